@@ -135,6 +135,58 @@ public:
  */
 extern OCIOEXPORT void ClearAllCaches();
 
+/**
+ * \brief Set the memory budget (in bytes) of the global cache holding the loaded LUT file
+ * content. The least recently used files are evicted when the budget is exceeded.
+ *
+ * The default budget comes from the OCIO_FILE_CACHE_BUDGET env. variable, and zero (i.e. the
+ * default when the env. variable is not set) means no limit.
+ *
+ * \note
+ *   The memory footprint of a file is the estimated in-memory size of its loaded content (i.e.
+ *   mostly the LUT values). An evicted file is reloaded the next time a processor using it is
+ *   created.
+ */
+extern OCIOEXPORT void SetFileCacheBudget(size_t numBytes);
+extern OCIOEXPORT size_t GetFileCacheBudget();
+
+/**
+ * \brief Get the statistics of the global cache holding the loaded LUT file content i.e. the
+ * number of cache hits, misses & evictions since the start of the process, and the current number
+ * of files with their estimated memory footprint (in bytes).
+ */
+extern OCIOEXPORT void GetFileCacheStatistics(size_t & numHits,
+                                              size_t & numMisses,
+                                              size_t & numEvictions,
+                                              size_t & numEntries,
+                                              size_t & numBytes);
+
+/**
+ * \brief Set the directory of the disk cache shared by the processes (e.g. the render tasks of
+ * a node). The cache holds the content of the LUT files, the fast inverse LUTs, the LUTs baked
+ * by the optimizer and the LUTs prepared by the CPU renderers so processes using the same
+ * directory only build them once. The LUTs are used in place from a memory mapping of the cache
+ * files so the processes also share their memory. An empty directory (i.e. the default when the
+ * OCIO_DISK_CACHE_DIR env. variable is not set) disables the disk cache.
+ *
+ * \note
+ *   The directory is created if needed. The cache entries are written by the library and
+ *   are specific to the library version. Any error accessing the cache is ignored (i.e. it is
+ *   then only logged in debug mode).
+ */
+extern OCIOEXPORT void SetDiskCacheDirectory(const char * dirname);
+extern OCIOEXPORT const char * GetDiskCacheDirectory();
+
+/**
+ * \brief Set the size budget (in bytes) of the disk cache directory. The least recently used
+ * entries are removed when the budget is exceeded.
+ *
+ * The default budget comes from the OCIO_DISK_CACHE_BUDGET env. variable, otherwise it is 1 GB.
+ * Zero means no limit.
+ */
+extern OCIOEXPORT void SetDiskCacheBudget(size_t numBytes);
+extern OCIOEXPORT size_t GetDiskCacheBudget();
+
 /**
  * \brief Get the version number for the library, as a dot-delimited string 
  *     (e.g., "1.0.0").
@@ -186,6 +238,24 @@ extern OCIOEXPORT void LogMessage(LoggingLevel level, const char * message);
 extern OCIOEXPORT void SetComputeHashFunction(ComputeHashFunction hashFunction);
 extern OCIOEXPORT void ResetComputeHashFunction();
 
+/**
+ * \brief Set the maximum number of pixels processed at once by the chain of CPU ops.
+ *
+ * By default (i.e. 0), each CPU op processes a complete scanline before the next op starts.
+ * A non-zero value cuts each scanline in chunks of that size and runs the complete chain of
+ * ops on one chunk before moving to the next, keeping the pixels in the processor caches
+ * (e.g. 256 pixels i.e. 4 KB for RGBA F32). The processing result is identical. Any value
+ * larger than the scanline width processes the complete scanline at once.
+ *
+ * \note
+ *     The setting is a process-wide performance tuning knob, not a per-processor setting. It
+ *     is an atomic value read once per scanline so it could be changed while other threads
+ *     apply processors: as the result is identical, a change only affects the performance of
+ *     the scanlines processed after it.
+ */
+extern OCIOEXPORT void SetCPUProcessorChunkSize(unsigned numPixels);
+extern OCIOEXPORT unsigned GetCPUProcessorChunkSize();
+
 //
 // Note that the following environment variable access methods are not thread safe.
 //
@@ -326,6 +396,9 @@ public:
      * See \ref Config::CreateFromBuiltinConfig.
      *
      * Supports archived configs (.ocioz files).
+     *
+     * Supports config snapshots (see \ref Config::serializeSnapshot) which are memory mapped and
+     * loaded without any YAML parsing.
      * 
      * \throw Exception If the file may not be read or does not parse.
      * \return The Config object.
@@ -341,6 +414,8 @@ public:
      *
      * Configs created from CreateFromStream can not be archived unless the working directory is 
      * set and contains any necessary LUT files.
+     *
+     * The stream could also contain a config snapshot (see \ref Config::serializeSnapshot).
      * 
      * \param istream Stream to the config.
      * \throw Exception If the stream does not parse.
@@ -426,6 +501,10 @@ public:
      * This will throw an exception if the config is malformed. The most
      * common error occurs when references are made to colorspaces that do not
      * exist.
+     *
+     * \note
+     *    All the transforms of a lazily loaded config are parsed so an invalid transform
+     *    definition is reported here (refer to OCIO_LAZY_LOADING_ENVVAR).
      */
     void validate() const;
 
@@ -467,6 +546,32 @@ public:
      */
     void serialize(std::ostream & os) const;
 
+    /**
+     * \brief Write a binary snapshot of the Config, to be loaded with \ref Config::CreateFromFile
+     * or \ref Config::CreateFromStream.
+     *
+     * A snapshot is a compact, versioned and checksummed encoding of the in-memory config which
+     * is much faster to load than its YAML text form e.g. to reduce the startup time of the
+     * processes loading the same large config. The snapshot keeps the working directory of the
+     * config to resolve the relative search paths. The environment variable values are not part
+     * of the snapshot i.e. they are read when loading it.
+     *
+     * A snapshot is only readable by an OCIO library using the same snapshot format version so
+     * it should be regenerated (e.g. using ociowrite) when the library is updated.
+     * NB: This does not validate the config.  Applications should validate before serializing.
+     */
+    void serializeSnapshot(std::ostream & os) const;
+
+    /**
+     * \brief Write the config snapshot (see \ref Config::serializeSnapshot) to a file.
+     *
+     * The snapshot is first written to a temporary file in the same directory which is then
+     * renamed, so a process loading the file never reads a partial snapshot.
+     *
+     * \throw Exception If the file may not be written.
+     */
+    void serializeSnapshot(const char * filename) const;
+
     /**
      * This will produce a hash of the all colorspace definitions, etc. All external references, 
      * such as files used in FileTransforms, etc., will be incorporated into the cacheID. While 
@@ -477,6 +582,10 @@ public:
      * 
      * If a null context is provided, file references will not be taken into 
      * account (this is essentially a hash of Config::serialize).
+     *
+     * \note
+     *    For a lazily loaded config, a non-null context parses all the transforms so it
+     *    throws if a transform definition is invalid.
      */
     const char * getCacheID() const;
     const char * getCacheID(const ConstContextRcPtr & context) const;
@@ -660,6 +769,8 @@ public:
      *
      * \note
      *    Name must be the canonical name.
+     * \note
+     *    Return true if a transform of a lazily loaded config fails to parse.
      */
     bool isColorSpaceUsed(const char * name) const noexcept;
 
@@ -1596,6 +1707,31 @@ public:
      */
     void clearProcessorCache() noexcept;
 
+    /**
+     * \brief Bound this config's cache of Processor instances.
+     * 
+     * The least recently used processors are evicted when there are more than maxProcessors
+     * processors or when their estimated memory footprint exceeds maxBytes. Zero means no limit,
+     * which is the default.
+     *
+     * \note
+     *   The memory footprint of a processor is estimated from its LUTs. An evicted processor
+     *   remains valid for its users and is only recreated the next time it is requested.
+     */
+    void setProcessorCacheLimits(size_t maxProcessors, size_t maxBytes) const;
+    void getProcessorCacheLimits(size_t & maxProcessors, size_t & maxBytes) const noexcept;
+
+    /**
+     * \brief Get the statistics of this config's cache of Processor instances i.e. the number of
+     * cache hits, misses & evictions since the config creation, and the current number of
+     * processors with their estimated memory footprint (in bytes).
+     */
+    void getProcessorCacheStatistics(size_t & numHits,
+                                     size_t & numMisses,
+                                     size_t & numEvictions,
+                                     size_t & numEntries,
+                                     size_t & numBytes) const noexcept;
+
     /// Set the ConfigIOProxy object used to provision the config and LUTs from somewhere other
     /// than the file system.  (This is set on the config's embedded Context object.)
     void setConfigIOProxy(ConfigIOProxyRcPtr ciop);
@@ -2192,8 +2328,13 @@ public:
      * 
      * If a transform in the specified direction has been specified,
      * return it. Otherwise return a null ConstTransformRcPtr
+     *
+     * \note
+     *    The transforms of a lazily loaded config are only parsed by the first call, which
+     *    throws if the transform definition is invalid (refer to OCIO_LAZY_LOADING_ENVVAR).
+     *    The later calls throw the same error. Config::validate reports all these errors.
      */
-    ConstTransformRcPtr getTransform(ColorSpaceDirection dir) const noexcept;
+    ConstTransformRcPtr getTransform(ColorSpaceDirection dir) const;
     /**
      * Specify the transform for the appropriate direction.
      * Setting the transform to null will clear it.
@@ -2209,6 +2350,8 @@ private:
     explicit ColorSpace(ReferenceSpaceType referenceSpace);
     ColorSpace();
 
+    friend class Config;
+
     static void deleter(ColorSpace* c);
 
     class Impl;
@@ -2438,6 +2581,8 @@ public:
 private:
     Look();
 
+    friend class Config;
+
     static void deleter(Look* c);
 
     class Impl;
@@ -2599,8 +2744,10 @@ public:
     /**
      * If a transform in the specified direction has been specified, return it.
      * Otherwise return a null ConstTransformRcPtr
+     *
+     * \see ColorSpace::getTransform
      */
-    ConstTransformRcPtr getTransform(ViewTransformDirection dir) const noexcept;
+    ConstTransformRcPtr getTransform(ViewTransformDirection dir) const;
 
     /**
      * Specify the transform for the appropriate direction. Setting the transform
@@ -2617,6 +2764,8 @@ private:
     ViewTransform();
     explicit ViewTransform(ReferenceSpaceType referenceSpace);
 
+    friend class Config;
+
     static void deleter(ViewTransform * c);
 
     class Impl;
@@ -2632,6 +2781,58 @@ extern OCIOEXPORT std::ostream& operator<< (std::ostream&, const ViewTransform&)
 //
 
 
+/**
+ * \brief The approximations of the CPU processing which change the processing result.
+ *
+ * They must be explicitly requested per CPUProcessor (refer to
+ * \ref Processor::getOptimizedCPUProcessor) i.e. they are never enabled by an OptimizationFlags
+ * value (including OPTIMIZATION_ALL) or by the OCIO_OPTIMIZATION_FLAGS environment variable.
+ */
+struct OCIOEXPORT CPUApproximations
+{
+    /**
+     * For 32-bit float input only, replace the separable ops (i.e. no channel crosstalk ops)
+     * at the start of the op list by a single half-domain 1D LUT evaluated with linear
+     * interpolation. Input values beyond the half float range are clamped.
+     */
+    bool m_separablePrefixF32{ false };
+
+    /**
+     * When the op list has channel crosstalk, bake it into a 3D LUT evaluated with tetrahedral
+     * interpolation, preceded for float input by a log2 shaper 1D LUT. The processing cost per
+     * pixel becomes fixed whatever the complexity of the color transformation.
+     */
+    bool m_bakeLut3D{ false };
+
+    /// The edge length of the baked 3D LUT, in the [2, 129] range.
+    unsigned m_bakeLut3DEdgeLength{ 65 };
+
+    /**
+     * The range of the log2 shaper used for float input, in stops around 0.18. The default
+     * [-10, +10] covers the values from 0.000176 to 184.3, other values are clamped. An empty
+     * range (i.e. minStops equals maxStops) removes the shaper so the 3D LUT covers the [0, 1]
+     * input range, which suits display-referred input. Integer input never uses a shaper.
+     */
+    double m_bakeLut3DShaperMinStops{ -10.0 };
+    double m_bakeLut3DShaperMaxStops{ 10.0 };
+
+    /**
+     * The maximum error allowed for the baked LUTs. They are compared to the original ops on
+     * samples located in between the 3D LUT grid points and, for float input, on samples
+     * outside of the LUT domain (i.e. negative values and values beyond the shaper range) which
+     * the baked LUTs clamp. The original ops are kept when the largest absolute difference
+     * exceeds it. The default (i.e. 0) always bakes the ops, even when the float input is not
+     * bounded. The error is also logged at the debug logging level.
+     */
+    double m_bakeLut3DMaxError{ 0.0 };
+
+    /// Throw if a setting is not valid.
+    void validate() const;
+
+    bool operator==(const CPUApproximations & rhs) const noexcept;
+    bool operator!=(const CPUApproximations & rhs) const noexcept { return !(*this == rhs); }
+};
+
 /**
  * The *Processor* represents a specific color transformation which is
  * the result of \ref Config::getProcessor.
@@ -2778,6 +2979,14 @@ public:
     ConstCPUProcessorRcPtr getOptimizedCPUProcessor(BitDepth inBitDepth,
                                                     BitDepth outBitDepth,
                                                     OptimizationFlags oFlags) const;
+    /**
+     * Get an optimized CPUProcessor instance using the requested approximations. The
+     * CPUProcessor instances are cached per optimization flags & approximations.
+     */
+    ConstCPUProcessorRcPtr getOptimizedCPUProcessor(BitDepth inBitDepth,
+                                                    BitDepth outBitDepth,
+                                                    OptimizationFlags oFlags,
+                                                    const CPUApproximations & approximations) const;
 
     Processor(const Processor &) = delete;
     Processor & operator= (const Processor &) = delete;
@@ -2832,6 +3041,10 @@ public:
      * \note The dynamic properties in this object are decoupled from the ones in the
      * \ref Processor it was generated from. For each dynamic property in the Processor,
      * there is one in the CPU processor.
+     *
+     * \note The values may be set while other threads are applying the CPU processor. Each
+     * apply call uses one consistent version of all the dynamic properties i.e. the values
+     * published when the call started.
      */
     DynamicPropertyRcPtr getDynamicProperty(DynamicPropertyType type) const;
     /// True if at least one dynamic property of that type exists.
@@ -2839,6 +3052,28 @@ public:
     /// True if at least one dynamic property of any type exists and is dynamic.
     bool isDynamic() const noexcept;
 
+    /**
+     * \brief Start a grouped update of the dynamic properties of the processor.
+     *
+     * Until \ref CPUProcessor::commitDynamicPropertyUpdate is called, the setValue methods of
+     * the dynamic properties from \ref CPUProcessor::getDynamicProperty only validate and stage
+     * the new values: the apply methods (and the getValue methods) keep using the current
+     * values. Throws if an update is already in progress.
+     */
+    void beginDynamicPropertyUpdate() const;
+    /**
+     * \brief Prepare the staged values on the calling thread (e.g. the spline coefficients of
+     * the grading curves) and publish them to the apply methods.
+     *
+     * Only the dynamic properties set since \ref CPUProcessor::beginDynamicPropertyUpdate are
+     * prepared, once each whatever the number of setValue calls. The knots & coefficients
+     * of the grading curves are swapped in atomically, an apply running concurrently uses
+     * either the previous or the new curves. Returns the number of dynamic properties set
+     * during the update, even if a new value equals the previous one. Throws if no update is
+     * in progress.
+     */
+    int commitDynamicPropertyUpdate() const;
+
     /**
      * \brief Apply to an image with any kind of channel ordering while
      * respecting the input and output bit-depths.
@@ -2846,6 +3081,17 @@ public:
     void apply(const ImageDesc & imgDesc) const;
     void apply(const ImageDesc & srcImgDesc, ImageDesc & dstImgDesc) const;
 
+    /**
+     * \brief Same as above but the image is split in numThreads bands of lines which are
+     * processed concurrently by the calling thread and by the worker threads of a pool shared
+     * by the library (i.e. the threads are only created once).
+     *
+     * A numThreads of 0 uses the number of hardware threads. The result is identical to the
+     * single threaded apply.
+     */
+    void apply(const ImageDesc & imgDesc, unsigned numThreads) const;
+    void apply(const ImageDesc & srcImgDesc, ImageDesc & dstImgDesc, unsigned numThreads) const;
+
     /**
      * Apply to a single pixel respecting that the input and output bit-depths
      * be 32-bit float and the image buffer be packed RGB/RGBA.
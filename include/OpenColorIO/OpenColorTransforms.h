@@ -827,7 +827,7 @@ protected:
 class OCIOEXPORT DynamicPropertyGradingPrimary
 {
 public:
-    virtual const GradingPrimary & getValue() const = 0;
+    virtual GradingPrimary getValue() const = 0;
     /// Will throw if value is not valid.
     virtual void setValue(const GradingPrimary & value) = 0;
 
@@ -844,7 +844,7 @@ protected:
 class OCIOEXPORT DynamicPropertyGradingRGBCurve
 {
 public:
-    virtual const ConstGradingRGBCurveRcPtr & getValue() const = 0;
+    virtual ConstGradingRGBCurveRcPtr getValue() const = 0;
     /// Will throw if value is not valid.
     virtual void setValue(const ConstGradingRGBCurveRcPtr & value) = 0;
 
@@ -861,7 +861,7 @@ protected:
 class OCIOEXPORT DynamicPropertyGradingHueCurve
 {
 public:
-    virtual const ConstGradingHueCurveRcPtr & getValue() const = 0;
+    virtual ConstGradingHueCurveRcPtr getValue() const = 0;
     /// Will throw if value is not valid.
     virtual void setValue(const ConstGradingHueCurveRcPtr & value) = 0;
 
@@ -878,7 +878,7 @@ protected:
 class OCIOEXPORT DynamicPropertyGradingTone
 {
 public:
-    virtual const GradingTone & getValue() const = 0;
+    virtual GradingTone getValue() const = 0;
     /// Will throw if value is not valid.
     virtual void setValue(const GradingTone & value) = 0;
 
@@ -1256,7 +1256,7 @@ public:
     /// Will reset value to style's defaults if style is not the current style.
     virtual void setStyle(GradingStyle style) noexcept = 0;
 
-    virtual const GradingPrimary & getValue() const = 0;
+    virtual GradingPrimary getValue() const = 0;
     /// Throws if value is not valid.
     virtual void setValue(const GradingPrimary & values) = 0;
 
@@ -1504,7 +1504,7 @@ public:
     /// Will reset value to style's defaults if style is not the current style.
     virtual void setStyle(GradingStyle style) noexcept = 0;
 
-    virtual const GradingTone & getValue() const = 0;
+    virtual GradingTone getValue() const = 0;
     virtual void setValue(const GradingTone & values) = 0;
 
     /**
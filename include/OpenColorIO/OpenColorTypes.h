@@ -842,6 +842,16 @@ extern OCIOEXPORT const char * OCIO_OPTIMIZATION_FLAGS_ENVVAR;
  */
 extern OCIOEXPORT const char * OCIO_USER_CATEGORIES_ENVVAR;
 
+/**
+ * The envvar 'OCIO_LAZY_LOADING' (when present) makes the config loading only keep the text
+ * of the color space, look, view transform and named transform transforms.  Each transform is
+ * then parsed the first time it is used (e.g. by a getProcessor() call), which makes the loading
+ * of large configs faster when an application only uses a few of their color spaces.  Note that
+ * an invalid transform is then only reported when it is used (i.e. the ColorSpace and
+ * ViewTransform getTransform methods throw) or when the config is validated.
+ */
+extern OCIOEXPORT const char * OCIO_LAZY_LOADING_ENVVAR;
+
 // TODO: Move to .rst
 /*!rst::
 Roles
@@ -1012,6 +1022,31 @@ extern OCIOEXPORT const char * OCIO_DISABLE_PROCESSOR_CACHES;
 // variable to disable the fallback.
 extern OCIOEXPORT const char * OCIO_DISABLE_CACHE_FALLBACK;
 
+//!rst::
+// .. c:var:: const char * OCIO_FILE_CACHE_BUDGET
+//
+// The initial memory budget (in bytes) of the FileTransform cache. The least recently used files
+// are evicted when the budget is exceeded. Unset or zero means no limit (refer to
+// SetFileCacheBudget).
+extern OCIOEXPORT const char * OCIO_FILE_CACHE_BUDGET;
+
+//!rst::
+// .. c:var:: const char * OCIO_DISK_CACHE_DIR
+//
+// The directory of the disk cache shared by the processes e.g. the render tasks of a node. The
+// cache holds the LUT file content, the fast inverse LUTs and the LUTs baked by the optimizer so
+// they are only built once. Unset or empty disables the disk cache (refer to
+// SetDiskCacheDirectory).
+extern OCIOEXPORT const char * OCIO_DISK_CACHE_DIR;
+
+//!rst::
+// .. c:var:: const char * OCIO_DISK_CACHE_BUDGET
+//
+// The initial size budget (in bytes) of the disk cache directory. The least recently used entries
+// are removed when the budget is exceeded. Unset means 1 GB and zero means no limit (refer to
+// SetDiskCacheBudget).
+extern OCIOEXPORT const char * OCIO_DISK_CACHE_BUDGET;
+
 
 // Archive config feature
 // Default filename (with extension) of an config.
@@ -299,6 +299,95 @@ struct AVX2RGBAPack<BIT_DEPTH_F32>
     }
 };
 
+// Operations on the float vectors of the SoA renderers (refer to SIMDMath.h).
+struct AVX2FloatOps
+{
+    typedef __m256 Float;
+    typedef __m256 Mask;
+
+    static constexpr unsigned size = 8;
+
+    static inline void loadRGBA(const float * in, Float & r, Float & g, Float & b, Float & a)
+    {
+        // Note: The channel values end up in an even/odd shuffled order (refer to
+        // avx2RGBATranspose_4x4_4x4) which is restored by storeRGBA.
+        avx2RGBATranspose_4x4_4x4(_mm256_loadu_ps(in +  0), _mm256_loadu_ps(in +  8),
+                                  _mm256_loadu_ps(in + 16), _mm256_loadu_ps(in + 24),
+                                  r, g, b, a);
+    }
+
+    static inline void storeRGBA(float * out, Float r, Float g, Float b, Float a)
+    {
+        AVX2RGBAPack<BIT_DEPTH_F32>::Store(out, r, g, b, a);
+    }
+
+    static inline Float load(const float * in) { return _mm256_loadu_ps(in); }
+    static inline void store(float * out, Float v) { _mm256_storeu_ps(out, v); }
+
+    static inline Float set1(float v) { return _mm256_set1_ps(v); }
+
+    static inline Float add(Float a, Float b) { return _mm256_add_ps(a, b); }
+    static inline Float sub(Float a, Float b) { return _mm256_sub_ps(a, b); }
+    static inline Float mul(Float a, Float b) { return _mm256_mul_ps(a, b); }
+    static inline Float div(Float a, Float b) { return _mm256_div_ps(a, b); }
+    static inline Float min(Float a, Float b) { return _mm256_min_ps(a, b); }
+    static inline Float max(Float a, Float b) { return _mm256_max_ps(a, b); }
+
+    static inline Float sqrt(Float a)  { return _mm256_sqrt_ps(a); }
+    static inline Float floor(Float a) { return _mm256_floor_ps(a); }
+    static inline Float ceil(Float a)  { return _mm256_ceil_ps(a); }
+
+    static inline Float abs(Float a)
+    {
+        return _mm256_andnot_ps(_mm256_set1_ps(-0.f), a);
+    }
+
+    static inline Float copySign(Float mag, Float sgn)
+    {
+        const __m256 signMask = _mm256_set1_ps(-0.f);
+        return _mm256_or_ps(_mm256_andnot_ps(signMask, mag), _mm256_and_ps(signMask, sgn));
+    }
+
+    static inline Mask lt(Float a, Float b) { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+    static inline Mask le(Float a, Float b) { return _mm256_cmp_ps(a, b, _CMP_LE_OQ); }
+    static inline Mask gt(Float a, Float b) { return _mm256_cmp_ps(a, b, _CMP_GT_OQ); }
+    static inline Mask ge(Float a, Float b) { return _mm256_cmp_ps(a, b, _CMP_GE_OQ); }
+    static inline Mask eq(Float a, Float b) { return _mm256_cmp_ps(a, b, _CMP_EQ_OQ); }
+    static inline Mask neq(Float a, Float b) { return _mm256_cmp_ps(a, b, _CMP_NEQ_UQ); }
+
+    static inline Mask maskAnd(Mask a, Mask b) { return _mm256_and_ps(a, b); }
+    static inline Mask maskOr(Mask a, Mask b)  { return _mm256_or_ps(a, b); }
+    static inline Mask maskNot(Mask a)
+    {
+        return _mm256_xor_ps(a, _mm256_castsi256_ps(_mm256_set1_epi32(-1)));
+    }
+
+    static inline bool any(Mask m) { return _mm256_movemask_ps(m) != 0; }
+    static inline bool all(Mask m) { return _mm256_movemask_ps(m) == 0xff; }
+
+    static inline Float select(Mask m, Float a, Float b) { return _mm256_blendv_ps(b, a, m); }
+
+    static inline Float exponent(Float x)
+    {
+        const __m256i bits = _mm256_and_si256(_mm256_castps_si256(x),
+                                              _mm256_set1_epi32(0x7F800000));
+        return _mm256_cvtepi32_ps(_mm256_sub_epi32(_mm256_srli_epi32(bits, 23),
+                                                   _mm256_set1_epi32(127)));
+    }
+
+    static inline Float mantissa(Float x)
+    {
+        return _mm256_or_ps(_mm256_andnot_ps(_mm256_castsi256_ps(_mm256_set1_epi32(0x7F800000)), x),
+                            _mm256_set1_ps(1.f));
+    }
+
+    static inline Float pow2i(Float n)
+    {
+        return _mm256_castsi256_ps(
+            _mm256_slli_epi32(_mm256_add_epi32(_mm256_cvttps_epi32(n), _mm256_set1_epi32(127)), 23));
+    }
+};
+
 } // namespace OCIO_NAMESPACE
 
 #endif // OCIO_USE_AVX2
@@ -460,6 +460,102 @@ struct AVX512RGBAPack<BIT_DEPTH_F32>
     }
 };
 
+// Operations on the float vectors of the SoA renderers (refer to SIMDMath.h).
+struct AVX512FloatOps
+{
+    typedef __m512    Float;
+    typedef __mmask16 Mask;
+
+    static constexpr unsigned size = 16;
+
+    static inline void loadRGBA(const float * in, Float & r, Float & g, Float & b, Float & a)
+    {
+        AVX512RGBAPack<BIT_DEPTH_F32>::Load(in, r, g, b, a);
+    }
+
+    static inline void storeRGBA(float * out, Float r, Float g, Float b, Float a)
+    {
+        AVX512RGBAPack<BIT_DEPTH_F32>::Store(out, r, g, b, a);
+    }
+
+    static inline Float load(const float * in) { return _mm512_loadu_ps(in); }
+    static inline void store(float * out, Float v) { _mm512_storeu_ps(out, v); }
+
+    static inline Float set1(float v) { return _mm512_set1_ps(v); }
+
+    static inline Float add(Float a, Float b) { return _mm512_add_ps(a, b); }
+    static inline Float sub(Float a, Float b) { return _mm512_sub_ps(a, b); }
+    static inline Float mul(Float a, Float b) { return _mm512_mul_ps(a, b); }
+    static inline Float div(Float a, Float b) { return _mm512_div_ps(a, b); }
+    static inline Float min(Float a, Float b) { return _mm512_min_ps(a, b); }
+    static inline Float max(Float a, Float b) { return _mm512_max_ps(a, b); }
+
+    static inline Float sqrt(Float a) { return _mm512_sqrt_ps(a); }
+
+    static inline Float floor(Float a)
+    {
+        return _mm512_roundscale_ps(a, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+    }
+
+    static inline Float ceil(Float a)
+    {
+        return _mm512_roundscale_ps(a, _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC);
+    }
+
+    // Note: The bit-wise float operations need AVX512DQ so use the integer ones.
+    static inline Float abs(Float a)
+    {
+        return _mm512_castsi512_ps(_mm512_and_si512(_mm512_castps_si512(a),
+                                                    _mm512_set1_epi32(0x7FFFFFFF)));
+    }
+
+    static inline Float copySign(Float mag, Float sgn)
+    {
+        const __m512i signMask = _mm512_set1_epi32((int)0x80000000);
+        return _mm512_castsi512_ps(
+            _mm512_or_si512(_mm512_andnot_si512(signMask, _mm512_castps_si512(mag)),
+                            _mm512_and_si512(signMask, _mm512_castps_si512(sgn))));
+    }
+
+    static inline Mask lt(Float a, Float b) { return _mm512_cmp_ps_mask(a, b, _CMP_LT_OQ); }
+    static inline Mask le(Float a, Float b) { return _mm512_cmp_ps_mask(a, b, _CMP_LE_OQ); }
+    static inline Mask gt(Float a, Float b) { return _mm512_cmp_ps_mask(a, b, _CMP_GT_OQ); }
+    static inline Mask ge(Float a, Float b) { return _mm512_cmp_ps_mask(a, b, _CMP_GE_OQ); }
+    static inline Mask eq(Float a, Float b) { return _mm512_cmp_ps_mask(a, b, _CMP_EQ_OQ); }
+    static inline Mask neq(Float a, Float b) { return _mm512_cmp_ps_mask(a, b, _CMP_NEQ_UQ); }
+
+    static inline Mask maskAnd(Mask a, Mask b) { return (Mask)(a & b); }
+    static inline Mask maskOr(Mask a, Mask b)  { return (Mask)(a | b); }
+    static inline Mask maskNot(Mask a)         { return (Mask)~a; }
+
+    static inline bool any(Mask m) { return m != 0; }
+    static inline bool all(Mask m) { return m == 0xFFFF; }
+
+    static inline Float select(Mask m, Float a, Float b) { return _mm512_mask_blend_ps(m, b, a); }
+
+    static inline Float exponent(Float x)
+    {
+        const __m512i bits = _mm512_and_si512(_mm512_castps_si512(x),
+                                              _mm512_set1_epi32(0x7F800000));
+        return _mm512_cvtepi32_ps(_mm512_sub_epi32(_mm512_srli_epi32(bits, 23),
+                                                   _mm512_set1_epi32(127)));
+    }
+
+    static inline Float mantissa(Float x)
+    {
+        return _mm512_castsi512_ps(
+            _mm512_or_si512(_mm512_andnot_si512(_mm512_set1_epi32(0x7F800000),
+                                                _mm512_castps_si512(x)),
+                            _mm512_castps_si512(_mm512_set1_ps(1.f))));
+    }
+
+    static inline Float pow2i(Float n)
+    {
+        return _mm512_castsi512_ps(
+            _mm512_slli_epi32(_mm512_add_epi32(_mm512_cvttps_epi32(n), _mm512_set1_epi32(127)), 23));
+    }
+};
+
 } // namespace OCIO_NAMESPACE
 
 #endif // OCIO_USE_AVX512
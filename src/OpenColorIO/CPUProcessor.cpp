@@ -1,17 +1,24 @@
 // SPDX-License-Identifier: BSD-3-Clause
 // Copyright Contributors to the OpenColorIO Project.
 
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <new>
 #include <string.h>
+#include <thread>
 
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "BitDepthUtils.h"
 #include "CPUProcessor.h"
+#include "ImagePacking.h"
 #include "ops/lut1d/Lut1DOpCPU.h"
 #include "ops/lut3d/Lut3DOpCPU.h"
 #include "ops/matrix/MatrixOp.h"
 #include "ops/range/RangeOpCPU.h"
 #include "ScanlineHelper.h"
+#include "ThreadPool.h"
 
 
 namespace OCIO_NAMESPACE
@@ -63,6 +70,21 @@ public:
             memcpy(outImg, inImg, 4*numPixels*sizeof(float));
         }
     }
+
+    bool hasPlanarApply() const override { return true; }
+
+    void applyPlanar(const float * const inPlanes[4],
+                     float * const outPlanes[4],
+                     long numPixels) const override
+    {
+        for(int c=0; c<4; ++c)
+        {
+            if(inPlanes[c]!=outPlanes[c])
+            {
+                memcpy(outPlanes[c], inPlanes[c], numPixels*sizeof(float));
+            }
+        }
+    }
 };
 
 ConstOpCPURcPtr CreateGenericBitDepthHelper(BitDepth in, BitDepth out)
@@ -184,16 +206,43 @@ void CreateCPUEngine(const OpRcPtrVec & ops,
 }
 
 
+namespace
+{
+
+// Storage for any of the GenericScanlineHelper instances (i.e. they all have the same layout)
+// to avoid a heap allocation per apply call.
+struct ScanlineHelperStorage
+{
+    alignas(GenericScanlineHelper<float, float>)
+        unsigned char m_data[sizeof(GenericScanlineHelper<float, float>)];
+};
+
+struct ScanlineHelperDeleter
+{
+    void operator()(ScanlineHelper * helper) const noexcept
+    {
+        helper->~ScanlineHelper();
+    }
+};
+
+typedef std::unique_ptr<ScanlineHelper, ScanlineHelperDeleter> ScanlineHelperPtr;
+
+} // anon
+
 ScanlineHelper * CreateScanlineHelper(BitDepth in, const ConstOpCPURcPtr & inBitDepthOp,
-                                      BitDepth out, const ConstOpCPURcPtr & outBitDepthOp)
+                                      BitDepth out, const ConstOpCPURcPtr & outBitDepthOp,
+                                      ScanlineHelperStorage * storage)
 {
 
 #define ADD_OUT_BIT_DEPTH(in, out)                    \
 case out:                                             \
 {                                                     \
-    return new GenericScanlineHelper<BitDepthInfo<in>::Type,                      \
-                                     BitDepthInfo<out>::Type>(in, inBitDepthOp,   \
-                                                              out, outBitDepthOp);\
+    typedef GenericScanlineHelper<BitDepthInfo<in>::Type,                         \
+                                  BitDepthInfo<out>::Type> Helper;                \
+    static_assert(sizeof(Helper) <= sizeof(ScanlineHelperStorage)                 \
+                    && alignof(Helper) <= alignof(ScanlineHelperStorage),         \
+                  "Scanline helper storage is too small");                        \
+    return new (storage) Helper(in, inBitDepthOp, out, outBitDepthOp);            \
     break;                                            \
 }
 
@@ -308,9 +357,96 @@ DynamicPropertyRcPtr CPUProcessor::Impl::getDynamicProperty(DynamicPropertyType
     throw Exception("Cannot find dynamic property; not used by CPU processor.");
 }
 
+void CPUProcessor::Impl::beginDynamicPropertyUpdate() const
+{
+    AutoMutex lock(m_mutex);
+
+    if (m_updateInProgress)
+    {
+        throw Exception("A dynamic property update is already in progress.");
+    }
+
+    for (const auto & prop : m_dynamicProperties)
+    {
+        prop->beginUpdate();
+    }
+    m_updateInProgress = true;
+}
+
+int CPUProcessor::Impl::commitDynamicPropertyUpdate() const
+{
+    AutoMutex lock(m_mutex);
+
+    if (!m_updateInProgress)
+    {
+        throw Exception("There is no dynamic property update in progress.");
+    }
+
+    // Prepare all the new versions first so that the renderers taking a snapshot are never
+    // delayed by the preparation costs.
+
+    int numUpdated = 0;
+    for (const auto & prop : m_dynamicProperties)
+    {
+        if (prop->prepareUpdate())
+        {
+            ++numUpdated;
+        }
+    }
+
+    // Publish them at once i.e. an odd epoch means a publication is in progress.
+
+    m_publishEpoch.fetch_add(1, std::memory_order_acq_rel);
+
+    for (const auto & prop : m_dynamicProperties)
+    {
+        prop->commitUpdate();
+    }
+
+    m_publishEpoch.fetch_add(1, std::memory_order_release);
+
+    m_updateInProgress = false;
+
+    return numUpdated;
+}
+
+DynamicPropertySnapshot CPUProcessor::Impl::getDynamicPropertySnapshot() const
+{
+    DynamicPropertySnapshot snapshot;
+    if (!m_dynamicProperties.empty())
+    {
+        loadDynamicPropertySnapshot(snapshot);
+    }
+    return snapshot;
+}
+
+void CPUProcessor::Impl::loadDynamicPropertySnapshot(DynamicPropertySnapshot & snapshot) const
+{
+    // The readers never block the writers: they simply retry if a grouped publication was
+    // concurrently in progress.
+
+    for (;;)
+    {
+        const unsigned epoch = m_publishEpoch.load(std::memory_order_acquire);
+        if ((epoch & 1) == 0)
+        {
+            snapshot.load(m_dynamicProperties);
+
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (m_publishEpoch.load(std::memory_order_relaxed) == epoch)
+            {
+                return;
+            }
+        }
+
+        std::this_thread::yield();
+    }
+}
+
 void FinalizeOpsForCPU(OpRcPtrVec & ops, const OpRcPtrVec & rawOps,
                        BitDepth in, BitDepth out,
-                       OptimizationFlags oFlags)
+                       OptimizationFlags oFlags,
+                       const CPUApproximations & approximations)
 {
     ops = rawOps;
 
@@ -321,7 +457,7 @@ void FinalizeOpsForCPU(OpRcPtrVec & ops, const OpRcPtrVec & rawOps,
 
         // Optimize the ops.
         ops.optimize(oFlags);
-        ops.optimizeForBitdepth(in, out, oFlags);
+        ops.optimizeForBitdepth(in, out, oFlags, approximations);
     }
 
     // The previous code could change the list of ops so an explicit check to empty is still needed.
@@ -340,14 +476,15 @@ void FinalizeOpsForCPU(OpRcPtrVec & ops, const OpRcPtrVec & rawOps,
 
 void CPUProcessor::Impl::finalize(const OpRcPtrVec & rawOps,
                                   BitDepth in, BitDepth out,
-                                  OptimizationFlags oFlags)
+                                  OptimizationFlags oFlags,
+                                  const CPUApproximations & approximations)
 {
     AutoMutex lock(m_mutex);
 
     // Get the ops of the color transformation without the bit-depth adjustments.
 
     OpRcPtrVec ops;
-    FinalizeOpsForCPU(ops, rawOps, in, out, oFlags);
+    FinalizeOpsForCPU(ops, rawOps, in, out, oFlags, approximations);
 
     m_inBitDepth  = in;
     m_outBitDepth = out;
@@ -365,6 +502,45 @@ void CPUProcessor::Impl::finalize(const OpRcPtrVec & rawOps,
     m_outBitDepthOp = nullptr;
     CreateCPUEngine(ops, in, out, oFlags, m_inBitDepthOp, m_cpuOps, m_outBitDepthOp);
 
+    // Collect the dynamic properties for the grouped updates.
+
+    m_dynamicProperties.clear();
+    m_updateInProgress = false;
+
+    ConstOpCPURcPtrVec allOps{ m_inBitDepthOp };
+    allOps.insert(allOps.end(), m_cpuOps.begin(), m_cpuOps.end());
+    allOps.push_back(m_outBitDepthOp);
+
+    for (int type = DYNAMIC_PROPERTY_EXPOSURE; type <= DYNAMIC_PROPERTY_GRADING_HUECURVE; ++type)
+    {
+        for (const auto & op : allOps)
+        {
+            if (op->hasDynamicProperty(static_cast<DynamicPropertyType>(type)))
+            {
+                auto prop = OCIO_DYNAMIC_POINTER_CAST<DynamicPropertyImpl>(
+                    op->getDynamicProperty(static_cast<DynamicPropertyType>(type)));
+
+                if (prop && std::find(m_dynamicProperties.begin(),
+                                      m_dynamicProperties.end(),
+                                      prop) == m_dynamicProperties.end())
+                {
+                    m_dynamicProperties.push_back(prop);
+                }
+            }
+        }
+    }
+
+    // Could the planar F32 images be processed without packing all the pixels in RGBA? Only the
+    // ops without a planar path then process packed RGBA pixels.
+
+    m_planarOps.clear();
+    if (in == BIT_DEPTH_F32 && out == BIT_DEPTH_F32
+        && std::any_of(m_cpuOps.begin(), m_cpuOps.end(),
+                       [](const ConstOpCPURcPtr & op) { return op->hasPlanarApply(); }))
+    {
+        m_planarOps = allOps;
+    }
+
     // Compute the cache id.
 
     std::stringstream ss;
@@ -376,92 +552,367 @@ void CPUProcessor::Impl::finalize(const OpRcPtrVec & rawOps,
     m_cacheID = ss.str();
 }
 
-void CPUProcessor::Impl::apply(const ImageDesc & imgDesc) const
-{   
-    // Get the ScanlineHelper for this thread (no significant performance impact).
-    std::unique_ptr<ScanlineHelper> 
-        scanlineBuilder(CreateScanlineHelper(m_inBitDepth, m_inBitDepthOp,
-                                             m_outBitDepth, m_outBitDepthOp));
+namespace
+{
 
-    // Prepare the processing.
-    scanlineBuilder->init(imgDesc);
+// Maximum number of pixels processed at once by the chain of CPU ops (0 means the scanline).
+std::atomic<unsigned> g_chunkSize{ 0 };
+
+// Return the number of pixels of the chunks for a scanline of numPixels pixels.
+long GetChunkSize(long numPixels)
+{
+    const unsigned chunkSize = g_chunkSize.load(std::memory_order_relaxed);
 
+    // Note that any size larger than the scanline (e.g. UINT_MAX) processes the complete
+    // scanline at once.
+    return (chunkSize == 0 || (unsigned long)chunkSize >= (unsigned long)numPixels)
+               ? numPixels
+               : (long)chunkSize;
+}
+
+// Process all the lines selected by the scanline helper.
+void ProcessScanlines(ScanlineHelper & scanlineBuilder, const ConstOpCPURcPtrVec & cpuOps)
+{
     float * rgbaBuffer = nullptr;
     long numPixels = 0;
 
+    const size_t numOps = cpuOps.size();
+
     while(true)
     {
-        scanlineBuilder->prepRGBAScanline(&rgbaBuffer, numPixels);
+        scanlineBuilder.prepRGBAScanline(&rgbaBuffer, numPixels);
         if(numPixels == 0) break;
 
-        const size_t numOps = m_cpuOps.size();
-        for(size_t i = 0; i<numOps; ++i)
+        const long chunkSize = GetChunkSize(numPixels);
+
+        if(chunkSize == numPixels)
+        {
+            for(size_t i = 0; i<numOps; ++i)
+            {
+                cpuOps[i]->apply(rgbaBuffer, rgbaBuffer, numPixels);
+            }
+        }
+        else
+        {
+            // Run the complete chain of ops on a chunk of the scanline while it is still
+            // in the processor caches, before moving to the next chunk.
+            for(long start = 0; start<numPixels; start += chunkSize)
+            {
+                float * chunk = rgbaBuffer + 4 * start;
+                const long numChunkPixels = std::min(chunkSize, numPixels - start);
+
+                for(size_t i = 0; i<numOps; ++i)
+                {
+                    cpuOps[i]->apply(chunk, chunk, numChunkPixels);
+                }
+            }
+        }
+
+        scanlineBuilder.finishRGBAScanline();
+    }
+}
+
+unsigned GetNumBands(unsigned numThreads, long height)
+{
+    if (numThreads == 0)
+    {
+        numThreads = GetNumHardwareThreads();
+    }
+
+    return (unsigned)std::max(1L, std::min((long)numThreads, height));
+}
+
+// Is it a planar F32 image with contiguous values in each plane?
+bool IsPlanarFloat(const ImageDesc & img)
+{
+    return dynamic_cast<const PlanarImageDesc *>(&img)
+            && img.getBitDepth() == BIT_DEPTH_F32
+            && img.getXStrideBytes() == (ptrdiff_t)sizeof(float);
+}
+
+// Apply an op on planar F32 pixels. The ops without a planar path process a packed RGBA copy
+// of the pixels (i.e. a run of such ops is packed & unpacked only once). Return the index of
+// the next op to apply.
+size_t ApplyPlanarOps(const ConstOpCPURcPtrVec & ops,
+                      size_t opIdx,
+                      const float * const inPlanes[4],
+                      float * const outPlanes[4],
+                      float * rgbaBuffer,
+                      long numPixels)
+{
+    if (ops[opIdx]->hasPlanarApply())
+    {
+        ops[opIdx]->applyPlanar(inPlanes, outPlanes, numPixels);
+        return opIdx + 1;
+    }
+
+    static PackRGBAFunc * packFunc     = GetPlanarFloatPackFunc();
+    static UnpackRGBAFunc * unpackFunc = GetPlanarFloatUnpackFunc();
+
+    packFunc(reinterpret_cast<const char * const *>(inPlanes), rgbaBuffer, numPixels);
+
+    for (; opIdx < ops.size() && !ops[opIdx]->hasPlanarApply(); ++opIdx)
+    {
+        ops[opIdx]->apply(rgbaBuffer, rgbaBuffer, numPixels);
+    }
+
+    unpackFunc(rgbaBuffer, reinterpret_cast<char * const *>(outPlanes), numPixels);
+
+    return opIdx;
+}
+
+// Process the lines [yBegin, yEnd) of planar F32 images directly on the planes.
+void ProcessPlanarLines(const ImageDesc & srcImg,
+                        const ImageDesc & dstImg,
+                        long yBegin,
+                        long yEnd,
+                        const ConstOpCPURcPtrVec & ops)
+{
+    const long width     = dstImg.getWidth();
+    const long chunkSize = GetChunkSize(width);
+
+    const ptrdiff_t srcYStrideBytes = srcImg.getYStrideBytes();
+    const ptrdiff_t dstYStrideBytes = dstImg.getYStrideBytes();
+
+    char * srcData[4] = { (char *)srcImg.getRData(), (char *)srcImg.getGData(),
+                          (char *)srcImg.getBData(), (char *)srcImg.getAData() };
+    char * dstData[4] = { (char *)dstImg.getRData(), (char *)dstImg.getGData(),
+                          (char *)dstImg.getBData(), (char *)dstImg.getAData() };
+
+    // The scratch memory holds the packed RGBA pixels for the ops without a planar path
+    // followed by the replacement of a missing alpha plane (i.e. an opaque alpha on input).
+    const size_t rgbaBytes = ScratchBuffer::AlignSize(4 * chunkSize * sizeof(float));
+
+    ScratchBuffer scratch;
+    char * scratchData = static_cast<char *>(scratch.acquire(rgbaBytes + chunkSize * sizeof(float)));
+
+    float * rgbaBuffer = reinterpret_cast<float *>(scratchData);
+    float * alphaPlane = reinterpret_cast<float *>(scratchData + rgbaBytes);
+
+    const float * inPlanes[4];
+    float * outPlanes[4];
+
+    for (long y = yBegin; y < yEnd; ++y)
+    {
+        for (long x = 0; x < width; x += chunkSize)
         {
-            m_cpuOps[i]->apply(rgbaBuffer, rgbaBuffer, numPixels);
+            const long numPixels = std::min(chunkSize, width - x);
+
+            for (int c = 0; c < 4; ++c)
+            {
+                inPlanes[c]  = srcData[c] ? (float *)(srcData[c] + srcYStrideBytes * y) + x
+                                          : alphaPlane;
+                outPlanes[c] = dstData[c] ? (float *)(dstData[c] + dstYStrideBytes * y) + x
+                                          : alphaPlane;
+            }
+
+            if (!srcData[3])
+            {
+                std::fill(alphaPlane, alphaPlane + numPixels, 1.0f);
+            }
+
+            // The first op reads the source planes and all the others the destination ones.
+            size_t opIdx = ApplyPlanarOps(ops, 0, inPlanes, outPlanes, rgbaBuffer, numPixels);
+            while (opIdx < ops.size())
+            {
+                opIdx = ApplyPlanarOps(ops, opIdx, outPlanes, outPlanes, rgbaBuffer, numPixels);
+            }
         }
+    }
+}
+
+} // anon
 
-        scanlineBuilder->finishRGBAScanline();
+bool CPUProcessor::Impl::usePlanarApply(const ImageDesc & srcImgDesc,
+                                        const ImageDesc & dstImgDesc) const
+{
+    if (m_planarOps.empty() || !IsPlanarFloat(srcImgDesc) || !IsPlanarFloat(dstImgDesc))
+    {
+        return false;
+    }
+
+    if (srcImgDesc.getWidth() != dstImgDesc.getWidth()
+        || srcImgDesc.getHeight() != dstImgDesc.getHeight())
+    {
+        throw Exception("Dimension inconsistency between source and destination image buffers.");
     }
+
+    return true;
+}
+
+void CPUProcessor::Impl::apply(const ImageDesc & imgDesc) const
+{   
+    // All the ops use the same version of the dynamic properties.
+    const DynamicPropertySnapshot snapshot = getDynamicPropertySnapshot();
+    const DynamicPropertySnapshot::Pin pin(snapshot);
+
+    if (usePlanarApply(imgDesc, imgDesc))
+    {
+        ProcessPlanarLines(imgDesc, imgDesc, 0, imgDesc.getHeight(), m_planarOps);
+        return;
+    }
+
+    // Get the ScanlineHelper for this thread (no heap allocation).
+    ScanlineHelperStorage storage;
+    ScanlineHelperPtr scanlineBuilder(CreateScanlineHelper(m_inBitDepth, m_inBitDepthOp,
+                                                           m_outBitDepth, m_outBitDepthOp,
+                                                           &storage));
+
+    // Prepare the processing.
+    scanlineBuilder->init(imgDesc);
+
+    ProcessScanlines(*scanlineBuilder, m_cpuOps);
 }
 
 void CPUProcessor::Impl::apply(const ImageDesc & srcImgDesc, ImageDesc & dstImgDesc) const
 {
-    // Get the ScanlineHelper for this thread (no significant performance impact).
-    std::unique_ptr<ScanlineHelper> 
-        scanlineBuilder(CreateScanlineHelper(m_inBitDepth, m_inBitDepthOp,
-                                             m_outBitDepth, m_outBitDepthOp));
+    // All the ops use the same version of the dynamic properties.
+    const DynamicPropertySnapshot snapshot = getDynamicPropertySnapshot();
+    const DynamicPropertySnapshot::Pin pin(snapshot);
+
+    if (usePlanarApply(srcImgDesc, dstImgDesc))
+    {
+        ProcessPlanarLines(srcImgDesc, dstImgDesc, 0, dstImgDesc.getHeight(), m_planarOps);
+        return;
+    }
+
+    // Get the ScanlineHelper for this thread (no heap allocation).
+    ScanlineHelperStorage storage;
+    ScanlineHelperPtr scanlineBuilder(CreateScanlineHelper(m_inBitDepth, m_inBitDepthOp,
+                                                           m_outBitDepth, m_outBitDepthOp,
+                                                           &storage));
 
     // Prepare the processing.
     scanlineBuilder->init(srcImgDesc, dstImgDesc);
 
-    float * rgbaBuffer = nullptr;
-    long numPixels = 0;
+    ProcessScanlines(*scanlineBuilder, m_cpuOps);
+}
 
-    while(true)
+void CPUProcessor::Impl::apply(const ImageDesc & imgDesc, unsigned numThreads) const
+{
+    applyBands(imgDesc, imgDesc, true, numThreads);
+}
+
+void CPUProcessor::Impl::apply(const ImageDesc & srcImgDesc,
+                               ImageDesc & dstImgDesc,
+                               unsigned numThreads) const
+{
+    applyBands(srcImgDesc, dstImgDesc, false, numThreads);
+}
+
+void CPUProcessor::Impl::applyBands(const ImageDesc & srcImgDesc,
+                                    const ImageDesc & dstImgDesc,
+                                    bool inPlace,
+                                    unsigned numThreads) const
+{
+    const long height = dstImgDesc.getHeight();
+    const unsigned numBands = GetNumBands(numThreads, height);
+
+    const bool planar = usePlanarApply(srcImgDesc, dstImgDesc);
+
+    // Each band processes a contiguous set of lines using its own ScanlineHelper so there is
+    // no shared mutable state between the threads. As the CPU ops only process pixels
+    // independently of each other, the result is identical to the single threaded processing.
+
+    // All the bands use the same version of the dynamic properties.
+    const DynamicPropertySnapshot snapshot = getDynamicPropertySnapshot();
+
+    RunParallelTasks(numBands, [&](unsigned band)
     {
-        scanlineBuilder->prepRGBAScanline(&rgbaBuffer, numPixels);
-        if(numPixels == 0) break;
+        const DynamicPropertySnapshot::Pin pin(snapshot);
 
-        const size_t numOps = m_cpuOps.size();
-        for(size_t i = 0; i<numOps; ++i)
+        const long yBegin = (height * band) / numBands;
+        const long yEnd   = (height * (band + 1)) / numBands;
+
+        if (planar)
         {
-            m_cpuOps[i]->apply(rgbaBuffer, rgbaBuffer, numPixels);
+            ProcessPlanarLines(srcImgDesc, dstImgDesc, yBegin, yEnd, m_planarOps);
+            return;
         }
 
-        scanlineBuilder->finishRGBAScanline();
+        ScanlineHelperStorage storage;
+        ScanlineHelperPtr scanlineBuilder(CreateScanlineHelper(m_inBitDepth, m_inBitDepthOp,
+                                                               m_outBitDepth, m_outBitDepthOp,
+                                                               &storage));
+
+        if (inPlace)
+        {
+            scanlineBuilder->init(srcImgDesc);
+        }
+        else
+        {
+            scanlineBuilder->init(srcImgDesc, dstImgDesc);
+        }
+
+        scanlineBuilder->setLineRange(yBegin, yEnd);
+
+        ProcessScanlines(*scanlineBuilder, m_cpuOps);
+    });
+}
+
+namespace
+{
+// Snapshot reused by the single pixel apply calls of the thread.
+thread_local DynamicPropertySnapshot g_pixelSnapshot;
+}
+
+template<typename Func>
+void CPUProcessor::Impl::applyPixel(const Func & func) const
+{
+    if (m_dynamicProperties.empty())
+    {
+        func();
+        return;
     }
+
+    // Do not keep the versions alive once the pixel is processed.
+    struct Release
+    {
+        ~Release() { g_pixelSnapshot.clear(); }
+    } release;
+
+    loadDynamicPropertySnapshot(g_pixelSnapshot);
+    const DynamicPropertySnapshot::Pin pin(g_pixelSnapshot);
+
+    func();
 }
 
 void CPUProcessor::Impl::applyRGB(float * pixel) const
 {
-    float v[4]{pixel[0], pixel[1], pixel[2], 0.0f};
+    applyPixel([this, pixel]()
+    {
+        float v[4]{pixel[0], pixel[1], pixel[2], 0.0f};
 
-    m_inBitDepthOp->apply(v, v, 1);
+        m_inBitDepthOp->apply(v, v, 1);
 
-    const size_t numOps = m_cpuOps.size();
-    for(size_t i = 0; i<numOps; ++i)
-    {
-        m_cpuOps[i]->apply(v, v, 1);
-    }
+        const size_t numOps = m_cpuOps.size();
+        for(size_t i = 0; i<numOps; ++i)
+        {
+            m_cpuOps[i]->apply(v, v, 1);
+        }
 
-    m_outBitDepthOp->apply(v, v, 1);
+        m_outBitDepthOp->apply(v, v, 1);
 
-    pixel[0] = v[0];
-    pixel[1] = v[1];
-    pixel[2] = v[2];
+        pixel[0] = v[0];
+        pixel[1] = v[1];
+        pixel[2] = v[2];
+    });
 }
 
 void CPUProcessor::Impl::applyRGBA(float * pixel) const
 {
-    m_inBitDepthOp->apply(pixel, pixel, 1);
-
-    const size_t numOps = m_cpuOps.size();
-    for(size_t i = 0; i<numOps; ++i)
+    applyPixel([this, pixel]()
     {
-        m_cpuOps[i]->apply(pixel, pixel, 1);
-    }
+        m_inBitDepthOp->apply(pixel, pixel, 1);
 
-    m_outBitDepthOp->apply(pixel, pixel, 1);
+        const size_t numOps = m_cpuOps.size();
+        for(size_t i = 0; i<numOps; ++i)
+        {
+            m_cpuOps[i]->apply(pixel, pixel, 1);
+        }
+
+        m_outBitDepthOp->apply(pixel, pixel, 1);
+    });
 }
 
 
@@ -472,6 +923,16 @@ void CPUProcessor::Impl::applyRGBA(float * pixel) const
 
 
 
+void SetCPUProcessorChunkSize(unsigned numPixels)
+{
+    g_chunkSize = numPixels;
+}
+
+unsigned GetCPUProcessorChunkSize()
+{
+    return g_chunkSize;
+}
+
 void CPUProcessor::deleter(CPUProcessor * c)
 {
     delete c;
@@ -533,6 +994,16 @@ DynamicPropertyRcPtr CPUProcessor::getDynamicProperty(DynamicPropertyType type)
     return getImpl()->getDynamicProperty(type);
 }
 
+void CPUProcessor::beginDynamicPropertyUpdate() const
+{
+    getImpl()->beginDynamicPropertyUpdate();
+}
+
+int CPUProcessor::commitDynamicPropertyUpdate() const
+{
+    return getImpl()->commitDynamicPropertyUpdate();
+}
+
 void CPUProcessor::apply(const ImageDesc & imgDesc) const
 {
     getImpl()->apply(imgDesc);
@@ -543,6 +1014,18 @@ void CPUProcessor::apply(const ImageDesc & srcImgDesc, ImageDesc & dstImgDesc) c
     getImpl()->apply(srcImgDesc, dstImgDesc);
 }
 
+void CPUProcessor::apply(const ImageDesc & imgDesc, unsigned numThreads) const
+{
+    getImpl()->apply(imgDesc, numThreads);
+}
+
+void CPUProcessor::apply(const ImageDesc & srcImgDesc,
+                         ImageDesc & dstImgDesc,
+                         unsigned numThreads) const
+{
+    getImpl()->apply(srcImgDesc, dstImgDesc, numThreads);
+}
+
 void CPUProcessor::applyRGB(float * pixel) const
 {
     getImpl()->applyRGB(pixel);
@@ -6,8 +6,11 @@
 #define INCLUDED_OCIO_CPUPROCESSOR_H
 
 
+#include <atomic>
+
 #include <OpenColorIO/OpenColorIO.h>
 
+#include "DynamicProperty.h"
 #include "Op.h"
 
 
@@ -43,9 +46,16 @@ public:
     bool hasDynamicProperty(DynamicPropertyType type) const noexcept;
     DynamicPropertyRcPtr getDynamicProperty(DynamicPropertyType type) const;
 
+    void beginDynamicPropertyUpdate() const;
+    int commitDynamicPropertyUpdate() const;
+
     void apply(const ImageDesc & imgDesc) const;
     void apply(const ImageDesc & srcImgDesc, ImageDesc & dstImgDesc) const;
 
+    // Split the image in bands of lines processed concurrently.
+    void apply(const ImageDesc & imgDesc, unsigned numThreads) const;
+    void apply(const ImageDesc & srcImgDesc, ImageDesc & dstImgDesc, unsigned numThreads) const;
+
     // Note that the method only accepts one packed RGB and 32-bit float pixel.
     void applyRGB(float * pixel) const;
     // Note that the method only accepts one packed RGBA and 32-bit float pixel.
@@ -55,21 +65,49 @@ public:
     //
     // Functions not exposed to the OCIO public API.
 
-    void finalize(const OpRcPtrVec & rawOps, BitDepth in, BitDepth out, OptimizationFlags oFlags);
+    void finalize(const OpRcPtrVec & rawOps, BitDepth in, BitDepth out, OptimizationFlags oFlags,
+                  const CPUApproximations & approximations);
 
 private:
+    // Get a consistent version of all the dynamic properties.
+    DynamicPropertySnapshot getDynamicPropertySnapshot() const;
+    void loadDynamicPropertySnapshot(DynamicPropertySnapshot & snapshot) const;
+
+    // Call func() with the dynamic properties (if any) pinned to the calling thread. The single
+    // pixel apply calls reuse the snapshot of the thread so they do not allocate per pixel.
+    template<typename Func>
+    void applyPixel(const Func & func) const;
+
+    // Could the images be processed directly on their F32 planes?
+    bool usePlanarApply(const ImageDesc & srcImgDesc, const ImageDesc & dstImgDesc) const;
+
+    void applyBands(const ImageDesc & srcImgDesc,
+                    const ImageDesc & dstImgDesc,
+                    bool inPlace,
+                    unsigned numThreads) const;
+
     ConstOpCPURcPtr    m_inBitDepthOp; // Converts from in to F32. It could be done by the first op.
     ConstOpCPURcPtrVec m_cpuOps;       // It could be empty if the OpVec only contains a 1D LUT op
                                        // (e.g. the 1D LUT CPUOp instance would be in the m_inBitDepthOp).
     ConstOpCPURcPtr    m_outBitDepthOp;// Converts from F32 to out. It could be done by the last op.
 
+    // All the CPU ops (i.e. with the bit-depth ones) when the planar F32 images are processed on
+    // their planes (refer to usePlanarApply), otherwise empty.
+    ConstOpCPURcPtrVec m_planarOps;
+
     BitDepth           m_inBitDepth = BIT_DEPTH_F32;
     BitDepth           m_outBitDepth = BIT_DEPTH_F32;
     bool               m_isNoOp = false;
     bool               m_isIdentity = false;
     bool               m_hasChannelCrosstalk = true;
     std::string        m_cacheID;
-    Mutex              m_mutex;
+    mutable Mutex      m_mutex;
+
+    // All the dynamic properties of the CPU ops (i.e. one per type at most).
+    std::vector<DynamicPropertyImplRcPtr> m_dynamicProperties;
+    mutable bool       m_updateInProgress = false;
+    // Incremented before & after each grouped publication of the dynamic properties.
+    mutable std::atomic<unsigned> m_publishEpoch{ 0 };
 };
 
 } // namespace OCIO_NAMESPACE
@@ -5,6 +5,7 @@
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "Caching.h"
+#include "DiskCache.h"
 #include "transforms/CDLTransform.h"
 #include "PathUtils.h"
 #include "transforms/FileTransform.h"
@@ -16,6 +17,9 @@ namespace OCIO_NAMESPACE
 const char * OCIO_DISABLE_ALL_CACHES       = "OCIO_DISABLE_ALL_CACHES";
 const char * OCIO_DISABLE_PROCESSOR_CACHES = "OCIO_DISABLE_PROCESSOR_CACHES";
 const char * OCIO_DISABLE_CACHE_FALLBACK   = "OCIO_DISABLE_CACHE_FALLBACK";
+const char * OCIO_FILE_CACHE_BUDGET        = "OCIO_FILE_CACHE_BUDGET";
+const char * OCIO_DISK_CACHE_DIR           = "OCIO_DISK_CACHE_DIR";
+const char * OCIO_DISK_CACHE_BUDGET        = "OCIO_DISK_CACHE_BUDGET";
 
 
 // TODO: Processors which the user hangs onto have local caches.
@@ -25,5 +29,6 @@ void ClearAllCaches()
 {
     ClearPathCaches();
     ClearFileTransformCaches();
+    DiskCache::ClearMemoryCache();
 }
 } // namespace OCIO_NAMESPACE
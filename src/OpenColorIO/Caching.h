@@ -6,7 +6,17 @@
 #define INCLUDED_OCIO_CACHING_H
 
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <limits>
+#include <list>
 #include <map>
+#include <memory>
+#include <unordered_map>
 
 #include <OpenColorIO/OpenColorIO.h>
 
@@ -93,6 +103,501 @@ private:
     Entries m_entries;
 };
 
+// Thread-safe cache with a least recently used (LRU) eviction policy bounded by a memory budget
+// and a maximum number of entries.
+//
+// The entries are spread over several shards, selected using the key hash, and each shard has its
+// own mutex so concurrent accesses to different keys rarely contend. Each entry has a cost (i.e. an
+// estimation of its memory footprint in bytes) and the least recently used entries are evicted when
+// the total cost exceeds the budget, or when there are too many entries. Zero means no limit.
+//
+// Each shard keeps its entries in LRU order and each access stamps the entry with a global tick so
+// the eviction finds the least recently used entry from the oldest entries of the shards without
+// ever locking more than one shard at a time.
+template<typename KeyType, typename EntryType, typename Hash = std::hash<KeyType>>
+class LRUCache
+{
+public:
+
+    static constexpr size_t NumShards = 16;
+
+    struct Statistics
+    {
+        size_t m_hits      = 0;
+        size_t m_misses    = 0;
+        size_t m_evictions = 0;
+        size_t m_entries   = 0;
+        size_t m_cost      = 0; // The sum of the entry costs (i.e. in bytes).
+    };
+
+    // Forbid copy & move semantics.
+    LRUCache(const LRUCache &)  = delete;
+    LRUCache(LRUCache && other) = delete;
+    LRUCache & operator=(const LRUCache &)  = delete;
+    LRUCache & operator=(LRUCache && other) = delete;
+
+    LRUCache()
+        :   m_envDisableAllCaches(Platform::isEnvPresent(OCIO_DISABLE_ALL_CACHES))
+    {
+    }
+
+    virtual ~LRUCache() = default;
+
+    void clear() noexcept
+    {
+        for (auto & shard : m_shards)
+        {
+            AutoMutex lock(shard.m_mutex);
+
+            m_cost    -= shard.m_cost;
+            m_entries -= shard.m_lru.size();
+
+            shard.m_index.clear();
+            shard.m_lru.clear();
+            shard.m_cost = 0;
+        }
+    }
+
+    inline void enable(bool enable) noexcept { m_enabled = enable; }
+
+    inline bool isEnabled() const noexcept { return !m_envDisableAllCaches && m_enabled; }
+
+    // Set the memory budget (in bytes) evicting entries if needed. Zero means no limit.
+    void setBudget(size_t budget)
+    {
+        m_budget = budget;
+        evict(nullptr);
+    }
+
+    inline size_t getBudget() const noexcept { return m_budget; }
+
+    // Set the maximum number of entries evicting entries if needed. Zero means no limit.
+    void setMaxEntries(size_t maxEntries)
+    {
+        m_maxEntries = maxEntries;
+        evict(nullptr);
+    }
+
+    inline size_t getMaxEntries() const noexcept { return m_maxEntries; }
+
+    // Get the entry for the key if it exists. The entry then becomes the most recently used one.
+    bool get(const KeyType & key, EntryType & entry)
+    {
+        if (!isEnabled())
+        {
+            return false;
+        }
+
+        Shard & shard = getShard(key);
+        AutoMutex lock(shard.m_mutex);
+
+        auto it = shard.m_index.find(key);
+        if (it == shard.m_index.end())
+        {
+            ++m_misses;
+            return false;
+        }
+
+        ++m_hits;
+        shard.m_lru.splice(shard.m_lru.begin(), shard.m_lru, it->second);
+        it->second->m_tick = ++m_clock;
+        entry = it->second->m_entry;
+
+        return true;
+    }
+
+    // Add or replace the entry for the key, and evict the least recently used entries, but not
+    // this one, if the limits are exceeded.
+    void insert(const KeyType & key, const EntryType & entry, size_t cost)
+    {
+        if (!isEnabled())
+        {
+            return;
+        }
+
+        {
+            Shard & shard = getShard(key);
+            AutoMutex lock(shard.m_mutex);
+
+            auto it = shard.m_index.find(key);
+            if (it != shard.m_index.end())
+            {
+                shard.m_cost -= it->second->m_cost;
+                m_cost       -= it->second->m_cost;
+                --m_entries;
+
+                shard.m_lru.erase(it->second);
+                shard.m_index.erase(it);
+            }
+
+            ++m_entries;
+            shard.m_cost += cost;
+            m_cost       += cost;
+            shard.m_lru.push_front(Item{ key, entry, cost, ++m_clock });
+            shard.m_index.emplace(key, shard.m_lru.begin());
+        }
+
+        evict(&key);
+    }
+
+    // Return the entry for the key, creating it (with a zero cost) using the factory when it does
+    // not exist. The entry then becomes the most recently used one. Note that the factory is called
+    // while the shard is locked so it must be fast (e.g. only create an empty placeholder).
+    template<typename Factory>
+    EntryType getOrCreate(const KeyType & key, Factory && create)
+    {
+        if (!isEnabled())
+        {
+            return create();
+        }
+
+        Shard & shard = getShard(key);
+        AutoMutex lock(shard.m_mutex);
+
+        auto it = shard.m_index.find(key);
+        if (it != shard.m_index.end())
+        {
+            ++m_hits;
+            shard.m_lru.splice(shard.m_lru.begin(), shard.m_lru, it->second);
+            it->second->m_tick = ++m_clock;
+            return it->second->m_entry;
+        }
+
+        ++m_misses;
+        ++m_entries;
+        shard.m_lru.push_front(Item{ key, create(), 0, ++m_clock });
+        shard.m_index.emplace(key, shard.m_lru.begin());
+
+        return shard.m_lru.front().m_entry;
+    }
+
+    // Update the cost of an existing entry (e.g. once its content is loaded) and evict the least
+    // recently used entries, but not this one, if the budget is exceeded.
+    void setCost(const KeyType & key, size_t cost)
+    {
+        if (!isEnabled())
+        {
+            return;
+        }
+
+        {
+            Shard & shard = getShard(key);
+            AutoMutex lock(shard.m_mutex);
+
+            auto it = shard.m_index.find(key);
+            if (it == shard.m_index.end())
+            {
+                return;
+            }
+
+            shard.m_cost = shard.m_cost - it->second->m_cost + cost;
+            m_cost      += cost;
+            m_cost      -= it->second->m_cost;
+
+            it->second->m_cost = cost;
+        }
+
+        evict(&key);
+    }
+
+    // Check the existence of an entry without changing the LRU order.
+    bool exists(const KeyType & key) const
+    {
+        if (!isEnabled())
+        {
+            return false;
+        }
+
+        const Shard & shard = getShard(key);
+        AutoMutex lock(shard.m_mutex);
+
+        return shard.m_index.find(key) != shard.m_index.end();
+    }
+
+    // Visit the entries, without changing the LRU order, until the visitor returns false. Note
+    // that the visitor is called while a shard is locked so it must not access the cache.
+    template<typename Visitor>
+    void forEach(Visitor && visit) const
+    {
+        for (const auto & shard : m_shards)
+        {
+            AutoMutex lock(shard.m_mutex);
+
+            for (const auto & item : shard.m_lru)
+            {
+                if (!visit(item.m_key, item.m_entry))
+                {
+                    return;
+                }
+            }
+        }
+    }
+
+    Statistics getStatistics() const noexcept
+    {
+        Statistics stats;
+        stats.m_hits      = m_hits;
+        stats.m_misses    = m_misses;
+        stats.m_evictions = m_evictions;
+        stats.m_entries   = m_entries;
+        stats.m_cost      = m_cost;
+        return stats;
+    }
+
+protected:
+    explicit LRUCache(bool disableCaches)
+        :   m_envDisableAllCaches(Platform::isEnvPresent(OCIO_DISABLE_ALL_CACHES) || disableCaches)
+    {
+    }
+
+    const bool m_envDisableAllCaches = false;
+    std::atomic<bool> m_enabled{ true };
+
+private:
+    struct Item
+    {
+        KeyType   m_key;
+        EntryType m_entry;
+        size_t    m_cost;
+        uint64_t  m_tick; // The last access time.
+    };
+
+    using Items = std::list<Item>;
+
+    struct Shard
+    {
+        mutable Mutex m_mutex;
+        Items m_lru; // The most recently used entry first.
+        std::unordered_map<KeyType, typename Items::iterator, Hash> m_index;
+        size_t m_cost = 0;
+    };
+
+    Shard & getShard(const KeyType & key) { return m_shards[Hash()(key) % NumShards]; }
+    const Shard & getShard(const KeyType & key) const { return m_shards[Hash()(key) % NumShards]; }
+
+    // Evict the least recently used entries until the total cost fits in the budget and the number
+    // of entries fits in the maximum. The entry of the key to keep (if any) is never evicted.
+    void evict(const KeyType * keep)
+    {
+        const size_t budget     = m_budget;
+        const size_t maxEntries = m_maxEntries;
+
+        while ((budget != 0 && m_cost > budget) || (maxEntries != 0 && m_entries > maxEntries))
+        {
+            // Find the least recently used entry among the oldest entries of all the shards.
+
+            Shard * oldestShard = nullptr;
+            KeyType oldestKey{};
+            uint64_t oldestTick = std::numeric_limits<uint64_t>::max();
+
+            for (auto & shard : m_shards)
+            {
+                AutoMutex lock(shard.m_mutex);
+
+                for (auto it = shard.m_lru.rbegin(); it != shard.m_lru.rend(); ++it)
+                {
+                    if (!keep || !(it->m_key == *keep))
+                    {
+                        if (it->m_tick < oldestTick)
+                        {
+                            oldestShard = &shard;
+                            oldestKey   = it->m_key;
+                            oldestTick  = it->m_tick;
+                        }
+                        break;
+                    }
+                }
+            }
+
+            if (!oldestShard)
+            {
+                return;
+            }
+
+            AutoMutex lock(oldestShard->m_mutex);
+
+            // Another thread could have used or removed the entry in the meantime.
+            auto it = oldestShard->m_index.find(oldestKey);
+            if (it != oldestShard->m_index.end() && it->second->m_tick == oldestTick)
+            {
+                oldestShard->m_cost -= it->second->m_cost;
+                m_cost              -= it->second->m_cost;
+                --m_entries;
+                ++m_evictions;
+
+                oldestShard->m_lru.erase(it->second);
+                oldestShard->m_index.erase(it);
+            }
+        }
+    }
+
+    std::array<Shard, NumShards> m_shards;
+
+    std::atomic<size_t> m_budget{ 0 };
+    std::atomic<size_t> m_maxEntries{ 0 };
+    std::atomic<size_t> m_cost{ 0 };
+    std::atomic<size_t> m_entries{ 0 };
+    std::atomic<size_t> m_hits{ 0 };
+    std::atomic<size_t> m_misses{ 0 };
+    std::atomic<size_t> m_evictions{ 0 };
+    std::atomic<uint64_t> m_clock{ 0 };
+};
+
+// Let the concurrent requests for the same key share a single creation (i.e. single-flight): the
+// first request creates the entry while the other ones wait for its result, or its exception.
+template<typename KeyType, typename EntryType, typename Hash = std::hash<KeyType>>
+class SingleFlight
+{
+public:
+    SingleFlight() = default;
+    ~SingleFlight() = default;
+
+    // Forbid copy & move semantics.
+    SingleFlight(const SingleFlight &) = delete;
+    SingleFlight(SingleFlight &&) = delete;
+    SingleFlight & operator=(const SingleFlight &) = delete;
+    SingleFlight & operator=(SingleFlight &&) = delete;
+
+    // Return the entry found by lookup(entry) if it returns true, otherwise wait for the pending
+    // creation of the key or call create() when there is none. The lookup is called while the
+    // pending creations are locked so an entry published by create() before it returns (e.g.
+    // inserted in a cache) is always found i.e. an entry is never created twice at the same time.
+    // Note that create() is called without holding any lock.
+    template<typename Lookup, typename Factory>
+    EntryType get(const KeyType & key, Lookup && lookup, Factory && create)
+    {
+        // Only the creator allocates the shared state i.e. a lookup hit never allocates.
+        std::unique_ptr<std::promise<EntryType>> promise;
+        std::shared_future<EntryType> pending;
+
+        {
+            AutoMutex lock(m_mutex);
+
+            EntryType entry;
+            if (lookup(entry))
+            {
+                return entry;
+            }
+
+            auto it = m_pending.find(key);
+            if (it != m_pending.end())
+            {
+                pending = it->second;
+            }
+            else
+            {
+                promise.reset(new std::promise<EntryType>());
+                m_pending.emplace(key, promise->get_future().share());
+            }
+        }
+
+        if (pending.valid())
+        {
+            // Note that it throws the exception of the creation if it failed.
+            return pending.get();
+        }
+
+        EntryType entry;
+        try
+        {
+            entry = create();
+        }
+        catch (...)
+        {
+            // A failed creation never stays pending i.e. the next request creates the entry again.
+            remove(key);
+            promise->set_exception(std::current_exception());
+            throw;
+        }
+
+        remove(key);
+        promise->set_value(entry);
+
+        return entry;
+    }
+
+    // Return the number of creations in progress.
+    size_t getNumPending() const
+    {
+        AutoMutex lock(m_mutex);
+        return m_pending.size();
+    }
+
+private:
+    void remove(const KeyType & key)
+    {
+        AutoMutex lock(m_mutex);
+        m_pending.erase(key);
+    }
+
+    mutable Mutex m_mutex;
+    std::unordered_map<KeyType, std::shared_future<EntryType>, Hash> m_pending;
+};
+
+// Cache of read-only shared data which does not own the entries i.e. an entry only lives as long
+// as one user keeps it, for example to share the data derived from identical LUTs between their
+// renderers. The expired entries are removed once in a while.
+template<typename KeyType, typename EntryType, typename Hash = std::hash<KeyType>>
+class WeakCache
+{
+public:
+    using EntryRcPtr = std::shared_ptr<const EntryType>;
+
+    WeakCache() = default;
+    ~WeakCache() = default;
+
+    // Forbid copy & move semantics.
+    WeakCache(const WeakCache &) = delete;
+    WeakCache(WeakCache &&) = delete;
+    WeakCache & operator=(const WeakCache &) = delete;
+    WeakCache & operator=(WeakCache &&) = delete;
+
+    // Return the entry or null if not existing (or expired).
+    EntryRcPtr get(const KeyType & key) const
+    {
+        AutoMutex lock(m_mutex);
+
+        auto it = m_entries.find(key);
+        return it != m_entries.end() ? it->second.lock() : EntryRcPtr();
+    }
+
+    // Return the cached entry if another thread already added it in the meantime.
+    EntryRcPtr add(const KeyType & key, const EntryRcPtr & entry)
+    {
+        AutoMutex lock(m_mutex);
+
+        auto & cached = m_entries[key];
+        if (EntryRcPtr existing = cached.lock())
+        {
+            return existing;
+        }
+        cached = entry;
+
+        if (m_entries.size() >= m_pruneSize)
+        {
+            for (auto it = m_entries.begin(); it != m_entries.end();)
+            {
+                it = it->second.expired() ? m_entries.erase(it) : std::next(it);
+            }
+            m_pruneSize = std::max<size_t>(64, 2 * m_entries.size());
+        }
+
+        return entry;
+    }
+
+    size_t size() const
+    {
+        AutoMutex lock(m_mutex);
+
+        return m_entries.size();
+    }
+
+private:
+    mutable Mutex m_mutex;
+    std::unordered_map<KeyType, std::weak_ptr<const EntryType>, Hash> m_entries;
+    size_t m_pruneSize = 64;
+};
+
 // A Processor instance uses this class to cache its derived optimized, CPU, and GPU Processors.
 // These caches may be disabled using either of two environment variables. The env. variables allow
 // either disabling all caches (including the FileTransform cache), or just the Processor caches.
@@ -108,6 +613,21 @@ public:
     ~ProcessorCache() = default;
 };
 
+// A Config instance uses this class to cache its Processors. The cache is bounded by a maximum
+// number of processors and by a memory budget (i.e. the estimated memory footprint in bytes of the
+// processors). It could be disabled using the same env. variables than the ProcessorCache class.
+template<typename KeyType, typename EntryType>
+class BoundedProcessorCache : public LRUCache<KeyType, EntryType>
+{
+public:
+    BoundedProcessorCache()
+        :   LRUCache<KeyType, EntryType>(Platform::isEnvPresent(OCIO_DISABLE_PROCESSOR_CACHES))
+    {
+    }
+
+    ~BoundedProcessorCache() = default;
+};
+
 
 } // namespace OCIO_NAMESPACE
 
@@ -8,6 +8,7 @@
 
 #include <OpenColorIO/OpenColorIO.h>
 
+#include "ColorSpace.h"
 #include "TokensManager.h"
 #include "Platform.h"
 #include "PrivateTypes.h"
@@ -24,78 +25,6 @@ const std::array<const std::string, 2> knownInterchangeNames = {
 namespace OCIO_NAMESPACE
 {
 
-class ColorSpace::Impl
-{
-public:
-    std::string m_name;
-    std::string m_family;
-    std::string m_equalityGroup;
-    std::string m_description;
-    std::string m_encoding;
-    std::string m_interopID;
-    StringUtils::StringVec m_aliases;
-    std::map<std::string, std::string> m_interchangeAttribs;
-
-    BitDepth m_bitDepth{ BIT_DEPTH_UNKNOWN };
-    bool m_isData{ false };
-
-    ReferenceSpaceType m_referenceSpaceType{ REFERENCE_SPACE_SCENE };
-
-    Allocation m_allocation{ ALLOCATION_UNIFORM };
-    std::vector<float> m_allocationVars;
-
-    TransformRcPtr m_toRefTransform;
-    TransformRcPtr m_fromRefTransform;
-
-    bool m_toRefSpecified{ false };
-    bool m_fromRefSpecified{ false };
-
-    TokensManager m_categories;
-
-    Impl() = delete;
-    explicit Impl(ReferenceSpaceType referenceSpace)
-        : m_referenceSpaceType(referenceSpace)
-    {
-    }
-
-    Impl(const Impl &) = delete;
-
-    ~Impl() = default;
-
-    Impl& operator= (const Impl & rhs)
-    {
-        if (this != &rhs)
-        {
-            m_name = rhs.m_name;
-            m_aliases = rhs.m_aliases;
-            m_family = rhs.m_family;
-            m_equalityGroup = rhs.m_equalityGroup;
-            m_description = rhs.m_description;
-            m_encoding = rhs.m_encoding;
-            m_interopID = rhs.m_interopID;
-            m_interchangeAttribs= rhs.m_interchangeAttribs;
-            m_bitDepth = rhs.m_bitDepth;
-            m_isData = rhs.m_isData;
-            m_referenceSpaceType = rhs.m_referenceSpaceType;
-            m_allocation = rhs.m_allocation;
-            m_allocationVars = rhs.m_allocationVars;
-
-            m_toRefTransform = rhs.m_toRefTransform?
-                rhs.m_toRefTransform->createEditableCopy()
-                : rhs.m_toRefTransform;
-
-            m_fromRefTransform = rhs.m_fromRefTransform?
-                rhs.m_fromRefTransform->createEditableCopy()
-                : rhs.m_fromRefTransform;
-
-            m_toRefSpecified = rhs.m_toRefSpecified;
-            m_fromRefSpecified = rhs.m_fromRefSpecified;
-            m_categories = rhs.m_categories;
-        }
-        return *this;
-    }
-
-};
 
 
 ///////////////////////////////////////////////////////////////////////////
@@ -450,14 +379,14 @@ void ColorSpace::setAllocationVars(int numvars, const float * vars)
     }
 }
 
-ConstTransformRcPtr ColorSpace::getTransform(ColorSpaceDirection dir) const noexcept
+ConstTransformRcPtr ColorSpace::getTransform(ColorSpaceDirection dir) const
 {
     switch (dir)
     {
     case COLORSPACE_DIR_TO_REFERENCE:
-        return getImpl()->m_toRefTransform;
+        return ResolveTransform(getImpl()->m_toRefDeferred, getImpl()->m_toRefTransform);
     case COLORSPACE_DIR_FROM_REFERENCE:
-        return getImpl()->m_fromRefTransform;
+        return ResolveTransform(getImpl()->m_fromRefDeferred, getImpl()->m_fromRefTransform);
     }
     return ConstTransformRcPtr();
 }
@@ -472,9 +401,27 @@ void ColorSpace::setTransform(const ConstTransformRcPtr & transform,
     {
     case COLORSPACE_DIR_TO_REFERENCE:
         getImpl()->m_toRefTransform = transformCopy;
+        getImpl()->m_toRefDeferred  = nullptr;
         break;
     case COLORSPACE_DIR_FROM_REFERENCE:
         getImpl()->m_fromRefTransform = transformCopy;
+        getImpl()->m_fromRefDeferred  = nullptr;
+        break;
+    }
+}
+
+void ColorSpace::Impl::setDeferred(ColorSpaceDirection dir,
+                                   const DeferredTransformRcPtr & transform)
+{
+    switch (dir)
+    {
+    case COLORSPACE_DIR_TO_REFERENCE:
+        m_toRefTransform = nullptr;
+        m_toRefDeferred  = transform;
+        break;
+    case COLORSPACE_DIR_FROM_REFERENCE:
+        m_fromRefTransform = nullptr;
+        m_fromRefDeferred  = transform;
         break;
     }
 }
@@ -571,15 +518,29 @@ std::ostream & operator<< (std::ostream & os, const ColorSpace & cs)
     {
         os << ", " << attr.first << "=" << attr.second;
     }
-    if(cs.getTransform(COLORSPACE_DIR_TO_REFERENCE))
+
+    // The transforms of a lazily loaded config could fail to parse, print the error instead.
+    ConstTransformRcPtr toRef, fromRef;
+    try
+    {
+        toRef   = cs.getTransform(COLORSPACE_DIR_TO_REFERENCE);
+        fromRef = cs.getTransform(COLORSPACE_DIR_FROM_REFERENCE);
+    }
+    catch (const Exception & e)
+    {
+        os << ", error=" << e.what() << ">";
+        return os;
+    }
+
+    if(toRef)
     {
         os << ",\n    " << cs.getName() << " --> Reference";
-        os << "\n        " << *cs.getTransform(COLORSPACE_DIR_TO_REFERENCE);
+        os << "\n        " << *toRef;
     }
-    if(cs.getTransform(COLORSPACE_DIR_FROM_REFERENCE))
+    if(fromRef)
     {
         os << ",\n    Reference --> " << cs.getName();
-        os << "\n        " << *cs.getTransform(COLORSPACE_DIR_FROM_REFERENCE);
+        os << "\n        " << *fromRef;
     }
     os << ">";
     return os;
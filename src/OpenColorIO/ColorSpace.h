@@ -0,0 +1,106 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#ifndef INCLUDED_OCIO_COLORSPACE_H
+#define INCLUDED_OCIO_COLORSPACE_H
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "DeferredTransform.h"
+#include "TokensManager.h"
+#include "utils/StringUtils.h"
+
+
+namespace OCIO_NAMESPACE
+{
+
+class ColorSpace::Impl
+{
+public:
+    std::string m_name;
+    std::string m_family;
+    std::string m_equalityGroup;
+    std::string m_description;
+    std::string m_encoding;
+    std::string m_interopID;
+    StringUtils::StringVec m_aliases;
+    std::map<std::string, std::string> m_interchangeAttribs;
+
+    BitDepth m_bitDepth{ BIT_DEPTH_UNKNOWN };
+    bool m_isData{ false };
+
+    ReferenceSpaceType m_referenceSpaceType{ REFERENCE_SPACE_SCENE };
+
+    Allocation m_allocation{ ALLOCATION_UNIFORM };
+    std::vector<float> m_allocationVars;
+
+    TransformRcPtr m_toRefTransform;
+    TransformRcPtr m_fromRefTransform;
+
+    // Only used by a lazy config loading, they supersede the transforms.
+    DeferredTransformRcPtr m_toRefDeferred;
+    DeferredTransformRcPtr m_fromRefDeferred;
+
+    bool m_toRefSpecified{ false };
+    bool m_fromRefSpecified{ false };
+
+    TokensManager m_categories;
+
+    Impl() = delete;
+    explicit Impl(ReferenceSpaceType referenceSpace)
+        : m_referenceSpaceType(referenceSpace)
+    {
+    }
+
+    Impl(const Impl &) = delete;
+
+    ~Impl() = default;
+
+    Impl& operator= (const Impl & rhs)
+    {
+        if (this != &rhs)
+        {
+            m_name = rhs.m_name;
+            m_aliases = rhs.m_aliases;
+            m_family = rhs.m_family;
+            m_equalityGroup = rhs.m_equalityGroup;
+            m_description = rhs.m_description;
+            m_encoding = rhs.m_encoding;
+            m_interopID = rhs.m_interopID;
+            m_interchangeAttribs= rhs.m_interchangeAttribs;
+            m_bitDepth = rhs.m_bitDepth;
+            m_isData = rhs.m_isData;
+            m_referenceSpaceType = rhs.m_referenceSpaceType;
+            m_allocation = rhs.m_allocation;
+            m_allocationVars = rhs.m_allocationVars;
+
+            m_toRefTransform = rhs.m_toRefTransform?
+                rhs.m_toRefTransform->createEditableCopy()
+                : rhs.m_toRefTransform;
+
+            m_fromRefTransform = rhs.m_fromRefTransform?
+                rhs.m_fromRefTransform->createEditableCopy()
+                : rhs.m_fromRefTransform;
+
+            m_toRefDeferred   = rhs.m_toRefDeferred;
+            m_fromRefDeferred = rhs.m_fromRefDeferred;
+
+            m_toRefSpecified = rhs.m_toRefSpecified;
+            m_fromRefSpecified = rhs.m_fromRefSpecified;
+            m_categories = rhs.m_categories;
+        }
+        return *this;
+    }
+
+    // Attach a deferred transform i.e. it replaces the transform for that direction.
+    void setDeferred(ColorSpaceDirection dir, const DeferredTransformRcPtr & transform);
+};
+
+} // namespace OCIO_NAMESPACE
+
+#endif // INCLUDED_OCIO_COLORSPACE_H
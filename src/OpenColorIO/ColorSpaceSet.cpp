@@ -1,11 +1,13 @@
 // SPDX-License-Identifier: BSD-3-Clause
 // Copyright Contributors to the OpenColorIO Project.
 
+#include <algorithm>
 #include <sstream>
 #include <string>
 
 #include <OpenColorIO/OpenColorIO.h>
 
+#include "NameIndex.h"
 #include "PrivateTypes.h"
 #include "utils/StringUtils.h"
 
@@ -31,6 +33,7 @@ public:
             {
                 m_colorSpaces.push_back(cs->createEditableCopy());
             }
+            m_index.rebuildWithAliases(m_colorSpaces);
         }
         return *this;
     }
@@ -89,27 +92,8 @@ public:
     int getIndex(const char * csName) const 
     {
         // Search for name and aliases.
-        if (csName && *csName)
-        {
-            const std::string str = StringUtils::Lower(csName);
-            for (size_t idx = 0; idx < m_colorSpaces.size(); ++idx)
-            {
-                if (StringUtils::Compare(m_colorSpaces[idx]->getName(), str))
-                {
-                    return static_cast<int>(idx);
-                }
-                const size_t numAliases = m_colorSpaces[idx]->getNumAliases();
-                for (size_t aidx = 0; aidx < numAliases; ++aidx)
-                {
-                    if (StringUtils::Compare(m_colorSpaces[idx]->getAlias(aidx), str))
-                    {
-                        return static_cast<int>(idx);
-                    }
-                }
-            }
-        }
-
-        return -1;
+        const size_t idx = m_index.find(csName);
+        return idx == NameIndex::npos ? -1 : static_cast<int>(idx);
     }
 
     bool isPresent(const char * csName) const
@@ -164,10 +148,12 @@ public:
         {
             // The color space replaces the existing one.
             m_colorSpaces[replaceIdx] = cs->createEditableCopy();
+            m_index.rebuildWithAliases(m_colorSpaces);
             return;
         }
 
         m_colorSpaces.push_back(cs->createEditableCopy());
+        m_index.addWithAliases(*m_colorSpaces.back(), m_colorSpaces.size() - 1);
     }
 
     void add(const Impl & rhs)
@@ -180,35 +166,46 @@ public:
 
     void remove(const char * csName)
     {
-        const std::string name = StringUtils::Lower(csName);
-        if (name.empty()) return;
-
-        for (auto itr = m_colorSpaces.begin(); itr != m_colorSpaces.end(); ++itr)
+        // Only remove by name (i.e. not by alias).
+        const size_t idx = m_index.find(csName);
+        if (idx != NameIndex::npos && StringUtils::Compare(m_colorSpaces[idx]->getName(), csName))
         {
-            if (StringUtils::Lower((*itr)->getName())==name)
-            {
-                m_colorSpaces.erase(itr);
-                return;
-            }
+            m_colorSpaces.erase(m_colorSpaces.begin() + idx);
+            m_index.rebuildWithAliases(m_colorSpaces);
         }
     }
 
     void remove(const Impl & rhs)
     {
-        for (auto & cs : rhs.m_colorSpaces)
+        // Only rebuild the index once all the color spaces are removed.
+        const auto newEnd
+            = std::remove_if(m_colorSpaces.begin(), m_colorSpaces.end(),
+                             [&rhs](const ColorSpaceRcPtr & cs)
+                             {
+                                 const size_t idx = rhs.m_index.find(cs->getName());
+                                 return idx != NameIndex::npos
+                                        && StringUtils::Compare(rhs.m_colorSpaces[idx]->getName(),
+                                                                cs->getName());
+                             });
+
+        if (newEnd != m_colorSpaces.end())
         {
-            remove(cs->getName());
+            m_colorSpaces.erase(newEnd, m_colorSpaces.end());
+            m_index.rebuildWithAliases(m_colorSpaces);
         }
     }
 
     void clear()
     {
         m_colorSpaces.clear();
+        m_index.clear();
     }
 
 private:
     typedef std::vector<ColorSpaceRcPtr> ColorSpaceVec;
     ColorSpaceVec m_colorSpaces;
+    // Case insensitive index of the color space names and aliases.
+    NameIndex m_index;
 };
 
 
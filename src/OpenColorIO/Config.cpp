@@ -11,23 +11,29 @@
 #include <vector>
 #include <regex>
 #include <functional>
+#include <unordered_map>
 
 #include <pystring.h>
 
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "builtinconfigs/BuiltinConfigRegistry.h"
+#include "ColorSpace.h"
+#include "ConfigSnapshot.h"
 #include "ConfigUtils.h"
 #include "ContextVariableUtils.h"
+#include "DeferredTransform.h"
 #include "Display.h"
 #include "fileformats/FileFormatICC.h"
 #include "FileRules.h"
 #include "HashUtils.h"
 #include "Logging.h"
+#include "Look.h"
 #include "LookParse.h"
 #include "MathUtils.h"
 #include "Mutex.h"
 #include "NamedTransform.h"
+#include "NameIndex.h"
 #include "OCIOYaml.h"
 #include "OCIOZArchive.h"
 #include "OpBuilders.h"
@@ -39,6 +45,7 @@
 #include "transforms/FileTransform.h"
 #include "utils/StringUtils.h"
 #include "ViewingRules.h"
+#include "ViewTransform.h"
 #include "SystemMonitor.h"
 
 namespace OCIO_NAMESPACE
@@ -50,6 +57,7 @@ const char * OCIO_ACTIVE_VIEWS_ENVVAR         = "OCIO_ACTIVE_VIEWS";
 const char * OCIO_INACTIVE_COLORSPACES_ENVVAR = "OCIO_INACTIVE_COLORSPACES";
 const char * OCIO_OPTIMIZATION_FLAGS_ENVVAR   = "OCIO_OPTIMIZATION_FLAGS";
 const char * OCIO_USER_CATEGORIES_ENVVAR      = "OCIO_USER_CATEGORIES";
+const char * OCIO_LAZY_LOADING_ENVVAR         = "OCIO_LAZY_LOADING";
 
 // Default filename (with extension) of a config and archived config.
 const char * OCIO_CONFIG_DEFAULT_NAME         = "config";
@@ -291,6 +299,7 @@ public:
 
     StringMap m_roles;
     LookVec m_looksList;
+    NameIndex m_lookIndex; // Case insensitive index of the look names.
 
     DisplayMap m_displays;
     StringUtils::StringVec m_activeDisplays;
@@ -304,6 +313,7 @@ public:
     Display m_virtualDisplay;
 
     std::vector<ViewTransformRcPtr> m_viewTransforms;
+    NameIndex m_viewTransformIndex; // Case insensitive index of the view transform names.
     std::string m_defaultViewTransform;
 
     mutable std::string m_activeDisplaysStr;
@@ -312,6 +322,8 @@ public:
 
     // All the named transforms(i.e. no filtering).
     std::vector<ConstNamedTransformRcPtr> m_allNamedTransforms;
+    // Case insensitive index of the named transform names and aliases.
+    NameIndex m_namedTransformIndex;
     // Active named transform names.
     StringUtils::StringVec m_activeNamedTransformNames;
     // Inactive named transform names.
@@ -330,7 +342,27 @@ public:
     FileRulesRcPtr m_fileRules;
 
     mutable ProcessorCacheFlags m_cacheFlags { PROCESSOR_CACHE_DEFAULT };
-    mutable ProcessorCache<std::size_t, ProcessorRcPtr> m_processorCache;
+    mutable BoundedProcessorCache<CacheIDDigest, ProcessorRcPtr> m_processorCache;
+    // Map the key of a request (i.e. using the whole context) to the key of the processor cache
+    // (i.e. only using the context variables needed by the transform) so a cache hit neither
+    // collects the context variables again nor allocates anything.
+    mutable LRUCache<CacheIDDigest, CacheIDDigest> m_processorKeys;
+    static constexpr size_t MaxProcessorKeys = 4096;
+
+    // The processors being created, so concurrent requests for the same key wait for the same
+    // creation instead of creating the processor again.
+    mutable SingleFlight<CacheIDDigest, ProcessorRcPtr> m_processorFlights;
+    // Protect the cache ID index. Note that the mutex is never held while creating a processor.
+    mutable Mutex m_processorCacheMutex;
+    // Index the cached processors by their cache ID for the cache fallback. The entries of the
+    // evicted processors are lazily pruned.
+    struct CachedProcessor
+    {
+        CacheIDDigest m_key;
+        std::weak_ptr<Processor> m_processor;
+    };
+    mutable std::unordered_map<std::string, CachedProcessor> m_processorCacheIDs;
+    mutable size_t m_processorCacheIDsPruneSize = 64;
 
     Impl() :
         m_majorVersion(LastSupportedMajorVersion),
@@ -367,6 +399,7 @@ public:
         m_inactiveColorSpaceNamesEnv = StringUtils::Trim(m_inactiveColorSpaceNamesEnv);
 
         m_processorCache.enable((m_cacheFlags & PROCESSOR_CACHE_ENABLED) == PROCESSOR_CACHE_ENABLED);
+        m_processorKeys.setMaxEntries(MaxProcessorKeys);
 
         // This is used to allow the YAML writer to not save any virtual displays that were
         // instantiated.
@@ -404,6 +437,7 @@ public:
             {
                 m_looksList.push_back(look->createEditableCopy());
             }
+            m_lookIndex.rebuild(m_looksList);
 
             // Assignment operator will suffice for these.
             m_roles = rhs.m_roles;
@@ -414,6 +448,7 @@ public:
             {
                 m_allNamedTransforms.push_back(nt->createEditableCopy());
             }
+            m_namedTransformIndex.rebuildWithAliases(m_allNamedTransforms);
             m_activeNamedTransformNames = rhs.m_activeNamedTransformNames;
             m_inactiveNamedTransformNames = rhs.m_inactiveNamedTransformNames;
 
@@ -436,6 +471,7 @@ public:
             {
                 m_viewTransforms.push_back(vt->createEditableCopy());
             }
+            m_viewTransformIndex.rebuild(m_viewTransforms);
             m_defaultViewTransform = rhs.m_defaultViewTransform;
             m_defaultLumaCoefs = rhs.m_defaultLumaCoefs;
             m_strictParsing = rhs.m_strictParsing;
@@ -450,8 +486,10 @@ public:
             
             m_cacheFlags = rhs.m_cacheFlags;
 
-            m_processorCache.clear();
+            clearProcessorCache();
             m_processorCache.enable((m_cacheFlags & PROCESSOR_CACHE_ENABLED) == PROCESSOR_CACHE_ENABLED);
+            m_processorCache.setMaxEntries(rhs.m_processorCache.getMaxEntries());
+            m_processorCache.setBudget(rhs.m_processorCache.getBudget());
         }
         return *this;
     }
@@ -495,26 +533,8 @@ public:
 
     size_t getNamedTransformIndex(const char * name) const noexcept
     {
-        if (name && *name)
-        {
-            const std::string str = StringUtils::Lower(name);
-            for (size_t idx = 0; idx < m_allNamedTransforms.size(); ++idx)
-            {
-                if (StringUtils::Lower(m_allNamedTransforms[idx]->getName()) == str)
-                {
-                    return idx;
-                }
-                const auto numAliases = m_allNamedTransforms[idx]->getNumAliases();
-                for (size_t alias = 0; alias < numAliases; ++alias)
-                {
-                    if (StringUtils::Lower(m_allNamedTransforms[idx]->getAlias(alias)) == str)
-                    {
-                        return idx;
-                    }
-                }
-            }
-        }
-        return static_cast<size_t>(-1);
+        // Search for name and aliases.
+        return m_namedTransformIndex.find(name);
     }
 
     enum InactiveType
@@ -528,32 +548,24 @@ public:
 
     ConstViewTransformRcPtr getViewTransform(const char * name) const noexcept
     {
-        const std::string namelower = StringUtils::Lower(name);
-
-        for (const auto & vt : m_viewTransforms)
+        const size_t idx = m_viewTransformIndex.find(name);
+        if (idx == NameIndex::npos)
         {
-            if (StringUtils::Lower(vt->getName()) == namelower)
-            {
-                return vt;
-            }
+            return ConstViewTransformRcPtr();
         }
 
-        return ConstViewTransformRcPtr();
+        return m_viewTransforms[idx];
     }
 
     ConstLookRcPtr getLook(const char * name) const
     {
-        const std::string namelower = StringUtils::Lower(name);
-
-        for (const auto & look : m_looksList)
+        const size_t idx = m_lookIndex.find(name);
+        if (idx == NameIndex::npos)
         {
-            if (StringUtils::Lower(look->getName()) == namelower)
-            {
-                return look;
-            }
+            return ConstLookRcPtr();
         }
 
-        return ConstLookRcPtr();
+        return m_looksList[idx];
     }
 
     ViewPtrVec getViews(const Display & display) const
@@ -587,6 +599,7 @@ public:
 
     static ConstConfigRcPtr Read(std::istream & istream, const char * filename);
     static ConstConfigRcPtr Read(std::istream & istream, ConfigIOProxyRcPtr ciop);
+    static ConstConfigRcPtr ReadSnapshot(const char * data, size_t size, const char * filename);
 
     // Validate view object that can be a config defined shared view or a display-defined view.
     void validateView(const std::string & display, const View & view, bool checkUseDisplayName) const
@@ -778,8 +791,39 @@ public:
         refreshActiveColorSpaces();
     }
 
+    // Throw if the transform (or one of its children) needs a more recent config version.
+    static void CheckVersionConsistency(const ConstTransformRcPtr & transform,
+                                        unsigned int majorVersion,
+                                        unsigned int minorVersion);
+
     void checkVersionConsistency(ConstTransformRcPtr & transform) const;
-    void checkVersionConsistency() const;
+    // Note that a lazy config loading checks the transforms when they are created.
+    void checkVersionConsistency(bool checkTransforms = true) const;
+
+    // Attach the deferred transforms of a lazy config loading (refer to OCIOYaml::ReadLazy).
+    static void SetDeferred(ColorSpace & cs, ColorSpaceDirection dir,
+                            const DeferredTransformRcPtr & transform)
+    {
+        cs.getImpl()->setDeferred(dir, transform);
+    }
+    static void SetDeferred(Look & look, TransformDirection dir,
+                            const DeferredTransformRcPtr & transform)
+    {
+        look.getImpl()->setDeferred(dir, transform);
+    }
+    static void SetDeferred(ViewTransform & vt, ViewTransformDirection dir,
+                            const DeferredTransformRcPtr & transform)
+    {
+        vt.getImpl()->setDeferred(dir, transform);
+    }
+
+    static void ReadLazy(std::istream & istream, ConfigRcPtr & config, const char * filename)
+    {
+        const OCIOYaml::DeferredTransformSetters setters{ &Impl::SetDeferred,
+                                                          &Impl::SetDeferred,
+                                                          &Impl::SetDeferred };
+        OCIOYaml::ReadLazy(istream, config, filename, &Impl::CheckVersionConsistency, setters);
+    }
 
     const View * getView(const char * display, const char * view) const
     {
@@ -932,6 +976,54 @@ public:
         m_processorCache.enable((m_cacheFlags & PROCESSOR_CACHE_ENABLED) == PROCESSOR_CACHE_ENABLED);
     }
 
+    void clearProcessorCache() const
+    {
+        AutoMutex guard(m_processorCacheMutex);
+
+        m_processorCache.clear();
+        m_processorKeys.clear();
+        m_processorCacheIDs.clear();
+    }
+
+    // Return the cached processor having the same cache ID if any, otherwise index the processor.
+    // To only use when the processor cache mutex is locked.
+    ProcessorRcPtr shareProcessor(const CacheIDDigest & key,
+                                  const std::string & cacheID,
+                                  const ProcessorRcPtr & processor) const
+    {
+        auto it = m_processorCacheIDs.find(cacheID);
+        if (it != m_processorCacheIDs.end())
+        {
+            ProcessorRcPtr cached = it->second.m_processor.lock();
+            if (cached && m_processorCache.exists(it->second.m_key))
+            {
+                return cached;
+            }
+        }
+
+        m_processorCacheIDs[cacheID] = CachedProcessor{ key, processor };
+
+        if (m_processorCacheIDs.size() >= m_processorCacheIDsPruneSize)
+        {
+            for (auto iter = m_processorCacheIDs.begin(); iter != m_processorCacheIDs.end();)
+            {
+                if (iter->second.m_processor.expired()
+                    || !m_processorCache.exists(iter->second.m_key))
+                {
+                    iter = m_processorCacheIDs.erase(iter);
+                }
+                else
+                {
+                    ++iter;
+                }
+            }
+
+            m_processorCacheIDsPruneSize = std::max<size_t>(64, 2 * m_processorCacheIDs.size());
+        }
+
+        return processor;
+    }
+
     ConstProcessorRcPtr getProcessorWithoutCaching(
         const Config & config,
         const ConstTransformRcPtr & transform, 
@@ -1180,9 +1272,19 @@ ConstConfigRcPtr Config::CreateFromFile(const char * filename)
         throw Exception (os.str().c_str());
     }
 
-    char magicNumber[2] = { 0 };
-    if (ifstream.read(magicNumber, 2))
+    char magicNumber[ConfigSnapshot::SignatureSize] = { 0 };
+    ifstream.read(magicNumber, ConfigSnapshot::SignatureSize);
+    if (ifstream.gcount() >= 2)
     {
+        // Check if it is a config snapshot.
+        if (ConfigSnapshot::IsSnapshot(magicNumber, static_cast<size_t>(ifstream.gcount())))
+        {
+            ifstream.close();
+
+            const Platform::MappedFile file(filename);
+            return Config::Impl::ReadSnapshot(file.data(), file.size(), filename);
+        }
+
         // Check if it is an OCIOZ archive.
         if (magicNumber[0] == 'P' && magicNumber[1] == 'K')
         {
@@ -1208,6 +1310,17 @@ ConstConfigRcPtr Config::CreateFromFile(const char * filename)
 
 ConstConfigRcPtr Config::CreateFromStream(std::istream & istream)
 {
+    // A YAML config cannot start with the first byte of the config snapshot signature so there
+    // is no need to rewind the stream. Note that the stream buffer is used to not change the
+    // stream state (e.g. a reused stream could still have its eof bit set).
+    std::streambuf * buf = istream.rdbuf();
+    if (buf && buf->sgetc() == static_cast<unsigned char>(ConfigSnapshot::SignatureStartByte))
+    {
+        const std::string data{ std::istreambuf_iterator<char>(istream),
+                                std::istreambuf_iterator<char>() };
+        return Config::Impl::ReadSnapshot(data.data(), data.size(), nullptr);
+    }
+
     return Config::Impl::Read(istream, nullptr);
 }
 
@@ -1808,7 +1921,18 @@ void Config::validate() const
     // the named color space exists and that all transforms are valid.
     {
         ConstTransformVec allTransforms;
-        getImpl()->getAllInternalTransforms(allTransforms);
+        try
+        {
+            // Also parses all the transforms of a lazily loaded config.
+            getImpl()->getAllInternalTransforms(allTransforms);
+        }
+        catch (const Exception & e)
+        {
+            std::ostringstream os;
+            os << "Config failed transform validation. " << e.what();
+            getImpl()->m_validationtext = os.str();
+            throw Exception(getImpl()->m_validationtext.c_str());
+        }
 
         ConstContextRcPtr context = getCurrentContext();
 
@@ -2639,12 +2763,28 @@ void Config::addColorSpace(const ConstColorSpaceRcPtr & original)
         }
     }
 
+    const int numColorSpaces = getImpl()->m_allColorSpaces->getNumColorSpaces();
+
     // This is verifying that name and aliases are fine with other color spaces.
     getImpl()->m_allColorSpaces->addColorSpace(original);
 
     AutoMutex lock(getImpl()->m_cacheidMutex);
     getImpl()->resetCacheIDs();
-    getImpl()->refreshActiveColorSpaces();
+
+    // Rebuilding the active lists makes the loading of a config quadratic in the number of
+    // color spaces, so only do it if the color space replaced an existing one or could be
+    // inactive.
+    if (getImpl()->m_allColorSpaces->getNumColorSpaces() == numColorSpaces + 1
+        && getImpl()->m_inactiveColorSpaceNamesAPI.empty()
+        && getImpl()->m_inactiveColorSpaceNamesEnv.empty()
+        && getImpl()->m_inactiveColorSpaceNamesConf.empty())
+    {
+        getImpl()->m_activeColorSpaceNames.push_back(name);
+    }
+    else
+    {
+        getImpl()->refreshActiveColorSpaces();
+    }
 }
 
 void Config::removeColorSpace(const char * name)
@@ -2667,7 +2807,16 @@ bool Config::isColorSpaceUsed(const char * name) const noexcept
     // Check for all color spaces, looks and view transforms.
 
     ConstTransformVec allTransforms;
-    getImpl()->getAllInternalTransforms(allTransforms);
+    try
+    {
+        getImpl()->getAllInternalTransforms(allTransforms);
+    }
+    catch (const Exception &)
+    {
+        // A transform of a lazily loaded config failed to parse so its color space references
+        // are unknown i.e. the color space could be used.
+        return true;
+    }
 
     std::set<std::string> colorSpaceNames;
     for (const auto & transform : allTransforms)
@@ -3177,8 +3326,8 @@ void Config::addNamedTransform(const ConstNamedTransformRcPtr & nt)
     {
         throw Exception("Named transform must have a non-empty name.");
     }
-    if (!nt->getTransform(TRANSFORM_DIR_FORWARD) &&
-        !nt->getTransform(TRANSFORM_DIR_INVERSE))
+    if (!NamedTransformImpl::HasTransform(*nt, TRANSFORM_DIR_FORWARD) &&
+        !NamedTransformImpl::HasTransform(*nt, TRANSFORM_DIR_INVERSE))
     {
         throw Exception("Named transform must define at least one transform.");
     }
@@ -3285,12 +3434,15 @@ void Config::addNamedTransform(const ConstNamedTransformRcPtr & nt)
         ConstNamedTransformRcPtr namedTransformCopy = copy;
         // Safe to swap, copy is not used after.
         getImpl()->m_allNamedTransforms[replaceIdx].swap(namedTransformCopy);
+        // The aliases might have changed.
+        getImpl()->m_namedTransformIndex.rebuildWithAliases(getImpl()->m_allNamedTransforms);
     }
     else
     {
         NamedTransformRcPtr copy = nt->createEditableCopy();
         ConstNamedTransformRcPtr namedTransformCopy = copy;
         getImpl()->m_allNamedTransforms.push_back(namedTransformCopy);
+        getImpl()->m_namedTransformIndex.addWithAliases(*namedTransformCopy, numNT);
     }
 
     getImpl()->resetCacheIDs();
@@ -3299,16 +3451,15 @@ void Config::addNamedTransform(const ConstNamedTransformRcPtr & nt)
 
 void Config::removeNamedTransform(const char * name)
 {
-    const std::string nameToSearch = StringUtils::Lower(name);
-    if (nameToSearch.empty()) return;
-
-    for (auto itr = getImpl()->m_allNamedTransforms.begin(); itr != getImpl()->m_allNamedTransforms.end(); ++itr)
+    // Only remove by name (i.e. not by alias).
+    const size_t idx = getImpl()->getNamedTransformIndex(name);
+    if (idx != NameIndex::npos
+        && StringUtils::Compare(getImpl()->m_allNamedTransforms[idx]->getName(), name))
     {
-        if (StringUtils::Lower((*itr)->getName()) == nameToSearch)
-        {
-            getImpl()->m_allNamedTransforms.erase(itr);
-            return;
-        }
+        auto & namedTransforms = getImpl()->m_allNamedTransforms;
+        namedTransforms.erase(namedTransforms.begin() + idx);
+        getImpl()->m_namedTransformIndex.rebuildWithAliases(namedTransforms);
+        return;
     }
 
     AutoMutex lock(getImpl()->m_cacheidMutex);
@@ -3319,6 +3470,7 @@ void Config::removeNamedTransform(const char * name)
 void Config::clearNamedTransforms()
 {
     getImpl()->m_allNamedTransforms.clear();
+    getImpl()->m_namedTransformIndex.clear();
 
     getImpl()->resetCacheIDs();
     getImpl()->refreshActiveColorSpaces();
@@ -4488,24 +4640,21 @@ void Config::addLook(const ConstLookRcPtr & look)
     if(name.empty())
         throw Exception("Cannot addLook with an empty name.");
 
-    const std::string namelower = StringUtils::Lower(name);
-
     // If the look exists, replace it
-    for(unsigned int i=0; i<getImpl()->m_looksList.size(); ++i)
+    const size_t idx = getImpl()->m_lookIndex.find(name);
+    if (idx != NameIndex::npos)
     {
-        if(StringUtils::Lower(getImpl()->m_looksList[i]->getName()) == namelower)
-        {
-            getImpl()->m_looksList[i] = look->createEditableCopy();
+        getImpl()->m_looksList[idx] = look->createEditableCopy();
 
-            AutoMutex lock(getImpl()->m_cacheidMutex);
-            getImpl()->resetCacheIDs();
+        AutoMutex lock(getImpl()->m_cacheidMutex);
+        getImpl()->resetCacheIDs();
 
-            return;
-        }
+        return;
     }
 
     // Otherwise, add it
     getImpl()->m_looksList.push_back(look->createEditableCopy());
+    getImpl()->m_lookIndex.add(name.c_str(), getImpl()->m_looksList.size() - 1);
 
     AutoMutex lock(getImpl()->m_cacheidMutex);
     getImpl()->resetCacheIDs();
@@ -4514,6 +4663,7 @@ void Config::addLook(const ConstLookRcPtr & look)
 void Config::clearLooks()
 {
     getImpl()->m_looksList.clear();
+    getImpl()->m_lookIndex.clear();
 
     AutoMutex lock(getImpl()->m_cacheidMutex);
     getImpl()->resetCacheIDs();
@@ -4589,33 +4739,25 @@ void Config::addViewTransform(const ConstViewTransformRcPtr & viewTransform)
         throw Exception("Cannot add view transform with an empty name.");
     }
 
-    if (!viewTransform->getTransform(VIEWTRANSFORM_DIR_TO_REFERENCE) &&
-        !viewTransform->getTransform(VIEWTRANSFORM_DIR_FROM_REFERENCE))
+    if (!viewTransform->getImpl()->hasTransform(VIEWTRANSFORM_DIR_TO_REFERENCE) &&
+        !viewTransform->getImpl()->hasTransform(VIEWTRANSFORM_DIR_FROM_REFERENCE))
     {
         std::ostringstream os;
         os << "Cannot add view transform '" << name << "' with no transform.";
         throw Exception(os.str().c_str());
     }
 
-    const std::string namelower = StringUtils::Lower(name);
-
-    bool addIt = true;
-
     // If the view transform exists, replace it.
-    for (auto && vt : getImpl()->m_viewTransforms)
+    const size_t idx = getImpl()->m_viewTransformIndex.find(name);
+    if (idx != NameIndex::npos)
     {
-        if (StringUtils::Lower(vt->getName()) == namelower)
-        {
-            vt = viewTransform->createEditableCopy();
-            addIt = false;
-            break;
-        }
+        getImpl()->m_viewTransforms[idx] = viewTransform->createEditableCopy();
     }
-
     // Otherwise, add it.
-    if (addIt)
+    else
     {
         getImpl()->m_viewTransforms.push_back(viewTransform->createEditableCopy());
+        getImpl()->m_viewTransformIndex.add(name.c_str(), getImpl()->m_viewTransforms.size() - 1);
     }
 
     AutoMutex lock(getImpl()->m_cacheidMutex);
@@ -4625,6 +4767,7 @@ void Config::addViewTransform(const ConstViewTransformRcPtr & viewTransform)
 void Config::clearViewTransforms()
 {
     getImpl()->m_viewTransforms.clear();
+    getImpl()->m_viewTransformIndex.clear();
 
     AutoMutex lock(getImpl()->m_cacheidMutex);
     getImpl()->resetCacheIDs();
@@ -4795,17 +4938,6 @@ ConstProcessorRcPtr Config::getProcessor(const ConstContextRcPtr & context,
     }
 
 
-    // The goal of the usedContext is to only contain the context vars that are actually used for
-    // this transform.  This allows the cache to be more efficient. However, there are still some
-    // various TODOs since the usedContext will sometimes contain more vars than are needed.
-
-    ContextRcPtr usedContext = Context::Create();
-    usedContext->setSearchPath(context->getSearchPath());
-    usedContext->setWorkingDir(context->getWorkingDir());
-    usedContext->setConfigIOProxy(context->getConfigIOProxy());
-
-    const bool needContextVariables = CollectContextVariables(*this, *context, transform, usedContext);
-
     // Create helper method.
     auto CreateProcessor = [](const Config & config, 
                               const ConstContextRcPtr & context,
@@ -4821,25 +4953,59 @@ ConstProcessorRcPtr Config::getProcessor(const ConstContextRcPtr & context,
 
     if (getImpl()->m_processorCache.isEnabled())
     {
-        AutoMutex guard(getImpl()->m_processorCache.lock());
+        // Note that the keys include a string description of the transform which does not include
+        // all the LUT entries (just the arguments of the FileTransforms for LUTs). The description
+        // is directly hashed to avoid building the string.
 
-        // Note that the key includes a string description of the transform which does not include
-        // all the LUT entries (just the arguments of the FileTransforms for LUTs).
-        std::ostringstream oss;
-        oss << (needContextVariables ? std::string(usedContext->getCacheID()) : "")
-            << *transform
-            << direction;
+        CacheIDHashStream requestKey;
+        requestKey << "Context " << context->getCacheID() << " " << *transform << direction;
 
-        const std::size_t key = std::hash<std::string>{}(oss.str());
+        CacheIDDigest key;
+        if (!getImpl()->m_processorKeys.get(requestKey.digest(), key))
+        {
+            // The goal of the usedContext is to only contain the context vars that are actually
+            // used for this transform.  This allows the cache to be more efficient. However,
+            // there are still some various TODOs since the usedContext will sometimes contain
+            // more vars than are needed.
 
-        // As the entry is a shared pointer instance, having an empty one means that the entry does
-        // not exist in the cache. So, it provides a fast existence check & access in one call.
-        ProcessorRcPtr & processor = getImpl()->m_processorCache[key];
-        if (!processor)
+            ContextRcPtr usedContext = Context::Create();
+            usedContext->setSearchPath(context->getSearchPath());
+            usedContext->setWorkingDir(context->getWorkingDir());
+            usedContext->setConfigIOProxy(context->getConfigIOProxy());
+
+            const bool needContextVariables
+                = CollectContextVariables(*this, *context, transform, usedContext);
+
+            CacheIDHashStream oss;
+            if (needContextVariables)
+            {
+                oss << usedContext->getCacheID();
+            }
+            oss << *transform << direction;
+
+            key = oss.digest();
+            getImpl()->m_processorKeys.insert(requestKey.digest(), key, 0);
+        }
+
+        auto lookup = [this, &key](ProcessorRcPtr & processor)
+        {
+            return getImpl()->m_processorCache.get(key, processor);
+        };
+
+        auto create = [&]()
         {
-            ProcessorRcPtr proc = CreateProcessor(*this, context, transform, direction);
+            // The processor creation (i.e. including the LUT file loading) happens without
+            // holding any lock so different processors are concurrently created.
+
+            ProcessorRcPtr processor = CreateProcessor(*this, context, transform, direction);
 
             const bool doFallback = !Platform::isEnvPresent(OCIO_DISABLE_CACHE_FALLBACK);
+
+            const std::string cacheID = doFallback ? processor->getCacheID() : std::string();
+            const size_t footprint = processor->getImpl()->getMemoryFootprint();
+
+            AutoMutex guard(getImpl()->m_processorCacheMutex);
+
             if (doFallback)
             {
                 // If an entry with the same cache ID already exists in the cache then reuse it
@@ -4854,23 +5020,17 @@ ConstProcessorRcPtr Config::getProcessor(const ConstContextRcPtr & context,
                 // compare the two contexts before doing the lengthy Processor::getCacheID()
                 // computation.
 
-                for (auto & entry : getImpl()->m_processorCache)
-                {
-                    if (entry.second && 0 == strcmp(entry.second->getCacheID(), proc->getCacheID()))
-                    {
-                        processor = entry.second;
-                        break;
-                    }
-                }
+                processor = getImpl()->shareProcessor(key, cacheID, processor);
             }
 
-            if (!processor)
-            {
-                processor = proc;
-            }
-        }
+            // Note that a processor reused from another entry is accounted for twice, so the
+            // memory footprint could be overestimated but never underestimated.
+            getImpl()->m_processorCache.insert(key, processor, footprint);
 
-        return processor;
+            return processor;
+        };
+
+        return getImpl()->m_processorFlights.get(key, lookup, create);
     }
     else
     {
@@ -5322,6 +5482,38 @@ void Config::serialize(std::ostream& os) const
     }
 }
 
+void Config::serializeSnapshot(std::ostream & os) const
+{
+    try
+    {
+        getImpl()->checkVersionConsistency();
+
+        ConfigSnapshot::Write(os, *this);
+    }
+    catch (const std::exception & e)
+    {
+        std::ostringstream error;
+        error << "Error building the config snapshot: " << e.what();
+        throw Exception(error.str().c_str());
+    }
+}
+
+void Config::serializeSnapshot(const char * filename) const
+{
+    try
+    {
+        getImpl()->checkVersionConsistency();
+
+        ConfigSnapshot::WriteFile(filename, *this);
+    }
+    catch (const std::exception & e)
+    {
+        std::ostringstream error;
+        error << "Error building the config snapshot: " << e.what();
+        throw Exception(error.str().c_str());
+    }
+}
+
 ProcessorCacheFlags Config::getProcessorCacheFlags() const noexcept
 {
     return getImpl()->getProcessorCacheFlags();
@@ -5334,7 +5526,34 @@ void Config::setProcessorCacheFlags(ProcessorCacheFlags flags) const noexcept
 
 void Config::clearProcessorCache() noexcept
 {
-    getImpl()->m_processorCache.clear();
+    getImpl()->clearProcessorCache();
+}
+
+void Config::setProcessorCacheLimits(size_t maxProcessors, size_t maxBytes) const
+{
+    getImpl()->m_processorCache.setMaxEntries(maxProcessors);
+    getImpl()->m_processorCache.setBudget(maxBytes);
+}
+
+void Config::getProcessorCacheLimits(size_t & maxProcessors, size_t & maxBytes) const noexcept
+{
+    maxProcessors = getImpl()->m_processorCache.getMaxEntries();
+    maxBytes      = getImpl()->m_processorCache.getBudget();
+}
+
+void Config::getProcessorCacheStatistics(size_t & numHits,
+                                         size_t & numMisses,
+                                         size_t & numEvictions,
+                                         size_t & numEntries,
+                                         size_t & numBytes) const noexcept
+{
+    const auto stats = getImpl()->m_processorCache.getStatistics();
+
+    numHits      = stats.m_hits;
+    numMisses    = stats.m_misses;
+    numEvictions = stats.m_evictions;
+    numEntries   = stats.m_entries;
+    numBytes     = stats.m_cost;
 }
 
 ///////////////////////////////////////////////////////////////////////////
@@ -5462,7 +5681,7 @@ void Config::Impl::resetCacheIDs()
 
     // As any changes could impact the cache keys, it's better to always flush the cache
     // of processors to not keep in memory useless instances.
-    m_processorCache.clear();
+    clearProcessorCache();
 }
 
 void Config::Impl::getAllInternalTransforms(ConstTransformVec & transformVec) const
@@ -5540,9 +5759,18 @@ void Config::Impl::getAllInternalTransforms(ConstTransformVec & transformVec) co
 ConstConfigRcPtr Config::Impl::Read(std::istream & istream, const char * filename)
 {
     ConfigRcPtr config = Config::Create();
-    OCIOYaml::Read(istream, config, filename);
 
-    config->getImpl()->checkVersionConsistency();
+    const bool lazy = Platform::isEnvPresent(OCIO_LAZY_LOADING_ENVVAR);
+    if (lazy)
+    {
+        ReadLazy(istream, config, filename);
+    }
+    else
+    {
+        OCIOYaml::Read(istream, config, filename);
+    }
+
+    config->getImpl()->checkVersionConsistency(!lazy);
 
     // An API request always supersedes the env. variable. As the OCIOYaml helper methods
     // use the Config public API, the variable reset highlights that only the
@@ -5553,15 +5781,38 @@ ConstConfigRcPtr Config::Impl::Read(std::istream & istream, const char * filenam
     return config;
 }
 
+ConstConfigRcPtr Config::Impl::ReadSnapshot(const char * data, size_t size,
+                                            const char * filename)
+{
+    ConfigRcPtr config = Config::Create();
+    ConfigSnapshot::Read(data, size, config, filename);
+
+    config->getImpl()->checkVersionConsistency();
+
+    // Same as a config file read i.e. only the env. variable and the config contents are valid.
+    config->getImpl()->m_inactiveColorSpaceNamesAPI.clear();
+    config->getImpl()->refreshActiveColorSpaces();
+
+    return config;
+}
+
 ConstConfigRcPtr Config::Impl::Read(std::istream & istream, ConfigIOProxyRcPtr ciop)
 {
     ConfigRcPtr config = Config::Create();
     // Passing special string for the file path to enable the parser to provide a more
     // meaningful error message if a problem is encountered.  (The working directory is not
     // set to this string.)
-    OCIOYaml::Read(istream, config, "from Archive/ConfigIOProxy");
+    const bool lazy = Platform::isEnvPresent(OCIO_LAZY_LOADING_ENVVAR);
+    if (lazy)
+    {
+        ReadLazy(istream, config, "from Archive/ConfigIOProxy");
+    }
+    else
+    {
+        OCIOYaml::Read(istream, config, "from Archive/ConfigIOProxy");
+    }
 
-    config->getImpl()->checkVersionConsistency();
+    config->getImpl()->checkVersionConsistency(!lazy);
 
     // An API request always supersedes the env. variable. As the OCIOYaml helper methods
     // use the Config public API, the variable reset highlights that only the
@@ -5575,24 +5826,26 @@ ConstConfigRcPtr Config::Impl::Read(std::istream & istream, ConfigIOProxyRcPtr c
     return config;
 }
 
-void Config::Impl::checkVersionConsistency(ConstTransformRcPtr & transform) const
+void Config::Impl::CheckVersionConsistency(const ConstTransformRcPtr & transform,
+                                           unsigned int majorVersion,
+                                           unsigned int minorVersion)
 {
     if (transform)
     {
         if (ConstBuiltinTransformRcPtr blt = DynamicPtrCast<const BuiltinTransform>(transform))
         {
-            if (m_majorVersion < 2)
+            if (majorVersion < 2)
             {
                 throw Exception("Only config version 2 (or higher) can have BuiltinInTransform.");
             }
 
-            if (m_majorVersion == 2 && m_minorVersion < 1
+            if (majorVersion == 2 && minorVersion < 1
                     && 0 == Platform::Strcasecmp(blt->getStyle(), "ACES-LMT - ACES 1.3 Reference Gamut Compression"))
             {
                 throw Exception("Only config version 2.1 (or higher) can have "
                                 "BuiltinTransform style 'ACES-LMT - ACES 1.3 Reference Gamut Compression'.");
             }
-            if (m_majorVersion == 2 && m_minorVersion < 2 
+            if (majorVersion == 2 && minorVersion < 2 
                     && (   0 == Platform::Strcasecmp(blt->getStyle(), "ARRI_LOGC4_to_ACES2065-1")
                         || 0 == Platform::Strcasecmp(blt->getStyle(), "CURVE - CANON_CLOG2_to_LINEAR")
                         || 0 == Platform::Strcasecmp(blt->getStyle(), "CURVE - CANON_CLOG3_to_LINEAR") )
@@ -5603,13 +5856,13 @@ void Config::Impl::checkVersionConsistency(ConstTransformRcPtr & transform) cons
                    << blt->getStyle() << "'.";
                 throw Exception(os.str().c_str());
             }
-            if (m_majorVersion == 2 && m_minorVersion < 3
+            if (majorVersion == 2 && minorVersion < 3
                     && 0 == Platform::Strcasecmp(blt->getStyle(), "DISPLAY - CIE-XYZ-D65_to_DisplayP3"))
             {
                 throw Exception("Only config version 2.3 (or higher) can have "
                                 "BuiltinTransform style 'DISPLAY - CIE-XYZ-D65_to_DisplayP3'.");
             }
-            if (m_majorVersion == 2 && m_minorVersion < 4 
+            if (majorVersion == 2 && minorVersion < 4 
                     && (   0 == Platform::Strcasecmp(blt->getStyle(), "APPLE_LOG_to_ACES2065-1")
                         || 0 == Platform::Strcasecmp(blt->getStyle(), "CURVE - APPLE_LOG_to_LINEAR")
                         || 0 == Platform::Strcasecmp(blt->getStyle(), "CURVE - HLG-OETF")
@@ -5659,7 +5912,7 @@ void Config::Impl::checkVersionConsistency(ConstTransformRcPtr & transform) cons
         }
         else if (ConstCDLTransformRcPtr cdl = DynamicPtrCast<const CDLTransform>(transform))
         {
-            if (m_majorVersion < 2 && cdl->getStyle() != CDL_TRANSFORM_DEFAULT)
+            if (majorVersion < 2 && cdl->getStyle() != CDL_TRANSFORM_DEFAULT)
             {
                 throw Exception("Only config version 2 (or higher) can have style for "
                                 "CDLTransform.");
@@ -5667,7 +5920,7 @@ void Config::Impl::checkVersionConsistency(ConstTransformRcPtr & transform) cons
         }
         else if (DynamicPtrCast<const DisplayViewTransform>(transform))
         {
-            if (m_majorVersion < 2)
+            if (majorVersion < 2)
             {
                 throw Exception("Only config version 2 (or higher) can have DisplayViewTransform.");
             }
@@ -5675,7 +5928,7 @@ void Config::Impl::checkVersionConsistency(ConstTransformRcPtr & transform) cons
         else if (ConstExponentTransformRcPtr ex =
                  DynamicPtrCast<const ExponentTransform>(transform))
         {
-            if (m_majorVersion < 2 && ex->getNegativeStyle() != NEGATIVE_CLAMP)
+            if (majorVersion < 2 && ex->getNegativeStyle() != NEGATIVE_CLAMP)
             {
                 throw Exception("Config version 1 only supports ExponentTransform clamping "
                                 "negative values.");
@@ -5683,7 +5936,7 @@ void Config::Impl::checkVersionConsistency(ConstTransformRcPtr & transform) cons
         }
         else if (DynamicPtrCast<const ExponentWithLinearTransform>(transform))
         {
-            if (m_majorVersion < 2)
+            if (majorVersion < 2)
             {
                 throw Exception("Only config version 2 (or higher) can have "
                                 "ExponentWithLinearTransform.");
@@ -5691,7 +5944,7 @@ void Config::Impl::checkVersionConsistency(ConstTransformRcPtr & transform) cons
         }
         else if (DynamicPtrCast<const ExposureContrastTransform>(transform))
         {
-            if (m_majorVersion < 2)
+            if (majorVersion < 2)
             {
                 throw Exception("Only config version 2 (or higher) can have "
                                 "ExposureContrastTransform.");
@@ -5699,7 +5952,7 @@ void Config::Impl::checkVersionConsistency(ConstTransformRcPtr & transform) cons
         }
         else if (ConstFileTransformRcPtr ft = DynamicPtrCast<const FileTransform>(transform))
         {
-            if (m_majorVersion < 2)
+            if (majorVersion < 2)
             {
                 if (ft->getInterpolation() == INTERP_CUBIC)
                 {
@@ -5716,19 +5969,19 @@ void Config::Impl::checkVersionConsistency(ConstTransformRcPtr & transform) cons
         else if (ConstFixedFunctionTransformRcPtr ff = DynamicPtrCast<const FixedFunctionTransform>(transform))
         {
             auto ffstyle = ff->getStyle();
-            if (m_majorVersion < 2)
+            if (majorVersion < 2)
             {
                 throw Exception("Only config version 2 (or higher) can have "
                                 "FixedFunctionTransform.");
             }
 
-            if (m_majorVersion == 2 && m_minorVersion < 1 && ffstyle == FIXED_FUNCTION_ACES_GAMUT_COMP_13)
+            if (majorVersion == 2 && minorVersion < 1 && ffstyle == FIXED_FUNCTION_ACES_GAMUT_COMP_13)
             {
                 throw Exception("Only config version 2.1 (or higher) can have "
                                 "FixedFunctionTransform style 'ACES_GAMUT_COMP_13'.");
             }
 
-            if (m_majorVersion == 2 && m_minorVersion < 4 )
+            if (majorVersion == 2 && minorVersion < 4 )
             {
                 if( ffstyle == FIXED_FUNCTION_LIN_TO_PQ  || 
                     ffstyle == FIXED_FUNCTION_LIN_TO_GAMMA_LOG || 
@@ -5745,7 +5998,7 @@ void Config::Impl::checkVersionConsistency(ConstTransformRcPtr & transform) cons
                 }
             }
 
-            if (m_majorVersion == 2 && m_minorVersion < 5 )
+            if (majorVersion == 2 && minorVersion < 5 )
             {
                 if( ffstyle == FIXED_FUNCTION_RGB_TO_HSY_LIN  || 
                     ffstyle == FIXED_FUNCTION_RGB_TO_HSY_LOG ||
@@ -5760,7 +6013,7 @@ void Config::Impl::checkVersionConsistency(ConstTransformRcPtr & transform) cons
         }
         else if (DynamicPtrCast<const GradingPrimaryTransform>(transform))
         {
-            if (m_majorVersion < 2)
+            if (majorVersion < 2)
             {
                 throw Exception("Only config version 2 (or higher) can have "
                                 "GradingPrimaryTransform.");
@@ -5768,7 +6021,7 @@ void Config::Impl::checkVersionConsistency(ConstTransformRcPtr & transform) cons
         }
         else if (DynamicPtrCast<const GradingRGBCurveTransform>(transform))
         {
-            if (m_majorVersion < 2)
+            if (majorVersion < 2)
             {
                 throw Exception("Only config version 2 (or higher) can have "
                                 "GradingRGBCurveTransform.");
@@ -5776,7 +6029,7 @@ void Config::Impl::checkVersionConsistency(ConstTransformRcPtr & transform) cons
         }
         else if (DynamicPtrCast<const GradingHueCurveTransform>(transform))
         {
-            if (m_majorVersion == 2 && m_minorVersion < 5 )
+            if (majorVersion == 2 && minorVersion < 5 )
             {
                 throw Exception("Only config version 2.5 (or higher) can have "
                                 "GradingHueCurveTransform.");
@@ -5784,7 +6037,7 @@ void Config::Impl::checkVersionConsistency(ConstTransformRcPtr & transform) cons
         }
         else if (DynamicPtrCast<const GradingToneTransform>(transform))
         {
-            if (m_majorVersion < 2)
+            if (majorVersion < 2)
             {
                 throw Exception("Only config version 2 (or higher) can have "
                                 "GradingToneTransform.");
@@ -5792,21 +6045,21 @@ void Config::Impl::checkVersionConsistency(ConstTransformRcPtr & transform) cons
         }
         else if (DynamicPtrCast<const LogAffineTransform>(transform))
         {
-            if (m_majorVersion < 2)
+            if (majorVersion < 2)
             {
                 throw Exception("Only config version 2 (or higher) can have LogAffineTransform.");
             }
         }
         else if (DynamicPtrCast<const LogCameraTransform>(transform))
         {
-            if (m_majorVersion < 2)
+            if (majorVersion < 2)
             {
                 throw Exception("Only config version 2 (or higher) can have LogCameraTransform.");
             }
         }
         else if (DynamicPtrCast<const RangeTransform>(transform))
         {
-            if (m_majorVersion < 2)
+            if (majorVersion < 2)
             {
                 throw Exception("Only config version 2 (or higher) can have RangeTransform.");
             }
@@ -5817,24 +6070,32 @@ void Config::Impl::checkVersionConsistency(ConstTransformRcPtr & transform) cons
             for (int idx = 0; idx < numTransforms; ++idx)
             {
                 ConstTransformRcPtr tr = grp->getTransform(idx);
-                checkVersionConsistency(tr);
+                CheckVersionConsistency(tr, majorVersion, minorVersion);
             }
         }
     }
 }
 
-void Config::Impl::checkVersionConsistency() const
+void Config::Impl::checkVersionConsistency(ConstTransformRcPtr & transform) const
+{
+    CheckVersionConsistency(transform, m_majorVersion, m_minorVersion);
+}
+
+void Config::Impl::checkVersionConsistency(bool checkTransforms) const
 {
     unsigned int hexVersion = (m_majorVersion << 24) | (m_minorVersion << 16);
 
     // Check for the Transforms.
 
-    ConstTransformVec transforms;
-    getAllInternalTransforms(transforms);
-
-    for (auto & transform : transforms)
+    if (checkTransforms)
     {
-        checkVersionConsistency(transform);
+        ConstTransformVec transforms;
+        getAllInternalTransforms(transforms);
+
+        for (auto & transform : transforms)
+        {
+            checkVersionConsistency(transform);
+        }
     }
 
     // Check for the family separator.
@@ -0,0 +1,2013 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <sstream>
+
+#include <pystring.h>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "ConfigSnapshot.h"
+#include "HashUtils.h"
+#include "ParseUtils.h"
+#include "PathUtils.h"
+#include "Platform.h"
+#include "utils/StringUtils.h"
+
+
+namespace OCIO_NAMESPACE
+{
+
+namespace
+{
+
+// The version must be increased when the payload layout changes (including any change to the
+// value of a serialized enum).
+constexpr uint32_t SnapshotFormatVersion = 1;
+
+constexpr char SnapshotSignature[ConfigSnapshot::SignatureSize]
+    = { ConfigSnapshot::SignatureStartByte, 'O', 'C', 'I', 'O', '\r', '\n', '\x1a' };
+
+// Signature, format version, reserved, payload size & payload checksum.
+constexpr size_t SnapshotHeaderSize
+    = ConfigSnapshot::SignatureSize + 2 * sizeof(uint32_t) + 3 * sizeof(uint64_t);
+
+static_assert(OCIO_LITTLE_ENDIAN, "The config snapshot only supports little-endian platforms.");
+
+// The valid values of the serialized enums so a corrupted snapshot is rejected instead of setting
+// an out of range value. A new enum value must be added here (and the format version increased).
+
+template<typename E>
+constexpr bool InRange(int32_t val, E first, E last)
+{
+    return val >= static_cast<int32_t>(first) && val <= static_cast<int32_t>(last);
+}
+
+template<typename E> bool IsValidEnum(int32_t val);
+
+template<> bool IsValidEnum<Allocation>(int32_t val)
+{
+    return InRange(val, ALLOCATION_UNKNOWN, ALLOCATION_LG2);
+}
+
+template<> bool IsValidEnum<BitDepth>(int32_t val)
+{
+    return InRange(val, BIT_DEPTH_UNKNOWN, BIT_DEPTH_F32);
+}
+
+template<> bool IsValidEnum<BSplineType>(int32_t val)
+{
+    return InRange(val, B_SPLINE, HORIZONTAL1_B_SPLINE);
+}
+
+template<> bool IsValidEnum<CDLStyle>(int32_t val)
+{
+    return InRange(val, CDL_ASC, CDL_NO_CLAMP);
+}
+
+template<> bool IsValidEnum<EnvironmentMode>(int32_t val)
+{
+    return InRange(val, ENV_ENVIRONMENT_UNKNOWN, ENV_ENVIRONMENT_LOAD_ALL);
+}
+
+template<> bool IsValidEnum<ExposureContrastStyle>(int32_t val)
+{
+    return InRange(val, EXPOSURE_CONTRAST_LINEAR, EXPOSURE_CONTRAST_LOGARITHMIC);
+}
+
+template<> bool IsValidEnum<FixedFunctionStyle>(int32_t val)
+{
+    return InRange(val, FIXED_FUNCTION_ACES_RED_MOD_03, FIXED_FUNCTION_RGB_TO_HSY_VID);
+}
+
+template<> bool IsValidEnum<GradingStyle>(int32_t val)
+{
+    return InRange(val, GRADING_LOG, GRADING_VIDEO);
+}
+
+template<> bool IsValidEnum<HSYTransformStyle>(int32_t val)
+{
+    return InRange(val, HSY_TRANSFORM_NONE, HSY_TRANSFORM_1);
+}
+
+template<> bool IsValidEnum<Interpolation>(int32_t val)
+{
+    return InRange(val, INTERP_UNKNOWN, INTERP_CUBIC)
+        || val == INTERP_DEFAULT || val == INTERP_BEST;
+}
+
+template<> bool IsValidEnum<Lut1DHueAdjust>(int32_t val)
+{
+    return InRange(val, HUE_NONE, HUE_WYPN);
+}
+
+template<> bool IsValidEnum<NegativeStyle>(int32_t val)
+{
+    return InRange(val, NEGATIVE_CLAMP, NEGATIVE_LINEAR);
+}
+
+template<> bool IsValidEnum<RangeStyle>(int32_t val)
+{
+    return InRange(val, RANGE_NO_CLAMP, RANGE_CLAMP);
+}
+
+template<> bool IsValidEnum<ReferenceSpaceType>(int32_t val)
+{
+    return InRange(val, REFERENCE_SPACE_SCENE, REFERENCE_SPACE_DISPLAY);
+}
+
+template<> bool IsValidEnum<TransformDirection>(int32_t val)
+{
+    return InRange(val, TRANSFORM_DIR_FORWARD, TRANSFORM_DIR_INVERSE);
+}
+
+template<> bool IsValidEnum<TransformType>(int32_t val)
+{
+    return InRange(val, TRANSFORM_TYPE_ALLOCATION, TRANSFORM_TYPE_RANGE);
+}
+
+class SnapshotWriter
+{
+public:
+    SnapshotWriter() = default;
+    SnapshotWriter(const SnapshotWriter &) = delete;
+    SnapshotWriter & operator=(const SnapshotWriter &) = delete;
+
+    const std::string & buffer() const noexcept { return m_buffer; }
+
+    template<typename T>
+    void writePOD(const T & val)
+    {
+        m_buffer.append(reinterpret_cast<const char *>(&val), sizeof(T));
+    }
+
+    void writeBool(bool val) { writePOD<uint8_t>(val ? 1 : 0); }
+    void writeUInt(uint32_t val) { writePOD(val); }
+    void writeSize(size_t val) { writePOD<uint64_t>(static_cast<uint64_t>(val)); }
+    void writeDouble(double val) { writePOD(val); }
+    void writeFloat(float val) { writePOD(val); }
+
+    template<typename E>
+    void writeEnum(E val) { writePOD<int32_t>(static_cast<int32_t>(val)); }
+
+    void writeDoubles(const double * vals, size_t num)
+    {
+        m_buffer.append(reinterpret_cast<const char *>(vals), num * sizeof(double));
+    }
+
+    // Strings are null-terminated so the reader could use them in place.
+    void writeString(const char * str)
+    {
+        const size_t len = str ? strlen(str) : 0;
+        writeUInt(static_cast<uint32_t>(len));
+        m_buffer.append(str ? str : "", len);
+        m_buffer.push_back('\0');
+    }
+
+    void writeString(const std::string & str) { writeString(str.c_str()); }
+
+private:
+    std::string m_buffer;
+};
+
+class SnapshotReader
+{
+public:
+    SnapshotReader(const char * data, size_t size, const char * filename)
+        : m_data(data)
+        , m_size(size)
+        , m_filename(filename && *filename ? filename : "<stream>")
+    {
+    }
+
+    SnapshotReader() = delete;
+    SnapshotReader(const SnapshotReader &) = delete;
+    SnapshotReader & operator=(const SnapshotReader &) = delete;
+
+    bool atEnd() const noexcept { return m_pos == m_size; }
+
+    template<typename T>
+    T readPOD()
+    {
+        T val;
+        memcpy(&val, consume(sizeof(T)), sizeof(T));
+        return val;
+    }
+
+    bool readBool() { return readPOD<uint8_t>() != 0; }
+    uint32_t readUInt() { return readPOD<uint32_t>(); }
+    double readDouble() { return readPOD<double>(); }
+    float readFloat() { return readPOD<float>(); }
+
+    size_t readSize()
+    {
+        const uint64_t val = readPOD<uint64_t>();
+        // Any count is bounded by the payload size, which also protects the allocations.
+        if (val > m_size)
+        {
+            throwCorrupted();
+        }
+        return static_cast<size_t>(val);
+    }
+
+    template<typename E>
+    E readEnum()
+    {
+        const int32_t val = readPOD<int32_t>();
+        if (!IsValidEnum<E>(val))
+        {
+            throwCorrupted();
+        }
+        return static_cast<E>(val);
+    }
+
+    void readDoubles(double * vals, size_t num)
+    {
+        memcpy(vals, consume(num * sizeof(double)), num * sizeof(double));
+    }
+
+    // The returned string points into the snapshot data.
+    const char * readString()
+    {
+        const uint32_t len = readUInt();
+        const char * str = consume(size_t(len) + 1);
+        if (str[len] != '\0')
+        {
+            throwCorrupted();
+        }
+        return str;
+    }
+
+    [[noreturn]] void throwCorrupted() const
+    {
+        std::ostringstream os;
+        os << "The config snapshot '" << m_filename << "' is corrupted.";
+        throw Exception(os.str().c_str());
+    }
+
+private:
+    const char * consume(size_t num)
+    {
+        if (num > m_size - m_pos)
+        {
+            throwCorrupted();
+        }
+        const char * ptr = m_data + m_pos;
+        m_pos += num;
+        return ptr;
+    }
+
+    const char * m_data;
+    const size_t m_size;
+    size_t m_pos = 0;
+    const std::string m_filename;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////
+// Helpers.
+
+void WriteStringVec(SnapshotWriter & w, const StringUtils::StringVec & vec)
+{
+    w.writeSize(vec.size());
+    for (const auto & str : vec)
+    {
+        w.writeString(str);
+    }
+}
+
+StringUtils::StringVec ReadStringVec(SnapshotReader & r)
+{
+    const size_t num = r.readSize();
+    StringUtils::StringVec vec;
+    vec.reserve(num);
+    for (size_t i = 0; i < num; ++i)
+    {
+        vec.emplace_back(r.readString());
+    }
+    return vec;
+}
+
+void WriteAttributes(SnapshotWriter & w, const std::map<std::string, std::string> & attrs)
+{
+    w.writeSize(attrs.size());
+    for (const auto & attr : attrs)
+    {
+        w.writeString(attr.first);
+        w.writeString(attr.second);
+    }
+}
+
+template<typename T>
+void ReadAttributes(SnapshotReader & r, T & owner)
+{
+    const size_t num = r.readSize();
+    for (size_t i = 0; i < num; ++i)
+    {
+        const char * name  = r.readString();
+        const char * value = r.readString();
+        owner.setInterchangeAttribute(name, value);
+    }
+}
+
+template<typename T>
+void WriteCategories(SnapshotWriter & w, const T & owner)
+{
+    const int num = owner.getNumCategories();
+    w.writeSize(num);
+    for (int i = 0; i < num; ++i)
+    {
+        w.writeString(owner.getCategory(i));
+    }
+}
+
+template<typename T>
+void ReadCategories(SnapshotReader & r, T & owner)
+{
+    const size_t num = r.readSize();
+    for (size_t i = 0; i < num; ++i)
+    {
+        owner.addCategory(r.readString());
+    }
+}
+
+template<typename T>
+void WriteAliases(SnapshotWriter & w, const T & owner)
+{
+    const size_t num = owner.getNumAliases();
+    w.writeSize(num);
+    for (size_t i = 0; i < num; ++i)
+    {
+        w.writeString(owner.getAlias(i));
+    }
+}
+
+template<typename T>
+void ReadAliases(SnapshotReader & r, T & owner)
+{
+    const size_t num = r.readSize();
+    for (size_t i = 0; i < num; ++i)
+    {
+        owner.addAlias(r.readString());
+    }
+}
+
+// Note that the root element name is not written as it is always the same.
+void WriteMetadataContent(SnapshotWriter & w, const FormatMetadata & md)
+{
+    w.writeString(md.getElementValue());
+
+    const int numAttrs = md.getNumAttributes();
+    w.writeSize(numAttrs);
+    for (int i = 0; i < numAttrs; ++i)
+    {
+        w.writeString(md.getAttributeName(i));
+        w.writeString(md.getAttributeValue(i));
+    }
+
+    const int numChildren = md.getNumChildrenElements();
+    w.writeSize(numChildren);
+    for (int i = 0; i < numChildren; ++i)
+    {
+        const FormatMetadata & child = md.getChildElement(i);
+        w.writeString(child.getElementName());
+        WriteMetadataContent(w, child);
+    }
+}
+
+void ReadMetadataContent(SnapshotReader & r, FormatMetadata & md)
+{
+    // Note that the root element can't have a value.
+    const char * value = r.readString();
+    if (*value)
+    {
+        md.setElementValue(value);
+    }
+
+    const size_t numAttrs = r.readSize();
+    for (size_t i = 0; i < numAttrs; ++i)
+    {
+        const char * name  = r.readString();
+        const char * value = r.readString();
+        md.addAttribute(name, value);
+    }
+
+    const size_t numChildren = r.readSize();
+    for (size_t i = 0; i < numChildren; ++i)
+    {
+        const char * name = r.readString();
+        md.addChildElement(name, "");
+        ReadMetadataContent(r, md.getChildElement(md.getNumChildrenElements() - 1));
+    }
+}
+
+void WriteCurve(SnapshotWriter & w, const ConstGradingBSplineCurveRcPtr & curve)
+{
+    w.writeEnum(curve->getSplineType());
+    const size_t num = curve->getNumControlPoints();
+    w.writeSize(num);
+    for (size_t i = 0; i < num; ++i)
+    {
+        const GradingControlPoint & pt = curve->getControlPoint(i);
+        w.writeFloat(pt.m_x);
+        w.writeFloat(pt.m_y);
+        w.writeFloat(curve->getSlope(i));
+    }
+}
+
+void ReadCurve(SnapshotReader & r, const GradingBSplineCurveRcPtr & curve)
+{
+    curve->setSplineType(r.readEnum<BSplineType>());
+    const size_t num = r.readSize();
+    curve->setNumControlPoints(num);
+    for (size_t i = 0; i < num; ++i)
+    {
+        GradingControlPoint & pt = curve->getControlPoint(i);
+        pt.m_x = r.readFloat();
+        pt.m_y = r.readFloat();
+        curve->setSlope(i, r.readFloat());
+    }
+}
+
+void WriteRGBM(SnapshotWriter & w, const GradingRGBM & rgbm)
+{
+    const double vals[4]{ rgbm.m_red, rgbm.m_green, rgbm.m_blue, rgbm.m_master };
+    w.writeDoubles(vals, 4);
+}
+
+void ReadRGBM(SnapshotReader & r, GradingRGBM & rgbm)
+{
+    double vals[4];
+    r.readDoubles(vals, 4);
+    rgbm = GradingRGBM(vals);
+}
+
+void WriteRGBMSW(SnapshotWriter & w, const GradingRGBMSW & rgbmsw)
+{
+    const double vals[6]{ rgbmsw.m_red, rgbmsw.m_green, rgbmsw.m_blue,
+                          rgbmsw.m_master, rgbmsw.m_start, rgbmsw.m_width };
+    w.writeDoubles(vals, 6);
+}
+
+void ReadRGBMSW(SnapshotReader & r, GradingRGBMSW & rgbmsw)
+{
+    double vals[6];
+    r.readDoubles(vals, 6);
+    rgbmsw = GradingRGBMSW(vals);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////
+// Transforms.
+
+void WriteTransform(SnapshotWriter & w, const ConstTransformRcPtr & transform);
+TransformRcPtr ReadTransform(SnapshotReader & r);
+
+void WriteTransformBody(SnapshotWriter & w, const ConstAllocationTransformRcPtr & t)
+{
+    w.writeEnum(t->getAllocation());
+    const int numVars = t->getNumVars();
+    std::vector<float> vars(numVars);
+    if (numVars > 0)
+    {
+        t->getVars(vars.data());
+    }
+    w.writeSize(numVars);
+    for (const float var : vars)
+    {
+        w.writeFloat(var);
+    }
+}
+
+TransformRcPtr ReadAllocationTransform(SnapshotReader & r)
+{
+    auto t = AllocationTransform::Create();
+    t->setAllocation(r.readEnum<Allocation>());
+    const size_t numVars = r.readSize();
+    std::vector<float> vars(numVars);
+    for (auto & var : vars)
+    {
+        var = r.readFloat();
+    }
+    t->setVars(static_cast<int>(numVars), vars.data());
+    return t;
+}
+
+void WriteTransformBody(SnapshotWriter & w, const ConstBuiltinTransformRcPtr & t)
+{
+    w.writeString(t->getStyle());
+}
+
+TransformRcPtr ReadBuiltinTransform(SnapshotReader & r)
+{
+    auto t = BuiltinTransform::Create();
+    t->setStyle(r.readString());
+    return t;
+}
+
+void WriteTransformBody(SnapshotWriter & w, const ConstCDLTransformRcPtr & t)
+{
+    // The id & the descriptions are part of the metadata.
+    WriteMetadataContent(w, t->getFormatMetadata());
+    w.writeEnum(t->getStyle());
+    double sop[9];
+    t->getSOP(sop);
+    w.writeDoubles(sop, 9);
+    w.writeDouble(t->getSat());
+}
+
+TransformRcPtr ReadCDLTransform(SnapshotReader & r)
+{
+    auto t = CDLTransform::Create();
+    ReadMetadataContent(r, t->getFormatMetadata());
+    t->setStyle(r.readEnum<CDLStyle>());
+    double sop[9];
+    r.readDoubles(sop, 9);
+    t->setSOP(sop);
+    t->setSat(r.readDouble());
+    return t;
+}
+
+void WriteTransformBody(SnapshotWriter & w, const ConstColorSpaceTransformRcPtr & t)
+{
+    w.writeString(t->getSrc());
+    w.writeString(t->getDst());
+    w.writeBool(t->getDataBypass());
+}
+
+TransformRcPtr ReadColorSpaceTransform(SnapshotReader & r)
+{
+    auto t = ColorSpaceTransform::Create();
+    t->setSrc(r.readString());
+    t->setDst(r.readString());
+    t->setDataBypass(r.readBool());
+    return t;
+}
+
+void WriteTransformBody(SnapshotWriter & w, const ConstDisplayViewTransformRcPtr & t)
+{
+    w.writeString(t->getSrc());
+    w.writeString(t->getDisplay());
+    w.writeString(t->getView());
+    w.writeBool(t->getLooksBypass());
+    w.writeBool(t->getDataBypass());
+}
+
+TransformRcPtr ReadDisplayViewTransform(SnapshotReader & r)
+{
+    auto t = DisplayViewTransform::Create();
+    t->setSrc(r.readString());
+    t->setDisplay(r.readString());
+    t->setView(r.readString());
+    t->setLooksBypass(r.readBool());
+    t->setDataBypass(r.readBool());
+    return t;
+}
+
+void WriteTransformBody(SnapshotWriter & w, const ConstExponentTransformRcPtr & t)
+{
+    WriteMetadataContent(w, t->getFormatMetadata());
+    double vals[4];
+    t->getValue(vals);
+    w.writeDoubles(vals, 4);
+    w.writeEnum(t->getNegativeStyle());
+}
+
+TransformRcPtr ReadExponentTransform(SnapshotReader & r)
+{
+    auto t = ExponentTransform::Create();
+    ReadMetadataContent(r, t->getFormatMetadata());
+    double vals[4];
+    r.readDoubles(vals, 4);
+    t->setValue(vals);
+    t->setNegativeStyle(r.readEnum<NegativeStyle>());
+    return t;
+}
+
+void WriteTransformBody(SnapshotWriter & w, const ConstExponentWithLinearTransformRcPtr & t)
+{
+    WriteMetadataContent(w, t->getFormatMetadata());
+    double vals[4];
+    t->getGamma(vals);
+    w.writeDoubles(vals, 4);
+    t->getOffset(vals);
+    w.writeDoubles(vals, 4);
+    w.writeEnum(t->getNegativeStyle());
+}
+
+TransformRcPtr ReadExponentWithLinearTransform(SnapshotReader & r)
+{
+    auto t = ExponentWithLinearTransform::Create();
+    ReadMetadataContent(r, t->getFormatMetadata());
+    double vals[4];
+    r.readDoubles(vals, 4);
+    t->setGamma(vals);
+    r.readDoubles(vals, 4);
+    t->setOffset(vals);
+    t->setNegativeStyle(r.readEnum<NegativeStyle>());
+    return t;
+}
+
+void WriteTransformBody(SnapshotWriter & w, const ConstExposureContrastTransformRcPtr & t)
+{
+    WriteMetadataContent(w, t->getFormatMetadata());
+    w.writeEnum(t->getStyle());
+    w.writeDouble(t->getExposure());
+    w.writeBool(t->isExposureDynamic());
+    w.writeDouble(t->getContrast());
+    w.writeBool(t->isContrastDynamic());
+    w.writeDouble(t->getGamma());
+    w.writeBool(t->isGammaDynamic());
+    w.writeDouble(t->getPivot());
+    w.writeDouble(t->getLogExposureStep());
+    w.writeDouble(t->getLogMidGray());
+}
+
+TransformRcPtr ReadExposureContrastTransform(SnapshotReader & r)
+{
+    auto t = ExposureContrastTransform::Create();
+    ReadMetadataContent(r, t->getFormatMetadata());
+    t->setStyle(r.readEnum<ExposureContrastStyle>());
+    t->setExposure(r.readDouble());
+    if (r.readBool())
+    {
+        t->makeExposureDynamic();
+    }
+    t->setContrast(r.readDouble());
+    if (r.readBool())
+    {
+        t->makeContrastDynamic();
+    }
+    t->setGamma(r.readDouble());
+    if (r.readBool())
+    {
+        t->makeGammaDynamic();
+    }
+    t->setPivot(r.readDouble());
+    t->setLogExposureStep(r.readDouble());
+    t->setLogMidGray(r.readDouble());
+    return t;
+}
+
+void WriteTransformBody(SnapshotWriter & w, const ConstFileTransformRcPtr & t)
+{
+    w.writeString(t->getSrc());
+    w.writeString(t->getCCCId());
+    w.writeEnum(t->getCDLStyle());
+    w.writeEnum(t->getInterpolation());
+}
+
+TransformRcPtr ReadFileTransform(SnapshotReader & r)
+{
+    auto t = FileTransform::Create();
+    t->setSrc(r.readString());
+    t->setCCCId(r.readString());
+    t->setCDLStyle(r.readEnum<CDLStyle>());
+    t->setInterpolation(r.readEnum<Interpolation>());
+    return t;
+}
+
+void WriteTransformBody(SnapshotWriter & w, const ConstFixedFunctionTransformRcPtr & t)
+{
+    WriteMetadataContent(w, t->getFormatMetadata());
+    w.writeEnum(t->getStyle());
+    const size_t numParams = t->getNumParams();
+    std::vector<double> params(numParams);
+    if (numParams > 0)
+    {
+        t->getParams(params.data());
+    }
+    w.writeSize(numParams);
+    w.writeDoubles(params.data(), numParams);
+}
+
+TransformRcPtr ReadFixedFunctionTransform(SnapshotReader & r)
+{
+    auto t = FixedFunctionTransform::Create(FIXED_FUNCTION_ACES_RED_MOD_03);
+    ReadMetadataContent(r, t->getFormatMetadata());
+    t->setStyle(r.readEnum<FixedFunctionStyle>());
+    const size_t numParams = r.readSize();
+    std::vector<double> params(numParams);
+    r.readDoubles(params.data(), numParams);
+    t->setParams(params.data(), numParams);
+    return t;
+}
+
+void WriteTransformBody(SnapshotWriter & w, const ConstGradingPrimaryTransformRcPtr & t)
+{
+    WriteMetadataContent(w, t->getFormatMetadata());
+    w.writeEnum(t->getStyle());
+    const GradingPrimary & val = t->getValue();
+    WriteRGBM(w, val.m_brightness);
+    WriteRGBM(w, val.m_contrast);
+    WriteRGBM(w, val.m_gamma);
+    WriteRGBM(w, val.m_offset);
+    WriteRGBM(w, val.m_exposure);
+    WriteRGBM(w, val.m_lift);
+    WriteRGBM(w, val.m_gain);
+    w.writeDouble(val.m_saturation);
+    w.writeDouble(val.m_pivot);
+    w.writeDouble(val.m_pivotBlack);
+    w.writeDouble(val.m_pivotWhite);
+    w.writeDouble(val.m_clampBlack);
+    w.writeDouble(val.m_clampWhite);
+    w.writeBool(t->isDynamic());
+}
+
+TransformRcPtr ReadGradingPrimaryTransform(SnapshotReader & r)
+{
+    auto t = GradingPrimaryTransform::Create(GRADING_LOG);
+    ReadMetadataContent(r, t->getFormatMetadata());
+    const GradingStyle style = r.readEnum<GradingStyle>();
+    t->setStyle(style);
+    GradingPrimary val(style);
+    ReadRGBM(r, val.m_brightness);
+    ReadRGBM(r, val.m_contrast);
+    ReadRGBM(r, val.m_gamma);
+    ReadRGBM(r, val.m_offset);
+    ReadRGBM(r, val.m_exposure);
+    ReadRGBM(r, val.m_lift);
+    ReadRGBM(r, val.m_gain);
+    val.m_saturation = r.readDouble();
+    val.m_pivot      = r.readDouble();
+    val.m_pivotBlack = r.readDouble();
+    val.m_pivotWhite = r.readDouble();
+    val.m_clampBlack = r.readDouble();
+    val.m_clampWhite = r.readDouble();
+    t->setValue(val);
+    if (r.readBool())
+    {
+        t->makeDynamic();
+    }
+    return t;
+}
+
+void WriteTransformBody(SnapshotWriter & w, const ConstGradingRGBCurveTransformRcPtr & t)
+{
+    WriteMetadataContent(w, t->getFormatMetadata());
+    w.writeEnum(t->getStyle());
+    const ConstGradingRGBCurveRcPtr curves = t->getValue();
+    for (int c = 0; c < RGB_NUM_CURVES; ++c)
+    {
+        WriteCurve(w, curves->getCurve(static_cast<RGBCurveType>(c)));
+    }
+    w.writeBool(t->getBypassLinToLog());
+    w.writeBool(t->isDynamic());
+}
+
+TransformRcPtr ReadGradingRGBCurveTransform(SnapshotReader & r)
+{
+    auto t = GradingRGBCurveTransform::Create(GRADING_LOG);
+    ReadMetadataContent(r, t->getFormatMetadata());
+    const GradingStyle style = r.readEnum<GradingStyle>();
+    t->setStyle(style);
+    GradingRGBCurveRcPtr curves = GradingRGBCurve::Create(style);
+    for (int c = 0; c < RGB_NUM_CURVES; ++c)
+    {
+        ReadCurve(r, curves->getCurve(static_cast<RGBCurveType>(c)));
+    }
+    t->setValue(curves);
+    t->setBypassLinToLog(r.readBool());
+    if (r.readBool())
+    {
+        t->makeDynamic();
+    }
+    return t;
+}
+
+void WriteTransformBody(SnapshotWriter & w, const ConstGradingHueCurveTransformRcPtr & t)
+{
+    WriteMetadataContent(w, t->getFormatMetadata());
+    w.writeEnum(t->getStyle());
+    const ConstGradingHueCurveRcPtr curves = t->getValue();
+    for (int c = 0; c < HUE_NUM_CURVES; ++c)
+    {
+        WriteCurve(w, curves->getCurve(static_cast<HueCurveType>(c)));
+    }
+    w.writeBool(curves->getDrawCurveOnly());
+    w.writeEnum(t->getRGBToHSY());
+    w.writeBool(t->isDynamic());
+}
+
+TransformRcPtr ReadGradingHueCurveTransform(SnapshotReader & r)
+{
+    auto t = GradingHueCurveTransform::Create(GRADING_LOG);
+    ReadMetadataContent(r, t->getFormatMetadata());
+    const GradingStyle style = r.readEnum<GradingStyle>();
+    t->setStyle(style);
+    GradingHueCurveRcPtr curves = GradingHueCurve::Create(style);
+    for (int c = 0; c < HUE_NUM_CURVES; ++c)
+    {
+        ReadCurve(r, curves->getCurve(static_cast<HueCurveType>(c)));
+    }
+    curves->setDrawCurveOnly(r.readBool());
+    t->setValue(curves);
+    t->setRGBToHSY(r.readEnum<HSYTransformStyle>());
+    if (r.readBool())
+    {
+        t->makeDynamic();
+    }
+    return t;
+}
+
+void WriteTransformBody(SnapshotWriter & w, const ConstGradingToneTransformRcPtr & t)
+{
+    WriteMetadataContent(w, t->getFormatMetadata());
+    w.writeEnum(t->getStyle());
+    const GradingTone & val = t->getValue();
+    WriteRGBMSW(w, val.m_blacks);
+    WriteRGBMSW(w, val.m_shadows);
+    WriteRGBMSW(w, val.m_midtones);
+    WriteRGBMSW(w, val.m_highlights);
+    WriteRGBMSW(w, val.m_whites);
+    w.writeDouble(val.m_scontrast);
+    w.writeBool(t->isDynamic());
+}
+
+TransformRcPtr ReadGradingToneTransform(SnapshotReader & r)
+{
+    auto t = GradingToneTransform::Create(GRADING_LOG);
+    ReadMetadataContent(r, t->getFormatMetadata());
+    const GradingStyle style = r.readEnum<GradingStyle>();
+    t->setStyle(style);
+    GradingTone val(style);
+    ReadRGBMSW(r, val.m_blacks);
+    ReadRGBMSW(r, val.m_shadows);
+    ReadRGBMSW(r, val.m_midtones);
+    ReadRGBMSW(r, val.m_highlights);
+    ReadRGBMSW(r, val.m_whites);
+    val.m_scontrast = r.readDouble();
+    t->setValue(val);
+    if (r.readBool())
+    {
+        t->makeDynamic();
+    }
+    return t;
+}
+
+void WriteTransformBody(SnapshotWriter & w, const ConstGroupTransformRcPtr & t)
+{
+    WriteMetadataContent(w, t->getFormatMetadata());
+    const int num = t->getNumTransforms();
+    w.writeSize(num);
+    for (int i = 0; i < num; ++i)
+    {
+        WriteTransform(w, t->getTransform(i));
+    }
+}
+
+TransformRcPtr ReadGroupTransform(SnapshotReader & r)
+{
+    auto t = GroupTransform::Create();
+    ReadMetadataContent(r, t->getFormatMetadata());
+    const size_t num = r.readSize();
+    for (size_t i = 0; i < num; ++i)
+    {
+        t->appendTransform(ReadTransform(r));
+    }
+    return t;
+}
+
+template<typename T>
+void WriteLogSideValues(SnapshotWriter & w, const T & t)
+{
+    double vals[3];
+    t->getLogSideSlopeValue(vals);
+    w.writeDoubles(vals, 3);
+    t->getLogSideOffsetValue(vals);
+    w.writeDoubles(vals, 3);
+    t->getLinSideSlopeValue(vals);
+    w.writeDoubles(vals, 3);
+    t->getLinSideOffsetValue(vals);
+    w.writeDoubles(vals, 3);
+}
+
+template<typename T>
+void ReadLogSideValues(SnapshotReader & r, T & t)
+{
+    double vals[3];
+    r.readDoubles(vals, 3);
+    t->setLogSideSlopeValue(vals);
+    r.readDoubles(vals, 3);
+    t->setLogSideOffsetValue(vals);
+    r.readDoubles(vals, 3);
+    t->setLinSideSlopeValue(vals);
+    r.readDoubles(vals, 3);
+    t->setLinSideOffsetValue(vals);
+}
+
+void WriteTransformBody(SnapshotWriter & w, const ConstLogAffineTransformRcPtr & t)
+{
+    WriteMetadataContent(w, t->getFormatMetadata());
+    w.writeDouble(t->getBase());
+    WriteLogSideValues(w, t);
+}
+
+TransformRcPtr ReadLogAffineTransform(SnapshotReader & r)
+{
+    auto t = LogAffineTransform::Create();
+    ReadMetadataContent(r, t->getFormatMetadata());
+    t->setBase(r.readDouble());
+    ReadLogSideValues(r, t);
+    return t;
+}
+
+void WriteTransformBody(SnapshotWriter & w, const ConstLogCameraTransformRcPtr & t)
+{
+    WriteMetadataContent(w, t->getFormatMetadata());
+    w.writeDouble(t->getBase());
+    WriteLogSideValues(w, t);
+    double vals[3];
+    t->getLinSideBreakValue(vals);
+    w.writeDoubles(vals, 3);
+    const bool hasLinearSlope = t->getLinearSlopeValue(vals);
+    w.writeBool(hasLinearSlope);
+    if (hasLinearSlope)
+    {
+        w.writeDoubles(vals, 3);
+    }
+}
+
+TransformRcPtr ReadLogCameraTransform(SnapshotReader & r)
+{
+    // The lin side break values are set below.
+    const double defaultBreak[3]{ 0., 0., 0. };
+    auto t = LogCameraTransform::Create(defaultBreak);
+    ReadMetadataContent(r, t->getFormatMetadata());
+    t->setBase(r.readDouble());
+    ReadLogSideValues(r, t);
+    double vals[3];
+    r.readDoubles(vals, 3);
+    t->setLinSideBreakValue(vals);
+    if (r.readBool())
+    {
+        r.readDoubles(vals, 3);
+        t->setLinearSlopeValue(vals);
+    }
+    return t;
+}
+
+void WriteTransformBody(SnapshotWriter & w, const ConstLogTransformRcPtr & t)
+{
+    WriteMetadataContent(w, t->getFormatMetadata());
+    w.writeDouble(t->getBase());
+}
+
+TransformRcPtr ReadLogTransform(SnapshotReader & r)
+{
+    auto t = LogTransform::Create();
+    ReadMetadataContent(r, t->getFormatMetadata());
+    t->setBase(r.readDouble());
+    return t;
+}
+
+void WriteTransformBody(SnapshotWriter & w, const ConstLookTransformRcPtr & t)
+{
+    w.writeString(t->getSrc());
+    w.writeString(t->getDst());
+    w.writeString(t->getLooks());
+    w.writeBool(t->getSkipColorSpaceConversion());
+}
+
+TransformRcPtr ReadLookTransform(SnapshotReader & r)
+{
+    auto t = LookTransform::Create();
+    t->setSrc(r.readString());
+    t->setDst(r.readString());
+    t->setLooks(r.readString());
+    t->setSkipColorSpaceConversion(r.readBool());
+    return t;
+}
+
+void WriteTransformBody(SnapshotWriter & w, const ConstLut1DTransformRcPtr & t)
+{
+    WriteMetadataContent(w, t->getFormatMetadata());
+    w.writeEnum(t->getFileOutputBitDepth());
+    w.writeBool(t->getInputHalfDomain());
+    w.writeBool(t->getOutputRawHalfs());
+    w.writeEnum(t->getHueAdjust());
+    w.writeEnum(t->getInterpolation());
+    const unsigned long length = t->getLength();
+    w.writeSize(length);
+    for (unsigned long i = 0; i < length; ++i)
+    {
+        float rgb[3];
+        t->getValue(i, rgb[0], rgb[1], rgb[2]);
+        w.writeFloat(rgb[0]);
+        w.writeFloat(rgb[1]);
+        w.writeFloat(rgb[2]);
+    }
+}
+
+TransformRcPtr ReadLut1DTransform(SnapshotReader & r)
+{
+    auto t = Lut1DTransform::Create();
+    ReadMetadataContent(r, t->getFormatMetadata());
+    t->setFileOutputBitDepth(r.readEnum<BitDepth>());
+    t->setInputHalfDomain(r.readBool());
+    t->setOutputRawHalfs(r.readBool());
+    t->setHueAdjust(r.readEnum<Lut1DHueAdjust>());
+    t->setInterpolation(r.readEnum<Interpolation>());
+    const unsigned long length = static_cast<unsigned long>(r.readSize());
+    t->setLength(length);
+    for (unsigned long i = 0; i < length; ++i)
+    {
+        const float red   = r.readFloat();
+        const float green = r.readFloat();
+        const float blue  = r.readFloat();
+        t->setValue(i, red, green, blue);
+    }
+    return t;
+}
+
+void WriteTransformBody(SnapshotWriter & w, const ConstLut3DTransformRcPtr & t)
+{
+    WriteMetadataContent(w, t->getFormatMetadata());
+    w.writeEnum(t->getFileOutputBitDepth());
+    w.writeEnum(t->getInterpolation());
+    const unsigned long gridSize = t->getGridSize();
+    w.writeSize(gridSize);
+    for (unsigned long ri = 0; ri < gridSize; ++ri)
+    {
+        for (unsigned long gi = 0; gi < gridSize; ++gi)
+        {
+            for (unsigned long bi = 0; bi < gridSize; ++bi)
+            {
+                float rgb[3];
+                t->getValue(ri, gi, bi, rgb[0], rgb[1], rgb[2]);
+                w.writeFloat(rgb[0]);
+                w.writeFloat(rgb[1]);
+                w.writeFloat(rgb[2]);
+            }
+        }
+    }
+}
+
+TransformRcPtr ReadLut3DTransform(SnapshotReader & r)
+{
+    auto t = Lut3DTransform::Create();
+    ReadMetadataContent(r, t->getFormatMetadata());
+    t->setFileOutputBitDepth(r.readEnum<BitDepth>());
+    t->setInterpolation(r.readEnum<Interpolation>());
+    const unsigned long gridSize = static_cast<unsigned long>(r.readSize());
+    t->setGridSize(gridSize);
+    for (unsigned long ri = 0; ri < gridSize; ++ri)
+    {
+        for (unsigned long gi = 0; gi < gridSize; ++gi)
+        {
+            for (unsigned long bi = 0; bi < gridSize; ++bi)
+            {
+                const float red   = r.readFloat();
+                const float green = r.readFloat();
+                const float blue  = r.readFloat();
+                t->setValue(ri, gi, bi, red, green, blue);
+            }
+        }
+    }
+    return t;
+}
+
+void WriteTransformBody(SnapshotWriter & w, const ConstMatrixTransformRcPtr & t)
+{
+    WriteMetadataContent(w, t->getFormatMetadata());
+    double vals[16];
+    t->getMatrix(vals);
+    w.writeDoubles(vals, 16);
+    t->getOffset(vals);
+    w.writeDoubles(vals, 4);
+    w.writeEnum(t->getFileInputBitDepth());
+    w.writeEnum(t->getFileOutputBitDepth());
+}
+
+TransformRcPtr ReadMatrixTransform(SnapshotReader & r)
+{
+    auto t = MatrixTransform::Create();
+    ReadMetadataContent(r, t->getFormatMetadata());
+    double vals[16];
+    r.readDoubles(vals, 16);
+    t->setMatrix(vals);
+    r.readDoubles(vals, 4);
+    t->setOffset(vals);
+    t->setFileInputBitDepth(r.readEnum<BitDepth>());
+    t->setFileOutputBitDepth(r.readEnum<BitDepth>());
+    return t;
+}
+
+void WriteTransformBody(SnapshotWriter & w, const ConstRangeTransformRcPtr & t)
+{
+    WriteMetadataContent(w, t->getFormatMetadata());
+    w.writeEnum(t->getStyle());
+    w.writeEnum(t->getFileInputBitDepth());
+    w.writeEnum(t->getFileOutputBitDepth());
+
+    w.writeBool(t->hasMinInValue());
+    w.writeDouble(t->hasMinInValue() ? t->getMinInValue() : 0.);
+    w.writeBool(t->hasMaxInValue());
+    w.writeDouble(t->hasMaxInValue() ? t->getMaxInValue() : 0.);
+    w.writeBool(t->hasMinOutValue());
+    w.writeDouble(t->hasMinOutValue() ? t->getMinOutValue() : 0.);
+    w.writeBool(t->hasMaxOutValue());
+    w.writeDouble(t->hasMaxOutValue() ? t->getMaxOutValue() : 0.);
+}
+
+TransformRcPtr ReadRangeTransform(SnapshotReader & r)
+{
+    auto t = RangeTransform::Create();
+    ReadMetadataContent(r, t->getFormatMetadata());
+    t->setStyle(r.readEnum<RangeStyle>());
+    t->setFileInputBitDepth(r.readEnum<BitDepth>());
+    t->setFileOutputBitDepth(r.readEnum<BitDepth>());
+
+    bool hasValue = r.readBool();
+    double value  = r.readDouble();
+    if (hasValue) t->setMinInValue(value);
+    hasValue = r.readBool();
+    value    = r.readDouble();
+    if (hasValue) t->setMaxInValue(value);
+    hasValue = r.readBool();
+    value    = r.readDouble();
+    if (hasValue) t->setMinOutValue(value);
+    hasValue = r.readBool();
+    value    = r.readDouble();
+    if (hasValue) t->setMaxOutValue(value);
+    return t;
+}
+
+template<typename T>
+void WriteTransformAs(SnapshotWriter & w, const ConstTransformRcPtr & transform)
+{
+    WriteTransformBody(w, DynamicPtrCast<const T>(transform));
+}
+
+// A null transform is allowed (e.g. a color space without transform).
+void WriteTransform(SnapshotWriter & w, const ConstTransformRcPtr & transform)
+{
+    w.writeBool(!!transform);
+    if (!transform)
+    {
+        return;
+    }
+
+    const TransformType type = transform->getTransformType();
+    w.writeEnum(type);
+    w.writeEnum(transform->getDirection());
+
+    switch (type)
+    {
+    case TRANSFORM_TYPE_ALLOCATION:
+        WriteTransformAs<AllocationTransform>(w, transform);
+        break;
+    case TRANSFORM_TYPE_BUILTIN:
+        WriteTransformAs<BuiltinTransform>(w, transform);
+        break;
+    case TRANSFORM_TYPE_CDL:
+        WriteTransformAs<CDLTransform>(w, transform);
+        break;
+    case TRANSFORM_TYPE_COLORSPACE:
+        WriteTransformAs<ColorSpaceTransform>(w, transform);
+        break;
+    case TRANSFORM_TYPE_DISPLAY_VIEW:
+        WriteTransformAs<DisplayViewTransform>(w, transform);
+        break;
+    case TRANSFORM_TYPE_EXPONENT:
+        WriteTransformAs<ExponentTransform>(w, transform);
+        break;
+    case TRANSFORM_TYPE_EXPONENT_WITH_LINEAR:
+        WriteTransformAs<ExponentWithLinearTransform>(w, transform);
+        break;
+    case TRANSFORM_TYPE_EXPOSURE_CONTRAST:
+        WriteTransformAs<ExposureContrastTransform>(w, transform);
+        break;
+    case TRANSFORM_TYPE_FILE:
+        WriteTransformAs<FileTransform>(w, transform);
+        break;
+    case TRANSFORM_TYPE_FIXED_FUNCTION:
+        WriteTransformAs<FixedFunctionTransform>(w, transform);
+        break;
+    case TRANSFORM_TYPE_GRADING_HUE_CURVE:
+        WriteTransformAs<GradingHueCurveTransform>(w, transform);
+        break;
+    case TRANSFORM_TYPE_GRADING_PRIMARY:
+        WriteTransformAs<GradingPrimaryTransform>(w, transform);
+        break;
+    case TRANSFORM_TYPE_GRADING_RGB_CURVE:
+        WriteTransformAs<GradingRGBCurveTransform>(w, transform);
+        break;
+    case TRANSFORM_TYPE_GRADING_TONE:
+        WriteTransformAs<GradingToneTransform>(w, transform);
+        break;
+    case TRANSFORM_TYPE_GROUP:
+        WriteTransformAs<GroupTransform>(w, transform);
+        break;
+    case TRANSFORM_TYPE_LOG_AFFINE:
+        WriteTransformAs<LogAffineTransform>(w, transform);
+        break;
+    case TRANSFORM_TYPE_LOG_CAMERA:
+        WriteTransformAs<LogCameraTransform>(w, transform);
+        break;
+    case TRANSFORM_TYPE_LOG:
+        WriteTransformAs<LogTransform>(w, transform);
+        break;
+    case TRANSFORM_TYPE_LOOK:
+        WriteTransformAs<LookTransform>(w, transform);
+        break;
+    case TRANSFORM_TYPE_LUT1D:
+        WriteTransformAs<Lut1DTransform>(w, transform);
+        break;
+    case TRANSFORM_TYPE_LUT3D:
+        WriteTransformAs<Lut3DTransform>(w, transform);
+        break;
+    case TRANSFORM_TYPE_MATRIX:
+        WriteTransformAs<MatrixTransform>(w, transform);
+        break;
+    case TRANSFORM_TYPE_RANGE:
+        WriteTransformAs<RangeTransform>(w, transform);
+        break;
+    default:
+        throw Exception("Unsupported Transform() type for the config snapshot.");
+    }
+}
+
+TransformRcPtr ReadTransform(SnapshotReader & r)
+{
+    if (!r.readBool())
+    {
+        return TransformRcPtr();
+    }
+
+    const TransformType type = r.readEnum<TransformType>();
+    const TransformDirection dir = r.readEnum<TransformDirection>();
+
+    TransformRcPtr t;
+    switch (type)
+    {
+    case TRANSFORM_TYPE_ALLOCATION:           t = ReadAllocationTransform(r);         break;
+    case TRANSFORM_TYPE_BUILTIN:              t = ReadBuiltinTransform(r);            break;
+    case TRANSFORM_TYPE_CDL:                  t = ReadCDLTransform(r);                break;
+    case TRANSFORM_TYPE_COLORSPACE:           t = ReadColorSpaceTransform(r);         break;
+    case TRANSFORM_TYPE_DISPLAY_VIEW:         t = ReadDisplayViewTransform(r);        break;
+    case TRANSFORM_TYPE_EXPONENT:             t = ReadExponentTransform(r);           break;
+    case TRANSFORM_TYPE_EXPONENT_WITH_LINEAR: t = ReadExponentWithLinearTransform(r); break;
+    case TRANSFORM_TYPE_EXPOSURE_CONTRAST:    t = ReadExposureContrastTransform(r);   break;
+    case TRANSFORM_TYPE_FILE:                 t = ReadFileTransform(r);               break;
+    case TRANSFORM_TYPE_FIXED_FUNCTION:       t = ReadFixedFunctionTransform(r);      break;
+    case TRANSFORM_TYPE_GRADING_HUE_CURVE:    t = ReadGradingHueCurveTransform(r);    break;
+    case TRANSFORM_TYPE_GRADING_PRIMARY:      t = ReadGradingPrimaryTransform(r);     break;
+    case TRANSFORM_TYPE_GRADING_RGB_CURVE:    t = ReadGradingRGBCurveTransform(r);    break;
+    case TRANSFORM_TYPE_GRADING_TONE:         t = ReadGradingToneTransform(r);        break;
+    case TRANSFORM_TYPE_GROUP:                t = ReadGroupTransform(r);              break;
+    case TRANSFORM_TYPE_LOG_AFFINE:           t = ReadLogAffineTransform(r);          break;
+    case TRANSFORM_TYPE_LOG_CAMERA:           t = ReadLogCameraTransform(r);          break;
+    case TRANSFORM_TYPE_LOG:                  t = ReadLogTransform(r);                break;
+    case TRANSFORM_TYPE_LOOK:                 t = ReadLookTransform(r);               break;
+    case TRANSFORM_TYPE_LUT1D:                t = ReadLut1DTransform(r);              break;
+    case TRANSFORM_TYPE_LUT3D:                t = ReadLut3DTransform(r);              break;
+    case TRANSFORM_TYPE_MATRIX:               t = ReadMatrixTransform(r);             break;
+    case TRANSFORM_TYPE_RANGE:                t = ReadRangeTransform(r);              break;
+    default:
+        r.throwCorrupted();
+    }
+
+    t->setDirection(dir);
+    return t;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////
+// Config elements.
+
+void WriteColorSpace(SnapshotWriter & w, const ConstColorSpaceRcPtr & cs)
+{
+    w.writeEnum(cs->getReferenceSpaceType());
+    w.writeString(cs->getName());
+    WriteAliases(w, *cs);
+    w.writeString(cs->getFamily());
+    w.writeString(cs->getEqualityGroup());
+    w.writeString(cs->getDescription());
+    w.writeString(cs->getInteropID());
+    WriteAttributes(w, cs->getInterchangeAttributes());
+    w.writeEnum(cs->getBitDepth());
+    WriteCategories(w, *cs);
+    w.writeString(cs->getEncoding());
+    w.writeBool(cs->isData());
+    w.writeEnum(cs->getAllocation());
+    const int numVars = cs->getAllocationNumVars();
+    std::vector<float> vars(numVars);
+    if (numVars > 0)
+    {
+        cs->getAllocationVars(vars.data());
+    }
+    w.writeSize(numVars);
+    for (const float var : vars)
+    {
+        w.writeFloat(var);
+    }
+    WriteTransform(w, cs->getTransform(COLORSPACE_DIR_TO_REFERENCE));
+    WriteTransform(w, cs->getTransform(COLORSPACE_DIR_FROM_REFERENCE));
+}
+
+ColorSpaceRcPtr ReadColorSpace(SnapshotReader & r)
+{
+    ColorSpaceRcPtr cs = ColorSpace::Create(r.readEnum<ReferenceSpaceType>());
+    cs->setName(r.readString());
+    ReadAliases(r, *cs);
+    cs->setFamily(r.readString());
+    cs->setEqualityGroup(r.readString());
+    cs->setDescription(r.readString());
+    cs->setInteropID(r.readString());
+    ReadAttributes(r, *cs);
+    cs->setBitDepth(r.readEnum<BitDepth>());
+    ReadCategories(r, *cs);
+    cs->setEncoding(r.readString());
+    cs->setIsData(r.readBool());
+    cs->setAllocation(r.readEnum<Allocation>());
+    const size_t numVars = r.readSize();
+    std::vector<float> vars(numVars);
+    for (auto & var : vars)
+    {
+        var = r.readFloat();
+    }
+    if (numVars > 0)
+    {
+        cs->setAllocationVars(static_cast<int>(numVars), vars.data());
+    }
+    cs->setTransform(ReadTransform(r), COLORSPACE_DIR_TO_REFERENCE);
+    cs->setTransform(ReadTransform(r), COLORSPACE_DIR_FROM_REFERENCE);
+    return cs;
+}
+
+void WriteLook(SnapshotWriter & w, const ConstLookRcPtr & look)
+{
+    w.writeString(look->getName());
+    w.writeString(look->getProcessSpace());
+    w.writeString(look->getDescription());
+    WriteAttributes(w, look->getInterchangeAttributes());
+    WriteTransform(w, look->getTransform());
+    WriteTransform(w, look->getInverseTransform());
+}
+
+LookRcPtr ReadLook(SnapshotReader & r)
+{
+    LookRcPtr look = Look::Create();
+    look->setName(r.readString());
+    look->setProcessSpace(r.readString());
+    look->setDescription(r.readString());
+    ReadAttributes(r, *look);
+
+    // Note that the look setters do not accept a null transform.
+    if (ConstTransformRcPtr t = ReadTransform(r))
+    {
+        look->setTransform(t);
+    }
+    if (ConstTransformRcPtr t = ReadTransform(r))
+    {
+        look->setInverseTransform(t);
+    }
+    return look;
+}
+
+void WriteViewTransform(SnapshotWriter & w, const ConstViewTransformRcPtr & vt)
+{
+    w.writeEnum(vt->getReferenceSpaceType());
+    w.writeString(vt->getName());
+    w.writeString(vt->getFamily());
+    w.writeString(vt->getDescription());
+    WriteAttributes(w, vt->getInterchangeAttributes());
+    WriteCategories(w, *vt);
+    WriteTransform(w, vt->getTransform(VIEWTRANSFORM_DIR_TO_REFERENCE));
+    WriteTransform(w, vt->getTransform(VIEWTRANSFORM_DIR_FROM_REFERENCE));
+}
+
+ViewTransformRcPtr ReadViewTransform(SnapshotReader & r)
+{
+    ViewTransformRcPtr vt = ViewTransform::Create(r.readEnum<ReferenceSpaceType>());
+    vt->setName(r.readString());
+    vt->setFamily(r.readString());
+    vt->setDescription(r.readString());
+    ReadAttributes(r, *vt);
+    ReadCategories(r, *vt);
+    vt->setTransform(ReadTransform(r), VIEWTRANSFORM_DIR_TO_REFERENCE);
+    vt->setTransform(ReadTransform(r), VIEWTRANSFORM_DIR_FROM_REFERENCE);
+    return vt;
+}
+
+void WriteNamedTransform(SnapshotWriter & w, const ConstNamedTransformRcPtr & nt)
+{
+    w.writeString(nt->getName());
+    WriteAliases(w, *nt);
+    w.writeString(nt->getFamily());
+    w.writeString(nt->getDescription());
+    WriteCategories(w, *nt);
+    w.writeString(nt->getEncoding());
+    WriteTransform(w, nt->getTransform(TRANSFORM_DIR_FORWARD));
+    WriteTransform(w, nt->getTransform(TRANSFORM_DIR_INVERSE));
+}
+
+NamedTransformRcPtr ReadNamedTransform(SnapshotReader & r)
+{
+    NamedTransformRcPtr nt = NamedTransform::Create();
+    nt->setName(r.readString());
+    ReadAliases(r, *nt);
+    nt->setFamily(r.readString());
+    nt->setDescription(r.readString());
+    ReadCategories(r, *nt);
+    nt->setEncoding(r.readString());
+    nt->setTransform(ReadTransform(r), TRANSFORM_DIR_FORWARD);
+    nt->setTransform(ReadTransform(r), TRANSFORM_DIR_INVERSE);
+    return nt;
+}
+
+void WriteFileRules(SnapshotWriter & w, const ConstFileRulesRcPtr & rules)
+{
+    const size_t numRules = rules->getNumEntries();
+    w.writeSize(numRules);
+    for (size_t i = 0; i < numRules; ++i)
+    {
+        w.writeString(rules->getName(i));
+        w.writeString(rules->getColorSpace(i));
+        w.writeString(rules->getRegex(i));
+        w.writeString(rules->getPattern(i));
+        w.writeString(rules->getExtension(i));
+        const size_t numKeys = rules->getNumCustomKeys(i);
+        w.writeSize(numKeys);
+        for (size_t k = 0; k < numKeys; ++k)
+        {
+            w.writeString(rules->getCustomKeyName(i, k));
+            w.writeString(rules->getCustomKeyValue(i, k));
+        }
+    }
+}
+
+FileRulesRcPtr ReadFileRules(SnapshotReader & r)
+{
+    // A new instance only contains the default rule which is always the last one.
+    FileRulesRcPtr rules = FileRules::Create();
+
+    const size_t numRules = r.readSize();
+    if (numRules == 0)
+    {
+        r.throwCorrupted();
+    }
+
+    for (size_t i = 0; i < numRules; ++i)
+    {
+        const char * name       = r.readString();
+        const char * colorSpace = r.readString();
+        const char * regex      = r.readString();
+        const char * pattern    = r.readString();
+        const char * extension  = r.readString();
+
+        if (i == numRules - 1)
+        {
+            rules->setDefaultRuleColorSpace(colorSpace);
+        }
+        else if (0 == Platform::Strcasecmp(name, FileRules::FilePathSearchRuleName))
+        {
+            rules->insertPathSearchRule(i);
+        }
+        else if (*regex)
+        {
+            rules->insertRule(i, name, colorSpace, regex);
+        }
+        else
+        {
+            rules->insertRule(i, name, colorSpace, pattern, extension);
+        }
+
+        const size_t numKeys = r.readSize();
+        for (size_t k = 0; k < numKeys; ++k)
+        {
+            const char * key   = r.readString();
+            const char * value = r.readString();
+            rules->setCustomKey(i, key, value);
+        }
+    }
+
+    return rules;
+}
+
+void WriteViewingRules(SnapshotWriter & w, const ConstViewingRulesRcPtr & rules)
+{
+    const size_t numRules = rules->getNumEntries();
+    w.writeSize(numRules);
+    for (size_t i = 0; i < numRules; ++i)
+    {
+        w.writeString(rules->getName(i));
+
+        const size_t numCS = rules->getNumColorSpaces(i);
+        w.writeSize(numCS);
+        for (size_t c = 0; c < numCS; ++c)
+        {
+            w.writeString(rules->getColorSpace(i, c));
+        }
+
+        const size_t numEnc = rules->getNumEncodings(i);
+        w.writeSize(numEnc);
+        for (size_t e = 0; e < numEnc; ++e)
+        {
+            w.writeString(rules->getEncoding(i, e));
+        }
+
+        const size_t numKeys = rules->getNumCustomKeys(i);
+        w.writeSize(numKeys);
+        for (size_t k = 0; k < numKeys; ++k)
+        {
+            w.writeString(rules->getCustomKeyName(i, k));
+            w.writeString(rules->getCustomKeyValue(i, k));
+        }
+    }
+}
+
+ViewingRulesRcPtr ReadViewingRules(SnapshotReader & r)
+{
+    ViewingRulesRcPtr rules = ViewingRules::Create();
+
+    const size_t numRules = r.readSize();
+    for (size_t i = 0; i < numRules; ++i)
+    {
+        rules->insertRule(i, r.readString());
+
+        const size_t numCS = r.readSize();
+        for (size_t c = 0; c < numCS; ++c)
+        {
+            rules->addColorSpace(i, r.readString());
+        }
+
+        const size_t numEnc = r.readSize();
+        for (size_t e = 0; e < numEnc; ++e)
+        {
+            rules->addEncoding(i, r.readString());
+        }
+
+        const size_t numKeys = r.readSize();
+        for (size_t k = 0; k < numKeys; ++k)
+        {
+            const char * key   = r.readString();
+            const char * value = r.readString();
+            rules->setCustomKey(i, key, value);
+        }
+    }
+
+    return rules;
+}
+
+// Views are written as: name, view transform, color space, looks, rule & description.
+struct SnapshotView
+{
+    const char * m_name;
+    const char * m_viewTransform;
+    const char * m_colorSpace;
+    const char * m_looks;
+    const char * m_rule;
+    const char * m_description;
+};
+
+void WriteView(SnapshotWriter & w, const SnapshotView & view)
+{
+    w.writeString(view.m_name);
+    w.writeString(view.m_viewTransform);
+    w.writeString(view.m_colorSpace);
+    w.writeString(view.m_looks);
+    w.writeString(view.m_rule);
+    w.writeString(view.m_description);
+}
+
+SnapshotView ReadView(SnapshotReader & r)
+{
+    SnapshotView view;
+    view.m_name          = r.readString();
+    view.m_viewTransform = r.readString();
+    view.m_colorSpace    = r.readString();
+    view.m_looks         = r.readString();
+    view.m_rule          = r.readString();
+    view.m_description   = r.readString();
+    return view;
+}
+
+SnapshotView GetDisplayView(const Config & config, const char * display, const char * name)
+{
+    return SnapshotView{ name,
+                         config.getDisplayViewTransformName(display, name),
+                         config.getDisplayViewColorSpaceName(display, name),
+                         config.getDisplayViewLooks(display, name),
+                         config.getDisplayViewRule(display, name),
+                         config.getDisplayViewDescription(display, name) };
+}
+
+void WriteConfig(SnapshotWriter & w, const Config & config)
+{
+    w.writeUInt(config.getMajorVersion());
+    w.writeUInt(config.getMinorVersion());
+
+    const int numEnvVars = config.getNumEnvironmentVars();
+    w.writeSize(numEnvVars);
+    for (int i = 0; i < numEnvVars; ++i)
+    {
+        const char * name = config.getEnvironmentVarNameByIndex(i);
+        w.writeString(name);
+        w.writeString(config.getEnvironmentVarDefault(name));
+    }
+    w.writeEnum(config.getEnvironmentMode());
+
+    const int numSearchPaths = config.getNumSearchPaths();
+    w.writeSize(numSearchPaths);
+    for (int i = 0; i < numSearchPaths; ++i)
+    {
+        w.writeString(config.getSearchPath(i));
+    }
+    w.writeString(config.getWorkingDir());
+
+    w.writeBool(config.isStrictParsingEnabled());
+    w.writePOD(config.getFamilySeparator());
+    double luma[3];
+    config.getDefaultLumaCoefs(luma);
+    w.writeDoubles(luma, 3);
+    w.writeString(config.getName());
+    w.writeString(config.getDescription());
+
+    const int numRoles = config.getNumRoles();
+    w.writeSize(numRoles);
+    for (int i = 0; i < numRoles; ++i)
+    {
+        w.writeString(config.getRoleName(i));
+        w.writeString(config.getRoleColorSpace(i));
+    }
+
+    // The color spaces are needed before the rules, the views, etc.
+    const int numCS = config.getNumColorSpaces(SEARCH_REFERENCE_SPACE_ALL, COLORSPACE_ALL);
+    w.writeSize(numCS);
+    for (int i = 0; i < numCS; ++i)
+    {
+        const char * name
+            = config.getColorSpaceNameByIndex(SEARCH_REFERENCE_SPACE_ALL, COLORSPACE_ALL, i);
+        WriteColorSpace(w, config.getColorSpace(name));
+    }
+
+    WriteFileRules(w, config.getFileRules());
+    WriteViewingRules(w, config.getViewingRules());
+
+    const int numSharedViews = config.getNumViews(VIEW_SHARED, nullptr);
+    w.writeSize(numSharedViews);
+    for (int v = 0; v < numSharedViews; ++v)
+    {
+        WriteView(w, GetDisplayView(config, nullptr, config.getView(VIEW_SHARED, nullptr, v)));
+    }
+
+    // Do not save the displays instantiated from the virtual display.
+    StringUtils::StringVec displays;
+    for (int i = 0; i < config.getNumDisplaysAll(); ++i)
+    {
+        if (!config.isDisplayTemporary(i))
+        {
+            displays.emplace_back(config.getDisplayAll(i));
+        }
+    }
+    w.writeSize(displays.size());
+    for (const auto & display : displays)
+    {
+        w.writeString(display);
+
+        const int numViews = config.getNumViews(VIEW_DISPLAY_DEFINED, display.c_str());
+        w.writeSize(numViews);
+        for (int v = 0; v < numViews; ++v)
+        {
+            const char * name = config.getView(VIEW_DISPLAY_DEFINED, display.c_str(), v);
+            WriteView(w, GetDisplayView(config, display.c_str(), name));
+        }
+
+        const int numShared = config.getNumViews(VIEW_SHARED, display.c_str());
+        w.writeSize(numShared);
+        for (int v = 0; v < numShared; ++v)
+        {
+            w.writeString(config.getView(VIEW_SHARED, display.c_str(), v));
+        }
+    }
+
+    const int numVirtualViews = config.getVirtualDisplayNumViews(VIEW_DISPLAY_DEFINED);
+    w.writeSize(numVirtualViews);
+    for (int v = 0; v < numVirtualViews; ++v)
+    {
+        const char * name = config.getVirtualDisplayView(VIEW_DISPLAY_DEFINED, v);
+        WriteView(w, SnapshotView{ name,
+                                   config.getVirtualDisplayViewTransformName(name),
+                                   config.getVirtualDisplayViewColorSpaceName(name),
+                                   config.getVirtualDisplayViewLooks(name),
+                                   config.getVirtualDisplayViewRule(name),
+                                   config.getVirtualDisplayViewDescription(name) });
+    }
+    const int numVirtualShared = config.getVirtualDisplayNumViews(VIEW_SHARED);
+    w.writeSize(numVirtualShared);
+    for (int v = 0; v < numVirtualShared; ++v)
+    {
+        w.writeString(config.getVirtualDisplayView(VIEW_SHARED, v));
+    }
+
+    StringUtils::StringVec activeDisplays;
+    for (int i = 0; i < config.getNumActiveDisplays(); ++i)
+    {
+        activeDisplays.emplace_back(config.getActiveDisplay(i));
+    }
+    WriteStringVec(w, activeDisplays);
+
+    StringUtils::StringVec activeViews;
+    for (int i = 0; i < config.getNumActiveViews(); ++i)
+    {
+        activeViews.emplace_back(config.getActiveView(i));
+    }
+    WriteStringVec(w, activeViews);
+
+    w.writeString(config.getInactiveColorSpaces());
+
+    const int numLooks = config.getNumLooks();
+    w.writeSize(numLooks);
+    for (int i = 0; i < numLooks; ++i)
+    {
+        WriteLook(w, config.getLook(config.getLookNameByIndex(i)));
+    }
+
+    const int numVT = config.getNumViewTransforms();
+    w.writeSize(numVT);
+    for (int i = 0; i < numVT; ++i)
+    {
+        WriteViewTransform(w, config.getViewTransform(config.getViewTransformNameByIndex(i)));
+    }
+    w.writeString(config.getDefaultViewTransformName());
+
+    const int numNT = config.getNumNamedTransforms(NAMEDTRANSFORM_ALL);
+    w.writeSize(numNT);
+    for (int i = 0; i < numNT; ++i)
+    {
+        const char * name = config.getNamedTransformNameByIndex(NAMEDTRANSFORM_ALL, i);
+        WriteNamedTransform(w, config.getNamedTransform(name));
+    }
+}
+
+void ReadConfig(SnapshotReader & r, ConfigRcPtr & config, const char * filename)
+{
+    const unsigned int major = r.readUInt();
+    const unsigned int minor = r.readUInt();
+    config->setVersion(major, minor);
+
+    const size_t numEnvVars = r.readSize();
+    for (size_t i = 0; i < numEnvVars; ++i)
+    {
+        const char * name  = r.readString();
+        const char * value = r.readString();
+        config->addEnvironmentVar(name, value);
+    }
+    const EnvironmentMode mode = r.readEnum<EnvironmentMode>();
+
+    const size_t numSearchPaths = r.readSize();
+    for (size_t i = 0; i < numSearchPaths; ++i)
+    {
+        config->addSearchPath(r.readString());
+    }
+
+    // Relative search paths are relative to the directory of the original config, so keep it.
+    const char * workingDir = r.readString();
+    if (*workingDir)
+    {
+        config->setWorkingDir(workingDir);
+    }
+    else if (filename && *filename)
+    {
+        const std::string realfilename = AbsPath(filename);
+        config->setWorkingDir(pystring::os::path::dirname(realfilename).c_str());
+    }
+
+    config->setStrictParsingEnabled(r.readBool());
+    config->setFamilySeparator(r.readPOD<char>());
+    double luma[3];
+    r.readDoubles(luma, 3);
+    config->setDefaultLumaCoefs(luma);
+    config->setName(r.readString());
+    config->setDescription(r.readString());
+
+    const size_t numRoles = r.readSize();
+    for (size_t i = 0; i < numRoles; ++i)
+    {
+        const char * role       = r.readString();
+        const char * colorSpace = r.readString();
+        config->setRole(role, colorSpace);
+    }
+
+    const size_t numCS = r.readSize();
+    for (size_t i = 0; i < numCS; ++i)
+    {
+        config->addColorSpace(ReadColorSpace(r));
+    }
+
+    config->setFileRules(ReadFileRules(r));
+    config->setViewingRules(ReadViewingRules(r));
+
+    const size_t numSharedViews = r.readSize();
+    for (size_t v = 0; v < numSharedViews; ++v)
+    {
+        const SnapshotView view = ReadView(r);
+        config->addSharedView(view.m_name, view.m_viewTransform, view.m_colorSpace,
+                              view.m_looks, view.m_rule, view.m_description);
+    }
+
+    const size_t numDisplays = r.readSize();
+    for (size_t i = 0; i < numDisplays; ++i)
+    {
+        const char * display = r.readString();
+
+        const size_t numViews = r.readSize();
+        for (size_t v = 0; v < numViews; ++v)
+        {
+            const SnapshotView view = ReadView(r);
+            config->addDisplayView(display, view.m_name, view.m_viewTransform,
+                                   view.m_colorSpace, view.m_looks, view.m_rule,
+                                   view.m_description);
+        }
+
+        const size_t numShared = r.readSize();
+        for (size_t v = 0; v < numShared; ++v)
+        {
+            config->addDisplaySharedView(display, r.readString());
+        }
+    }
+
+    const size_t numVirtualViews = r.readSize();
+    for (size_t v = 0; v < numVirtualViews; ++v)
+    {
+        const SnapshotView view = ReadView(r);
+        config->addVirtualDisplayView(view.m_name, view.m_viewTransform, view.m_colorSpace,
+                                      view.m_looks, view.m_rule, view.m_description);
+    }
+    const size_t numVirtualShared = r.readSize();
+    for (size_t v = 0; v < numVirtualShared; ++v)
+    {
+        config->addVirtualDisplaySharedView(r.readString());
+    }
+
+    config->setActiveDisplays(JoinStringEnvStyle(ReadStringVec(r)).c_str());
+    config->setActiveViews(JoinStringEnvStyle(ReadStringVec(r)).c_str());
+    config->setInactiveColorSpaces(r.readString());
+
+    const size_t numLooks = r.readSize();
+    for (size_t i = 0; i < numLooks; ++i)
+    {
+        config->addLook(ReadLook(r));
+    }
+
+    const size_t numVT = r.readSize();
+    for (size_t i = 0; i < numVT; ++i)
+    {
+        config->addViewTransform(ReadViewTransform(r));
+    }
+    config->setDefaultViewTransformName(r.readString());
+
+    const size_t numNT = r.readSize();
+    for (size_t i = 0; i < numNT; ++i)
+    {
+        config->addNamedTransform(ReadNamedTransform(r));
+    }
+
+    if (!r.atEnd())
+    {
+        r.throwCorrupted();
+    }
+
+    config->setEnvironmentMode(mode);
+    config->loadEnvironment();
+}
+
+} // anon.
+
+bool ConfigSnapshot::IsSnapshot(const char * data, size_t size) noexcept
+{
+    return data && size >= SignatureSize
+        && 0 == memcmp(data, SnapshotSignature, SignatureSize);
+}
+
+void ConfigSnapshot::Read(const char * data, size_t size, ConfigRcPtr & config,
+                          const char * filename)
+{
+    SnapshotReader header(data, size, filename);
+
+    if (!IsSnapshot(data, size) || size < SnapshotHeaderSize)
+    {
+        header.throwCorrupted();
+    }
+
+    header.readPOD<uint64_t>(); // Signature.
+
+    const uint32_t formatVersion = header.readUInt();
+    if (formatVersion != SnapshotFormatVersion)
+    {
+        std::ostringstream os;
+        os << "The config snapshot '" << (filename && *filename ? filename : "<stream>")
+           << "' uses the format version " << formatVersion << " but this version of the "
+           << "OpenColorIO library (" << GetVersion() << ") only reads the format version "
+           << SnapshotFormatVersion << ". The snapshot must be regenerated.";
+        throw Exception(os.str().c_str());
+    }
+
+    header.readUInt(); // Reserved.
+
+    const uint64_t payloadSize = header.readPOD<uint64_t>();
+    CacheIDDigest checksum;
+    checksum.m_low  = header.readPOD<uint64_t>();
+    checksum.m_high = header.readPOD<uint64_t>();
+
+    const char * payload = data + SnapshotHeaderSize;
+    if (payloadSize != size - SnapshotHeaderSize
+        || checksum != CacheIDHashDigest(payload, static_cast<size_t>(payloadSize)))
+    {
+        header.throwCorrupted();
+    }
+
+    SnapshotReader reader(payload, static_cast<size_t>(payloadSize), filename);
+    ReadConfig(reader, config, filename);
+}
+
+void ConfigSnapshot::Write(std::ostream & ostream, const Config & config)
+{
+    SnapshotWriter payload;
+    WriteConfig(payload, config);
+
+    const std::string & data = payload.buffer();
+    const CacheIDDigest checksum = CacheIDHashDigest(data.data(), data.size());
+
+    SnapshotWriter header;
+    for (const char c : SnapshotSignature)
+    {
+        header.writePOD(c);
+    }
+    header.writeUInt(SnapshotFormatVersion);
+    header.writeUInt(0); // Reserved.
+    header.writePOD<uint64_t>(data.size());
+    header.writePOD(checksum.m_low);
+    header.writePOD(checksum.m_high);
+
+    ostream.write(header.buffer().data(), header.buffer().size());
+    ostream.write(data.data(), data.size());
+
+    if (!ostream)
+    {
+        throw Exception("Could not write the config snapshot to the stream.");
+    }
+}
+
+void ConfigSnapshot::WriteFile(const char * filename, const Config & config)
+{
+    namespace fs = std::filesystem;
+
+    if (!filename || !*filename)
+    {
+        throw Exception("The config snapshot filename is empty.");
+    }
+
+    // The temporary file is in the same directory so the rename is atomic, and its name is unique
+    // as several processes could write the same snapshot.
+    std::ostringstream tempName;
+    std::random_device random;
+    tempName << filename << "." << std::hex << random() << random() << ".tmp";
+
+    const fs::path tempPath(Platform::filenameToUTF(tempName.str()));
+
+    std::error_code ec;
+    try
+    {
+        {
+            std::ofstream file(tempPath, std::ios_base::out | std::ios_base::binary);
+            if (!file.is_open())
+            {
+                std::ostringstream os;
+                os << "Could not open the file '" << tempName.str() << "'.";
+                throw Exception(os.str().c_str());
+            }
+
+            Write(file, config);
+
+            file.close();
+            if (!file)
+            {
+                std::ostringstream os;
+                os << "Could not write the file '" << tempName.str() << "'.";
+                throw Exception(os.str().c_str());
+            }
+        }
+
+        // A process loading the snapshot never reads a partial one. Note that an existing file
+        // is replaced, not modified, as other processes could have mapped it.
+        fs::rename(tempPath, fs::path(Platform::filenameToUTF(filename)), ec);
+        if (ec)
+        {
+            std::ostringstream os;
+            os << "Could not rename the file '" << tempName.str() << "' to '" << filename
+               << "': " << ec.message();
+            throw Exception(os.str().c_str());
+        }
+    }
+    catch (...)
+    {
+        fs::remove(tempPath, ec);
+        throw;
+    }
+}
+
+} // namespace OCIO_NAMESPACE
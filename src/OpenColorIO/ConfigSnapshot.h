@@ -0,0 +1,52 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#ifndef INCLUDED_OCIO_CONFIGSNAPSHOT_H
+#define INCLUDED_OCIO_CONFIGSNAPSHOT_H
+
+namespace OCIO_NAMESPACE
+{
+
+// A config snapshot is a compact binary encoding of an in-memory config, used to skip the YAML
+// parsing when the same (validated) config is loaded by many processes.
+//
+// The snapshot starts with a signature, the format version, the payload size and a 128-bit
+// checksum of the payload. The payload is a little-endian encoding of the config contents which
+// is decoded using the Config public API (i.e. the same path as the YAML reader) so the loaded
+// config is identical to the one that was written. A snapshot written by a different format
+// version is rejected and must be regenerated.
+//
+// Note that the environment variable values are not part of the snapshot i.e. they are loaded
+// from the current environment when reading the snapshot.
+
+namespace ConfigSnapshot
+{
+
+// Number of bytes needed by IsSnapshot().
+constexpr size_t SignatureSize = 8;
+// The first signature byte is not valid in a UTF-8 text (i.e. cannot start a YAML config).
+constexpr char SignatureStartByte = '\x89';
+
+// Return true if the data starts with the config snapshot signature.
+bool IsSnapshot(const char * data, size_t size) noexcept;
+
+// Decode the snapshot into an empty config. The filename is only used to build error messages
+// and to default the working directory (if the snapshot does not have one). Throw if the
+// snapshot is corrupted or uses a different format version.
+void Read(const char * data, size_t size, ConfigRcPtr & config, const char * filename);
+
+// Throw if the stream could not be written.
+void Write(std::ostream & ostream, const Config & config);
+
+// Write the snapshot to a temporary file which is then renamed to the filename (provided as
+// UTF-8) so a process loading the file never reads a partial snapshot. Throw if the file could
+// not be written.
+void WriteFile(const char * filename, const Config & config);
+
+} // namespace ConfigSnapshot
+
+} // namespace OCIO_NAMESPACE
+
+#endif // INCLUDED_OCIO_CONFIGSNAPSHOT_H
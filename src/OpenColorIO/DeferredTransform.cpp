@@ -0,0 +1,47 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "DeferredTransform.h"
+
+
+namespace OCIO_NAMESPACE
+{
+
+DeferredTransform::DeferredTransform(Loader loader)
+    :   m_loader(std::move(loader))
+{
+    if (!m_loader)
+    {
+        throw Exception("A deferred transform needs a loader.");
+    }
+}
+
+ConstTransformRcPtr DeferredTransform::get() const
+{
+    AutoMutex lock(m_mutex);
+
+    if (!m_transform)
+    {
+        // Note that the loader is kept if it throws.
+        m_transform = m_loader();
+        if (!m_transform)
+        {
+            throw Exception("A deferred transform cannot be null.");
+        }
+
+        m_loader = nullptr;
+    }
+
+    return m_transform;
+}
+
+bool DeferredTransform::isLoaded() const
+{
+    AutoMutex lock(m_mutex);
+    return bool(m_transform);
+}
+
+} // namespace OCIO_NAMESPACE
@@ -0,0 +1,65 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#ifndef INCLUDED_OCIO_DEFERREDTRANSFORM_H
+#define INCLUDED_OCIO_DEFERREDTRANSFORM_H
+
+
+#include <functional>
+#include <memory>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "Mutex.h"
+
+
+namespace OCIO_NAMESPACE
+{
+
+class DeferredTransform;
+typedef OCIO_SHARED_PTR<DeferredTransform> DeferredTransformRcPtr;
+
+// The transform of a config element (i.e. color space, look, view transform or named transform)
+// only created on first use. That's used by the lazy loading of a config (refer to
+// OCIO_LAZY_LOADING_ENVVAR) to keep the transform definitions as text until a processor needs
+// them.
+//
+// A deferred transform is immutable once attached to an element so the copies of the element
+// share it (and share the loaded transform which is only accessed as a const transform).
+class DeferredTransform
+{
+public:
+    // Create the transform. It throws if the definition is invalid.
+    typedef std::function<TransformRcPtr()> Loader;
+
+    explicit DeferredTransform(Loader loader);
+    ~DeferredTransform() = default;
+
+    DeferredTransform() = delete;
+    DeferredTransform(const DeferredTransform &) = delete;
+    DeferredTransform & operator=(const DeferredTransform &) = delete;
+
+    // Return the transform, creating it on the first call. The method is thread-safe. If the
+    // creation fails the exception is thrown again by the following calls.
+    ConstTransformRcPtr get() const;
+
+    bool isLoaded() const;
+
+private:
+    mutable Mutex m_mutex;
+    // The loader (and the resources it holds) is released once the transform is created.
+    mutable Loader m_loader;
+    mutable ConstTransformRcPtr m_transform;
+};
+
+// Return the deferred transform if any, otherwise the transform.
+inline ConstTransformRcPtr ResolveTransform(const DeferredTransformRcPtr & deferred,
+                                            const ConstTransformRcPtr & transform)
+{
+    return deferred ? deferred->get() : transform;
+}
+
+} // namespace OCIO_NAMESPACE
+
+#endif // INCLUDED_OCIO_DEFERREDTRANSFORM_H
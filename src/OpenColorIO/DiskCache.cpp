@@ -0,0 +1,1087 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <thread>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "Caching.h"
+#include "DiskCache.h"
+#include "Logging.h"
+#include "ops/lut1d/Lut1DOpData.h"
+#include "ops/lut3d/Lut3DOpData.h"
+#include "ops/matrix/MatrixOpData.h"
+#include "ops/range/RangeOpData.h"
+#include "Platform.h"
+
+
+namespace OCIO_NAMESPACE
+{
+
+namespace
+{
+
+namespace fs = std::filesystem;
+
+// The version must be increased when the payload layout changes (including any change to the
+// value of a serialized enum). Note that the entries are also specific to the library version
+// i.e. both versions are part of the entry file name so the processes using different versions
+// could share the cache directory.
+constexpr uint32_t EntryFormatVersion = 2;
+
+constexpr char EntrySignature[8] = { '\x89', 'O', 'C', 'I', 'O', 'D', 'C', '\n' };
+
+constexpr const char * EntryExtension = ".ociocache";
+constexpr const char * TempExtension  = ".tmp";
+
+// Signature, format version, library version, entry kind, key, payload size & payload checksum,
+// padded so the payload starts on an alignment boundary.
+constexpr size_t EntryHeaderSize = 64;
+
+// The alignment (from the start of the file) of the LUT & matrix values.
+constexpr size_t ValueAlignment = 16;
+
+static_assert(EntryHeaderSize % ValueAlignment == 0, "The payload must be aligned.");
+static_assert(OCIO_LITTLE_ENDIAN, "The disk cache only supports little-endian platforms.");
+
+// The default budget of the cache directory.
+constexpr size_t DefaultBudget = size_t(1024) * 1024 * 1024;
+
+// A temporary file older than that is considered as left by a crashed process.
+constexpr std::chrono::hours StaleTempFileAge{ 1 };
+
+// The maximum delay between two scans of the directory size as other processes could also add
+// entries.
+constexpr std::chrono::minutes DirectoryScanInterval{ 1 };
+
+// C++20 deprecates fs::u8path() and makes path::u8string() return a std::u8string, so all the
+// conversions between the UTF-8 paths of the API and fs::path go through these helpers.
+fs::path PathFromUTF8(const std::string & str)
+{
+#if defined(__cpp_lib_char8_t)
+    return fs::path(std::u8string(str.begin(), str.end()));
+#else
+    return fs::u8path(str);
+#endif
+}
+
+std::string PathToUTF8(const fs::path & path)
+{
+    const auto str = path.u8string();
+    return std::string(str.begin(), str.end());
+}
+
+// The error of a corrupted entry file i.e. the only entry files which are removed when reading.
+class CorruptedEntryException : public Exception
+{
+public:
+    explicit CorruptedEntryException(const std::string & filename)
+        :   Exception(("The disk cache entry '" + filename + "' is corrupted.").c_str())
+    {
+    }
+};
+
+class EntryWriter
+{
+public:
+    EntryWriter() = default;
+    // The data is only hashed i.e. there is no alignment padding.
+    explicit EntryWriter(CacheIDHasher & hasher) : m_hasher(&hasher) {}
+
+    EntryWriter(const EntryWriter &) = delete;
+    EntryWriter & operator=(const EntryWriter &) = delete;
+
+    const std::string & buffer() const noexcept { return m_buffer; }
+
+    void write(const void * data, size_t size)
+    {
+        if (m_hasher)
+        {
+            m_hasher->update(data, size);
+        }
+        else
+        {
+            m_buffer.append(static_cast<const char *>(data), size);
+        }
+    }
+
+    template<typename T>
+    void writePOD(const T & val) { write(&val, sizeof(T)); }
+
+    void writeUInt(uint32_t val) { writePOD(val); }
+    void writeSize(size_t val) { writePOD<uint64_t>(static_cast<uint64_t>(val)); }
+
+    template<typename E>
+    void writeEnum(E val) { writePOD<int32_t>(static_cast<int32_t>(val)); }
+
+    void writeString(const char * str)
+    {
+        const size_t len = str ? strlen(str) : 0;
+        writeUInt(static_cast<uint32_t>(len));
+        write(str ? str : "", len);
+    }
+
+    template<typename T>
+    void writeValues(const ArrayValues<T> & values)
+    {
+        writeSize(values.size());
+        if (!m_hasher)
+        {
+            m_buffer.append((ValueAlignment - m_buffer.size() % ValueAlignment) % ValueAlignment,
+                            '\0');
+        }
+        write(values.data(), values.size() * sizeof(T));
+    }
+
+private:
+    CacheIDHasher * m_hasher = nullptr;
+    std::string m_buffer;
+};
+
+class EntryReader
+{
+public:
+    // The holder keeps the data alive as the values read share the data rather than copying it.
+    EntryReader(const char * data, size_t size, const std::string & filename,
+                std::shared_ptr<const void> holder)
+        : m_data(data)
+        , m_size(size)
+        , m_filename(filename)
+        , m_holder(std::move(holder))
+    {
+    }
+
+    EntryReader() = delete;
+    EntryReader(const EntryReader &) = delete;
+    EntryReader & operator=(const EntryReader &) = delete;
+
+    bool atEnd() const noexcept { return m_pos == m_size; }
+
+    template<typename T>
+    T readPOD()
+    {
+        T val;
+        memcpy(&val, consume(sizeof(T)), sizeof(T));
+        return val;
+    }
+
+    uint32_t readUInt() { return readPOD<uint32_t>(); }
+
+    size_t readSize()
+    {
+        const uint64_t val = readPOD<uint64_t>();
+        // Any count is bounded by the payload size, which also protects the allocations.
+        if (val > m_size)
+        {
+            throwCorrupted();
+        }
+        return static_cast<size_t>(val);
+    }
+
+    template<typename E>
+    E readEnum() { return static_cast<E>(readPOD<int32_t>()); }
+
+    std::string readString()
+    {
+        const uint32_t len = readUInt();
+        return std::string(consume(len), len);
+    }
+
+    // The values are used in place as they are aligned & little-endian. If checkSize is true
+    // the number of values must match the expected one.
+    template<typename T>
+    void readValues(ArrayValues<T> & values, bool checkSize = true)
+    {
+        const size_t size = readSize();
+        if (checkSize && size != values.size())
+        {
+            throwCorrupted();
+        }
+        consume((ValueAlignment - m_pos % ValueAlignment) % ValueAlignment);
+        values.share(reinterpret_cast<const T *>(consume(size * sizeof(T))), size, m_holder);
+    }
+
+    [[noreturn]] void throwCorrupted() const
+    {
+        throw CorruptedEntryException(m_filename);
+    }
+
+private:
+    const char * consume(size_t num)
+    {
+        if (num > m_size - m_pos)
+        {
+            throwCorrupted();
+        }
+        const char * ptr = m_data + m_pos;
+        m_pos += num;
+        return ptr;
+    }
+
+    const char * m_data;
+    const size_t m_size;
+    size_t m_pos = 0;
+    const std::string m_filename;
+    const std::shared_ptr<const void> m_holder;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////
+// Op data encoding.
+
+// Note that the root element name is not written as it is always the same.
+void WriteMetadataContent(EntryWriter & w, const FormatMetadata & md)
+{
+    w.writeString(md.getElementValue());
+
+    const int numAttrs = md.getNumAttributes();
+    w.writeSize(numAttrs);
+    for (int i = 0; i < numAttrs; ++i)
+    {
+        w.writeString(md.getAttributeName(i));
+        w.writeString(md.getAttributeValue(i));
+    }
+
+    const int numChildren = md.getNumChildrenElements();
+    w.writeSize(numChildren);
+    for (int i = 0; i < numChildren; ++i)
+    {
+        const FormatMetadata & child = md.getChildElement(i);
+        w.writeString(child.getElementName());
+        WriteMetadataContent(w, child);
+    }
+}
+
+void ReadMetadataContent(EntryReader & r, FormatMetadata & md)
+{
+    // Note that the root element can't have a value.
+    const std::string value = r.readString();
+    if (!value.empty())
+    {
+        md.setElementValue(value.c_str());
+    }
+
+    const size_t numAttrs = r.readSize();
+    for (size_t i = 0; i < numAttrs; ++i)
+    {
+        const std::string name  = r.readString();
+        const std::string value = r.readString();
+        md.addAttribute(name.c_str(), value.c_str());
+    }
+
+    const size_t numChildren = r.readSize();
+    for (size_t i = 0; i < numChildren; ++i)
+    {
+        const std::string name = r.readString();
+        md.addChildElement(name.c_str(), "");
+        ReadMetadataContent(r, md.getChildElement(md.getNumChildrenElements() - 1));
+    }
+}
+
+void WriteOpData(EntryWriter & w, const OpData & data)
+{
+    w.writeEnum(data.getType());
+    WriteMetadataContent(w, data.getFormatMetadata());
+
+    switch (data.getType())
+    {
+    case OpData::Lut1DType:
+    {
+        const Lut1DOpData & lut = static_cast<const Lut1DOpData &>(data);
+        w.writeEnum(lut.getInterpolation());
+        w.writeEnum(lut.getDirection());
+        w.writeEnum(lut.getHalfFlags());
+        w.writeEnum(lut.getHueAdjust());
+        w.writeEnum(lut.getFileOutputBitDepth());
+        w.writeUInt(lut.getArray().getLength());
+        w.writeUInt(lut.getArray().getNumColorComponents());
+        w.writeValues(lut.getArray().getValues());
+        break;
+    }
+    case OpData::Lut3DType:
+    {
+        const Lut3DOpData & lut = static_cast<const Lut3DOpData &>(data);
+        w.writeEnum(lut.getInterpolation());
+        w.writeEnum(lut.getDirection());
+        w.writeEnum(lut.getFileOutputBitDepth());
+        w.writeUInt(lut.getArray().getLength());
+        w.writeValues(lut.getArray().getValues());
+        break;
+    }
+    case OpData::MatrixType:
+    {
+        const MatrixOpData & mat = static_cast<const MatrixOpData &>(data);
+        w.writeEnum(mat.getDirection());
+        w.writeEnum(mat.getFileInputBitDepth());
+        w.writeEnum(mat.getFileOutputBitDepth());
+        w.writeValues(mat.getArray().getValues());
+        w.write(mat.getOffsets().getValues(), 4 * sizeof(double));
+        break;
+    }
+    case OpData::RangeType:
+    {
+        const RangeOpData & range = static_cast<const RangeOpData &>(data);
+        w.writeEnum(range.getDirection());
+        w.writeEnum(range.getFileInputBitDepth());
+        w.writeEnum(range.getFileOutputBitDepth());
+        w.writePOD(range.getMinInValue());
+        w.writePOD(range.getMaxInValue());
+        w.writePOD(range.getMinOutValue());
+        w.writePOD(range.getMaxOutValue());
+        break;
+    }
+    case OpData::CDLType:
+    case OpData::ExponentType:
+    case OpData::ExposureContrastType:
+    case OpData::FixedFunctionType:
+    case OpData::GammaType:
+    case OpData::GradingPrimaryType:
+    case OpData::GradingRGBCurveType:
+    case OpData::GradingHueCurveType:
+    case OpData::GradingToneType:
+    case OpData::LogType:
+    case OpData::ReferenceType:
+    case OpData::NoOpType:
+    {
+        std::ostringstream os;
+        os << "The disk cache does not support the '" << GetTypeName(data.getType())
+           << "' op data.";
+        throw Exception(os.str().c_str());
+    }
+    }
+}
+
+OpDataRcPtr ReadOpData(EntryReader & r)
+{
+    const OpData::Type type = r.readEnum<OpData::Type>();
+
+    FormatMetadataImpl metadata;
+    ReadMetadataContent(r, metadata);
+
+    OpDataRcPtr data;
+    switch (type)
+    {
+    case OpData::Lut1DType:
+    {
+        const Interpolation interp    = r.readEnum<Interpolation>();
+        const TransformDirection dir  = r.readEnum<TransformDirection>();
+        const auto halfFlags          = r.readEnum<Lut1DOpData::HalfFlags>();
+        const Lut1DHueAdjust hue      = r.readEnum<Lut1DHueAdjust>();
+        const BitDepth fileOutDepth   = r.readEnum<BitDepth>();
+        const unsigned long length    = r.readUInt();
+        const unsigned long numComps  = r.readUInt();
+
+        auto lut = std::make_shared<Lut1DOpData>(halfFlags, length, false);
+        lut->setInterpolation(interp);
+        lut->setDirection(dir);
+        lut->setHueAdjust(hue);
+        lut->setFileOutputBitDepth(fileOutDepth);
+        r.readValues(lut->getArray().getValues());
+        lut->getArray().setNumColorComponents(numComps);
+        data = lut;
+        break;
+    }
+    case OpData::Lut3DType:
+    {
+        const Interpolation interp   = r.readEnum<Interpolation>();
+        const TransformDirection dir = r.readEnum<TransformDirection>();
+        const BitDepth fileOutDepth  = r.readEnum<BitDepth>();
+        const unsigned long gridSize = r.readUInt();
+
+        auto lut = std::make_shared<Lut3DOpData>(interp, gridSize);
+        lut->setDirection(dir);
+        lut->setFileOutputBitDepth(fileOutDepth);
+        r.readValues(lut->getArray().getValues());
+        data = lut;
+        break;
+    }
+    case OpData::MatrixType:
+    {
+        auto mat = std::make_shared<MatrixOpData>(r.readEnum<TransformDirection>());
+        mat->setFileInputBitDepth(r.readEnum<BitDepth>());
+        mat->setFileOutputBitDepth(r.readEnum<BitDepth>());
+        r.readValues(mat->getArray().getValues());
+        for (unsigned long i = 0; i < 4; ++i)
+        {
+            mat->setOffsetValue(i, r.readPOD<double>());
+        }
+        data = mat;
+        break;
+    }
+    case OpData::RangeType:
+    {
+        const TransformDirection dir = r.readEnum<TransformDirection>();
+        const BitDepth fileInDepth   = r.readEnum<BitDepth>();
+        const BitDepth fileOutDepth  = r.readEnum<BitDepth>();
+        const double minIn  = r.readPOD<double>();
+        const double maxIn  = r.readPOD<double>();
+        const double minOut = r.readPOD<double>();
+        const double maxOut = r.readPOD<double>();
+
+        auto range = std::make_shared<RangeOpData>(minIn, maxIn, minOut, maxOut, dir);
+        range->setFileInputBitDepth(fileInDepth);
+        range->setFileOutputBitDepth(fileOutDepth);
+        data = range;
+        break;
+    }
+    case OpData::CDLType:
+    case OpData::ExponentType:
+    case OpData::ExposureContrastType:
+    case OpData::FixedFunctionType:
+    case OpData::GammaType:
+    case OpData::GradingPrimaryType:
+    case OpData::GradingRGBCurveType:
+    case OpData::GradingHueCurveType:
+    case OpData::GradingToneType:
+    case OpData::LogType:
+    case OpData::ReferenceType:
+    case OpData::NoOpType:
+        r.throwCorrupted();
+    }
+
+    if (!data)
+    {
+        r.throwCorrupted();
+    }
+
+    data->getFormatMetadata() = metadata;
+    return data;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////
+// Settings & caches.
+
+struct Settings
+{
+    Settings()
+        :   m_envDisableAllCaches(Platform::isEnvPresent(OCIO_DISABLE_ALL_CACHES))
+    {
+        Platform::Getenv(OCIO_DISK_CACHE_DIR, m_directory);
+
+        std::string budget;
+        if (Platform::Getenv(OCIO_DISK_CACHE_BUDGET, budget))
+        {
+            // Note: An invalid value means no limit.
+            m_budget = static_cast<size_t>(std::strtoull(budget.c_str(), nullptr, 10));
+        }
+    }
+
+    Settings(const Settings &) = delete;
+    Settings & operator=(const Settings &) = delete;
+
+    const bool m_envDisableAllCaches;
+
+    Mutex m_mutex;
+    std::string m_directory;
+    size_t m_budget = DefaultBudget;
+};
+
+Settings & GetSettings()
+{
+    static Settings settings;
+    return settings;
+}
+
+std::string GetDirectory()
+{
+    Settings & settings = GetSettings();
+    AutoMutex lock(settings.m_mutex);
+    return settings.m_directory;
+}
+
+typedef OCIO_SHARED_PTR<const ConstOpDataVec> ConstOpDataVecRcPtr;
+
+// The entries already read (or written) by the process. The memory footprint of an entry is
+// estimated from its file size.
+class MemoryCache : public LRUCache<CacheIDDigest, ConstOpDataVecRcPtr>
+{
+public:
+    MemoryCache()
+    {
+        std::string budget;
+        if (Platform::Getenv(OCIO_FILE_CACHE_BUDGET, budget))
+        {
+            // Note: An invalid value means no limit.
+            setBudget(static_cast<size_t>(std::strtoull(budget.c_str(), nullptr, 10)));
+        }
+    }
+};
+
+MemoryCache g_memoryCache;
+
+// Remove the least recently used (i.e. the oldest modification time as loading an entry updates
+// it) entries until the directory size fits in the budget, and return the remaining size.
+uintmax_t EvictEntries(const std::string & directory, size_t budget)
+{
+    if (directory.empty() || budget == 0)
+    {
+        return 0;
+    }
+
+    struct Entry
+    {
+        fs::path m_path;
+        uintmax_t m_size;
+        fs::file_time_type m_time;
+    };
+
+    std::vector<Entry> entries;
+    uintmax_t totalSize = 0;
+
+    std::error_code ec;
+    const auto now = fs::file_time_type::clock::now();
+    for (fs::directory_iterator it(PathFromUTF8(directory), ec), end; !ec && it != end;
+         it.increment(ec))
+    {
+        const fs::path & path = it->path();
+        const fs::path ext = path.extension();
+
+        std::error_code statEc;
+        if (ext == TempExtension)
+        {
+            const auto time = fs::last_write_time(path, statEc);
+            if (!statEc && now - time > StaleTempFileAge)
+            {
+                fs::remove(path, statEc);
+            }
+        }
+        else if (ext == EntryExtension)
+        {
+            Entry entry{ path, fs::file_size(path, statEc), fs::last_write_time(path, statEc) };
+            if (!statEc)
+            {
+                totalSize += entry.m_size;
+                entries.push_back(std::move(entry));
+            }
+        }
+    }
+
+    if (totalSize <= budget)
+    {
+        return totalSize;
+    }
+
+    std::sort(entries.begin(), entries.end(),
+              [](const Entry & a, const Entry & b) { return a.m_time < b.m_time; });
+
+    for (const auto & entry : entries)
+    {
+        if (totalSize <= budget)
+        {
+            break;
+        }
+
+        std::error_code removeEc;
+        if (fs::remove(entry.m_path, removeEc))
+        {
+            totalSize -= entry.m_size;
+        }
+    }
+
+    return totalSize;
+}
+
+// Track the size of the directory to only scan it (i.e. to evict entries) when the written
+// entries could exceed the budget, or when the last scan is too old.
+class DirectorySize
+{
+public:
+    DirectorySize() = default;
+    DirectorySize(const DirectorySize &) = delete;
+    DirectorySize & operator=(const DirectorySize &) = delete;
+
+    void addEntry(const std::string & directory, size_t budget, uintmax_t entrySize)
+    {
+        AutoMutex lock(m_mutex);
+
+        if (directory != m_directory)
+        {
+            m_directory = directory;
+            m_scanned   = false;
+        }
+
+        m_size += entrySize;
+
+        if (!m_scanned || m_size > budget
+            || std::chrono::steady_clock::now() - m_lastScan > DirectoryScanInterval)
+        {
+            scan(budget);
+        }
+    }
+
+    void evict(const std::string & directory, size_t budget)
+    {
+        AutoMutex lock(m_mutex);
+        m_directory = directory;
+        scan(budget);
+    }
+
+private:
+    void scan(size_t budget)
+    {
+        m_size     = EvictEntries(m_directory, budget);
+        m_scanned  = true;
+        m_lastScan = std::chrono::steady_clock::now();
+    }
+
+    Mutex m_mutex;
+    std::string m_directory;
+    uintmax_t m_size = 0;
+    bool m_scanned   = false;
+    std::chrono::steady_clock::time_point m_lastScan;
+};
+
+DirectorySize g_directorySize;
+
+// Return a unique name, among processes & threads, for the temporary file of an entry.
+std::string GetTempPath(const std::string & entryPath)
+{
+    static std::atomic<uint64_t> counter{ 0 };
+
+    CacheIDHasher hasher;
+    const auto threadId = std::hash<std::thread::id>()(std::this_thread::get_id());
+    const auto time     = std::chrono::high_resolution_clock::now().time_since_epoch().count();
+    const uint64_t num  = ++counter;
+    const void * addr   = &counter; // i.e. differs between processes when using ASLR.
+    hasher.update(&threadId, sizeof(threadId))
+          .update(&time, sizeof(time))
+          .update(&num, sizeof(num))
+          .update(&addr, sizeof(addr));
+
+    return entryPath + "." + hasher.digest().toUUID() + TempExtension;
+}
+
+// The content of an entry.
+enum EntryKind : uint32_t
+{
+    ENTRY_OP_DATA = 0, // A list of op data.
+    ENTRY_VALUES  = 1  // Float values (e.g. a LUT prepared for a renderer).
+};
+
+// Check the header of the entry and return the reader of its payload. The payload is read from
+// the memory mapping of the file which is kept alive by the values sharing it.
+std::unique_ptr<EntryReader> ReadEntry(const CacheIDDigest & key,
+                                       EntryKind kind,
+                                       const std::string & filename)
+{
+    auto file = std::make_shared<const Platform::MappedFile>(filename.c_str());
+
+    EntryReader header(file->data(), file->size(), filename, file);
+    if (file->size() < EntryHeaderSize
+        || 0 != memcmp(file->data(), EntrySignature, sizeof(EntrySignature)))
+    {
+        header.throwCorrupted();
+    }
+
+    header.readPOD<uint64_t>(); // Signature.
+
+    // The versions are part of the file name so they always match for a valid entry.
+    const uint32_t formatVersion  = header.readUInt();
+    const uint32_t libraryVersion = header.readUInt();
+    if (formatVersion != EntryFormatVersion
+        || libraryVersion != static_cast<uint32_t>(GetVersionHex()))
+    {
+        header.throwCorrupted();
+    }
+
+    const uint32_t entryKind = header.readUInt();
+
+    CacheIDDigest entryKey;
+    entryKey.m_low  = header.readPOD<uint64_t>();
+    entryKey.m_high = header.readPOD<uint64_t>();
+
+    const uint64_t payloadSize = header.readPOD<uint64_t>();
+    CacheIDDigest checksum;
+    checksum.m_low  = header.readPOD<uint64_t>();
+    checksum.m_high = header.readPOD<uint64_t>();
+
+    const char * payload = file->data() + EntryHeaderSize;
+    if (entryKind != kind || entryKey != key || payloadSize != file->size() - EntryHeaderSize
+        || checksum != CacheIDHashDigest(payload, static_cast<size_t>(payloadSize)))
+    {
+        header.throwCorrupted();
+    }
+
+    return std::make_unique<EntryReader>(payload, static_cast<size_t>(payloadSize), filename,
+                                         file);
+}
+
+ConstOpDataVecRcPtr ReadOpDataEntry(const CacheIDDigest & key, const std::string & filename)
+{
+    auto reader = ReadEntry(key, ENTRY_OP_DATA, filename);
+
+    auto data = std::make_shared<ConstOpDataVec>(reader->readSize());
+    for (auto & opData : *data)
+    {
+        opData = ReadOpData(*reader);
+    }
+
+    if (!reader->atEnd())
+    {
+        reader->throwCorrupted();
+    }
+
+    return data;
+}
+
+void WriteEntry(const CacheIDDigest & key,
+                EntryKind kind,
+                const EntryWriter & payload,
+                std::ostream & ostream)
+{
+    const std::string & buffer = payload.buffer();
+    const CacheIDDigest checksum = CacheIDHashDigest(buffer.data(), buffer.size());
+
+    EntryWriter header;
+    header.write(EntrySignature, sizeof(EntrySignature));
+    header.writeUInt(EntryFormatVersion);
+    header.writeUInt(static_cast<uint32_t>(GetVersionHex()));
+    header.writeUInt(kind);
+    header.writePOD(key.m_low);
+    header.writePOD(key.m_high);
+    header.writePOD<uint64_t>(buffer.size());
+    header.writePOD(checksum.m_low);
+    header.writePOD(checksum.m_high);
+
+    const std::string padding(EntryHeaderSize - header.buffer().size(), '\0');
+
+    ostream.write(header.buffer().data(), header.buffer().size());
+    ostream.write(padding.data(), padding.size());
+    ostream.write(buffer.data(), buffer.size());
+}
+
+// Read an existing entry file. A corrupted entry is removed.
+template<typename Read>
+bool ReadEntryFile(const std::string & filename, Read read)
+{
+    std::error_code ec;
+    const fs::path path = PathFromUTF8(filename);
+    if (!fs::exists(path, ec))
+    {
+        return false;
+    }
+
+    try
+    {
+        read();
+    }
+    catch (const CorruptedEntryException & e)
+    {
+        // Note that another process could only replace the file by a complete entry.
+        LogDebug(e.what());
+        fs::remove(path, ec);
+        return false;
+    }
+    catch (const std::exception & e)
+    {
+        // The entry is kept when the failure is not caused by its content (e.g. the file could
+        // not be mapped).
+        LogDebug(e.what());
+        return false;
+    }
+
+    // Loading an entry makes it the most recently used one.
+    fs::last_write_time(path, fs::file_time_type::clock::now(), ec);
+    return true;
+}
+
+void WriteEntryFile(const CacheIDDigest & key, EntryKind kind, const EntryWriter & payload)
+{
+    const std::string filename = DiskCache::GetEntryPath(key);
+    const std::string tempFilename = GetTempPath(filename);
+
+    std::error_code ec;
+    const fs::path tempPath = PathFromUTF8(tempFilename);
+
+    uintmax_t entrySize = 0;
+    try
+    {
+        fs::create_directories(tempPath.parent_path(), ec);
+
+        std::ostringstream buffer;
+        WriteEntry(key, kind, payload, buffer);
+        const std::string content = buffer.str();
+        entrySize = content.size();
+
+        {
+            std::ofstream file(tempPath, std::ios_base::out | std::ios_base::binary);
+            file.write(content.data(), content.size());
+            file.close();
+            if (!file)
+            {
+                std::ostringstream os;
+                os << "Error could not write the disk cache entry '" << tempFilename << "'.";
+                throw Exception(os.str().c_str());
+            }
+        }
+
+        // The rename is atomic so a reader never sees a partial entry. Note that an existing
+        // entry file is never modified in place as other processes could have mapped it.
+        fs::rename(tempPath, PathFromUTF8(filename), ec);
+        if (ec)
+        {
+            std::ostringstream os;
+            os << "Error could not rename the disk cache entry '" << tempFilename << "': "
+               << ec.message();
+            throw Exception(os.str().c_str());
+        }
+    }
+    catch (const std::exception & e)
+    {
+        LogDebug(e.what());
+        fs::remove(tempPath, ec);
+        return;
+    }
+
+    const size_t budget = GetDiskCacheBudget();
+    if (budget != 0)
+    {
+        g_directorySize.addEntry(GetDirectory(), budget, entrySize);
+    }
+}
+
+} // anon.
+
+bool DiskCache::IsEnabled()
+{
+    Settings & settings = GetSettings();
+    if (settings.m_envDisableAllCaches)
+    {
+        return false;
+    }
+
+    AutoMutex lock(settings.m_mutex);
+    return !settings.m_directory.empty();
+}
+
+bool DiskCache::IsSupported(const OpData & data) noexcept
+{
+    switch (data.getType())
+    {
+    case OpData::Lut1DType:
+    case OpData::Lut3DType:
+    case OpData::MatrixType:
+    case OpData::RangeType:
+        return true;
+    case OpData::CDLType:
+    case OpData::ExponentType:
+    case OpData::ExposureContrastType:
+    case OpData::FixedFunctionType:
+    case OpData::GammaType:
+    case OpData::GradingPrimaryType:
+    case OpData::GradingRGBCurveType:
+    case OpData::GradingHueCurveType:
+    case OpData::GradingToneType:
+    case OpData::LogType:
+    case OpData::ReferenceType:
+    case OpData::NoOpType:
+        return false;
+    }
+
+    return false;
+}
+
+void DiskCache::UpdateKey(CacheIDHasher & hasher, const OpData & data)
+{
+    EntryWriter w(hasher);
+    WriteOpData(w, data);
+}
+
+void DiskCache::UpdateKey(CacheIDHasher & hasher, const OpRcPtrVec & ops)
+{
+    for (const auto & op : ops)
+    {
+        ConstOpRcPtr constOp = op;
+        const OpData & data = *constOp->data();
+        if (IsSupported(data))
+        {
+            UpdateKey(hasher, data);
+        }
+        else
+        {
+            hasher.update(GetTypeName(data.getType())).update(op->getCacheID());
+        }
+    }
+}
+
+bool DiskCache::UpdateKey(CacheIDHasher & hasher, const std::string & filepath)
+{
+    std::error_code ec;
+    const fs::path path = PathFromUTF8(filepath);
+
+    const uintmax_t size = fs::file_size(path, ec);
+    if (ec)
+    {
+        return false;
+    }
+    const auto time = fs::last_write_time(path, ec).time_since_epoch().count();
+    if (ec)
+    {
+        return false;
+    }
+
+    // The device & inode identify the file when the path is reused for another file.
+    hasher.update(filepath)
+          .update(Platform::CreateFileContentHash(filepath))
+          .update(&size, sizeof(size))
+          .update(&time, sizeof(time));
+
+    return true;
+}
+
+std::string DiskCache::GetEntryPath(const CacheIDDigest & key)
+{
+    const std::string directory = GetDirectory();
+    if (directory.empty())
+    {
+        return std::string();
+    }
+
+    // i.e. <key>_<library version>_<format version>.ociocache
+    std::ostringstream filename;
+    filename << key.toUUID() << "_" << std::hex << GetVersionHex() << std::dec << "_"
+             << EntryFormatVersion << EntryExtension;
+
+    return PathToUTF8(PathFromUTF8(directory) / PathFromUTF8(filename.str()));
+}
+
+bool DiskCache::Load(const CacheIDDigest & key, ConstOpDataVec & data)
+{
+    if (!IsEnabled())
+    {
+        return false;
+    }
+
+    ConstOpDataVecRcPtr entry;
+    if (g_memoryCache.get(key, entry))
+    {
+        data = *entry;
+        return true;
+    }
+
+    const std::string filename = GetEntryPath(key);
+    if (!ReadEntryFile(filename, [&]() { entry = ReadOpDataEntry(key, filename); }))
+    {
+        return false;
+    }
+
+    std::error_code ec;
+    const uintmax_t size = fs::file_size(PathFromUTF8(filename), ec);
+    g_memoryCache.insert(key, entry, static_cast<size_t>(size));
+
+    data = *entry;
+    return true;
+}
+
+void DiskCache::Save(const CacheIDDigest & key, const ConstOpDataVec & data)
+{
+    if (!IsEnabled())
+    {
+        return;
+    }
+
+    EntryWriter payload;
+    payload.writeSize(data.size());
+    for (const auto & opData : data)
+    {
+        WriteOpData(payload, *opData);
+    }
+
+    WriteEntryFile(key, ENTRY_OP_DATA, payload);
+}
+
+bool DiskCache::LoadValues(const CacheIDDigest & key, Array::Values & values)
+{
+    if (!IsEnabled())
+    {
+        return false;
+    }
+
+    const std::string filename = GetEntryPath(key);
+    return ReadEntryFile(filename, [&]()
+    {
+        auto reader = ReadEntry(key, ENTRY_VALUES, filename);
+
+        Array::Values entryValues;
+        reader->readValues(entryValues, false);
+        if (!reader->atEnd())
+        {
+            reader->throwCorrupted();
+        }
+
+        values = std::move(entryValues);
+    });
+}
+
+void DiskCache::SaveValues(const CacheIDDigest & key, const Array::Values & values)
+{
+    if (!IsEnabled())
+    {
+        return;
+    }
+
+    EntryWriter payload;
+    payload.writeValues(values);
+
+    WriteEntryFile(key, ENTRY_VALUES, payload);
+}
+
+void DiskCache::ClearMemoryCache()
+{
+    g_memoryCache.clear();
+}
+
+void DiskCache::SetMemoryBudget(size_t numBytes)
+{
+    g_memoryCache.setBudget(numBytes);
+}
+
+void SetDiskCacheDirectory(const char * dirname)
+{
+    {
+        Settings & settings = GetSettings();
+        AutoMutex lock(settings.m_mutex);
+        settings.m_directory = dirname ? dirname : "";
+    }
+
+    // The entries kept in memory could come from the previous directory.
+    g_memoryCache.clear();
+}
+
+const char * GetDiskCacheDirectory()
+{
+    // The string is kept per thread as the directory could be changed by another thread.
+    static thread_local std::string directory;
+    directory = GetDirectory();
+    return directory.c_str();
+}
+
+void SetDiskCacheBudget(size_t numBytes)
+{
+    {
+        Settings & settings = GetSettings();
+        AutoMutex lock(settings.m_mutex);
+        settings.m_budget = numBytes;
+    }
+
+    if (DiskCache::IsEnabled())
+    {
+        g_directorySize.evict(GetDirectory(), numBytes);
+    }
+}
+
+size_t GetDiskCacheBudget()
+{
+    Settings & settings = GetSettings();
+    AutoMutex lock(settings.m_mutex);
+    return settings.m_budget;
+}
+
+} // namespace OCIO_NAMESPACE
@@ -0,0 +1,97 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#ifndef INCLUDED_OCIO_DISKCACHE_H
+#define INCLUDED_OCIO_DISKCACHE_H
+
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "HashUtils.h"
+#include "Op.h"
+#include "ops/OpArray.h"
+
+
+namespace OCIO_NAMESPACE
+{
+
+// The disk cache persists the op data which is expensive to build (i.e. the ops of a LUT file,
+// the fast inverse LUTs and the LUTs baked by the optimizer) and the LUTs prepared by the CPU
+// renderers so the processes sharing the cache directory (e.g. the render tasks of a node) only
+// build them once. It is disabled by default (refer to SetDiskCacheDirectory &
+// OCIO_DISK_CACHE_DIR).
+//
+// Each entry is a file named from its key, the library version and the entry format version
+// (i.e. the processes using other versions keep their own entries). The file starts with a
+// signature, the format version, the library version, the entry kind, the key, the payload size
+// and a 128-bit checksum of the payload. The payload is a little-endian encoding of the op data (or of the values) where the
+// LUT & matrix values are aligned so they are used in place from a read-only memory mapping of
+// the file (refer to ArrayValues) i.e. the processes share the physical memory of the LUTs. An
+// entry is written to a temporary file which is then renamed so concurrent readers never see a
+// partial entry and a mapped file is never modified, and the least recently used entries are
+// removed when the directory size exceeds the budget (refer to SetDiskCacheBudget &
+// OCIO_DISK_CACHE_BUDGET). The directory is only scanned when the entries written by the process
+// could exceed the budget or when the last scan is older than a minute.
+//
+// The op data entries are read only once per process i.e. they are then kept in memory using the
+// same budget than the FileTransform cache (refer to SetFileCacheBudget). Note that the copies of
+// the op data (e.g. when creating the ops) share the mapped values until they are modified.
+//
+// Any failure (e.g. missing permissions or corrupted entry) is only logged in debug mode and
+// treated as a cache miss. Only the corrupted entries are removed.
+
+namespace DiskCache
+{
+
+// Return true if a cache directory is set and the caches are not disabled.
+bool IsEnabled();
+
+// Return true if the op data could be stored i.e. a 1D LUT, a 3D LUT, a matrix or a range.
+bool IsSupported(const OpData & data) noexcept;
+
+// Add the complete content of a supported op data to the key (i.e. not only its cache id).
+void UpdateKey(CacheIDHasher & hasher, const OpData & data);
+
+// Add the ops to the key i.e. the complete content of the supported op data and the cache id of
+// the others.
+void UpdateKey(CacheIDHasher & hasher, const OpRcPtrVec & ops);
+
+// Add the identity of a file (i.e. its path, size & modification time) to the key. Return false
+// if the file does not exist.
+bool UpdateKey(CacheIDHasher & hasher, const std::string & filepath);
+
+// Return true and the op data of the entry if it exists.
+bool Load(const CacheIDDigest & key, ConstOpDataVec & data);
+
+// Store the op data which must be supported.
+void Save(const CacheIDDigest & key, const ConstOpDataVec & data);
+
+// Return the values of the entry if it exists. The values are not kept in memory.
+bool LoadValues(const CacheIDDigest & key, Array::Values & values);
+
+// Store the values.
+void SaveValues(const CacheIDDigest & key, const Array::Values & values);
+
+// Return a copy (i.e. that could be modified) of a loaded op data if it has the expected type.
+template<typename T>
+OCIO_SHARED_PTR<T> CopyAs(const ConstOpDataRcPtr & data)
+{
+    auto typed = DynamicPtrCast<const T>(data);
+    return typed ? std::make_shared<T>(*typed) : OCIO_SHARED_PTR<T>();
+}
+
+// Clear the entries kept in memory (i.e. the entry files are kept).
+void ClearMemoryCache();
+
+// The memory budget of the entries kept in memory. Zero means no limit.
+void SetMemoryBudget(size_t numBytes);
+
+// Return the path of the entry file (for tests).
+std::string GetEntryPath(const CacheIDDigest & key);
+
+} // namespace DiskCache
+
+} // namespace OCIO_NAMESPACE
+
+#endif // INCLUDED_OCIO_DISKCACHE_H
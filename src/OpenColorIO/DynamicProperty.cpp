@@ -2,6 +2,9 @@
 // Copyright Contributors to the OpenColorIO Project.
 
 
+#include <atomic>
+#include <memory>
+
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "DynamicProperty.h"
@@ -124,12 +127,83 @@ bool DynamicPropertyImpl::equals(const DynamicPropertyImpl & rhs) const
     return false;
 }
 
+namespace
+{
+// Snapshot pinned by the calling thread, if any.
+thread_local const DynamicPropertySnapshot * g_pinnedSnapshot = nullptr;
+}
+
+DynamicPropertyImpl::ConstVersionRcPtr DynamicPropertyImpl::loadVersion() const
+{
+    if (const DynamicPropertySnapshot * snapshot = g_pinnedSnapshot)
+    {
+        for (const auto & version : snapshot->m_versions)
+        {
+            if (version.first == this)
+            {
+                return version.second;
+            }
+        }
+    }
+
+    return std::atomic_load(&m_version);
+}
+
+void DynamicPropertyImpl::publishVersion(const ConstVersionRcPtr & version)
+{
+    std::atomic_store(&m_version, version);
+}
+
+bool DynamicPropertyImpl::prepareUpdate()
+{
+    m_preparedVersion = prepareStagedValue();
+    return !!m_preparedVersion;
+}
+
+void DynamicPropertyImpl::commitUpdate()
+{
+    m_updateInProgress = false;
+    if (m_preparedVersion)
+    {
+        publishVersion(m_preparedVersion);
+        m_preparedVersion.reset();
+    }
+}
+
+DynamicPropertySnapshot::DynamicPropertySnapshot(const std::vector<DynamicPropertyImplRcPtr> & props)
+{
+    load(props);
+}
+
+void DynamicPropertySnapshot::load(const std::vector<DynamicPropertyImplRcPtr> & props)
+{
+    m_versions.clear();
+    m_versions.reserve(props.size());
+    for (const auto & prop : props)
+    {
+        m_versions.emplace_back(prop.get(), std::atomic_load(&prop->m_version));
+    }
+}
+
+DynamicPropertySnapshot::Pin::Pin(const DynamicPropertySnapshot & snapshot) noexcept
+    : m_previous(g_pinnedSnapshot)
+{
+    g_pinnedSnapshot = &snapshot;
+}
+
+DynamicPropertySnapshot::Pin::~Pin()
+{
+    g_pinnedSnapshot = m_previous;
+}
+
+//========================================================================================
+
 DynamicPropertyDoubleImpl::DynamicPropertyDoubleImpl(DynamicPropertyType type,
                                                      double value,
                                                      bool dynamic)
     : DynamicPropertyImpl(type, dynamic)
-    , m_value(value)
 {
+    publishVersion(std::make_shared<double>(value));
 }
 
 DynamicPropertyDoubleImplRcPtr DynamicPropertyDoubleImpl::createEditableCopy() const
@@ -137,6 +211,31 @@ DynamicPropertyDoubleImplRcPtr DynamicPropertyDoubleImpl::createEditableCopy() c
     return std::make_shared<DynamicPropertyDoubleImpl>(getType(), getValue(), isDynamic());
 }
 
+double DynamicPropertyDoubleImpl::getValue() const
+{
+    return *static_cast<const double *>(loadVersion().get());
+}
+
+void DynamicPropertyDoubleImpl::setValue(double value)
+{
+    if (m_updateInProgress)
+    {
+        m_stagedValue = value;
+        m_hasStagedValue = true;
+        return;
+    }
+
+    publishVersion(std::make_shared<double>(value));
+}
+
+DynamicPropertyImpl::ConstVersionRcPtr DynamicPropertyDoubleImpl::prepareStagedValue()
+{
+    if (!m_hasStagedValue) return ConstVersionRcPtr();
+
+    m_hasStagedValue = false;
+    return std::make_shared<double>(m_stagedValue);
+}
+
 //========================================================================================
 
 DynamicPropertyGradingPrimaryImpl::DynamicPropertyGradingPrimaryImpl(GradingStyle style,
@@ -146,9 +245,8 @@ DynamicPropertyGradingPrimaryImpl::DynamicPropertyGradingPrimaryImpl(GradingStyl
     : DynamicPropertyImpl(DYNAMIC_PROPERTY_GRADING_PRIMARY, dynamic)
     , m_style(style)
     , m_direction(dir)
-    , m_value(value)
 {
-    m_preRenderValues.update(m_style, m_direction, m_value);
+    publishVersion(makeVersion(value));
 }
 
 DynamicPropertyGradingPrimaryImpl::DynamicPropertyGradingPrimaryImpl(GradingStyle style,
@@ -159,33 +257,66 @@ DynamicPropertyGradingPrimaryImpl::DynamicPropertyGradingPrimaryImpl(GradingStyl
     : DynamicPropertyImpl(DYNAMIC_PROPERTY_GRADING_PRIMARY, dynamic)
     , m_style(style)
     , m_direction(dir)
-    , m_value(value)
-    , m_preRenderValues(comp)
 {
+    publishVersion(std::make_shared<Version>(value, comp));
 }
 
 DynamicPropertyGradingPrimaryImplRcPtr DynamicPropertyGradingPrimaryImpl::createEditableCopy() const
 {
+    const ConstVersionPtr version = getVersion();
     return std::make_shared<DynamicPropertyGradingPrimaryImpl>(m_style,
                                                                m_direction,
-                                                               m_value,
-                                                               m_preRenderValues,
+                                                               version->m_value,
+                                                               version->m_preRender,
                                                                isDynamic());
 }
 
+DynamicPropertyGradingPrimaryImpl::ConstVersionPtr DynamicPropertyGradingPrimaryImpl::getVersion() const
+{
+    return std::static_pointer_cast<const Version>(loadVersion());
+}
+
+ConstGradingPrimaryPreRenderRcPtr DynamicPropertyGradingPrimaryImpl::getComputedValue() const
+{
+    const ConstVersionPtr version = getVersion();
+    return ConstGradingPrimaryPreRenderRcPtr(version, &version->m_preRender);
+}
+
+DynamicPropertyImpl::ConstVersionRcPtr
+DynamicPropertyGradingPrimaryImpl::makeVersion(const GradingPrimary & value) const
+{
+    GradingPrimaryPreRender preRender;
+    preRender.update(m_style, m_direction, value);
+    return std::make_shared<Version>(value, preRender);
+}
+
 void DynamicPropertyGradingPrimaryImpl::setValue(const GradingPrimary & value)
 {
     value.validate(m_style);
-    m_value = value;
-    m_preRenderValues.update(m_style, m_direction, m_value);
+
+    if (m_updateInProgress)
+    {
+        m_stagedValue.reset(new GradingPrimary(value));
+        return;
+    }
+
+    publishVersion(makeVersion(value));
+}
+
+DynamicPropertyImpl::ConstVersionRcPtr DynamicPropertyGradingPrimaryImpl::prepareStagedValue()
+{
+    if (!m_stagedValue) return ConstVersionRcPtr();
+
+    ConstVersionRcPtr version = makeVersion(*m_stagedValue);
+    m_stagedValue.reset();
+    return version;
 }
 
 void DynamicPropertyGradingPrimaryImpl::setStyle(GradingStyle style)
 {
     m_style = style;
     // Reset values to style defaults.
-    m_value = GradingPrimary(m_style);
-    m_preRenderValues.update(m_style, m_direction, m_value);
+    publishVersion(makeVersion(GradingPrimary(m_style)));
 }
 
 void DynamicPropertyGradingPrimaryImpl::setDirection(TransformDirection dir) noexcept
@@ -193,7 +324,7 @@ void DynamicPropertyGradingPrimaryImpl::setDirection(TransformDirection dir) noe
     if (m_direction != dir)
     {
         m_direction = dir;
-        m_preRenderValues.update(m_style, m_direction, m_value);
+        publishVersion(makeVersion(getValue()));
     }
 }
 
@@ -203,58 +334,80 @@ DynamicPropertyGradingRGBCurveImpl::DynamicPropertyGradingRGBCurveImpl(
     const ConstGradingRGBCurveRcPtr & value, bool dynamic)
     : DynamicPropertyImpl(DYNAMIC_PROPERTY_GRADING_RGBCURVE, dynamic)
 {
-    m_gradingRGBCurve = GradingRGBCurve::Create(value);
-    // Convert control points from the UI into knots and coefficients for the apply.
-    precompute();
+    publishVersion(MakeVersion(GradingRGBCurve::Create(value)));
+}
+
+DynamicPropertyGradingRGBCurveImpl::ConstVersionPtr DynamicPropertyGradingRGBCurveImpl::getVersion() const
+{
+    return std::static_pointer_cast<const Version>(loadVersion());
 }
 
-const ConstGradingRGBCurveRcPtr & DynamicPropertyGradingRGBCurveImpl::getValue() const
+ConstGradingRGBCurveRcPtr DynamicPropertyGradingRGBCurveImpl::getValue() const
 {
-    return m_gradingRGBCurve;
+    return getVersion()->m_value;
 }
 
 void DynamicPropertyGradingRGBCurveImpl::setValue(const ConstGradingRGBCurveRcPtr & value)
 {
     value->validate();
 
-    m_gradingRGBCurve = value->createEditableCopy();
-    // Convert control points from the UI into knots and coefficients for the apply.
-    precompute();
+    if (m_updateInProgress)
+    {
+        m_stagedValue = value->createEditableCopy();
+        return;
+    }
+
+    publishVersion(MakeVersion(value->createEditableCopy()));
+}
+
+DynamicPropertyImpl::ConstVersionRcPtr DynamicPropertyGradingRGBCurveImpl::prepareStagedValue()
+{
+    if (!m_stagedValue) return ConstVersionRcPtr();
+
+    ConstVersionRcPtr version = MakeVersion(m_stagedValue);
+    m_stagedValue.reset();
+    return version;
+}
+
+ConstKnotsCoefsRcPtr DynamicPropertyGradingRGBCurveImpl::getKnotsCoefs() const
+{
+    const ConstVersionPtr version = getVersion();
+    return ConstKnotsCoefsRcPtr(version, &version->m_knotsCoefs);
 }
 
 bool DynamicPropertyGradingRGBCurveImpl::getLocalBypass() const
 {
-    return m_knotsCoefs.m_localBypass;
+    return getVersion()->m_knotsCoefs.m_localBypass;
 }
 
 int DynamicPropertyGradingRGBCurveImpl::getNumKnots() const
 {
-    return static_cast<int>(m_knotsCoefs.m_numKnots);
+    return static_cast<int>(getVersion()->m_knotsCoefs.m_numKnots);
 }
 
 int DynamicPropertyGradingRGBCurveImpl::getNumCoefs() const
 {
-    return static_cast<int>(m_knotsCoefs.m_numCoefs);
+    return static_cast<int>(getVersion()->m_knotsCoefs.m_numCoefs);
 }
 
 const int * DynamicPropertyGradingRGBCurveImpl::getKnotsOffsetsArray() const
 {
-    return m_knotsCoefs.m_knotsOffsetsArray.data();
+    return getVersion()->m_knotsCoefs.m_knotsOffsetsArray.data();
 }
 
 const int * DynamicPropertyGradingRGBCurveImpl::getCoefsOffsetsArray() const
 {
-    return m_knotsCoefs.m_coefsOffsetsArray.data();
+    return getVersion()->m_knotsCoefs.m_coefsOffsetsArray.data();
 }
 
 const float * DynamicPropertyGradingRGBCurveImpl::getKnotsArray() const
 {
-    return m_knotsCoefs.m_knotsArray.data();
+    return getVersion()->m_knotsCoefs.m_knotsArray.data();
 }
 
 const float * DynamicPropertyGradingRGBCurveImpl::getCoefsArray() const
 {
-    return m_knotsCoefs.m_coefsArray.data();
+    return getVersion()->m_knotsCoefs.m_coefsArray.data();
 }
 
 unsigned int DynamicPropertyGradingRGBCurveImpl::GetMaxKnots()
@@ -267,28 +420,35 @@ unsigned int DynamicPropertyGradingRGBCurveImpl::GetMaxCoefs()
     return GradingBSplineCurveImpl::KnotsCoefs::MAX_NUM_COEFS;
 }
 
-void DynamicPropertyGradingRGBCurveImpl::precompute()
+DynamicPropertyImpl::ConstVersionRcPtr
+DynamicPropertyGradingRGBCurveImpl::MakeVersion(const ConstGradingRGBCurveRcPtr & value)
 {
-    m_knotsCoefs.m_localBypass = false;
-    m_knotsCoefs.m_numCoefs = 0;
-    m_knotsCoefs.m_numKnots = 0;
+    auto version = std::make_shared<Version>(value);
+
+    GradingBSplineCurveImpl::KnotsCoefs & knotsCoefs = version->m_knotsCoefs;
+    knotsCoefs.m_localBypass = false;
+    knotsCoefs.m_numCoefs = 0;
+    knotsCoefs.m_numKnots = 0;
 
     // Compute knots and coefficients for each control point and pack all knots and coefs of
     // all curves in one knots array and one coef array, using an offset array to find specific
     // curve data.
     for (const auto c : { RGB_RED, RGB_GREEN, RGB_BLUE, RGB_MASTER })
     {
-        ConstGradingBSplineCurveRcPtr curve = m_gradingRGBCurve->getCurve(c);
+        ConstGradingBSplineCurveRcPtr curve = value->getCurve(c);
         auto curveImpl = dynamic_cast<const GradingBSplineCurveImpl *>(curve.get());
-        curveImpl->computeKnotsAndCoefs(m_knotsCoefs, static_cast<int>(c), false);
+        curveImpl->computeKnotsAndCoefs(knotsCoefs, static_cast<int>(c), false);
     }
-    if (m_knotsCoefs.m_numKnots <= 0) m_knotsCoefs.m_localBypass = true;
+    if (knotsCoefs.m_numKnots <= 0) knotsCoefs.m_localBypass = true;
+
+    return version;
 }
 
 DynamicPropertyGradingRGBCurveImplRcPtr DynamicPropertyGradingRGBCurveImpl::createEditableCopy() const
 {
     auto res = std::make_shared<DynamicPropertyGradingRGBCurveImpl>(getValue(), isDynamic());
-    res->m_knotsCoefs = m_knotsCoefs;
+    // The versions are immutable so they can be shared.
+    res->publishVersion(loadVersion());
     return res;
 }
 
@@ -298,58 +458,80 @@ DynamicPropertyGradingHueCurveImpl::DynamicPropertyGradingHueCurveImpl(
     const ConstGradingHueCurveRcPtr & value, bool dynamic)
     : DynamicPropertyImpl(DYNAMIC_PROPERTY_GRADING_HUECURVE, dynamic)
 {
-    m_gradingHueCurve = GradingHueCurve::Create(value);
-    // Convert control points from the UI into knots and coefficients for the apply.
-    precompute();
+    publishVersion(MakeVersion(GradingHueCurve::Create(value)));
+}
+
+DynamicPropertyGradingHueCurveImpl::ConstVersionPtr DynamicPropertyGradingHueCurveImpl::getVersion() const
+{
+    return std::static_pointer_cast<const Version>(loadVersion());
 }
 
-const ConstGradingHueCurveRcPtr & DynamicPropertyGradingHueCurveImpl::getValue() const
+ConstGradingHueCurveRcPtr DynamicPropertyGradingHueCurveImpl::getValue() const
 {
-    return m_gradingHueCurve;
+    return getVersion()->m_value;
 }
 
 void DynamicPropertyGradingHueCurveImpl::setValue(const ConstGradingHueCurveRcPtr & value)
 {
     value->validate();
 
-    m_gradingHueCurve = value->createEditableCopy();
-    // Convert control points from the UI into knots and coefficients for the apply.
-    precompute();
+    if (m_updateInProgress)
+    {
+        m_stagedValue = value->createEditableCopy();
+        return;
+    }
+
+    publishVersion(MakeVersion(value->createEditableCopy()));
+}
+
+DynamicPropertyImpl::ConstVersionRcPtr DynamicPropertyGradingHueCurveImpl::prepareStagedValue()
+{
+    if (!m_stagedValue) return ConstVersionRcPtr();
+
+    ConstVersionRcPtr version = MakeVersion(m_stagedValue);
+    m_stagedValue.reset();
+    return version;
+}
+
+ConstKnotsCoefsRcPtr DynamicPropertyGradingHueCurveImpl::getKnotsCoefs() const
+{
+    const ConstVersionPtr version = getVersion();
+    return ConstKnotsCoefsRcPtr(version, &version->m_knotsCoefs);
 }
 
 bool DynamicPropertyGradingHueCurveImpl::getLocalBypass() const
 {
-    return m_knotsCoefs.m_localBypass;
+    return getVersion()->m_knotsCoefs.m_localBypass;
 }
 
 int DynamicPropertyGradingHueCurveImpl::getNumKnots() const
 {
-    return static_cast<int>(m_knotsCoefs.m_numKnots);
+    return static_cast<int>(getVersion()->m_knotsCoefs.m_numKnots);
 }
 
 int DynamicPropertyGradingHueCurveImpl::getNumCoefs() const
 {
-    return static_cast<int>(m_knotsCoefs.m_numCoefs);
+    return static_cast<int>(getVersion()->m_knotsCoefs.m_numCoefs);
 }
 
 const int * DynamicPropertyGradingHueCurveImpl::getKnotsOffsetsArray() const
 {
-    return m_knotsCoefs.m_knotsOffsetsArray.data();
+    return getVersion()->m_knotsCoefs.m_knotsOffsetsArray.data();
 }
 
 const int * DynamicPropertyGradingHueCurveImpl::getCoefsOffsetsArray() const
 {
-    return m_knotsCoefs.m_coefsOffsetsArray.data();
+    return getVersion()->m_knotsCoefs.m_coefsOffsetsArray.data();
 }
 
 const float * DynamicPropertyGradingHueCurveImpl::getKnotsArray() const
 {
-    return m_knotsCoefs.m_knotsArray.data();
+    return getVersion()->m_knotsCoefs.m_knotsArray.data();
 }
 
 const float * DynamicPropertyGradingHueCurveImpl::getCoefsArray() const
 {
-    return m_knotsCoefs.m_coefsArray.data();
+    return getVersion()->m_knotsCoefs.m_coefsArray.data();
 }
 
 unsigned int DynamicPropertyGradingHueCurveImpl::GetMaxKnots()
@@ -362,29 +544,36 @@ unsigned int DynamicPropertyGradingHueCurveImpl::GetMaxCoefs()
     return GradingBSplineCurveImpl::KnotsCoefs::MAX_NUM_COEFS;
 }
 
-void DynamicPropertyGradingHueCurveImpl::precompute()
+DynamicPropertyImpl::ConstVersionRcPtr
+DynamicPropertyGradingHueCurveImpl::MakeVersion(const ConstGradingHueCurveRcPtr & value)
 {
-    m_knotsCoefs.m_localBypass = false;
-    m_knotsCoefs.m_numCoefs = 0;
-    m_knotsCoefs.m_numKnots = 0;
+    auto version = std::make_shared<Version>(value);
+
+    GradingBSplineCurveImpl::KnotsCoefs & knotsCoefs = version->m_knotsCoefs;
+    knotsCoefs.m_localBypass = false;
+    knotsCoefs.m_numCoefs = 0;
+    knotsCoefs.m_numKnots = 0;
 
     // Compute knots and coefficients for each control point and pack all knots and coefs of
     // all curves in one knots array and one coef array, using an offset array to find specific
     // curve data.
     for (const auto c : { HUE_HUE, HUE_SAT, HUE_LUM, LUM_SAT, SAT_SAT, LUM_LUM, SAT_LUM, HUE_FX })
     {
-        ConstGradingBSplineCurveRcPtr curve = m_gradingHueCurve->getCurve(c);
+        ConstGradingBSplineCurveRcPtr curve = value->getCurve(c);
         auto curveImpl = dynamic_cast<const GradingBSplineCurveImpl *>(curve.get());
-        curveImpl->computeKnotsAndCoefs(m_knotsCoefs, static_cast<int>(c),
-                                        m_gradingHueCurve->getDrawCurveOnly());
+        curveImpl->computeKnotsAndCoefs(knotsCoefs, static_cast<int>(c),
+                                        value->getDrawCurveOnly());
     }
-    if (m_knotsCoefs.m_numKnots <= 0) m_knotsCoefs.m_localBypass = true;
+    if (knotsCoefs.m_numKnots <= 0) knotsCoefs.m_localBypass = true;
+
+    return version;
 }
 
 DynamicPropertyGradingHueCurveImplRcPtr DynamicPropertyGradingHueCurveImpl::createEditableCopy() const
 {
     auto res = std::make_shared<DynamicPropertyGradingHueCurveImpl>(getValue(), isDynamic());
-    res->m_knotsCoefs = m_knotsCoefs;
+    // The versions are immutable so they can be shared.
+    res->publishVersion(loadVersion());
     return res;
 }
 
@@ -394,40 +583,78 @@ DynamicPropertyGradingToneImpl::DynamicPropertyGradingToneImpl(const GradingTone
                                                                GradingStyle style,
                                                                bool dynamic)
     : DynamicPropertyImpl(DYNAMIC_PROPERTY_GRADING_TONE, dynamic)
-    , m_value(value)
-    , m_preRenderValues(style)
 {
-    m_preRenderValues.update(m_value);
+    GradingTonePreRender preRender(style);
+    preRender.update(value);
+    publishVersion(std::make_shared<Version>(value, preRender));
 }
 
 DynamicPropertyGradingToneImpl::DynamicPropertyGradingToneImpl(const GradingTone & value,
                                                                const GradingTonePreRender & comp,
                                                                bool dynamic)
     : DynamicPropertyImpl(DYNAMIC_PROPERTY_GRADING_TONE, dynamic)
-    , m_value(value)
-    , m_preRenderValues(comp)
 {
+    publishVersion(std::make_shared<Version>(value, comp));
 }
 
 DynamicPropertyGradingToneImplRcPtr DynamicPropertyGradingToneImpl::createEditableCopy() const
 {
-    return std::make_shared<DynamicPropertyGradingToneImpl>(m_value, m_preRenderValues, isDynamic());
+    const ConstVersionPtr version = getVersion();
+    return std::make_shared<DynamicPropertyGradingToneImpl>(version->m_value,
+                                                            version->m_preRender,
+                                                            isDynamic());
+}
+
+DynamicPropertyGradingToneImpl::ConstVersionPtr DynamicPropertyGradingToneImpl::getVersion() const
+{
+    return std::static_pointer_cast<const Version>(loadVersion());
+}
+
+ConstGradingTonePreRenderRcPtr DynamicPropertyGradingToneImpl::getComputedValue() const
+{
+    const ConstVersionPtr version = getVersion();
+    return ConstGradingTonePreRenderRcPtr(version, &version->m_preRender);
+}
+
+DynamicPropertyImpl::ConstVersionRcPtr
+DynamicPropertyGradingToneImpl::makeVersion(const GradingTone & value) const
+{
+    // The style of the pre-render values is kept.
+    GradingTonePreRender preRender(*getComputedValue());
+    preRender.update(value);
+    return std::make_shared<Version>(value, preRender);
 }
 
 void DynamicPropertyGradingToneImpl::setValue(const GradingTone & value)
 {
     value.validate();
 
-    m_value = value;
-    m_preRenderValues.update(m_value);
+    if (m_updateInProgress)
+    {
+        m_stagedValue.reset(new GradingTone(value));
+        return;
+    }
+
+    publishVersion(makeVersion(value));
+}
+
+DynamicPropertyImpl::ConstVersionRcPtr DynamicPropertyGradingToneImpl::prepareStagedValue()
+{
+    if (!m_stagedValue) return ConstVersionRcPtr();
+
+    ConstVersionRcPtr version = makeVersion(*m_stagedValue);
+    m_stagedValue.reset();
+    return version;
 }
 
 void DynamicPropertyGradingToneImpl::setStyle(GradingStyle style)
 {
     // Reset values to style defaults.
-    m_value = GradingTone(style);
-    m_preRenderValues.setStyle(style);
-    m_preRenderValues.update(m_value);
+    const GradingTone value(style);
+    GradingTonePreRender preRender(*getComputedValue());
+    preRender.setStyle(style);
+    preRender.update(value);
+    publishVersion(std::make_shared<Version>(value, preRender));
 }
 
 } // namespace OCIO_NAMESPACE
@@ -4,6 +4,10 @@
 #ifndef INCLUDED_OCIO_DYNAMICPROPERTY_H
 #define INCLUDED_OCIO_DYNAMICPROPERTY_H
 
+#include <memory>
+#include <utility>
+#include <vector>
+
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "ops/gradingprimary/GradingPrimary.h"
@@ -16,6 +20,12 @@ namespace OCIO_NAMESPACE
 class DynamicPropertyImpl;
 typedef OCIO_SHARED_PTR<DynamicPropertyImpl> DynamicPropertyImplRcPtr;
 
+class DynamicPropertySnapshot;
+
+typedef OCIO_SHARED_PTR<const GradingBSplineCurveImpl::KnotsCoefs> ConstKnotsCoefsRcPtr;
+typedef OCIO_SHARED_PTR<const GradingPrimaryPreRender> ConstGradingPrimaryPreRenderRcPtr;
+typedef OCIO_SHARED_PTR<const GradingTonePreRender> ConstGradingTonePreRenderRcPtr;
+
 // Holds type and dynamic state.
 class DynamicPropertyImpl : public DynamicProperty
 {
@@ -54,13 +64,82 @@ public:
     //   return false. Even if the values agree now, they may not once in use.
     bool equals(const DynamicPropertyImpl & rhs) const;
 
+    // Deferred updates (refer to CPUProcessor::beginDynamicPropertyUpdate()). While an update
+    // is in progress, setValue() only stages the new value and the renderers keep using the
+    // current one until prepareUpdate() & commitUpdate() prepare and publish the staged value.
+    void beginUpdate() noexcept { m_updateInProgress = true; }
+    bool isUpdateInProgress() const noexcept { return m_updateInProgress; }
+    // Prepare the version of the staged value, and return true if there is one.
+    bool prepareUpdate();
+    // End the update and publish the version built by prepareUpdate(), if any.
+    void commitUpdate();
+
 protected:
     DynamicPropertyImpl(DynamicPropertyType type);
 
     DynamicPropertyImpl & operator=(DynamicPropertyImpl &) = delete;
+
+    // The values read by the renderers are published as immutable versions. A writer never
+    // modifies a published version but publishes a new one, so a reader keeps using a
+    // consistent version for as long as it holds it (refer to DynamicPropertySnapshot).
+    typedef OCIO_SHARED_PTR<const void> ConstVersionRcPtr;
+
+    // Return the version pinned by the calling thread if any, otherwise the last published
+    // one. Note that the references to the content of the version (e.g. getValue()) are only
+    // valid while the version is pinned or still the published one.
+    ConstVersionRcPtr loadVersion() const;
+    void publishVersion(const ConstVersionRcPtr & version);
+
+    // Build the version of the staged value, or return null if there is none.
+    virtual ConstVersionRcPtr prepareStagedValue() = 0;
+
     DynamicPropertyType m_type{ DYNAMIC_PROPERTY_EXPOSURE };
 
     bool m_isDynamic{ false };
+    bool m_updateInProgress{ false };
+
+private:
+    friend class DynamicPropertySnapshot;
+
+    ConstVersionRcPtr m_version;
+    ConstVersionRcPtr m_preparedVersion;
+};
+
+// Consistent set of versions of the dynamic properties. While a snapshot is pinned to a thread,
+// the renderers running on that thread read the values of the snapshot instead of the last
+// published ones, so all the ops and all the chunks of an apply call use the same values
+// whatever the concurrent updates.
+class DynamicPropertySnapshot
+{
+public:
+    DynamicPropertySnapshot() = default;
+    // Load the current version of each dynamic property.
+    explicit DynamicPropertySnapshot(const std::vector<DynamicPropertyImplRcPtr> & props);
+
+    // Replace the versions by the current ones, reusing the storage of the snapshot.
+    void load(const std::vector<DynamicPropertyImplRcPtr> & props);
+    // Release the versions but keep the storage for the next load().
+    void clear() noexcept { m_versions.clear(); }
+
+    class Pin
+    {
+    public:
+        Pin() = delete;
+        Pin(const Pin &) = delete;
+        Pin & operator=(const Pin &) = delete;
+
+        explicit Pin(const DynamicPropertySnapshot & snapshot) noexcept;
+        ~Pin();
+
+    private:
+        const DynamicPropertySnapshot * m_previous;
+    };
+
+private:
+    friend class DynamicPropertyImpl;
+
+    std::vector<std::pair<const DynamicPropertyImpl *,
+                          OCIO_SHARED_PTR<const void>>> m_versions;
 };
 
 bool operator==(const DynamicProperty &, const DynamicProperty &);
@@ -75,13 +154,16 @@ public:
     DynamicPropertyDoubleImpl() = delete;
     DynamicPropertyDoubleImpl(DynamicPropertyType type, double val, bool dynamic);
     ~DynamicPropertyDoubleImpl() = default;
-    double getValue() const override { return m_value; }
-    void setValue(double value) override { m_value = value; }
+    double getValue() const override;
+    void setValue(double value) override;
 
     DynamicPropertyDoubleImplRcPtr createEditableCopy() const;
 
 private:
-    double m_value;
+    ConstVersionRcPtr prepareStagedValue() override;
+
+    double m_stagedValue{ 0. };
+    bool m_hasStagedValue{ false };
 };
 
 class DynamicPropertyGradingPrimaryImpl;
@@ -104,34 +186,51 @@ public:
                                       bool dynamic);
     ~DynamicPropertyGradingPrimaryImpl() = default;
 
-    const GradingPrimary & getValue() const override { return m_value; }
+    GradingPrimary getValue() const override { return getVersion()->m_value; }
     void setValue(const GradingPrimary & value) override;
 
     void setStyle(GradingStyle style);
     void setDirection(TransformDirection dir) noexcept;
     TransformDirection getDirection() const noexcept { return m_direction; }
-    const GradingPrimaryPreRender & getComputedValue() const { return m_preRenderValues; }
+    // The renderers must only read the pre-render values through the returned pointer as a
+    // commit may concurrently replace them.
+    ConstGradingPrimaryPreRenderRcPtr getComputedValue() const;
 
-    const Float3 & getBrightness() const { return m_preRenderValues.getBrightness(); }
-    const Float3 & getContrast() const { return m_preRenderValues.getContrast(); }
-    const Float3 & getGamma() const { return m_preRenderValues.getGamma(); }
-    double getPivot() const { return m_preRenderValues.getPivot(); }
+    // The references are only valid while their version is pinned or still the published one
+    // (i.e. the Float3 uniforms of the GPU shader, read by the rendering thread).
+    const Float3 & getBrightness() const { return getComputedValue()->getBrightness(); }
+    const Float3 & getContrast() const { return getComputedValue()->getContrast(); }
+    const Float3 & getGamma() const { return getComputedValue()->getGamma(); }
+    double getPivot() const { return getComputedValue()->getPivot(); }
 
-    const Float3 & getExposure() const { return m_preRenderValues.getExposure(); }
-    const Float3 & getOffset() const { return m_preRenderValues.getOffset(); }
+    const Float3 & getExposure() const { return getComputedValue()->getExposure(); }
+    const Float3 & getOffset() const { return getComputedValue()->getOffset(); }
 
-    const Float3 & getSlope() const { return m_preRenderValues.getSlope(); }
+    const Float3 & getSlope() const { return getComputedValue()->getSlope(); }
 
     // Do not apply the op if all params are identity.
-    bool getLocalBypass() const { return m_preRenderValues.getLocalBypass(); }
+    bool getLocalBypass() const { return getComputedValue()->getLocalBypass(); }
 
     DynamicPropertyGradingPrimaryImplRcPtr createEditableCopy() const;
 
 private:
+    struct Version
+    {
+        Version(const GradingPrimary & value, const GradingPrimaryPreRender & preRender)
+            : m_value(value), m_preRender(preRender) {}
+
+        GradingPrimary m_value;
+        GradingPrimaryPreRender m_preRender;
+    };
+    typedef OCIO_SHARED_PTR<const Version> ConstVersionPtr;
+
+    ConstVersionPtr getVersion() const;
+    ConstVersionRcPtr makeVersion(const GradingPrimary & value) const;
+    ConstVersionRcPtr prepareStagedValue() override;
+
     GradingStyle m_style{ GRADING_LOG };
     TransformDirection m_direction{ TRANSFORM_DIR_FORWARD };
-    GradingPrimary m_value;
-    GradingPrimaryPreRender m_preRenderValues;
+    std::unique_ptr<GradingPrimary> m_stagedValue;
 };
 
 
@@ -145,19 +244,23 @@ public:
     DynamicPropertyGradingRGBCurveImpl() = delete;
     DynamicPropertyGradingRGBCurveImpl(const ConstGradingRGBCurveRcPtr & value, bool dynamic);
     ~DynamicPropertyGradingRGBCurveImpl() = default;
-    const ConstGradingRGBCurveRcPtr & getValue() const override;
+    ConstGradingRGBCurveRcPtr getValue() const override;
     void setValue(const ConstGradingRGBCurveRcPtr & value) override;
 
     bool getLocalBypass() const;
     int getNumKnots() const;
     int getNumCoefs() const;
     static int GetNumOffsetValues() { return 8; }  // offset and num vals for four curves
+    // The arrays are only valid while their version is pinned or still the published one
+    // (e.g. the uniforms of the GPU shader, read by the rendering thread).
     const int * getKnotsOffsetsArray() const;
     const int * getCoefsOffsetsArray() const;
     const float * getKnotsArray() const;
     const float * getCoefsArray() const;
 
-    const GradingBSplineCurveImpl::KnotsCoefs & getKnotsCoefs() const { return m_knotsCoefs; }
+    // The renderers must only read the knots & coefs through the returned pointer as a commit
+    // may concurrently replace them.
+    ConstKnotsCoefsRcPtr getKnotsCoefs() const;
 
     static unsigned int GetMaxKnots();
     static unsigned int GetMaxCoefs();
@@ -165,12 +268,24 @@ public:
     DynamicPropertyGradingRGBCurveImplRcPtr createEditableCopy() const;
 
 private:
-    void precompute();
+    struct Version
+    {
+        explicit Version(const ConstGradingRGBCurveRcPtr & value) : m_value(value) {}
+
+        ConstGradingRGBCurveRcPtr m_value;
+
+        // Holds curve data as knots and coefs. There are 4 curves.
+        GradingBSplineCurveImpl::KnotsCoefs m_knotsCoefs{ 4 };
+    };
+    typedef OCIO_SHARED_PTR<const Version> ConstVersionPtr;
 
-    ConstGradingRGBCurveRcPtr m_gradingRGBCurve;
+    // The readers hold the version for as long as they read it.
+    ConstVersionPtr getVersion() const;
+    // Convert control points from the UI into knots and coefficients for the apply.
+    static ConstVersionRcPtr MakeVersion(const ConstGradingRGBCurveRcPtr & value);
+    ConstVersionRcPtr prepareStagedValue() override;
 
-    // Holds curve data as knots and coefs. There are 4 curves.
-    GradingBSplineCurveImpl::KnotsCoefs m_knotsCoefs{ 4 };
+    ConstGradingRGBCurveRcPtr m_stagedValue;
 };
 
 class DynamicPropertyGradingHueCurveImpl;
@@ -183,19 +298,23 @@ public:
     DynamicPropertyGradingHueCurveImpl() = delete;
     DynamicPropertyGradingHueCurveImpl(const ConstGradingHueCurveRcPtr & value, bool dynamic);
     ~DynamicPropertyGradingHueCurveImpl() = default;
-    const ConstGradingHueCurveRcPtr & getValue() const override;
+    ConstGradingHueCurveRcPtr getValue() const override;
     void setValue(const ConstGradingHueCurveRcPtr & value) override;
 
     bool getLocalBypass() const;
     int getNumKnots() const;
     int getNumCoefs() const;
     static int GetNumOffsetValues() { return 16; }  // offset and num vals for eight curves
+    // The arrays are only valid while their version is pinned or still the published one
+    // (e.g. the uniforms of the GPU shader, read by the rendering thread).
     const int * getKnotsOffsetsArray() const;
     const int * getCoefsOffsetsArray() const;
     const float * getKnotsArray() const;
     const float * getCoefsArray() const;
 
-    const GradingBSplineCurveImpl::KnotsCoefs & getKnotsCoefs() const { return m_knotsCoefs; }
+    // The renderers must only read the knots & coefs through the returned pointer as a commit
+    // may concurrently replace them.
+    ConstKnotsCoefsRcPtr getKnotsCoefs() const;
 
     static unsigned int GetMaxKnots();
     static unsigned int GetMaxCoefs();
@@ -203,12 +322,24 @@ public:
     DynamicPropertyGradingHueCurveImplRcPtr createEditableCopy() const;
 
 private:
-    void precompute();
+    struct Version
+    {
+        explicit Version(const ConstGradingHueCurveRcPtr & value) : m_value(value) {}
+
+        ConstGradingHueCurveRcPtr m_value;
 
-    ConstGradingHueCurveRcPtr m_gradingHueCurve;
+        // Holds curve data as knots and coefs. There are 8 curves.
+        GradingBSplineCurveImpl::KnotsCoefs m_knotsCoefs{ 8 };
+    };
+    typedef OCIO_SHARED_PTR<const Version> ConstVersionPtr;
 
-    // Holds curve data as knots and coefs. There are 8 curves.
-    GradingBSplineCurveImpl::KnotsCoefs m_knotsCoefs{ 8 };
+    // The readers hold the version for as long as they read it.
+    ConstVersionPtr getVersion() const;
+    // Convert control points from the UI into knots and coefficients for the apply.
+    static ConstVersionRcPtr MakeVersion(const ConstGradingHueCurveRcPtr & value);
+    ConstVersionRcPtr prepareStagedValue() override;
+
+    ConstGradingHueCurveRcPtr m_stagedValue;
 };
 
 class DynamicPropertyGradingToneImpl;
@@ -226,20 +357,34 @@ public:
                                    bool dynamic);
     ~DynamicPropertyGradingToneImpl() = default;
 
-    const GradingTone & getValue() const override { return m_value; }
+    GradingTone getValue() const override { return getVersion()->m_value; }
     void setValue(const GradingTone & value) override;
 
     void setStyle(GradingStyle style);
-    const GradingTonePreRender & getComputedValue() const { return m_preRenderValues; }
+    // The renderers must only read the pre-render values through the returned pointer as a
+    // commit may concurrently replace them.
+    ConstGradingTonePreRenderRcPtr getComputedValue() const;
 
-    bool getLocalBypass() const { return m_preRenderValues.m_localBypass; }
+    bool getLocalBypass() const { return getComputedValue()->m_localBypass; }
 
     DynamicPropertyGradingToneImplRcPtr createEditableCopy() const;
 
 private:
+    struct Version
+    {
+        Version(const GradingTone & value, const GradingTonePreRender & preRender)
+            : m_value(value), m_preRender(preRender) {}
+
+        GradingTone m_value;
+        GradingTonePreRender m_preRender;
+    };
+    typedef OCIO_SHARED_PTR<const Version> ConstVersionPtr;
+
+    ConstVersionPtr getVersion() const;
+    ConstVersionRcPtr makeVersion(const GradingTone & value) const;
+    ConstVersionRcPtr prepareStagedValue() override;
 
-    GradingTone m_value;
-    GradingTonePreRender m_preRenderValues;
+    std::unique_ptr<GradingTone> m_stagedValue;
 };
 
 } // namespace OCIO_NAMESPACE
@@ -1,9 +1,6 @@
 // SPDX-License-Identifier: BSD-3-Clause
 // Copyright Contributors to the OpenColorIO Project.
 
-#include <sstream>
-#include <iomanip>
-
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "HashUtils.h"
@@ -17,36 +14,154 @@
 namespace OCIO_NAMESPACE
 {
 
-std::string CacheIDHash(const char * array, std::size_t size)
+namespace
+{
+
+static_assert(sizeof(XXH3_state_t) <= sizeof(CacheIDHasher),
+              "The storage of the xxHash state is too small.");
+
+static_assert(alignof(XXH3_state_t) <= alignof(CacheIDHasher),
+              "The storage of the xxHash state is not enough aligned.");
+
+constexpr char HexDigits[] = "0123456789abcdef";
+
+// Write the hexadecimal form of the value i.e. same as std::hex so without leading zeros, at the
+// end of the buffer and return the position of its first character.
+int FormatHex(char (&buffer)[16], uint64_t value)
 {
-    XXH128_hash_t hash = XXH3_128bits(array, size);
+    int pos = 16;
+    do
+    {
+        buffer[--pos] = HexDigits[value & 0xF];
+        value >>= 4;
+    }
+    while (value != 0);
 
-    std::stringstream oss;
-    oss << std::hex << hash.low64 << hash.high64;
-    return oss.str();
+    return pos;
 }
 
-std::string CacheIDHashUUID(const char * array, std::size_t size)
+void AppendHex(std::string & str, uint64_t value)
+{
+    char buffer[16];
+    const int pos = FormatHex(buffer, value);
+    str.append(buffer + pos, 16 - pos);
+}
+
+void WriteHex(std::ostream & os, uint64_t value)
+{
+    char buffer[16];
+    const int pos = FormatHex(buffer, value);
+    os.write(buffer + pos, 16 - pos);
+}
+
+// Append the zero-padded hexadecimal form of the requested digits of the value, starting from the
+// most significant one.
+void AppendPaddedHex(std::string & str, uint64_t value, int firstDigit, int numDigits)
 {
-    XXH128_hash_t hash = XXH3_128bits(array, size);
-
-    // Make sure that we have full, zero-padded 32 chars.
-    std::stringstream oss;
-    oss << std::hex << std::setfill('0');
-    oss << std::setw(16) << hash.high64;
-    oss << std::setw(16) << hash.low64;
-
-    // Format into 8-4-4-4-12 form.
-    std::string hex = oss.str();    
-    std::string uuid =
-        hex.substr(0, 8)  + "-" +
-        hex.substr(8, 4)  + "-" +
-        hex.substr(12, 4) + "-" +
-        hex.substr(16, 4) + "-" +
-        hex.substr(20, 12);
-    
+    for (int digit = firstDigit; digit < firstDigit + numDigits; ++digit)
+    {
+        str += HexDigits[(value >> (60 - 4 * digit)) & 0xF];
+    }
+}
+
+} // anonymous namespace
+
+std::string CacheIDDigest::toString() const
+{
+    std::string str;
+    str.reserve(32);
+    AppendHex(str, m_low);
+    AppendHex(str, m_high);
+    return str;
+}
+
+std::string CacheIDDigest::toUUID() const
+{
+    // Format into 8-4-4-4-12 form using the full, zero-padded 32 chars.
+    std::string uuid;
+    uuid.reserve(36);
+    AppendPaddedHex(uuid, m_high, 0, 8);
+    uuid += '-';
+    AppendPaddedHex(uuid, m_high, 8, 4);
+    uuid += '-';
+    AppendPaddedHex(uuid, m_high, 12, 4);
+    uuid += '-';
+    AppendPaddedHex(uuid, m_low, 0, 4);
+    uuid += '-';
+    AppendPaddedHex(uuid, m_low, 4, 12);
     return uuid;
 }
 
+std::ostream & operator<<(std::ostream & os, const CacheIDDigest & digest)
+{
+    WriteHex(os, digest.m_low);
+    WriteHex(os, digest.m_high);
+    return os;
+}
+
+CacheIDDigest CacheIDHashDigest(const void * data, std::size_t size)
+{
+    const XXH128_hash_t hash = XXH3_128bits(data, size);
+
+    CacheIDDigest digest;
+    digest.m_low  = hash.low64;
+    digest.m_high = hash.high64;
+    return digest;
+}
+
+std::string CacheIDHash(const char * array, std::size_t size)
+{
+    return CacheIDHashDigest(array, size).toString();
+}
+
+std::string CacheIDHashUUID(const char * array, std::size_t size)
+{
+    return CacheIDHashDigest(array, size).toUUID();
+}
+
+CacheIDHasher::CacheIDHasher() noexcept
+{
+    reset();
+}
+
+void CacheIDHasher::reset() noexcept
+{
+    XXH3_state_t * state = reinterpret_cast<XXH3_state_t *>(m_state);
+    XXH3_INITSTATE(state);
+    XXH3_128bits_reset(state);
+}
+
+CacheIDHasher & CacheIDHasher::update(const void * data, std::size_t size) noexcept
+{
+    XXH3_128bits_update(reinterpret_cast<XXH3_state_t *>(m_state), data, size);
+    return *this;
+}
+
+CacheIDDigest CacheIDHasher::digest() const noexcept
+{
+    const XXH128_hash_t hash
+        = XXH3_128bits_digest(reinterpret_cast<const XXH3_state_t *>(m_state));
+
+    CacheIDDigest digest;
+    digest.m_low  = hash.low64;
+    digest.m_high = hash.high64;
+    return digest;
+}
+
+CacheIDHashBuffer::int_type CacheIDHashBuffer::overflow(int_type ch)
+{
+    if (!traits_type::eq_int_type(ch, traits_type::eof()))
+    {
+        const char c = traits_type::to_char_type(ch);
+        m_hasher->update(&c, 1);
+    }
+    return traits_type::not_eof(ch);
+}
+
+std::streamsize CacheIDHashBuffer::xsputn(const char * s, std::streamsize n)
+{
+    m_hasher->update(s, static_cast<std::size_t>(n));
+    return n;
+}
 
 } // namespace OCIO_NAMESPACE
@@ -7,6 +7,10 @@
 
 #include <OpenColorIO/OpenColorIO.h>
 
+#include <cstdint>
+#include <functional>
+#include <ostream>
+#include <streambuf>
 #include <string>
 
 namespace OCIO_NAMESPACE
@@ -18,6 +22,115 @@ std::string CacheIDHash(const char * array, std::size_t size);
 // string.
 std::string CacheIDHashUUID(const char * array, std::size_t size);
 
+// A 128 bit digest to build & compare cache IDs without any heap allocation. The string forms
+// are only needed by the public API.
+struct CacheIDDigest
+{
+    uint64_t m_low  = 0;
+    uint64_t m_high = 0;
+
+    bool operator==(const CacheIDDigest & rhs) const noexcept
+    {
+        return m_low == rhs.m_low && m_high == rhs.m_high;
+    }
+    bool operator!=(const CacheIDDigest & rhs) const noexcept { return !(*this == rhs); }
+
+    // Same string form than CacheIDHash().
+    std::string toString() const;
+    // Same string form than CacheIDHashUUID().
+    std::string toUUID() const;
+};
+
+// Write the same string form than CacheIDDigest::toString() without any heap allocation.
+std::ostream & operator<<(std::ostream & os, const CacheIDDigest & digest);
+
+CacheIDDigest CacheIDHashDigest(const void * data, std::size_t size);
+
+// Incrementally compute the digest of a sequence of data i.e. the digest is identical to the one
+// of the concatenated data. Digests could be added to combine them (i.e. hash of hashes).
+class CacheIDHasher
+{
+public:
+    CacheIDHasher() noexcept;
+    ~CacheIDHasher() = default;
+
+    CacheIDHasher(const CacheIDHasher &) = delete;
+    CacheIDHasher & operator=(const CacheIDHasher &) = delete;
+
+    void reset() noexcept;
+
+    CacheIDHasher & update(const void * data, std::size_t size) noexcept;
+    CacheIDHasher & update(const std::string & str) noexcept
+    {
+        return update(str.c_str(), str.size());
+    }
+    CacheIDHasher & update(const CacheIDDigest & digest) noexcept
+    {
+        return update(&digest, sizeof(CacheIDDigest));
+    }
+
+    CacheIDDigest digest() const noexcept;
+
+private:
+    // Opaque storage for the xxHash streaming state to avoid any heap allocation.
+    alignas(64) unsigned char m_state[640];
+};
+
+// Stream buffer computing the digest of the written characters.
+class CacheIDHashBuffer : public std::streambuf
+{
+public:
+    CacheIDHashBuffer() = default;
+    // Update an existing hasher instead of its own one.
+    explicit CacheIDHashBuffer(CacheIDHasher & hasher) : m_hasher(&hasher) {}
+
+    CacheIDDigest digest() const noexcept { return m_hasher->digest(); }
+
+protected:
+    int_type overflow(int_type ch) override;
+    std::streamsize xsputn(const char * s, std::streamsize n) override;
+
+private:
+    CacheIDHasher m_ownHasher;
+    CacheIDHasher * m_hasher = &m_ownHasher;
+};
+
+// Output stream computing the digest of the streamed content instead of building a string (e.g.
+// to hash the serialization of a transform).
+class CacheIDHashStream : public std::ostream
+{
+public:
+    CacheIDHashStream() : std::ostream(nullptr) { rdbuf(&m_buffer); }
+    // Write the streamed content to an existing hasher (e.g. to add it to other data).
+    explicit CacheIDHashStream(CacheIDHasher & hasher)
+        :   std::ostream(nullptr)
+        ,   m_buffer(hasher)
+    {
+        rdbuf(&m_buffer);
+    }
+
+    CacheIDHashStream(const CacheIDHashStream &) = delete;
+    CacheIDHashStream & operator=(const CacheIDHashStream &) = delete;
+
+    CacheIDDigest digest() const noexcept { return m_buffer.digest(); }
+
+private:
+    CacheIDHashBuffer m_buffer;
+};
+
 } // namespace OCIO_NAMESPACE
 
+namespace std
+{
+template<>
+struct hash<OCIO_NAMESPACE::CacheIDDigest>
+{
+    size_t operator()(const OCIO_NAMESPACE::CacheIDDigest & digest) const noexcept
+    {
+        // The digest bits are already uniformly distributed.
+        return static_cast<size_t>(digest.m_low);
+    }
+};
+} // namespace std
+
 #endif
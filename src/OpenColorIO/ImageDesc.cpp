@@ -94,6 +94,8 @@ void GenericImageDesc::init(const ImageDesc & img, BitDepth bitDepth, const Cons
     {
         throw Exception("Bit-depth mismatch between the image buffer and the finalization setting.");
     }
+
+    InitPackingFuncs(*this, bitDepth);
 }
 
 bool GenericImageDesc::isPackedFloatRGBA() const
@@ -11,12 +11,147 @@
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "BitDepthUtils.h"
+#include "CPUInfo.h"
 #include "ImagePacking.h"
+#include "ImagePacking_SSE2.h"
 
 
 namespace OCIO_NAMESPACE
 {
 
+PackingLayout GetPackingLayout(const GenericImageDesc & img, BitDepth bitDepth)
+{
+    const ptrdiff_t valueSize = GetChannelSizeInBytes(bitDepth);
+
+    const char * r = img.m_rData;
+    const char * g = img.m_gData;
+    const char * b = img.m_bData;
+    const char * a = img.m_aData;
+
+    if (img.m_xStrideBytes == valueSize)
+    {
+        // Only planar images could have contiguous values for each channel.
+        return PACKING_LAYOUT_PLANAR;
+    }
+    else if (img.m_xStrideBytes == 3 * valueSize && !a)
+    {
+        if (g - r == valueSize && b - g == valueSize)
+        {
+            return PACKING_LAYOUT_RGB;
+        }
+        else if (g - b == valueSize && r - g == valueSize)
+        {
+            return PACKING_LAYOUT_BGR;
+        }
+    }
+    else if (img.m_xStrideBytes == 4 * valueSize && a)
+    {
+        if (g - b == valueSize && r - g == valueSize && a - r == valueSize)
+        {
+            return PACKING_LAYOUT_BGRA;
+        }
+        else if (b - a == valueSize && g - b == valueSize && r - g == valueSize)
+        {
+            return PACKING_LAYOUT_ABGR;
+        }
+    }
+
+    return PACKING_LAYOUT_OTHER;
+}
+
+void InitPackingFuncs(GenericImageDesc & img, BitDepth bitDepth)
+{
+    img.m_packFunc   = nullptr;
+    img.m_unpackFunc = nullptr;
+
+    // Note that the RGBA packed images do not need any packing.
+    if (img.m_isRGBAPacked)
+    {
+        return;
+    }
+
+    const PackingLayout layout = GetPackingLayout(img, bitDepth);
+    if (layout == PACKING_LAYOUT_OTHER)
+    {
+        return;
+    }
+
+#if OCIO_USE_SSE2
+    if (CPUInfo::instance().hasSSE2())
+    {
+        img.m_packFunc   = SSE2GetPackRGBAFunc(bitDepth, layout);
+        img.m_unpackFunc = SSE2GetUnpackRGBAFunc(bitDepth, layout);
+    }
+#endif
+}
+
+
+namespace
+{
+
+void PackPlanarFloat(const char * const channels[4], void * rgbaBuffer, long numPixels)
+{
+    const float * r = reinterpret_cast<const float *>(channels[0]);
+    const float * g = reinterpret_cast<const float *>(channels[1]);
+    const float * b = reinterpret_cast<const float *>(channels[2]);
+    const float * a = reinterpret_cast<const float *>(channels[3]);
+
+    float * out = static_cast<float *>(rgbaBuffer);
+
+    for (long idx = 0; idx < numPixels; ++idx)
+    {
+        out[4 * idx + 0] = r[idx];
+        out[4 * idx + 1] = g[idx];
+        out[4 * idx + 2] = b[idx];
+        out[4 * idx + 3] = a ? a[idx] : 1.0f;
+    }
+}
+
+void UnpackPlanarFloat(const void * rgbaBuffer, char * const channels[4], long numPixels)
+{
+    float * r = reinterpret_cast<float *>(channels[0]);
+    float * g = reinterpret_cast<float *>(channels[1]);
+    float * b = reinterpret_cast<float *>(channels[2]);
+    float * a = reinterpret_cast<float *>(channels[3]);
+
+    const float * in = static_cast<const float *>(rgbaBuffer);
+
+    for (long idx = 0; idx < numPixels; ++idx)
+    {
+        r[idx] = in[4 * idx + 0];
+        g[idx] = in[4 * idx + 1];
+        b[idx] = in[4 * idx + 2];
+        if (a)
+        {
+            a[idx] = in[4 * idx + 3];
+        }
+    }
+}
+
+} // anon.
+
+PackRGBAFunc * GetPlanarFloatPackFunc()
+{
+#if OCIO_USE_SSE2
+    if (CPUInfo::instance().hasSSE2())
+    {
+        return SSE2GetPackRGBAFunc(BIT_DEPTH_F32, PACKING_LAYOUT_PLANAR);
+    }
+#endif
+    return PackPlanarFloat;
+}
+
+UnpackRGBAFunc * GetPlanarFloatUnpackFunc()
+{
+#if OCIO_USE_SSE2
+    if (CPUInfo::instance().hasSSE2())
+    {
+        return SSE2GetUnpackRGBAFunc(BIT_DEPTH_F32, PACKING_LAYOUT_PLANAR);
+    }
+#endif
+    return UnpackPlanarFloat;
+}
+
 
 template<typename Type>
 void Generic<Type>::PackRGBAFromImageDesc(const GenericImageDesc & srcImg,
@@ -71,6 +206,13 @@ void Generic<Type>::PackRGBAFromImageDesc(const GenericImageDesc & srcImg,
 
     // Process one single, complete scanline.
     int pixelsCopied = 0;
+    if(srcImg.m_packFunc)
+    {
+        const char * channels[4] = { (char *)rPtr, (char *)gPtr, (char *)bPtr, (char *)aPtr };
+        srcImg.m_packFunc(channels, inBitDepthBuffer, outputBufferSize);
+        pixelsCopied = outputBufferSize;
+    }
+
     while(pixelsCopied < outputBufferSize)
     {     
         // Reorder channels from arbitrary channel ordering to RGBA 32-bit float.
@@ -142,6 +284,13 @@ void Generic<float>::PackRGBAFromImageDesc(const GenericImageDesc & srcImg,
 
     // Process one single, complete scanline.
     int pixelsCopied = 0;
+    if(srcImg.m_packFunc)
+    {
+        const char * channels[4] = { (char *)rPtr, (char *)gPtr, (char *)bPtr, (char *)aPtr };
+        srcImg.m_packFunc(channels, outputBuffer, outputBufferSize);
+        pixelsCopied = outputBufferSize;
+    }
+
     while(pixelsCopied < outputBufferSize)
     {
         // Reorder channels from arbitrary channel ordering to RGBA 32-bit float.
@@ -215,6 +364,13 @@ void Generic<Type>::UnpackRGBAToImageDesc(GenericImageDesc & dstImg,
 
     // Process one single, complete scanline.
     int pixelsCopied = 0;
+    if(dstImg.m_unpackFunc)
+    {
+        char * channels[4] = { (char *)rPtr, (char *)gPtr, (char *)bPtr, (char *)aPtr };
+        dstImg.m_unpackFunc(&outBitDepthBuffer[0], channels, numPixelsToUnpack);
+        pixelsCopied = numPixelsToUnpack;
+    }
+
     while(pixelsCopied < numPixelsToUnpack)
     {
         // Copy from RGBA buffer to arbitrary channel ordering.
@@ -285,6 +441,13 @@ void Generic<float>::UnpackRGBAToImageDesc(GenericImageDesc & dstImg,
 
     // Process one single, complete scanline.
     int pixelsCopied = 0;
+    if(dstImg.m_unpackFunc)
+    {
+        char * channels[4] = { (char *)rPtr, (char *)gPtr, (char *)bPtr, (char *)aPtr };
+        dstImg.m_unpackFunc(&inputBuffer[0], channels, numPixelsToUnpack);
+        pixelsCopied = numPixelsToUnpack;
+    }
+
     while(pixelsCopied < numPixelsToUnpack)
     {
         // Copy from RGBA buffer to arbitrary channel ordering.
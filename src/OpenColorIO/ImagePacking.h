@@ -13,6 +13,22 @@
 namespace OCIO_NAMESPACE
 {
 
+// The image layouts having vectorized packing functions.
+enum PackingLayout
+{
+    PACKING_LAYOUT_OTHER = 0,
+    PACKING_LAYOUT_RGB,     // Contiguous RGB channels.
+    PACKING_LAYOUT_BGR,     // Contiguous BGR channels.
+    PACKING_LAYOUT_BGRA,    // Contiguous BGRA channels.
+    PACKING_LAYOUT_ABGR,    // Contiguous ABGR channels.
+    PACKING_LAYOUT_PLANAR   // One contiguous plane per channel.
+};
+
+// Copy numPixels pixels from the image channels (i.e. R, G, B & A pointers with an optional
+// alpha) to a packed RGBA buffer of the same bit-depth, and back.
+typedef void (PackRGBAFunc)(const char * const channels[4], void * rgbaBuffer, long numPixels);
+typedef void (UnpackRGBAFunc)(const void * rgbaBuffer, char * const channels[4], long numPixels);
+
 struct GenericImageDesc
 {
     long m_width  = 0;
@@ -34,6 +50,10 @@ struct GenericImageDesc
     // Is the image buffer a 32-bit float image buffer?
     bool m_isFloat      = false;
 
+    // Vectorized packing functions for the image layout, if any.
+    PackRGBAFunc   * m_packFunc   = nullptr;
+    UnpackRGBAFunc * m_unpackFunc = nullptr;
+
 
     // Resolves all AutoStride.
     void init(const ImageDesc & img, BitDepth bitDepth, const ConstOpCPURcPtr & bitDepthOp);
@@ -46,6 +66,16 @@ struct GenericImageDesc
     bool isFloat() const;
 };
 
+// Find the layout of the image channels.
+PackingLayout GetPackingLayout(const GenericImageDesc & img, BitDepth bitDepth);
+
+// Select the vectorized packing functions matching the image layout & the CPU.
+void InitPackingFuncs(GenericImageDesc & img, BitDepth bitDepth);
+
+// Return the packing functions of 32-bit float planes (i.e. PACKING_LAYOUT_PLANAR) for the CPU.
+PackRGBAFunc * GetPlanarFloatPackFunc();
+UnpackRGBAFunc * GetPlanarFloatUnpackFunc();
+
 template<typename Type>
 struct Generic
 {
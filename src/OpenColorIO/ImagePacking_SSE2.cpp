@@ -0,0 +1,583 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include "ImagePacking_SSE2.h"
+
+#if OCIO_USE_SSE2
+
+#include <string.h>
+
+#include "SSE2.h"
+
+namespace OCIO_NAMESPACE
+{
+
+namespace {
+
+constexpr bool HasAlpha(PackingLayout layout)
+{
+    return layout == PACKING_LAYOUT_BGRA || layout == PACKING_LAYOUT_ABGR;
+}
+
+// Index (in the R, G, B & A channel pointers) of the first channel of a pixel.
+constexpr int FirstChannel(PackingLayout layout)
+{
+    return layout == PACKING_LAYOUT_RGB ? 0 : (layout == PACKING_LAYOUT_ABGR ? 3 : 2);
+}
+
+// Offset (in number of values) of a channel from the start of the pixel.
+constexpr long ChannelOffset(PackingLayout layout, int channel)
+{
+    return layout == PACKING_LAYOUT_RGB  ? channel
+         : layout == PACKING_LAYOUT_BGR  ? 2 - channel
+         : layout == PACKING_LAYOUT_BGRA ? (channel == 3 ? 3 : 2 - channel)
+         :                                 3 - channel;
+}
+
+// Store the 12 first bytes of the vector.
+static inline void Store12(void * dst, __m128i v)
+{
+    _mm_storel_epi64(static_cast<__m128i *>(dst), v);
+    const int last = _mm_cvtsi128_si32(_mm_srli_si128(v, 8));
+    memcpy(static_cast<char *>(dst) + 8, &last, sizeof(int));
+}
+
+// 8-bit integer values i.e. four RGBA pixels per vector.
+struct Values8
+{
+    typedef uint8_t Type;
+    static constexpr long NumPixels = 4;
+
+    // Move the four RGB triplets of the 12 first bytes to four RGB0 pixels.
+    static inline __m128i Expand(__m128i v)
+    {
+        const __m128i m0 = _mm_set_epi32(0, 0, 0, 0x00FFFFFF);
+        const __m128i m1 = _mm_set_epi32(0, 0, 0x00FFFFFF, 0);
+        const __m128i m2 = _mm_set_epi32(0, 0x00FFFFFF, 0, 0);
+        const __m128i m3 = _mm_set_epi32(0x00FFFFFF, 0, 0, 0);
+
+        return _mm_or_si128(_mm_or_si128(_mm_and_si128(v, m0),
+                                         _mm_and_si128(_mm_slli_si128(v, 1), m1)),
+                            _mm_or_si128(_mm_and_si128(_mm_slli_si128(v, 2), m2),
+                                         _mm_and_si128(_mm_slli_si128(v, 3), m3)));
+    }
+
+    // Move the RGB values of the four RGBA pixels to the 12 first bytes.
+    static inline __m128i Compress(__m128i v)
+    {
+        const __m128i m0 = _mm_set_epi32(0, 0, 0, 0x00FFFFFF);
+        const __m128i m1 = _mm_set_epi32(0, 0, 0x0000FFFF, (int)0xFF000000);
+        const __m128i m2 = _mm_set_epi32(0, 0x000000FF, (int)0xFFFF0000, 0);
+        const __m128i m3 = _mm_set_epi32(0, (int)0xFFFFFF00, 0, 0);
+
+        return _mm_or_si128(_mm_or_si128(_mm_and_si128(v, m0),
+                                         _mm_and_si128(_mm_srli_si128(v, 1), m1)),
+                            _mm_or_si128(_mm_and_si128(_mm_srli_si128(v, 2), m2),
+                                         _mm_and_si128(_mm_srli_si128(v, 3), m3)));
+    }
+
+    // Swap the first and third channels i.e. BGRA <-> RGBA.
+    static inline __m128i SwapRB(__m128i v)
+    {
+        const __m128i ga = _mm_and_si128(v, _mm_set1_epi32((int)0xFF00FF00));
+        const __m128i rb = _mm_and_si128(v, _mm_set1_epi32(0x00FF00FF));
+
+        return _mm_or_si128(ga, _mm_or_si128(_mm_slli_epi32(rb, 16), _mm_srli_epi32(rb, 16)));
+    }
+
+    // Reverse the channel order i.e. ABGR <-> RGBA.
+    static inline __m128i Reverse(__m128i v)
+    {
+        v = _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+        v = _mm_shufflelo_epi16(v, _MM_SHUFFLE(2, 3, 0, 1));
+        return _mm_shufflehi_epi16(v, _MM_SHUFFLE(2, 3, 0, 1));
+    }
+
+    static inline __m128i Alpha(unsigned alpha)
+    {
+        return _mm_set1_epi32((int)(alpha << 24));
+    }
+};
+
+// 16-bit integer or half float values i.e. two RGBA pixels per vector.
+struct Values16
+{
+    typedef uint16_t Type;
+    static constexpr long NumPixels = 2;
+
+    // Move the two RGB triplets of the 12 first bytes to two RGB0 pixels.
+    static inline __m128i Expand(__m128i v)
+    {
+        const __m128i m0 = _mm_set_epi32(0, 0, 0x0000FFFF, -1);
+        const __m128i m1 = _mm_set_epi32(0x0000FFFF, -1, 0, 0);
+
+        return _mm_or_si128(_mm_and_si128(v, m0), _mm_and_si128(_mm_slli_si128(v, 2), m1));
+    }
+
+    // Move the RGB values of the two RGBA pixels to the 12 first bytes.
+    static inline __m128i Compress(__m128i v)
+    {
+        const __m128i m0 = _mm_set_epi32(0, 0, 0x0000FFFF, -1);
+        const __m128i m1 = _mm_set_epi32(0, -1, (int)0xFFFF0000, 0);
+
+        return _mm_or_si128(_mm_and_si128(v, m0), _mm_and_si128(_mm_srli_si128(v, 2), m1));
+    }
+
+    // Swap the first and third channels i.e. BGRA <-> RGBA.
+    static inline __m128i SwapRB(__m128i v)
+    {
+        v = _mm_shufflelo_epi16(v, _MM_SHUFFLE(3, 0, 1, 2));
+        return _mm_shufflehi_epi16(v, _MM_SHUFFLE(3, 0, 1, 2));
+    }
+
+    // Reverse the channel order i.e. ABGR <-> RGBA.
+    static inline __m128i Reverse(__m128i v)
+    {
+        v = _mm_shufflelo_epi16(v, _MM_SHUFFLE(0, 1, 2, 3));
+        return _mm_shufflehi_epi16(v, _MM_SHUFFLE(0, 1, 2, 3));
+    }
+
+    static inline __m128i Alpha(unsigned alpha)
+    {
+        return _mm_set_epi16((short)alpha, 0, 0, 0, (short)alpha, 0, 0, 0);
+    }
+};
+
+// Note that all the reorderings are their own inverse.
+template<typename V, PackingLayout layout>
+inline __m128i Reorder(__m128i v)
+{
+    if (layout == PACKING_LAYOUT_BGR || layout == PACKING_LAYOUT_BGRA)
+    {
+        return V::SwapRB(v);
+    }
+    else if (layout == PACKING_LAYOUT_ABGR)
+    {
+        return V::Reverse(v);
+    }
+
+    return v;
+}
+
+template<typename V, PackingLayout layout, unsigned alpha>
+void PackInterleaved(const char * const channels[4], void * rgbaBuffer, long numPixels)
+{
+    typedef typename V::Type Type;
+
+    constexpr long numChannels = HasAlpha(layout) ? 4 : 3;
+
+    // A vector load of RGB pixels reads the values of the next pixels, so stop early enough
+    // to never read past the end of the line.
+    constexpr long numValues = 16 / sizeof(Type);
+    constexpr long numLoadedPixels = numChannels == 4 ? V::NumPixels : (numValues + 2) / 3;
+
+    const Type * in = reinterpret_cast<const Type *>(channels[FirstChannel(layout)]);
+    Type * out = static_cast<Type *>(rgbaBuffer);
+
+    const __m128i alphaValue = V::Alpha(alpha);
+
+    long idx = 0;
+    for (; idx + numLoadedPixels <= numPixels; idx += V::NumPixels)
+    {
+        __m128i pixels = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + numChannels * idx));
+
+        if (numChannels == 3)
+        {
+            pixels = _mm_or_si128(Reorder<V, layout>(V::Expand(pixels)), alphaValue);
+        }
+        else
+        {
+            pixels = Reorder<V, layout>(pixels);
+        }
+
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out + 4 * idx), pixels);
+    }
+
+    for (; idx < numPixels; ++idx)
+    {
+        const Type * pixel = in + numChannels * idx;
+
+        out[4 * idx + 0] = pixel[ChannelOffset(layout, 0)];
+        out[4 * idx + 1] = pixel[ChannelOffset(layout, 1)];
+        out[4 * idx + 2] = pixel[ChannelOffset(layout, 2)];
+        out[4 * idx + 3] = numChannels == 4 ? pixel[ChannelOffset(layout, 3)] : (Type)alpha;
+    }
+}
+
+template<typename V, PackingLayout layout>
+void UnpackInterleaved(const void * rgbaBuffer, char * const channels[4], long numPixels)
+{
+    typedef typename V::Type Type;
+
+    constexpr long numChannels = HasAlpha(layout) ? 4 : 3;
+
+    const Type * in = static_cast<const Type *>(rgbaBuffer);
+    Type * out = reinterpret_cast<Type *>(channels[FirstChannel(layout)]);
+
+    long idx = 0;
+    for (; idx + V::NumPixels <= numPixels; idx += V::NumPixels)
+    {
+        __m128i pixels = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + 4 * idx));
+        pixels = Reorder<V, layout>(pixels);
+
+        if (numChannels == 3)
+        {
+            Store12(out + numChannels * idx, V::Compress(pixels));
+        }
+        else
+        {
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(out + numChannels * idx), pixels);
+        }
+    }
+
+    for (; idx < numPixels; ++idx)
+    {
+        Type * pixel = out + numChannels * idx;
+
+        pixel[ChannelOffset(layout, 0)] = in[4 * idx + 0];
+        pixel[ChannelOffset(layout, 1)] = in[4 * idx + 1];
+        pixel[ChannelOffset(layout, 2)] = in[4 * idx + 2];
+        if (numChannels == 4)
+        {
+            pixel[ChannelOffset(layout, 3)] = in[4 * idx + 3];
+        }
+    }
+}
+
+template<PackingLayout layout>
+inline __m128 ReorderFloat(__m128 v)
+{
+    if (layout == PACKING_LAYOUT_BGR || layout == PACKING_LAYOUT_BGRA)
+    {
+        return _mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 0, 1, 2));
+    }
+    else if (layout == PACKING_LAYOUT_ABGR)
+    {
+        return _mm_shuffle_ps(v, v, _MM_SHUFFLE(0, 1, 2, 3));
+    }
+
+    return v;
+}
+
+template<PackingLayout layout>
+void PackInterleavedFloat(const char * const channels[4], void * rgbaBuffer, long numPixels)
+{
+    constexpr long numChannels = HasAlpha(layout) ? 4 : 3;
+
+    const float * in = reinterpret_cast<const float *>(channels[FirstChannel(layout)]);
+    float * out = static_cast<float *>(rgbaBuffer);
+
+    long idx = 0;
+    if (numChannels == 4)
+    {
+        for (; idx < numPixels; ++idx)
+        {
+            const __m128 pixel = _mm_loadu_ps(in + 4 * idx);
+            _mm_storeu_ps(out + 4 * idx, ReorderFloat<layout>(pixel));
+        }
+    }
+    else
+    {
+        const __m128 rgbMask = _mm_castsi128_ps(_mm_set_epi32(0, -1, -1, -1));
+        const __m128 alpha   = _mm_set_ps(1.0f, 0.0f, 0.0f, 0.0f);
+
+        for (; idx + 4 <= numPixels; idx += 4)
+        {
+            // The four RGB triplets are in three vectors.
+            const __m128 a = _mm_loadu_ps(in + 3 * idx);
+            const __m128 b = _mm_loadu_ps(in + 3 * idx + 4);
+            const __m128 c = _mm_loadu_ps(in + 3 * idx + 8);
+
+            const __m128 ab = _mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 3, 3));
+
+            __m128 p0 = a;
+            __m128 p1 = _mm_shuffle_ps(ab, b, _MM_SHUFFLE(1, 1, 2, 0));
+            __m128 p2 = _mm_shuffle_ps(b, c, _MM_SHUFFLE(0, 0, 3, 2));
+            __m128 p3 = _mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 3, 2, 1));
+
+            p0 = _mm_or_ps(_mm_and_ps(ReorderFloat<layout>(p0), rgbMask), alpha);
+            p1 = _mm_or_ps(_mm_and_ps(ReorderFloat<layout>(p1), rgbMask), alpha);
+            p2 = _mm_or_ps(_mm_and_ps(ReorderFloat<layout>(p2), rgbMask), alpha);
+            p3 = _mm_or_ps(_mm_and_ps(ReorderFloat<layout>(p3), rgbMask), alpha);
+
+            _mm_storeu_ps(out + 4 * idx,      p0);
+            _mm_storeu_ps(out + 4 * idx + 4,  p1);
+            _mm_storeu_ps(out + 4 * idx + 8,  p2);
+            _mm_storeu_ps(out + 4 * idx + 12, p3);
+        }
+
+        for (; idx < numPixels; ++idx)
+        {
+            const float * pixel = in + 3 * idx;
+
+            out[4 * idx + 0] = pixel[ChannelOffset(layout, 0)];
+            out[4 * idx + 1] = pixel[ChannelOffset(layout, 1)];
+            out[4 * idx + 2] = pixel[ChannelOffset(layout, 2)];
+            out[4 * idx + 3] = 1.0f;
+        }
+    }
+}
+
+template<PackingLayout layout>
+void UnpackInterleavedFloat(const void * rgbaBuffer, char * const channels[4], long numPixels)
+{
+    constexpr long numChannels = HasAlpha(layout) ? 4 : 3;
+
+    const float * in = static_cast<const float *>(rgbaBuffer);
+    float * out = reinterpret_cast<float *>(channels[FirstChannel(layout)]);
+
+    long idx = 0;
+    if (numChannels == 4)
+    {
+        for (; idx < numPixels; ++idx)
+        {
+            const __m128 pixel = _mm_loadu_ps(in + 4 * idx);
+            _mm_storeu_ps(out + 4 * idx, ReorderFloat<layout>(pixel));
+        }
+    }
+    else
+    {
+        for (; idx + 4 <= numPixels; idx += 4)
+        {
+            const __m128 p0 = ReorderFloat<layout>(_mm_loadu_ps(in + 4 * idx));
+            const __m128 p1 = ReorderFloat<layout>(_mm_loadu_ps(in + 4 * idx + 4));
+            const __m128 p2 = ReorderFloat<layout>(_mm_loadu_ps(in + 4 * idx + 8));
+            const __m128 p3 = ReorderFloat<layout>(_mm_loadu_ps(in + 4 * idx + 12));
+
+            // Move the four RGB triplets to three vectors.
+            const __m128 p01 = _mm_shuffle_ps(p0, p1, _MM_SHUFFLE(0, 0, 2, 2));
+            const __m128 p23 = _mm_shuffle_ps(p2, p3, _MM_SHUFFLE(0, 0, 2, 2));
+
+            _mm_storeu_ps(out + 3 * idx,     _mm_shuffle_ps(p0, p01, _MM_SHUFFLE(2, 0, 1, 0)));
+            _mm_storeu_ps(out + 3 * idx + 4, _mm_shuffle_ps(p1, p2, _MM_SHUFFLE(1, 0, 2, 1)));
+            _mm_storeu_ps(out + 3 * idx + 8, _mm_shuffle_ps(p23, p3, _MM_SHUFFLE(2, 1, 2, 0)));
+        }
+
+        for (; idx < numPixels; ++idx)
+        {
+            float * pixel = out + 3 * idx;
+
+            pixel[ChannelOffset(layout, 0)] = in[4 * idx + 0];
+            pixel[ChannelOffset(layout, 1)] = in[4 * idx + 1];
+            pixel[ChannelOffset(layout, 2)] = in[4 * idx + 2];
+        }
+    }
+}
+
+void PackPlanarFloat(const char * const channels[4], void * rgbaBuffer, long numPixels)
+{
+    const float * r = reinterpret_cast<const float *>(channels[0]);
+    const float * g = reinterpret_cast<const float *>(channels[1]);
+    const float * b = reinterpret_cast<const float *>(channels[2]);
+    const float * a = reinterpret_cast<const float *>(channels[3]);
+
+    float * out = static_cast<float *>(rgbaBuffer);
+
+    const __m128 alpha = _mm_set1_ps(1.0f);
+
+    long idx = 0;
+    for (; idx + 4 <= numPixels; idx += 4)
+    {
+        __m128 p0 = _mm_loadu_ps(r + idx);
+        __m128 p1 = _mm_loadu_ps(g + idx);
+        __m128 p2 = _mm_loadu_ps(b + idx);
+        __m128 p3 = a ? _mm_loadu_ps(a + idx) : alpha;
+
+        _MM_TRANSPOSE4_PS(p0, p1, p2, p3);
+
+        _mm_storeu_ps(out + 4 * idx,      p0);
+        _mm_storeu_ps(out + 4 * idx + 4,  p1);
+        _mm_storeu_ps(out + 4 * idx + 8,  p2);
+        _mm_storeu_ps(out + 4 * idx + 12, p3);
+    }
+
+    for (; idx < numPixels; ++idx)
+    {
+        out[4 * idx + 0] = r[idx];
+        out[4 * idx + 1] = g[idx];
+        out[4 * idx + 2] = b[idx];
+        out[4 * idx + 3] = a ? a[idx] : 1.0f;
+    }
+}
+
+void UnpackPlanarFloat(const void * rgbaBuffer, char * const channels[4], long numPixels)
+{
+    float * r = reinterpret_cast<float *>(channels[0]);
+    float * g = reinterpret_cast<float *>(channels[1]);
+    float * b = reinterpret_cast<float *>(channels[2]);
+    float * a = reinterpret_cast<float *>(channels[3]);
+
+    const float * in = static_cast<const float *>(rgbaBuffer);
+
+    long idx = 0;
+    for (; idx + 4 <= numPixels; idx += 4)
+    {
+        __m128 p0 = _mm_loadu_ps(in + 4 * idx);
+        __m128 p1 = _mm_loadu_ps(in + 4 * idx + 4);
+        __m128 p2 = _mm_loadu_ps(in + 4 * idx + 8);
+        __m128 p3 = _mm_loadu_ps(in + 4 * idx + 12);
+
+        _MM_TRANSPOSE4_PS(p0, p1, p2, p3);
+
+        _mm_storeu_ps(r + idx, p0);
+        _mm_storeu_ps(g + idx, p1);
+        _mm_storeu_ps(b + idx, p2);
+        if (a)
+        {
+            _mm_storeu_ps(a + idx, p3);
+        }
+    }
+
+    for (; idx < numPixels; ++idx)
+    {
+        r[idx] = in[4 * idx + 0];
+        g[idx] = in[4 * idx + 1];
+        b[idx] = in[4 * idx + 2];
+        if (a)
+        {
+            a[idx] = in[4 * idx + 3];
+        }
+    }
+}
+
+template<typename V, unsigned alpha>
+PackRGBAFunc * GetPackInterleavedFunc(PackingLayout layout)
+{
+    switch (layout)
+    {
+        case PACKING_LAYOUT_RGB:
+            return PackInterleaved<V, PACKING_LAYOUT_RGB, alpha>;
+        case PACKING_LAYOUT_BGR:
+            return PackInterleaved<V, PACKING_LAYOUT_BGR, alpha>;
+        case PACKING_LAYOUT_BGRA:
+            return PackInterleaved<V, PACKING_LAYOUT_BGRA, alpha>;
+        case PACKING_LAYOUT_ABGR:
+            return PackInterleaved<V, PACKING_LAYOUT_ABGR, alpha>;
+        case PACKING_LAYOUT_PLANAR:
+        case PACKING_LAYOUT_OTHER:
+            break;
+    }
+
+    return nullptr;
+}
+
+template<typename V>
+UnpackRGBAFunc * GetUnpackInterleavedFunc(PackingLayout layout)
+{
+    switch (layout)
+    {
+        case PACKING_LAYOUT_RGB:
+            return UnpackInterleaved<V, PACKING_LAYOUT_RGB>;
+        case PACKING_LAYOUT_BGR:
+            return UnpackInterleaved<V, PACKING_LAYOUT_BGR>;
+        case PACKING_LAYOUT_BGRA:
+            return UnpackInterleaved<V, PACKING_LAYOUT_BGRA>;
+        case PACKING_LAYOUT_ABGR:
+            return UnpackInterleaved<V, PACKING_LAYOUT_ABGR>;
+        case PACKING_LAYOUT_PLANAR:
+        case PACKING_LAYOUT_OTHER:
+            break;
+    }
+
+    return nullptr;
+}
+
+PackRGBAFunc * GetPackFloatFunc(PackingLayout layout)
+{
+    switch (layout)
+    {
+        case PACKING_LAYOUT_RGB:
+            return PackInterleavedFloat<PACKING_LAYOUT_RGB>;
+        case PACKING_LAYOUT_BGR:
+            return PackInterleavedFloat<PACKING_LAYOUT_BGR>;
+        case PACKING_LAYOUT_BGRA:
+            return PackInterleavedFloat<PACKING_LAYOUT_BGRA>;
+        case PACKING_LAYOUT_ABGR:
+            return PackInterleavedFloat<PACKING_LAYOUT_ABGR>;
+        case PACKING_LAYOUT_PLANAR:
+            return PackPlanarFloat;
+        case PACKING_LAYOUT_OTHER:
+            break;
+    }
+
+    return nullptr;
+}
+
+UnpackRGBAFunc * GetUnpackFloatFunc(PackingLayout layout)
+{
+    switch (layout)
+    {
+        case PACKING_LAYOUT_RGB:
+            return UnpackInterleavedFloat<PACKING_LAYOUT_RGB>;
+        case PACKING_LAYOUT_BGR:
+            return UnpackInterleavedFloat<PACKING_LAYOUT_BGR>;
+        case PACKING_LAYOUT_BGRA:
+            return UnpackInterleavedFloat<PACKING_LAYOUT_BGRA>;
+        case PACKING_LAYOUT_ABGR:
+            return UnpackInterleavedFloat<PACKING_LAYOUT_ABGR>;
+        case PACKING_LAYOUT_PLANAR:
+            return UnpackPlanarFloat;
+        case PACKING_LAYOUT_OTHER:
+            break;
+    }
+
+    return nullptr;
+}
+
+// The bit pattern of 1.0 in half float i.e. the default alpha value.
+constexpr unsigned HalfOne = 0x3C00;
+
+} // anonymous namespace
+
+PackRGBAFunc * SSE2GetPackRGBAFunc(BitDepth bitDepth, PackingLayout layout)
+{
+    switch (bitDepth)
+    {
+        case BIT_DEPTH_UINT8:
+            return GetPackInterleavedFunc<Values8, BitDepthInfo<BIT_DEPTH_UINT8>::maxValue>(layout);
+        case BIT_DEPTH_UINT10:
+            return GetPackInterleavedFunc<Values16, BitDepthInfo<BIT_DEPTH_UINT10>::maxValue>(layout);
+        case BIT_DEPTH_UINT12:
+            return GetPackInterleavedFunc<Values16, BitDepthInfo<BIT_DEPTH_UINT12>::maxValue>(layout);
+        case BIT_DEPTH_UINT16:
+            return GetPackInterleavedFunc<Values16, BitDepthInfo<BIT_DEPTH_UINT16>::maxValue>(layout);
+        case BIT_DEPTH_F16:
+            return GetPackInterleavedFunc<Values16, HalfOne>(layout);
+        case BIT_DEPTH_F32:
+            return GetPackFloatFunc(layout);
+        case BIT_DEPTH_UINT14:
+        case BIT_DEPTH_UINT32:
+        case BIT_DEPTH_UNKNOWN:
+        default:
+            break;
+    }
+
+    return nullptr;
+}
+
+UnpackRGBAFunc * SSE2GetUnpackRGBAFunc(BitDepth bitDepth, PackingLayout layout)
+{
+    switch (bitDepth)
+    {
+        case BIT_DEPTH_UINT8:
+            return GetUnpackInterleavedFunc<Values8>(layout);
+        case BIT_DEPTH_UINT10:
+        case BIT_DEPTH_UINT12:
+        case BIT_DEPTH_UINT16:
+        case BIT_DEPTH_F16:
+            return GetUnpackInterleavedFunc<Values16>(layout);
+        case BIT_DEPTH_F32:
+            return GetUnpackFloatFunc(layout);
+        case BIT_DEPTH_UINT14:
+        case BIT_DEPTH_UINT32:
+        case BIT_DEPTH_UNKNOWN:
+        default:
+            break;
+    }
+
+    return nullptr;
+}
+
+} // OCIO_NAMESPACE
+
+#endif // OCIO_USE_SSE2
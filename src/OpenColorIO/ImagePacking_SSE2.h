@@ -0,0 +1,24 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#ifndef INCLUDED_OCIO_IMAGEPACKING_SSE2_H
+#define INCLUDED_OCIO_IMAGEPACKING_SSE2_H
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "CPUInfo.h"
+#include "ImagePacking.h"
+
+#if OCIO_USE_SSE2
+namespace OCIO_NAMESPACE
+{
+
+// Return nullptr when the bit-depth & layout pair has no SSE2 implementation.
+PackRGBAFunc * SSE2GetPackRGBAFunc(BitDepth bitDepth, PackingLayout layout);
+UnpackRGBAFunc * SSE2GetUnpackRGBAFunc(BitDepth bitDepth, PackingLayout layout);
+
+} // namespace OCIO_NAMESPACE
+
+#endif // OCIO_USE_SSE2
+
+#endif /* INCLUDED_OCIO_IMAGEPACKING_SSE2_H */
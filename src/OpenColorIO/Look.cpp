@@ -9,6 +9,7 @@
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "ContextVariableUtils.h"
+#include "Look.h"
 #include "utils/StringUtils.h"
 
 namespace
@@ -29,44 +30,6 @@ void Look::deleter(Look* c)
     delete c;
 }
 
-class Look::Impl
-{
-public:
-    std::string m_name;
-    std::string m_processSpace;
-    std::string m_description;
-    std::map<std::string, std::string> m_interchangeAttribs;
-    TransformRcPtr m_transform;
-    TransformRcPtr m_inverseTransform;
-
-    Impl()
-    { }
-
-    Impl(const Impl &) = delete;
-
-    ~Impl()
-    { }
-
-    Impl& operator= (const Impl & rhs)
-    {
-        if (this != &rhs)
-        {
-            m_name = rhs.m_name;
-            m_processSpace = rhs.m_processSpace;
-            m_description = rhs.m_description;
-
-            m_interchangeAttribs = rhs.m_interchangeAttribs;
-
-            m_transform = rhs.m_transform?
-                rhs.m_transform->createEditableCopy() : rhs.m_transform;
-
-            m_inverseTransform = rhs.m_inverseTransform?
-                rhs.m_inverseTransform->createEditableCopy()
-                : rhs.m_inverseTransform;
-        }
-        return *this;
-    }
-};
 
 ///////////////////////////////////////////////////////////////////////////
 
@@ -110,22 +73,39 @@ void Look::setProcessSpace(const char * processSpace)
 
 ConstTransformRcPtr Look::getTransform() const
 {
-    return getImpl()->m_transform;
+    return ResolveTransform(getImpl()->m_deferred, getImpl()->m_transform);
 }
 
 void Look::setTransform(const ConstTransformRcPtr & transform)
 {
     getImpl()->m_transform = transform->createEditableCopy();
+    getImpl()->m_deferred  = nullptr;
 }
 
 ConstTransformRcPtr Look::getInverseTransform() const
 {
-    return getImpl()->m_inverseTransform;
+    return ResolveTransform(getImpl()->m_inverseDeferred, getImpl()->m_inverseTransform);
 }
 
 void Look::setInverseTransform(const ConstTransformRcPtr & transform)
 {
     getImpl()->m_inverseTransform = transform->createEditableCopy();
+    getImpl()->m_inverseDeferred  = nullptr;
+}
+
+void Look::Impl::setDeferred(TransformDirection dir, const DeferredTransformRcPtr & transform)
+{
+    switch (dir)
+    {
+    case TRANSFORM_DIR_FORWARD:
+        m_transform = nullptr;
+        m_deferred  = transform;
+        break;
+    case TRANSFORM_DIR_INVERSE:
+        m_inverseTransform = nullptr;
+        m_inverseDeferred  = transform;
+        break;
+    }
 }
 
 const char * Look::getDescription() const
@@ -287,16 +267,29 @@ std::ostream& operator<< (std::ostream& os, const Look& look)
         os << ", " << attr.first << "=" << attr.second;
     }
 
-    if(look.getTransform())
+    // The transforms of a lazily loaded config could fail to parse, print the error instead.
+    ConstTransformRcPtr transform, inverseTransform;
+    try
+    {
+        transform        = look.getTransform();
+        inverseTransform = look.getInverseTransform();
+    }
+    catch (const Exception & e)
+    {
+        os << ", error=" << e.what() << ">";
+        return os;
+    }
+
+    if(transform)
     {
         os << ",\n    transform=";
-        os << "\n        " << *look.getTransform();
+        os << "\n        " << *transform;
     }
 
-    if(look.getInverseTransform())
+    if(inverseTransform)
     {
         os << ",\n    inverseTransform=";
-        os << "\n        " << *look.getInverseTransform();
+        os << "\n        " << *inverseTransform;
     }
 
     os << ">";
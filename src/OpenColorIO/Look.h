@@ -0,0 +1,70 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#ifndef INCLUDED_OCIO_LOOK_H
+#define INCLUDED_OCIO_LOOK_H
+
+#include <map>
+#include <string>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "DeferredTransform.h"
+
+
+namespace OCIO_NAMESPACE
+{
+
+class Look::Impl
+{
+public:
+    std::string m_name;
+    std::string m_processSpace;
+    std::string m_description;
+    std::map<std::string, std::string> m_interchangeAttribs;
+    TransformRcPtr m_transform;
+    TransformRcPtr m_inverseTransform;
+
+    // Only used by a lazy config loading, they supersede the transforms.
+    DeferredTransformRcPtr m_deferred;
+    DeferredTransformRcPtr m_inverseDeferred;
+
+    Impl()
+    { }
+
+    Impl(const Impl &) = delete;
+
+    ~Impl()
+    { }
+
+    Impl& operator= (const Impl & rhs)
+    {
+        if (this != &rhs)
+        {
+            m_name = rhs.m_name;
+            m_processSpace = rhs.m_processSpace;
+            m_description = rhs.m_description;
+
+            m_interchangeAttribs = rhs.m_interchangeAttribs;
+
+            m_transform = rhs.m_transform?
+                rhs.m_transform->createEditableCopy() : rhs.m_transform;
+
+            m_inverseTransform = rhs.m_inverseTransform?
+                rhs.m_inverseTransform->createEditableCopy()
+                : rhs.m_inverseTransform;
+
+            m_deferred        = rhs.m_deferred;
+            m_inverseDeferred = rhs.m_inverseDeferred;
+        }
+        return *this;
+    }
+
+    // Attach a deferred transform i.e. it replaces the transform for that direction.
+    void setDeferred(TransformDirection dir, const DeferredTransformRcPtr & transform);
+};
+
+} // namespace OCIO_NAMESPACE
+
+#endif // INCLUDED_OCIO_LOOK_H
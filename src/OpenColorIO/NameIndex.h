@@ -0,0 +1,116 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#ifndef INCLUDED_OCIO_NAMEINDEX_H
+#define INCLUDED_OCIO_NAMEINDEX_H
+
+
+#include <string>
+#include <unordered_map>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "utils/StringUtils.h"
+
+
+namespace OCIO_NAMESPACE
+{
+
+// Case insensitive index of the names (and aliases) of the elements of a collection (e.g. the
+// color spaces of a ColorSpaceSet) giving the position of the element in its collection.
+//
+// The index is owned by the collection which must keep it in sync with its elements. Adding an
+// element at the end is cheap, any other change (i.e. replacement, removal) must rebuild the
+// index as the positions might have changed.
+//
+// Note that the first element using a name wins, so the index always finds the same element
+// as the linear search over the names and the aliases of the collection it replaces.
+class NameIndex
+{
+public:
+    static constexpr size_t npos = static_cast<size_t>(-1);
+
+    NameIndex() = default;
+    ~NameIndex() = default;
+
+    // Return the position of the element using the name (as a name or as an alias), or npos.
+    size_t find(const char * name) const
+    {
+        if (!name || !*name || m_index.empty())
+        {
+            return npos;
+        }
+
+        const auto it = m_index.find(StringUtils::Lower(name));
+        return it == m_index.end() ? npos : it->second;
+    }
+
+    size_t find(const std::string & name) const
+    {
+        return find(name.c_str());
+    }
+
+    void add(const char * name, size_t pos)
+    {
+        if (name && *name)
+        {
+            m_index.emplace(StringUtils::Lower(name), pos);
+        }
+    }
+
+    // Add the name and the aliases of an element (i.e. a color space or a named transform).
+    template<typename T>
+    void addWithAliases(const T & elt, size_t pos)
+    {
+        add(elt.getName(), pos);
+
+        const size_t numAliases = elt.getNumAliases();
+        for (size_t aidx = 0; aidx < numAliases; ++aidx)
+        {
+            add(elt.getAlias(aidx), pos);
+        }
+    }
+
+    // Rebuild the index from a collection of elements only having a name (e.g. looks).
+    template<typename Vec>
+    void rebuild(const Vec & elts)
+    {
+        clear();
+        m_index.reserve(elts.size());
+        for (size_t pos = 0; pos < elts.size(); ++pos)
+        {
+            add(elts[pos]->getName(), pos);
+        }
+    }
+
+    // Rebuild the index from a collection of elements having a name and aliases.
+    template<typename Vec>
+    void rebuildWithAliases(const Vec & elts)
+    {
+        clear();
+        m_index.reserve(elts.size());
+        for (size_t pos = 0; pos < elts.size(); ++pos)
+        {
+            addWithAliases(*elts[pos], pos);
+        }
+    }
+
+    void clear() noexcept
+    {
+        m_index.clear();
+    }
+
+    size_t size() const noexcept
+    {
+        return m_index.size();
+    }
+
+private:
+    // Lower case name to the position of the element.
+    std::unordered_map<std::string, size_t> m_index;
+};
+
+} // namespace OCIO_NAMESPACE
+
+#endif // INCLUDED_OCIO_NAMEINDEX_H
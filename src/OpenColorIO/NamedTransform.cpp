@@ -36,6 +36,8 @@ NamedTransformRcPtr NamedTransformImpl::createEditableCopy() const
     {
         copy->m_inverseTransform = m_inverseTransform->createEditableCopy();
     }
+    copy->m_forwardDeferred = m_forwardDeferred;
+    copy->m_inverseDeferred = m_inverseDeferred;
     return copy;
 }
 
@@ -169,11 +171,11 @@ ConstTransformRcPtr NamedTransformImpl::getTransform(TransformDirection dir) con
 {
     if (dir == TRANSFORM_DIR_FORWARD)
     {
-        return m_forwardTransform;
+        return ResolveTransform(m_forwardDeferred, m_forwardTransform);
     }
     else if (dir == TRANSFORM_DIR_INVERSE)
     {
-        return m_inverseTransform;
+        return ResolveTransform(m_inverseDeferred, m_inverseTransform);
     }
     throw Exception("Named transform: Unspecified TransformDirection.");
 }
@@ -231,6 +233,7 @@ void NamedTransformImpl::setTransform(const ConstTransformRcPtr & transform, Tra
         {
             m_forwardTransform = transform->createEditableCopy();
         }
+        m_forwardDeferred = nullptr;
     }
     else if (dir == TRANSFORM_DIR_INVERSE)
     {
@@ -242,6 +245,7 @@ void NamedTransformImpl::setTransform(const ConstTransformRcPtr & transform, Tra
         {
             m_inverseTransform = transform->createEditableCopy();
         }
+        m_inverseDeferred = nullptr;
     }
     else
     {
@@ -249,6 +253,47 @@ void NamedTransformImpl::setTransform(const ConstTransformRcPtr & transform, Tra
     }
 }
 
+void NamedTransformImpl::SetDeferred(NamedTransform & nt,
+                                     TransformDirection dir,
+                                     const DeferredTransformRcPtr & transform)
+{
+    NamedTransformImpl * impl = dynamic_cast<NamedTransformImpl *>(&nt);
+    if (!impl)
+    {
+        throw Exception("Named transform: Unknown implementation.");
+    }
+
+    switch (dir)
+    {
+    case TRANSFORM_DIR_FORWARD:
+        impl->m_forwardTransform = nullptr;
+        impl->m_forwardDeferred  = transform;
+        break;
+    case TRANSFORM_DIR_INVERSE:
+        impl->m_inverseTransform = nullptr;
+        impl->m_inverseDeferred  = transform;
+        break;
+    }
+}
+
+bool NamedTransformImpl::HasTransform(const NamedTransform & nt, TransformDirection dir)
+{
+    const NamedTransformImpl * impl = dynamic_cast<const NamedTransformImpl *>(&nt);
+    if (!impl)
+    {
+        return bool(nt.getTransform(dir));
+    }
+
+    switch (dir)
+    {
+    case TRANSFORM_DIR_FORWARD:
+        return impl->m_forwardDeferred || impl->m_forwardTransform;
+    case TRANSFORM_DIR_INVERSE:
+        return impl->m_inverseDeferred || impl->m_inverseTransform;
+    }
+    return false;
+}
+
 std::ostream & operator<< (std::ostream & os, const NamedTransform & t)
 {
     os << "<NamedTransform ";
@@ -292,15 +337,27 @@ std::ostream & operator<< (std::ostream & os, const NamedTransform & t)
     {
         os << ", encoding=" << enc;
     }
-    if (t.getTransform(TRANSFORM_DIR_FORWARD))
+    // The transforms of a lazily loaded config could fail to parse, print the error instead.
+    ConstTransformRcPtr forward, inverse;
+    try
+    {
+        forward = t.getTransform(TRANSFORM_DIR_FORWARD);
+        inverse = t.getTransform(TRANSFORM_DIR_INVERSE);
+    }
+    catch (const Exception & e)
+    {
+        os << ", error=" << e.what() << ">";
+        return os;
+    }
+    if (forward)
     {
         os << ",\n    forward=";
-        os << "\n        " << *t.getTransform(TRANSFORM_DIR_FORWARD);
+        os << "\n        " << *forward;
     }
-    if (t.getTransform(TRANSFORM_DIR_INVERSE))
+    if (inverse)
     {
         os << ",\n    inverse=";
-        os << "\n        " << *t.getTransform(TRANSFORM_DIR_INVERSE);
+        os << "\n        " << *inverse;
     }
     os << ">";
     return os;
@@ -9,6 +9,7 @@
 
 #include <OpenColorIO/OpenColorIO.h>
 
+#include "DeferredTransform.h"
 #include "TokensManager.h"
 
 namespace OCIO_NAMESPACE
@@ -53,12 +54,24 @@ public:
 
     static void Deleter(NamedTransform * nt);
 
+    // Attach a deferred transform i.e. it replaces the transform for that direction.
+    static void SetDeferred(NamedTransform & nt, TransformDirection dir,
+                            const DeferredTransformRcPtr & transform);
+
+    // Return true if there is a transform (deferred or not) for that direction, without
+    // creating the deferred transform.
+    static bool HasTransform(const NamedTransform & nt, TransformDirection dir);
+
 private:
     std::string m_name;
     StringUtils::StringVec m_aliases;
     ConstTransformRcPtr m_forwardTransform;
     ConstTransformRcPtr m_inverseTransform;
 
+    // Only used by a lazy config loading, they supersede the transforms.
+    DeferredTransformRcPtr m_forwardDeferred;
+    DeferredTransformRcPtr m_inverseDeferred;
+
     std::string m_family;
     std::string m_description;
     TokensManager m_categories;
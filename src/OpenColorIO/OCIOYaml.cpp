@@ -2,16 +2,20 @@
 // Copyright Contributors to the OpenColorIO Project.
 
 #include <cstring>
+#include <iterator>
+#include <memory>
 #include <unordered_set>
 
 #include <pystring.h>
 
 #include <OpenColorIO/OpenColorIO.h>
 
+#include "DeferredTransform.h"
 #include "Display.h"
 #include "FileRules.h"
 #include "Logging.h"
 #include "MathUtils.h"
+#include "NamedTransform.h"
 #include "OCIOYaml.h"
 #include "ops/exposurecontrast/ExposureContrastOpData.h"
 #include "ops/gradingprimary/GradingPrimaryOpData.h"
@@ -3421,7 +3425,365 @@ void save(YAML::Emitter& out, ConstTransformRcPtr t, unsigned int majorVersion)
 
 // ColorSpace
 
-inline void load(const YAML::Node& node, ColorSpaceRcPtr& cs, unsigned int majorVersion)
+// Lazy loading
+
+// The YAML text of a transform kept by the lazy loading pre-pass.
+struct DeferredSource
+{
+    std::string m_text;
+    // The (0-based) line of the text in the config file, to keep the error messages accurate.
+    unsigned int m_line = 0;
+};
+
+typedef std::vector<DeferredSource> DeferredSources;
+
+// The element keys whose value is a transform.
+bool IsTransformKey(const std::string & key)
+{
+    return key == "to_reference"          || key == "from_reference"
+        || key == "to_scene_reference"    || key == "from_scene_reference"
+        || key == "to_display_reference"  || key == "from_display_reference"
+        || key == "transform"             || key == "inverse_transform";
+}
+
+// The top-level config keys whose elements own transforms.
+bool IsDeferrableSection(const std::string & key)
+{
+    return key == "colorspaces" || key == "display_colorspaces" || key == "looks"
+        || key == "view_transforms" || key == "named_transforms";
+}
+
+// Return the line content without the trailing comment and whitespaces, and its indentation.
+std::string GetLineContent(const std::string & line, size_t & indent)
+{
+    indent = line.find_first_not_of(' ');
+    if (indent == std::string::npos || line[indent] == '#' || line[indent] == '\r')
+    {
+        indent = 0;
+        return "";
+    }
+
+    size_t end = line.size();
+    const size_t comment = line.find(" #", indent);
+    if (comment != std::string::npos)
+    {
+        end = comment;
+    }
+
+    return StringUtils::RightTrim(line.substr(indent, end - indent));
+}
+
+// The text pre-pass of the lazy loading. It replaces the transform values of the color spaces,
+// looks, view transforms and named transforms by a '!<DeferredTransform> index' scalar and
+// keeps the original text in sources. Line numbers are preserved.
+//
+// The pre-pass only handles the block style written by OCIO (and most hand-written configs).
+// Any transform it cannot safely extract (e.g. anchors, aliases, flow style elements) is left
+// in place and is then loaded as usual.
+std::string DeferTransforms(const std::string & text, DeferredSources & sources)
+{
+    std::vector<std::string> lines = StringUtils::SplitByLines(text);
+
+    static constexpr size_t npos = std::string::npos;
+
+    bool inSection    = false;
+    size_t itemIndent  = npos;
+    size_t entryIndent = npos;
+    bool pendingEntry  = false;
+
+    for (size_t idx = 0; idx < lines.size(); ++idx)
+    {
+        size_t indent = 0;
+        const std::string content = GetLineContent(lines[idx], indent);
+        if (content.empty())
+        {
+            continue;
+        }
+
+        const bool isItem = content[0] == '-' && (content.size() == 1 || content[1] == ' ');
+
+        if (indent == 0 && !(inSection && isItem))
+        {
+            // A top-level key.
+            const size_t colon = content.find(':');
+            inSection = colon != npos && colon + 1 == content.size()
+                        && IsDeferrableSection(content.substr(0, colon));
+            itemIndent  = npos;
+            entryIndent = npos;
+            pendingEntry = false;
+            continue;
+        }
+
+        if (!inSection)
+        {
+            continue;
+        }
+
+        if (isItem && (itemIndent == npos || indent == itemIndent))
+        {
+            // A new element. Only a tag alone on the item line starts a block map.
+            itemIndent   = indent;
+            entryIndent  = npos;
+            const std::string tag = content.size() > 1 ? content.substr(2) : "";
+            pendingEntry = tag.size() > 3 && tag.compare(0, 2, "!<") == 0 && tag.back() == '>';
+            continue;
+        }
+
+        if (pendingEntry)
+        {
+            pendingEntry = false;
+            if (itemIndent == npos || indent <= itemIndent)
+            {
+                continue;
+            }
+            entryIndent = indent;
+        }
+
+        if (entryIndent == npos || indent != entryIndent)
+        {
+            continue;
+        }
+
+        // An element key.
+
+        const size_t colon = content.find(':');
+        if (colon == npos || !IsTransformKey(content.substr(0, colon)))
+        {
+            continue;
+        }
+
+        const size_t keyEnd = indent + colon + 1;
+        if (keyEnd < lines[idx].size() && lines[idx][keyEnd] != ' ' && lines[idx][keyEnd] != '\r')
+        {
+            continue;
+        }
+
+        // Collect the value i.e. the rest of the key line and the following lines having a
+        // larger indentation.
+
+        size_t last = idx;
+        for (size_t next = idx + 1; next < lines.size(); ++next)
+        {
+            size_t nextIndent = 0;
+            if (GetLineContent(lines[next], nextIndent).empty())
+            {
+                continue;
+            }
+            if (nextIndent <= entryIndent)
+            {
+                break;
+            }
+            last = next;
+        }
+
+        std::string value = lines[idx].substr(keyEnd);
+        for (size_t next = idx + 1; next <= last; ++next)
+        {
+            value += "\n";
+            value += lines[next];
+        }
+
+        size_t valueIndent = 0;
+        const std::string firstLine = GetLineContent(lines[idx].substr(keyEnd), valueIndent);
+        if ((firstLine.empty() && last == idx)
+            || (!firstLine.empty() && (firstLine[0] == '|' || firstLine[0] == '>'))
+            || value.find_first_of("&*") != npos)
+        {
+            continue;
+        }
+
+        DeferredSource source;
+        source.m_text = std::move(value);
+        source.m_line = static_cast<unsigned int>(idx);
+
+        const bool crlf = !lines[idx].empty() && lines[idx].back() == '\r';
+        lines[idx] = lines[idx].substr(0, keyEnd) + " !<DeferredTransform> "
+                     + std::to_string(sources.size()) + (crlf ? "\r" : "");
+        for (size_t next = idx + 1; next <= last; ++next)
+        {
+            lines[next].clear();
+        }
+
+        sources.push_back(std::move(source));
+        idx = last;
+    }
+
+    std::string result;
+    result.reserve(text.size());
+    for (const auto & line : lines)
+    {
+        result += line;
+        result += "\n";
+    }
+    return result;
+}
+
+// What the deferred transforms need to know about the config they belong to.
+struct LazyContext
+{
+    std::string m_filename;
+    unsigned int m_majorVersion = 0;
+    unsigned int m_minorVersion = 0;
+    OCIOYaml::TransformCheck m_check = nullptr;
+};
+
+typedef std::shared_ptr<LazyContext> LazyContextRcPtr;
+
+[[noreturn]] void ThrowLoadingError(const char * filename, const std::exception & e)
+{
+    std::ostringstream os;
+    os << "Error: Loading the OCIO profile ";
+    if (filename && filename[0] && 
+        Platform::Strcasecmp(filename, "from Archive/ConfigIOProxy") != 0)
+    {
+        os << "'" << filename << "' ";
+    }
+    os << "failed. " << e.what();
+    throw Exception(os.str().c_str());
+}
+
+class LazyLoading
+{
+public:
+    LazyLoading(DeferredSources && sources, const char * filename, OCIOYaml::TransformCheck check,
+                const OCIOYaml::DeferredTransformSetters & setters)
+        :   m_sources(std::move(sources))
+        ,   m_context(std::make_shared<LazyContext>())
+        ,   m_setters(setters)
+    {
+        m_context->m_filename = filename ? filename : "";
+        m_context->m_check    = check;
+    }
+
+    LazyLoading() = delete;
+    LazyLoading(const LazyLoading &) = delete;
+    LazyLoading & operator=(const LazyLoading &) = delete;
+
+    void setVersion(unsigned int majorVersion, unsigned int minorVersion)
+    {
+        m_context->m_majorVersion = majorVersion;
+        m_context->m_minorVersion = minorVersion;
+    }
+
+    // Check a transform which was not deferred.
+    void check(const ConstTransformRcPtr & transform) const
+    {
+        m_context->m_check(transform, m_context->m_majorVersion, m_context->m_minorVersion);
+    }
+
+    DeferredTransformRcPtr createDeferred(const YAML::Node & node)
+    {
+        const std::string & str = node.Scalar();
+        const size_t index = str.empty() ? m_sources.size() : std::stoul(str);
+        if (index >= m_sources.size() || m_sources[index].m_text.empty())
+        {
+            throwError(node, "Invalid deferred transform.");
+        }
+
+        LazyContextRcPtr context = m_context;
+        DeferredSource source    = std::move(m_sources[index]);
+
+        return std::make_shared<DeferredTransform>([context, source]()
+        {
+            TransformRcPtr transform;
+            try
+            {
+                const YAML::Node node = YAML::Load(std::string(source.m_line, '\n')
+                                                   + source.m_text);
+                load(node, transform);
+                context->m_check(transform, context->m_majorVersion, context->m_minorVersion);
+            }
+            catch (const std::exception & e)
+            {
+                ThrowLoadingError(context->m_filename.c_str(), e);
+            }
+            return transform;
+        });
+    }
+
+    void setDeferred(ColorSpace & cs, ColorSpaceDirection dir,
+                     const DeferredTransformRcPtr & transform) const
+    {
+        m_setters.m_colorSpace(cs, dir, transform);
+    }
+
+    void setDeferred(Look & look, TransformDirection dir,
+                     const DeferredTransformRcPtr & transform) const
+    {
+        m_setters.m_look(look, dir, transform);
+    }
+
+    void setDeferred(ViewTransform & vt, ViewTransformDirection dir,
+                     const DeferredTransformRcPtr & transform) const
+    {
+        m_setters.m_viewTransform(vt, dir, transform);
+    }
+
+    void setDeferred(NamedTransform & nt, TransformDirection dir,
+                     const DeferredTransformRcPtr & transform) const
+    {
+        NamedTransformImpl::SetDeferred(nt, dir, transform);
+    }
+
+private:
+    DeferredSources m_sources;
+    LazyContextRcPtr m_context;
+    const OCIOYaml::DeferredTransformSetters m_setters;
+};
+
+inline void setElementTransform(ColorSpaceRcPtr & cs, const TransformRcPtr & transform,
+                                ColorSpaceDirection dir)
+{
+    cs->setTransform(transform, dir);
+}
+
+inline void setElementTransform(LookRcPtr & look, const TransformRcPtr & transform,
+                                TransformDirection dir)
+{
+    if (dir == TRANSFORM_DIR_FORWARD)
+    {
+        look->setTransform(transform);
+    }
+    else
+    {
+        look->setInverseTransform(transform);
+    }
+}
+
+inline void setElementTransform(ViewTransformRcPtr & vt, const TransformRcPtr & transform,
+                                ViewTransformDirection dir)
+{
+    vt->setTransform(transform, dir);
+}
+
+inline void setElementTransform(NamedTransformRcPtr & nt, const TransformRcPtr & transform,
+                                TransformDirection dir)
+{
+    nt->setTransform(transform, dir);
+}
+
+// Load the transform of an element, lazy is null when the loading is not lazy.
+template<typename ElementRcPtr, typename Direction>
+void loadElementTransform(const YAML::Node & node, LazyLoading * lazy,
+                          ElementRcPtr & element, Direction dir)
+{
+    if (lazy && node.Tag() == "DeferredTransform")
+    {
+        lazy->setDeferred(*element, dir, lazy->createDeferred(node));
+        return;
+    }
+
+    TransformRcPtr val;
+    load(node, val);
+    if (lazy)
+    {
+        lazy->check(val);
+    }
+    setElementTransform(element, val, dir);
+}
+
+inline void load(const YAML::Node& node, ColorSpaceRcPtr& cs, unsigned int majorVersion,
+                 LazyLoading * lazy)
 {
     if(node.Tag() != "ColorSpace")
         return; // not a !<ColorSpace> tag
@@ -3527,9 +3889,7 @@ inline void load(const YAML::Node& node, ColorSpaceRcPtr& cs, unsigned int major
                 throwError(node, "'to_reference' or 'to_scene_reference' cannot be used for a "
                                  "display color space.");
             }
-            TransformRcPtr val;
-            load(iter->second, val);
-            cs->setTransform(val, COLORSPACE_DIR_TO_REFERENCE);
+            loadElementTransform(iter->second, lazy, cs, COLORSPACE_DIR_TO_REFERENCE);
         }
         else if (key == "to_display_reference")
         {
@@ -3538,9 +3898,7 @@ inline void load(const YAML::Node& node, ColorSpaceRcPtr& cs, unsigned int major
                 throwError(node, "'to_display_reference' cannot be used for a "
                                  "non-display color space.");
             }
-            TransformRcPtr val;
-            load(iter->second, val);
-            cs->setTransform(val, COLORSPACE_DIR_TO_REFERENCE);
+            loadElementTransform(iter->second, lazy, cs, COLORSPACE_DIR_TO_REFERENCE);
         }
         else if(key == "from_reference" || (majorVersion >= 2 && key == "from_scene_reference"))
         {
@@ -3549,9 +3907,7 @@ inline void load(const YAML::Node& node, ColorSpaceRcPtr& cs, unsigned int major
                 throwError(node, "'from_reference' or 'from_scene_reference' cannot be used for "
                                  "a display color space.");
             }
-            TransformRcPtr val;
-            load(iter->second, val);
-            cs->setTransform(val, COLORSPACE_DIR_FROM_REFERENCE);
+            loadElementTransform(iter->second, lazy, cs, COLORSPACE_DIR_FROM_REFERENCE);
         }
         else if (key == "from_display_reference")
         {
@@ -3560,9 +3916,7 @@ inline void load(const YAML::Node& node, ColorSpaceRcPtr& cs, unsigned int major
                 throwError(node, "'from_display_reference' cannot be used for a "
                                  "non-display color space.");
             }
-            TransformRcPtr val;
-            load(iter->second, val);
-            cs->setTransform(val, COLORSPACE_DIR_FROM_REFERENCE);
+            loadElementTransform(iter->second, lazy, cs, COLORSPACE_DIR_FROM_REFERENCE);
         }
         else
         {
@@ -3664,7 +4018,7 @@ inline void save(YAML::Emitter& out, ConstColorSpaceRcPtr cs, unsigned int major
 
 // Look
 
-inline void load(const YAML::Node& node, LookRcPtr& look)
+inline void load(const YAML::Node& node, LookRcPtr& look, LazyLoading * lazy)
 {
     if(node.Tag() != "Look")
         return;
@@ -3691,15 +4045,11 @@ inline void load(const YAML::Node& node, LookRcPtr& look)
         }
         else if(key == "transform")
         {
-            TransformRcPtr val;
-            load(iter->second, val);
-            look->setTransform(val);
+            loadElementTransform(iter->second, lazy, look, TRANSFORM_DIR_FORWARD);
         }
         else if(key == "inverse_transform")
         {
-            TransformRcPtr val;
-            load(iter->second, val);
-            look->setInverseTransform(val);
+            loadElementTransform(iter->second, lazy, look, TRANSFORM_DIR_INVERSE);
         }
         else if(key == "description")
         {
@@ -3794,7 +4144,7 @@ inline ReferenceSpaceType peekViewTransformReferenceSpace(const YAML::Node & nod
     return isDisplay ? REFERENCE_SPACE_DISPLAY : REFERENCE_SPACE_SCENE;
 }
 
-inline void load(const YAML::Node & node, ViewTransformRcPtr & vt)
+inline void load(const YAML::Node & node, ViewTransformRcPtr & vt, LazyLoading * lazy)
 {
     if (node.Tag() != "ViewTransform")
     {
@@ -3849,27 +4199,19 @@ inline void load(const YAML::Node & node, ViewTransformRcPtr & vt)
         }
         else if (key == "to_scene_reference")
         {
-            TransformRcPtr val;
-            load(iter->second, val);
-            vt->setTransform(val, VIEWTRANSFORM_DIR_TO_REFERENCE);
+            loadElementTransform(iter->second, lazy, vt, VIEWTRANSFORM_DIR_TO_REFERENCE);
         }
         else if (key == "to_display_reference")
         {
-            TransformRcPtr val;
-            load(iter->second, val);
-            vt->setTransform(val, VIEWTRANSFORM_DIR_TO_REFERENCE);
+            loadElementTransform(iter->second, lazy, vt, VIEWTRANSFORM_DIR_TO_REFERENCE);
         }
         else if (key == "from_scene_reference")
         {
-            TransformRcPtr val;
-            load(iter->second, val);
-            vt->setTransform(val, VIEWTRANSFORM_DIR_FROM_REFERENCE);
+            loadElementTransform(iter->second, lazy, vt, VIEWTRANSFORM_DIR_FROM_REFERENCE);
         }
         else if (key == "from_display_reference")
         {
-            TransformRcPtr val;
-            load(iter->second, val);
-            vt->setTransform(val, VIEWTRANSFORM_DIR_FROM_REFERENCE);
+            loadElementTransform(iter->second, lazy, vt, VIEWTRANSFORM_DIR_FROM_REFERENCE);
         }
         else
         {
@@ -3924,7 +4266,7 @@ inline void save(YAML::Emitter & out, ConstViewTransformRcPtr & vt, unsigned int
 
 // NamedTransform
 
-inline void load(const YAML::Node & node, NamedTransformRcPtr & nt)
+inline void load(const YAML::Node & node, NamedTransformRcPtr & nt, LazyLoading * lazy)
 {
     if (node.Tag() != "NamedTransform")
     {
@@ -3988,15 +4330,11 @@ inline void load(const YAML::Node & node, NamedTransformRcPtr & nt)
         }
         else if (key == "transform")
         {
-            TransformRcPtr val;
-            load(iter->second, val);
-            nt->setTransform(val, TRANSFORM_DIR_FORWARD);
+            loadElementTransform(iter->second, lazy, nt, TRANSFORM_DIR_FORWARD);
         }
         else if (key == "inverse_transform")
         {
-            TransformRcPtr val;
-            load(iter->second, val);
-            nt->setTransform(val, TRANSFORM_DIR_INVERSE);
+            loadElementTransform(iter->second, lazy, nt, TRANSFORM_DIR_INVERSE);
         }
         else
         {
@@ -4395,7 +4733,8 @@ inline void save(YAML::Emitter & out, ConstViewingRulesRcPtr & vr, size_t positi
 
 // Config
 
-inline void load(const YAML::Node& node, ConfigRcPtr & config, const char* filename)
+inline void load(const YAML::Node& node, ConfigRcPtr & config, const char* filename,
+                 LazyLoading * lazy)
 {
 
     // check profile version
@@ -4446,6 +4785,10 @@ inline void load(const YAML::Node& node, ConfigRcPtr & config, const char* filen
     {
         config->setVersion((unsigned int)profile_major_version,
                            (unsigned int)profile_minor_version);
+        if (lazy)
+        {
+            lazy->setVersion(config->getMajorVersion(), config->getMinorVersion());
+        }
     }
     catch(Exception & ex)
     {
@@ -4782,7 +5125,7 @@ inline void load(const YAML::Node& node, ConfigRcPtr & config, const char* filen
                 if(val.Tag() == "ColorSpace")
                 {
                     ColorSpaceRcPtr cs = ColorSpace::Create(REFERENCE_SPACE_SCENE);
-                    load(val, cs, config->getMajorVersion());
+                    load(val, cs, config->getMajorVersion(), lazy);
                     for(int ii = 0; ii < config->getNumColorSpaces(); ++ii)
                     {
                         if(strcmp(config->getColorSpaceNameByIndex(ii), cs->getName()) == 0)
@@ -4818,7 +5161,7 @@ inline void load(const YAML::Node& node, ConfigRcPtr & config, const char* filen
                 if (val.Tag() == "ColorSpace")
                 {
                     ColorSpaceRcPtr cs = ColorSpace::Create(REFERENCE_SPACE_DISPLAY);
-                    load(val, cs, config->getMajorVersion());
+                    load(val, cs, config->getMajorVersion(), lazy);
                     for (int ii = 0; ii < config->getNumColorSpaces(); ++ii)
                     {
                         if (strcmp(config->getColorSpaceNameByIndex(ii), cs->getName()) == 0)
@@ -4854,7 +5197,7 @@ inline void load(const YAML::Node& node, ConfigRcPtr & config, const char* filen
                 if(val.Tag() == "Look")
                 {
                     LookRcPtr look = Look::Create();
-                    load(val, look);
+                    load(val, look, lazy);
                     config->addLook(look);
                 }
                 else
@@ -4882,7 +5225,7 @@ inline void load(const YAML::Node& node, ConfigRcPtr & config, const char* filen
                 {
                     ReferenceSpaceType rst = peekViewTransformReferenceSpace(val);
                     ViewTransformRcPtr vt = ViewTransform::Create(rst);
-                    load(val, vt);
+                    load(val, vt, lazy);
                     config->addViewTransform(vt);
                 }
                 else
@@ -4915,7 +5258,7 @@ inline void load(const YAML::Node& node, ConfigRcPtr & config, const char* filen
                 if (val.Tag() == "NamedTransform")
                 {
                     auto nt = NamedTransform::Create();
-                    load(val, nt);
+                    load(val, nt, lazy);
                     if (nt->getName())
                     {
                         // Test that the name transform definitions are unique.
@@ -5415,19 +5758,33 @@ void OCIOYaml::Read(std::istream & istream, ConfigRcPtr & config, const char * f
     try
     {
         YAML::Node node = YAML::Load(istream);
-        load(node, config, filename);
+        load(node, config, filename, nullptr);
     }
     catch(const std::exception & e)
     {
-        std::ostringstream os;
-        os << "Error: Loading the OCIO profile ";
-        if (filename && filename[0] && 
-            Platform::Strcasecmp(filename, "from Archive/ConfigIOProxy") != 0)
-        {
-            os << "'" << filename << "' ";
-        }
-        os << "failed. " << e.what();
-        throw Exception(os.str().c_str());
+        ThrowLoadingError(filename, e);
+    }
+}
+
+void OCIOYaml::ReadLazy(std::istream & istream, ConfigRcPtr & config, const char * filename,
+                        TransformCheck check, const DeferredTransformSetters & setters)
+{
+    try
+    {
+        const std::string text{ std::istreambuf_iterator<char>(istream),
+                                std::istreambuf_iterator<char>() };
+
+        DeferredSources sources;
+        const std::string deferredText = DeferTransforms(text, sources);
+
+        LazyLoading lazy(std::move(sources), filename, check, setters);
+
+        YAML::Node node = YAML::Load(deferredText);
+        load(node, config, filename, &lazy);
+    }
+    catch(const std::exception & e)
+    {
+        ThrowLoadingError(filename, e);
     }
 }
 
@@ -6,6 +6,8 @@
 #ifndef INCLUDED_OCIO_YAML_H
 #define INCLUDED_OCIO_YAML_H
 
+#include "DeferredTransform.h"
+
 namespace OCIO_NAMESPACE
 {
 
@@ -13,6 +15,28 @@ namespace OCIOYaml
 {
 
 void Read(std::istream & istream, ConfigRcPtr & c, const char * filename);
+
+// Check a transform against the config version, throws if the transform is not supported.
+typedef void (*TransformCheck)(const ConstTransformRcPtr & transform,
+                               unsigned int majorVersion,
+                               unsigned int minorVersion);
+
+// Attach a deferred transform to a config element i.e. it replaces the element transform for
+// that direction. Only the config reaches the element implementations so it provides them.
+struct DeferredTransformSetters
+{
+    void (*m_colorSpace)(ColorSpace & cs, ColorSpaceDirection dir,
+                         const DeferredTransformRcPtr & transform);
+    void (*m_look)(Look & look, TransformDirection dir, const DeferredTransformRcPtr & transform);
+    void (*m_viewTransform)(ViewTransform & vt, ViewTransformDirection dir,
+                            const DeferredTransformRcPtr & transform);
+};
+
+// Same as Read() except that the transforms of the color spaces, looks, view transforms and
+// named transforms are only parsed (and checked) when first used (refer to
+// OCIO_LAZY_LOADING_ENVVAR).
+void ReadLazy(std::istream & istream, ConfigRcPtr & c, const char * filename,
+              TransformCheck check, const DeferredTransformSetters & setters);
 void Write(std::ostream & ostream, const Config & c);
 
 } // namespace OCIOYaml
@@ -8,6 +8,7 @@
 
 #include <OpenColorIO/OpenColorIO.h>
 
+#include "HashUtils.h"
 #include "Logging.h"
 #include "Op.h"
 #include "ops/cdl/CDLOp.h"
@@ -26,6 +27,18 @@
 
 namespace OCIO_NAMESPACE
 {
+bool OpCPU::hasPlanarApply() const
+{
+    return false;
+}
+
+void OpCPU::applyPlanar(const float * const /* inPlanes */[4],
+                        float * const /* outPlanes */[4],
+                        long /* numPixels */) const
+{
+    throw Exception("Op does not implement planar processing.");
+}
+
 bool OpCPU::isDynamic() const
 {
     return false;
@@ -78,6 +91,13 @@ bool OpData::equals(const OpData & other) const
     return getType() == other.getType();
 }
 
+std::string OpData::getCacheID() const
+{
+    std::ostringstream cacheIDStream;
+    writeCacheID(cacheIDStream);
+    return cacheIDStream.str();
+}
+
 const std::string & OpData::getID() const
 {
     return m_metadata.getAttributeValueString(METADATA_ID);
@@ -160,6 +180,13 @@ void Op::validate() const
     m_data->validate();
 }
 
+std::string Op::getCacheID() const
+{
+    std::ostringstream cacheIDStream;
+    writeCacheID(cacheIDStream);
+    return cacheIDStream.str();
+}
+
 bool Op::isDynamic() const
 {
     return false;
@@ -464,6 +491,24 @@ std::string OpRcPtrVec::getCacheID() const
     return stream.str();
 }
 
+void OpRcPtrVec::getCacheID(CacheIDHasher & hasher) const
+{
+    // The ops directly write their cache IDs to the hasher. Note that only the no-ops have an
+    // empty cache ID.
+    CacheIDHashStream stream(hasher);
+    const std::streamsize precision = stream.precision();
+
+    for (const auto & op : m_ops)
+    {
+        if (!op->isNoOpType())
+        {
+            stream.precision(precision);
+            stream << " ";
+            op->writeCacheID(stream);
+        }
+    }
+}
+
 std::ostream& operator<< (std::ostream & os, const Op & op)
 {
     os << op.getInfo();
@@ -45,6 +45,14 @@ public:
     // the 1D LUT CPU Op where the finalization depends on input and output bit depths.
     virtual void apply(const void * inImg, void * outImg, long numPixels) const = 0;
 
+    // Some ops could also directly process planar 32-bit float pixels (i.e. one buffer per
+    // channel in the R, G, B, A order) which avoids packing and unpacking the pixels in RGBA.
+    // Note that the in and out planes could be the same buffers.
+    virtual bool hasPlanarApply() const;
+    virtual void applyPlanar(const float * const inPlanes[4],
+                             float * const outPlanes[4],
+                             long numPixels) const;
+
     virtual bool isDynamic() const;
     virtual bool hasDynamicProperty(DynamicPropertyType type) const;
     virtual DynamicPropertyRcPtr getDynamicProperty(DynamicPropertyType type) const;
@@ -61,6 +69,8 @@ typedef OCIO_SHARED_PTR<Op> OpRcPtr;
 typedef OCIO_SHARED_PTR<const Op> ConstOpRcPtr;
 class OpRcPtrVec;
 
+class CacheIDHasher;
+
 // The OpData class is a helper class to hold the data part of an Op 
 // with some basic behaviors (i.e. isNoop(), isIdentity() …). The Op class 
 // holds an OpData and offers high-level behaviors such as op's combinations, 
@@ -157,7 +167,10 @@ public:
     virtual bool equals(const OpData & other) const;
 
     // This should yield a string of not unreasonable length.
-    virtual std::string getCacheID() const = 0;
+    std::string getCacheID() const;
+    // Write the cache ID to the stream (e.g. a CacheIDHashStream to hash it without building
+    // the string). Note that the stream precision could be changed.
+    virtual void writeCacheID(std::ostream & os) const = 0;
 
     // FormatMetadata.
     FormatMetadataImpl & getFormatMetadata() { return m_metadata;  }
@@ -227,7 +240,9 @@ public:
     virtual void finalize() { }
 
     // This should yield a string of not unreasonable length.
-    virtual std::string getCacheID() const = 0;
+    std::string getCacheID() const;
+    // Write the cache ID to the stream (refer to OpData::writeCacheID()).
+    virtual void writeCacheID(std::ostream & os) const = 0;
 
     // Render the specified pixels.
     //
@@ -389,6 +404,9 @@ public:
     void validate() const;
 
     std::string getCacheID() const;
+    // Add the cache ID to the hasher without building the full string i.e. the digest is the
+    // same as hashing the string returned by getCacheID().
+    void getCacheID(CacheIDHasher & hasher) const;
 
     // The method validates and finalizes each op.
     void finalize();
@@ -402,10 +420,12 @@ public:
     //
     void optimize(OptimizationFlags oFlags);
 
-    // Only OptimizationFlags related to bitdepth optimization are used.
+    // Only OptimizationFlags related to bitdepth optimization are used. The approximations are
+    // only requested for the CPU processing.
     void optimizeForBitdepth(const BitDepth & inBitDepth,
                              const BitDepth & outBitDepth,
-                             OptimizationFlags oFlags);
+                             OptimizationFlags oFlags,
+                             const CPUApproximations & approximations = CPUApproximations());
 
 };
 
@@ -2,16 +2,21 @@
 // Copyright Contributors to the OpenColorIO Project.
 
 #include <algorithm>
+#include <cmath>
 #include <iterator>
+#include <limits>
 #include <sstream>
 
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "BitDepthUtils.h"
+#include "DiskCache.h"
 #include "Logging.h"
+#include "MathUtils.h"
 #include "Op.h"
 #include "ops/lut1d/Lut1DOp.h"
 #include "ops/lut3d/Lut3DOp.h"
+#include "ops/OpTools.h"
 #include "ops/range/RangeOp.h"
 
 namespace OCIO_NAMESPACE
@@ -550,16 +555,27 @@ unsigned FindSeparablePrefix(const OpRcPtrVec & ops)
 
 // Use functional composition to replace a string of separable ops at the head of
 // the op list with a single 1D LUT that is built to do a look-up for the input bit-depth.
-void OptimizeSeparablePrefix(OpRcPtrVec & ops, BitDepth in)
+// For F32 input, the LUT is a half-domain LUT which interpolates between the half values.
+void OptimizeSeparablePrefix(OpRcPtrVec & ops, BitDepth in, OptimizationFlags oFlags,
+                             const CPUApproximations & approximations)
 {
     if (ops.empty())
     {
         return;
     }
 
-    // TODO: Investigate whether even the F32 case could be sped up via interpolating 
-    //       in a half-domain Lut1D (e.g. replacing a string of exponent, log, etc.).
-    if (in == BIT_DEPTH_F32 || in == BIT_DEPTH_UINT32)
+    if (in == BIT_DEPTH_UINT32)
+    {
+        return;
+    }
+    else if (in == BIT_DEPTH_F32)
+    {
+        if (!approximations.m_separablePrefixF32)
+        {
+            return;
+        }
+    }
+    else if (!HasFlag(oFlags, OPTIMIZATION_COMP_SEPARABLE_PREFIX))
     {
         return;
     }
@@ -576,12 +592,38 @@ void OptimizeSeparablePrefix(OpRcPtrVec & ops, BitDepth in)
         prefixOps.push_back(ops[i]->clone());
     }
 
-    // Make a domain for the LUT.  (Will be half-domain for target == 16f.)
-    Lut1DOpDataRcPtr newDomain = Lut1DOpData::MakeLookupDomain(in);
+    // The processes sharing the disk cache only compose the LUT once.
+    CacheIDDigest diskCacheKey;
+    const bool useDiskCache = DiskCache::IsEnabled();
+    Lut1DOpDataRcPtr newDomain;
+    if (useDiskCache)
+    {
+        CacheIDHasher hasher;
+        hasher.update("OptimizeSeparablePrefix").update(&in, sizeof(in));
+        DiskCache::UpdateKey(hasher, prefixOps);
+        diskCacheKey = hasher.digest();
+
+        ConstOpDataVec data;
+        if (DiskCache::Load(diskCacheKey, data) && data.size() == 1)
+        {
+            newDomain = DiskCache::CopyAs<Lut1DOpData>(data[0]);
+        }
+    }
+
+    if (!newDomain)
+    {
+        // Make a domain for the LUT.  (Will be half-domain for target == 16f.)
+        newDomain = Lut1DOpData::MakeLookupDomain(in);
 
-    // Send the domain through the prefix ops.
-    // Note: This sets the outBitDepth of newDomain to match prefixOps.
-    Lut1DOpData::ComposeVec(newDomain, prefixOps);
+        // Send the domain through the prefix ops.
+        // Note: This sets the outBitDepth of newDomain to match prefixOps.
+        Lut1DOpData::ComposeVec(newDomain, prefixOps);
+
+        if (useDiskCache)
+        {
+            DiskCache::Save(diskCacheKey, { newDomain });
+        }
+    }
 
     // Remove the prefix ops.
     ops.erase(ops.begin(), ops.begin() + prefixLen);
@@ -593,6 +635,246 @@ void OptimizeSeparablePrefix(OpRcPtrVec & ops, BitDepth in)
 
     ops.insert(ops.begin(), lutOps.begin(), lutOps.end());
 }
+
+constexpr float BakeLut3DShaperMidGray = 0.18f;
+
+// The log2 shaper maps [midGray * 2^minStops, midGray * 2^maxStops] to [0, 1].
+float BakeLut3DShaper(float v, float minStops, float maxStops)
+{
+    if (IsNan(v) || v <= 0.0f)
+    {
+        return 0.0f;
+    }
+    const float stops = std::log2(v / BakeLut3DShaperMidGray);
+    return Clamp((stops - minStops) / (maxStops - minStops), 0.0f, 1.0f);
+}
+
+float BakeLut3DInvShaper(float v, float minStops, float maxStops)
+{
+    return BakeLut3DShaperMidGray * std::exp2(minStops + v * (maxStops - minStops));
+}
+
+// Return the maximum absolute difference between the ops and the baked LUT ops. The error is
+// measured in the middle of the cells of a coarser grid, i.e. where the interpolation error is
+// expected to be the largest.  Float input is not bounded so the error is also measured outside
+// of the LUT domain (i.e. negative values and values beyond the shaper range, or beyond 1 without
+// a shaper) where the baked LUTs clamp.
+float MeasureBakeLut3DError(OpRcPtrVec & ops, const OpRcPtrVec & lutOps, bool floatInput,
+                            bool useShaper, float minStops, float maxStops)
+{
+    static constexpr long numSteps = 16;
+
+    std::vector<float> samples;
+    samples.reserve(numSteps * numSteps * numSteps * 3);
+    for (long idx = 0; idx < numSteps * numSteps * numSteps; ++idx)
+    {
+        samples.push_back(((idx / numSteps / numSteps) % numSteps + 0.5f) / numSteps);
+        samples.push_back(((idx / numSteps) % numSteps + 0.5f) / numSteps);
+        samples.push_back((idx % numSteps + 0.5f) / numSteps);
+    }
+    if (useShaper)
+    {
+        for (auto & v : samples)
+        {
+            v = BakeLut3DInvShaper(v, minStops, maxStops);
+        }
+    }
+
+    if (floatInput)
+    {
+        // All the combinations of values below, inside and above the domain.
+        const float lowest  = useShaper ? BakeLut3DInvShaper(0.0f, minStops, maxStops) : 0.0f;
+        const float highest = useShaper ? BakeLut3DInvShaper(1.0f, minStops, maxStops) : 1.0f;
+        const float middle  = useShaper ? BakeLut3DShaperMidGray : 0.5f;
+        const float values[] = { -highest, -0.01f, lowest * 0.5f, middle,
+                                 highest * 1.5f, highest * 16.0f };
+
+        for (float r : values)
+        {
+            for (float g : values)
+            {
+                for (float b : values)
+                {
+                    samples.insert(samples.end(), { r, g, b });
+                }
+            }
+        }
+    }
+
+    const long numSamples = (long)(samples.size() / 3);
+
+    std::vector<float> ref(numSamples * 3);
+    std::vector<float> res(numSamples * 3);
+    EvalTransform(samples.data(), ref.data(), numSamples, ops);
+    OpRcPtrVec evalOps = lutOps.clone();
+    EvalTransform(samples.data(), res.data(), numSamples, evalOps);
+
+    float maxError = 0.0f;
+    for (long idx = 0; idx < numSamples * 3; ++idx)
+    {
+        // A NaN difference is an infinite error.
+        const float error = std::fabs(ref[idx] - res[idx]);
+        maxError = IsNan(error) ? std::numeric_limits<float>::infinity()
+                                : std::max(maxError, error);
+    }
+    return maxError;
+}
+
+// Replace the complete op list by a 3D LUT (with a log2 shaper 1D LUT for float input) when
+// it contains at least one op with channel crosstalk.  The shaper is needed as the 3D LUT
+// domain is [0, 1] whereas float input is often scene-referred.  Contrary to the separable
+// prefix optimization, this is an approximation of the ops even for integer input so the
+// maximum error on samples located in between the grid points is measured: the ops are kept
+// when it exceeds the maximum error setting, and it is logged.  As for the Baker, the alpha
+// channel is left untouched.
+void BakeLut3D(OpRcPtrVec & ops, BitDepth in, const CPUApproximations & approximations)
+{
+    if (!approximations.m_bakeLut3D || ops.empty())
+    {
+        return;
+    }
+
+    // Separable op lists are better handled by the separable prefix optimization and
+    // dynamic properties would be lost.
+    if (!ops.hasChannelCrosstalk() || ops.isDynamic())
+    {
+        return;
+    }
+
+    // Nothing to gain if it is already a single 3D LUT.
+    if (ops.size() == 1)
+    {
+        ConstOpRcPtr constOp0 = ops[0];
+        auto opData = constOp0->data();
+        if (opData->getType() == OpData::Lut3DType)
+        {
+            auto lutData = OCIO_DYNAMIC_POINTER_CAST<const Lut3DOpData>(opData);
+            if (lutData->getDirection() == TRANSFORM_DIR_FORWARD)
+            {
+                return;
+            }
+        }
+    }
+
+    const unsigned edgeLength    = approximations.m_bakeLut3DEdgeLength;
+    const float minStops         = (float)approximations.m_bakeLut3DShaperMinStops;
+    const float maxStops         = (float)approximations.m_bakeLut3DShaperMaxStops;
+    const double maxAllowedError = approximations.m_bakeLut3DMaxError;
+
+    const bool useShaper = IsFloatBitDepth(in) && minStops != maxStops;
+
+    OpRcPtrVec bakedOps;
+    for (const auto & op : ops)
+    {
+        bakedOps.push_back(op->clone());
+    }
+
+    // The processes sharing the disk cache only bake the LUTs once.
+    CacheIDDigest diskCacheKey;
+    const bool useDiskCache = DiskCache::IsEnabled();
+    Lut1DOpDataRcPtr shaper;
+    Lut3DOpDataRcPtr cube;
+    if (useDiskCache)
+    {
+        CacheIDHasher hasher;
+        hasher.update("BakeLut3D")
+              .update(&edgeLength, sizeof(edgeLength))
+              .update(&useShaper, sizeof(useShaper))
+              .update(&minStops, sizeof(minStops))
+              .update(&maxStops, sizeof(maxStops));
+        DiskCache::UpdateKey(hasher, bakedOps);
+        diskCacheKey = hasher.digest();
+
+        ConstOpDataVec data;
+        if (DiskCache::Load(diskCacheKey, data) && data.size() == (useShaper ? 2 : 1))
+        {
+            shaper = useShaper ? DiskCache::CopyAs<Lut1DOpData>(data.front()) : nullptr;
+            cube   = DiskCache::CopyAs<Lut3DOpData>(data.back());
+            if (useShaper && !shaper)
+            {
+                cube.reset();
+            }
+        }
+    }
+
+    if (!cube)
+    {
+        // Build the shaper as a half-domain 1D LUT.
+        if (useShaper)
+        {
+            shaper = Lut1DOpData::MakeLookupDomain(BIT_DEPTH_F16);
+            Array::Values & values = shaper->getArray().getValues();
+            float * shaped = values.mutableData();
+            for (size_t idx = 0; idx < values.size(); ++idx)
+            {
+                shaped[idx] = BakeLut3DShaper(shaped[idx], minStops, maxStops);
+            }
+        }
+
+        // Send the (unshaped) grid points through the ops.
+        cube = std::make_shared<Lut3DOpData>(INTERP_TETRAHEDRAL, edgeLength);
+        Array::Values & values = cube->getArray().getValues();
+        const long numPixels = (long)(edgeLength * edgeLength * edgeLength);
+
+        std::vector<float> inValues(values.begin(), values.begin() + numPixels * 3);
+        if (useShaper)
+        {
+            for (auto & v : inValues)
+            {
+                v = BakeLut3DInvShaper(v, minStops, maxStops);
+            }
+        }
+        EvalTransform(inValues.data(), values.mutableData(), numPixels, bakedOps);
+
+        if (useDiskCache)
+        {
+            ConstOpDataVec data;
+            if (useShaper)
+            {
+                data.push_back(shaper);
+            }
+            data.push_back(cube);
+            DiskCache::Save(diskCacheKey, data);
+        }
+    }
+
+    OpRcPtrVec lutOps;
+    if (useShaper)
+    {
+        CreateLut1DOp(lutOps, shaper, TRANSFORM_DIR_FORWARD);
+    }
+    CreateLut3DOp(lutOps, cube, TRANSFORM_DIR_FORWARD);
+    FinalizeOps(lutOps);
+
+    if (maxAllowedError > 0.0 || IsDebugLoggingEnabled())
+    {
+        // Note: bakedOps are still the original ops.
+        const float maxError
+            = MeasureBakeLut3DError(bakedOps, lutOps, IsFloatBitDepth(in),
+                                    useShaper, minStops, maxStops);
+        const bool rejected = maxAllowedError > 0.0 && !(maxError <= maxAllowedError);
+
+        if (IsDebugLoggingEnabled())
+        {
+            std::ostringstream oss;
+            oss << (rejected ? "Rejected baking " : "Baked ") << ops.size() << " op(s) into a "
+                << edgeLength << "x" << edgeLength << "x" << edgeLength << " 3D LUT"
+                << (useShaper ? " with a log2 shaper" : "") << ", max error: " << maxError;
+            if (rejected)
+            {
+                oss << " exceeds " << maxAllowedError;
+            }
+            LogDebug(oss.str());
+        }
+
+        if (rejected)
+        {
+            return;
+        }
+    }
+
+    ops = lutOps;
+}
 } // namespace
 
 void OpRcPtrVec::finalize()
@@ -757,7 +1039,8 @@ void OpRcPtrVec::optimize(OptimizationFlags oFlags)
 
 void OpRcPtrVec::optimizeForBitdepth(const BitDepth & inBitDepth,
                                      const BitDepth & outBitDepth,
-                                     OptimizationFlags oFlags)
+                                     OptimizationFlags oFlags,
+                                     const CPUApproximations & approximations)
 {
     if (!empty())
     {
@@ -769,12 +1052,48 @@ void OpRcPtrVec::optimizeForBitdepth(const BitDepth & inBitDepth,
         {
             RemoveTrailingClampIdentity(*this);
         }
-        if (HasFlag(oFlags, OPTIMIZATION_COMP_SEPARABLE_PREFIX))
-        {
-            OptimizeSeparablePrefix(*this, inBitDepth);
-        }
+        BakeLut3D(*this, inBitDepth, approximations);
+        OptimizeSeparablePrefix(*this, inBitDepth, oFlags, approximations);
     }
 }
 
+void CPUApproximations::validate() const
+{
+    if (m_bakeLut3DEdgeLength < 2 || m_bakeLut3DEdgeLength > Lut3DOpData::maxSupportedLength)
+    {
+        std::ostringstream oss;
+        oss << "Bake LUT 3D: Edge length '" << m_bakeLut3DEdgeLength
+            << "' must be in the range [2, " << Lut3DOpData::maxSupportedLength << "].";
+        throw Exception(oss.str().c_str());
+    }
+
+    if (!(m_bakeLut3DShaperMinStops <= m_bakeLut3DShaperMaxStops)
+        || std::isinf(m_bakeLut3DShaperMinStops) || std::isinf(m_bakeLut3DShaperMaxStops))
+    {
+        std::ostringstream oss;
+        oss << "Bake LUT 3D: Shaper range [" << m_bakeLut3DShaperMinStops << ", "
+            << m_bakeLut3DShaperMaxStops << "] is not a valid range.";
+        throw Exception(oss.str().c_str());
+    }
+
+    if (!(m_bakeLut3DMaxError >= 0.0))
+    {
+        std::ostringstream oss;
+        oss << "Bake LUT 3D: Max error '" << m_bakeLut3DMaxError
+            << "' must be positive or zero.";
+        throw Exception(oss.str().c_str());
+    }
+}
+
+bool CPUApproximations::operator==(const CPUApproximations & rhs) const noexcept
+{
+    return m_separablePrefixF32      == rhs.m_separablePrefixF32
+        && m_bakeLut3D               == rhs.m_bakeLut3D
+        && m_bakeLut3DEdgeLength     == rhs.m_bakeLut3DEdgeLength
+        && m_bakeLut3DShaperMinStops == rhs.m_bakeLut3DShaperMinStops
+        && m_bakeLut3DShaperMaxStops == rhs.m_bakeLut3DShaperMaxStops
+        && m_bakeLut3DMaxError       == rhs.m_bakeLut3DMaxError;
+}
+
 } // namespace OCIO_NAMESPACE
 
@@ -13,7 +13,10 @@
 #include "Platform.h"
 
 #ifndef _WIN32
+#include <fcntl.h>
 #include <strings.h>
+#include <sys/mman.h>
+#include <unistd.h>
 #endif
 
 
@@ -352,6 +355,117 @@ std::string CreateFileContentHash(const std::string &filename)
     return "";
 }
 
+MappedFile::MappedFile(const char * filename)
+{
+    if (!filename || !*filename)
+    {
+        throw Exception("A file name is needed to map a file.");
+    }
+
+#ifdef _WIN32
+    // Other processes could rename or remove the file while it is mapped (e.g. the disk cache
+    // entries).
+    const DWORD shareMode = FILE_SHARE_READ | FILE_SHARE_DELETE;
+#ifdef UNICODE
+    m_file = CreateFileW(Utf8ToUtf16(filename).c_str(), GENERIC_READ, shareMode, nullptr,
+                         OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+#else
+    m_file = CreateFileA(filename, GENERIC_READ, shareMode, nullptr,
+                         OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+#endif
+
+    LARGE_INTEGER fileSize;
+    if (m_file == INVALID_HANDLE_VALUE || !GetFileSizeEx(m_file, &fileSize))
+    {
+        if (m_file != INVALID_HANDLE_VALUE)
+        {
+            CloseHandle(m_file);
+        }
+        std::ostringstream os;
+        os << "Error could not read '" << filename << "'.";
+        throw Exception(os.str().c_str());
+    }
+
+    m_size = static_cast<size_t>(fileSize.QuadPart);
+    if (m_size == 0)
+    {
+        // An empty file cannot be mapped.
+        return;
+    }
+
+    m_mapping = CreateFileMapping(m_file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    const void * view = m_mapping ? MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+    if (!view)
+    {
+        if (m_mapping)
+        {
+            CloseHandle(m_mapping);
+        }
+        CloseHandle(m_file);
+        std::ostringstream os;
+        os << "Error could not map '" << filename << "'.";
+        throw Exception(os.str().c_str());
+    }
+#else
+    const int fd = open(filename, O_RDONLY);
+
+    struct stat fileInfo;
+    if (fd == -1 || fstat(fd, &fileInfo) != 0)
+    {
+        if (fd != -1)
+        {
+            close(fd);
+        }
+        std::ostringstream os;
+        os << "Error could not read '" << filename << "'.";
+        throw Exception(os.str().c_str());
+    }
+
+    m_size = static_cast<size_t>(fileInfo.st_size);
+    if (m_size == 0)
+    {
+        // An empty file cannot be mapped.
+        close(fd);
+        return;
+    }
+
+    void * view = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    // The mapping stays valid once the file descriptor is closed.
+    close(fd);
+    if (view == MAP_FAILED)
+    {
+        std::ostringstream os;
+        os << "Error could not map '" << filename << "'.";
+        throw Exception(os.str().c_str());
+    }
+#endif
+
+    m_data = static_cast<const char *>(view);
+}
+
+MappedFile::~MappedFile()
+{
+#ifdef _WIN32
+    if (m_data)
+    {
+        UnmapViewOfFile(m_data);
+    }
+    if (m_mapping)
+    {
+        CloseHandle(m_mapping);
+    }
+    if (m_file != INVALID_HANDLE_VALUE)
+    {
+        CloseHandle(m_file);
+    }
+#else
+    if (m_data)
+    {
+        munmap(const_cast<char *>(m_data), m_size);
+    }
+#endif
+}
+
 } // Platform
 
 } // namespace OCIO_NAMESPACE
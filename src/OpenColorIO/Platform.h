@@ -106,6 +106,29 @@ void OpenInputFileStream(std::ifstream & stream, const char * filename, std::ios
 // Create a unique hash of a file provided as a UTF-8 filename on any platform.
 std::string CreateFileContentHash(const std::string &filename);
 
+// Read-only memory mapping of a whole file provided as a UTF-8 filename on any platform.
+// An exception is thrown if the file cannot be opened or mapped. The mapping is released by
+// the destructor so the data must not be used after the instance is destroyed.
+class MappedFile
+{
+public:
+    explicit MappedFile(const char * filename);
+    MappedFile(const MappedFile &) = delete;
+    MappedFile & operator=(const MappedFile &) = delete;
+    ~MappedFile();
+
+    const char * data() const noexcept { return m_data; }
+    size_t size() const noexcept { return m_size; }
+
+private:
+    const char * m_data = nullptr;
+    size_t m_size = 0;
+#ifdef _WIN32
+    HANDLE m_file = INVALID_HANDLE_VALUE;
+    HANDLE m_mapping = nullptr;
+#endif
+};
+
 // Convert UTF-8 string to UTF-16LE.
 std::wstring Utf8ToUtf16(const std::string & str);
 
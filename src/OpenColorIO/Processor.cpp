@@ -13,6 +13,8 @@
 #include "HashUtils.h"
 #include "Logging.h"
 #include "OpBuilders.h"
+#include "ops/lut1d/Lut1DOpData.h"
+#include "ops/lut3d/Lut3DOpData.h"
 #include "ops/noop/NoOps.h"
 #include "Processor.h"
 #include "TransformBuilder.h"
@@ -218,6 +220,15 @@ ConstCPUProcessorRcPtr Processor::getOptimizedCPUProcessor(BitDepth inBitDepth,
     return getImpl()->getOptimizedCPUProcessor(inBitDepth, outBitDepth, oFlags);
 }
 
+ConstCPUProcessorRcPtr Processor::getOptimizedCPUProcessor(
+    BitDepth inBitDepth,
+    BitDepth outBitDepth,
+    OptimizationFlags oFlags,
+    const CPUApproximations & approximations) const
+{
+    return getImpl()->getOptimizedCPUProcessor(inBitDepth, outBitDepth, oFlags, approximations);
+}
+
 
 // Instantiate the cache with the right types.
 template class ProcessorCache<std::size_t, ProcessorRcPtr>;
@@ -331,8 +342,9 @@ const char * Processor::Impl::getCacheID() const
     if(!m_cacheID.empty()) return m_cacheID.c_str();
 
     // Note: empty ops vector will also create a UUID.
-    const std::string fullstr = m_ops.getCacheID();
-    m_cacheID = CacheIDHashUUID(fullstr.c_str(), fullstr.size());
+    CacheIDHasher hasher;
+    m_ops.getCacheID(hasher);
+    m_cacheID = hasher.digest().toUUID();
 
     return m_cacheID.c_str();
 }
@@ -351,6 +363,38 @@ OptimizationFlags EnvironmentOverride(OptimizationFlags oFlags)
     }
     return oFlags;
 }
+
+// Combine the bit-depths & the optimization flags into a cache key without any heap allocation.
+std::size_t ComputeProcessorKey(BitDepth inBitDepth, BitDepth outBitDepth, OptimizationFlags oFlags)
+{
+    const uint64_t key = (static_cast<uint64_t>(inBitDepth) << 48)
+                       ^ (static_cast<uint64_t>(outBitDepth) << 40)
+                       ^ static_cast<uint64_t>(static_cast<uint32_t>(oFlags));
+
+    return std::hash<uint64_t>{}(key);
+}
+
+// Also include the approximations, which only change the key when they are not the default ones.
+std::size_t ComputeProcessorKey(BitDepth inBitDepth, BitDepth outBitDepth, OptimizationFlags oFlags,
+                                const CPUApproximations & approximations)
+{
+    const std::size_t key = ComputeProcessorKey(inBitDepth, outBitDepth, oFlags);
+    if (approximations == CPUApproximations())
+    {
+        return key;
+    }
+
+    CacheIDHasher hasher;
+    hasher.update(&key, sizeof(key))
+          .update(&approximations.m_separablePrefixF32, sizeof(bool))
+          .update(&approximations.m_bakeLut3D, sizeof(bool))
+          .update(&approximations.m_bakeLut3DEdgeLength, sizeof(unsigned))
+          .update(&approximations.m_bakeLut3DShaperMinStops, sizeof(double))
+          .update(&approximations.m_bakeLut3DShaperMaxStops, sizeof(double))
+          .update(&approximations.m_bakeLut3DMaxError, sizeof(double));
+
+    return std::hash<CacheIDDigest>{}(hasher.digest());
+}
 }
 
 ConstProcessorRcPtr Processor::Impl::getOptimizedProcessor(OptimizationFlags oFlags) const
@@ -386,10 +430,7 @@ ConstProcessorRcPtr Processor::Impl::getOptimizedProcessor(BitDepth inBitDepth,
     {
         AutoMutex guard(m_optProcessorCache.lock());
 
-        std::ostringstream oss;
-        oss << inBitDepth << outBitDepth << oFlags;
-
-        const std::size_t key = std::hash<std::string>{}(oss.str());
+        const std::size_t key = ComputeProcessorKey(inBitDepth, outBitDepth, oFlags);
 
         // As the entry is a shared pointer instance, having an empty one means that the entry does
         // not exist in the cache. So, it provides a fast existence check & access in one call.
@@ -516,18 +557,29 @@ ConstCPUProcessorRcPtr Processor::Impl::getOptimizedCPUProcessor(OptimizationFla
 ConstCPUProcessorRcPtr Processor::Impl::getOptimizedCPUProcessor(BitDepth inBitDepth,
                                                                  BitDepth outBitDepth,
                                                                  OptimizationFlags oFlags) const
+{
+    return getOptimizedCPUProcessor(inBitDepth, outBitDepth, oFlags, CPUApproximations());
+}
+
+ConstCPUProcessorRcPtr Processor::Impl::getOptimizedCPUProcessor(
+    BitDepth inBitDepth,
+    BitDepth outBitDepth,
+    OptimizationFlags oFlags,
+    const CPUApproximations & approximations) const
 {
     // Helper method.
-    auto CreateProcessor = [](const OpRcPtrVec & ops,
-                              BitDepth inBitDepth,
-                              BitDepth outBitDepth,
-                              OptimizationFlags oFlags) -> CPUProcessorRcPtr
+    auto CreateProcessor = [&approximations](const OpRcPtrVec & ops,
+                                             BitDepth inBitDepth,
+                                             BitDepth outBitDepth,
+                                             OptimizationFlags oFlags) -> CPUProcessorRcPtr
     {
         CPUProcessorRcPtr cpu = CPUProcessorRcPtr(new CPUProcessor(), &CPUProcessor::deleter);
-        cpu->getImpl()->finalize(ops, inBitDepth, outBitDepth, oFlags);
+        cpu->getImpl()->finalize(ops, inBitDepth, outBitDepth, oFlags, approximations);
         return cpu;
     };
 
+    approximations.validate();
+
     oFlags = EnvironmentOverride(oFlags);
 
     const bool shareDynamicProperties 
@@ -539,10 +591,8 @@ ConstCPUProcessorRcPtr Processor::Impl::getOptimizedCPUProcessor(BitDepth inBitD
     {
         AutoMutex guard(m_cpuProcessorCache.lock());
 
-        std::ostringstream oss;
-        oss << inBitDepth << outBitDepth << oFlags;
-
-        const std::size_t key = std::hash<std::string>{}(oss.str());
+        const std::size_t key
+            = ComputeProcessorKey(inBitDepth, outBitDepth, oFlags, approximations);
 
         // As the entry is a shared pointer instance, having an empty one means that the entry does
         // not exist in the cache. So, it provides a fast existence check & access in one call.
@@ -571,6 +621,32 @@ void Processor::Impl::setProcessorCacheFlags(ProcessorCacheFlags flags) noexcept
     m_cpuProcessorCache.enable(cacheEnabled);
 }
 
+size_t Processor::Impl::getMemoryFootprint() const noexcept
+{
+    // Only the LUTs are accounted for as all the other ops are negligible.
+    size_t numBytes = sizeof(Processor) + sizeof(Processor::Impl);
+
+    for (const auto & op : m_ops)
+    {
+        ConstOpRcPtr constOp = op;
+        ConstOpDataRcPtr data = constOp->data();
+        numBytes += sizeof(Op);
+
+        if (data->getType() == OpData::Lut1DType)
+        {
+            auto lut = OCIO_DYNAMIC_POINTER_CAST<const Lut1DOpData>(data);
+            numBytes += lut->getArray().getValues().size() * sizeof(float);
+        }
+        else if (data->getType() == OpData::Lut3DType)
+        {
+            auto lut = OCIO_DYNAMIC_POINTER_CAST<const Lut3DOpData>(data);
+            numBytes += lut->getArray().getValues().size() * sizeof(float);
+        }
+    }
+
+    return numBytes;
+}
+
 ///////////////////////////////////////////////////////////////////////////
 
 
@@ -83,10 +83,17 @@ public:
     ConstCPUProcessorRcPtr getOptimizedCPUProcessor(BitDepth inBitDepth,
                                                     BitDepth outBitDepth,
                                                     OptimizationFlags oFlags) const;
+    ConstCPUProcessorRcPtr getOptimizedCPUProcessor(BitDepth inBitDepth,
+                                                    BitDepth outBitDepth,
+                                                    OptimizationFlags oFlags,
+                                                    const CPUApproximations & approximations) const;
 
     // Enable or disable the internal caches.
     void setProcessorCacheFlags(ProcessorCacheFlags flags) noexcept;
 
+    // Estimate the memory footprint (in bytes) of the processor.
+    size_t getMemoryFootprint() const noexcept;
+
     ////////////////////////////////////////////
     //
     // Builder functions, Not exposed
@@ -0,0 +1,216 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#ifndef INCLUDED_OCIO_SIMDMATH_H
+#define INCLUDED_OCIO_SIMDMATH_H
+
+#include <limits>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+namespace OCIO_NAMESPACE
+{
+
+// SIMDFloat & SIMDMask are used to write the SoA versions of the CPU renderers (i.e. each
+// vector holds one channel of Ops::size pixels) with the same expressions than their scalar
+// versions. The Ops type of an instruction set (refer to SSE2FloatOps, AVX2FloatOps &
+// AVX512FloatOps) provides the Float & Mask vector types and the operations on them:
+//
+//   Ops::size                                      the number of lanes,
+//   Ops::load(in), store(out, v)                   load & store Ops::size float values,
+//   Ops::loadRGBA(in, r, g, b, a)                  load Ops::size RGBA float pixels,
+//   Ops::storeRGBA(out, r, g, b, a)                store Ops::size RGBA float pixels,
+//   Ops::set1, add, sub, mul, div, sqrt, floor, ceil, abs, copySign,
+//   Ops::min, max                                  with the SSE semantics (i.e. return the
+//                                                  second argument if one is a NaN),
+//   Ops::lt, le, gt, ge, eq                        ordered comparisons,
+//   Ops::neq                                       unordered comparison (i.e. true for NaN),
+//   Ops::maskAnd, maskOr, maskNot, any, all, select,
+//   Ops::exponent, mantissa                        unbiased exponent & mantissa in [1, 2),
+//   Ops::pow2i                                     2^n for an integral n in [-126, 127].
+//
+// Note: As the templates below are instantiated in the translation units of each instruction
+// set, they must not rely on any non-template inline function compiled without these flags.
+
+template<typename Ops> struct SIMDMask
+{
+    typename Ops::Mask m_v;
+
+    SIMDMask() = default;
+    SIMDMask(typename Ops::Mask v) : m_v(v) {}
+
+    friend SIMDMask operator&(SIMDMask a, SIMDMask b) { return Ops::maskAnd(a.m_v, b.m_v); }
+    friend SIMDMask operator|(SIMDMask a, SIMDMask b) { return Ops::maskOr(a.m_v, b.m_v); }
+    friend SIMDMask operator!(SIMDMask a) { return Ops::maskNot(a.m_v); }
+
+    friend bool Any(SIMDMask a) { return Ops::any(a.m_v); }
+    friend bool All(SIMDMask a) { return Ops::all(a.m_v); }
+};
+
+template<typename Ops> struct SIMDFloat
+{
+    typedef SIMDMask<Ops> Mask;
+
+    static constexpr unsigned size = Ops::size;
+
+    typename Ops::Float m_v;
+
+    SIMDFloat() = default;
+    SIMDFloat(typename Ops::Float v) : m_v(v) {}
+    SIMDFloat(float v) : m_v(Ops::set1(v)) {}
+
+    // Non-template friends so that a float operand is implicitly converted.
+    friend SIMDFloat operator+(SIMDFloat a, SIMDFloat b) { return Ops::add(a.m_v, b.m_v); }
+    friend SIMDFloat operator-(SIMDFloat a, SIMDFloat b) { return Ops::sub(a.m_v, b.m_v); }
+    friend SIMDFloat operator*(SIMDFloat a, SIMDFloat b) { return Ops::mul(a.m_v, b.m_v); }
+    friend SIMDFloat operator/(SIMDFloat a, SIMDFloat b) { return Ops::div(a.m_v, b.m_v); }
+    friend SIMDFloat operator-(SIMDFloat a) { return Ops::sub(Ops::set1(0.f), a.m_v); }
+
+    SIMDFloat & operator+=(SIMDFloat b) { m_v = Ops::add(m_v, b.m_v); return *this; }
+    SIMDFloat & operator-=(SIMDFloat b) { m_v = Ops::sub(m_v, b.m_v); return *this; }
+    SIMDFloat & operator*=(SIMDFloat b) { m_v = Ops::mul(m_v, b.m_v); return *this; }
+    SIMDFloat & operator/=(SIMDFloat b) { m_v = Ops::div(m_v, b.m_v); return *this; }
+
+    friend Mask operator<(SIMDFloat a, SIMDFloat b)  { return Ops::lt(a.m_v, b.m_v); }
+    friend Mask operator<=(SIMDFloat a, SIMDFloat b) { return Ops::le(a.m_v, b.m_v); }
+    friend Mask operator>(SIMDFloat a, SIMDFloat b)  { return Ops::gt(a.m_v, b.m_v); }
+    friend Mask operator>=(SIMDFloat a, SIMDFloat b) { return Ops::ge(a.m_v, b.m_v); }
+    friend Mask operator==(SIMDFloat a, SIMDFloat b) { return Ops::eq(a.m_v, b.m_v); }
+    friend Mask operator!=(SIMDFloat a, SIMDFloat b) { return Ops::neq(a.m_v, b.m_v); }
+
+    // Same as (mask ? a : b) for each lane.
+    friend SIMDFloat Select(Mask mask, SIMDFloat a, SIMDFloat b)
+    {
+        return Ops::select(mask.m_v, a.m_v, b.m_v);
+    }
+
+    // Same results as std::min & std::max, including for NaN values.
+    friend SIMDFloat Min(SIMDFloat a, SIMDFloat b) { return Ops::min(b.m_v, a.m_v); }
+    friend SIMDFloat Max(SIMDFloat a, SIMDFloat b) { return Ops::max(b.m_v, a.m_v); }
+
+    friend SIMDFloat Sqrt(SIMDFloat a)  { return Ops::sqrt(a.m_v); }
+    friend SIMDFloat Floor(SIMDFloat a) { return Ops::floor(a.m_v); }
+    friend SIMDFloat Ceil(SIMDFloat a)  { return Ops::ceil(a.m_v); }
+    friend SIMDFloat Abs(SIMDFloat a)   { return Ops::abs(a.m_v); }
+
+    friend SIMDFloat CopySign(SIMDFloat mag, SIMDFloat sgn)
+    {
+        return Ops::copySign(mag.m_v, sgn.m_v);
+    }
+
+    // Same algorithm & polynomials as sseLog2() (refer to SSE.h).
+    friend SIMDFloat Log2(SIMDFloat x)
+    {
+        const SIMDFloat mantissa = Ops::mantissa(x.m_v);
+
+        const SIMDFloat log2
+            = ((((  (float)+4.487361286440374006195e-2  * mantissa
+                  + (float)-4.165637071209677112635e-1) * mantissa
+                  + (float)+1.631148826119436277100)    * mantissa
+                  + (float)-3.550793018041176193407)    * mantissa
+                  + (float)+5.091710879305474367557)    * mantissa
+                  + (float)-2.800364054395965731506;
+
+        return log2 + SIMDFloat(Ops::exponent(x.m_v));
+    }
+
+    // Same algorithm & polynomials as sseExp2() (refer to SSE.h).
+    friend SIMDFloat Exp2(SIMDFloat x)
+    {
+        const SIMDFloat floorX = Floor(x);
+        const SIMDFloat fraction = x - floorX;
+
+        // exp2(floor(x)) is wrong outside of [-126, 128[ but it's handled below.
+        const SIMDFloat zf = Ops::pow2i(Min(Max(floorX, -127.f), 127.f).m_v);
+
+        const SIMDFloat mexp
+            = (((  (float)1.353416792833547468620e-2  * fraction
+                 + (float)5.201146058412685018921e-2) * fraction
+                 + (float)2.414427569091865207710e-1) * fraction
+                 + (float)6.930038344665415134202e-1) * fraction
+                 + (float)1.000002593370603213644;
+
+        SIMDFloat exp2 = zf * mexp;
+
+        // Handle the underflow & overflow.
+        exp2 = Select(x < -126.f, 0.f, exp2);
+        exp2 = Select(x >= 128.f, std::numeric_limits<float>::infinity(), exp2);
+
+        return exp2;
+    }
+
+    // Same as ssePower() i.e. base values smaller or equal than zero are mapped to zero.
+    friend SIMDFloat Power(SIMDFloat x, SIMDFloat exp)
+    {
+        return Select(x > 0.f, Exp2(exp * Log2(x)), 0.f);
+    }
+};
+
+// Apply the scalar function on each lane e.g. when a vectorized approximation is not accurate
+// enough. Note that the function must not call a non-template inline function (refer to the
+// note above).
+template<typename Ops, typename Func>
+SIMDFloat<Ops> ApplyPerLane(const SIMDFloat<Ops> & x, const Func & func)
+{
+    float lanes[Ops::size];
+    Ops::store(lanes, x.m_v);
+    for (unsigned lane = 0; lane < Ops::size; ++lane)
+    {
+        lanes[lane] = func(lanes[lane]);
+    }
+    return Ops::load(lanes);
+}
+
+// Apply the kernel on SIMDFloat<Ops>::size pixels at a time. The kernel gets the R, G & B
+// channels of the pixels and the alpha channel is left unchanged. Note that the last packet
+// is padded with its last pixel.
+template<typename Ops, typename Kernel>
+void ApplyRGBASoA(const float * src, float * dst, long numPixels, const Kernel & kernel)
+{
+    constexpr unsigned size = Ops::size;
+
+    typename Ops::Float r, g, b, a;
+
+    long idx = 0;
+    for (; idx + (long)size <= numPixels; idx += size)
+    {
+        Ops::loadRGBA(src + 4 * idx, r, g, b, a);
+
+        SIMDFloat<Ops> red(r), grn(g), blu(b);
+        kernel(red, grn, blu);
+
+        Ops::storeRGBA(dst + 4 * idx, red.m_v, grn.m_v, blu.m_v, a);
+    }
+
+    if (idx < numPixels)
+    {
+        const unsigned count = (unsigned)(numPixels - idx);
+
+        float buffer[4 * size];
+        for (unsigned pix = 0; pix < size; ++pix)
+        {
+            const float * in = src + 4 * (idx + (pix < count ? pix : count - 1));
+            buffer[4 * pix + 0] = in[0];
+            buffer[4 * pix + 1] = in[1];
+            buffer[4 * pix + 2] = in[2];
+            buffer[4 * pix + 3] = in[3];
+        }
+
+        Ops::loadRGBA(buffer, r, g, b, a);
+
+        SIMDFloat<Ops> red(r), grn(g), blu(b);
+        kernel(red, grn, blu);
+
+        Ops::storeRGBA(buffer, red.m_v, grn.m_v, blu.m_v, a);
+
+        for (unsigned i = 0; i < 4 * count; ++i)
+        {
+            dst[4 * idx + i] = buffer[i];
+        }
+    }
+}
+
+} // namespace OCIO_NAMESPACE
+
+#endif /* INCLUDED_OCIO_SIMDMATH_H */
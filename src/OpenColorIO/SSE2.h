@@ -400,6 +400,105 @@ struct SSE2RGBAPack<BIT_DEPTH_F32>
     }
 };
 
+// Operations on the float vectors of the SoA renderers (refer to SIMDMath.h).
+struct SSE2FloatOps
+{
+    typedef __m128 Float;
+    typedef __m128 Mask;
+
+    static constexpr unsigned size = 4;
+
+    static inline void loadRGBA(const float * in, Float & r, Float & g, Float & b, Float & a)
+    {
+        SSE2RGBAPack<BIT_DEPTH_F32>::Load(in, r, g, b, a);
+    }
+
+    static inline void storeRGBA(float * out, Float r, Float g, Float b, Float a)
+    {
+        SSE2RGBAPack<BIT_DEPTH_F32>::Store(out, r, g, b, a);
+    }
+
+    static inline Float load(const float * in) { return _mm_loadu_ps(in); }
+    static inline void store(float * out, Float v) { _mm_storeu_ps(out, v); }
+
+    static inline Float set1(float v) { return _mm_set1_ps(v); }
+
+    static inline Float add(Float a, Float b) { return _mm_add_ps(a, b); }
+    static inline Float sub(Float a, Float b) { return _mm_sub_ps(a, b); }
+    static inline Float mul(Float a, Float b) { return _mm_mul_ps(a, b); }
+    static inline Float div(Float a, Float b) { return _mm_div_ps(a, b); }
+    static inline Float min(Float a, Float b) { return _mm_min_ps(a, b); }
+    static inline Float max(Float a, Float b) { return _mm_max_ps(a, b); }
+
+    static inline Float sqrt(Float a) { return _mm_sqrt_ps(a); }
+
+    // There is no rounding instruction before SSE4.1 so truncate & adjust the result. Note that
+    // the values too large for an int32 are already integral (and NaN & infinity are kept).
+    static inline Float floor(Float a)
+    {
+        const __m128 trunc = _mm_cvtepi32_ps(_mm_cvttps_epi32(a));
+        const __m128 res = _mm_sub_ps(trunc, _mm_and_ps(_mm_cmpgt_ps(trunc, a), _mm_set1_ps(1.f)));
+        return select(_mm_cmplt_ps(abs(a), _mm_set1_ps(8388608.f)), res, a);
+    }
+
+    static inline Float ceil(Float a)
+    {
+        const __m128 trunc = _mm_cvtepi32_ps(_mm_cvttps_epi32(a));
+        const __m128 res = _mm_add_ps(trunc, _mm_and_ps(_mm_cmplt_ps(trunc, a), _mm_set1_ps(1.f)));
+        return select(_mm_cmplt_ps(abs(a), _mm_set1_ps(8388608.f)), res, a);
+    }
+
+    static inline Float abs(Float a)
+    {
+        return _mm_andnot_ps(_mm_set1_ps(-0.f), a);
+    }
+
+    static inline Float copySign(Float mag, Float sgn)
+    {
+        const __m128 signMask = _mm_set1_ps(-0.f);
+        return _mm_or_ps(_mm_andnot_ps(signMask, mag), _mm_and_ps(signMask, sgn));
+    }
+
+    static inline Mask lt(Float a, Float b)  { return _mm_cmplt_ps(a, b); }
+    static inline Mask le(Float a, Float b)  { return _mm_cmple_ps(a, b); }
+    static inline Mask gt(Float a, Float b)  { return _mm_cmpgt_ps(a, b); }
+    static inline Mask ge(Float a, Float b)  { return _mm_cmpge_ps(a, b); }
+    static inline Mask eq(Float a, Float b)  { return _mm_cmpeq_ps(a, b); }
+    static inline Mask neq(Float a, Float b) { return _mm_cmpneq_ps(a, b); }
+
+    static inline Mask maskAnd(Mask a, Mask b) { return _mm_and_ps(a, b); }
+    static inline Mask maskOr(Mask a, Mask b)  { return _mm_or_ps(a, b); }
+    static inline Mask maskNot(Mask a)
+    {
+        return _mm_xor_ps(a, _mm_castsi128_ps(_mm_set1_epi32(-1)));
+    }
+
+    static inline bool any(Mask m) { return _mm_movemask_ps(m) != 0; }
+    static inline bool all(Mask m) { return _mm_movemask_ps(m) == 0xf; }
+
+    static inline Float select(Mask m, Float a, Float b)
+    {
+        return _mm_or_ps(_mm_and_ps(m, a), _mm_andnot_ps(m, b));
+    }
+
+    static inline Float exponent(Float x)
+    {
+        const __m128i bits = _mm_and_si128(_mm_castps_si128(x), _mm_set1_epi32(0x7F800000));
+        return _mm_cvtepi32_ps(_mm_sub_epi32(_mm_srli_epi32(bits, 23), _mm_set1_epi32(127)));
+    }
+
+    static inline Float mantissa(Float x)
+    {
+        return _mm_or_ps(_mm_andnot_ps(_mm_castsi128_ps(_mm_set1_epi32(0x7F800000)), x),
+                         _mm_set1_ps(1.f));
+    }
+
+    static inline Float pow2i(Float n)
+    {
+        return _mm_castsi128_ps(
+            _mm_slli_epi32(_mm_add_epi32(_mm_cvttps_epi32(n), _mm_set1_epi32(127)), 23));
+    }
+};
 
 } // namespace OCIO_NAMESPACE
 
@@ -2,6 +2,7 @@
 // Copyright Contributors to the OpenColorIO Project.
 
 #include <algorithm>
+#include <new>
 
 #include <OpenColorIO/OpenColorIO.h>
 
@@ -30,6 +31,103 @@ Optimizations GetOptimizationMode(const GenericImageDesc & imgDesc)
 }
 
 
+namespace
+{
+
+void * AllocateScratch(size_t numBytes)
+{
+    return ::operator new(numBytes, std::align_val_t(ScratchBuffer::Alignment));
+}
+
+void FreeScratch(void * data) noexcept
+{
+    ::operator delete(data, std::align_val_t(ScratchBuffer::Alignment));
+}
+
+// The per-thread memory shared by the successive ScratchBuffer instances.
+struct ScratchArena
+{
+    ScratchArena() = default;
+    ScratchArena(const ScratchArena &) = delete;
+    ScratchArena & operator=(const ScratchArena &) = delete;
+
+    ~ScratchArena()
+    {
+        FreeScratch(m_data);
+    }
+
+    void * m_data = nullptr;
+    size_t m_size = 0;
+    bool m_inUse  = false;
+};
+
+thread_local ScratchArena g_scratchArena;
+
+} // anon
+
+ScratchBuffer::~ScratchBuffer()
+{
+    release();
+}
+
+void * ScratchBuffer::acquire(size_t numBytes)
+{
+    if (numBytes <= m_size)
+    {
+        return m_data;
+    }
+
+    if (!m_data && !g_scratchArena.m_inUse)
+    {
+        g_scratchArena.m_inUse = true;
+        m_usesArena = true;
+    }
+
+    if (m_usesArena)
+    {
+        if (numBytes > g_scratchArena.m_size)
+        {
+            FreeScratch(g_scratchArena.m_data);
+            g_scratchArena.m_data = nullptr;
+            g_scratchArena.m_size = 0;
+
+            g_scratchArena.m_data = AllocateScratch(numBytes);
+            g_scratchArena.m_size = numBytes;
+        }
+
+        m_data = g_scratchArena.m_data;
+        m_size = g_scratchArena.m_size;
+    }
+    else
+    {
+        FreeScratch(m_data);
+        m_data = nullptr;
+        m_size = 0;
+
+        m_data = AllocateScratch(numBytes);
+        m_size = numBytes;
+    }
+
+    return m_data;
+}
+
+void ScratchBuffer::release() noexcept
+{
+    if (m_usesArena)
+    {
+        g_scratchArena.m_inUse = false;
+    }
+    else
+    {
+        FreeScratch(m_data);
+    }
+
+    m_data = nullptr;
+    m_size = 0;
+    m_usesArena = false;
+}
+
+
 template<typename InType, typename OutType>
 GenericScanlineHelper<InType, OutType>::GenericScanlineHelper(BitDepth inputBitDepth,
                                                               const ConstOpCPURcPtr & inBitDepthOp,
@@ -43,6 +141,7 @@ GenericScanlineHelper<InType, OutType>::GenericScanlineHelper(BitDepth inputBitD
     ,   m_inOptimizedMode(NO_OPTIMIZATION)
     ,   m_outOptimizedMode(NO_OPTIMIZATION)
     ,   m_yIndex(0)
+    ,   m_yEnd(0)
     ,   m_useDstBuffer(false)
 {
 }
@@ -60,6 +159,8 @@ void GenericScanlineHelper<InType, OutType>::init(const ImageDesc & srcImg, cons
         throw Exception("Dimension inconsistency between source and destination image buffers.");
     }
 
+    m_yEnd = m_dstImg.m_height;
+
     m_inOptimizedMode  = GetOptimizationMode(m_srcImg);
     m_outOptimizedMode = GetOptimizationMode(m_dstImg);
 
@@ -67,18 +168,8 @@ void GenericScanlineHelper<InType, OutType>::init(const ImageDesc & srcImg, cons
     m_useDstBuffer
         = (m_outOptimizedMode & PACKED_FLOAT_OPTIMIZATION) == PACKED_FLOAT_OPTIMIZATION;
 
-    if( (m_inOptimizedMode & PACKED_OPTIMIZATION) != PACKED_OPTIMIZATION)
-    {
-        const long bufferSize = 4 * m_dstImg.m_width;
-        m_inBitDepthBuffer.resize(bufferSize);
-    }
-
-    if(!m_useDstBuffer)
-    {
-        const long bufferSize = 4 * m_dstImg.m_width;
-        m_rgbaFloatBuffer.resize(bufferSize);
-        m_outBitDepthBuffer.resize(bufferSize);
-    }
+    allocateBuffers((m_inOptimizedMode & PACKED_OPTIMIZATION) != PACKED_OPTIMIZATION,
+                    !m_useDstBuffer);
 }
 
 template<typename InType, typename OutType>
@@ -89,6 +180,8 @@ void GenericScanlineHelper<InType, OutType>::init(const ImageDesc & img)
     m_srcImg.init(img, m_inputBitDepth, m_inBitDepthOp);
     m_dstImg.init(img, m_outputBitDepth, m_outBitDepthOp);
 
+    m_yEnd = m_dstImg.m_height;
+
     m_inOptimizedMode  = GetOptimizationMode(m_srcImg);
     m_outOptimizedMode = m_inOptimizedMode;
 
@@ -96,17 +189,55 @@ void GenericScanlineHelper<InType, OutType>::init(const ImageDesc & img)
     m_useDstBuffer
         = (m_outOptimizedMode & PACKED_FLOAT_OPTIMIZATION) == PACKED_FLOAT_OPTIMIZATION;
 
-    if(!m_useDstBuffer)
+    allocateBuffers(!m_useDstBuffer, !m_useDstBuffer);
+}
+
+template<typename InType, typename OutType>
+void GenericScanlineHelper<InType, OutType>::allocateBuffers(bool inBitDepthBuffer,
+                                                             bool rgbaAndOutBitDepthBuffers)
+{
+    const size_t numValues = 4 * size_t(m_dstImg.m_width);
+
+    const size_t inSize
+        = inBitDepthBuffer ? ScratchBuffer::AlignSize(numValues * sizeof(InType)) : 0;
+    const size_t rgbaSize
+        = rgbaAndOutBitDepthBuffers ? ScratchBuffer::AlignSize(numValues * sizeof(float)) : 0;
+    const size_t outSize
+        = rgbaAndOutBitDepthBuffers ? ScratchBuffer::AlignSize(numValues * sizeof(OutType)) : 0;
+
+    m_rgbaFloatBuffer    = nullptr;
+    m_inBitDepthBuffer   = nullptr;
+    m_outBitDepthBuffer  = nullptr;
+
+    if (inSize + rgbaSize + outSize == 0)
     {
-        // TODO: Re-use memory from thread-safe memory pool, rather
-        // than doing a new allocation each time.
+        return;
+    }
 
-        const long bufferSize = 4 * m_dstImg.m_width;
+    char * data = static_cast<char *>(m_scratch.acquire(inSize + rgbaSize + outSize));
 
-        m_rgbaFloatBuffer.resize(bufferSize);
-        m_inBitDepthBuffer.resize(bufferSize);
-        m_outBitDepthBuffer.resize(bufferSize);
+    if (inBitDepthBuffer)
+    {
+        m_inBitDepthBuffer = reinterpret_cast<InType *>(data);
     }
+
+    if (rgbaAndOutBitDepthBuffers)
+    {
+        m_rgbaFloatBuffer   = reinterpret_cast<float *>(data + inSize);
+        m_outBitDepthBuffer = reinterpret_cast<OutType *>(data + inSize + rgbaSize);
+    }
+}
+
+template<typename InType, typename OutType>
+void GenericScanlineHelper<InType, OutType>::setLineRange(long yBegin, long yEnd)
+{
+    if (yBegin < 0 || yBegin > yEnd || yEnd > m_dstImg.m_height)
+    {
+        throw Exception("Invalid line range for the image buffer.");
+    }
+
+    m_yIndex = yBegin;
+    m_yEnd   = yEnd;
 }
 
 template<typename InType, typename OutType>
@@ -120,14 +251,14 @@ void GenericScanlineHelper<InType, OutType>::prepRGBAScanline(float** buffer, lo
 {
     // Note that only a line-by-line processing is done on the image buffer.
 
-    if(m_yIndex >= m_dstImg.m_height)
+    if(m_yIndex >= m_yEnd)
     {
         numPixels = 0;
         return;
     }
 
     *buffer = m_useDstBuffer ? (float*)(m_dstImg.m_rData + m_dstImg.m_yStrideBytes * m_yIndex)
-                             : &m_rgbaFloatBuffer[0];
+                             : m_rgbaFloatBuffer;
 
     if((m_inOptimizedMode&PACKED_OPTIMIZATION)==PACKED_OPTIMIZATION)
     {
@@ -140,7 +271,7 @@ void GenericScanlineHelper<InType, OutType>::prepRGBAScanline(float** buffer, lo
         // Pack from any channel ordering & bit-depth to a packed RGBA F32 buffer.
 
         Generic<InType>::PackRGBAFromImageDesc(m_srcImg,
-                                               &m_inBitDepthBuffer[0],
+                                               m_inBitDepthBuffer,
                                                *buffer,
                                                m_dstImg.m_width,
                                                m_yIndex * m_dstImg.m_width, 
@@ -160,7 +291,7 @@ void GenericScanlineHelper<InType, OutType>::finishRGBAScanline()
     {
         void * out = (void*)(m_dstImg.m_rData + m_dstImg.m_yStrideBytes * m_yIndex);
 
-        const void * in  = m_useDstBuffer ? out : (void*)&m_rgbaFloatBuffer[0];
+        const void * in  = m_useDstBuffer ? out : (void*)m_rgbaFloatBuffer;
 
         m_dstImg.m_bitDepthOp->apply(in, out, m_dstImg.m_width);
     }
@@ -168,8 +299,8 @@ void GenericScanlineHelper<InType, OutType>::finishRGBAScanline()
     {
         // Unpack from packed RGBA F32 to any channel ordering & bit-depth.
         Generic<OutType>::UnpackRGBAToImageDesc(m_dstImg,
-                                                &m_rgbaFloatBuffer[0],
-                                                &m_outBitDepthBuffer[0],
+                                                m_rgbaFloatBuffer,
+                                                m_outBitDepthBuffer,
                                                 m_dstImg.m_width,
                                                 m_yIndex * m_dstImg.m_width);
     }
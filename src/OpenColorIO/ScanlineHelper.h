@@ -25,6 +25,42 @@ enum Optimizations
 Optimizations GetOptimizationMode(const GenericImageDesc & imgDesc);
 
 
+// Scratch memory for the scanline processing. The memory comes from a per-thread arena which
+// is kept from one apply call to the next, so there is no allocation once the arena reached
+// the size needed by the largest processed line. A nested use on the same thread falls back
+// to a private allocation.
+class ScratchBuffer
+{
+public:
+    // Alignment (in bytes) of the returned memory blocks i.e. one cache line.
+    static constexpr size_t Alignment = 64;
+
+    ScratchBuffer() = default;
+    ScratchBuffer(const ScratchBuffer &) = delete;
+    ScratchBuffer & operator=(const ScratchBuffer &) = delete;
+
+    ~ScratchBuffer();
+
+    // Return a memory block of at least numBytes bytes. The content of a previously
+    // acquired block is not preserved.
+    void * acquire(size_t numBytes);
+
+    // Round up a size to keep the next block aligned.
+    static constexpr size_t AlignSize(size_t numBytes)
+    {
+        return (numBytes + Alignment - 1) & ~(Alignment - 1);
+    }
+
+private:
+    void release() noexcept;
+
+    void * m_data = nullptr;
+    size_t m_size = 0;
+    bool m_usesArena = false;
+};
+
+
+
 class ScanlineHelper
 {
 public:
@@ -37,6 +73,9 @@ public:
     virtual void init(const ImageDesc & srcImg, const ImageDesc & dstImg) = 0;
     virtual void init(const ImageDesc & img) = 0;
 
+    // Restrict the processing to the lines [yBegin, yEnd) of the image(s) passed to init().
+    virtual void setLineRange(long yBegin, long yEnd) = 0;
+
     virtual void prepRGBAScanline(float** buffer, long & numPixels) = 0;
 
     virtual void finishRGBAScanline() = 0;
@@ -56,6 +95,8 @@ public:
     void init(const ImageDesc & srcImg, const ImageDesc & dstImg) override;
     void init(const ImageDesc & img) override;
 
+    void setLineRange(long yBegin, long yEnd) override;
+
     ~GenericScanlineHelper() override;
 
     // Copy from the src image to our scanline, in our preferred
@@ -80,16 +121,23 @@ private:
     Optimizations m_inOptimizedMode;  // Optimization applicable to the input buffer.
     Optimizations m_outOptimizedMode; // Optimization applicable to the output buffer.
 
+    void allocateBuffers(bool inBitDepthBuffer, bool rgbaAndOutBitDepthBuffers);
+
+    // Memory holding the following buffers.
+    ScratchBuffer m_scratch;
+
     // Processing needs an intermediate buffer as CPU Ops only process packed RGBA F32.
-    std::vector<float> m_rgbaFloatBuffer;
+    float * m_rgbaFloatBuffer = nullptr;
 
     // Processing needs additional buffers of the same pixel type as the input/output
     // in order to convert arbitrary channel order from/to RGBA.
-    std::vector<InType> m_inBitDepthBuffer;
-    std::vector<OutType> m_outBitDepthBuffer;
+    InType * m_inBitDepthBuffer = nullptr;
+    OutType * m_outBitDepthBuffer = nullptr;
 
     // The index of the current line to process.
-    int m_yIndex;
+    long m_yIndex;
+    // The index following the last line to process.
+    long m_yEnd;
 
     // If the destination buffer is packed RGBA F32 it could then be used
     // as the internal processing buffer (i.e. instead of m_rgbaFloatBuffer
@@ -0,0 +1,203 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "ThreadPool.h"
+
+
+namespace OCIO_NAMESPACE
+{
+
+namespace
+{
+
+// The tasks of one RunParallelTasks() call.
+class Job
+{
+public:
+    Job(unsigned numTasks, const std::function<void(unsigned)> & func)
+        :   m_numTasks(numTasks)
+        ,   m_func(func)
+    {
+    }
+
+    Job() = delete;
+    Job(const Job &) = delete;
+    Job & operator=(const Job &) = delete;
+
+    // Process the tasks not yet started. Return when there are no more tasks to start.
+    void runTasks() noexcept
+    {
+        for (unsigned task = m_nextTask++; task < m_numTasks; task = m_nextTask++)
+        {
+            try
+            {
+                m_func(task);
+            }
+            catch (...)
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                if (!m_error)
+                {
+                    m_error = std::current_exception();
+                }
+            }
+
+            if (++m_numDoneTasks == m_numTasks)
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_done.notify_all();
+            }
+        }
+    }
+
+    // Wait for the tasks started by the other threads and rethrow the first error.
+    void wait()
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_done.wait(lock, [this]() { return m_numDoneTasks == m_numTasks; });
+
+        if (m_error)
+        {
+            std::rethrow_exception(m_error);
+        }
+    }
+
+private:
+    const unsigned m_numTasks;
+    // Only called for the tasks in [0, m_numTasks) i.e. never once the job is done.
+    const std::function<void(unsigned)> & m_func;
+
+    std::atomic<unsigned> m_nextTask{ 0 };
+    std::atomic<unsigned> m_numDoneTasks{ 0 };
+
+    std::mutex m_mutex;
+    std::condition_variable m_done;
+    std::exception_ptr m_error;
+};
+
+using JobRcPtr = std::shared_ptr<Job>;
+
+class ThreadPool
+{
+public:
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool & operator=(const ThreadPool &) = delete;
+
+    explicit ThreadPool(unsigned numWorkers)
+    {
+        m_workers.reserve(numWorkers);
+        for (unsigned i = 0; i < numWorkers; ++i)
+        {
+            m_workers.emplace_back(&ThreadPool::workerLoop, this);
+        }
+    }
+
+    void run(unsigned numTasks, const std::function<void(unsigned)> & func)
+    {
+        JobRcPtr job = std::make_shared<Job>(numTasks, func);
+
+        if (!m_workers.empty())
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_jobs.push_back(job);
+        }
+        m_jobAdded.notify_all();
+
+        // The calling thread also processes tasks so the call completes even if all the
+        // workers are busy (e.g. for a task calling RunParallelTasks()).
+        job->runTasks();
+
+        if (!m_workers.empty())
+        {
+            removeJob(job);
+        }
+
+        job->wait();
+    }
+
+private:
+    void workerLoop()
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+
+        while (true)
+        {
+            m_jobAdded.wait(lock, [this]() { return !m_jobs.empty(); });
+
+            JobRcPtr job = m_jobs.front();
+
+            lock.unlock();
+            job->runTasks();
+            lock.lock();
+
+            // All the tasks of the job are started.
+            auto it = std::find(m_jobs.begin(), m_jobs.end(), job);
+            if (it != m_jobs.end())
+            {
+                m_jobs.erase(it);
+            }
+        }
+    }
+
+    void removeJob(const JobRcPtr & job)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        auto it = std::find(m_jobs.begin(), m_jobs.end(), job);
+        if (it != m_jobs.end())
+        {
+            m_jobs.erase(it);
+        }
+    }
+
+    std::vector<std::thread> m_workers;
+
+    std::mutex m_mutex;
+    std::condition_variable m_jobAdded;
+    std::deque<JobRcPtr> m_jobs;
+};
+
+ThreadPool & GetThreadPool()
+{
+    // The pool is never destroyed as joining threads while the library is unloaded could
+    // deadlock (e.g. on Windows). The idle workers only wait for new jobs.
+    static ThreadPool * pool = new ThreadPool(GetNumHardwareThreads() - 1);
+    return *pool;
+}
+
+} // anon.
+
+unsigned GetNumHardwareThreads() noexcept
+{
+    return std::max(1u, std::thread::hardware_concurrency());
+}
+
+void RunParallelTasks(unsigned numTasks, const std::function<void(unsigned)> & func)
+{
+    if (numTasks == 0)
+    {
+        return;
+    }
+
+    if (numTasks == 1)
+    {
+        func(0);
+        return;
+    }
+
+    GetThreadPool().run(numTasks, func);
+}
+
+} // namespace OCIO_NAMESPACE
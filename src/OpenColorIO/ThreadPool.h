@@ -0,0 +1,58 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#ifndef INCLUDED_OCIO_THREADPOOL_H
+#define INCLUDED_OCIO_THREADPOOL_H
+
+
+#include <functional>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+
+/** For internal use only */
+
+namespace OCIO_NAMESPACE
+{
+
+// Return the number of hardware threads (at least one).
+unsigned GetNumHardwareThreads() noexcept;
+
+// Call func(task) for each task in [0, numTasks) concurrently. The tasks are processed by the
+// calling thread and by the worker threads of a pool shared by the whole library i.e. the
+// threads are only created once (i.e. GetNumHardwareThreads() - 1 workers). The tasks could
+// run in any order. Once all the tasks are done, the first exception thrown by a task (if any)
+// is rethrown.
+//
+// Note that a task could call RunParallelTasks() again i.e. the calling thread always processes
+// the remaining tasks itself so the call never waits for a busy pool.
+void RunParallelTasks(unsigned numTasks, const std::function<void(unsigned)> & func);
+
+// Call func(begin, end) on contiguous sub-ranges of [0, numItems) using at most numTasks
+// concurrent tasks (refer to RunParallelTasks). Each call must only write the data of its own
+// sub-range.
+template<typename Func>
+void RunParallelRanges(unsigned long numItems, unsigned numTasks, const Func & func)
+{
+    if (numTasks <= 1 || numItems <= 1)
+    {
+        func(0UL, numItems);
+        return;
+    }
+
+    RunParallelTasks(numTasks, [&](unsigned task)
+    {
+        const unsigned long begin = (unsigned long)(((unsigned long long)numItems * task) / numTasks);
+        const unsigned long end
+            = (unsigned long)(((unsigned long long)numItems * (task + 1)) / numTasks);
+        if (begin < end)
+        {
+            func(begin, end);
+        }
+    });
+}
+
+} // namespace OCIO_NAMESPACE
+
+#endif // INCLUDED_OCIO_THREADPOOL_H
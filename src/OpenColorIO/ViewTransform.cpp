@@ -5,7 +5,7 @@
 
 #include <OpenColorIO/OpenColorIO.h>
 
-#include "TokensManager.h"
+#include "ViewTransform.h"
 
 namespace
 {
@@ -16,52 +16,6 @@ const std::array<const std::string, 1> knownInterchangeNames = {
 namespace OCIO_NAMESPACE
 {
 
-class ViewTransform::Impl
-{
-public:
-    std::string m_name;
-    std::string m_family;
-    std::string m_description;
-    ReferenceSpaceType m_referenceSpaceType{ REFERENCE_SPACE_SCENE };
-    std::map<std::string, std::string> m_interchangeAttribs;
-
-    TransformRcPtr m_toRefTransform;
-    TransformRcPtr m_fromRefTransform;
-
-    TokensManager m_categories;
-
-    Impl() = delete;
-    explicit Impl(ReferenceSpaceType referenceSpace)
-        : m_referenceSpaceType(referenceSpace)
-    {
-    }
-
-    Impl(const Impl &) = delete;
-    ~Impl() = default;
-
-    Impl & operator= (const Impl & rhs)
-    {
-        if (this != &rhs)
-        {
-            m_name        = rhs.m_name;
-            m_family      = rhs.m_family;
-            m_description = rhs.m_description;
-
-            m_referenceSpaceType = rhs.m_referenceSpaceType;
-            m_interchangeAttribs = rhs.m_interchangeAttribs;
-
-            m_toRefTransform = rhs.m_toRefTransform ? rhs.m_toRefTransform->createEditableCopy() :
-                                                      rhs.m_toRefTransform;
-
-            m_fromRefTransform = rhs.m_fromRefTransform ?
-                                 rhs.m_fromRefTransform->createEditableCopy() :
-                                 rhs.m_fromRefTransform;
-
-            m_categories = rhs.m_categories;
-        }
-        return *this;
-    }
-};
 
 
 ViewTransformRcPtr ViewTransform::Create(ReferenceSpaceType referenceSpace)
@@ -213,14 +167,14 @@ ReferenceSpaceType ViewTransform::getReferenceSpaceType() const noexcept
     return getImpl()->m_referenceSpaceType;
 }
 
-ConstTransformRcPtr ViewTransform::getTransform(ViewTransformDirection dir) const noexcept
+ConstTransformRcPtr ViewTransform::getTransform(ViewTransformDirection dir) const
 {
     switch (dir)
     {
     case VIEWTRANSFORM_DIR_TO_REFERENCE:
-        return getImpl()->m_toRefTransform;
+        return ResolveTransform(getImpl()->m_toRefDeferred, getImpl()->m_toRefTransform);
     case VIEWTRANSFORM_DIR_FROM_REFERENCE:
-        return getImpl()->m_fromRefTransform;
+        return ResolveTransform(getImpl()->m_fromRefDeferred, getImpl()->m_fromRefTransform);
     }
     return ConstTransformRcPtr();
 }
@@ -237,13 +191,43 @@ void ViewTransform::setTransform(const ConstTransformRcPtr & transform, ViewTran
     {
     case VIEWTRANSFORM_DIR_TO_REFERENCE:
         getImpl()->m_toRefTransform = transformCopy; 
+        getImpl()->m_toRefDeferred  = nullptr;
         break;
     case VIEWTRANSFORM_DIR_FROM_REFERENCE:
         getImpl()->m_fromRefTransform = transformCopy; 
+        getImpl()->m_fromRefDeferred  = nullptr;
         break;
     }
 }
 
+void ViewTransform::Impl::setDeferred(ViewTransformDirection dir,
+                                      const DeferredTransformRcPtr & transform)
+{
+    switch (dir)
+    {
+    case VIEWTRANSFORM_DIR_TO_REFERENCE:
+        m_toRefTransform = nullptr;
+        m_toRefDeferred  = transform;
+        break;
+    case VIEWTRANSFORM_DIR_FROM_REFERENCE:
+        m_fromRefTransform = nullptr;
+        m_fromRefDeferred  = transform;
+        break;
+    }
+}
+
+bool ViewTransform::Impl::hasTransform(ViewTransformDirection dir) const
+{
+    switch (dir)
+    {
+    case VIEWTRANSFORM_DIR_TO_REFERENCE:
+        return m_toRefDeferred || m_toRefTransform;
+    case VIEWTRANSFORM_DIR_FROM_REFERENCE:
+        return m_fromRefDeferred || m_fromRefTransform;
+    }
+    return false;
+}
+
 
 namespace
 {
@@ -280,15 +264,28 @@ std::ostream & operator<< (std::ostream & os, const ViewTransform & vt)
         os << ", " << attr.first << "=" << attr.second;
     }
 
-    if (vt.getTransform(VIEWTRANSFORM_DIR_TO_REFERENCE))
+    // Refer to the ColorSpace operator for the lazily loaded transforms.
+    ConstTransformRcPtr toRef, fromRef;
+    try
+    {
+        toRef   = vt.getTransform(VIEWTRANSFORM_DIR_TO_REFERENCE);
+        fromRef = vt.getTransform(VIEWTRANSFORM_DIR_FROM_REFERENCE);
+    }
+    catch (const Exception & e)
+    {
+        os << ", error=" << e.what() << ">";
+        return os;
+    }
+
+    if (toRef)
     {
         os << ",\n    " << vt.getName() << " --> Reference";
-        os << "\n        " << *vt.getTransform(VIEWTRANSFORM_DIR_TO_REFERENCE);
+        os << "\n        " << *toRef;
     }
-    if (vt.getTransform(VIEWTRANSFORM_DIR_FROM_REFERENCE))
+    if (fromRef)
     {
         os << ",\n    Reference --> " << vt.getName();
-        os << "\n        " << *vt.getTransform(VIEWTRANSFORM_DIR_FROM_REFERENCE);
+        os << "\n        " << *fromRef;
     }
     os << ">";
     return os;
@@ -0,0 +1,83 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#ifndef INCLUDED_OCIO_VIEWTRANSFORM_H
+#define INCLUDED_OCIO_VIEWTRANSFORM_H
+
+#include <map>
+#include <string>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "DeferredTransform.h"
+#include "TokensManager.h"
+
+
+namespace OCIO_NAMESPACE
+{
+
+class ViewTransform::Impl
+{
+public:
+    std::string m_name;
+    std::string m_family;
+    std::string m_description;
+    ReferenceSpaceType m_referenceSpaceType{ REFERENCE_SPACE_SCENE };
+    std::map<std::string, std::string> m_interchangeAttribs;
+
+    TransformRcPtr m_toRefTransform;
+    TransformRcPtr m_fromRefTransform;
+
+    // Only used by a lazy config loading, they supersede the transforms.
+    DeferredTransformRcPtr m_toRefDeferred;
+    DeferredTransformRcPtr m_fromRefDeferred;
+
+    TokensManager m_categories;
+
+    Impl() = delete;
+    explicit Impl(ReferenceSpaceType referenceSpace)
+        : m_referenceSpaceType(referenceSpace)
+    {
+    }
+
+    Impl(const Impl &) = delete;
+    ~Impl() = default;
+
+    Impl & operator= (const Impl & rhs)
+    {
+        if (this != &rhs)
+        {
+            m_name        = rhs.m_name;
+            m_family      = rhs.m_family;
+            m_description = rhs.m_description;
+
+            m_referenceSpaceType = rhs.m_referenceSpaceType;
+            m_interchangeAttribs = rhs.m_interchangeAttribs;
+
+            m_toRefTransform = rhs.m_toRefTransform ? rhs.m_toRefTransform->createEditableCopy() :
+                                                      rhs.m_toRefTransform;
+
+            m_fromRefTransform = rhs.m_fromRefTransform ?
+                                 rhs.m_fromRefTransform->createEditableCopy() :
+                                 rhs.m_fromRefTransform;
+
+            m_toRefDeferred   = rhs.m_toRefDeferred;
+            m_fromRefDeferred = rhs.m_fromRefDeferred;
+
+            m_categories = rhs.m_categories;
+        }
+        return *this;
+    }
+
+    // Attach a deferred transform i.e. it replaces the transform for that direction.
+    void setDeferred(ViewTransformDirection dir, const DeferredTransformRcPtr & transform);
+
+    // Return true if there is a transform (deferred or not) for that direction, without
+    // creating the deferred transform.
+    bool hasTransform(ViewTransformDirection dir) const;
+};
+
+} // namespace OCIO_NAMESPACE
+
+#endif // INCLUDED_OCIO_VIEWTRANSFORM_H
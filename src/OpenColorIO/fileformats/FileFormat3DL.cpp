@@ -84,6 +84,11 @@ public:
     LocalCachedFile() = default;
     ~LocalCachedFile() = default;
 
+    size_t getMemorySize() const override
+    {
+        return sizeof(LocalCachedFile) + GetOpDataMemorySize(lut1D) + GetOpDataMemorySize(lut3D);
+    }
+
     Lut1DOpDataRcPtr lut1D;
     Lut3DOpDataRcPtr lut3D;
 };
@@ -411,12 +416,12 @@ CachedFileRcPtr LocalFileFormat::read(std::istream & istream,
             cachedFile->lut1D->setFileOutputBitDepth(out1DBD);
 
             const float scale = (float)GetBitDepthMaxValue(out1DBD);
-            Array & lutArray = cachedFile->lut1D->getArray();
+            float * lutValues = cachedFile->lut1D->getArray().getValues().mutableData();
             for (unsigned int i = 0, p = 0; i < rawshaper.size(); ++i)
             {
                 for (int j = 0; j < 3; ++j, ++p)
                 {
-                    lutArray[p] = static_cast<float>(rawshaper[i]) / scale;
+                    lutValues[p] = static_cast<float>(rawshaper[i]) / scale;
                 }
             }
         }
@@ -468,10 +473,10 @@ CachedFileRcPtr LocalFileFormat::read(std::istream & istream,
         cachedFile->lut3D->setFileOutputBitDepth(out3DBD);
 
         const float scale = (float)GetBitDepthMaxValue(out3DBD);
-        Array & lutArray = cachedFile->lut3D->getArray();
+        float * lutValues = cachedFile->lut3D->getArray().getValues().mutableData();
         for (size_t i = 0; i < raw3d.size(); ++i)
         {
-            lutArray[(unsigned long)i] = static_cast<float>(raw3d[i]) / scale;
+            lutValues[(unsigned long)i] = static_cast<float>(raw3d[i]) / scale;
         }
     }
     return cachedFile;
@@ -26,6 +26,11 @@ public:
 
     ~LocalCachedFile() = default;
 
+    size_t getMemorySize() const override
+    {
+        return sizeof(LocalCachedFile) + sizeof(CDLTransformImpl);
+    }
+
     GroupTransformRcPtr getCDLGroup() const override
     {
         auto group = GroupTransform::Create();
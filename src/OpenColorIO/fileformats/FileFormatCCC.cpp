@@ -29,6 +29,11 @@ public:
     }
     ~LocalCachedFile() = default;
 
+    size_t getMemorySize() const override
+    {
+        return sizeof(LocalCachedFile) + m_transformVec.size() * sizeof(CDLTransformImpl);
+    }
+
     GroupTransformRcPtr getCDLGroup() const override
     {
         auto group = GroupTransform::Create();
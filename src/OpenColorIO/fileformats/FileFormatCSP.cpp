@@ -297,6 +297,14 @@ public:
     }
     ~CachedFileCSP() = default;
 
+    size_t getMemorySize() const override
+    {
+        return sizeof(CachedFileCSP)
+             + GetOpDataMemorySize(prelut)
+             + GetOpDataMemorySize(lut1D)
+             + GetOpDataMemorySize(lut3D);
+    }
+
     std::string metadata;
 
     double prelut_from_min[3] = { 0.0, 0.0, 0.0 };
@@ -504,7 +512,7 @@ CachedFileRcPtr LocalFileFormat::read(std::istream & istream,
             lut1d_ptr->setInterpolation(interp);
         }
         lut1d_ptr->setFileOutputBitDepth(BIT_DEPTH_F32);
-        Array & lutArray = lut1d_ptr->getArray();
+        float * lutValues = lut1d_ptr->getArray().getValues().mutableData();
 
         for(int i = 0; i < points1D; ++i)
         {
@@ -526,9 +534,9 @@ CachedFileRcPtr LocalFileFormat::read(std::istream & istream,
             }
 
             // Store each channel.
-            lutArray[i*3 + 0] = floatArray[0];
-            lutArray[i*3 + 1] = floatArray[1];
-            lutArray[i*3 + 2] = floatArray[2];
+            lutValues[i*3 + 0] = floatArray[0];
+            lutValues[i*3 + 1] = floatArray[1];
+            lutValues[i*3 + 2] = floatArray[2];
 
         }
 
@@ -578,7 +586,7 @@ CachedFileRcPtr LocalFileFormat::read(std::istream & istream,
         }
         lut3d_ptr->setFileOutputBitDepth(BIT_DEPTH_F32);
 
-        Array & lutArray = lut3d_ptr->getArray();
+        float * lutValues = lut3d_ptr->getArray().getValues().mutableData();
         int num3dentries = lutSize * lutSize * lutSize;
 
         int r = 0;
@@ -607,9 +615,9 @@ CachedFileRcPtr LocalFileFormat::read(std::istream & istream,
                 throw Exception(os.str().c_str());
             }
 
-            lutArray[arrayIdx + 0] = floatArray[0];
-            lutArray[arrayIdx + 1] = floatArray[1];
-            lutArray[arrayIdx + 2] = floatArray[2];
+            lutValues[arrayIdx + 0] = floatArray[0];
+            lutValues[arrayIdx + 1] = floatArray[1];
+            lutValues[arrayIdx + 2] = floatArray[2];
 
             // CSP stores the LUT in red-fastest order.
             r += 1;
@@ -660,14 +668,14 @@ CachedFileRcPtr LocalFileFormat::read(std::istream & istream,
             // TODO: Fancy spline analysis to determine required number of samples.
             cachedFile->prelut_from_min[c] = from_min;
             cachedFile->prelut_from_max[c] = from_max;
-            Array & prelutArray = prelut_ptr->getArray();
+            float * prelutValues = prelut_ptr->getArray().getValues().mutableData();
 
             for (int i = 0; i < NUM_PRELUT_SAMPLES; ++i)
             {
                 float interpo = float(i) / float(NUM_PRELUT_SAMPLES-1);
                 float srcval = lerpf(from_min, from_max, interpo);
                 float newval = rsr_Interpolator1D_interpolate(srcval, interpolater);
-                prelutArray[i*3 + c] = newval;
+                prelutValues[i*3 + c] = newval;
             }
 
             rsr_Interpolator1D_Raw_destroy(cprelut_raw);
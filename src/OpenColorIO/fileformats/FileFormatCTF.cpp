@@ -115,6 +115,16 @@ public:
     };
     ~LocalCachedFile() {};
 
+    size_t getMemorySize() const override
+    {
+        size_t size = sizeof(LocalCachedFile);
+        for (const auto & opData : m_transform->getOpDataVec())
+        {
+            size += GetOpDataMemorySize(opData);
+        }
+        return size;
+    }
+
     CTFReaderTransformPtr m_transform;
     std::string m_filePath;
 
@@ -1524,12 +1534,12 @@ void LocalFileFormat::bake(const Baker & baker,
             if (fromInStart != 0.f || fromInEnd != 1.0f)
             {
                 GenerateLinearScaleLut1D(
-                    shaperLut->getArray().getValues().data(),
+                    shaperLut->getArray().getValues().mutableData(),
                     shaperSizeRequest, 3, fromInStart, fromInEnd);
             }
         }
         const auto shaperSize = shaperLut->getArray().getLength();
-        PackedImageDesc shaperImg(shaperLut->getArray().getValues().data(),shaperSize, 1, 3);
+        PackedImageDesc shaperImg(shaperLut->getArray().getValues().mutableData(),shaperSize, 1, 3);
         ConstCPUProcessorRcPtr inputToShaper = GetInputToShaperProcessor(baker);
         inputToShaper->apply(shaperImg);
     }
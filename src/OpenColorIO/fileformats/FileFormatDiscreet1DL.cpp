@@ -629,6 +629,11 @@ public:
     };
     ~LocalCachedFile() = default;
 
+    size_t getMemorySize() const override
+    {
+        return sizeof(LocalCachedFile) + GetOpDataMemorySize(lut1D);
+    }
+
     Lut1DOpDataRcPtr lut1D;
 };
 
@@ -708,7 +713,7 @@ CachedFileRcPtr LocalFileFormat::read(std::istream & istream,
                                                    interp));
 
     const float scale = (float)GetBitDepthMaxValue(outputBD);
-    Array & array = cachedFile->lut1D->getArray();
+    float * values = cachedFile->lut1D->getArray().getValues().mutableData();
     const int srcTableLimit = discreetLut1d->numtables - 1;
     for (int i = 0, p = 0; i< lutSize; ++i)
     {
@@ -720,11 +725,11 @@ CachedFileRcPtr LocalFileFormat::read(std::istream & istream,
                 // Convert raw half values to floats.
                 half halfObj;
                 halfObj.setBits((unsigned short)discreetLut1d->tables[srcTable][i]);
-                array[p] = (float)halfObj;
+                values[p] = (float)halfObj;
             }
             else
             {
-                array[p] = (float)discreetLut1d->tables[srcTable][i] / scale;
+                values[p] = (float)discreetLut1d->tables[srcTable][i] / scale;
             }
         }
     }
@@ -227,6 +227,11 @@ public:
     }
     ~CachedFileHDL() = default;
 
+    size_t getMemorySize() const override
+    {
+        return sizeof(CachedFileHDL) + GetOpDataMemorySize(lut1D) + GetOpDataMemorySize(lut3D);
+    }
+
     void setLUT1D(const std::vector<float> & values, Interpolation interp)
     {
         auto lutSize = static_cast<unsigned long>(values.size());
@@ -237,12 +242,12 @@ public:
         }
         lut1D->setFileOutputBitDepth(BIT_DEPTH_F32);
 
-        auto & lutArray = lut1D->getArray();
+        float * lutValues = lut1D->getArray().getValues().mutableData();
         for (unsigned long i = 0; i < lutSize; ++i)
         {
-            lutArray[3 * i + 0] = values[i];
-            lutArray[3 * i + 1] = values[i];
-            lutArray[3 * i + 2] = values[i];
+            lutValues[3 * i + 0] = values[i];
+            lutValues[3 * i + 1] = values[i];
+            lutValues[3 * i + 2] = values[i];
         }
     }
 
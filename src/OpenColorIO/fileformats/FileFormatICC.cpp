@@ -39,6 +39,11 @@ public:
     LocalCachedFile() = default;
     ~LocalCachedFile() = default;
 
+    size_t getMemorySize() const override
+    {
+        return sizeof(LocalCachedFile) + GetOpDataMemorySize(lut);
+    }
+
     // The profile description.
     std::string mProfileDescription;
 
@@ -643,15 +648,15 @@ CachedFileRcPtr LocalFileFormat::read(std::istream & istream,
             cachedFile->lut = std::make_shared<Lut1DOpData>(lutLength);
             cachedFile->lut->setFileOutputBitDepth(BIT_DEPTH_F32);
 
-            auto & lutData = cachedFile->lut->getArray();
+            float * lutValues = cachedFile->lut->getArray().getValues().mutableData();
 
             for (unsigned long i = 0; i < lutLength; ++i)
             {
                 float v = i / (lutLength - 1.f);
 
-                lutData[i * 3 + 0] = ApplyParametricCurve(v, red->GetFunctionType(), red->GetParam());
-                lutData[i * 3 + 1] = ApplyParametricCurve(v, green->GetFunctionType(), green->GetParam());
-                lutData[i * 3 + 2] = ApplyParametricCurve(v, blue->GetFunctionType(), blue->GetParam());
+                lutValues[i * 3 + 0] = ApplyParametricCurve(v, red->GetFunctionType(), red->GetParam());
+                lutValues[i * 3 + 1] = ApplyParametricCurve(v, green->GetFunctionType(), green->GetParam());
+                lutValues[i * 3 + 2] = ApplyParametricCurve(v, blue->GetFunctionType(), blue->GetParam());
             }
         }
     }
@@ -719,13 +724,13 @@ CachedFileRcPtr LocalFileFormat::read(std::istream & istream,
             const auto & gc = green->GetCurve();
             const auto & bc = blue->GetCurve();
 
-            auto & lutData = cachedFile->lut->getArray();
+            float * lutValues = cachedFile->lut->getArray().getValues().mutableData();
 
             for (unsigned long i = 0; i < lutLength; ++i)
             {
-                lutData[i * 3 + 0] = rc[i];
-                lutData[i * 3 + 1] = gc[i];
-                lutData[i * 3 + 2] = bc[i];
+                lutValues[i * 3 + 0] = rc[i];
+                lutValues[i * 3 + 1] = gc[i];
+                lutValues[i * 3 + 2] = bc[i];
             }
 
             // Set the file bit-depth based on what is in the ICC profile
@@ -77,6 +77,11 @@ public:
     LocalCachedFile() = default;
     ~LocalCachedFile() = default;
 
+    size_t getMemorySize() const override
+    {
+        return sizeof(LocalCachedFile) + GetOpDataMemorySize(lut1D) + GetOpDataMemorySize(lut3D);
+    }
+
     Lut1DOpDataRcPtr lut1D;
     Lut3DOpDataRcPtr lut3D;
     float domain_min[3]{ 0.0f, 0.0f, 0.0f };
@@ -398,9 +403,10 @@ LocalFileFormat::read(std::istream & istream,
             auto & lutArray = cachedFile->lut1D->getArray();
 
             const auto numVals = lutArray.getNumValues();
+            float * lutValues = lutArray.getValues().mutableData();
             for(unsigned long i = 0; i < numVals; ++i)
             {
-                lutArray[i] = raw[i];
+                lutValues[i] = raw[i];
             }
         }
     }
@@ -26,6 +26,11 @@ public:
     LocalCachedFile () = default;
     ~LocalCachedFile() = default;
 
+    size_t getMemorySize() const override
+    {
+        return sizeof(LocalCachedFile) + GetOpDataMemorySize(lut3D);
+    }
+
     Lut3DOpDataRcPtr lut3D;
 };
 
@@ -258,14 +263,14 @@ CachedFileRcPtr LocalFileFormat::read(std::istream & istream,
     BitDepth fileBD = GetBitdepthFromMaxValue(outputBitDepthMaxValue);
     cachedFile->lut3D->setFileOutputBitDepth(fileBD);
 
-    auto & lutArray = cachedFile->lut3D->getArray();
+    float * lutValues = cachedFile->lut3D->getArray().getValues().mutableData();
 
     float scale = 1.0f / ((float)outputBitDepthMaxValue - 1.0f);
 
     // lutArray and LUT in file are blue fastest.
     for (size_t i = 0; i < raw3d.size(); ++i)
     {
-        lutArray[(unsigned long)i] = static_cast<float>(raw3d[i]) * scale;
+        lutValues[i] = static_cast<float>(raw3d[i]) * scale;
     }
 
     return cachedFile;
@@ -182,6 +182,11 @@ public:
     LocalCachedFile() = default;
     ~LocalCachedFile() = default;
 
+    size_t getMemorySize() const override
+    {
+        return sizeof(LocalCachedFile) + GetOpDataMemorySize(lut1D) + GetOpDataMemorySize(lut3D);
+    }
+
     Lut1DOpDataRcPtr lut1D;
     float range1d_min = 0.0f;
     float range1d_max = 1.0f;
@@ -450,11 +455,11 @@ CachedFileRcPtr LocalFileFormat::read(std::istream & istream,
             cachedFile->range1d_min = range1d_min;
             cachedFile->range1d_max = range1d_max;
 
-            auto & lutArray = cachedFile->lut1D->getArray();
+            float * lutValues = cachedFile->lut1D->getArray().getValues().mutableData();
 
             for (unsigned long i = 0; i < raw1d.size(); ++i)
             {
-                lutArray[i] = raw1d[i];
+                lutValues[i] = raw1d[i];
             }
         }
     }
@@ -43,6 +43,11 @@ public:
     LocalCachedFile() = default;
     ~LocalCachedFile() = default;
 
+    size_t getMemorySize() const override
+    {
+        return sizeof(LocalCachedFile) + GetOpDataMemorySize(lut);
+    }
+
     Lut1DOpDataRcPtr lut;
     float from_min = 0.0f;
     float from_max = 1.0f;
@@ -195,7 +200,7 @@ CachedFileRcPtr LocalFileFormat::read(std::istream & istream,
     }
 
     lut1d->setFileOutputBitDepth(BIT_DEPTH_F32);
-    Array & lutArray = lut1d->getArray();
+    float * lutValues = lut1d->getArray().getValues().mutableData();
     unsigned long i = 0;
     {
         istream.getline(lineBuffer, MAX_LINE_SIZE);
@@ -262,27 +267,27 @@ CachedFileRcPtr LocalFileFormat::read(std::istream & istream,
                 // If 1 component is specified, use x1 x1 x1.
                 if (components == 1)
                 {
-                    lutArray[i]     = values[0];
-                    lutArray[i + 1] = values[0];
-                    lutArray[i + 2] = values[0];
+                    lutValues[i]     = values[0];
+                    lutValues[i + 1] = values[0];
+                    lutValues[i + 2] = values[0];
                     i += 3;
                     ++lineCount;
                 }
                 // If 2 components are specified, use x1 x2 0.0.
                 else if (components == 2)
                 {
-                    lutArray[i]     = values[0];
-                    lutArray[i + 1] = values[1];
-                    lutArray[i + 2] = 0.0f;
+                    lutValues[i]     = values[0];
+                    lutValues[i + 1] = values[1];
+                    lutValues[i + 2] = 0.0f;
                     i += 3;
                     ++lineCount;
                 }
                 // If 3 component is specified, use x1 x2 x3.
                 else if (components == 3)
                 {
-                    lutArray[i]     = values[0];
-                    lutArray[i + 1] = values[1];
-                    lutArray[i + 2] = values[2];
+                    lutValues[i]     = values[0];
+                    lutValues[i + 1] = values[1];
+                    lutValues[i + 2] = values[2];
                     i += 3;
                     ++lineCount;
                 }
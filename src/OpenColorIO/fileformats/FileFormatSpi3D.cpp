@@ -40,6 +40,11 @@ public:
     LocalCachedFile() = default;
     ~LocalCachedFile() = default;
 
+    size_t getMemorySize() const override
+    {
+        return sizeof(LocalCachedFile) + GetOpDataMemorySize(lut);
+    }
+
     Lut3DOpDataRcPtr lut;
 };
 
@@ -144,6 +149,7 @@ CachedFileRcPtr LocalFileFormat::read(std::istream & istream,
     Array & lutArray = lut3d->getArray();
     unsigned long numVal = lutArray.getNumValues();
     std::vector<bool> indexDefined(numVal, false);
+    float * lutValues = lutArray.getValues().mutableData();
     while (istream.good() && entriesRemaining > 0)
     {
         istream.getline(lineBuffer, MAX_LINE_SIZE);
@@ -215,9 +221,9 @@ CachedFileRcPtr LocalFileFormat::read(std::istream & istream,
                 throw Exception(os.str().c_str());
             }
 
-            lutArray[index+0] = redValue;
-            lutArray[index+1] = greenValue;
-            lutArray[index+2] = blueValue;
+            lutValues[index+0] = redValue;
+            lutValues[index+1] = greenValue;
+            lutValues[index+2] = blueValue;
             if (! indexDefined[index])
             {
                 entriesRemaining--;
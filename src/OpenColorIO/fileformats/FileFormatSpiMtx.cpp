@@ -28,6 +28,11 @@ public:
     };
     ~LocalCachedFile() {};
 
+    size_t getMemorySize() const override
+    {
+        return sizeof(LocalCachedFile);
+    }
+
     double m44[16];
     double offset4[4];
 };
@@ -44,6 +44,11 @@ public:
     LocalCachedFile() = default;
     ~LocalCachedFile() = default;
 
+    size_t getMemorySize() const override
+    {
+        return sizeof(LocalCachedFile) + GetOpDataMemorySize(lut1D) + GetOpDataMemorySize(lut3D);
+    }
+
     Lut1DOpDataRcPtr lut1D;
     Lut3DOpDataRcPtr lut3D;
 };
@@ -251,9 +256,10 @@ CachedFileRcPtr LocalFileFormat::read(std::istream & istream,
         }
 
         const auto nv = lutArray.getNumValues();
+        float * lutValues = lutArray.getValues().mutableData();
         for(unsigned long i = 0; i < nv; ++i)
         {
-            lutArray[i] = raw1d[i] * descale;
+            lutValues[i] = raw1d[i] * descale;
         }
     }
 
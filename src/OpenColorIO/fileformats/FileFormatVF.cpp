@@ -26,6 +26,11 @@ public:
     LocalCachedFile() = default;
     ~LocalCachedFile() = default;
 
+    size_t getMemorySize() const override
+    {
+        return sizeof(LocalCachedFile) + GetOpDataMemorySize(lut3D);
+    }
+
     Lut3DOpDataRcPtr lut3D;
     double m44[16]{ 0 };
     bool useMatrix = false;
@@ -3471,10 +3471,10 @@ void CTFReaderInvLut1DElt::endArray(unsigned int position)
     if (m_invLut->isOutputRawHalfs())
     {
         const size_t maxValues = pArray->getNumValues();
+        float * values = pArray->getValues().mutableData();
         for (size_t i = 0; i<maxValues; ++i)
         {
-            pArray->getValues()[i]
-                = ConvertHalfBitsToFloat((unsigned short)pArray->getValues()[i]);
+            values[i] = ConvertHalfBitsToFloat((unsigned short)values[i]);
         }
     }
 
@@ -3498,12 +3498,12 @@ void CTFReaderInvLut1DElt::endArray(unsigned int position)
         const unsigned long numLuts = maxColorComponents;
 
         // TODO: Should improve Lut1DOp so that the copy is unnecessary.
+        float * values = pArray->getValues().mutableData();
         for (long i = (dimensions - 1); i >= 0; --i)
         {
             for (unsigned long j = 0; j<numLuts; ++j)
             {
-                pArray->getValues()[(i*numLuts) + j]
-                    = pArray->getValues()[i];
+                values[(i*numLuts) + j] = values[i];
             }
         }
     }
@@ -4284,10 +4284,10 @@ void CTFReaderLut1DElt::endArray(unsigned int position)
     if (m_lut->isOutputRawHalfs())
     {
         const size_t maxValues = pArray->getNumValues();
+        float * values = pArray->getValues().mutableData();
         for (size_t i = 0; i<maxValues; ++i)
         {
-            pArray->getValues()[i]
-                = ConvertHalfBitsToFloat((unsigned short)pArray->getValues()[i]);
+            values[i] = ConvertHalfBitsToFloat((unsigned short)values[i]);
         }
     }
 
@@ -4309,11 +4309,12 @@ void CTFReaderLut1DElt::endArray(unsigned int position)
         const unsigned numLuts = maxColorComponents;
 
         // TODO: Should improve Lut1DOp so that the copy is unnecessary.
+        float * values = pArray->getValues().mutableData();
         for (signed i = (dimensions - 1); i >= 0; --i)
         {
             for (unsigned j = 0; j<numLuts; ++j)
             {
-                pArray->getValues()[(i*numLuts) + j] = pArray->getValues()[i];
+                values[(i*numLuts) + j] = values[i];
             }
         }
     }
@@ -4725,7 +4726,7 @@ void CTFReaderMatrixElt::convert_1_2_to_Latest()
 
             array.resize(3, 3);
 
-            ArrayDouble::Values & v = array.getValues();
+            double * v = array.getValues().mutableData();
             v[0] = oldV[0];
             v[1] = oldV[1];
             v[2] = oldV[2];
@@ -4850,7 +4851,7 @@ void CTFReaderMatrixElt_1_3::endArray(unsigned int position)
 
             array.setLength(3);
 
-            ArrayDouble::Values & v = array.getValues();
+            double * v = array.getValues().mutableData();
             v[0] = oldV[0];
             v[1] = oldV[1];
             v[2] = oldV[2];
@@ -4894,7 +4895,7 @@ void CTFReaderMatrixElt_1_3::endArray(unsigned int position)
 
         array.resize(4, 4);
 
-        ArrayDouble::Values & v = array.getValues();
+        double * v = array.getValues().mutableData();
         v[0] = oldV[0];
         v[1] = oldV[1];
         v[2] = oldV[2];
@@ -4,7 +4,10 @@
 #ifndef INCLUDED_OCIO_OPARRAY_H
 #define INCLUDED_OCIO_OPARRAY_H
 
+#include <algorithm>
+#include <memory>
 #include <sstream>
+#include <utility>
 #include <vector>
 
 #include <OpenColorIO/OpenColorIO.h>
@@ -30,6 +33,107 @@ public:
     virtual unsigned long getNumValues() const = 0;
 };
 
+// The values of an array. They are either owned or a read-only view of values owned by another
+// object (e.g. the memory mapping of a disk cache entry, refer to DiskCache.h) so identical LUTs
+// share their memory, including across processes. The accessors are read-only and never copy
+// the shared values, only mutableData() copies them (i.e. copy-on-write) so it is reserved to
+// the code editing the values.
+template<typename T> class ArrayValues
+{
+public:
+    typedef T value_type;
+    typedef const T * const_iterator;
+
+public:
+    ArrayValues() = default;
+    explicit ArrayValues(size_t size) : m_data(size) {}
+    ArrayValues(size_t size, const T & value) : m_data(size, value) {}
+    ArrayValues(std::initializer_list<T> values) : m_data(values) {}
+    ArrayValues(std::vector<T> values) : m_data(std::move(values)) {}
+
+    ArrayValues(const ArrayValues &) = default;
+    ArrayValues & operator=(const ArrayValues &) = default;
+    ArrayValues(ArrayValues &&) = default;
+    ArrayValues & operator=(ArrayValues &&) = default;
+
+    // Use read-only values which are kept alive by the holder.
+    void share(const T * values, size_t size, std::shared_ptr<const void> holder)
+    {
+        std::vector<T>().swap(m_data);
+        m_sharedValues = values;
+        m_sharedSize   = size;
+        m_holder       = std::move(holder);
+    }
+
+    bool isShared() const noexcept { return bool(m_holder); }
+
+    size_t size() const noexcept { return m_holder ? m_sharedSize : m_data.size(); }
+    bool empty() const noexcept { return size() == 0; }
+
+    const T * data() const noexcept { return m_holder ? m_sharedValues : m_data.data(); }
+
+    const T & operator[](size_t index) const noexcept { return data()[index]; }
+
+    const_iterator begin() const noexcept { return data(); }
+    const_iterator end() const noexcept { return data() + size(); }
+
+    // The only access to modify the values, it copies the shared values first.
+    T * mutableData() { detach(); return m_data.data(); }
+
+    void resize(size_t size)
+    {
+        // Keep sharing the values if the size does not change.
+        if (!m_holder || size != m_sharedSize)
+        {
+            detach();
+            m_data.resize(size);
+        }
+    }
+
+    void resize(size_t size, const T & value)
+    {
+        if (!m_holder || size != m_sharedSize)
+        {
+            detach();
+            m_data.resize(size, value);
+        }
+    }
+
+    void clear() noexcept
+    {
+        m_holder.reset();
+        m_sharedValues = nullptr;
+        m_sharedSize   = 0;
+        m_data.clear();
+    }
+
+    bool operator==(const ArrayValues & other) const
+    {
+        return size() == other.size()
+            && (data() == other.data() || std::equal(begin(), end(), other.begin()));
+    }
+
+    bool operator!=(const ArrayValues & other) const { return !(*this == other); }
+
+private:
+    void detach()
+    {
+        if (m_holder)
+        {
+            m_data.assign(m_sharedValues, m_sharedValues + m_sharedSize);
+            m_sharedValues = nullptr;
+            m_sharedSize   = 0;
+            m_holder.reset();
+        }
+    }
+
+    std::vector<T> m_data;
+
+    const T * m_sharedValues = nullptr;
+    size_t m_sharedSize      = 0;
+    std::shared_ptr<const void> m_holder;
+};
+
 // The CLF spec defines several ops that all contain an array (LUT1D, LUT3D,
 // and Matrix). The Array class is used as a building block to implement those
 // other classes. Since the dimensionality of the underlying array of those 
@@ -38,7 +142,7 @@ public:
 template<typename T> class ArrayT : public ArrayBase
 {
 public:
-    typedef std::vector<T> Values;
+    typedef ArrayValues<T> Values;
 
 public:
     ArrayT()
@@ -72,12 +176,12 @@ public:
 
     void setDoubleValue(unsigned long index, double value) override
     {
-        m_data[index] = (T)value;
+        m_data.mutableData()[index] = (T)value;
     }
 
     double getDoubleValue(unsigned long index) override
     {
-        return double(m_data[index]);
+        return double(std::as_const(m_data)[index]);
     }
 
     unsigned long getLength() const override
@@ -112,17 +216,19 @@ public:
     {
         if (m_numColorComponents == 3)
         {
+            const Values & values = m_data;
+
             bool sameCoeff = true;
             for (unsigned long idx = 0; idx < m_length && sameCoeff; ++idx)
             {
-                if (IsNan(m_data[idx * 3]) &&
-                    IsNan(m_data[idx * 3 + 1]) &&
-                    IsNan(m_data[idx * 3 + 2]))
+                if (IsNan(values[idx * 3]) &&
+                    IsNan(values[idx * 3 + 1]) &&
+                    IsNan(values[idx * 3 + 2]))
                 {
                     continue;
                 }
-                if (m_data[idx * 3] != m_data[idx * 3 + 1]
-                    || m_data[idx * 3] != m_data[idx * 3 + 2])
+                if (values[idx * 3] != values[idx * 3 + 1]
+                    || values[idx * 3] != values[idx * 3 + 2])
                 {
                     sameCoeff = false;
                     break;
@@ -156,11 +262,6 @@ public:
         return m_data[index];
     }
 
-    inline T& operator[](unsigned long index)
-    {
-        return m_data[index];
-    }
-
     virtual void validate() const
     {
         if (getLength() == 0)
@@ -192,9 +293,10 @@ public:
         if (scale != (T)1.)
         {
             const size_t nbVal = m_data.size();
+            T * values = m_data.mutableData();
             for (size_t i = 0; i < nbVal; ++i)
             {
-                m_data[i] *= scale;
+                values[i] *= scale;
             }
         }
     }
@@ -1,20 +1,34 @@
 // SPDX-License-Identifier: BSD-3-Clause
 // Copyright Contributors to the OpenColorIO Project.
 
+#include <algorithm>
+#include <atomic>
+#include <vector>
+
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "BitDepthUtils.h"
 #include "ops/OpTools.h"
+#include "ThreadPool.h"
 
 namespace OCIO_NAMESPACE
 {
-void EvalTransform(const float * in,
-                    float * out,
-                    long numPixels,
-                    OpRcPtrVec & ops)
+
+namespace
 {
-    std::vector<float> tmp(numPixels * 4);
 
+// Number of pixels processed at once by a thread.
+constexpr long EvalChunkSize = 4096;
+
+// Below this number of pixels per task, the parallel dispatch costs more than it saves.
+constexpr long EvalMinPixelsPerThread = 16 * EvalChunkSize;
+
+void EvalChunk(const float * in,
+               float * out,
+               long numPixels,
+               const ConstOpCPURcPtrVec & cpuOps,
+               std::vector<float> & tmp)
+{
     // Render the LUT entries (domain) through the ops.
     const float * values = in;
     for (long idx = 0; idx<numPixels; ++idx)
@@ -27,12 +41,9 @@ void EvalTransform(const float * in,
         values += 3;
     }
 
-    ops.finalize();
-    ops.optimize(OPTIMIZATION_NONE);
-
-    for (OpRcPtrVec::size_type i = 0, size = ops.size(); i<size; ++i)
+    for (const auto & cpuOp : cpuOps)
     {
-        ops[i]->apply(&tmp[0], &tmp[0], numPixels);
+        cpuOp->apply(&tmp[0], &tmp[0], numPixels);
     }
 
     float * result = out;
@@ -45,4 +56,45 @@ void EvalTransform(const float * in,
         result += 3;
     }
 }
+
+} // anonymous namespace
+
+void EvalTransform(const float * in,
+                   float * out,
+                   long numPixels,
+                   OpRcPtrVec & ops)
+{
+    ops.finalize();
+    ops.optimize(OPTIMIZATION_NONE);
+
+    // Create the CPU renderers only once for all the chunks.
+    ConstOpCPURcPtrVec cpuOps;
+    for (const auto & op : ops)
+    {
+        cpuOps.push_back(op->getCPUOp(false));
+    }
+
+    const long numChunks = (numPixels + EvalChunkSize - 1) / EvalChunkSize;
+
+    const unsigned numTasks
+        = (unsigned)std::max(1L, std::min((long)GetNumHardwareThreads(),
+                                          numPixels / EvalMinPixelsPerThread));
+
+    // The chunks are dynamically dispatched to the tasks.
+    std::atomic<long> nextChunk{ 0 };
+
+    RunParallelTasks(numTasks, [&](unsigned /*task*/)
+    {
+        std::vector<float> tmp(4 * std::min(EvalChunkSize, numPixels));
+
+        for (long chunk = nextChunk++; chunk < numChunks; chunk = nextChunk++)
+        {
+            const long start = chunk * EvalChunkSize;
+            const long numChunkPixels = std::min(EvalChunkSize, numPixels - start);
+
+            EvalChunk(in + 3 * start, out + 3 * start, numChunkPixels, cpuOps, tmp);
+        }
+    });
+}
+
 } // namespace OCIO_NAMESPACE
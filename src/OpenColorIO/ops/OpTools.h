@@ -14,6 +14,9 @@
 namespace OCIO_NAMESPACE
 {
 
+// Evaluate the RGB values through the ops. The ops are finalized and the pixels are processed by
+// chunks spread over several threads when there are enough of them. The in & out buffers could be
+// the same.
 void EvalTransform(const float * in, float * out,
                    long numPixels,
                    OpRcPtrVec & ops);
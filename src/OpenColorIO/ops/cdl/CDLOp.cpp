@@ -46,7 +46,7 @@ public:
     bool canCombineWith(ConstOpRcPtr & op) const override;
     void combineWith(OpRcPtrVec & ops, ConstOpRcPtr & secondOp) const override;
 
-    std::string getCacheID() const override;
+    void writeCacheID(std::ostream & os) const override;
 
     ConstOpCPURcPtr getCPUOp(bool fastLogExpPow) const override;
 
@@ -116,15 +116,12 @@ void CDLOp::combineWith(OpRcPtrVec & /*ops*/, ConstOpRcPtr & secondOp) const
     // TODO: Implement CDLOp::combineWith()
 }
 
-std::string CDLOp::getCacheID() const
+void CDLOp::writeCacheID(std::ostream & os) const
 {
     // Create the cacheID.
-    std::ostringstream cacheIDStream;
-    cacheIDStream << "<CDLOp ";
-    cacheIDStream << cdlData()->getCacheID();
-    cacheIDStream << ">";
-
-    return cacheIDStream.str();
+    os << "<CDLOp ";
+    cdlData()->writeCacheID(os);
+    os << ">";
 }
 
 ConstOpCPURcPtr CDLOp::getCPUOp(bool fastLogExpPow) const
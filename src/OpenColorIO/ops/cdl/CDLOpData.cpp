@@ -452,11 +452,19 @@ bool CDLOpData::isClamping() const
     return false;
 }
 
+namespace
+{
+void WriteChannelParameters(std::ostream & os, const CDLOpData::ChannelParams & params)
+{
+    os << params[0] << ", " << params[1] << ", " << params[2];
+}
+}
+
 std::string CDLOpData::GetChannelParametersString(ChannelParams params)
 {
     std::ostringstream oss;
     oss.precision(DefaultValues::FLOAT_DECIMALS);
-    oss << params[0] << ", " << params[1] << ", " << params[2];
+    WriteChannelParameters(oss, params);
     return oss.str();
 }
 
@@ -489,25 +497,25 @@ CDLOpDataRcPtr CDLOpData::inverse() const
     return cdl;
 }
 
-std::string CDLOpData::getCacheID() const
+void CDLOpData::writeCacheID(std::ostream & os) const
 {
     AutoMutex lock(m_mutex);
 
-    std::ostringstream cacheIDStream;
     if (!getID().empty())
     {
-        cacheIDStream << getID() << " ";
+        os << getID() << " ";
     }
 
-    cacheIDStream.precision(DefaultValues::FLOAT_DECIMALS);
-
-    cacheIDStream << GetStyleName(getStyle()) << " ";
-    cacheIDStream << getSlopeString() << " ";
-    cacheIDStream << getOffsetString() << " ";
-    cacheIDStream << getPowerString() << " ";
-    cacheIDStream << getSaturationString() << " ";
+    os.precision(DefaultValues::FLOAT_DECIMALS);
 
-    return cacheIDStream.str();
+    os << GetStyleName(getStyle()) << " ";
+    WriteChannelParameters(os, m_slopeParams);
+    os << " ";
+    WriteChannelParameters(os, m_offsetParams);
+    os << " ";
+    WriteChannelParameters(os, m_powerParams);
+    os << " ";
+    os << m_saturation << " ";
 }
 
 bool operator==(const CDLOpData & lhs, const CDLOpData & rhs)
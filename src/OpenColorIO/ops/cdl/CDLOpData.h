@@ -166,7 +166,7 @@ public:
 
     CDLOpDataRcPtr inverse() const;
 
-    std::string getCacheID() const override;
+    void writeCacheID(std::ostream & os) const override;
 
 protected:
     static std::string GetChannelParametersString(ChannelParams params);
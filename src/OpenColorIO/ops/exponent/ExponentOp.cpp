@@ -65,24 +65,21 @@ bool ExponentOpData::isIdentity() const
     return IsVecEqualToOne(m_exp4, 4);
 }
 
-std::string ExponentOpData::getCacheID() const
+void ExponentOpData::writeCacheID(std::ostream & os) const
 {
     AutoMutex lock(m_mutex);
 
     // Create the cacheID.
-    std::ostringstream cacheIDStream;
     if (!getID().empty())
     {
-        cacheIDStream << getID() << " ";
+        os << getID() << " ";
     }
 
-    cacheIDStream.precision(DefaultValues::FLOAT_DECIMALS);
+    os.precision(DefaultValues::FLOAT_DECIMALS);
     for (int i = 0; i < 4; ++i)
     {
-        cacheIDStream << m_exp4[i] << " ";
+        os << m_exp4[i] << " ";
     }
-
-    return cacheIDStream.str();
 }
 
 void ExponentOpData::validate() const
@@ -99,6 +96,11 @@ public:
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
 
+    bool hasPlanarApply() const override { return true; }
+    void applyPlanar(const float * const inPlanes[4],
+                     float * const outPlanes[4],
+                     long numPixels) const override;
+
 private:
     ConstExponentOpDataRcPtr m_data;
 };
@@ -125,6 +127,23 @@ void ExponentOpCPU::apply(const void * inImg, void * outImg, long numPixels) con
     }
 }
 
+void ExponentOpCPU::applyPlanar(const float * const inPlanes[4],
+                                float * const outPlanes[4],
+                                long numPixels) const
+{
+    for (int c = 0; c < 4; ++c)
+    {
+        const float * in = inPlanes[c];
+        float * out = outPlanes[c];
+        const float exp = float(m_data->m_exp4[c]);
+
+        for (long idx = 0; idx < numPixels; ++idx)
+        {
+            out[idx] = powf( std::max(0.0f, in[idx]), exp);
+        }
+    }
+}
+
 class ExponentOp : public Op
 {
 public:
@@ -146,7 +165,7 @@ public:
     bool canCombineWith(ConstOpRcPtr & op) const override;
     void combineWith(OpRcPtrVec & ops, ConstOpRcPtr & secondOp) const override;
 
-    std::string getCacheID() const override;
+    void writeCacheID(std::ostream & os) const override;
 
     ConstOpCPURcPtr getCPUOp(bool fastLogExpPow) const override;
 
@@ -236,14 +255,12 @@ void ExponentOp::combineWith(OpRcPtrVec & ops, ConstOpRcPtr & secondOp) const
     }
 }
 
-std::string ExponentOp::getCacheID() const
+void ExponentOp::writeCacheID(std::ostream & os) const
 {
     // Create the cacheID
-    std::ostringstream cacheIDStream;
-    cacheIDStream << "<ExponentOp ";
-    cacheIDStream << expData()->getCacheID();
-    cacheIDStream << ">";
-    return cacheIDStream.str();
+    os << "<ExponentOp ";
+    expData()->writeCacheID(os);
+    os << ">";
 }
 
 ConstOpCPURcPtr ExponentOp::getCPUOp(bool /*fastLogExpPow*/) const
@@ -34,7 +34,7 @@ public:
 
     double m_exp4[4];
 
-    std::string getCacheID() const override;
+    void writeCacheID(std::ostream & os) const override;
     void validate() const override;
 };
 
@@ -39,7 +39,7 @@ public:
     bool canCombineWith(ConstOpRcPtr & op) const override;
     void combineWith(OpRcPtrVec & ops, ConstOpRcPtr & secondOp) const override;
 
-    std::string getCacheID() const override;
+    void writeCacheID(std::ostream & os) const override;
 
     bool isDynamic() const override;
     bool hasDynamicProperty(DynamicPropertyType type) const override;
@@ -118,15 +118,12 @@ void ExposureContrastOp::combineWith(OpRcPtrVec & /*ops*/, ConstOpRcPtr & second
     }
 }
 
-std::string ExposureContrastOp::getCacheID() const
+void ExposureContrastOp::writeCacheID(std::ostream & os) const
 {
     // Create the cacheID.
-    std::ostringstream cacheIDStream;
-    cacheIDStream << "<ExposureContrastOp ";
-    cacheIDStream << ecData()->getCacheID();
-    cacheIDStream << ">";
-
-    return cacheIDStream.str();
+    os << "<ExposureContrastOp ";
+    ecData()->writeCacheID(os);
+    os << ">";
 }
 
 ConstOpCPURcPtr ExposureContrastOp::getCPUOp(bool /*fastLogExpPow*/) const
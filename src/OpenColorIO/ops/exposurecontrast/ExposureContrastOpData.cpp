@@ -245,37 +245,34 @@ ExposureContrastOpDataRcPtr ExposureContrastOpData::inverse() const
     return ec;
 }
 
-std::string ExposureContrastOpData::getCacheID() const
+void ExposureContrastOpData::writeCacheID(std::ostream & os) const
 {
     AutoMutex lock(m_mutex);
 
-    std::ostringstream cacheIDStream;
     if (!getID().empty())
     {
-        cacheIDStream << getID() << " ";
+        os << getID() << " ";
     }
 
-    cacheIDStream.precision(DefaultValues::FLOAT_DECIMALS);
+    os.precision(DefaultValues::FLOAT_DECIMALS);
 
-    cacheIDStream << ConvertStyleToString(m_style) << " ";
+    os << ConvertStyleToString(m_style) << " ";
 
     if (!m_exposure->isDynamic())
     {
-        cacheIDStream << "E: " << m_exposure->getValue() << " ";
+        os << "E: " << m_exposure->getValue() << " ";
     }
     if (!m_contrast->isDynamic())
     {
-        cacheIDStream << "C: " << m_contrast->getValue() << " ";
+        os << "C: " << m_contrast->getValue() << " ";
     }
     if (!m_gamma->isDynamic())
     {
-        cacheIDStream << "G: " << m_gamma->getValue() << " ";
+        os << "G: " << m_gamma->getValue() << " ";
     }
-    cacheIDStream << "P: " << m_pivot << " ";
-    cacheIDStream << "LES: " << m_logExposureStep << " ";
-    cacheIDStream << "LMG: " << m_logMidGray;
-
-    return cacheIDStream.str();
+    os << "P: " << m_pivot << " ";
+    os << "LES: " << m_logExposureStep << " ";
+    os << "LMG: " << m_logMidGray;
 }
 
 bool ExposureContrastOpData::equals(const OpData & other) const
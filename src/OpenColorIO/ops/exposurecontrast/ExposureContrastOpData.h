@@ -159,7 +159,7 @@ public:
     bool isInverse(ConstExposureContrastOpDataRcPtr & r) const;
     ExposureContrastOpDataRcPtr inverse() const;
 
-    std::string getCacheID() const override;
+    void writeCacheID(std::ostream & os) const override;
 
     bool equals(const OpData & other) const override;
 
@@ -91,7 +91,7 @@ inline m33f m33_from_ocio_matrix_array(const MatrixOpData::MatrixArray &array)
 inline m33f invert_f33(const m33f &mat33)
 {
     MatrixOpData::MatrixArray array;
-    MatrixOpData::MatrixArray::Values & v = array.getValues();
+    double * v = array.getValues().mutableData();
 
     v[0] = mat33[0];
     v[1] = mat33[1];
@@ -0,0 +1,578 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#ifndef INCLUDED_OCIO_ACES2_TRANSFORMSIMD_H
+#define INCLUDED_OCIO_ACES2_TRANSFORMSIMD_H
+
+#include <cstring>
+#include <limits>
+
+#include "Transform.h"
+
+namespace OCIO_NAMESPACE
+{
+
+namespace ACES2
+{
+
+// SIMD version of the forward ACES 2.0 output transform.
+//
+// The code mirrors the scalar implementation from Transform.cpp but processes V::width pixels
+// at once.  It is only included by the FixedFunctionOpCPU_<ISA>.cpp files where V is a
+// structure wrapping the intrinsics of the instruction set:
+//
+//   F, I & M    The float, int32 & comparison mask vector types.
+//   width       The number of pixels (i.e. lanes) processed at once.
+//   set1, iset1, add, sub, mul, div, fmadd (a * b + c), min, max, sqrt,
+//   lt, le, gt, mand, mor, mandnot (!a && b), select (mask ? a : b), any,
+//   cvtt (truncate), cvtr (round), cvtf, asInt, asFloat, iadd, isub, iand, ior,
+//   sll23, srl23, gather, load & store (i.e. RGBA F32 pixels).
+//
+// The branches of the scalar code are computed for all the lanes and merged using the masks.
+// The transcendental functions use polynomial approximations (with a precision of about
+// 1e-7 relative error) so the results differ slightly from the scalar version (refer to
+// the FixedFunctionOpCPU unit tests for the tolerance).
+namespace SIMD
+{
+
+template<typename V>
+inline typename V::F abs(typename V::F x)
+{
+    return V::asFloat(V::iand(V::asInt(x), V::iset1(0x7fffffff)));
+}
+
+// Return the magnitude of 'mag' with the sign of 'sgn'.
+template<typename V>
+inline typename V::F copysign(typename V::F mag, typename V::F sgn)
+{
+    return V::asFloat(V::ior(V::iand(V::asInt(mag), V::iset1(0x7fffffff)),
+                             V::iand(V::asInt(sgn), V::iset1(static_cast<int>(0x80000000u)))));
+}
+
+template<typename V>
+inline typename V::F lerp(typename V::F a, typename V::F b, typename V::F t)
+{
+    return V::fmadd(V::sub(b, a), t, a);
+}
+
+// Note: Values smaller than FLT_MIN (including negative values) are processed as FLT_MIN.
+template<typename V>
+inline typename V::F log2(typename V::F x)
+{
+    using F = typename V::F;
+    using I = typename V::I;
+
+    x = V::max(x, V::set1(std::numeric_limits<float>::min()));
+
+    // x = 2^e * m with m in [sqrt(0.5), sqrt(2)[.
+    const I xi = V::asInt(x);
+    F e = V::cvtf(V::isub(V::srl23(xi), V::iset1(127)));
+    F m = V::asFloat(V::ior(V::iand(xi, V::iset1(0x007fffff)), V::iset1(0x3f800000)));
+
+    const auto big = V::gt(m, V::set1(1.41421356f));
+    m = V::select(big, V::mul(m, V::set1(0.5f)), m);
+    e = V::select(big, V::add(e, V::set1(1.0f)), e);
+
+    // Polynomial approximation of ln(1 + t) over [sqrt(0.5) - 1, sqrt(2) - 1[ (from Cephes).
+    const F t = V::sub(m, V::set1(1.0f));
+    const F z = V::mul(t, t);
+
+    F p = V::set1(7.0376836292e-2f);
+    p = V::fmadd(p, t, V::set1(-1.1514610310e-1f));
+    p = V::fmadd(p, t, V::set1( 1.1676998740e-1f));
+    p = V::fmadd(p, t, V::set1(-1.2420140846e-1f));
+    p = V::fmadd(p, t, V::set1( 1.4249322787e-1f));
+    p = V::fmadd(p, t, V::set1(-1.6668057665e-1f));
+    p = V::fmadd(p, t, V::set1( 2.0000714765e-1f));
+    p = V::fmadd(p, t, V::set1(-2.4999993993e-1f));
+    p = V::fmadd(p, t, V::set1( 3.3333331174e-1f));
+
+    const F ln = V::fmadd(V::mul(t, z), p, V::fmadd(z, V::set1(-0.5f), t));
+
+    return V::fmadd(ln, V::set1(1.44269504089f), e);
+}
+
+// Note: Results smaller than 2^-126 are flushed to zero.
+template<typename V>
+inline typename V::F exp2(typename V::F x)
+{
+    using F = typename V::F;
+    using I = typename V::I;
+
+    const F xc = V::min(V::max(x, V::set1(-126.0f)), V::set1(127.0f));
+
+    // x = n + r with r in [-0.5, 0.5].
+    const I n = V::cvtr(xc);
+    const F r = V::sub(xc, V::cvtf(n));
+
+    // Polynomial approximation of 2^r (from Cephes).
+    F p = V::set1(1.535336188319500e-4f);
+    p = V::fmadd(p, r, V::set1(1.339887440266574e-3f));
+    p = V::fmadd(p, r, V::set1(9.618437357674640e-3f));
+    p = V::fmadd(p, r, V::set1(5.550332471162809e-2f));
+    p = V::fmadd(p, r, V::set1(2.402264791363012e-1f));
+    p = V::fmadd(p, r, V::set1(6.931472028550421e-1f));
+    p = V::fmadd(p, r, V::set1(1.0f));
+
+    const F scale = V::asFloat(V::sll23(V::iadd(n, V::iset1(127))));
+    const F res = V::mul(p, scale);
+
+    return V::select(V::lt(x, V::set1(-126.0f)), V::set1(0.0f), res);
+}
+
+// Note: Results for base values smaller or equal to zero are zero.
+template<typename V>
+inline typename V::F pow(typename V::F x, typename V::F y)
+{
+    const typename V::F res = exp2<V>(V::mul(y, log2<V>(x)));
+    return V::select(V::gt(x, V::set1(0.0f)), res, V::set1(0.0f));
+}
+
+template<typename V>
+inline typename V::F pow(typename V::F x, float y)
+{
+    return pow<V>(x, V::set1(y));
+}
+
+// Return atan2(y, x) in degrees in the range [0, 360].
+template<typename V>
+inline typename V::F atan2_degrees(typename V::F y, typename V::F x)
+{
+    using F = typename V::F;
+
+    const F ax = abs<V>(x);
+    const F ay = abs<V>(y);
+    const F mx = V::max(ax, ay);
+    const F mn = V::min(ax, ay);
+
+    F a = V::select(V::gt(mx, V::set1(0.0f)), V::div(mn, mx), V::set1(0.0f));
+
+    // Reduce the range to [0, tan(pi/8)].
+    const auto reduce = V::gt(a, V::set1(0.4142135623730950f));
+    a = V::select(reduce, V::div(V::sub(a, V::set1(1.0f)), V::add(a, V::set1(1.0f))), a);
+
+    // Polynomial approximation of atan(a) (from Cephes).
+    const F z = V::mul(a, a);
+    F p = V::set1(8.05374449538e-2f);
+    p = V::fmadd(p, z, V::set1(-1.38776856032e-1f));
+    p = V::fmadd(p, z, V::set1( 1.99777106478e-1f));
+    p = V::fmadd(p, z, V::set1(-3.33329491539e-1f));
+    F r = V::fmadd(V::mul(p, z), a, a);
+    r = V::select(reduce, V::add(r, V::set1(PI / 4.0f)), r);
+
+    r = V::select(V::gt(ay, ax), V::sub(V::set1(PI / 2.0f), r), r);
+    r = V::select(V::lt(x, V::set1(0.0f)), V::sub(V::set1(PI), r), r);
+    r = V::select(V::lt(y, V::set1(0.0f)), V::sub(V::set1(0.0f), r), r);
+
+    const F h = V::mul(r, V::set1(180.0f / PI));
+    return V::select(V::lt(h, V::set1(0.0f)), V::add(h, V::set1(hue_limit)), h);
+}
+
+template<typename V>
+inline void mult_f3_f33(typename V::F & c0, typename V::F & c1, typename V::F & c2,
+                        const m33f & m)
+{
+    const typename V::F i0 = c0;
+    const typename V::F i1 = c1;
+    const typename V::F i2 = c2;
+
+    c0 = V::fmadd(i0, V::set1(m[0]), V::fmadd(i1, V::set1(m[1]), V::mul(i2, V::set1(m[2]))));
+    c1 = V::fmadd(i0, V::set1(m[3]), V::fmadd(i1, V::set1(m[4]), V::mul(i2, V::set1(m[5]))));
+    c2 = V::fmadd(i0, V::set1(m[6]), V::fmadd(i1, V::set1(m[7]), V::mul(i2, V::set1(m[8]))));
+}
+
+template<typename V>
+inline typename V::F post_adaptation_cone_response_compression_fwd(typename V::F v)
+{
+    const typename V::F F_L_Y = pow<V>(abs<V>(v), 0.42f);
+    const typename V::F Ra    = V::div(F_L_Y, V::add(V::set1(cam_nl_offset), F_L_Y));
+    return copysign<V>(Ra, v);
+}
+
+template<typename V>
+inline typename V::F _post_adaptation_cone_response_compression_inv(typename V::F Ra)
+{
+    const typename V::F Ra_lim = V::min(Ra, V::set1(0.99f));
+    const typename V::F F_L_Y  = V::div(V::mul(V::set1(cam_nl_offset), Ra_lim),
+                                        V::sub(V::set1(1.0f), Ra_lim));
+    return pow<V>(F_L_Y, 1.0f / 0.42f);
+}
+
+template<typename V>
+inline typename V::F post_adaptation_cone_response_compression_inv(typename V::F v)
+{
+    return copysign<V>(_post_adaptation_cone_response_compression_inv<V>(abs<V>(v)), v);
+}
+
+template<typename V>
+inline typename V::F _Y_to_J(typename V::F abs_Y, const JMhParams & p)
+{
+    using F = typename V::F;
+
+    const F F_L_Y = pow<V>(V::mul(abs_Y, V::set1(p.F_L_n)), 0.42f);
+    const F Ra    = V::div(F_L_Y, V::add(V::set1(cam_nl_offset), F_L_Y));
+    return V::mul(V::set1(J_scale), pow<V>(V::mul(Ra, V::set1(p.inv_A_w_J)), p.cz));
+}
+
+// Equivalent of tonescale_A_to_J_fwd() where the achromatic value A is strictly positive.
+template<typename V>
+inline typename V::F tonescale_A_to_J_fwd(typename V::F A, const JMhParams & p,
+                                          const ToneScaleParams & pt)
+{
+    using F = typename V::F;
+
+    const F Y_in = V::div(_post_adaptation_cone_response_compression_inv<V>(V::mul(V::set1(p.A_w_J), A)),
+                          V::set1(p.F_L_n));
+
+    const F f    = V::mul(V::set1(pt.m_2),
+                          pow<V>(V::div(Y_in, V::add(Y_in, V::set1(pt.s_2))), pt.g));
+    const F Y_ts = V::mul(V::max(V::div(V::mul(f, f), V::add(f, V::set1(pt.t_1))), V::set1(0.0f)),
+                          V::set1(pt.n_r));
+
+    return _Y_to_J<V>(Y_ts, p);
+}
+
+template<typename V>
+inline typename V::F chroma_compress_norm(typename V::F cos_hr1, typename V::F sin_hr1,
+                                          float chroma_compress_scale)
+{
+    using F = typename V::F;
+
+    const F cos_hr2 = V::fmadd(V::mul(V::set1(2.0f), cos_hr1), cos_hr1, V::set1(-1.0f));
+    const F sin_hr2 = V::mul(V::mul(V::set1(2.0f), cos_hr1), sin_hr1);
+    const F cos_hr3 = V::mul(cos_hr1, V::fmadd(V::mul(V::set1(4.0f), cos_hr1), cos_hr1, V::set1(-3.0f)));
+    const F sin_hr3 = V::mul(sin_hr1, V::sub(V::set1(3.0f), V::mul(V::mul(V::set1(4.0f), sin_hr1), sin_hr1)));
+
+    F M = V::set1(77.12896f);
+    M = V::fmadd(V::set1(11.34072f), cos_hr1, M);
+    M = V::fmadd(V::set1(16.46899f), cos_hr2, M);
+    M = V::fmadd(V::set1(7.88380f),  cos_hr3, M);
+    M = V::fmadd(V::set1(14.66441f), sin_hr1, M);
+    M = V::fmadd(V::set1(-6.37224f), sin_hr2, M);
+    M = V::fmadd(V::set1(9.19364f),  sin_hr3, M);
+
+    return V::mul(M, V::set1(chroma_compress_scale));
+}
+
+template<typename V>
+inline typename V::F toe_fwd(typename V::F x, typename V::F limit, typename V::F k1_in, typename V::F k2_in)
+{
+    using F = typename V::F;
+
+    const F k2 = V::max(k2_in, V::set1(0.001f));
+    const F k1 = V::sqrt(V::fmadd(k1_in, k1_in, V::mul(k2, k2)));
+    const F k3 = V::div(V::add(limit, k1), V::add(limit, k2));
+
+    const F minus_b  = V::sub(V::mul(k3, x), k1);
+    const F minus_ac = V::mul(V::mul(k2, k3), x);
+    const F res      = V::mul(V::set1(0.5f),
+                              V::add(minus_b, V::sqrt(V::fmadd(minus_b, minus_b,
+                                                               V::mul(V::set1(4.0f), minus_ac)))));
+
+    return V::select(V::gt(x, limit), x, res);
+}
+
+// Equivalent of chroma_compress_fwd() returning the compressed M.
+template<typename V>
+inline typename V::F chroma_compress_fwd(typename V::F J, typename V::F M, typename V::F J_ts,
+                                         typename V::F Mnorm, typename V::F reachMaxM,
+                                         const SharedCompressionParameters & ps,
+                                         const ChromaCompressParams & pc)
+{
+    using F = typename V::F;
+
+    const F nJ    = V::div(J_ts, V::set1(ps.limit_J_max));
+    const F snJ   = V::max(V::sub(V::set1(1.0f), nJ), V::set1(0.0f));
+    const F limit = V::div(V::mul(pow<V>(nJ, ps.model_gamma_inv), reachMaxM), Mnorm);
+
+    F M_cp = V::mul(M, pow<V>(V::div(J_ts, J), ps.model_gamma_inv));
+    M_cp = V::div(M_cp, Mnorm);
+    M_cp = V::sub(limit, toe_fwd<V>(V::sub(limit, M_cp),
+                                    V::sub(limit, V::set1(0.001f)),
+                                    V::mul(snJ, V::set1(pc.sat)),
+                                    V::sqrt(V::fmadd(nJ, nJ, V::set1(pc.sat_thr)))));
+    M_cp = toe_fwd<V>(M_cp, limit, V::mul(nJ, V::set1(pc.compr)), snJ);
+    M_cp = V::mul(M_cp, Mnorm);
+
+    return V::select(V::gt(M, V::set1(0.0f)), M_cp, M);
+}
+
+template<typename V>
+inline typename V::F solve_J_intersect(typename V::F J, typename V::F M, typename V::F focusJ,
+                                       float maxJ, typename V::F slope_gain)
+{
+    using F = typename V::F;
+
+    const F M_scaled = V::div(M, slope_gain);
+    const F a        = V::div(M_scaled, focusJ);
+
+    const auto below = V::lt(J, focusJ);
+
+    const F b = V::select(below,
+                          V::sub(V::set1(1.0f), M_scaled),
+                          V::sub(V::set1(0.0f), V::add(V::add(V::set1(1.0f), M_scaled),
+                                                       V::mul(V::set1(maxJ), a))));
+    const F c = V::select(below,
+                          V::sub(V::set1(0.0f), J),
+                          V::fmadd(V::set1(maxJ), M_scaled, J));
+
+    const F det  = V::sub(V::mul(b, b), V::mul(V::mul(V::set1(4.0f), a), c));
+    const F root = V::sqrt(det);
+
+    return V::div(V::mul(V::set1(-2.0f), c), V::select(below, V::add(b, root), V::sub(b, root)));
+}
+
+template<typename V>
+inline typename V::F estimate_line_and_boundary_intersection_M(typename V::F J_axis_intersect,
+                                                               typename V::F slope,
+                                                               typename V::F inv_gamma,
+                                                               typename V::F J_max,
+                                                               typename V::F M_max,
+                                                               typename V::F J_intersection_reference)
+{
+    using F = typename V::F;
+
+    const F normalised_J         = V::div(J_axis_intersect, J_intersection_reference);
+    const F shifted_intersection = V::mul(J_intersection_reference, pow<V>(normalised_J, inv_gamma));
+
+    return V::div(V::mul(shifted_intersection, M_max), V::sub(J_max, V::mul(slope, M_max)));
+}
+
+// Process one vector of pixels in place.
+template<typename V>
+inline void OutputTransformFwd(typename V::F & red, typename V::F & grn, typename V::F & blu,
+                               const JMhParams & pIn, const JMhParams & pOut,
+                               const ToneScaleParams & t, const SharedCompressionParameters & s,
+                               const ChromaCompressParams & c, const GamutCompressParams & g)
+{
+    using F = typename V::F;
+    using I = typename V::I;
+
+    const F zero = V::set1(0.0f);
+    const F one  = V::set1(1.0f);
+
+    //
+    // RGB_to_Aab & Aab_to_JMh
+    //
+
+    F A = red, a = grn, b = blu;
+    mult_f3_f33<V>(A, a, b, pIn.MATRIX_RGB_to_CAM16_c);
+    A = post_adaptation_cone_response_compression_fwd<V>(A);
+    a = post_adaptation_cone_response_compression_fwd<V>(a);
+    b = post_adaptation_cone_response_compression_fwd<V>(b);
+    mult_f3_f33<V>(A, a, b, pIn.MATRIX_cone_response_to_Aab);
+
+    const auto chromatic = V::gt(A, zero);
+
+    const F J = V::select(chromatic, V::mul(V::set1(J_scale), pow<V>(A, pIn.cz)), zero);
+    const F M = V::select(chromatic, V::sqrt(V::fmadd(a, a, V::mul(b, b))), zero);
+    const F h = V::select(chromatic, atan2_degrees<V>(b, a), zero);
+
+    // The cosine & sine of the hue angle are directly derived from the Aab values.
+    const auto hasM = V::gt(M, zero);
+    const F cos_hr = V::select(hasM, V::div(a, M), one);
+    const F sin_hr = V::select(hasM, V::div(b, M), zero);
+
+    // The hue used for the table look-ups is always a valid table position.
+    const F hc = V::min(V::max(h, zero), V::set1(hue_limit));
+
+    //
+    // resolve_CompressionParams
+    //
+
+    const I reachBase  = V::cvtt(hc);
+    const F reachT     = V::sub(hc, V::cvtf(reachBase));
+    const I reachLo    = V::iadd(reachBase, V::iset1(int(s.reach_m_table.first_nominal_index)));
+    const F reachMaxM  = lerp<V>(V::gather(s.reach_m_table.data(), reachLo),
+                                 V::gather(s.reach_m_table.data(), V::iadd(reachLo, V::iset1(1))),
+                                 reachT);
+
+    //
+    // Tonescale & chroma compression
+    //
+
+    const F Mnorm = chroma_compress_norm<V>(cos_hr, sin_hr, c.chroma_compress_scale);
+
+    const F J_ts  = V::select(chromatic, tonescale_A_to_J_fwd<V>(A, pIn, t), zero);
+    const F M_cp  = chroma_compress_fwd<V>(J, M, J_ts, Mnorm, reachMaxM, s, c);
+
+    //
+    // Gamut compression
+    //
+
+    // Hue dependant parameters (i.e. init_HueDependantGamutParams).
+    const Table1D & hues = g.hue_table;
+
+    F i  = V::add(V::cvtf(V::cvtt(hc)), V::set1(float(hues.first_nominal_index)));
+    F lo = V::max(V::set1(float(hues.lower_wrap_index)),
+                  V::add(i, V::set1(float(g.hue_linearity_search_range[0]))));
+    F hi = V::min(V::set1(float(hues.upper_wrap_index)),
+                  V::add(i, V::set1(float(g.hue_linearity_search_range[1]))));
+
+    auto active = V::lt(V::add(lo, one), hi);
+    while (V::any(active))
+    {
+        const auto above = V::gt(hc, V::gather(hues.data(), V::cvtt(i)));
+        lo = V::select(V::mand(active, above), i, lo);
+        hi = V::select(V::mandnot(above, active), i, hi);
+        i  = V::cvtf(V::cvtt(V::mul(V::add(lo, hi), V::set1(0.5f))));
+
+        active = V::lt(V::add(lo, one), hi);
+    }
+    hi = V::max(hi, one);
+
+    const I i_hi = V::cvtt(hi);
+    const I i_lo = V::isub(i_hi, V::iset1(1));
+
+    const F hue_lo = V::gather(hues.data(), i_lo);
+    const F hue_hi = V::gather(hues.data(), i_hi);
+    const F cuspT  = V::div(V::sub(hc, hue_lo), V::sub(hue_hi, hue_lo));
+
+    const float * cusps = &g.gamut_cusp_table[0][0];
+    const I c_lo = V::iadd(V::iadd(i_lo, i_lo), i_lo);
+    const I c_hi = V::iadd(V::iadd(i_hi, i_hi), i_hi);
+
+    const F cuspJ         = lerp<V>(V::gather(cusps,     c_lo), V::gather(cusps,     c_hi), cuspT);
+    const F cuspM         = lerp<V>(V::gather(cusps + 1, c_lo), V::gather(cusps + 1, c_hi), cuspT);
+    const F gamma_top_inv = lerp<V>(V::gather(cusps + 2, c_lo), V::gather(cusps + 2, c_hi), cuspT);
+
+    const F limit_J_max = V::set1(s.limit_J_max);
+
+    const F focusJ = lerp<V>(cuspJ, V::set1(g.mid_J),
+                             V::min(one, V::sub(V::set1(cusp_mid_blend), V::div(cuspJ, limit_J_max))));
+    const F analytical_threshold = lerp<V>(cuspJ, limit_J_max, V::set1(focus_gain_blend));
+
+    // compressGamut
+    const F Jg = J_ts;
+    const F Mg = M_cp;
+
+    F gain_adjustment = V::div(V::sub(limit_J_max, analytical_threshold),
+                               V::max(V::sub(limit_J_max, Jg), V::set1(0.0001f)));
+    gain_adjustment = V::mul(log2<V>(gain_adjustment), V::set1(0.301029995664f)); // log10
+    gain_adjustment = V::fmadd(gain_adjustment, gain_adjustment, one);
+
+    const F slope_gain = V::mul(V::set1(s.limit_J_max * g.focus_dist),
+                                V::select(V::gt(Jg, analytical_threshold), gain_adjustment, one));
+
+    const F J_intersect_source = solve_J_intersect<V>(Jg, Mg, focusJ, s.limit_J_max, slope_gain);
+
+    const F direction_scaler = V::select(V::lt(J_intersect_source, focusJ),
+                                         J_intersect_source,
+                                         V::sub(limit_J_max, J_intersect_source));
+    const F gamut_slope = V::div(V::mul(direction_scaler, V::sub(J_intersect_source, focusJ)),
+                                 V::mul(focusJ, slope_gain));
+
+    const F J_intersect_cusp = solve_J_intersect<V>(cuspJ, cuspM, focusJ, s.limit_J_max, slope_gain);
+
+    // find_gamut_boundary_intersection
+    const F M_boundary_lower
+        = estimate_line_and_boundary_intersection_M<V>(J_intersect_source, gamut_slope,
+                                                       V::set1(g.lower_hull_gamma_inv),
+                                                       cuspJ, cuspM, J_intersect_cusp);
+    const F M_boundary_upper
+        = estimate_line_and_boundary_intersection_M<V>(V::sub(limit_J_max, J_intersect_source),
+                                                       V::sub(zero, gamut_slope),
+                                                       gamma_top_inv,
+                                                       V::sub(limit_J_max, cuspJ),
+                                                       cuspM,
+                                                       V::sub(limit_J_max, J_intersect_cusp));
+
+    const F s_scaled = V::mul(V::set1(smooth_cusps), cuspM);
+    const F hs = V::div(V::max(V::sub(s_scaled, abs<V>(V::sub(M_boundary_lower, M_boundary_upper))), zero),
+                        s_scaled);
+    const F gamut_boundary_M = V::sub(V::min(M_boundary_lower, M_boundary_upper),
+                                      V::mul(V::mul(V::mul(V::mul(hs, hs), hs), s_scaled),
+                                             V::set1(1.0f / 6.0f)));
+
+    const F reachBoundaryM
+        = estimate_line_and_boundary_intersection_M<V>(J_intersect_source, gamut_slope,
+                                                       V::set1(s.model_gamma_inv),
+                                                       limit_J_max, reachMaxM, limit_J_max);
+
+    // remap_M
+    const F proportion = V::max(V::div(gamut_boundary_M, reachBoundaryM), V::set1(compression_threshold));
+    const F threshold  = V::mul(proportion, gamut_boundary_M);
+
+    const F m_offset     = V::sub(Mg, threshold);
+    const F gamut_offset = V::sub(gamut_boundary_M, threshold);
+    const F reach_offset = V::sub(reachBoundaryM, threshold);
+
+    const F scale = V::div(reach_offset, V::sub(V::div(reach_offset, gamut_offset), one));
+    const F nd    = V::div(m_offset, scale);
+
+    const auto noRemap = V::mor(V::le(Mg, threshold), V::le(one, proportion));
+    const F remapped_M = V::select(noRemap, Mg,
+                                   V::add(threshold, V::div(V::mul(scale, nd), V::add(one, nd))));
+
+    // gamut_compress_fwd
+    const auto noBoundary = V::le(gamut_boundary_M, zero);
+    F Jout = V::select(noBoundary, Jg, V::fmadd(remapped_M, gamut_slope, J_intersect_source));
+    F Mout = V::select(noBoundary, zero, remapped_M);
+
+    const auto noCompress = V::mor(V::le(Mg, zero), V::gt(Jg, limit_J_max));
+    Jout = V::select(noCompress, Jg, Jout);
+    Mout = V::select(noCompress, zero, Mout);
+
+    const auto black = V::le(Jg, zero);
+    Jout = V::select(black, zero, Jout);
+    Mout = V::select(black, zero, Mout);
+
+    //
+    // JMh_to_Aab & Aab_to_RGB
+    //
+
+    A = pow<V>(V::mul(Jout, V::set1(1.0f / J_scale)), pOut.inv_cz);
+    a = V::mul(Mout, cos_hr);
+    b = V::mul(Mout, sin_hr);
+
+    mult_f3_f33<V>(A, a, b, pOut.MATRIX_Aab_to_cone_response);
+    A = post_adaptation_cone_response_compression_inv<V>(A);
+    a = post_adaptation_cone_response_compression_inv<V>(a);
+    b = post_adaptation_cone_response_compression_inv<V>(b);
+    mult_f3_f33<V>(A, a, b, pOut.MATRIX_CAM16_c_to_RGB);
+
+    red = A;
+    grn = a;
+    blu = b;
+}
+
+template<typename V>
+void OutputTransformFwd(const JMhParams & pIn, const JMhParams & pOut,
+                        const ToneScaleParams & t, const SharedCompressionParameters & s,
+                        const ChromaCompressParams & c, const GamutCompressParams & g,
+                        const float * in, float * out, long numPixels)
+{
+    typename V::F red, grn, blu, alpha;
+
+    long idx = 0;
+    for (; idx + V::width <= numPixels; idx += V::width)
+    {
+        V::load(in, red, grn, blu, alpha);
+        OutputTransformFwd<V>(red, grn, blu, pIn, pOut, t, s, c, g);
+        V::store(out, red, grn, blu, alpha);
+
+        in  += 4 * V::width;
+        out += 4 * V::width;
+    }
+
+    const long remainder = numPixels - idx;
+    if (remainder > 0)
+    {
+        float buffer[4 * V::width] = { 0.0f };
+        std::memcpy(buffer, in, remainder * 4 * sizeof(float));
+
+        V::load(buffer, red, grn, blu, alpha);
+        OutputTransformFwd<V>(red, grn, blu, pIn, pOut, t, s, c, g);
+        V::store(buffer, red, grn, blu, alpha);
+
+        std::memcpy(out, buffer, remainder * 4 * sizeof(float));
+    }
+}
+
+} // namespace SIMD
+
+} // namespace ACES2
+
+} // OCIO namespace
+
+#endif
@@ -41,7 +41,7 @@ public:
     bool canCombineWith(ConstOpRcPtr & op) const override;
     void combineWith(OpRcPtrVec & ops, ConstOpRcPtr & secondOp) const override;
 
-    std::string getCacheID() const override;
+    void writeCacheID(std::ostream & os) const override;
 
     ConstOpCPURcPtr getCPUOp(bool fastLogExpPow) const override;
 
@@ -108,15 +108,12 @@ void FixedFunctionOp::combineWith(OpRcPtrVec & /*ops*/, ConstOpRcPtr & secondOp)
     }
 }
 
-std::string FixedFunctionOp::getCacheID() const
+void FixedFunctionOp::writeCacheID(std::ostream & os) const
 {
     // Create the cacheID.
-    std::ostringstream cacheIDStream;
-    cacheIDStream << "<FixedFunctionOp ";
-    cacheIDStream << fnData()->getCacheID();
-    cacheIDStream << ">";
-
-    return cacheIDStream.str();
+    os << "<FixedFunctionOp ";
+    fnData()->writeCacheID(os);
+    os << ">";
 }
 
 ConstOpCPURcPtr FixedFunctionOp::getCPUOp(bool fastLogExpPow) const
@@ -13,6 +13,9 @@
 #include "ops/fixedfunction/FixedFunctionOpCPU.h"
 #include "SSE.h"
 #include "CPUInfo.h"
+#include "FixedFunctionOpCPU_SSE2.h"
+#include "FixedFunctionOpCPU_AVX2.h"
+#include "FixedFunctionOpCPU_AVX512.h"
 
 
 namespace OCIO_NAMESPACE
@@ -152,6 +155,30 @@ protected:
     ACES2::GamutCompressParams m_g;
 };
 
+#if OCIO_USE_SSE2
+// SIMD version of the forward ACES 2.0 output transform. The log, exp & pow functions are
+// approximated so it is only used when OPTIMIZATION_FAST_LOG_EXP_POW is enabled.
+class Renderer_ACES_OutputTransform20_Fwd_SIMD : public Renderer_ACES_OutputTransform20
+{
+public:
+    Renderer_ACES_OutputTransform20_Fwd_SIMD() = delete;
+    explicit Renderer_ACES_OutputTransform20_Fwd_SIMD(ConstFixedFunctionOpDataRcPtr & data);
+
+    void apply(const void * inImg, void * outImg, long numPixels) const override;
+
+protected:
+    typedef void (ApplyFunc)(const ACES2::JMhParams & pIn,
+                             const ACES2::JMhParams & pOut,
+                             const ACES2::ToneScaleParams & t,
+                             const ACES2::SharedCompressionParameters & s,
+                             const ACES2::ChromaCompressParams & c,
+                             const ACES2::GamutCompressParams & g,
+                             const float * in, float * out, long numPixels);
+
+    ApplyFunc * m_applyFunc = nullptr;
+};
+#endif // OCIO_USE_SSE2
+
 class Renderer_ACES_RGB_TO_JMh_20 : public OpCPU
 {
 public:
@@ -346,6 +373,23 @@ public:
     void apply(const void * inImg, void * outImg, long numPixels) const override;
 };
 
+#if OCIO_USE_SSE2
+// SIMD version of the color model conversions i.e. HSV, HSY, xyY, uvY & LUV (refer to
+// FixedFunctionOpCPU_SIMD.h).
+template<typename Renderer>
+class Renderer_ColorModel_SIMD : public Renderer
+{
+public:
+    Renderer_ColorModel_SIMD() = delete;
+    explicit Renderer_ColorModel_SIMD(ConstFixedFunctionOpDataRcPtr & data);
+
+    void apply(const void * inImg, void * outImg, long numPixels) const override;
+
+protected:
+    ColorModelSIMDApplyFunc * m_applyFunc = nullptr;
+};
+#endif // OCIO_USE_SSE2
+
 template <typename T>
 class Renderer_LIN_TO_PQ : public OpCPU {
 public:
@@ -1165,6 +1209,44 @@ void Renderer_ACES_OutputTransform20::inv(const void * inImg, void * outImg, lon
     }
 }
 
+#if OCIO_USE_SSE2
+Renderer_ACES_OutputTransform20_Fwd_SIMD::Renderer_ACES_OutputTransform20_Fwd_SIMD(ConstFixedFunctionOpDataRcPtr & data)
+    :   Renderer_ACES_OutputTransform20(data)
+{
+    if (CPUInfo::instance().hasSSE2())
+    {
+        m_applyFunc = applyACESOutputTransform20FwdSSE2;
+    }
+
+#if OCIO_USE_AVX2
+    if (CPUInfo::instance().hasAVX2() && !CPUInfo::instance().AVX2SlowGather())
+    {
+        m_applyFunc = applyACESOutputTransform20FwdAVX2;
+    }
+#endif
+
+#if OCIO_USE_AVX512
+    if (CPUInfo::instance().hasAVX512())
+    {
+        m_applyFunc = applyACESOutputTransform20FwdAVX512;
+    }
+#endif
+}
+
+void Renderer_ACES_OutputTransform20_Fwd_SIMD::apply(const void * inImg, void * outImg, long numPixels) const
+{
+    if (m_applyFunc)
+    {
+        m_applyFunc(m_pIn, m_pOut, m_t, m_s, m_c, m_g,
+                    (const float *)inImg, (float *)outImg, numPixels);
+    }
+    else
+    {
+        Renderer_ACES_OutputTransform20::apply(inImg, outImg, numPixels);
+    }
+}
+#endif // OCIO_USE_SSE2
+
 Renderer_ACES_RGB_TO_JMh_20::Renderer_ACES_RGB_TO_JMh_20(ConstFixedFunctionOpDataRcPtr & data)
     :   OpCPU()
 {
@@ -2025,6 +2107,77 @@ void Renderer_LUV_TO_XYZ::apply(const void * inImg, void * outImg, long numPixel
     }
 }
 
+#if OCIO_USE_SSE2
+namespace
+{
+
+// Return the SIMD version of the color model conversion for the best available instruction
+// set, or null if the style is not a color model conversion.
+ColorModelSIMDApplyFunc * GetColorModelSIMDFunc(FixedFunctionOpData::Style style)
+{
+    ColorModelSIMDApplyFunc * applyFunc = nullptr;
+
+    if (CPUInfo::instance().hasSSE2())
+    {
+        applyFunc = getColorModelFuncSSE2(style);
+    }
+
+#if OCIO_USE_AVX2
+    if (CPUInfo::instance().hasAVX2())
+    {
+        applyFunc = getColorModelFuncAVX2(style);
+    }
+#endif
+
+#if OCIO_USE_AVX512
+    if (CPUInfo::instance().hasAVX512())
+    {
+        applyFunc = getColorModelFuncAVX512(style);
+    }
+#endif
+
+    return applyFunc;
+}
+
+} // anonymous namespace
+
+template<typename Renderer>
+Renderer_ColorModel_SIMD<Renderer>::Renderer_ColorModel_SIMD(ConstFixedFunctionOpDataRcPtr & data)
+    :   Renderer(data)
+{
+    m_applyFunc = GetColorModelSIMDFunc(data->getStyle());
+}
+
+template<typename Renderer>
+void Renderer_ColorModel_SIMD<Renderer>::apply(const void * inImg, void * outImg, long numPixels) const
+{
+    if (m_applyFunc)
+    {
+        m_applyFunc((const float *)inImg, (float *)outImg, numPixels);
+    }
+    else
+    {
+        Renderer::apply(inImg, outImg, numPixels);
+    }
+}
+#endif // OCIO_USE_SSE2
+
+namespace
+{
+
+// Use the SIMD version of the color model conversion when available.
+template<typename Renderer>
+ConstOpCPURcPtr GetColorModelRenderer(ConstFixedFunctionOpDataRcPtr & func)
+{
+#if OCIO_USE_SSE2
+    return std::make_shared<Renderer_ColorModel_SIMD<Renderer>>(func);
+#else
+    return std::make_shared<Renderer>(func);
+#endif // OCIO_USE_SSE2
+}
+
+} // anonymous namespace
+
 namespace 
 {
 namespace ST_2084
@@ -2486,6 +2639,13 @@ ConstOpCPURcPtr GetFixedFunctionCPURenderer(ConstFixedFunctionOpDataRcPtr & func
         case FixedFunctionOpData::ACES_OUTPUT_TRANSFORM_20_FWD:
         case FixedFunctionOpData::ACES_OUTPUT_TRANSFORM_20_INV:
         {
+#if OCIO_USE_SSE2
+            // Only the forward direction has a SIMD implementation.
+            if (fastLogExpPow && func->getStyle() == FixedFunctionOpData::ACES_OUTPUT_TRANSFORM_20_FWD)
+            {
+                return std::make_shared<Renderer_ACES_OutputTransform20_Fwd_SIMD>(func);
+            }
+#endif // OCIO_USE_SSE2
             // Sharing same renderer (param will be inverted to handle direction).
             return std::make_shared<Renderer_ACES_OutputTransform20>(func);
         }
@@ -2520,38 +2680,43 @@ ConstOpCPURcPtr GetFixedFunctionCPURenderer(ConstFixedFunctionOpDataRcPtr & func
 
         case FixedFunctionOpData::RGB_TO_HSV:
         {
-            return std::make_shared<Renderer_RGB_TO_HSV>(func);
+            return GetColorModelRenderer<Renderer_RGB_TO_HSV>(func);
         }
         case FixedFunctionOpData::HSV_TO_RGB:
         {
-            return std::make_shared<Renderer_HSV_TO_RGB>(func);
+            return GetColorModelRenderer<Renderer_HSV_TO_RGB>(func);
         }
 
         case FixedFunctionOpData::XYZ_TO_xyY:
         {
-            return std::make_shared<Renderer_XYZ_TO_xyY>(func);
+            return GetColorModelRenderer<Renderer_XYZ_TO_xyY>(func);
         }
         case FixedFunctionOpData::xyY_TO_XYZ:
         {
-            return std::make_shared<Renderer_xyY_TO_XYZ>(func);
+            return GetColorModelRenderer<Renderer_xyY_TO_XYZ>(func);
         }
 
         case FixedFunctionOpData::XYZ_TO_uvY:
         {
-            return std::make_shared<Renderer_XYZ_TO_uvY>(func);
+            return GetColorModelRenderer<Renderer_XYZ_TO_uvY>(func);
         }
         case FixedFunctionOpData::uvY_TO_XYZ:
         {
-            return std::make_shared<Renderer_uvY_TO_XYZ>(func);
+            return GetColorModelRenderer<Renderer_uvY_TO_XYZ>(func);
         }
 
         case FixedFunctionOpData::XYZ_TO_LUV:
         {
+            // The SIMD version uses the fast pow approximation for the cube root.
+            if (fastLogExpPow)
+            {
+                return GetColorModelRenderer<Renderer_XYZ_TO_LUV>(func);
+            }
             return std::make_shared<Renderer_XYZ_TO_LUV>(func);
         }
         case FixedFunctionOpData::LUV_TO_XYZ:
         {
-            return std::make_shared<Renderer_LUV_TO_XYZ>(func);
+            return GetColorModelRenderer<Renderer_LUV_TO_XYZ>(func);
         }
         
         case FixedFunctionOpData::LIN_TO_PQ:
@@ -2613,29 +2778,29 @@ ConstOpCPURcPtr GetFixedFunctionCPURenderer(ConstFixedFunctionOpDataRcPtr & func
 
         case FixedFunctionOpData::RGB_TO_HSY_LOG:
         {
-            return std::make_shared<Renderer_RGB_TO_HSY_LOG>(func);
+            return GetColorModelRenderer<Renderer_RGB_TO_HSY_LOG>(func);
         }
         case FixedFunctionOpData::HSY_LOG_TO_RGB:
         {
-            return std::make_shared<Renderer_HSY_LOG_TO_RGB>(func);
+            return GetColorModelRenderer<Renderer_HSY_LOG_TO_RGB>(func);
         }
 
         case FixedFunctionOpData::RGB_TO_HSY_LIN:
         {
-            return std::make_shared<Renderer_RGB_TO_HSY_LIN>(func);
+            return GetColorModelRenderer<Renderer_RGB_TO_HSY_LIN>(func);
         }
         case FixedFunctionOpData::HSY_LIN_TO_RGB:
         {
-            return std::make_shared<Renderer_HSY_LIN_TO_RGB>(func);
+            return GetColorModelRenderer<Renderer_HSY_LIN_TO_RGB>(func);
         }
 
         case FixedFunctionOpData::RGB_TO_HSY_VID:
         {
-            return std::make_shared<Renderer_RGB_TO_HSY_VID>(func);
+            return GetColorModelRenderer<Renderer_RGB_TO_HSY_VID>(func);
         }
         case FixedFunctionOpData::HSY_VID_TO_RGB:
         {
-            return std::make_shared<Renderer_HSY_VID_TO_RGB>(func);
+            return GetColorModelRenderer<Renderer_HSY_VID_TO_RGB>(func);
         }
     }
 
@@ -0,0 +1,92 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include "FixedFunctionOpCPU_AVX2.h"
+#if OCIO_USE_AVX2
+
+#include <immintrin.h>
+
+#include "ACES2/TransformSIMD.h"
+#include "AVX2.h"
+
+namespace OCIO_NAMESPACE
+{
+namespace {
+
+// Refer to ACES2/TransformSIMD.h for the description of the structure.
+struct VecAVX2
+{
+    using F = __m256;
+    using I = __m256i;
+    using M = __m256;
+
+    static constexpr int width = 8;
+
+    static inline F set1(float v) { return _mm256_set1_ps(v); }
+    static inline I iset1(int v) { return _mm256_set1_epi32(v); }
+
+    static inline F add(F a, F b) { return _mm256_add_ps(a, b); }
+    static inline F sub(F a, F b) { return _mm256_sub_ps(a, b); }
+    static inline F mul(F a, F b) { return _mm256_mul_ps(a, b); }
+    static inline F div(F a, F b) { return _mm256_div_ps(a, b); }
+    static inline F fmadd(F a, F b, F c) { return _mm256_fmadd_ps(a, b, c); }
+    static inline F min(F a, F b) { return _mm256_min_ps(a, b); }
+    static inline F max(F a, F b) { return _mm256_max_ps(a, b); }
+    static inline F sqrt(F a) { return _mm256_sqrt_ps(a); }
+
+    static inline M lt(F a, F b) { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+    static inline M le(F a, F b) { return _mm256_cmp_ps(a, b, _CMP_LE_OQ); }
+    static inline M gt(F a, F b) { return _mm256_cmp_ps(a, b, _CMP_GT_OQ); }
+    static inline M mand(M a, M b) { return _mm256_and_ps(a, b); }
+    static inline M mor(M a, M b) { return _mm256_or_ps(a, b); }
+    static inline M mandnot(M a, M b) { return _mm256_andnot_ps(a, b); }
+    static inline F select(M m, F a, F b) { return _mm256_blendv_ps(b, a, m); }
+    static inline bool any(M m) { return _mm256_movemask_ps(m) != 0; }
+
+    static inline I cvtt(F a) { return _mm256_cvttps_epi32(a); }
+    static inline I cvtr(F a) { return _mm256_cvtps_epi32(a); }
+    static inline F cvtf(I a) { return _mm256_cvtepi32_ps(a); }
+    static inline I asInt(F a) { return _mm256_castps_si256(a); }
+    static inline F asFloat(I a) { return _mm256_castsi256_ps(a); }
+
+    static inline I iadd(I a, I b) { return _mm256_add_epi32(a, b); }
+    static inline I isub(I a, I b) { return _mm256_sub_epi32(a, b); }
+    static inline I iand(I a, I b) { return _mm256_and_si256(a, b); }
+    static inline I ior(I a, I b) { return _mm256_or_si256(a, b); }
+    static inline I sll23(I a) { return _mm256_slli_epi32(a, 23); }
+    static inline I srl23(I a) { return _mm256_srli_epi32(a, 23); }
+
+    static inline F gather(const float * base, I idx) { return _mm256_i32gather_ps(base, idx, 4); }
+
+    static inline void load(const float * in, F & r, F & g, F & b, F & a)
+    {
+        AVX2RGBAPack<BIT_DEPTH_F32>::Load(in, r, g, b, a);
+    }
+
+    static inline void store(float * out, F r, F g, F b, F a)
+    {
+        AVX2RGBAPack<BIT_DEPTH_F32>::Store(out, r, g, b, a);
+    }
+};
+
+} // anonymous namespace
+
+void applyACESOutputTransform20FwdAVX2(const ACES2::JMhParams & pIn,
+                                       const ACES2::JMhParams & pOut,
+                                       const ACES2::ToneScaleParams & t,
+                                       const ACES2::SharedCompressionParameters & s,
+                                       const ACES2::ChromaCompressParams & c,
+                                       const ACES2::GamutCompressParams & g,
+                                       const float * in, float * out, long numPixels)
+{
+    ACES2::SIMD::OutputTransformFwd<VecAVX2>(pIn, pOut, t, s, c, g, in, out, numPixels);
+}
+
+ColorModelSIMDApplyFunc * getColorModelFuncAVX2(FixedFunctionOpData::Style style)
+{
+    return GetColorModelSIMDFunc<AVX2FloatOps>(style);
+}
+
+} // namespace OCIO_NAMESPACE
+
+#endif // OCIO_USE_AVX2
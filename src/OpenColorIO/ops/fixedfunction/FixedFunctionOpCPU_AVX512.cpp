@@ -0,0 +1,93 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include "FixedFunctionOpCPU_AVX512.h"
+#if OCIO_USE_AVX512
+
+#include <immintrin.h>
+
+#include "ACES2/TransformSIMD.h"
+#include "AVX512.h"
+
+namespace OCIO_NAMESPACE
+{
+namespace {
+
+// Refer to ACES2/TransformSIMD.h for the description of the structure.
+// Note: Only AVX-512F instructions are used (e.g. no _mm512_and_ps which is AVX-512DQ).
+struct VecAVX512
+{
+    using F = __m512;
+    using I = __m512i;
+    using M = __mmask16;
+
+    static constexpr int width = 16;
+
+    static inline F set1(float v) { return _mm512_set1_ps(v); }
+    static inline I iset1(int v) { return _mm512_set1_epi32(v); }
+
+    static inline F add(F a, F b) { return _mm512_add_ps(a, b); }
+    static inline F sub(F a, F b) { return _mm512_sub_ps(a, b); }
+    static inline F mul(F a, F b) { return _mm512_mul_ps(a, b); }
+    static inline F div(F a, F b) { return _mm512_div_ps(a, b); }
+    static inline F fmadd(F a, F b, F c) { return _mm512_fmadd_ps(a, b, c); }
+    static inline F min(F a, F b) { return _mm512_min_ps(a, b); }
+    static inline F max(F a, F b) { return _mm512_max_ps(a, b); }
+    static inline F sqrt(F a) { return _mm512_sqrt_ps(a); }
+
+    static inline M lt(F a, F b) { return _mm512_cmp_ps_mask(a, b, _CMP_LT_OQ); }
+    static inline M le(F a, F b) { return _mm512_cmp_ps_mask(a, b, _CMP_LE_OQ); }
+    static inline M gt(F a, F b) { return _mm512_cmp_ps_mask(a, b, _CMP_GT_OQ); }
+    static inline M mand(M a, M b) { return static_cast<M>(a & b); }
+    static inline M mor(M a, M b) { return static_cast<M>(a | b); }
+    static inline M mandnot(M a, M b) { return static_cast<M>(~a & b); }
+    static inline F select(M m, F a, F b) { return _mm512_mask_blend_ps(m, b, a); }
+    static inline bool any(M m) { return m != 0; }
+
+    static inline I cvtt(F a) { return _mm512_cvttps_epi32(a); }
+    static inline I cvtr(F a) { return _mm512_cvtps_epi32(a); }
+    static inline F cvtf(I a) { return _mm512_cvtepi32_ps(a); }
+    static inline I asInt(F a) { return _mm512_castps_si512(a); }
+    static inline F asFloat(I a) { return _mm512_castsi512_ps(a); }
+
+    static inline I iadd(I a, I b) { return _mm512_add_epi32(a, b); }
+    static inline I isub(I a, I b) { return _mm512_sub_epi32(a, b); }
+    static inline I iand(I a, I b) { return _mm512_and_si512(a, b); }
+    static inline I ior(I a, I b) { return _mm512_or_si512(a, b); }
+    static inline I sll23(I a) { return _mm512_slli_epi32(a, 23); }
+    static inline I srl23(I a) { return _mm512_srli_epi32(a, 23); }
+
+    static inline F gather(const float * base, I idx) { return _mm512_i32gather_ps(idx, base, 4); }
+
+    static inline void load(const float * in, F & r, F & g, F & b, F & a)
+    {
+        AVX512RGBAPack<BIT_DEPTH_F32>::Load(in, r, g, b, a);
+    }
+
+    static inline void store(float * out, F r, F g, F b, F a)
+    {
+        AVX512RGBAPack<BIT_DEPTH_F32>::Store(out, r, g, b, a);
+    }
+};
+
+} // anonymous namespace
+
+void applyACESOutputTransform20FwdAVX512(const ACES2::JMhParams & pIn,
+                                         const ACES2::JMhParams & pOut,
+                                         const ACES2::ToneScaleParams & t,
+                                         const ACES2::SharedCompressionParameters & s,
+                                         const ACES2::ChromaCompressParams & c,
+                                         const ACES2::GamutCompressParams & g,
+                                         const float * in, float * out, long numPixels)
+{
+    ACES2::SIMD::OutputTransformFwd<VecAVX512>(pIn, pOut, t, s, c, g, in, out, numPixels);
+}
+
+ColorModelSIMDApplyFunc * getColorModelFuncAVX512(FixedFunctionOpData::Style style)
+{
+    return GetColorModelSIMDFunc<AVX512FloatOps>(style);
+}
+
+} // namespace OCIO_NAMESPACE
+
+#endif // OCIO_USE_AVX512
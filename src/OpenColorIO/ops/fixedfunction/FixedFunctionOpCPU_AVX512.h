@@ -0,0 +1,33 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#ifndef INCLUDED_OCIO_FIXEDFUNCTIONOP_CPU_AVX512_H
+#define INCLUDED_OCIO_FIXEDFUNCTIONOP_CPU_AVX512_H
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "ACES2/Common.h"
+#include "CPUInfo.h"
+#include "FixedFunctionOpCPU_SIMD.h"
+
+#if OCIO_USE_AVX512
+namespace OCIO_NAMESPACE
+{
+
+// Apply the forward ACES 2.0 output transform to RGBA F32 pixels.
+void applyACESOutputTransform20FwdAVX512(const ACES2::JMhParams & pIn,
+                                         const ACES2::JMhParams & pOut,
+                                         const ACES2::ToneScaleParams & t,
+                                         const ACES2::SharedCompressionParameters & s,
+                                         const ACES2::ChromaCompressParams & c,
+                                         const ACES2::GamutCompressParams & g,
+                                         const float * in, float * out, long numPixels);
+
+// Return the AVX512 version of the color model conversion (refer to GetColorModelSIMDFunc).
+ColorModelSIMDApplyFunc * getColorModelFuncAVX512(FixedFunctionOpData::Style style);
+
+} // namespace OCIO_NAMESPACE
+
+#endif // OCIO_USE_AVX512
+
+#endif /* INCLUDED_OCIO_FIXEDFUNCTIONOP_CPU_AVX512_H */
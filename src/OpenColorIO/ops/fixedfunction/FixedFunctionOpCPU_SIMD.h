@@ -0,0 +1,407 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#ifndef INCLUDED_OCIO_FIXEDFUNCTIONOP_CPU_SIMD_H
+#define INCLUDED_OCIO_FIXEDFUNCTIONOP_CPU_SIMD_H
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "ops/fixedfunction/FixedFunctionOpData.h"
+#include "SIMDMath.h"
+
+namespace OCIO_NAMESPACE
+{
+
+// Apply a color model conversion to RGBA F32 pixels.
+typedef void (ColorModelSIMDApplyFunc)(const float * in, float * out, long numPixels);
+
+// SoA versions of the color model conversions of FixedFunctionOpCPU.cpp. The branches of the
+// scalar versions (e.g. the hue sextant) are replaced by selects so all the lanes compute all
+// the cases, and the operations are kept in the same order to produce the same results.
+
+// Same as Clamp() (refer to MathUtils.h) i.e. NaN values become the min value.
+template<typename V>
+inline V ClampSoA(const V & a, float minValue, float maxValue)
+{
+    return Min(Max(V(minValue), a), maxValue);
+}
+
+// Same as the CLAMP macro (refer to BitDepthUtils.h) i.e. NaN values are preserved.
+template<typename V>
+inline V ClampMacroSoA(const V & a, float minValue, float maxValue)
+{
+    return Select(a > maxValue, V(maxValue), Select(a < minValue, V(minValue), a));
+}
+
+template<typename Ops>
+void ApplyRGBToHSV(const float * in, float * out, long numPixels)
+{
+    typedef SIMDFloat<Ops> V;
+
+    ApplyRGBASoA<Ops>(in, out, numPixels, [](V & red, V & grn, V & blu)
+    {
+        const V rgbMin = Min(Min(red, grn), blu);
+        const V rgbMax = Max(Max(red, grn), blu);
+
+        const typename V::Mask hasHue = rgbMin != rgbMax;
+        const V delta = rgbMax - rgbMin;
+
+        V sat = Select(hasHue & (rgbMax != 0.f), delta / rgbMax, 0.f);
+
+        V hue = Select(red == rgbMax, (grn - blu) / delta,
+                       Select(grn == rgbMax, 2.0f + (blu - red) / delta,
+                                             4.0f + (red - grn) / delta));
+        hue = Select(hue < 0.f, hue + 6.f, hue);
+        hue = Select(hasHue, hue * 0.16666666666666666f, 0.f);
+
+        // Handle extended range inputs.
+        const V val = Select(rgbMin < 0.f, rgbMax + rgbMin, rgbMax);
+        sat = Select(-rgbMin > rgbMax, (rgbMax - rgbMin) / -rgbMin, sat);
+
+        red = hue;
+        grn = sat;
+        blu = val;
+    });
+}
+
+template<typename Ops>
+void ApplyHSVToRGB(const float * in, float * out, long numPixels)
+{
+    typedef SIMDFloat<Ops> V;
+
+    ApplyRGBASoA<Ops>(in, out, numPixels, [](V & red, V & grn, V & blu)
+    {
+        constexpr float MAX_SAT = 1.999f;
+
+        const V hue = (red - Floor(red)) * 6.f;
+        const V sat = ClampSoA(grn, 0.f, MAX_SAT);
+        const V val = blu;
+
+        const V r = ClampSoA(Abs(hue - 3.f) - 1.f, 0.f, 1.f);
+        const V g = ClampSoA(2.f - Abs(hue - 2.f), 0.f, 1.f);
+        const V b = ClampSoA(2.f - Abs(hue - 4.f), 0.f, 1.f);
+
+        // Handle extended range inputs.
+        const typename V::Mask isHighSat = sat > 1.f;
+        const typename V::Mask isNegVal = val < 0.f;
+
+        V rgbMin = Select(isHighSat, val * (1.f - sat) / (2.f - sat), val * (1.f - sat));
+        rgbMin = Select(isNegVal, val / (2.f - sat), rgbMin);
+        const V rgbMax = Select(isHighSat | isNegVal, val - rgbMin, val);
+
+        const V delta = rgbMax - rgbMin;
+        red = r * delta + rgbMin;
+        grn = g * delta + rgbMin;
+        blu = b * delta + rgbMin;
+    });
+}
+
+template<typename Ops, FixedFunctionOpData::Style style>
+void ApplyRGBToHSY(const float * in, float * out, long numPixels)
+{
+    typedef SIMDFloat<Ops> V;
+
+    ApplyRGBASoA<Ops>(in, out, numPixels, [](V & red, V & grn, V & blu)
+    {
+        const V rgbMin = Min(Min(red, grn), blu);
+        const V rgbMax = Max(Max(red, grn), blu);
+
+        const V luma = 0.2126f * red + 0.7152f * grn + 0.0722f * blu;
+
+        const V distRgb = Abs(red - luma) + Abs(grn - luma) + Abs(blu - luma);
+
+        V sat;
+        if (style == FixedFunctionOpData::RGB_TO_HSY_LIN)
+        {
+            const V sumRgb = red + grn + blu;
+            const float k = 0.15f;
+            const V satHi = distRgb / Max(0.07f * distRgb + 1e-6f, k + sumRgb);
+            const float loGain = 5.f;
+            const V satLo = distRgb * loGain;
+            const float maxLum = 0.01f;
+            const float minLum = maxLum * 0.1f;
+            const V alpha = ClampMacroSoA((luma - minLum) / (maxLum - minLum), 0.f, 1.f);
+            sat = satLo + alpha * (satHi - satLo);
+            sat *= 1.4f;
+        }
+        else if (style == FixedFunctionOpData::RGB_TO_HSY_LOG)
+        {
+            sat = distRgb * 4.f;
+        }
+        else  // FixedFunctionOpData::RGB_TO_HSY_VID
+        {
+            sat = distRgb * 1.25f;
+        }
+
+        // NB: HSY maps magenta rather than red to a hue of zero.
+        const V delta = rgbMax - rgbMin;
+        V hue = Select(red == rgbMax, 1.0f + (grn - blu) / delta,
+                       Select(grn == rgbMax, 3.0f + (blu - red) / delta,
+                                             5.0f + (red - grn) / delta));
+        hue = Select(rgbMin != rgbMax, hue * 0.16666666666666666f, 0.f);
+
+        red = hue;
+        grn = sat;
+        blu = luma;
+    });
+}
+
+template<typename Ops, FixedFunctionOpData::Style style>
+void ApplyHSYToRGB(const float * in, float * out, long numPixels)
+{
+    typedef SIMDFloat<Ops> V;
+
+    ApplyRGBASoA<Ops>(in, out, numPixels, [](V & red, V & grn, V & blu)
+    {
+        // Make magenta 0 hue, rather than red.
+        V hue = red - 1.f/6.f;
+        V sat = grn;
+        const V luma = blu;
+
+        // Rotate hue 180 deg. for negative luma values.
+        hue = Select(luma < 0.f, hue + 0.5f, hue);
+        hue = (hue - Floor(hue)) * 6.f;
+
+        V r = ClampMacroSoA(Abs(hue - 3.f) - 1.f, 0.f, 1.f);
+        V g = ClampMacroSoA(2.f - Abs(hue - 2.f), 0.f, 1.f);
+        V b = ClampMacroSoA(2.f - Abs(hue - 4.f), 0.f, 1.f);
+
+        const V currY = 0.2126f * r + 0.7152f * g + 0.0722f * b;
+        r *= luma / currY;
+        g *= luma / currY;
+        b *= luma / currY;
+
+        const V distRgb = Abs(r - luma) + Abs(g - luma) + Abs(b - luma);
+
+        V gainS;
+        if (style == FixedFunctionOpData::HSY_LIN_TO_RGB)
+        {
+            const V sumRgb = r + g + b;
+
+            const float k = 0.15f;
+            const float loGain = 5.f;
+
+            sat /= 1.4f;
+            V tmp = -sat * sumRgb + sat * 3.f * luma + distRgb;
+            // Don't allow tmp to go negative, which would cause a negative gainS.
+            tmp = Max(V(1e-6f), tmp);
+
+            // Prevent gainS from becoming too extreme.
+            const V s1 = Min(sat * (k + 3.f * luma) / tmp, 50.f);
+            const V s0 = sat / Max(V(1e-10f), distRgb * loGain);
+
+            const float maxLum = 0.01f;
+            const float minLum = maxLum * 0.1f;
+            const V alpha = ClampMacroSoA((luma - minLum) / (maxLum - minLum), 0.f, 1.f);
+
+            // Blend between the low & high gains (the unused lanes may hold NaN values).
+            const V a = distRgb * loGain * (1.f - alpha) * (sumRgb - 3.f * luma);
+            const V bb = distRgb * loGain * (1.f - alpha) * (k + 3.f * luma) + distRgb * alpha -
+                         sat * (sumRgb - 3.f * luma);
+            const V c = -sat * (k + 3.f * luma);
+            const V discrim = Sqrt(bb * bb - 4.f * a * c);
+            const V denom = -discrim - bb;
+            V gainMid = (2.f * c) / denom;
+            gainMid = Select(gainMid >= 0.f, gainMid, (2.f * c) / (denom + discrim * 2.f));
+
+            gainS = Select(alpha == 1.f, s1, Select(alpha == 0.f, s0, gainMid));
+        }
+        else if (style == FixedFunctionOpData::HSY_LOG_TO_RGB)
+        {
+            gainS = sat / Max(V(1e-10f), distRgb * 4.f);
+        }
+        else  // FixedFunctionOpData::HSY_VID_TO_RGB
+        {
+            gainS = sat / Max(V(1e-10f), distRgb * 1.25f);
+        }
+
+        red = luma + gainS * (r - luma);
+        grn = luma + gainS * (g - luma);
+        blu = luma + gainS * (b - luma);
+    });
+}
+
+template<typename Ops>
+void ApplyXYZToxyY(const float * in, float * out, long numPixels)
+{
+    typedef SIMDFloat<Ops> V;
+
+    ApplyRGBASoA<Ops>(in, out, numPixels, [](V & X, V & Y, V & Z)
+    {
+        V d = X + Y + Z;
+        d = Select(d == 0.f, 0.f, 1.f / d);
+
+        X = X * d;
+        Z = Y;
+        Y = Y * d;
+    });
+}
+
+template<typename Ops>
+void ApplyxyYToXYZ(const float * in, float * out, long numPixels)
+{
+    typedef SIMDFloat<Ops> V;
+
+    ApplyRGBASoA<Ops>(in, out, numPixels, [](V & x, V & y, V & Y)
+    {
+        const V d = Select(y == 0.f, 0.f, 1.f / y);
+        const V X = Y * x * d;
+        const V Z = Y * (1.f - x - y) * d;
+
+        x = X;
+        y = Y;
+        Y = Z;
+    });
+}
+
+template<typename Ops>
+void ApplyXYZTouvY(const float * in, float * out, long numPixels)
+{
+    typedef SIMDFloat<Ops> V;
+
+    ApplyRGBASoA<Ops>(in, out, numPixels, [](V & X, V & Y, V & Z)
+    {
+        V d = X + 15.f * Y + 3.f * Z;
+        d = Select(d == 0.f, 0.f, 1.f / d);
+
+        X = 4.f * X * d;
+        Z = Y;
+        Y = 9.f * Y * d;
+    });
+}
+
+template<typename Ops>
+void ApplyuvYToXYZ(const float * in, float * out, long numPixels)
+{
+    typedef SIMDFloat<Ops> V;
+
+    ApplyRGBASoA<Ops>(in, out, numPixels, [](V & u, V & v, V & Y)
+    {
+        const V d = Select(v == 0.f, 0.f, 1.f / v);
+        const V X = (9.f / 4.f) * Y * u * d;
+        const V Z = (3.f / 4.f) * Y * (4.f - u - 6.666666666666667f * v) * d;
+
+        u = X;
+        v = Y;
+        Y = Z;
+    });
+}
+
+// Note: The cube root uses the Power() approximation.
+template<typename Ops>
+void ApplyXYZToLUV(const float * in, float * out, long numPixels)
+{
+    typedef SIMDFloat<Ops> V;
+
+    ApplyRGBASoA<Ops>(in, out, numPixels, [](V & X, V & Y, V & Z)
+    {
+        V d = X + 15.f * Y + 3.f * Z;
+        d = Select(d == 0.f, 0.f, 1.f / d);
+        const V u = 4.f * X * d;
+        const V v = 9.f * Y * d;
+
+        const V Lstar = Select(Y <= 0.008856451679f, 9.0329629629629608f * Y,
+                                                     1.16f * Power(Y, 0.333333333f) - 0.16f);
+
+        X = Lstar;
+        Y = 13.f * Lstar * (u - 0.19783001f);   // D65 white
+        Z = 13.f * Lstar * (v - 0.46831999f);   // D65 white
+    });
+}
+
+template<typename Ops>
+void ApplyLUVToXYZ(const float * in, float * out, long numPixels)
+{
+    typedef SIMDFloat<Ops> V;
+
+    ApplyRGBASoA<Ops>(in, out, numPixels, [](V & Lstar, V & ustar, V & vstar)
+    {
+        const V d = Select(Lstar == 0.f, 0.f, 0.076923076923076927f / Lstar);
+        const V u = ustar * d + 0.19783001f;    // D65 white
+        const V v = vstar * d + 0.46831999f;    // D65 white
+
+        const V tmp = (Lstar + 0.16f) * 0.86206896551724144f;
+        const V Y = Select(Lstar <= 0.08f, 0.11070564598794539f * Lstar, tmp * tmp * tmp);
+
+        const V dd = Select(v == 0.f, 0.f, 0.25f / v);
+        Lstar = 9.f * Y * u * dd;
+        ustar = Y;
+        vstar = Y * (12.f - 3.f * u - 20.f * v) * dd;
+    });
+}
+
+// Return the vectorized version of the color model conversion, or null if the style is not a
+// color model conversion.
+template<typename Ops>
+ColorModelSIMDApplyFunc * GetColorModelSIMDFunc(FixedFunctionOpData::Style style)
+{
+    switch (style)
+    {
+        case FixedFunctionOpData::RGB_TO_HSV:
+            return ApplyRGBToHSV<Ops>;
+        case FixedFunctionOpData::HSV_TO_RGB:
+            return ApplyHSVToRGB<Ops>;
+
+        case FixedFunctionOpData::RGB_TO_HSY_LOG:
+            return ApplyRGBToHSY<Ops, FixedFunctionOpData::RGB_TO_HSY_LOG>;
+        case FixedFunctionOpData::HSY_LOG_TO_RGB:
+            return ApplyHSYToRGB<Ops, FixedFunctionOpData::HSY_LOG_TO_RGB>;
+        case FixedFunctionOpData::RGB_TO_HSY_LIN:
+            return ApplyRGBToHSY<Ops, FixedFunctionOpData::RGB_TO_HSY_LIN>;
+        case FixedFunctionOpData::HSY_LIN_TO_RGB:
+            return ApplyHSYToRGB<Ops, FixedFunctionOpData::HSY_LIN_TO_RGB>;
+        case FixedFunctionOpData::RGB_TO_HSY_VID:
+            return ApplyRGBToHSY<Ops, FixedFunctionOpData::RGB_TO_HSY_VID>;
+        case FixedFunctionOpData::HSY_VID_TO_RGB:
+            return ApplyHSYToRGB<Ops, FixedFunctionOpData::HSY_VID_TO_RGB>;
+
+        case FixedFunctionOpData::XYZ_TO_xyY:
+            return ApplyXYZToxyY<Ops>;
+        case FixedFunctionOpData::xyY_TO_XYZ:
+            return ApplyxyYToXYZ<Ops>;
+        case FixedFunctionOpData::XYZ_TO_uvY:
+            return ApplyXYZTouvY<Ops>;
+        case FixedFunctionOpData::uvY_TO_XYZ:
+            return ApplyuvYToXYZ<Ops>;
+        case FixedFunctionOpData::XYZ_TO_LUV:
+            return ApplyXYZToLUV<Ops>;
+        case FixedFunctionOpData::LUV_TO_XYZ:
+            return ApplyLUVToXYZ<Ops>;
+
+        case FixedFunctionOpData::ACES_RED_MOD_03_FWD:
+        case FixedFunctionOpData::ACES_RED_MOD_03_INV:
+        case FixedFunctionOpData::ACES_RED_MOD_10_FWD:
+        case FixedFunctionOpData::ACES_RED_MOD_10_INV:
+        case FixedFunctionOpData::ACES_GLOW_03_FWD:
+        case FixedFunctionOpData::ACES_GLOW_03_INV:
+        case FixedFunctionOpData::ACES_GLOW_10_FWD:
+        case FixedFunctionOpData::ACES_GLOW_10_INV:
+        case FixedFunctionOpData::ACES_DARK_TO_DIM_10_FWD:
+        case FixedFunctionOpData::ACES_DARK_TO_DIM_10_INV:
+        case FixedFunctionOpData::ACES_GAMUT_COMP_13_FWD:
+        case FixedFunctionOpData::ACES_GAMUT_COMP_13_INV:
+        case FixedFunctionOpData::REC2100_SURROUND_FWD:
+        case FixedFunctionOpData::REC2100_SURROUND_INV:
+        case FixedFunctionOpData::LIN_TO_PQ:
+        case FixedFunctionOpData::PQ_TO_LIN:
+        case FixedFunctionOpData::LIN_TO_GAMMA_LOG:
+        case FixedFunctionOpData::GAMMA_LOG_TO_LIN:
+        case FixedFunctionOpData::LIN_TO_DOUBLE_LOG:
+        case FixedFunctionOpData::DOUBLE_LOG_TO_LIN:
+        case FixedFunctionOpData::ACES_OUTPUT_TRANSFORM_20_FWD:
+        case FixedFunctionOpData::ACES_OUTPUT_TRANSFORM_20_INV:
+        case FixedFunctionOpData::ACES_RGB_TO_JMh_20:
+        case FixedFunctionOpData::ACES_JMh_TO_RGB_20:
+        case FixedFunctionOpData::ACES_TONESCALE_COMPRESS_20_FWD:
+        case FixedFunctionOpData::ACES_TONESCALE_COMPRESS_20_INV:
+        case FixedFunctionOpData::ACES_GAMUT_COMPRESS_20_FWD:
+        case FixedFunctionOpData::ACES_GAMUT_COMPRESS_20_INV:
+            break;
+    }
+
+    return nullptr;
+}
+
+} // namespace OCIO_NAMESPACE
+
+#endif /* INCLUDED_OCIO_FIXEDFUNCTIONOP_CPU_SIMD_H */
@@ -0,0 +1,98 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include "FixedFunctionOpCPU_SSE2.h"
+#if OCIO_USE_SSE2
+
+#include <cstdint>
+
+#include "ACES2/TransformSIMD.h"
+#include "SSE2.h"
+
+namespace OCIO_NAMESPACE
+{
+namespace {
+
+// Refer to ACES2/TransformSIMD.h for the description of the structure.
+struct VecSSE2
+{
+    using F = __m128;
+    using I = __m128i;
+    using M = __m128;
+
+    static constexpr int width = 4;
+
+    static inline F set1(float v) { return _mm_set1_ps(v); }
+    static inline I iset1(int v) { return _mm_set1_epi32(v); }
+
+    static inline F add(F a, F b) { return _mm_add_ps(a, b); }
+    static inline F sub(F a, F b) { return _mm_sub_ps(a, b); }
+    static inline F mul(F a, F b) { return _mm_mul_ps(a, b); }
+    static inline F div(F a, F b) { return _mm_div_ps(a, b); }
+    static inline F fmadd(F a, F b, F c) { return _mm_add_ps(_mm_mul_ps(a, b), c); }
+    static inline F min(F a, F b) { return _mm_min_ps(a, b); }
+    static inline F max(F a, F b) { return _mm_max_ps(a, b); }
+    static inline F sqrt(F a) { return _mm_sqrt_ps(a); }
+
+    static inline M lt(F a, F b) { return _mm_cmplt_ps(a, b); }
+    static inline M le(F a, F b) { return _mm_cmple_ps(a, b); }
+    static inline M gt(F a, F b) { return _mm_cmpgt_ps(a, b); }
+    static inline M mand(M a, M b) { return _mm_and_ps(a, b); }
+    static inline M mor(M a, M b) { return _mm_or_ps(a, b); }
+    static inline M mandnot(M a, M b) { return _mm_andnot_ps(a, b); }
+    static inline F select(M m, F a, F b) { return _mm_or_ps(_mm_and_ps(m, a), _mm_andnot_ps(m, b)); }
+    static inline bool any(M m) { return _mm_movemask_ps(m) != 0; }
+
+    static inline I cvtt(F a) { return _mm_cvttps_epi32(a); }
+    static inline I cvtr(F a) { return _mm_cvtps_epi32(a); }
+    static inline F cvtf(I a) { return _mm_cvtepi32_ps(a); }
+    static inline I asInt(F a) { return _mm_castps_si128(a); }
+    static inline F asFloat(I a) { return _mm_castsi128_ps(a); }
+
+    static inline I iadd(I a, I b) { return _mm_add_epi32(a, b); }
+    static inline I isub(I a, I b) { return _mm_sub_epi32(a, b); }
+    static inline I iand(I a, I b) { return _mm_and_si128(a, b); }
+    static inline I ior(I a, I b) { return _mm_or_si128(a, b); }
+    static inline I sll23(I a) { return _mm_slli_epi32(a, 23); }
+    static inline I srl23(I a) { return _mm_srli_epi32(a, 23); }
+
+    // There is no gather instruction before AVX2.
+    static inline F gather(const float * base, I idx)
+    {
+        alignas(16) int32_t i[4];
+        _mm_store_si128(reinterpret_cast<__m128i *>(i), idx);
+        return _mm_setr_ps(base[i[0]], base[i[1]], base[i[2]], base[i[3]]);
+    }
+
+    static inline void load(const float * in, F & r, F & g, F & b, F & a)
+    {
+        SSE2RGBAPack<BIT_DEPTH_F32>::Load(in, r, g, b, a);
+    }
+
+    static inline void store(float * out, F r, F g, F b, F a)
+    {
+        SSE2RGBAPack<BIT_DEPTH_F32>::Store(out, r, g, b, a);
+    }
+};
+
+} // anonymous namespace
+
+void applyACESOutputTransform20FwdSSE2(const ACES2::JMhParams & pIn,
+                                       const ACES2::JMhParams & pOut,
+                                       const ACES2::ToneScaleParams & t,
+                                       const ACES2::SharedCompressionParameters & s,
+                                       const ACES2::ChromaCompressParams & c,
+                                       const ACES2::GamutCompressParams & g,
+                                       const float * in, float * out, long numPixels)
+{
+    ACES2::SIMD::OutputTransformFwd<VecSSE2>(pIn, pOut, t, s, c, g, in, out, numPixels);
+}
+
+ColorModelSIMDApplyFunc * getColorModelFuncSSE2(FixedFunctionOpData::Style style)
+{
+    return GetColorModelSIMDFunc<SSE2FloatOps>(style);
+}
+
+} // namespace OCIO_NAMESPACE
+
+#endif // OCIO_USE_SSE2
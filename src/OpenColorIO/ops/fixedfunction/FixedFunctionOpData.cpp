@@ -1165,26 +1165,23 @@ bool FixedFunctionOpData::equals(const OpData & other) const
     return getStyle() == fop->getStyle() && getParams() == fop->getParams();
 }
 
-std::string FixedFunctionOpData::getCacheID() const
+void FixedFunctionOpData::writeCacheID(std::ostream & os) const
 {
     AutoMutex lock(m_mutex);
 
-    std::ostringstream cacheIDStream;
     if (!getID().empty())
     {
-        cacheIDStream << getID() << " ";
+        os << getID() << " ";
     }
 
-    cacheIDStream.precision(DefaultValues::FLOAT_DECIMALS);
+    os.precision(DefaultValues::FLOAT_DECIMALS);
 
-    cacheIDStream << ConvertStyleToString(m_style, true);
+    os << ConvertStyleToString(m_style, true);
 
     for (const auto & param : m_params)
     {
-        cacheIDStream << " " << param;
+        os << " " << param;
     }
-
-    return cacheIDStream.str();
 }
 
 bool operator==(const FixedFunctionOpData & lhs, const FixedFunctionOpData & rhs)
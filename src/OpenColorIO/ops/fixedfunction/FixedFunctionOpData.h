@@ -97,7 +97,7 @@ public:
     bool isInverse(ConstFixedFunctionOpDataRcPtr & r) const;
     FixedFunctionOpDataRcPtr inverse() const;
 
-    std::string getCacheID() const override;
+    void writeCacheID(std::ostream & os) const override;
 
     Style getStyle() const  noexcept { return m_style; }
     void setStyle(Style style)  noexcept { m_style = style; }
@@ -40,7 +40,7 @@ public:
     bool canCombineWith(ConstOpRcPtr & op) const override;
     void combineWith(OpRcPtrVec & ops, ConstOpRcPtr & secondOp) const override;
 
-    std::string getCacheID() const override;
+    void writeCacheID(std::ostream & os) const override;
 
     ConstOpCPURcPtr getCPUOp(bool fastLogExpPow) const override;
 
@@ -106,15 +106,12 @@ void GammaOp::combineWith(OpRcPtrVec & ops, ConstOpRcPtr & secondOp) const
     CreateGammaOp(ops, res, TRANSFORM_DIR_FORWARD);
 }
 
-std::string GammaOp::getCacheID() const
+void GammaOp::writeCacheID(std::ostream & os) const
 {
     // Create the cacheID
-    std::ostringstream cacheIDStream;
-    cacheIDStream << "<GammaOp ";
-    cacheIDStream << gammaData()->getCacheID() << " ";
-    cacheIDStream << ">";
-
-    return cacheIDStream.str();
+    os << "<GammaOp ";
+    gammaData()->writeCacheID(os);
+    os << " >";
 }
 
 ConstOpCPURcPtr GammaOp::getCPUOp(bool fastLogExpPow) const
@@ -37,16 +37,13 @@ inline bool IsMonCurveIdentity(const GammaOpData::Params & p)
     return (p[0] == IdentityScale && p[1] == IdentityOffset);
 }
 
-std::string GetParametersString(const GammaOpData::Params & params)
+void WriteParameters(std::ostream & os, const GammaOpData::Params & params)
 {
-    std::ostringstream oss;
-    oss.precision(FLOAT_DECIMALS);
-    oss << params[0];
+    os << params[0];
     for(size_t idx=1; idx<params.size(); ++idx)
     {
-        oss << ", " << params[idx];
+        os << ", " << params[idx];
     }
-    return oss.str();
 }
 
 constexpr char GAMMA_STYLE_BASIC_FWD[]           = "basicFwd";
@@ -795,24 +792,28 @@ bool GammaOpData::equals(const OpData & other) const
             m_alphaParams == gop->m_alphaParams;
 }
 
-std::string GammaOpData::getCacheID() const
+void GammaOpData::writeCacheID(std::ostream & os) const
 {
     AutoMutex lock(m_mutex);
 
-    std::ostringstream cacheIDStream;
     if (!getID().empty())
     {
-        cacheIDStream << getID() << " ";
+        os << getID() << " ";
     }
 
-    cacheIDStream << GammaOpData::ConvertStyleToString(getStyle()) << " ";
+    os.precision(FLOAT_DECIMALS);
 
-    cacheIDStream << "r:" << GetParametersString(getRedParams())   << " ";
-    cacheIDStream << "g:" << GetParametersString(getGreenParams()) << " ";
-    cacheIDStream << "b:" << GetParametersString(getBlueParams())  << " ";
-    cacheIDStream << "a:" << GetParametersString(getAlphaParams()) << " ";
+    os << GammaOpData::ConvertStyleToString(getStyle()) << " ";
 
-    return cacheIDStream.str();
+    os << "r:";
+    WriteParameters(os, getRedParams());
+    os << " g:";
+    WriteParameters(os, getGreenParams());
+    os << " b:";
+    WriteParameters(os, getBlueParams());
+    os << " a:";
+    WriteParameters(os, getAlphaParams());
+    os << " ";
 }
 
 TransformDirection GammaOpData::getDirection() const noexcept
@@ -143,7 +143,7 @@ public:
 
     bool equals(const OpData& other) const override;
 
-    std::string getCacheID() const override;
+    void writeCacheID(std::ostream & os) const override;
 
     TransformDirection getDirection() const noexcept;
     void setDirection(TransformDirection dir) noexcept;
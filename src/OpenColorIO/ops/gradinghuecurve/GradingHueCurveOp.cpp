@@ -41,7 +41,7 @@ public:
     bool canCombineWith(ConstOpRcPtr & op) const override;
     void combineWith(OpRcPtrVec & ops, ConstOpRcPtr & secondOp) const override;
 
-    std::string getCacheID() const override;
+    void writeCacheID(std::ostream & os) const override;
 
     bool isDynamic() const override;
     bool hasDynamicProperty(DynamicPropertyType type) const override;
@@ -120,15 +120,12 @@ void GradingHueCurveOp::combineWith(OpRcPtrVec & /*ops*/, ConstOpRcPtr & secondO
     }
 }
 
-std::string GradingHueCurveOp::getCacheID() const
+void GradingHueCurveOp::writeCacheID(std::ostream & os) const
 {
     // Create the cacheID.
-    std::ostringstream cacheIDStream;
-    cacheIDStream << "<GradingHueCurveOp ";
-    cacheIDStream << hueCurveData()->getCacheID();
-    cacheIDStream << ">";
-
-    return cacheIDStream.str();
+    os << "<GradingHueCurveOp ";
+    hueCurveData()->writeCacheID(os);
+    os << ">";
 }
 
 bool GradingHueCurveOp::isDynamic() const
@@ -10,6 +10,7 @@
 #include "BitDepthUtils.h"
 #include "MathUtils.h"
 #include "ops/gradinghuecurve/GradingHueCurveOpCPU.h"
+#include "ops/gradinghuecurve/GradingHueCurveOpCPU_SIMD.h"
 #include "ops/fixedfunction/FixedFunctionOpCPU.h"
 #include "ops/fixedfunction/FixedFunctionOpData.h"
 #include "ops/matrix/MatrixOpCPU.h"
@@ -65,6 +66,10 @@ public:
     DynamicPropertyRcPtr getDynamicProperty(DynamicPropertyType type) const override;
 
 protected:
+    // Apply the vectorized renderer with a snapshot of the dynamic property values.
+    void applySIMD(const GradingBSplineCurveImpl::KnotsCoefs & knotsCoefs,
+                   const void * inImg, void * outImg, long numPixels) const;
+
     DynamicPropertyGradingHueCurveImplRcPtr m_ghuecurve;
     bool m_isLinear = false;
 
@@ -73,6 +78,9 @@ protected:
 
     apply_nonlin_func *m_applyLinLog = NoOp;
     apply_nonlin_func *m_applyLogLin = NoOp;
+
+    TransformDirection m_direction;
+    GradingHueCurveSIMDApplyFunc * m_applySIMD = nullptr;
 };
 
 GradingHueCurveOpCPU::GradingHueCurveOpCPU(ConstGradingHueCurveOpDataRcPtr & gcData)
@@ -125,6 +133,50 @@ GradingHueCurveOpCPU::GradingHueCurveOpCPU(ConstGradingHueCurveOpDataRcPtr & gcD
         m_applyLinLog = LinLog;
         m_applyLogLin = LogLin;
     }
+
+    m_direction = gcData->getDirection();
+
+#if OCIO_USE_AVX2
+    if (CPUInfo::instance().hasAVX2())
+    {
+        m_applySIMD = applyGradingHueCurveAVX2;
+    }
+#endif
+
+#if OCIO_USE_AVX512
+    if (CPUInfo::instance().hasAVX512())
+    {
+        m_applySIMD = applyGradingHueCurveAVX512;
+    }
+#endif
+}
+
+void GradingHueCurveOpCPU::applySIMD(const GradingBSplineCurveImpl::KnotsCoefs & knotsCoefs,
+                                     const void * inImg, void * outImg, long numPixels) const
+{
+    GradingHueCurveSIMDParams params;
+    params.dir = m_direction;
+    params.isLinear = m_isLinear;
+    for (int c = 0; c < HUE_NUM_CURVES; ++c)
+    {
+        params.curves[c] = knotsCoefs.getSIMDView(c);
+    }
+
+    // The RGB to HSY conversions are applied on blocks of pixels (i.e. instead of a pixel at a
+    // time) small enough to stay in the cache.
+    static constexpr long BlockSize = 1024;
+
+    const float * in = (const float *)inImg;
+    float * out = (float *)outImg;
+
+    for (long idx = 0; idx < numPixels; idx += BlockSize)
+    {
+        const long count = std::min(BlockSize, numPixels - idx);
+
+        m_rgbToHsyOp->apply(in + 4 * idx, out + 4 * idx, count);
+        m_applySIMD(params, out + 4 * idx, out + 4 * idx, count);
+        m_hsyToRgbOp->apply(out + 4 * idx, out + 4 * idx, count);
+    }
 }
 
 bool GradingHueCurveOpCPU::isDynamic() const
@@ -178,7 +230,8 @@ void GradingHueCurveDrawOpCPU::apply(const void * inImg, void * outImg, long num
 {
     // NB: LocalBypass does not matter, need to evaluate even if it's an identity.
 
-    const GradingBSplineCurveImpl::KnotsCoefs & knotsCoefs = m_ghuecurve->getKnotsCoefs();
+    const ConstKnotsCoefsRcPtr knotsCoefsPtr = m_ghuecurve->getKnotsCoefs();
+    const GradingBSplineCurveImpl::KnotsCoefs & knotsCoefs = *knotsCoefsPtr;
 
     const float * in = (float *)inImg;
     float * out = (float *)outImg;
@@ -216,7 +269,11 @@ static constexpr auto PixelSize = 4 * sizeof(float);
 
 void GradingHueCurveFwdOpCPU::apply(const void * inImg, void * outImg, long numPixels) const
 {
-    if (m_ghuecurve->getLocalBypass())
+    // Use the same knots & coefs for the whole call even if a new value gets committed.
+    const ConstKnotsCoefsRcPtr knotsCoefsPtr = m_ghuecurve->getKnotsCoefs();
+    const GradingBSplineCurveImpl::KnotsCoefs & knotsCoefs = *knotsCoefsPtr;
+
+    if (knotsCoefs.m_localBypass)
     {
         if (inImg != outImg)
         {
@@ -225,7 +282,11 @@ void GradingHueCurveFwdOpCPU::apply(const void * inImg, void * outImg, long numP
         return;
     }
 
-    const GradingBSplineCurveImpl::KnotsCoefs & knotsCoefs = m_ghuecurve->getKnotsCoefs();
+    if (m_applySIMD)
+    {
+        applySIMD(knotsCoefs, inImg, outImg, numPixels);
+        return;
+    }
 
     const float * in = (float *)inImg;
     float * out = (float *)outImg;
@@ -294,7 +355,11 @@ GradingHueCurveRevOpCPU::GradingHueCurveRevOpCPU(ConstGradingHueCurveOpDataRcPtr
 
 void GradingHueCurveRevOpCPU::apply(const void * inImg, void * outImg, long numPixels) const
 {
-    if (m_ghuecurve->getLocalBypass())
+    // Use the same knots & coefs for the whole call even if a new value gets committed.
+    const ConstKnotsCoefsRcPtr knotsCoefsPtr = m_ghuecurve->getKnotsCoefs();
+    const GradingBSplineCurveImpl::KnotsCoefs & knotsCoefs = *knotsCoefsPtr;
+
+    if (knotsCoefs.m_localBypass)
     {
         if (inImg != outImg)
         {
@@ -303,7 +368,11 @@ void GradingHueCurveRevOpCPU::apply(const void * inImg, void * outImg, long numP
         return;
     }
 
-    const GradingBSplineCurveImpl::KnotsCoefs & knotsCoefs = m_ghuecurve->getKnotsCoefs();
+    if (m_applySIMD)
+    {
+        applySIMD(knotsCoefs, inImg, outImg, numPixels);
+        return;
+    }
 
     const float * in = (float *)inImg;
     float * out = (float *)outImg;
@@ -0,0 +1,20 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include "ops/gradinghuecurve/GradingHueCurveOpCPU_SIMD.h"
+#if OCIO_USE_AVX2
+
+#include "AVX2.h"
+
+namespace OCIO_NAMESPACE
+{
+
+void applyGradingHueCurveAVX2(const GradingHueCurveSIMDParams & params,
+                              const float * in, float * out, long numPixels)
+{
+    ApplyGradingHueCurve<AVX2FloatOps>(params, in, out, numPixels);
+}
+
+} // namespace OCIO_NAMESPACE
+
+#endif // OCIO_USE_AVX2
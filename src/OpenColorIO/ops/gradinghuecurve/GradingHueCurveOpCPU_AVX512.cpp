@@ -0,0 +1,20 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include "ops/gradinghuecurve/GradingHueCurveOpCPU_SIMD.h"
+#if OCIO_USE_AVX512
+
+#include "AVX512.h"
+
+namespace OCIO_NAMESPACE
+{
+
+void applyGradingHueCurveAVX512(const GradingHueCurveSIMDParams & params,
+                                const float * in, float * out, long numPixels)
+{
+    ApplyGradingHueCurve<AVX512FloatOps>(params, in, out, numPixels);
+}
+
+} // namespace OCIO_NAMESPACE
+
+#endif // OCIO_USE_AVX512
@@ -0,0 +1,185 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#ifndef INCLUDED_OCIO_GRADINGHUECURVE_CPU_SIMD_H
+#define INCLUDED_OCIO_GRADINGHUECURVE_CPU_SIMD_H
+
+#include <math.h>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "CPUInfo.h"
+#include "ops/gradingrgbcurve/GradingBSplineCurve_SIMD.h"
+#include "SIMDMath.h"
+
+namespace OCIO_NAMESPACE
+{
+
+// Snapshot of the dynamic property curves used by the vectorized renderers. Note that the
+// vectorized renderers only process the HSY values i.e. the caller applies the RGB to HSY
+// conversions.
+struct GradingHueCurveSIMDParams
+{
+    TransformDirection   dir = TRANSFORM_DIR_FORWARD;
+    bool                 isLinear = false;
+    BSplineCurveSIMDView curves[HUE_NUM_CURVES]; // In the HueCurveType order.
+};
+
+typedef void (GradingHueCurveSIMDApplyFunc)(const GradingHueCurveSIMDParams &,
+                                            const float *, float *, long);
+
+#if OCIO_USE_AVX2
+// Process 8 pixels at once.
+void applyGradingHueCurveAVX2(const GradingHueCurveSIMDParams & params,
+                              const float * in, float * out, long numPixels);
+#endif
+
+#if OCIO_USE_AVX512
+// Process 16 pixels at once.
+void applyGradingHueCurveAVX512(const GradingHueCurveSIMDParams & params,
+                                const float * in, float * out, long numPixels);
+#endif
+
+// SoA versions of LinLog & LogLin of GradingHueCurveOpCPU.cpp. As the curves are evaluated in
+// the log space, they use the same exact functions than the scalar versions (i.e. logf & powf
+// which are not inline) instead of the vectorized approximations.
+
+template<typename V>
+inline V HueCurveLinLogSoA(const V & pix)
+{
+    return ApplyPerLane(pix, [](float x)
+    {
+        constexpr float xbrk = 0.0041318374739483946f;
+        constexpr float shift = -0.000157849851665374f;
+        constexpr float m = 1.f / (0.18f + shift);
+        constexpr float gain = 363.034608563f;
+        constexpr float offs = -7.f;
+        constexpr float base2 = 1.4426950408889634f; // 1/log(2)
+
+        return (x < xbrk) ? x * gain + offs : base2 * logf((x + shift) * m);
+    });
+}
+
+template<typename V>
+inline V HueCurveLogLinSoA(const V & pix)
+{
+    return ApplyPerLane(pix, [](float x)
+    {
+        constexpr float shift = -0.000157849851665374f;
+        constexpr float gain = 363.034608563f;
+        constexpr float offs = -7.f;
+        constexpr float ybrk = -5.5f;
+
+        return (x < ybrk) ? (x - offs) / gain : powf(2.0f, x) * (0.18f + shift) - shift;
+    });
+}
+
+template<typename Ops>
+void ApplyGradingHueCurve(const GradingHueCurveSIMDParams & p,
+                          const float * in, float * out, long numPixels)
+{
+    typedef SIMDFloat<Ops> V;
+
+    const BSplineCurveSIMDView * curves = p.curves;
+    const bool isLinear = p.isLinear;
+
+    if (p.dir == TRANSFORM_DIR_FORWARD)
+    {
+        ApplyRGBASoA<Ops>(in, out, numPixels, [curves, isLinear](V & hue, V & sat, V & lum)
+        {
+            if (isLinear)
+            {
+                lum = HueCurveLinLogSoA(lum);
+            }
+
+            // HUE-SAT
+            const V hueSatGain = Max(0.f, EvalCurveSoA(curves[HUE_SAT], hue, V(1.f)));
+            // HUE-LUM
+            V hueLumGain = Max(0.f, EvalCurveSoA(curves[HUE_LUM], hue, V(1.f)));
+            // HUE-HUE
+            hue = EvalCurveSoA(curves[HUE_HUE], hue, hue);
+            // SAT-SAT
+            sat = Max(0.f, EvalCurveSoA(curves[SAT_SAT], sat, sat));
+            // LUM-SAT
+            const V lumSatGain = Max(0.f, EvalCurveSoA(curves[LUM_SAT], lum, V(1.f)));
+
+            // Apply sat gain.
+            sat *= lumSatGain * hueSatGain;
+
+            // SAT-LUM
+            const V satLumGain = Max(0.f, EvalCurveSoA(curves[SAT_LUM], sat, V(1.f)));
+            // LUM-LUM
+            lum = EvalCurveSoA(curves[LUM_LUM], lum, lum);
+
+            if (isLinear)
+            {
+                lum = HueCurveLogLinSoA(lum);
+            }
+
+            // Limit hue-lum gain at low sat.
+            hueLumGain = 1.f - (1.f - hueLumGain) * Min(sat, 1.f);
+
+            // Apply lum gain.
+            lum = isLinear ? lum * hueLumGain * satLumGain
+                           : lum + (hueLumGain + satLumGain - 2.f) * 0.1f;
+
+            // HUE-FX
+            hue = hue - Floor(hue);   // wrap to [0,1)
+            hue = hue + EvalCurveSoA(curves[HUE_FX], hue, V(0.f));
+        });
+    }
+    else
+    {
+        ApplyRGBASoA<Ops>(in, out, numPixels, [curves, isLinear](V & hue, V & sat, V & lum)
+        {
+            // Invert HUE-FX.
+            hue = EvalCurveRevHueSoA(curves[HUE_FX], true, hue);
+
+            // Invert HUE-HUE.
+            hue = EvalCurveRevHueSoA(curves[HUE_HUE], false, hue);
+
+            // Use the inverted hue to calculate the HUE-SAT & HUE-LUM gains.
+            hue = hue - Floor(hue);   // wrap to [0,1)
+            const V hueSatGain = Max(0.f, EvalCurveSoA(curves[HUE_SAT], hue, V(1.f)));
+            V hueLumGain = Max(0.f, EvalCurveSoA(curves[HUE_LUM], hue, V(1.f)));
+
+            // Use the output sat to calculate the SAT-LUM gain.
+            sat = Max(0.f, sat);         // guard against negative saturation
+            const V satLumGain = Max(0.f, EvalCurveSoA(curves[SAT_LUM], sat, V(1.f)));
+
+            hueLumGain = 1.f - (1.f - hueLumGain) * Min(sat, 1.f);
+
+            // Invert the lum gain.
+            const V lumGain = hueLumGain * satLumGain;
+            lum = isLinear ? lum / Max(0.01f, lumGain)
+                           : lum - (hueLumGain + satLumGain - 2.f) * 0.1f;
+
+            if (isLinear)
+            {
+                lum = HueCurveLinLogSoA(lum);
+            }
+
+            // Invert LUM-LUM.
+            lum = EvalCurveRevSoA(curves[LUM_LUM], lum);
+
+            // Use it to calc the LUM-SAT gain.
+            const V lumSatGain = Max(0.f, EvalCurveSoA(curves[LUM_SAT], lum, V(1.f)));
+
+            if (isLinear)
+            {
+                lum = HueCurveLogLinSoA(lum);
+            }
+
+            // Invert the sat gain.
+            const V satGain = lumSatGain * hueSatGain;
+            sat /= Max(0.01f, satGain);
+
+            // Invert SAT-SAT.
+            sat = Max(0.f, EvalCurveRevSoA(curves[SAT_SAT], sat));
+        });
+    }
+}
+
+} // namespace OCIO_NAMESPACE
+
+#endif /* INCLUDED_OCIO_GRADINGHUECURVE_CPU_SIMD_H */
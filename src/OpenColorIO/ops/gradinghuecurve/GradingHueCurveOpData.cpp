@@ -133,29 +133,27 @@ GradingHueCurveOpDataRcPtr GradingHueCurveOpData::inverse() const
     return res;
 }
 
-std::string GradingHueCurveOpData::getCacheID() const
+void GradingHueCurveOpData::writeCacheID(std::ostream & os) const
 {
     AutoMutex lock(m_mutex);
 
-    std::ostringstream cacheIDStream;
     if (!getID().empty())
     {
-        cacheIDStream << getID() << " ";
+        os << getID() << " ";
     }
 
-    cacheIDStream.precision(DefaultValues::FLOAT_DECIMALS);
+    os.precision(DefaultValues::FLOAT_DECIMALS);
 
-    cacheIDStream << GradingStyleToString(getStyle()) << " ";
-    cacheIDStream << TransformDirectionToString(getDirection()) << " ";
+    os << GradingStyleToString(getStyle()) << " ";
+    os << TransformDirectionToString(getDirection()) << " ";
     if (m_RGBToHSY != HSY_TRANSFORM_1)
     {
-        cacheIDStream << " bypassRGBToHSY ";
+        os << " bypassRGBToHSY ";
     }
     if (!isDynamic())
     {
-        cacheIDStream << *(m_value->getValue());
+        os << *(m_value->getValue());
     }
-    return cacheIDStream.str();
 }
 
 void GradingHueCurveOpData::setStyle(GradingStyle style) noexcept
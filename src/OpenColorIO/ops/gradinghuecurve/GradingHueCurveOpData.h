@@ -51,7 +51,7 @@ public:
     bool isInverse(ConstGradingHueCurveOpDataRcPtr & r) const;
     GradingHueCurveOpDataRcPtr inverse() const;
 
-    std::string getCacheID() const override;
+    void writeCacheID(std::ostream & os) const override;
 
     GradingStyle getStyle() const noexcept { return m_style; }
     void setStyle(GradingStyle style) noexcept;
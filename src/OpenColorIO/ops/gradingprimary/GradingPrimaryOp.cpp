@@ -41,7 +41,7 @@ public:
     bool canCombineWith(ConstOpRcPtr & op) const override;
     void combineWith(OpRcPtrVec & ops, ConstOpRcPtr & secondOp) const override;
 
-    std::string getCacheID() const override;
+    void writeCacheID(std::ostream & os) const override;
 
     bool isDynamic() const override;
     bool hasDynamicProperty(DynamicPropertyType type) const override;
@@ -122,15 +122,12 @@ void GradingPrimaryOp::combineWith(OpRcPtrVec & /*ops*/, ConstOpRcPtr & secondOp
     }
 }
 
-std::string GradingPrimaryOp::getCacheID() const
+void GradingPrimaryOp::writeCacheID(std::ostream & os) const
 {
     // Create the cacheID.
-    std::ostringstream cacheIDStream;
-    cacheIDStream << "<GradingPrimaryOp ";
-    cacheIDStream << primaryData()->getCacheID();
-    cacheIDStream << ">";
-
-    return cacheIDStream.str();
+    os << "<GradingPrimaryOp ";
+    primaryData()->writeCacheID(os);
+    os << ">";
 }
 
 bool GradingPrimaryOp::isDynamic() const
@@ -10,6 +10,7 @@
 #include "BitDepthUtils.h"
 #include "MathUtils.h"
 #include "ops/gradingprimary/GradingPrimaryOpCPU.h"
+#include "ops/gradingprimary/GradingPrimaryOpCPU_SIMD.h"
 #include "SSE.h"
 
 namespace OCIO_NAMESPACE
@@ -30,17 +31,83 @@ public:
     DynamicPropertyRcPtr getDynamicProperty(DynamicPropertyType type) const override;
 
 protected:
+    // Apply the vectorized renderer with the current values of the dynamic property.
+    void applySIMD(const void * inImg, void * outImg, long numPixels) const;
+
     DynamicPropertyGradingPrimaryImplRcPtr m_gp;
+
+    GradingStyle m_style;
+    TransformDirection m_direction;
+    GradingPrimarySIMDApplyFunc * m_applySIMD = nullptr;
 };
 
 GradingPrimaryOpCPU::GradingPrimaryOpCPU(ConstGradingPrimaryOpDataRcPtr & gp)
     : OpCPU()
+    , m_style(gp->getStyle())
+    , m_direction(gp->getDirection())
 {
     m_gp = gp->getDynamicPropertyInternal();
     if (m_gp->isDynamic())
     {
         m_gp = m_gp->createEditableCopy();
     }
+
+#if OCIO_USE_AVX2
+    if (CPUInfo::instance().hasAVX2())
+    {
+        m_applySIMD = applyGradingPrimaryAVX2;
+    }
+#endif
+
+#if OCIO_USE_AVX512
+    if (CPUInfo::instance().hasAVX512())
+    {
+        m_applySIMD = applyGradingPrimaryAVX512;
+    }
+#endif
+}
+
+void GradingPrimaryOpCPU::applySIMD(const void * inImg, void * outImg, long numPixels) const
+{
+    const GradingPrimary v = m_gp->getValue();
+    const ConstGradingPrimaryPreRenderRcPtr compPtr = m_gp->getComputedValue();
+    const GradingPrimaryPreRender & comp = *compPtr;
+
+    GradingPrimarySIMDParams params;
+    params.style = m_style;
+    params.dir = m_direction;
+
+    for (int c = 0; c < 3; ++c)
+    {
+        params.brightness[c] = comp.getBrightness()[c];
+        params.contrast[c]   = comp.getContrast()[c];
+        params.gamma[c]      = comp.getGamma()[c];
+        params.exposure[c]   = comp.getExposure()[c];
+        params.offset[c]     = comp.getOffset()[c];
+        params.slope[c]      = comp.getSlope()[c];
+    }
+
+    params.pivot      = static_cast<float>(comp.getPivot());
+    params.pivotBlack = static_cast<float>(v.m_pivotBlack);
+    params.pivotWhite = static_cast<float>(v.m_pivotWhite);
+    params.clampBlack = static_cast<float>(v.m_clampBlack);
+    params.clampWhite = static_cast<float>(v.m_clampWhite);
+
+    // Note: The gamma & the lin contrast share the same identity flag.
+    params.applyPower = !comp.isGammaIdentity();
+
+    if (m_direction == TRANSFORM_DIR_FORWARD)
+    {
+        params.saturation = static_cast<float>(v.m_saturation);
+        params.applySaturation = v.m_saturation != 1.;
+    }
+    else
+    {
+        params.saturation = v.m_saturation != 0. ? static_cast<float>(1. / v.m_saturation) : 1.f;
+        params.applySaturation = v.m_saturation != 1. && v.m_saturation != 0.;
+    }
+
+    m_applySIMD(params, (const float *)inImg, (float *)outImg, numPixels);
 }
 
 bool GradingPrimaryOpCPU::isDynamic() const
@@ -267,11 +334,18 @@ void GradingPrimaryLogFwdOpCPU::apply(const void * inImg, void * outImg, long nu
         return;
     }
 
+    if (m_applySIMD)
+    {
+        applySIMD(inImg, outImg, numPixels);
+        return;
+    }
+
     const float * in = (float *)inImg;
     float * out = (float *)outImg;
 
-    auto & v = m_gp->getValue();
-    auto & comp = m_gp->getComputedValue();
+    const GradingPrimary v = m_gp->getValue();
+    const ConstGradingPrimaryPreRenderRcPtr compPtr = m_gp->getComputedValue();
+    const GradingPrimaryPreRender & comp = *compPtr;
 
     const bool isGammaIdentity = comp.isGammaIdentity();
 
@@ -446,11 +520,18 @@ void GradingPrimaryLogRevOpCPU::apply(const void * inImg, void * outImg, long nu
         return;
     }
 
+    if (m_applySIMD)
+    {
+        applySIMD(inImg, outImg, numPixels);
+        return;
+    }
+
     const float * in = (float *)inImg;
     float * out = (float *)outImg;
 
-    auto & v = m_gp->getValue();
-    auto & comp = m_gp->getComputedValue();
+    const GradingPrimary v = m_gp->getValue();
+    const ConstGradingPrimaryPreRenderRcPtr compPtr = m_gp->getComputedValue();
+    const GradingPrimaryPreRender & comp = *compPtr;
 
     const bool isGammaIdentity = comp.isGammaIdentity();
 
@@ -620,11 +701,18 @@ void GradingPrimaryLinFwdOpCPU::apply(const void * inImg, void * outImg, long nu
         return;
     }
 
+    if (m_applySIMD)
+    {
+        applySIMD(inImg, outImg, numPixels);
+        return;
+    }
+
     const float * in = (float *)inImg;
     float * out = (float *)outImg;
 
-    auto & v = m_gp->getValue();
-    auto & comp = m_gp->getComputedValue();
+    const GradingPrimary v = m_gp->getValue();
+    const ConstGradingPrimaryPreRenderRcPtr compPtr = m_gp->getComputedValue();
+    const GradingPrimaryPreRender & comp = *compPtr;
 
     const bool isContrastIdentity = comp.isContrastIdentity();
 
@@ -794,11 +882,18 @@ void GradingPrimaryLinRevOpCPU::apply(const void * inImg, void * outImg, long nu
         return;
     }
 
+    if (m_applySIMD)
+    {
+        applySIMD(inImg, outImg, numPixels);
+        return;
+    }
+
     const float * in = (float *)inImg;
     float * out = (float *)outImg;
 
-    auto & v = m_gp->getValue();
-    auto & comp = m_gp->getComputedValue();
+    const GradingPrimary v = m_gp->getValue();
+    const ConstGradingPrimaryPreRenderRcPtr compPtr = m_gp->getComputedValue();
+    const GradingPrimaryPreRender & comp = *compPtr;
 
     const bool isContrastIdentity = comp.isContrastIdentity();
 
@@ -962,11 +1057,18 @@ void GradingPrimaryVidFwdOpCPU::apply(const void * inImg, void * outImg, long nu
         return;
     }
 
+    if (m_applySIMD)
+    {
+        applySIMD(inImg, outImg, numPixels);
+        return;
+    }
+
     const float * in = (float *)inImg;
     float * out = (float *)outImg;
 
-    auto & v = m_gp->getValue();
-    auto & comp = m_gp->getComputedValue();
+    const GradingPrimary v = m_gp->getValue();
+    const ConstGradingPrimaryPreRenderRcPtr compPtr = m_gp->getComputedValue();
+    const GradingPrimaryPreRender & comp = *compPtr;
 
     const bool isGammaIdentity = comp.isGammaIdentity();
 
@@ -1142,11 +1244,18 @@ void GradingPrimaryVidRevOpCPU::apply(const void * inImg, void * outImg, long nu
         return;
     }
 
+    if (m_applySIMD)
+    {
+        applySIMD(inImg, outImg, numPixels);
+        return;
+    }
+
     const float * in = (float *)inImg;
     float * out = (float *)outImg;
 
-    auto & v = m_gp->getValue();
-    auto & comp = m_gp->getComputedValue();
+    const GradingPrimary v = m_gp->getValue();
+    const ConstGradingPrimaryPreRenderRcPtr compPtr = m_gp->getComputedValue();
+    const GradingPrimaryPreRender & comp = *compPtr;
 
     const bool isGammaIdentity = comp.isGammaIdentity();
 
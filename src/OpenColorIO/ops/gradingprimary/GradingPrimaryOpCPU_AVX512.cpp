@@ -0,0 +1,20 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include "ops/gradingprimary/GradingPrimaryOpCPU_SIMD.h"
+#if OCIO_USE_AVX512
+
+#include "AVX512.h"
+
+namespace OCIO_NAMESPACE
+{
+
+void applyGradingPrimaryAVX512(const GradingPrimarySIMDParams & params,
+                               const float * in, float * out, long numPixels)
+{
+    ApplyGradingPrimary<AVX512FloatOps>(params, in, out, numPixels);
+}
+
+} // namespace OCIO_NAMESPACE
+
+#endif // OCIO_USE_AVX512
@@ -0,0 +1,262 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#ifndef INCLUDED_OCIO_GRADINGPRIMARY_CPU_SIMD_H
+#define INCLUDED_OCIO_GRADINGPRIMARY_CPU_SIMD_H
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "CPUInfo.h"
+#include "SIMDMath.h"
+
+namespace OCIO_NAMESPACE
+{
+
+// Snapshot of the dynamic property values used by the vectorized renderers. Note that the
+// computed values are already inverted for the inverse direction.
+struct GradingPrimarySIMDParams
+{
+    GradingStyle       style = GRADING_LOG;
+    TransformDirection dir = TRANSFORM_DIR_FORWARD;
+
+    float brightness[3] = { 0.f, 0.f, 0.f }; // Log style.
+    float contrast[3]   = { 1.f, 1.f, 1.f }; // Log & lin styles.
+    float gamma[3]      = { 1.f, 1.f, 1.f }; // Log & video styles.
+    float exposure[3]   = { 1.f, 1.f, 1.f }; // Lin style.
+    float offset[3]     = { 0.f, 0.f, 0.f }; // Lin & video styles.
+    float slope[3]      = { 1.f, 1.f, 1.f }; // Video style.
+
+    float pivot = 0.f;
+    float pivotBlack = 0.f;
+    float pivotWhite = 1.f;
+    float clampBlack = 0.f;
+    float clampWhite = 1.f;
+    float saturation = 1.f;
+
+    bool applyPower = true;       // False when the gamma (or lin contrast) is an identity.
+    bool applySaturation = true;  // False when the saturation is an identity.
+};
+
+typedef void (GradingPrimarySIMDApplyFunc)(const GradingPrimarySIMDParams &,
+                                           const float *, float *, long);
+
+#if OCIO_USE_AVX2
+// Process 8 pixels at once.
+void applyGradingPrimaryAVX2(const GradingPrimarySIMDParams & params,
+                             const float * in, float * out, long numPixels);
+#endif
+
+#if OCIO_USE_AVX512
+// Process 16 pixels at once.
+void applyGradingPrimaryAVX512(const GradingPrimarySIMDParams & params,
+                               const float * in, float * out, long numPixels);
+#endif
+
+// SoA versions of the functions of GradingPrimaryOpCPU.cpp.
+
+template<typename V>
+inline void ApplyContrastSoA(V & pix, float contrast, float pivot)
+{
+    pix = (pix - pivot) * contrast + pivot;
+}
+
+template<typename V>
+inline void ApplyLinContrastSoA(V & pix, float contrast, float pivot)
+{
+    pix = Power(Abs(pix / pivot), contrast) * CopySign(pivot, pix);
+}
+
+template<typename V>
+inline void ApplyGammaSoA(V & pix, float gamma, float blackPivot, float whitePivot)
+{
+    const V val = pix - blackPivot;
+    const float range = whitePivot - blackPivot;
+    pix = CopySign(Power(Abs(val) / range, gamma), val) * range + blackPivot;
+}
+
+template<typename V>
+inline void ApplySaturationSoA(V & r, V & g, V & b, float saturation)
+{
+    const V luma = r * 0.2126f + g * 0.7152f + b * 0.0722f;
+
+    r = luma + saturation * (r - luma);
+    g = luma + saturation * (g - luma);
+    b = luma + saturation * (b - luma);
+}
+
+template<typename V>
+inline void ApplyClampSoA(V & pix, float clampMin, float clampMax)
+{
+    pix = Min(Max(pix, clampMin), clampMax);
+}
+
+template<typename Ops>
+void ApplyGradingPrimary(const GradingPrimarySIMDParams & p,
+                         const float * in, float * out, long numPixels)
+{
+    typedef SIMDFloat<Ops> V;
+
+    switch (p.style)
+    {
+    case GRADING_LOG:
+    {
+        if (p.dir == TRANSFORM_DIR_FORWARD)
+        {
+            ApplyRGBASoA<Ops>(in, out, numPixels, [&p](V & r, V & g, V & b)
+            {
+                r += p.brightness[0];
+                g += p.brightness[1];
+                b += p.brightness[2];
+                ApplyContrastSoA(r, p.contrast[0], p.pivot);
+                ApplyContrastSoA(g, p.contrast[1], p.pivot);
+                ApplyContrastSoA(b, p.contrast[2], p.pivot);
+                if (p.applyPower)
+                {
+                    ApplyGammaSoA(r, p.gamma[0], p.pivotBlack, p.pivotWhite);
+                    ApplyGammaSoA(g, p.gamma[1], p.pivotBlack, p.pivotWhite);
+                    ApplyGammaSoA(b, p.gamma[2], p.pivotBlack, p.pivotWhite);
+                }
+                if (p.applySaturation)
+                {
+                    ApplySaturationSoA(r, g, b, p.saturation);
+                }
+                ApplyClampSoA(r, p.clampBlack, p.clampWhite);
+                ApplyClampSoA(g, p.clampBlack, p.clampWhite);
+                ApplyClampSoA(b, p.clampBlack, p.clampWhite);
+            });
+        }
+        else
+        {
+            ApplyRGBASoA<Ops>(in, out, numPixels, [&p](V & r, V & g, V & b)
+            {
+                ApplyClampSoA(r, p.clampBlack, p.clampWhite);
+                ApplyClampSoA(g, p.clampBlack, p.clampWhite);
+                ApplyClampSoA(b, p.clampBlack, p.clampWhite);
+                if (p.applySaturation)
+                {
+                    ApplySaturationSoA(r, g, b, p.saturation);
+                }
+                if (p.applyPower)
+                {
+                    ApplyGammaSoA(r, p.gamma[0], p.pivotBlack, p.pivotWhite);
+                    ApplyGammaSoA(g, p.gamma[1], p.pivotBlack, p.pivotWhite);
+                    ApplyGammaSoA(b, p.gamma[2], p.pivotBlack, p.pivotWhite);
+                }
+                ApplyContrastSoA(r, p.contrast[0], p.pivot);
+                ApplyContrastSoA(g, p.contrast[1], p.pivot);
+                ApplyContrastSoA(b, p.contrast[2], p.pivot);
+                r += p.brightness[0];
+                g += p.brightness[1];
+                b += p.brightness[2];
+            });
+        }
+        break;
+    }
+    case GRADING_LIN:
+    {
+        if (p.dir == TRANSFORM_DIR_FORWARD)
+        {
+            ApplyRGBASoA<Ops>(in, out, numPixels, [&p](V & r, V & g, V & b)
+            {
+                r = (r + p.offset[0]) * p.exposure[0];
+                g = (g + p.offset[1]) * p.exposure[1];
+                b = (b + p.offset[2]) * p.exposure[2];
+                if (p.applyPower)
+                {
+                    ApplyLinContrastSoA(r, p.contrast[0], p.pivot);
+                    ApplyLinContrastSoA(g, p.contrast[1], p.pivot);
+                    ApplyLinContrastSoA(b, p.contrast[2], p.pivot);
+                }
+                if (p.applySaturation)
+                {
+                    ApplySaturationSoA(r, g, b, p.saturation);
+                }
+                ApplyClampSoA(r, p.clampBlack, p.clampWhite);
+                ApplyClampSoA(g, p.clampBlack, p.clampWhite);
+                ApplyClampSoA(b, p.clampBlack, p.clampWhite);
+            });
+        }
+        else
+        {
+            ApplyRGBASoA<Ops>(in, out, numPixels, [&p](V & r, V & g, V & b)
+            {
+                ApplyClampSoA(r, p.clampBlack, p.clampWhite);
+                ApplyClampSoA(g, p.clampBlack, p.clampWhite);
+                ApplyClampSoA(b, p.clampBlack, p.clampWhite);
+                if (p.applySaturation)
+                {
+                    ApplySaturationSoA(r, g, b, p.saturation);
+                }
+                if (p.applyPower)
+                {
+                    ApplyLinContrastSoA(r, p.contrast[0], p.pivot);
+                    ApplyLinContrastSoA(g, p.contrast[1], p.pivot);
+                    ApplyLinContrastSoA(b, p.contrast[2], p.pivot);
+                }
+                r = r * p.exposure[0] + p.offset[0];
+                g = g * p.exposure[1] + p.offset[1];
+                b = b * p.exposure[2] + p.offset[2];
+            });
+        }
+        break;
+    }
+    case GRADING_VIDEO:
+    {
+        if (p.dir == TRANSFORM_DIR_FORWARD)
+        {
+            ApplyRGBASoA<Ops>(in, out, numPixels, [&p](V & r, V & g, V & b)
+            {
+                r += p.offset[0];
+                g += p.offset[1];
+                b += p.offset[2];
+                ApplyContrastSoA(r, p.slope[0], p.pivotBlack);
+                ApplyContrastSoA(g, p.slope[1], p.pivotBlack);
+                ApplyContrastSoA(b, p.slope[2], p.pivotBlack);
+                if (p.applyPower)
+                {
+                    ApplyGammaSoA(r, p.gamma[0], p.pivotBlack, p.pivotWhite);
+                    ApplyGammaSoA(g, p.gamma[1], p.pivotBlack, p.pivotWhite);
+                    ApplyGammaSoA(b, p.gamma[2], p.pivotBlack, p.pivotWhite);
+                }
+                if (p.applySaturation)
+                {
+                    ApplySaturationSoA(r, g, b, p.saturation);
+                }
+                ApplyClampSoA(r, p.clampBlack, p.clampWhite);
+                ApplyClampSoA(g, p.clampBlack, p.clampWhite);
+                ApplyClampSoA(b, p.clampBlack, p.clampWhite);
+            });
+        }
+        else
+        {
+            ApplyRGBASoA<Ops>(in, out, numPixels, [&p](V & r, V & g, V & b)
+            {
+                ApplyClampSoA(r, p.clampBlack, p.clampWhite);
+                ApplyClampSoA(g, p.clampBlack, p.clampWhite);
+                ApplyClampSoA(b, p.clampBlack, p.clampWhite);
+                if (p.applySaturation)
+                {
+                    ApplySaturationSoA(r, g, b, p.saturation);
+                }
+                if (p.applyPower)
+                {
+                    ApplyGammaSoA(r, p.gamma[0], p.pivotBlack, p.pivotWhite);
+                    ApplyGammaSoA(g, p.gamma[1], p.pivotBlack, p.pivotWhite);
+                    ApplyGammaSoA(b, p.gamma[2], p.pivotBlack, p.pivotWhite);
+                }
+                ApplyContrastSoA(r, p.slope[0], p.pivotBlack);
+                ApplyContrastSoA(g, p.slope[1], p.pivotBlack);
+                ApplyContrastSoA(b, p.slope[2], p.pivotBlack);
+                r += p.offset[0];
+                g += p.offset[1];
+                b += p.offset[2];
+            });
+        }
+        break;
+    }
+    }
+}
+
+} // namespace OCIO_NAMESPACE
+
+#endif /* INCLUDED_OCIO_GRADINGPRIMARY_CPU_SIMD_H */
@@ -82,7 +82,7 @@ bool GradingPrimaryOpData::isIdentity() const
     if (isDynamic()) return false;
 
     const GradingPrimary defaultValues{ m_style };
-    auto & values = m_value->getValue();
+    const GradingPrimary values = m_value->getValue();
 
     if (defaultValues.m_saturation == values.m_saturation  &&
         defaultValues.m_clampBlack == values.m_clampBlack &&
@@ -127,7 +127,7 @@ bool GradingPrimaryOpData::isIdentity() const
 
 OpDataRcPtr GradingPrimaryOpData::getIdentityReplacement() const
 {
-    auto & values = m_value->getValue();
+    const GradingPrimary values = m_value->getValue();
     double clampLow = values.m_clampBlack;
     bool lowEmpty = false;
     bool highEmpty = false;
@@ -155,7 +155,7 @@ OpDataRcPtr GradingPrimaryOpData::getIdentityReplacement() const
 
 bool GradingPrimaryOpData::hasChannelCrosstalk() const
 {
-    auto & values = m_value->getValue();
+    const GradingPrimary values = m_value->getValue();
     return values.m_saturation != 1.;
 }
 
@@ -184,26 +184,23 @@ GradingPrimaryOpDataRcPtr GradingPrimaryOpData::inverse() const
     return res;
 }
 
-std::string GradingPrimaryOpData::getCacheID() const
+void GradingPrimaryOpData::writeCacheID(std::ostream & os) const
 {
     AutoMutex lock(m_mutex);
 
-    std::ostringstream cacheIDStream;
     if (!getID().empty())
     {
-        cacheIDStream << getID() << " ";
+        os << getID() << " ";
     }
 
-    cacheIDStream.precision(DefaultValues::FLOAT_DECIMALS);
+    os.precision(DefaultValues::FLOAT_DECIMALS);
 
-    cacheIDStream << GradingStyleToString(getStyle()) << " ";
-    cacheIDStream << TransformDirectionToString(getDirection()) << " ";
+    os << GradingStyleToString(getStyle()) << " ";
+    os << TransformDirectionToString(getDirection()) << " ";
     if (!isDynamic())
     {
-        cacheIDStream << m_value->getValue();
+        os << m_value->getValue();
     }
-
-    return cacheIDStream.str();
 }
 
 void GradingPrimaryOpData::setStyle(GradingStyle style) noexcept
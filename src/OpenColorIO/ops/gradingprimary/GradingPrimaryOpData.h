@@ -44,12 +44,12 @@ public:
     bool isInverse(ConstGradingPrimaryOpDataRcPtr & r) const;
     GradingPrimaryOpDataRcPtr inverse() const;
 
-    std::string getCacheID() const override;
+    void writeCacheID(std::ostream & os) const override;
 
     GradingStyle getStyle() const noexcept { return m_style; }
     void setStyle(GradingStyle style) noexcept;
 
-    const GradingPrimary & getValue() const { return m_value->getValue(); }
+    GradingPrimary getValue() const { return m_value->getValue(); }
     void setValue(const GradingPrimary & values) { m_value->setValue(values); }
 
     TransformDirection getDirection() const noexcept;
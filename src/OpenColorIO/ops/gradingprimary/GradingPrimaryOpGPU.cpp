@@ -107,8 +107,8 @@ void AddGPLogProperties(GpuShaderCreatorRcPtr & shaderCreator,
         shaderCreator->addDynamicProperty(newProp);
         DynamicPropertyGradingPrimaryImpl * primaryProp = shaderProp.get();
 
-        // Use the shader dynamic property to bind the uniforms.
-        const auto & value = shaderProp->getValue();
+        // Use the shader dynamic property to bind the uniforms. Note that the getters read the
+        // current value of the property as a setValue() call publishes a new one.
 
         // Add uniforms if they are not already there.
         const auto getB = std::bind(&DynamicPropertyGradingPrimaryImpl::getBrightness, primaryProp);
@@ -122,23 +122,24 @@ void AddGPLogProperties(GpuShaderCreatorRcPtr & shaderCreator,
 
         const auto getPVal = std::bind(&DynamicPropertyGradingPrimaryImpl::getPivot, primaryProp);
         AddUniform(shaderCreator, getPVal, propNames.pivot);
-        const auto getPBVal = std::bind(&GradingPrimary::m_pivotBlack, &value);
+        const auto getPBVal = [primaryProp]() { return primaryProp->getValue().m_pivotBlack; };
         AddUniform(shaderCreator, getPBVal, propNames.pivotBlack);
-        const auto getPWVal = std::bind(&GradingPrimary::m_pivotWhite, &value);
+        const auto getPWVal = [primaryProp]() { return primaryProp->getValue().m_pivotWhite; };
         AddUniform(shaderCreator, getPWVal, propNames.pivotWhite);
-        const auto getCBVal = std::bind(&GradingPrimary::m_clampBlack, &value);
+        const auto getCBVal = [primaryProp]() { return primaryProp->getValue().m_clampBlack; };
         AddUniform(shaderCreator, getCBVal, propNames.clampBlack);
-        const auto getCWVal = std::bind(&GradingPrimary::m_clampWhite, &value);
+        const auto getCWVal = [primaryProp]() { return primaryProp->getValue().m_clampWhite; };
         AddUniform(shaderCreator, getCWVal, propNames.clampWhite);
-        const auto getSVal = std::bind(&GradingPrimary::m_saturation, &value);
+        const auto getSVal = [primaryProp]() { return primaryProp->getValue().m_saturation; };
         AddUniform(shaderCreator, getSVal, propNames.saturation);
         const auto getLBP = std::bind(&DynamicPropertyGradingPrimaryImpl::getLocalBypass, shaderProp.get());
         AddBoolUniform(shaderCreator, getLBP, propNames.localBypass);
     }
     else
     {
-        const auto & value = prop->getValue();
-        const auto & comp = prop->getComputedValue();
+        const GradingPrimary value = prop->getValue();
+        const ConstGradingPrimaryPreRenderRcPtr compPtr = prop->getComputedValue();
+        const GradingPrimaryPreRender & comp = *compPtr;
 
         st.declareFloat3(propNames.brightness, comp.getBrightness());
         st.declareFloat3(propNames.contrast, comp.getContrast());
@@ -256,8 +257,8 @@ void AddGPLinProperties(GpuShaderCreatorRcPtr & shaderCreator,
         shaderCreator->addDynamicProperty(newProp);
         DynamicPropertyGradingPrimaryImpl * primaryProp = shaderProp.get();
 
-        // Use the shader dynamic property to bind the uniforms.
-        const auto & value = shaderProp->getValue();
+        // Use the shader dynamic property to bind the uniforms. Note that the getters read the
+        // current value of the property as a setValue() call publishes a new one.
 
         const auto getO = std::bind(&DynamicPropertyGradingPrimaryImpl::getOffset, primaryProp);
         AddUniform(shaderCreator, getO, propNames.offset);
@@ -270,19 +271,20 @@ void AddGPLinProperties(GpuShaderCreatorRcPtr & shaderCreator,
 
         const auto getPVal = std::bind(&DynamicPropertyGradingPrimaryImpl::getPivot, primaryProp);
         AddUniform(shaderCreator, getPVal, propNames.pivot);
-        const auto getCBVal = std::bind(&GradingPrimary::m_clampBlack, &value);
+        const auto getCBVal = [primaryProp]() { return primaryProp->getValue().m_clampBlack; };
         AddUniform(shaderCreator, getCBVal, propNames.clampBlack);
-        const auto getCWVal = std::bind(&GradingPrimary::m_clampWhite, &value);
+        const auto getCWVal = [primaryProp]() { return primaryProp->getValue().m_clampWhite; };
         AddUniform(shaderCreator, getCWVal, propNames.clampWhite);
-        const auto getSVal = std::bind(&GradingPrimary::m_saturation, &value);
+        const auto getSVal = [primaryProp]() { return primaryProp->getValue().m_saturation; };
         AddUniform(shaderCreator, getSVal, propNames.saturation);
         const auto getLBP = std::bind(&DynamicPropertyGradingPrimaryImpl::getLocalBypass, shaderProp.get());
         AddBoolUniform(shaderCreator, getLBP, propNames.localBypass);
     }
     else
     {
-        const auto & value = prop->getValue();
-        const auto & comp = prop->getComputedValue();
+        const GradingPrimary value = prop->getValue();
+        const ConstGradingPrimaryPreRenderRcPtr compPtr = prop->getComputedValue();
+        const GradingPrimaryPreRender & comp = *compPtr;
 
         st.declareFloat3(propNames.offset, comp.getOffset());
         st.declareFloat3(propNames.exposure, comp.getExposure());
@@ -390,8 +392,8 @@ void AddGPVideoProperties(GpuShaderCreatorRcPtr & shaderCreator,
         shaderCreator->addDynamicProperty(newProp);
         DynamicPropertyGradingPrimaryImpl * primaryProp = shaderProp.get();
 
-        // Use the shader dynamic property to bind the uniforms.
-        const auto & value = shaderProp->getValue();
+        // Use the shader dynamic property to bind the uniforms. Note that the getters read the
+        // current value of the property as a setValue() call publishes a new one.
 
         // NB: No need to add an index to the name to avoid collisions as the dynamic properties
         // are unique.
@@ -405,23 +407,24 @@ void AddGPVideoProperties(GpuShaderCreatorRcPtr & shaderCreator,
         const auto getS = std::bind(&DynamicPropertyGradingPrimaryImpl::getSlope, primaryProp);
         AddUniform(shaderCreator, getS, propNames.slope);
 
-        const auto getPBVal = std::bind(&GradingPrimary::m_pivotBlack, &value);
+        const auto getPBVal = [primaryProp]() { return primaryProp->getValue().m_pivotBlack; };
         AddUniform(shaderCreator, getPBVal, propNames.pivotBlack);
-        const auto getPWVal = std::bind(&GradingPrimary::m_pivotWhite, &value);
+        const auto getPWVal = [primaryProp]() { return primaryProp->getValue().m_pivotWhite; };
         AddUniform(shaderCreator, getPWVal, propNames.pivotWhite);
-        const auto getCBVal = std::bind(&GradingPrimary::m_clampBlack, &value);
+        const auto getCBVal = [primaryProp]() { return primaryProp->getValue().m_clampBlack; };
         AddUniform(shaderCreator, getCBVal, propNames.clampBlack);
-        const auto getCWVal = std::bind(&GradingPrimary::m_clampWhite, &value);
+        const auto getCWVal = [primaryProp]() { return primaryProp->getValue().m_clampWhite; };
         AddUniform(shaderCreator, getCWVal, propNames.clampWhite);
-        const auto getSVal = std::bind(&GradingPrimary::m_saturation, &value);
+        const auto getSVal = [primaryProp]() { return primaryProp->getValue().m_saturation; };
         AddUniform(shaderCreator, getSVal, propNames.saturation);
         const auto getLBP = std::bind(&DynamicPropertyGradingPrimaryImpl::getLocalBypass, shaderProp.get());
         AddBoolUniform(shaderCreator, getLBP, propNames.localBypass);
     }
     else
     {
-        const auto & value = prop->getValue();
-        const auto & comp = prop->getComputedValue();
+        const GradingPrimary value = prop->getValue();
+        const ConstGradingPrimaryPreRenderRcPtr compPtr = prop->getComputedValue();
+        const GradingPrimaryPreRender & comp = *compPtr;
 
         st.declareFloat3(propNames.gamma, comp.getGamma());
         st.declareFloat3(propNames.offset, comp.getOffset());
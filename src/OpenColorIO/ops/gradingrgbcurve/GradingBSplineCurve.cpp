@@ -10,6 +10,7 @@
 
 #include "GpuShaderUtils.h"
 #include "ops/gradingrgbcurve/GradingBSplineCurve.h"
+#include "ops/gradingrgbcurve/GradingBSplineCurve_SIMD.h"
 
 namespace OCIO_NAMESPACE
 {
@@ -1436,6 +1437,21 @@ float GradingBSplineCurveImpl::KnotsCoefs::evalCurveRevHue(int c, float y) const
     // Note: The caller should wrap to ensure the output is a hue on [0,1).
 }
 
+//------------------------------------------------------------------------------------------------
+//
+BSplineCurveSIMDView GradingBSplineCurveImpl::KnotsCoefs::getSIMDView(int c) const
+{
+    BSplineCurveSIMDView view;
+    view.coefsSets = m_coefsOffsetsArray[2 * c + 1] / 3;
+    if (view.coefsSets != 0)
+    {
+        view.coefs = m_coefsArray.data() + m_coefsOffsetsArray[2 * c];
+        view.knots = m_knotsArray.data() + m_knotsOffsetsArray[2 * c];
+        view.knotsCnt = m_knotsOffsetsArray[2 * c + 1];
+    }
+    return view;
+}
+
 bool operator==(const GradingControlPoint & lhs, const GradingControlPoint & rhs)
 {
     return lhs.m_x == rhs.m_x && lhs.m_y == rhs.m_y;
@@ -13,6 +13,7 @@
 namespace OCIO_NAMESPACE
 {
 class GpuShaderText;
+struct BSplineCurveSIMDView;
 
 class GradingBSplineCurveImpl : public GradingBSplineCurve
 {
@@ -117,6 +118,9 @@ public:
         float evalCurveRev(int curveIdx, float y) const;
         // Reverse evaluation of HUE_HUE_B_SPLINE or HUE_FX curves using PERIODIC_0_B_SPLINE.
         float evalCurveRevHue(int c, float y) const;
+
+        // Curve data for the vectorized evaluations (refer to GradingBSplineCurve_SIMD.h).
+        BSplineCurveSIMDView getSIMDView(int curveIdx) const;
     };
 
     // Compute knots and coefs for a curve and add result to knotsCoefs. It has to be called for
@@ -0,0 +1,170 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#ifndef INCLUDED_OCIO_GRADINGBSPLINECURVE_SIMD_H
+#define INCLUDED_OCIO_GRADINGBSPLINECURVE_SIMD_H
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "SIMDMath.h"
+
+namespace OCIO_NAMESPACE
+{
+
+// Flat view of one of the curves of a GradingBSplineCurveImpl::KnotsCoefs (refer to
+// KnotsCoefs::getSIMDView()) used by the vectorized renderers.
+struct BSplineCurveSIMDView
+{
+    const float * knots = nullptr; // Knots of the curve.
+    const float * coefs = nullptr; // A coefs of the curve, followed by the B & C coefs.
+    int coefsSets = 0;             // Number of polynomial segments, 0 for an identity curve.
+    int knotsCnt = 0;
+};
+
+// SoA versions of the KnotsCoefs::evalCurve*() methods. Instead of the linear search of the
+// segment for each value, the coefficients of all the segments are selected in turn (i.e. no
+// gather) which produces the same segment than the scalar search as the knots are increasing.
+
+template<typename V>
+V EvalCurveSoA(const BSplineCurveSIMDView & curve, const V & x, const V & identityX)
+{
+    const int coefsSets = curve.coefsSets;
+    if (coefsSets == 0)
+    {
+        return identityX;
+    }
+
+    const float * A = curve.coefs;
+    const float * B = curve.coefs + coefsSets;
+    const float * C = curve.coefs + coefsSets * 2;
+    const float * knots = curve.knots;
+    const int knotsCnt = curve.knotsCnt;
+
+    V a = A[0], b = B[0], c = C[0], kn = knots[0];
+    for (int i = 1; i < knotsCnt - 1; ++i)
+    {
+        const typename V::Mask inSegment = x >= knots[i];
+        a  = Select(inSegment, A[i], a);
+        b  = Select(inSegment, B[i], b);
+        c  = Select(inSegment, C[i], c);
+        kn = Select(inSegment, knots[i], kn);
+    }
+
+    const V t = x - kn;
+    V res = (a * t + b) * t + c;
+
+    const float knStart = knots[0];
+    const float knEnd = knots[knotsCnt - 1];
+
+    {
+        const float tEnd = knEnd - knots[knotsCnt - 2];
+        const float slope = 2.f * A[coefsSets - 1] * tEnd + B[coefsSets - 1];
+        const float offs = (A[coefsSets - 1] * tEnd + B[coefsSets - 1]) * tEnd + C[coefsSets - 1];
+        res = Select(x >= knEnd, (x - knEnd) * slope + offs, res);
+    }
+
+    return Select(x <= knStart, (x - knStart) * B[0] + C[0], res);
+}
+
+template<typename V>
+V EvalCurveRevSoA(const BSplineCurveSIMDView & curve, const V & y)
+{
+    const int coefsSets = curve.coefsSets;
+    if (coefsSets == 0)
+    {
+        return y;
+    }
+
+    const float * A = curve.coefs;
+    const float * B = curve.coefs + coefsSets;
+    const float * C = curve.coefs + coefsSets * 2;
+    const float * knots = curve.knots;
+    const int knotsCnt = curve.knotsCnt;
+
+    V a = A[0], b = B[0], c = C[0], kn = knots[0];
+    for (int i = 1; i < knotsCnt - 1; ++i)
+    {
+        const typename V::Mask inSegment = y >= C[i];
+        a  = Select(inSegment, A[i], a);
+        b  = Select(inSegment, B[i], b);
+        c  = Select(inSegment, C[i], c);
+        kn = Select(inSegment, knots[i], kn);
+    }
+
+    const V C0 = c - y;
+    const V discrim = Sqrt(b * b - 4.f * a * C0);
+    V res = kn + (-2.f * C0) / (discrim + b);
+
+    const float knStart = knots[0];
+    const float knEnd = knots[knotsCnt - 1];
+    const float knStartY = C[0];
+
+    {
+        // Extrapolate high side.
+        const float t = knEnd - knots[knotsCnt - 2];
+        const float slope = 2.f * A[coefsSets - 1] * t + B[coefsSets - 1];
+        const float offs = (A[coefsSets - 1] * t + B[coefsSets - 1]) * t + C[coefsSets - 1];
+        const V high = (slope < 1e-5f && slope > -1e-5f) ? V(knEnd) : (y - offs) / slope + knEnd;
+        res = Select(y >= offs, high, res);
+    }
+
+    // Extrapolate low side.
+    const V low = (B[0] < 1e-5f && B[0] > -1e-5f) ? V(knStart) : (y - C[0]) / B[0] + knStart;
+    return Select(y <= knStartY, low, res);
+}
+
+template<typename V>
+V EvalCurveRevHueSoA(const BSplineCurveSIMDView & curve, bool isHfx, V y)
+{
+    const int coefsSets = curve.coefsSets;
+    if (coefsSets == 0)
+    {
+        return y;
+    }
+
+    const float * A = curve.coefs;
+    const float * B = curve.coefs + coefsSets;
+    const float * C = curve.coefs + coefsSets * 2;
+    const float * knots = curve.knots;
+    const int knotsCnt = curve.knotsCnt;
+
+    const float knStart = knots[0];
+    const float knEnd = knots[knotsCnt - 1];
+    const float knStartY = isHfx ? C[0] + knStart : C[0];
+    float knEndY;
+    {
+        const float t = knEnd - knots[knotsCnt - 2];
+        knEndY = (A[coefsSets - 1] * t + B[coefsSets - 1]) * t + C[coefsSets - 1];
+        knEndY = isHfx ? knEndY + knEnd : knEndY;
+    }
+
+    // Wrap up or down into the valid hue range.
+    y = Select(y < knStartY, y + Ceil(knStartY - y),
+               Select(y > knEndY, y - Ceil(y - knEndY), y));
+
+    V a = A[0], b = B[0], c = C[0], kn = knots[0];
+    for (int i = 1; i < knotsCnt - 1; ++i)
+    {
+        const float curveY = isHfx ? C[i] + knots[i] : C[i];
+
+        const typename V::Mask inSegment = y >= curveY;
+        a  = Select(inSegment, A[i], a);
+        b  = Select(inSegment, B[i], b);
+        c  = Select(inSegment, C[i], c);
+        kn = Select(inSegment, knots[i], kn);
+    }
+
+    if (isHfx)
+    {
+        c += kn;     // shift curve up so left edge is on the main diagonal
+        b += 1.f;    // add diagonal line
+    }
+
+    const V C0 = c - y;
+    const V discrim = Sqrt(b * b - 4.f * a * C0);
+    return kn + (-2.f * C0) / (discrim + b);
+}
+
+} // namespace OCIO_NAMESPACE
+
+#endif /* INCLUDED_OCIO_GRADINGBSPLINECURVE_SIMD_H */
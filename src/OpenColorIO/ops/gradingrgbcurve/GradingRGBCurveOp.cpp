@@ -41,7 +41,7 @@ public:
     bool canCombineWith(ConstOpRcPtr & op) const override;
     void combineWith(OpRcPtrVec & ops, ConstOpRcPtr & secondOp) const override;
 
-    std::string getCacheID() const override;
+    void writeCacheID(std::ostream & os) const override;
 
     bool isDynamic() const override;
     bool hasDynamicProperty(DynamicPropertyType type) const override;
@@ -121,15 +121,12 @@ void GradingRGBCurveOp::combineWith(OpRcPtrVec & /*ops*/, ConstOpRcPtr & secondO
     }
 }
 
-std::string GradingRGBCurveOp::getCacheID() const
+void GradingRGBCurveOp::writeCacheID(std::ostream & os) const
 {
     // Create the cacheID.
-    std::ostringstream cacheIDStream;
-    cacheIDStream << "<GradingRGBCurveOp ";
-    cacheIDStream << rgbCurveData()->getCacheID();
-    cacheIDStream << ">";
-
-    return cacheIDStream.str();
+    os << "<GradingRGBCurveOp ";
+    rgbCurveData()->writeCacheID(os);
+    os << ">";
 }
 
 bool GradingRGBCurveOp::isDynamic() const
@@ -10,6 +10,7 @@
 #include "BitDepthUtils.h"
 #include "MathUtils.h"
 #include "ops/gradingrgbcurve/GradingRGBCurveOpCPU.h"
+#include "ops/gradingrgbcurve/GradingRGBCurveOpCPU_SIMD.h"
 #include "SSE.h"
 
 namespace OCIO_NAMESPACE
@@ -52,17 +53,55 @@ protected:
         out[2] = knotsCoefs.evalCurveRev(static_cast<int>(RGB_BLUE), out[2]);
     }
 
+    // Apply the vectorized renderer with a snapshot of the dynamic property values.
+    void applySIMD(const GradingBSplineCurveImpl::KnotsCoefs & knotsCoefs,
+                   const void * inImg, void * outImg, long numPixels) const;
+
     DynamicPropertyGradingRGBCurveImplRcPtr m_grgbcurve;
+
+    TransformDirection m_direction;
+    bool m_linToLog;
+    GradingRGBCurveSIMDApplyFunc * m_applySIMD = nullptr;
 };
 
 GradingRGBCurveOpCPU::GradingRGBCurveOpCPU(ConstGradingRGBCurveOpDataRcPtr & grgbc)
     : OpCPU()
+    , m_direction(grgbc->getDirection())
+    , m_linToLog((grgbc->getStyle() == GRADING_LIN) && !grgbc->getBypassLinToLog())
 {
     m_grgbcurve = grgbc->getDynamicPropertyInternal();
     if (m_grgbcurve->isDynamic())
     {
         m_grgbcurve = m_grgbcurve->createEditableCopy();
     }
+
+#if OCIO_USE_AVX2
+    if (CPUInfo::instance().hasAVX2())
+    {
+        m_applySIMD = applyGradingRGBCurveAVX2;
+    }
+#endif
+
+#if OCIO_USE_AVX512
+    if (CPUInfo::instance().hasAVX512())
+    {
+        m_applySIMD = applyGradingRGBCurveAVX512;
+    }
+#endif
+}
+
+void GradingRGBCurveOpCPU::applySIMD(const GradingBSplineCurveImpl::KnotsCoefs & knotsCoefs,
+                                     const void * inImg, void * outImg, long numPixels) const
+{
+    GradingRGBCurveSIMDParams params;
+    params.dir = m_direction;
+    params.linToLog = m_linToLog;
+    for (const auto c : { RGB_RED, RGB_GREEN, RGB_BLUE, RGB_MASTER })
+    {
+        params.curves[c] = knotsCoefs.getSIMDView(static_cast<int>(c));
+    }
+
+    m_applySIMD(params, (const float *)inImg, (float *)outImg, numPixels);
 }
 
 bool GradingRGBCurveOpCPU::isDynamic() const
@@ -117,7 +156,11 @@ static constexpr auto PixelSize = 4 * sizeof(float);
 
 void GradingRGBCurveFwdOpCPU::apply(const void * inImg, void * outImg, long numPixels) const
 {
-    if (m_grgbcurve->getLocalBypass())
+    // Use the same knots & coefs for the whole call even if a new value gets committed.
+    const ConstKnotsCoefsRcPtr knotsCoefsPtr = m_grgbcurve->getKnotsCoefs();
+    const GradingBSplineCurveImpl::KnotsCoefs & knotsCoefs = *knotsCoefsPtr;
+
+    if (knotsCoefs.m_localBypass)
     {
         if (inImg != outImg)
         {
@@ -126,12 +169,18 @@ void GradingRGBCurveFwdOpCPU::apply(const void * inImg, void * outImg, long numP
         return;
     }
 
+    if (m_applySIMD)
+    {
+        applySIMD(knotsCoefs, inImg, outImg, numPixels);
+        return;
+    }
+
     const float * in = (float *)inImg;
     float * out = (float *)outImg;
 
     for (long idx = 0; idx < numPixels; ++idx)
     {
-        eval(m_grgbcurve->getKnotsCoefs(), out, in);
+        eval(knotsCoefs, out, in);
 
         out[3] = in[3];
 
@@ -242,7 +291,11 @@ inline void LogLin(float * out)
 
 void GradingRGBCurveLinearFwdOpCPU::apply(const void * inImg, void * outImg, long numPixels) const
 {
-    if (m_grgbcurve->getLocalBypass())
+    // Use the same knots & coefs for the whole call even if a new value gets committed.
+    const ConstKnotsCoefsRcPtr knotsCoefsPtr = m_grgbcurve->getKnotsCoefs();
+    const GradingBSplineCurveImpl::KnotsCoefs & knotsCoefs = *knotsCoefsPtr;
+
+    if (knotsCoefs.m_localBypass)
     {
         if (inImg != outImg)
         {
@@ -251,6 +304,12 @@ void GradingRGBCurveLinearFwdOpCPU::apply(const void * inImg, void * outImg, lon
         return;
     }
 
+    if (m_applySIMD)
+    {
+        applySIMD(knotsCoefs, inImg, outImg, numPixels);
+        return;
+    }
+
     const float * in = (float *)inImg;
     float * out = (float *)outImg;
 
@@ -259,7 +318,7 @@ void GradingRGBCurveLinearFwdOpCPU::apply(const void * inImg, void * outImg, lon
         LinLog(in, out);
 
         // Curves.
-        eval(m_grgbcurve->getKnotsCoefs(), out, out);
+        eval(knotsCoefs, out, out);
 
         LogLin(out);
 
@@ -287,7 +346,11 @@ GradingRGBCurveRevOpCPU::GradingRGBCurveRevOpCPU(ConstGradingRGBCurveOpDataRcPtr
 
 void GradingRGBCurveRevOpCPU::apply(const void * inImg, void * outImg, long numPixels) const
 {
-    if (m_grgbcurve->getLocalBypass())
+    // Use the same knots & coefs for the whole call even if a new value gets committed.
+    const ConstKnotsCoefsRcPtr knotsCoefsPtr = m_grgbcurve->getKnotsCoefs();
+    const GradingBSplineCurveImpl::KnotsCoefs & knotsCoefs = *knotsCoefsPtr;
+
+    if (knotsCoefs.m_localBypass)
     {
         if (inImg != outImg)
         {
@@ -296,12 +359,18 @@ void GradingRGBCurveRevOpCPU::apply(const void * inImg, void * outImg, long numP
         return;
     }
 
+    if (m_applySIMD)
+    {
+        applySIMD(knotsCoefs, inImg, outImg, numPixels);
+        return;
+    }
+
     const float * in = (float *)inImg;
     float * out = (float *)outImg;
 
     for (long idx = 0; idx < numPixels; ++idx)
     {
-        evalRev(m_grgbcurve->getKnotsCoefs(), out, in);
+        evalRev(knotsCoefs, out, in);
 
         out[3] = in[3];
 
@@ -327,7 +396,11 @@ GradingRGBCurveLinearRevOpCPU::GradingRGBCurveLinearRevOpCPU(ConstGradingRGBCurv
 
 void GradingRGBCurveLinearRevOpCPU::apply(const void * inImg, void * outImg, long numPixels) const
 {
-    if (m_grgbcurve->getLocalBypass())
+    // Use the same knots & coefs for the whole call even if a new value gets committed.
+    const ConstKnotsCoefsRcPtr knotsCoefsPtr = m_grgbcurve->getKnotsCoefs();
+    const GradingBSplineCurveImpl::KnotsCoefs & knotsCoefs = *knotsCoefsPtr;
+
+    if (knotsCoefs.m_localBypass)
     {
         if (inImg != outImg)
         {
@@ -336,6 +409,12 @@ void GradingRGBCurveLinearRevOpCPU::apply(const void * inImg, void * outImg, lon
         return;
     }
 
+    if (m_applySIMD)
+    {
+        applySIMD(knotsCoefs, inImg, outImg, numPixels);
+        return;
+    }
+
     const float * in = (float *)inImg;
     float * out = (float *)outImg;
 
@@ -344,7 +423,7 @@ void GradingRGBCurveLinearRevOpCPU::apply(const void * inImg, void * outImg, lon
         LinLog(in, out);
 
         // Curves.
-        evalRev(m_grgbcurve->getKnotsCoefs(), out, out);
+        evalRev(knotsCoefs, out, out);
 
         LogLin(out);
 
@@ -0,0 +1,131 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#ifndef INCLUDED_OCIO_GRADINGRGBCURVE_CPU_SIMD_H
+#define INCLUDED_OCIO_GRADINGRGBCURVE_CPU_SIMD_H
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "CPUInfo.h"
+#include "ops/gradingrgbcurve/GradingBSplineCurve_SIMD.h"
+#include "SIMDMath.h"
+
+namespace OCIO_NAMESPACE
+{
+
+// Snapshot of the dynamic property curves used by the vectorized renderers.
+struct GradingRGBCurveSIMDParams
+{
+    TransformDirection   dir = TRANSFORM_DIR_FORWARD;
+    bool                 linToLog = false;
+    BSplineCurveSIMDView curves[4]; // In the RGBCurveType order (i.e. R, G, B & M).
+};
+
+typedef void (GradingRGBCurveSIMDApplyFunc)(const GradingRGBCurveSIMDParams &,
+                                            const float *, float *, long);
+
+#if OCIO_USE_AVX2
+// Process 8 pixels at once.
+void applyGradingRGBCurveAVX2(const GradingRGBCurveSIMDParams & params,
+                              const float * in, float * out, long numPixels);
+#endif
+
+#if OCIO_USE_AVX512
+// Process 16 pixels at once.
+void applyGradingRGBCurveAVX512(const GradingRGBCurveSIMDParams & params,
+                                const float * in, float * out, long numPixels);
+#endif
+
+// Same as the SSE versions of LinLog & LogLin of GradingRGBCurveOpCPU.cpp.
+
+template<typename V>
+inline V RGBCurveLinLogSoA(const V & pix)
+{
+    constexpr float xbrk = 0.0041318374739483946f;
+    constexpr float shift = -0.000157849851665374f;
+    constexpr float m = 1.f / (0.18f + shift);
+    constexpr float gain = 363.034608563f;
+    constexpr float offs = -7.f;
+
+    return Select(pix > xbrk, Log2((pix + shift) * m), pix * gain + offs);
+}
+
+template<typename V>
+inline V RGBCurveLogLinSoA(const V & pix)
+{
+    constexpr float shift = -0.000157849851665374f;
+    constexpr float gain = 363.034608563f;
+    constexpr float offs = -7.f;
+    constexpr float ybrk = -5.5f;
+
+    return Select(pix > ybrk, Exp2(pix) * (0.18f + shift) - shift, (pix - offs) * (1.f / gain));
+}
+
+template<typename Ops>
+void ApplyGradingRGBCurve(const GradingRGBCurveSIMDParams & p,
+                          const float * in, float * out, long numPixels)
+{
+    typedef SIMDFloat<Ops> V;
+
+    const BSplineCurveSIMDView & red    = p.curves[0];
+    const BSplineCurveSIMDView & green  = p.curves[1];
+    const BSplineCurveSIMDView & blue   = p.curves[2];
+    const BSplineCurveSIMDView & master = p.curves[3];
+
+    if (p.dir == TRANSFORM_DIR_FORWARD)
+    {
+        ApplyRGBASoA<Ops>(in, out, numPixels, [&](V & r, V & g, V & b)
+        {
+            if (p.linToLog)
+            {
+                r = RGBCurveLinLogSoA(r);
+                g = RGBCurveLinLogSoA(g);
+                b = RGBCurveLinLogSoA(b);
+            }
+
+            r = EvalCurveSoA(red, r, r);
+            g = EvalCurveSoA(green, g, g);
+            b = EvalCurveSoA(blue, b, b);
+            r = EvalCurveSoA(master, r, r);
+            g = EvalCurveSoA(master, g, g);
+            b = EvalCurveSoA(master, b, b);
+
+            if (p.linToLog)
+            {
+                r = RGBCurveLogLinSoA(r);
+                g = RGBCurveLogLinSoA(g);
+                b = RGBCurveLogLinSoA(b);
+            }
+        });
+    }
+    else
+    {
+        ApplyRGBASoA<Ops>(in, out, numPixels, [&](V & r, V & g, V & b)
+        {
+            if (p.linToLog)
+            {
+                r = RGBCurveLinLogSoA(r);
+                g = RGBCurveLinLogSoA(g);
+                b = RGBCurveLinLogSoA(b);
+            }
+
+            r = EvalCurveRevSoA(master, r);
+            g = EvalCurveRevSoA(master, g);
+            b = EvalCurveRevSoA(master, b);
+            r = EvalCurveRevSoA(red, r);
+            g = EvalCurveRevSoA(green, g);
+            b = EvalCurveRevSoA(blue, b);
+
+            if (p.linToLog)
+            {
+                r = RGBCurveLogLinSoA(r);
+                g = RGBCurveLogLinSoA(g);
+                b = RGBCurveLogLinSoA(b);
+            }
+        });
+    }
+}
+
+} // namespace OCIO_NAMESPACE
+
+#endif /* INCLUDED_OCIO_GRADINGRGBCURVE_CPU_SIMD_H */
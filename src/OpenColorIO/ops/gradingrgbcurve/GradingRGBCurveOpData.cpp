@@ -124,29 +124,27 @@ GradingRGBCurveOpDataRcPtr GradingRGBCurveOpData::inverse() const
     return res;
 }
 
-std::string GradingRGBCurveOpData::getCacheID() const
+void GradingRGBCurveOpData::writeCacheID(std::ostream & os) const
 {
     AutoMutex lock(m_mutex);
 
-    std::ostringstream cacheIDStream;
     if (!getID().empty())
     {
-        cacheIDStream << getID() << " ";
+        os << getID() << " ";
     }
 
-    cacheIDStream.precision(DefaultValues::FLOAT_DECIMALS);
+    os.precision(DefaultValues::FLOAT_DECIMALS);
 
-    cacheIDStream << GradingStyleToString(getStyle()) << " ";
-    cacheIDStream << TransformDirectionToString(getDirection()) << " ";
+    os << GradingStyleToString(getStyle()) << " ";
+    os << TransformDirectionToString(getDirection()) << " ";
     if (m_bypassLinToLog)
     {
-        cacheIDStream << " bypassLinToLog";
+        os << " bypassLinToLog";
     }
     if (!isDynamic())
     {
-        cacheIDStream << *(m_value->getValue());
+        os << *(m_value->getValue());
     }
-    return cacheIDStream.str();
 }
 
 void GradingRGBCurveOpData::setStyle(GradingStyle style) noexcept
@@ -48,7 +48,7 @@ public:
     bool isInverse(ConstGradingRGBCurveOpDataRcPtr & r) const;
     GradingRGBCurveOpDataRcPtr inverse() const;
 
-    std::string getCacheID() const override;
+    void writeCacheID(std::ostream & os) const override;
 
     GradingStyle getStyle() const noexcept { return m_style; }
     void setStyle(GradingStyle style) noexcept;
@@ -41,7 +41,7 @@ public:
     bool canCombineWith(ConstOpRcPtr & op) const override;
     void combineWith(OpRcPtrVec & ops, ConstOpRcPtr & secondOp) const override;
 
-    std::string getCacheID() const override;
+    void writeCacheID(std::ostream & os) const override;
 
     bool isDynamic() const override;
     bool hasDynamicProperty(DynamicPropertyType type) const override;
@@ -121,15 +121,12 @@ void GradingToneOp::combineWith(OpRcPtrVec & /*ops*/, ConstOpRcPtr & secondOp) c
     }
 }
 
-std::string GradingToneOp::getCacheID() const
+void GradingToneOp::writeCacheID(std::ostream & os) const
 {
     // Create the cacheID.
-    std::ostringstream cacheIDStream;
-    cacheIDStream << "<GradingToneOp ";
-    cacheIDStream << toneData()->getCacheID();
-    cacheIDStream << ">";
-
-    return cacheIDStream.str();
+    os << "<GradingToneOp ";
+    toneData()->writeCacheID(os);
+    os << ">";
 }
 
 bool GradingToneOp::isDynamic() const
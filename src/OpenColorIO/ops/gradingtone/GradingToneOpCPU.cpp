@@ -10,6 +10,7 @@
 #include "BitDepthUtils.h"
 #include "MathUtils.h"
 #include "ops/gradingtone/GradingToneOpCPU.h"
+#include "ops/gradingtone/GradingToneOpCPU_SIMD.h"
 #include "SSE.h"
 
 namespace OCIO_NAMESPACE
@@ -30,8 +31,13 @@ public:
     DynamicPropertyRcPtr getDynamicProperty(DynamicPropertyType type) const override;
 
 protected:
+    // Apply the vectorized renderer with the current values of the dynamic property.
+    void applySIMD(const void * inImg, void * outImg, long numPixels) const;
+
     DynamicPropertyGradingToneImplRcPtr m_gt;
     GradingStyle m_style;
+    TransformDirection m_direction;
+    GradingToneSIMDApplyFunc * m_applySIMD = nullptr;
 };
 
 GradingToneOpCPU::GradingToneOpCPU(ConstGradingToneOpDataRcPtr & gt)
@@ -39,10 +45,74 @@ GradingToneOpCPU::GradingToneOpCPU(ConstGradingToneOpDataRcPtr & gt)
 {
     m_gt = gt->getDynamicPropertyInternal();
     m_style = gt->getStyle();
+    m_direction = gt->getDirection();
     if (m_gt->isDynamic())
     {
         m_gt = m_gt->createEditableCopy();
     }
+
+#if OCIO_USE_AVX2
+    if (CPUInfo::instance().hasAVX2())
+    {
+        m_applySIMD = applyGradingToneAVX2;
+    }
+#endif
+
+#if OCIO_USE_AVX512
+    if (CPUInfo::instance().hasAVX512())
+    {
+        m_applySIMD = applyGradingToneAVX512;
+    }
+#endif
+}
+
+void GradingToneOpCPU::applySIMD(const void * inImg, void * outImg, long numPixels) const
+{
+    const GradingTone v = m_gt->getValue();
+    const ConstGradingTonePreRenderRcPtr vprPtr = m_gt->getComputedValue();
+    const GradingTonePreRender & vpr = *vprPtr;
+
+    GradingToneSIMDParams params;
+    params.isLinear = m_style == GRADING_LIN;
+    params.dir = m_direction;
+
+    for (const auto channel : { R, G, B, M })
+    {
+        const float mid_adj = Clamp(GetChannelValue(v.m_midtones, channel), 0.01f, 1.99f);
+        params.applyMids[channel] = mid_adj != 1.f;
+
+        params.hsVal[0][channel] = 2.f - GetChannelValue(v.m_highlights, channel);
+        params.hsVal[1][channel] = GetChannelValue(v.m_shadows, channel);
+        params.wbVal[0][channel] = GetChannelValue(v.m_whites, channel);
+        params.wbVal[1][channel] = GetChannelValue(v.m_blacks, channel);
+    }
+
+    float contrast = static_cast<float>(v.m_scontrast);
+    params.applySContrast = contrast != 1.f;
+    if (params.applySContrast)
+    {
+        // Limit the range of values to prevent reversals.
+        contrast = (contrast > 1.f) ? 1.f / (1.8125f - 0.8125f * std::min(contrast, 1.99f)) :
+                                            0.28125f + 0.71875f * std::max(contrast, 0.01f);
+    }
+    params.scontrast = contrast;
+
+    memcpy(params.midX, vpr.m_midX, sizeof(params.midX));
+    memcpy(params.midY, vpr.m_midY, sizeof(params.midY));
+    memcpy(params.midM, vpr.m_midM, sizeof(params.midM));
+    memcpy(params.hsX, vpr.m_hsX, sizeof(params.hsX));
+    memcpy(params.hsY, vpr.m_hsY, sizeof(params.hsY));
+    memcpy(params.hsM, vpr.m_hsM, sizeof(params.hsM));
+    memcpy(params.wbX, vpr.m_wbX, sizeof(params.wbX));
+    memcpy(params.wbY, vpr.m_wbY, sizeof(params.wbY));
+    memcpy(params.wbM, vpr.m_wbM, sizeof(params.wbM));
+    memcpy(params.wbGain, vpr.m_wbGain, sizeof(params.wbGain));
+    memcpy(params.scX, vpr.m_scX, sizeof(params.scX));
+    memcpy(params.scY, vpr.m_scY, sizeof(params.scY));
+    memcpy(params.scM, vpr.m_scM, sizeof(params.scM));
+    params.pivot = vpr.m_pivot;
+
+    m_applySIMD(params, (const float *)inImg, (float *)outImg, numPixels);
 }
 
 bool GradingToneOpCPU::isDynamic() const
@@ -958,11 +1028,18 @@ void GradingToneFwdOpCPU::apply(const void * inImg, void * outImg, long numPixel
         return;
     }
 
+    if (m_applySIMD)
+    {
+        applySIMD(inImg, outImg, numPixels);
+        return;
+    }
+
     const float * in = (float *)inImg;
     float * out = (float *)outImg;
 
-    auto & v = m_gt->getValue();
-    auto & vpr = m_gt->getComputedValue();
+    const GradingTone v = m_gt->getValue();
+    const ConstGradingTonePreRenderRcPtr vprPtr = m_gt->getComputedValue();
+    const GradingTonePreRender & vpr = *vprPtr;
 
     for (long idx = 0; idx < numPixels; ++idx)
     {
@@ -1015,11 +1092,18 @@ void GradingToneRevOpCPU::apply(const void * inImg, void * outImg, long numPixel
         return;
     }
 
+    if (m_applySIMD)
+    {
+        applySIMD(inImg, outImg, numPixels);
+        return;
+    }
+
     const float * in = (float *)inImg;
     float * out = (float *)outImg;
 
-    auto & v = m_gt->getValue();
-    auto & vpr = m_gt->getComputedValue();
+    const GradingTone v = m_gt->getValue();
+    const ConstGradingTonePreRenderRcPtr vprPtr = m_gt->getComputedValue();
+    const GradingTonePreRender & vpr = *vprPtr;
 
     for (long idx = 0; idx < numPixels; ++idx)
     {
@@ -1155,11 +1239,18 @@ void GradingToneLinearFwdOpCPU::apply(const void * inImg, void * outImg, long nu
         return;
     }
 
+    if (m_applySIMD)
+    {
+        applySIMD(inImg, outImg, numPixels);
+        return;
+    }
+
     const float * in = (float *)inImg;
     float * out = (float *)outImg;
 
-    auto & v = m_gt->getValue();
-    auto & vpr = m_gt->getComputedValue();
+    const GradingTone v = m_gt->getValue();
+    const ConstGradingTonePreRenderRcPtr vprPtr = m_gt->getComputedValue();
+    const GradingTonePreRender & vpr = *vprPtr;
 
     for (long idx = 0; idx < numPixels; ++idx)
     {
@@ -1212,11 +1303,18 @@ void GradingToneLinearRevOpCPU::apply(const void * inImg, void * outImg, long nu
         return;
     }
 
+    if (m_applySIMD)
+    {
+        applySIMD(inImg, outImg, numPixels);
+        return;
+    }
+
     const float * in = (float *)inImg;
     float * out = (float *)outImg;
 
-    auto & v = m_gt->getValue();
-    auto & vpr = m_gt->getComputedValue();
+    const GradingTone v = m_gt->getValue();
+    const ConstGradingTonePreRenderRcPtr vprPtr = m_gt->getComputedValue();
+    const GradingTonePreRender & vpr = *vprPtr;
 
     for (long idx = 0; idx < numPixels; ++idx)
     {
@@ -0,0 +1,20 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#include "ops/gradingtone/GradingToneOpCPU_SIMD.h"
+#if OCIO_USE_AVX512
+
+#include "AVX512.h"
+
+namespace OCIO_NAMESPACE
+{
+
+void applyGradingToneAVX512(const GradingToneSIMDParams & params,
+                            const float * in, float * out, long numPixels)
+{
+    ApplyGradingTone<AVX512FloatOps>(params, in, out, numPixels);
+}
+
+} // namespace OCIO_NAMESPACE
+
+#endif // OCIO_USE_AVX512
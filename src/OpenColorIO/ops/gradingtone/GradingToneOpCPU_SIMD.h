@@ -0,0 +1,589 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#ifndef INCLUDED_OCIO_GRADINGTONE_CPU_SIMD_H
+#define INCLUDED_OCIO_GRADINGTONE_CPU_SIMD_H
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "CPUInfo.h"
+#include "SIMDMath.h"
+
+namespace OCIO_NAMESPACE
+{
+
+// Snapshot of the dynamic property values used by the vectorized renderers. The channels are
+// in the RGBMChannel order (i.e. R, G, B & M) and the arrays are copies of the
+// GradingTonePreRender ones.
+struct GradingToneSIMDParams
+{
+    bool               isLinear = false;
+    TransformDirection dir = TRANSFORM_DIR_FORWARD;
+
+    bool  applyMids[4]{ false, false, false, false };
+    float hsVal[2][4]{ { 1.f } };     // 2 - highlights & shadows values.
+    float wbVal[2][4]{ { 1.f } };     // whites & blacks values.
+    bool  applySContrast = false;
+    float scontrast = 1.f;            // Limited s-contrast value.
+
+    float midX[4][6]{ { 0.f } };
+    float midY[4][6]{ { 0.f } };
+    float midM[4][6]{ { 0.f } };
+
+    float hsX[2][4][3]{ { { 0.f } } };
+    float hsY[2][4][3]{ { { 0.f } } };
+    float hsM[2][4][2]{ { { 0.f } } };
+
+    float wbX[2][4][2]{ { { 0.f } } };
+    float wbY[2][4][2]{ { { 0.f } } };
+    float wbM[2][4][2]{ { { 0.f } } };
+    float wbGain[2][4]{ { 0.f } };
+
+    float scX[2][4]{ { 0.f } };
+    float scY[2][4]{ { 0.f } };
+    float scM[2][2]{ { 0.f } };
+
+    float pivot = 0.f;
+};
+
+typedef void (GradingToneSIMDApplyFunc)(const GradingToneSIMDParams &,
+                                        const float *, float *, long);
+
+#if OCIO_USE_AVX2
+// Process 8 pixels at once.
+void applyGradingToneAVX2(const GradingToneSIMDParams & params,
+                          const float * in, float * out, long numPixels);
+#endif
+
+#if OCIO_USE_AVX512
+// Process 16 pixels at once.
+void applyGradingToneAVX512(const GradingToneSIMDParams & params,
+                            const float * in, float * out, long numPixels);
+#endif
+
+// SoA versions of the functions of GradingToneOpCPU.cpp. Note that the master channel (M)
+// version of the functions is applied on each of the RGB channels, some of them use slightly
+// different comparisons than the single channel version.
+
+// Apply func on the channel or on each of the RGB channels for the master channel.
+template<typename V, typename Func>
+inline void ApplyToneChannelSoA(V * rgb, int channel, const Func & func)
+{
+    if (channel != 3)
+    {
+        rgb[channel] = func(rgb[channel], false);
+    }
+    else
+    {
+        rgb[0] = func(rgb[0], true);
+        rgb[1] = func(rgb[1], true);
+        rgb[2] = func(rgb[2], true);
+    }
+}
+
+template<typename V>
+V MidsFwdSoA(const GradingToneSIMDParams & p, int channel, const V & t, bool isMaster)
+{
+    const float x0 = p.midX[channel][0];
+    const float x1 = p.midX[channel][1];
+    const float x2 = p.midX[channel][2];
+    const float x3 = p.midX[channel][3];
+    const float x4 = p.midX[channel][4];
+    const float x5 = p.midX[channel][5];
+    const float y0 = p.midY[channel][0];
+    const float y1 = p.midY[channel][1];
+    const float y2 = p.midY[channel][2];
+    const float y3 = p.midY[channel][3];
+    const float y4 = p.midY[channel][4];
+    const float y5 = p.midY[channel][5];
+    const float m0 = p.midM[channel][0];
+    const float m1 = p.midM[channel][1];
+    const float m2 = p.midM[channel][2];
+    const float m3 = p.midM[channel][3];
+    const float m4 = p.midM[channel][4];
+    const float m5 = p.midM[channel][5];
+
+    const V tL  = (t - x0) / (x1 - x0);
+    const V tM  = (t - x1) / (x2 - x1);
+    const V tR  = (t - x2) / (x3 - x2);
+    const V tR2 = (t - x3) / (x4 - x3);
+    const V tR3 = (t - x4) / (x5 - x4);
+
+    const V fL  = tL * (x1 - x0) * ( tL * 0.5f * (m1 - m0) + m0 ) + y0;
+    const V fM  = tM * (x2 - x1) * ( tM * 0.5f * (m2 - m1) + m1 ) + y1;
+    const V fR  = tR * (x3 - x2) * ( tR * 0.5f * (m3 - m2) + m2 ) + y2;
+    const V fR2 = tR2 * (x4 - x3) * ( tR2 * 0.5f * (m4 - m3) + m3 ) + y3;
+    const V fR3 = tR3 * (x5 - x4) * ( tR3 * 0.5f * (m5 - m4) + m4 ) + y4;
+
+    V res = Select(t < x1, fL, fM);
+    if (!isMaster)
+    {
+        res = Select(t > x2, fR, res);
+        res = Select(t > x3, fR2, res);
+        res = Select(t > x4, fR3, res);
+        res = Select(t < x0, y0 + (t - x0) * m0, res);
+        return Select(t > x5, y5 + (t - x5) * m5, res);
+    }
+
+    res = Select(t < x2, res, fR);
+    res = Select(t < x3, res, fR2);
+    res = Select(t < x4, res, fR3);
+    res = Select(t < x0, (t - x0) * m0 + y0, res);
+    return Select(t < x5, res, (t - x5) * m5 + y5);
+}
+
+// Inverse of a segment of the midtones curve.
+template<typename V>
+inline V MidsRevSegmentSoA(const V & t, float x0, float x1, float y0, float m0, float m1)
+{
+    const V c = y0 - t;
+    const float b = m0 * (x1 - x0);
+    const float a = 0.5f * (m1 - m0) * (x1 - x0);
+    const V discrim = Sqrt(b * b - 4.f * a * c);
+    const V tmp = (2.f * c) / (-b - discrim);
+    return tmp * (x1 - x0) + x0;
+}
+
+template<typename V>
+V MidsRevSoA(const GradingToneSIMDParams & p, int channel, const V & t, bool isMaster)
+{
+    const float x0 = p.midX[channel][0];
+    const float x1 = p.midX[channel][1];
+    const float x2 = p.midX[channel][2];
+    const float x3 = p.midX[channel][3];
+    const float x4 = p.midX[channel][4];
+    const float x5 = p.midX[channel][5];
+    const float y0 = p.midY[channel][0];
+    const float y1 = p.midY[channel][1];
+    const float y2 = p.midY[channel][2];
+    const float y3 = p.midY[channel][3];
+    const float y4 = p.midY[channel][4];
+    const float y5 = p.midY[channel][5];
+    const float m0 = p.midM[channel][0];
+    const float m1 = p.midM[channel][1];
+    const float m2 = p.midM[channel][2];
+    const float m3 = p.midM[channel][3];
+    const float m4 = p.midM[channel][4];
+    const float m5 = p.midM[channel][5];
+
+    const V outL0 = x0 + (t - y0) / m0;
+    const V outL  = MidsRevSegmentSoA(t, x0, x1, y0, m0, m1);
+    const V outM  = MidsRevSegmentSoA(t, x1, x2, y1, m1, m2);
+    const V outR  = MidsRevSegmentSoA(t, x2, x3, y2, m2, m3);
+    const V outR2 = MidsRevSegmentSoA(t, x3, x4, y3, m3, m4);
+    const V outR3 = MidsRevSegmentSoA(t, x4, x5, y4, m4, m5);
+
+    if (!isMaster)
+    {
+        // Note: The single channel version uses the first segment to extrapolate the top end.
+        V res = Select(t >= y0, outL, outL0);
+        res = Select(t >= y1, outM, res);
+        res = Select(t >= y2, outR, res);
+        res = Select(t >= y3, outR2, res);
+        res = Select(t >= y4, outR3, res);
+        return Select(t >= y5, outL0, res);
+    }
+
+    const V outR4 = x5 + (t - y5) / m5;
+
+    V res = Select(t < y1, outL, outM);
+    res = Select(t < y2, res, outR);
+    res = Select(t < y3, res, outR2);
+    res = Select(t < y4, res, outR3);
+    res = Select(t < y0, outL0, res);
+    return Select(t < y5, res, outR4);
+}
+
+template<typename V>
+V ComputeHSFwdSoA(const float * x, const float * y, const float * m, const V & t)
+{
+    const float x0 = x[0], x1 = x[1], x2 = x[2];
+    const float y0 = y[0], y1 = y[1], y2 = y[2];
+    const float m0 = m[0], m2 = m[1];
+
+    const V tL = (t - x0) / (x1 - x0);
+    const V tR = (t - x1) / (x2 - x1);
+    const V fL = y0 * (1.f - tL*tL) + y1 * tL*tL + m0 * (1.f - tL) * tL * (x1 - x0);
+    const V fR = y1 * (1.f - tR)*(1.f - tR) + y2 * (2.f - tR)*tR + m2 * (tR - 1.f)*tR * (x2 - x1);
+
+    V res = Select(t < x1, fL, fR);
+    res = Select(t < x0, (t - x0) * m0 + y0, res);
+    return Select(t < x2, res, (t - x2) * m2 + y2);
+}
+
+template<typename V>
+V ComputeHSRevSoA(const float * x, const float * y, const float * m, const V & t)
+{
+    const float x0 = x[0], x1 = x[1], x2 = x[2];
+    const float y0 = y[0], y1 = y[1], y2 = y[2];
+    const float m0 = m[0], m2 = m[1];
+
+    const float bL = m0 * (x1 - x0);
+    const float aL = y1 - y0 - m0 * (x1 - x0);
+    const V cL = y0 - t;
+    const V discrimL = Sqrt(bL * bL - 4.f * aL * cL);
+    const V outL = (-2.f * cL) / (discrimL + bL) * (x1 - x0) + x0;
+    const float bR = 2.f*y2 - 2.f*y1 - m2 * (x2 - x1);
+    const float aR = y1 - y2 + m2 * (x2 - x1);
+    const V cR = y1 - t;
+    const V discrimR = Sqrt(bR * bR - 4.f * aR * cR);
+    const V outR = (-2.f * cR) / (discrimR + bR) * (x2 - x1) + x1;
+
+    V res = Select(t < y1, outL, outR);
+    res = Select(t < y0, (t - y0) / m0 + x0, res);
+    return Select(t < y2, res, (t - y2) / m2 + x2);
+}
+
+template<typename V>
+void HighlightShadowSoA(const GradingToneSIMDParams & p, int channel, bool isShadow, V * rgb)
+{
+    const int hs = isShadow ? 1 : 0;
+
+    const float val = p.hsVal[hs][channel];
+    if (val == 1.f) return;
+
+    const float * x = p.hsX[hs][channel];
+    const float * y = p.hsY[hs][channel];
+    const float * m = p.hsM[hs][channel];
+
+    // The effect of val is symmetric around 1 (<1 uses Fwd algorithm, >1 uses Rev algorithm).
+    const bool useFwd = (val < 1.f) == (p.dir == TRANSFORM_DIR_FORWARD);
+
+    ApplyToneChannelSoA(rgb, channel, [x, y, m, useFwd](const V & t, bool)
+    {
+        return useFwd ? ComputeHSFwdSoA(x, y, m, t) : ComputeHSRevSoA(x, y, m, t);
+    });
+}
+
+template<typename V>
+V ComputeWBFwdSoA(bool isBlack, float val, float x0, float x1, float y0, float y1,
+                  float m0, float m1, float gain, V t)
+{
+    const float mtest = (!isBlack) ? val : 2.f - val;
+
+    if (mtest < 1.f)
+    {
+        // Slope is decreasing case.
+
+        const V tlocal = (t - x0) / (x1 - x0);
+        V res = tlocal * (x1 - x0) * (tlocal * 0.5f * (m1 - m0) + m0) + y0;
+        res = Select(t < x0, y0 + (t - x0) * m0, res);
+        return Select(t < x1, res, y1 + (t - x1) * m1);
+    }
+    else if (mtest > 1.f)
+    {
+        // Slope is increasing case.
+
+        t = (!isBlack) ? (t - x0) * gain + x0 : (t - x1) * gain + x1;
+
+        const float a = 0.5f * (m1 - m0) * (x1 - x0);
+        const float b = m0 * (x1 - x0);
+
+        const V c = y0 - t;
+        const V discrim = Sqrt(b * b - 4.f * a * c);
+        const V tmp = (-2.f * c) / (discrim + b);
+        V res = tmp * (x1 - x0) + x0;
+        res = Select(t < y0, x0 + (t - y0) / m0, res);
+
+        if (!isBlack)
+        {
+            res = (res - x0) / gain + x0;
+            // Quadratic extrapolation for better HDR control.
+            const float new_y1 = (x1 - x0) / gain + x0;
+            const float xd = x0 + (x1 - x0) * 0.99f;
+            float md = m0 + (xd - x0) * (m1 - m0) / (x1 - x0);
+            md = 1.f / md;
+            const float aa = 0.5f * (1.f / m1 - md) / (x1 - xd);
+            const float bb = 1.f / m1 - 2.f * aa * x1;
+            const float cc = new_y1 - bb * x1 - aa * x1 * x1;
+            t = (t - x0) / gain + x0;
+
+            return Select(t < x1, res, (aa * t + bb) * t + cc);
+        }
+
+        res = Select(t < y1, res, x1 + (t - y1) / m1);
+        return (res - x1) / gain + x1;
+    }
+
+    return t;
+}
+
+template<typename V>
+V ComputeWBRevSoA(bool isBlack, float val, float x0, float x1, float y0, float y1,
+                  float m0, float m1, float gain, V t)
+{
+    const float mtest = (!isBlack) ? val : 2.f - val;
+
+    if (mtest < 1.f)
+    {
+        // Slope is decreasing case.
+
+        const float a = 0.5f * (m1 - m0) * (x1 - x0);
+        const float b = m0 * (x1 - x0);
+
+        const V c = y0 - t;
+        const V discrim = Sqrt(b * b - 4.f * a * c);
+        const V tmp = (-2.f * c) / (discrim + b);
+        V res = tmp * (x1 - x0) + x0;
+        res = Select(t < y0, x0 + (t - y0) / m0, res);
+        return Select(t < y1, res, x1 + (t - y1) / m1);
+    }
+    else if (mtest > 1.f)
+    {
+        // Slope is increasing case.
+
+        t = (!isBlack) ? (t - x0) * gain + x0 : (t - x1) * gain + x1;
+
+        const V tlocal = (t - x0) / (x1 - x0);
+        V res = tlocal * (x1 - x0) * (tlocal * 0.5f * (m1 - m0) + m0) + y0;
+        res = Select(t < x0, y0 + (t - x0) * m0, res);
+
+        if (!isBlack)
+        {
+            res = (res - x0) / gain + x0;
+            // Quadratic extrapolation for better HDR control.
+            const float new_y1 = (x1 - x0) / gain + x0;
+            const float xd = x0 + (x1 - x0) * 0.99f;
+            float md = m0 + (xd - x0) * (m1 - m0) / (x1 - x0);
+            md = 1.f / md;
+            const float aa = 0.5f * (1.f / m1 - md) / (x1 - xd);
+            const float bb = 1.f / m1 - 2.f * aa * x1;
+            const float cc = new_y1 - bb * x1 - aa * x1 * x1;
+            t = (t - x0) / gain + x0;
+
+            const V c = cc - t;
+            const V discrim = Sqrt(bb * bb - 4.f * aa * c);
+            const V res1 = (-2.f * c) / (discrim + bb);
+            const float brk = (aa * x1 + bb) * x1 + cc;
+            return Select(t < brk, res, res1);
+        }
+
+        res = Select(t < x1, res, y1 + (t - x1) * m1);
+        return (res - x1) / gain + x1;
+    }
+
+    return t;
+}
+
+template<typename V>
+void WhiteBlackSoA(const GradingToneSIMDParams & p, int channel, bool isBlack, V * rgb)
+{
+    const int wb = isBlack ? 1 : 0;
+
+    const float val  = p.wbVal[wb][channel];
+    const float x0   = p.wbX[wb][channel][0];
+    const float x1   = p.wbX[wb][channel][1];
+    const float y0   = p.wbY[wb][channel][0];
+    const float y1   = p.wbY[wb][channel][1];
+    const float m0   = p.wbM[wb][channel][0];
+    const float m1   = p.wbM[wb][channel][1];
+    const float gain = p.wbGain[wb][channel];
+
+    const bool isFwd = p.dir == TRANSFORM_DIR_FORWARD;
+
+    ApplyToneChannelSoA(rgb, channel, [&](const V & t, bool)
+    {
+        return isFwd ? ComputeWBFwdSoA(isBlack, val, x0, x1, y0, y1, m0, m1, gain, t)
+                     : ComputeWBRevSoA(isBlack, val, x0, x1, y0, y1, m0, m1, gain, t);
+    });
+}
+
+template<typename V>
+void MidsSoA(const GradingToneSIMDParams & p, int channel, V * rgb)
+{
+    if (!p.applyMids[channel]) return;
+
+    const bool isFwd = p.dir == TRANSFORM_DIR_FORWARD;
+
+    ApplyToneChannelSoA(rgb, channel, [&p, channel, isFwd](const V & t, bool isMaster)
+    {
+        return isFwd ? MidsFwdSoA(p, channel, t, isMaster) : MidsRevSoA(p, channel, t, isMaster);
+    });
+}
+
+template<typename V>
+V SContrastFwdSoA(const GradingToneSIMDParams & p, const V & t)
+{
+    V outColor = (t - p.pivot) * p.scontrast + p.pivot;
+
+    // Top end
+    {
+        const float x1 = p.scX[0][1];
+        const float x2 = p.scX[0][2];
+        const float y1 = p.scY[0][1];
+        const float y2 = p.scY[0][2];
+        const float m0 = p.scM[0][0];
+        const float m3 = p.scM[0][1];
+
+        const V tR  = (t - x1) / (x2 - x1);
+        const V res = tR * (x2 - x1) * ( tR * 0.5f * (m3 - m0) + m0 ) + y1;
+
+        outColor = Select(t < x1, outColor, res);
+        outColor = Select(t < x2, outColor, y2 + (t - x2) * m3);
+    }
+
+    // Bottom end
+    {
+        const float x1 = p.scX[1][1];
+        const float x2 = p.scX[1][2];
+        const float y1 = p.scY[1][1];
+        const float m0 = p.scM[1][0];
+        const float m3 = p.scM[1][1];
+
+        const V tR  = (t - x1) / (x2 - x1);
+        const V res = tR * (x2 - x1) * (tR * 0.5f * (m3 - m0) + m0) + y1;
+
+        outColor = Select(t < x2, res, outColor);
+        outColor = Select(t < x1, y1 + (t - x1) * m0, outColor);
+    }
+
+    return outColor;
+}
+
+template<typename V>
+V SContrastRevSoA(const GradingToneSIMDParams & p, const V & t)
+{
+    V outColor = (t - p.pivot) / p.scontrast + p.pivot;
+
+    // Top end
+    {
+        const float x1 = p.scX[0][1];
+        const float x2 = p.scX[0][2];
+        const float y1 = p.scY[0][1];
+        const float y2 = p.scY[0][2];
+        const float m0 = p.scM[0][0];
+        const float m3 = p.scM[0][1];
+
+        const float b = m0 * (x2 - x1);
+        const float a = (m3 - m0) * 0.5f * (x2 - x1);
+        const V c = y1 - t;
+        const V discrim = Sqrt(b * b - 4.f * a * c);
+        const V res = (x2 - x1) * (-2.f * c) / (discrim + b) + x1;
+
+        outColor = Select(t < y1, outColor, res);
+        outColor = Select(t < y2, outColor, x2 + (t - y2) / m3);
+    }
+
+    // Bottom end
+    {
+        const float x1 = p.scX[1][1];
+        const float x2 = p.scX[1][2];
+        const float y1 = p.scY[1][1];
+        const float y2 = p.scY[1][2];
+        const float m0 = p.scM[1][0];
+        const float m3 = p.scM[1][1];
+
+        const float b = m0 * (x2 - x1);
+        const float a = (m3 - m0) * 0.5f * (x2 - x1);
+        const V c = y1 - t;
+        const V discrim = Sqrt(b * b - 4.f * a * c);
+        const V res = (x2 - x1) * (-2.f * c) / (discrim + b) + x1;
+
+        outColor = Select(t < y2, res, outColor);
+        outColor = Select(t < y1, x1 + (t - y1) / m0, outColor);
+    }
+
+    return outColor;
+}
+
+// Same as the SSE versions of LinLog & LogLin of GradingToneOpCPU.cpp.
+
+template<typename V>
+inline V ToneLinLogSoA(const V & pix)
+{
+    constexpr float xbrk = 0.0041318374739483946f;
+    constexpr float shift = -0.000157849851665374f;
+    constexpr float m = 1.f / (0.18f + shift);
+    constexpr float gain = 363.034608563f;
+    constexpr float offs = -7.f;
+
+    return Select(pix > xbrk, Log2((pix + shift) * m), pix * gain + offs);
+}
+
+template<typename V>
+inline V ToneLogLinSoA(const V & pix)
+{
+    constexpr float shift = -0.000157849851665374f;
+    constexpr float gain = 363.034608563f;
+    constexpr float offs = -7.f;
+    constexpr float ybrk = -5.5f;
+
+    return Select(pix > ybrk, Exp2(pix) * (0.18f + shift) - shift, (pix - offs) * (1.f / gain));
+}
+
+template<typename Ops>
+void ApplyGradingTone(const GradingToneSIMDParams & p, const float * in, float * out, long numPixels)
+{
+    typedef SIMDFloat<Ops> V;
+
+    constexpr int R = 0, G = 1, B = 2, M = 3;
+
+    if (p.dir == TRANSFORM_DIR_FORWARD)
+    {
+        ApplyRGBASoA<Ops>(in, out, numPixels, [&p](V & r, V & g, V & b)
+        {
+            V rgb[3] = { r, g, b };
+
+            if (p.isLinear)
+            {
+                for (int c = 0; c < 3; ++c) rgb[c] = ToneLinLogSoA(rgb[c]);
+            }
+
+            for (int channel : { R, G, B, M }) MidsSoA(p, channel, rgb);
+            for (int channel : { R, G, B, M }) HighlightShadowSoA(p, channel, false, rgb);
+            for (int channel : { R, G, B, M }) WhiteBlackSoA(p, channel, false, rgb);
+            for (int channel : { R, G, B, M }) HighlightShadowSoA(p, channel, true, rgb);
+            for (int channel : { R, G, B, M }) WhiteBlackSoA(p, channel, true, rgb);
+
+            if (p.applySContrast)
+            {
+                for (int c = 0; c < 3; ++c) rgb[c] = SContrastFwdSoA(p, rgb[c]);
+            }
+
+            if (p.isLinear)
+            {
+                for (int c = 0; c < 3; ++c) rgb[c] = ToneLogLinSoA(rgb[c]);
+            }
+
+            r = Min(rgb[0], 65504.f);
+            g = Min(rgb[1], 65504.f);
+            b = Min(rgb[2], 65504.f);
+        });
+    }
+    else
+    {
+        ApplyRGBASoA<Ops>(in, out, numPixels, [&p](V & r, V & g, V & b)
+        {
+            V rgb[3] = { r, g, b };
+
+            if (p.isLinear)
+            {
+                for (int c = 0; c < 3; ++c) rgb[c] = ToneLinLogSoA(rgb[c]);
+            }
+
+            if (p.applySContrast)
+            {
+                for (int c = 0; c < 3; ++c) rgb[c] = SContrastRevSoA(p, rgb[c]);
+            }
+
+            for (int channel : { M, R, G, B }) WhiteBlackSoA(p, channel, true, rgb);
+            for (int channel : { M, R, G, B }) HighlightShadowSoA(p, channel, true, rgb);
+            for (int channel : { M, R, G, B }) WhiteBlackSoA(p, channel, false, rgb);
+            for (int channel : { M, R, G, B }) HighlightShadowSoA(p, channel, false, rgb);
+            for (int channel : { M, R, G, B }) MidsSoA(p, channel, rgb);
+
+            if (p.isLinear)
+            {
+                for (int c = 0; c < 3; ++c) rgb[c] = ToneLogLinSoA(rgb[c]);
+            }
+
+            r = Min(rgb[0], 65504.f);
+            g = Min(rgb[1], 65504.f);
+            b = Min(rgb[2], 65504.f);
+        });
+    }
+}
+
+} // namespace OCIO_NAMESPACE
+
+#endif /* INCLUDED_OCIO_GRADINGTONE_CPU_SIMD_H */
@@ -76,7 +76,7 @@ bool GradingToneOpData::isIdentity() const
 {
     if (isDynamic()) return false;
 
-    auto & value = m_value->getValue();
+    const GradingTone value = m_value->getValue();
 
     return IsIdentity(value);
 }
@@ -105,26 +105,23 @@ GradingToneOpDataRcPtr GradingToneOpData::inverse() const
     return res;
 }
 
-std::string GradingToneOpData::getCacheID() const
+void GradingToneOpData::writeCacheID(std::ostream & os) const
 {
     AutoMutex lock(m_mutex);
 
-    std::ostringstream cacheIDStream;
     if (!getID().empty())
     {
-        cacheIDStream << getID() << " ";
+        os << getID() << " ";
     }
 
-    cacheIDStream.precision(DefaultValues::FLOAT_DECIMALS);
+    os.precision(DefaultValues::FLOAT_DECIMALS);
 
-    cacheIDStream << GradingStyleToString(getStyle()) << " ";
-    cacheIDStream << TransformDirectionToString(getDirection()) << " ";
+    os << GradingStyleToString(getStyle()) << " ";
+    os << TransformDirectionToString(getDirection()) << " ";
     if (!isDynamic())
     {
-        cacheIDStream << m_value->getValue();
+        os << m_value->getValue();
     }
-
-    return cacheIDStream.str();
 }
 
 void GradingToneOpData::setStyle(GradingStyle style) noexcept
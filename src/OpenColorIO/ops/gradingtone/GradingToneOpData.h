@@ -48,12 +48,12 @@ public:
     bool isInverse(ConstGradingToneOpDataRcPtr & r) const;
     GradingToneOpDataRcPtr inverse() const;
 
-    std::string getCacheID() const override;
+    void writeCacheID(std::ostream & os) const override;
 
     GradingStyle getStyle() const noexcept { return m_style; }
     void setStyle(GradingStyle style) noexcept;
 
-    const GradingTone & getValue() const { return m_value->getValue(); }
+    GradingTone getValue() const { return m_value->getValue(); }
     void setValue(const GradingTone & values) { m_value->setValue(values); }
 
     TransformDirection getDirection() const noexcept;
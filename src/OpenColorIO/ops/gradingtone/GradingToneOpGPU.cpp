@@ -141,19 +141,18 @@ void AddGTProperties(GpuShaderCreatorRcPtr & shaderCreator,
         DynamicPropertyGradingToneImplRcPtr shaderProp = prop->createEditableCopy();
         DynamicPropertyRcPtr newProp = shaderProp;
         shaderCreator->addDynamicProperty(newProp);
+        DynamicPropertyGradingToneImpl * toneProp = shaderProp.get();
 
-        // Use the shader dynamic property to bind the uniforms.
-        const auto & value = shaderProp->getValue();
-        using CompVal = GradingTonePreRender;
-        const auto & compVal = shaderProp->getComputedValue();
+        // Use the shader dynamic property to bind the uniforms. Note that the getters read the
+        // current value of the property as a setValue() call publishes a new one.
 
         // Add uniforms if they are not already there.
-        auto getBDR = std::bind(&GradingRGBMSW::m_red,    &value.m_blacks);
-        auto getBDG = std::bind(&GradingRGBMSW::m_green,  &value.m_blacks);
-        auto getBDB = std::bind(&GradingRGBMSW::m_blue,   &value.m_blacks);
-        auto getBDM = std::bind(&GradingRGBMSW::m_master, &value.m_blacks);
-        auto getBDS = std::bind(&CompVal::m_blacksStart, &compVal);
-        auto getBDW = std::bind(&CompVal::m_blacksWidth, &compVal);
+        auto getBDR = [toneProp]() { return toneProp->getValue().m_blacks.m_red; };
+        auto getBDG = [toneProp]() { return toneProp->getValue().m_blacks.m_green; };
+        auto getBDB = [toneProp]() { return toneProp->getValue().m_blacks.m_blue; };
+        auto getBDM = [toneProp]() { return toneProp->getValue().m_blacks.m_master; };
+        auto getBDS = [toneProp]() { return toneProp->getComputedValue()->m_blacksStart; };
+        auto getBDW = [toneProp]() { return toneProp->getComputedValue()->m_blacksWidth; };
         AddUniform(shaderCreator, getBDR, propNames.blacksR);
         AddUniform(shaderCreator, getBDG, propNames.blacksG);
         AddUniform(shaderCreator, getBDB, propNames.blacksB);
@@ -161,12 +160,12 @@ void AddGTProperties(GpuShaderCreatorRcPtr & shaderCreator,
         AddUniform(shaderCreator, getBDS, propNames.blacksS);
         AddUniform(shaderCreator, getBDW, propNames.blacksW);
 
-        auto getSR = std::bind(&GradingRGBMSW::m_red,    &value.m_shadows);
-        auto getSG = std::bind(&GradingRGBMSW::m_green,  &value.m_shadows);
-        auto getSB = std::bind(&GradingRGBMSW::m_blue,   &value.m_shadows);
-        auto getSM = std::bind(&GradingRGBMSW::m_master, &value.m_shadows);
-        auto getSS = std::bind(&CompVal::m_shadowsStart, &compVal);
-        auto getSW = std::bind(&CompVal::m_shadowsWidth, &compVal);
+        auto getSR = [toneProp]() { return toneProp->getValue().m_shadows.m_red; };
+        auto getSG = [toneProp]() { return toneProp->getValue().m_shadows.m_green; };
+        auto getSB = [toneProp]() { return toneProp->getValue().m_shadows.m_blue; };
+        auto getSM = [toneProp]() { return toneProp->getValue().m_shadows.m_master; };
+        auto getSS = [toneProp]() { return toneProp->getComputedValue()->m_shadowsStart; };
+        auto getSW = [toneProp]() { return toneProp->getComputedValue()->m_shadowsWidth; };
         AddUniform(shaderCreator, getSR, propNames.shadowsR);
         AddUniform(shaderCreator, getSG, propNames.shadowsG);
         AddUniform(shaderCreator, getSB, propNames.shadowsB);
@@ -174,12 +173,12 @@ void AddGTProperties(GpuShaderCreatorRcPtr & shaderCreator,
         AddUniform(shaderCreator, getSS, propNames.shadowsS);
         AddUniform(shaderCreator, getSW, propNames.shadowsW);
 
-        auto getMR = std::bind(&GradingRGBMSW::m_red,    &value.m_midtones);
-        auto getMG = std::bind(&GradingRGBMSW::m_green,  &value.m_midtones);
-        auto getMB = std::bind(&GradingRGBMSW::m_blue,   &value.m_midtones);
-        auto getMM = std::bind(&GradingRGBMSW::m_master, &value.m_midtones);
-        auto getMS = std::bind(&GradingRGBMSW::m_start,  &value.m_midtones);
-        auto getMW = std::bind(&GradingRGBMSW::m_width,  &value.m_midtones);
+        auto getMR = [toneProp]() { return toneProp->getValue().m_midtones.m_red; };
+        auto getMG = [toneProp]() { return toneProp->getValue().m_midtones.m_green; };
+        auto getMB = [toneProp]() { return toneProp->getValue().m_midtones.m_blue; };
+        auto getMM = [toneProp]() { return toneProp->getValue().m_midtones.m_master; };
+        auto getMS = [toneProp]() { return toneProp->getValue().m_midtones.m_start; };
+        auto getMW = [toneProp]() { return toneProp->getValue().m_midtones.m_width; };
         AddUniform(shaderCreator, getMR, propNames.midtonesR);
         AddUniform(shaderCreator, getMG, propNames.midtonesG);
         AddUniform(shaderCreator, getMB, propNames.midtonesB);
@@ -187,12 +186,12 @@ void AddGTProperties(GpuShaderCreatorRcPtr & shaderCreator,
         AddUniform(shaderCreator, getMS, propNames.midtonesS);
         AddUniform(shaderCreator, getMW, propNames.midtonesW);
 
-        auto getHR = std::bind(&GradingRGBMSW::m_red,    &value.m_highlights);
-        auto getHG = std::bind(&GradingRGBMSW::m_green,  &value.m_highlights);
-        auto getHB = std::bind(&GradingRGBMSW::m_blue,   &value.m_highlights);
-        auto getHM = std::bind(&GradingRGBMSW::m_master, &value.m_highlights);
-        auto getHS = std::bind(&CompVal::m_highlightsStart, &compVal);
-        auto getHW = std::bind(&CompVal::m_highlightsWidth, &compVal);
+        auto getHR = [toneProp]() { return toneProp->getValue().m_highlights.m_red; };
+        auto getHG = [toneProp]() { return toneProp->getValue().m_highlights.m_green; };
+        auto getHB = [toneProp]() { return toneProp->getValue().m_highlights.m_blue; };
+        auto getHM = [toneProp]() { return toneProp->getValue().m_highlights.m_master; };
+        auto getHS = [toneProp]() { return toneProp->getComputedValue()->m_highlightsStart; };
+        auto getHW = [toneProp]() { return toneProp->getComputedValue()->m_highlightsWidth; };
         AddUniform(shaderCreator, getHR, propNames.highlightsR);
         AddUniform(shaderCreator, getHG, propNames.highlightsG);
         AddUniform(shaderCreator, getHB, propNames.highlightsB);
@@ -200,12 +199,12 @@ void AddGTProperties(GpuShaderCreatorRcPtr & shaderCreator,
         AddUniform(shaderCreator, getHS, propNames.highlightsS);
         AddUniform(shaderCreator, getHW, propNames.highlightsW);
 
-        auto getWDR = std::bind(&GradingRGBMSW::m_red,    &value.m_whites);
-        auto getWDG = std::bind(&GradingRGBMSW::m_green,  &value.m_whites);
-        auto getWDB = std::bind(&GradingRGBMSW::m_blue,   &value.m_whites);
-        auto getWDM = std::bind(&GradingRGBMSW::m_master, &value.m_whites);
-        auto getWDS = std::bind(&CompVal::m_whitesStart, &compVal);
-        auto getWDW = std::bind(&CompVal::m_whitesWidth, &compVal);
+        auto getWDR = [toneProp]() { return toneProp->getValue().m_whites.m_red; };
+        auto getWDG = [toneProp]() { return toneProp->getValue().m_whites.m_green; };
+        auto getWDB = [toneProp]() { return toneProp->getValue().m_whites.m_blue; };
+        auto getWDM = [toneProp]() { return toneProp->getValue().m_whites.m_master; };
+        auto getWDS = [toneProp]() { return toneProp->getComputedValue()->m_whitesStart; };
+        auto getWDW = [toneProp]() { return toneProp->getComputedValue()->m_whitesWidth; };
         AddUniform(shaderCreator, getWDR, propNames.whitesR);
         AddUniform(shaderCreator, getWDG, propNames.whitesG);
         AddUniform(shaderCreator, getWDB, propNames.whitesB);
@@ -213,16 +212,17 @@ void AddGTProperties(GpuShaderCreatorRcPtr & shaderCreator,
         AddUniform(shaderCreator, getWDS, propNames.whitesS);
         AddUniform(shaderCreator, getWDW, propNames.whitesW);
 
-        auto getSC = std::bind(&GradingTone::m_scontrast, &value);
+        auto getSC = [toneProp]() { return toneProp->getValue().m_scontrast; };
         AddUniform(shaderCreator, getSC, propNames.sContrast);
 
-        auto getLB = std::bind(&DynamicPropertyGradingToneImpl::getLocalBypass, shaderProp.get());
+        auto getLB = std::bind(&DynamicPropertyGradingToneImpl::getLocalBypass, toneProp);
         AddBoolUniform(shaderCreator, getLB, propNames.localBypass);
     }
     else
     {
-        const auto & value = prop->getValue();
-        const auto & compVal = prop->getComputedValue();
+        const GradingTone value = prop->getValue();
+        const ConstGradingTonePreRenderRcPtr compValPtr = prop->getComputedValue();
+        const GradingTonePreRender & compVal = *compValPtr;
 
         st.declareVarConst(propNames.blacksR, static_cast<float>(value.m_blacks.m_red));
         st.declareVarConst(propNames.blacksG, static_cast<float>(value.m_blacks.m_green));
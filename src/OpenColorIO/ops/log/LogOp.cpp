@@ -40,7 +40,7 @@ public:
 
     bool isSameType(ConstOpRcPtr & op) const override;
     bool isInverse(ConstOpRcPtr & op) const override;
-    std::string getCacheID() const override;
+    void writeCacheID(std::ostream & os) const override;
 
     ConstOpCPURcPtr getCPUOp(bool fastLogExpPow) const override;
 
@@ -93,15 +93,12 @@ bool LogOp::isInverse(ConstOpRcPtr & op) const
     return logData()->isInverse(logOpData);
 }
 
-std::string LogOp::getCacheID() const
+void LogOp::writeCacheID(std::ostream & os) const
 {
     // Create the cacheID.
-    std::ostringstream cacheIDStream;
-    cacheIDStream << "<LogOp ";
-    cacheIDStream << logData()->getCacheID();
-    cacheIDStream << ">";
-
-    return cacheIDStream.str();
+    os << "<LogOp ";
+    logData()->writeCacheID(os);
+    os << ">";
 }
 
 ConstOpCPURcPtr LogOp::getCPUOp(bool fastLogExpPow) const
@@ -59,6 +59,30 @@ void ValidateParams(const LogOpData::Params & params, TransformDirection /* dire
         throw Exception(oss.str().c_str());
     }
 }
+
+template <int index>
+void writeParameter(std::ostream & os, const LogOpData & log)
+{
+    static_assert(index >= 0 && index < 6, "Index has to be in [0..5]");
+
+    if (index < log.getRedParams().size())
+    {
+        if (log.allComponentsEqual())
+        {
+            os << log.getRedParams()[index];
+        }
+        else
+        {
+            os << log.getRedParams()[index] << ", ";
+            os << log.getGreenParams()[index] << ", ";
+            os << log.getBlueParams()[index];
+        }
+    }
+    else
+    {
+        throw Exception("Log: accessing parameter that does not exist.");
+    }
+}
 }
 
 LogOpData::LogOpData(double base, TransformDirection direction)
@@ -296,32 +320,38 @@ bool LogOpData::isNoOp() const
     return false;
 }
 
-std::string LogOpData::getCacheID() const
+void LogOpData::writeCacheID(std::ostream & os) const
 {
     AutoMutex lock(m_mutex);
 
-    std::ostringstream cacheIDStream;
     if (!getID().empty())
     {
-        cacheIDStream << getID() << " ";
+        os << getID() << " ";
     }
 
-    cacheIDStream << TransformDirectionToString(m_direction) << " ";
+    os << TransformDirectionToString(m_direction) << " ";
+
+    os.precision(DefaultValues::FLOAT_DECIMALS);
 
-    cacheIDStream << "Base "          << getBaseString(DefaultValues::FLOAT_DECIMALS)      << " ";
-    cacheIDStream << "LogSideSlope "  << getLogSlopeString(DefaultValues::FLOAT_DECIMALS)  << " ";
-    cacheIDStream << "LogSideOffset " << getLogOffsetString(DefaultValues::FLOAT_DECIMALS) << " ";
-    cacheIDStream << "LinSideSlope "  << getLinSlopeString(DefaultValues::FLOAT_DECIMALS)  << " ";
-    cacheIDStream << "LinSideOffset " << getLinOffsetString(DefaultValues::FLOAT_DECIMALS);
+    os << "Base " << getBase();
+    os << " LogSideSlope ";
+    writeParameter<LOG_SIDE_SLOPE>(os, *this);
+    os << " LogSideOffset ";
+    writeParameter<LOG_SIDE_OFFSET>(os, *this);
+    os << " LinSideSlope ";
+    writeParameter<LIN_SIDE_SLOPE>(os, *this);
+    os << " LinSideOffset ";
+    writeParameter<LIN_SIDE_OFFSET>(os, *this);
     if (m_redParams.size() > 4)
     {
-        cacheIDStream << " LinSideBreak " << getLinBreakString(DefaultValues::FLOAT_DECIMALS);
+        os << " LinSideBreak ";
+        writeParameter<LIN_SIDE_BREAK>(os, *this);
         if (m_redParams.size() > 5)
         {
-            cacheIDStream << " LinearSlope " << getLinearSlopeString(DefaultValues::FLOAT_DECIMALS);
+            os << " LinearSlope ";
+            writeParameter<LINEAR_SLOPE>(os, *this);
         }
     }
-    return cacheIDStream.str();
 }
 
 bool LogOpData::equals(const OpData& other) const
@@ -389,27 +419,9 @@ bool LogOpData::allComponentsEqual() const
 template <int index>
 std::string getParameterString(const LogOpData & log, std::streamsize precision)
 {
-    static_assert(index >= 0 && index < 6, "Index has to be in [0..5]");
     std::ostringstream o;
     o.precision(precision);
-
-    if (index < log.getRedParams().size())
-    {
-        if (log.allComponentsEqual())
-        {
-            o << log.getRedParams()[index];
-        }
-        else
-        {
-            o << log.getRedParams()[index] << ", ";
-            o << log.getGreenParams()[index] << ", ";
-            o << log.getBlueParams()[index];
-        }
-    }
-    else
-    {
-        throw Exception("Log: accessing parameter that does not exist.");
-    }
+    writeParameter<index>(o, log);
     return o.str();
 }
 
@@ -75,7 +75,7 @@ public:
 
     bool hasChannelCrosstalk() const override { return false; }
 
-    std::string getCacheID() const override;
+    void writeCacheID(std::ostream & os) const override;
 
     bool equals(const OpData& other) const override;
 
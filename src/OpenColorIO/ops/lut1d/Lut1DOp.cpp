@@ -47,7 +47,7 @@ public:
     void combineWith(OpRcPtrVec & ops, ConstOpRcPtr & secondOp) const override;
     bool hasChannelCrosstalk() const override;
     void finalize() override;
-    std::string getCacheID() const override;
+    void writeCacheID(std::ostream & os) const override;
 
     ConstOpCPURcPtr getCPUOp(bool fastLogExpPow) const override;
 
@@ -137,15 +137,12 @@ void Lut1DOp::finalize()
     lut1DData()->finalize();
 }
 
-std::string Lut1DOp::getCacheID() const
+void Lut1DOp::writeCacheID(std::ostream & os) const
 {
     // Rebuild the cache identifier.
-    std::ostringstream cacheIDStream;
-    cacheIDStream << "<Lut1D ";
-    cacheIDStream << lut1DData()->getCacheID();
-    cacheIDStream << ">";
-
-    return cacheIDStream.str();
+    os << "<Lut1D ";
+    lut1DData()->writeCacheID(os);
+    os << ">";
 }
 
 ConstOpCPURcPtr Lut1DOp::getCPUOp(bool /*fastLogExpPow*/) const
@@ -223,6 +223,9 @@ public:
     virtual void updateData(ConstLut1DOpDataRcPtr & lut);
 
 protected:
+    // Copy the component parameters for the vectorized inverse evaluation.
+    void updateInvParams(bool halfDomain);
+
     float m_scale; // Output scaling for the r, g and b components.
 
     ComponentParams m_paramsR;
@@ -234,6 +237,9 @@ protected:
     std::vector<float> m_tmpLutG;
     std::vector<float> m_tmpLutB;
     float              m_alphaScaling;  // Bit-depth scale factor for alpha channel.
+
+    InvLut1DParams           m_invParams;
+    InvLut1DOpCPUApplyFunc * m_applyInvLutFunc;
 };
 
 template<BitDepth inBD, BitDepth outBD>
@@ -998,7 +1004,7 @@ void Lut1DRendererHueAdjust<inBD, outBD>::apply(const void * inImg, void * outIm
 
 namespace
 {
-// TODO: Use SSE intrinsics to speed this up.
+// Note: Refer to Lut1DOpCPU_InvSearch.h for the vectorized versions.
 
 // Calculate the inverse of a value resulting from linear interpolation
 // in a 1d LUT.
@@ -1127,6 +1133,26 @@ float FindLutInvHalf(const float * start,
     // Scale converts from units of [0,dim] to [0,outDepth].
     return domain * scale;
 }
+
+// The float values of all the half bit patterns, to convert the indices of the half domain
+// LUTs in the vectorized inverse evaluation.
+const float * GetHalfToFloatTable()
+{
+    static const std::vector<float> table = []()
+    {
+        std::vector<float> values(65536);
+
+        half h;
+        for (unsigned i = 0; i < 65536; ++i)
+        {
+            h.setBits((unsigned short)i);
+            values[i] = h;
+        }
+        return values;
+    }();
+
+    return table.data();
+}
 }
 
 template<BitDepth inBD, BitDepth outBD>
@@ -1134,8 +1160,34 @@ InvLut1DRenderer<inBD, outBD>::InvLut1DRenderer(ConstLut1DOpDataRcPtr & lut)
     :   OpCPU()
     ,   m_dim(0)
     ,   m_alphaScaling(0.0f)
+    ,   m_applyInvLutFunc(nullptr)
 {
     updateData(lut);
+
+    // The vectorized inverse evaluation only processes float images.
+    if (inBD == BIT_DEPTH_F32 && outBD == BIT_DEPTH_F32)
+    {
+#if OCIO_USE_SSE2
+        if (CPUInfo::instance().hasSSE2())
+        {
+            m_applyInvLutFunc = applyInvLut1DSSE2;
+        }
+#endif
+
+#if OCIO_USE_AVX2
+        if (CPUInfo::instance().hasAVX2() && !CPUInfo::instance().AVX2SlowGather())
+        {
+            m_applyInvLutFunc = applyInvLut1DAVX2;
+        }
+#endif
+
+#if OCIO_USE_AVX512
+        if (CPUInfo::instance().hasAVX512())
+        {
+            m_applyInvLutFunc = applyInvLut1DAVX512;
+        }
+#endif
+    }
 }
 
 template<BitDepth inBD, BitDepth outBD>
@@ -1235,6 +1287,40 @@ void InvLut1DRenderer<inBD, outBD>::updateData(ConstLut1DOpDataRcPtr & lut)
     // Converts from index units to inDepth units of the original LUT.
     // (Note that inDepth of the original LUT is outDepth of the inverse LUT.)
     m_scale = outMax / (float) (m_dim - 1);
+
+    updateInvParams(false);
+}
+
+template<BitDepth inBD, BitDepth outBD>
+void InvLut1DRenderer<inBD, outBD>::updateInvParams(bool halfDomain)
+{
+    const ComponentParams * params[3] = { &m_paramsR, &m_paramsG, &m_paramsB };
+
+    for (int c = 0; c < 3; ++c)
+    {
+        InvLut1DChannel & channel = m_invParams.channels[c];
+
+        channel.pos.lutStart    = params[c]->lutStart;
+        channel.pos.lutEnd      = params[c]->lutEnd;
+        channel.pos.startOffset = params[c]->startOffset;
+        channel.pos.flipSign    = params[c]->flipSign;
+
+        channel.neg.lutStart    = params[c]->negLutStart;
+        channel.neg.lutEnd      = params[c]->negLutEnd;
+        channel.neg.startOffset = params[c]->negStartOffset;
+        channel.neg.flipSign    = -params[c]->flipSign;
+
+        channel.bisectPoint  = params[c]->bisectPoint;
+        channel.isIncreasing = params[c]->flipSign > 0.f;
+    }
+
+    // Same as InvLut1DRendererHalfCode::apply(), the negative half domain of the blue
+    // component uses the red flip sign.
+    m_invParams.channels[2].neg.flipSign = -m_paramsR.flipSign;
+
+    m_invParams.scale        = m_scale;
+    m_invParams.alphaScaling = m_alphaScaling;
+    m_invParams.halfToFloat  = halfDomain ? GetHalfToFloatTable() : nullptr;
 }
 
 template<BitDepth inBD, BitDepth outBD>
@@ -1243,6 +1329,12 @@ void InvLut1DRenderer<inBD, outBD>::apply(const void * inImg, void * outImg, lon
     typedef typename BitDepthInfo<inBD>::Type InType;
     typedef typename BitDepthInfo<outBD>::Type OutType;
 
+    if (m_applyInvLutFunc)
+    {
+        m_applyInvLutFunc(m_invParams, (const float *)inImg, (float *)outImg, numPixels);
+        return;
+    }
+
     const InType * in = (InType *)inImg;
     OutType * out = (OutType *)outImg;
 
@@ -1446,6 +1538,8 @@ void InvLut1DRendererHalfCode<inBD, outBD>::updateData(ConstLut1DOpDataRcPtr & l
     // between adjacent entries is not constant, we cannot roll it into the
     // scale.
     this->m_scale = outMax;
+
+    this->updateInvParams(true);
 }
 
 template<BitDepth inBD, BitDepth outBD>
@@ -1454,6 +1548,12 @@ void InvLut1DRendererHalfCode<inBD, outBD>::apply(const void * inImg, void * out
     typedef typename BitDepthInfo<inBD>::Type InType;
     typedef typename BitDepthInfo<outBD>::Type OutType;
 
+    if (this->m_applyInvLutFunc)
+    {
+        this->m_applyInvLutFunc(this->m_invParams, (const float *)inImg, (float *)outImg, numPixels);
+        return;
+    }
+
     const InType * in = (InType *)inImg;
     OutType * out = (OutType *)outImg;
 
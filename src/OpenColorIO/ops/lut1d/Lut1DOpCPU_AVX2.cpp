@@ -146,6 +146,49 @@ inline Lut1DOpCPUApplyFunc * GetConvertInBitDepth(BitDepth outBD)
     return nullptr;
 }
 
+struct InvLut1DOpsAVX2
+{
+    typedef __m256  Float;
+    typedef __m256i Int;
+    typedef __m256  Mask;
+
+    static constexpr unsigned size = 8;
+
+    static inline Float load(const float * src) { return _mm256_load_ps(src); }
+    static inline void store(float * dst, Float v) { _mm256_store_ps(dst, v); }
+
+    static inline Float set1(float v) { return _mm256_set1_ps(v); }
+    static inline Int iset1(int v) { return _mm256_set1_epi32(v); }
+
+    static inline Float min(Float a, Float b) { return _mm256_min_ps(a, b); }
+    static inline Float max(Float a, Float b) { return _mm256_max_ps(a, b); }
+    static inline Float add(Float a, Float b) { return _mm256_add_ps(a, b); }
+    static inline Float sub(Float a, Float b) { return _mm256_sub_ps(a, b); }
+    static inline Float mul(Float a, Float b) { return _mm256_mul_ps(a, b); }
+    static inline Float div(Float a, Float b) { return _mm256_div_ps(a, b); }
+    static inline Int iadd(Int a, Int b) { return _mm256_add_epi32(a, b); }
+
+    static inline Float cvt(Int v) { return _mm256_cvtepi32_ps(v); }
+    static inline Int cvtt(Float v) { return _mm256_cvttps_epi32(v); }
+
+    static inline Float gather(const float * src, Int idx) { return _mm256_i32gather_ps(src, idx, 4); }
+
+    static inline Mask lt(Float a, Float b) { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+    static inline Mask gt(Float a, Float b) { return _mm256_cmp_ps(a, b, _CMP_GT_OQ); }
+    static inline Mask ge(Float a, Float b) { return _mm256_cmp_ps(a, b, _CMP_GE_OQ); }
+    static inline Mask maskNot(Mask m) { return _mm256_xor_ps(m, _mm256_castsi256_ps(_mm256_set1_epi32(-1))); }
+    static inline bool any(Mask m) { return _mm256_movemask_ps(m) != 0; }
+    static inline bool all(Mask m) { return _mm256_movemask_ps(m) == 0xff; }
+
+    static inline Float select(Mask m, Float a, Float b) { return _mm256_blendv_ps(b, a, m); }
+
+    static inline Int iselect(Mask m, Int a, Int b)
+    {
+        return _mm256_castps_si256(
+            _mm256_blendv_ps(_mm256_castsi256_ps(b), _mm256_castsi256_ps(a), m));
+    }
+};
+
 } // anonymous namespace
 
 Lut1DOpCPUApplyFunc * AVX2GetLut1DApplyFunc(BitDepth inBD, BitDepth outBD)
@@ -172,6 +215,11 @@ Lut1DOpCPUApplyFunc * AVX2GetLut1DApplyFunc(BitDepth inBD, BitDepth outBD)
     return nullptr;
 }
 
+void applyInvLut1DAVX2(const InvLut1DParams & params, const float * src, float * dst, long numPixels)
+{
+    ApplyInvLut1D<InvLut1DOpsAVX2>(params, src, dst, numPixels);
+}
+
 } // OCIO_NAMESPACE
 
 #endif // OCIO_USE_AVX2
\ No newline at end of file
@@ -119,6 +119,44 @@ inline Lut1DOpCPUApplyFunc * GetConvertInBitDepth(BitDepth outBD)
     return nullptr;
 }
 
+struct InvLut1DOpsAVX512
+{
+    typedef __m512    Float;
+    typedef __m512i   Int;
+    typedef __mmask16 Mask;
+
+    static constexpr unsigned size = 16;
+
+    static inline Float load(const float * src) { return _mm512_load_ps(src); }
+    static inline void store(float * dst, Float v) { _mm512_store_ps(dst, v); }
+
+    static inline Float set1(float v) { return _mm512_set1_ps(v); }
+    static inline Int iset1(int v) { return _mm512_set1_epi32(v); }
+
+    static inline Float min(Float a, Float b) { return _mm512_min_ps(a, b); }
+    static inline Float max(Float a, Float b) { return _mm512_max_ps(a, b); }
+    static inline Float add(Float a, Float b) { return _mm512_add_ps(a, b); }
+    static inline Float sub(Float a, Float b) { return _mm512_sub_ps(a, b); }
+    static inline Float mul(Float a, Float b) { return _mm512_mul_ps(a, b); }
+    static inline Float div(Float a, Float b) { return _mm512_div_ps(a, b); }
+    static inline Int iadd(Int a, Int b) { return _mm512_add_epi32(a, b); }
+
+    static inline Float cvt(Int v) { return _mm512_cvtepi32_ps(v); }
+    static inline Int cvtt(Float v) { return _mm512_cvttps_epi32(v); }
+
+    static inline Float gather(const float * src, Int idx) { return _mm512_i32gather_ps(idx, src, 4); }
+
+    static inline Mask lt(Float a, Float b) { return _mm512_cmp_ps_mask(a, b, _CMP_LT_OQ); }
+    static inline Mask gt(Float a, Float b) { return _mm512_cmp_ps_mask(a, b, _CMP_GT_OQ); }
+    static inline Mask ge(Float a, Float b) { return _mm512_cmp_ps_mask(a, b, _CMP_GE_OQ); }
+    static inline Mask maskNot(Mask m) { return _mm512_knot(m); }
+    static inline bool any(Mask m) { return m != 0; }
+    static inline bool all(Mask m) { return m == 0xffff; }
+
+    static inline Float select(Mask m, Float a, Float b) { return _mm512_mask_blend_ps(m, b, a); }
+    static inline Int iselect(Mask m, Int a, Int b) { return _mm512_mask_blend_epi32(m, b, a); }
+};
+
 } // anonymous namespace
 
 Lut1DOpCPUApplyFunc * AVX512GetLut1DApplyFunc(BitDepth inBD, BitDepth outBD)
@@ -145,6 +183,11 @@ Lut1DOpCPUApplyFunc * AVX512GetLut1DApplyFunc(BitDepth inBD, BitDepth outBD)
     return nullptr;
 }
 
+void applyInvLut1DAVX512(const InvLut1DParams & params, const float * src, float * dst, long numPixels)
+{
+    ApplyInvLut1D<InvLut1DOpsAVX512>(params, src, dst, numPixels);
+}
+
 } // OCIO_NAMESPACE
 
 #endif // OCIO_USE_AVX512
\ No newline at end of file
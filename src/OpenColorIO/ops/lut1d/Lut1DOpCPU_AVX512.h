@@ -7,6 +7,7 @@
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "CPUInfo.h"
+#include "ops/lut1d/Lut1DOpCPU_InvSearch.h"
 
 typedef void (Lut1DOpCPUApplyFunc)(const float *, const float *, const float *, int, const void *, void *, long);
 
@@ -16,6 +17,9 @@ namespace OCIO_NAMESPACE
 
 Lut1DOpCPUApplyFunc * AVX512GetLut1DApplyFunc(BitDepth inBD, BitDepth outBD);
 
+// Inverse LUT evaluation using a vectorized search (16 values at once).
+void applyInvLut1DAVX512(const InvLut1DParams & params, const float * src, float * dst, long numPixels);
+
 } // namespace OCIO_NAMESPACE
 
 #endif // OCIO_USE_AVX512
@@ -0,0 +1,192 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#ifndef INCLUDED_OCIO_LUT1DOP_CPU_INVSEARCH_H
+#define INCLUDED_OCIO_LUT1DOP_CPU_INVSEARCH_H
+
+#include <OpenColorIO/OpenColorIO.h>
+
+namespace OCIO_NAMESPACE
+{
+
+// Effective domain of an inverse 1D LUT channel (refer to FindLutInv() for details).
+struct InvLut1DSegment
+{
+    const float * lutStart = nullptr; // First effective LUT entry (in increasing order).
+    const float * lutEnd = nullptr;   // Last effective LUT entry.
+    float startOffset = 0.f;          // Difference between real and effective start of lut.
+    float flipSign = 1.f;             // Flip the sign of value to handle decreasing luts.
+};
+
+struct InvLut1DChannel
+{
+    InvLut1DSegment pos;      // The LUT or the positive part of a half domain LUT.
+    InvLut1DSegment neg;      // The negative part of a half domain LUT.
+    float bisectPoint = 0.f;  // Point of switching from pos to neg of half domain.
+    bool isIncreasing = true;
+};
+
+struct InvLut1DParams
+{
+    InvLut1DChannel channels[3];
+    float scale = 1.f;                   // From LUT index units to output values.
+    float alphaScaling = 1.f;
+    const float * halfToFloat = nullptr; // Float values of all the half bit patterns for a
+                                         // half domain LUT, nullptr otherwise.
+};
+
+typedef void (InvLut1DOpCPUApplyFunc)(const InvLut1DParams &, const float *, float *, long);
+
+// The vectorized inverse evaluation only depends on a few operations so the same algorithm is
+// instantiated for each instruction set, and each one gets its own instantiation. The Ops type
+// provides the Float, Int & Mask vector types of Ops::size lanes and the operations on them.
+// Note that the min() & max() operations must follow the SSE semantics (i.e. return the second
+// argument if one is a NaN).
+
+// Vectorized version of FindLutInv() & FindLutInvHalf() which produces identical results.
+template<typename Ops>
+typename Ops::Float FindLutInvVec(const InvLut1DSegment & segment,
+                                  const float scale,
+                                  const float * halfToFloat,
+                                  const typename Ops::Float & val)
+{
+    typedef typename Ops::Float Float;
+    typedef typename Ops::Int   Int;
+
+    const float * start = segment.lutStart;
+    const int numEntries = (int)(segment.lutEnd - segment.lutStart);
+
+    // Clamp the value to the range of the LUT (same as std::min(std::max(v, *start), *end)).
+    const Float cv = Ops::min(Ops::set1(*segment.lutEnd),
+                              Ops::max(Ops::set1(*start),
+                                       Ops::mul(val, Ops::set1(segment.flipSign))));
+
+    // Branchless std::lower_bound(start, end, cv): The number of steps only depends on the
+    // LUT length so all the lanes search at once.
+    Int base = Ops::iset1(0);
+    int length = numEntries;
+    while (length > 1)
+    {
+        const int half = length / 2;
+        const Int probe = Ops::iadd(base, Ops::iset1(half));
+        base = Ops::iselect(Ops::lt(Ops::gather(start, probe), cv), probe, base);
+        length -= half;
+    }
+    if (numEntries > 0)
+    {
+        const Int next = Ops::iadd(base, Ops::iset1(1));
+        base = Ops::iselect(Ops::lt(Ops::gather(start, base), cv), next, base);
+    }
+
+    // lower_bound() returns first entry >= val so decrement it unless val == *start.
+    const Float zero = Ops::set1(0.f);
+    const Int lowbound
+        = Ops::iselect(Ops::gt(Ops::cvt(base), zero), Ops::iadd(base, Ops::iset1(-1)), base);
+
+    const Int highbound
+        = Ops::iselect(Ops::lt(Ops::cvt(lowbound), Ops::set1((float)numEntries)),
+                       Ops::iadd(lowbound, Ops::iset1(1)), lowbound);
+
+    const Float lowVal  = Ops::gather(start, lowbound);
+    const Float highVal = Ops::gather(start, highbound);
+
+    // Delta is the fractional distance of val between the adjacent LUT entries (handle flat
+    // spots by leaving delta = 0).
+    const Float delta = Ops::select(Ops::gt(highVal, lowVal),
+                                    Ops::div(Ops::sub(cv, lowVal), Ops::sub(highVal, lowVal)),
+                                    zero);
+
+    const Float totalInds = Ops::add(Ops::cvt(lowbound), Ops::set1(segment.startOffset));
+
+    if (!halfToFloat)
+    {
+        return Ops::mul(Ops::add(totalInds, delta), Ops::set1(scale));
+    }
+
+    // For a half domain LUT, the entries are not a constant distance apart.
+    const Int halfInds = Ops::cvtt(totalInds);
+    const Float domainBase  = Ops::gather(halfToFloat, halfInds);
+    const Float domainBase1 = Ops::gather(halfToFloat, Ops::iadd(halfInds, Ops::iset1(1)));
+
+    const Float domain = Ops::add(domainBase, Ops::mul(delta, Ops::sub(domainBase1, domainBase)));
+
+    return Ops::mul(domain, Ops::set1(scale));
+}
+
+template<typename Ops>
+typename Ops::Float ApplyInvLut1DChannel(const InvLut1DParams & params,
+                                         const InvLut1DChannel & channel,
+                                         const typename Ops::Float & val)
+{
+    if (!params.halfToFloat)
+    {
+        return FindLutInvVec<Ops>(channel.pos, params.scale, nullptr, val);
+    }
+
+    // Test the values against the bisectPoint to determine which half of the float domain to
+    // do the inverse eval in.
+    typename Ops::Mask usePos = Ops::ge(val, Ops::set1(channel.bisectPoint));
+    if (!channel.isIncreasing)
+    {
+        usePos = Ops::maskNot(usePos);
+    }
+
+    // Only evaluate the needed halves.
+    if (Ops::all(usePos))
+    {
+        return FindLutInvVec<Ops>(channel.pos, params.scale, params.halfToFloat, val);
+    }
+    if (!Ops::any(usePos))
+    {
+        return FindLutInvVec<Ops>(channel.neg, params.scale, params.halfToFloat, val);
+    }
+
+    return Ops::select(usePos,
+                       FindLutInvVec<Ops>(channel.pos, params.scale, params.halfToFloat, val),
+                       FindLutInvVec<Ops>(channel.neg, params.scale, params.halfToFloat, val));
+}
+
+template<typename Ops>
+void ApplyInvLut1D(const InvLut1DParams & params, const float * src, float * dst, long numPixels)
+{
+    constexpr unsigned size = Ops::size;
+
+    alignas(64) float rgb[3][size];
+
+    for (long start = 0; start < numPixels; start += size)
+    {
+        const long remaining = numPixels - start;
+        const unsigned count = remaining < (long)size ? (unsigned)remaining : size;
+
+        // Pad the last packet with its last pixel.
+        for (unsigned lane = 0; lane < size; ++lane)
+        {
+            const float * in = src + 4 * (start + (lane < count ? lane : count - 1));
+            rgb[0][lane] = in[0];
+            rgb[1][lane] = in[1];
+            rgb[2][lane] = in[2];
+        }
+
+        for (unsigned c = 0; c < 3; ++c)
+        {
+            Ops::store(rgb[c], ApplyInvLut1DChannel<Ops>(params, params.channels[c],
+                                                         Ops::load(rgb[c])));
+        }
+
+        for (unsigned lane = 0; lane < count; ++lane)
+        {
+            const float * in = src + 4 * (start + lane);
+            float * out = dst + 4 * (start + lane);
+
+            const float alpha = in[3];
+            out[0] = rgb[0][lane];
+            out[1] = rgb[1][lane];
+            out[2] = rgb[2][lane];
+            out[3] = alpha * params.alphaScaling;
+        }
+    }
+}
+
+} // namespace OCIO_NAMESPACE
+
+#endif /* INCLUDED_OCIO_LUT1DOP_CPU_INVSEARCH_H */
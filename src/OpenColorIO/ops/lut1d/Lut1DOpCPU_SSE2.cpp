@@ -177,6 +177,59 @@ inline Lut1DOpCPUApplyFunc * GetConvertInBitDepth(BitDepth outBD)
     return nullptr;
 }
 
+struct InvLut1DOpsSSE2
+{
+    typedef __m128  Float;
+    typedef __m128i Int;
+    typedef __m128  Mask;
+
+    static constexpr unsigned size = 4;
+
+    static inline Float load(const float * src) { return _mm_load_ps(src); }
+    static inline void store(float * dst, Float v) { _mm_store_ps(dst, v); }
+
+    static inline Float set1(float v) { return _mm_set1_ps(v); }
+    static inline Int iset1(int v) { return _mm_set1_epi32(v); }
+
+    static inline Float min(Float a, Float b) { return _mm_min_ps(a, b); }
+    static inline Float max(Float a, Float b) { return _mm_max_ps(a, b); }
+    static inline Float add(Float a, Float b) { return _mm_add_ps(a, b); }
+    static inline Float sub(Float a, Float b) { return _mm_sub_ps(a, b); }
+    static inline Float mul(Float a, Float b) { return _mm_mul_ps(a, b); }
+    static inline Float div(Float a, Float b) { return _mm_div_ps(a, b); }
+    static inline Int iadd(Int a, Int b) { return _mm_add_epi32(a, b); }
+
+    static inline Float cvt(Int v) { return _mm_cvtepi32_ps(v); }
+    static inline Int cvtt(Float v) { return _mm_cvttps_epi32(v); }
+
+    static inline Float gather(const float * src, Int idx)
+    {
+        alignas(16) int indices[4];
+        alignas(16) float buffer[4];
+        Float res;
+        i32gather_ps_sse2(src, res, idx, indices, buffer);
+        return res;
+    }
+
+    static inline Mask lt(Float a, Float b) { return _mm_cmplt_ps(a, b); }
+    static inline Mask gt(Float a, Float b) { return _mm_cmpgt_ps(a, b); }
+    static inline Mask ge(Float a, Float b) { return _mm_cmpge_ps(a, b); }
+    static inline Mask maskNot(Mask m) { return _mm_xor_ps(m, _mm_castsi128_ps(_mm_set1_epi32(-1))); }
+    static inline bool any(Mask m) { return _mm_movemask_ps(m) != 0; }
+    static inline bool all(Mask m) { return _mm_movemask_ps(m) == 0xf; }
+
+    static inline Float select(Mask m, Float a, Float b)
+    {
+        return _mm_or_ps(_mm_and_ps(m, a), _mm_andnot_ps(m, b));
+    }
+
+    static inline Int iselect(Mask m, Int a, Int b)
+    {
+        const __m128i mi = _mm_castps_si128(m);
+        return _mm_or_si128(_mm_and_si128(mi, a), _mm_andnot_si128(mi, b));
+    }
+};
+
 } // anonymous namespace
 
 Lut1DOpCPUApplyFunc * SSE2GetLut1DApplyFunc(BitDepth inBD, BitDepth outBD)
@@ -203,6 +256,11 @@ Lut1DOpCPUApplyFunc * SSE2GetLut1DApplyFunc(BitDepth inBD, BitDepth outBD)
     return nullptr;
 }
 
+void applyInvLut1DSSE2(const InvLut1DParams & params, const float * src, float * dst, long numPixels)
+{
+    ApplyInvLut1D<InvLut1DOpsSSE2>(params, src, dst, numPixels);
+}
+
 } // OCIO_NAMESPACE
 
 #endif // OCIO_USE_SSE2
\ No newline at end of file
@@ -7,6 +7,7 @@
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "BitDepthUtils.h"
+#include "DiskCache.h"
 #include "HashUtils.h"
 #include "MathUtils.h"
 #include "ops/lut1d/Lut1DOp.h"
@@ -47,7 +48,7 @@ void Lut1DOpData::Lut3by1DArray::fill(HalfFlags halfFlags, bool filterNANs)
     const unsigned long dim         = getLength();
     const unsigned long maxChannels = getNumColorComponents();
 
-    Array::Values& values = getValues();
+    float * values = getValues().mutableData();
     if (Lut1DOpData::IsInputHalfDomain(halfFlags))
     {
         for (unsigned long idx = 0; idx<dim; ++idx)
@@ -625,30 +626,25 @@ const char* GetHueAdjustName(Lut1DHueAdjust algo)
 
 }
 
-std::string Lut1DOpData::getCacheID() const
+void Lut1DOpData::writeCacheID(std::ostream & os) const
 {
     AutoMutex lock(m_mutex);
 
     const Lut3by1DArray::Values & values = getArray().getValues();
 
-    std::ostringstream cacheIDStream;
     if (!getID().empty())
     {
-        cacheIDStream << getID() << " ";
+        os << getID() << " ";
     }
 
-    cacheIDStream << CacheIDHash(reinterpret_cast<const char*>(&values[0]), 
-                                 values.size() * sizeof(values[0]))
-                  << " ";
+    os << CacheIDHashDigest(&values[0], values.size() * sizeof(values[0])) << " ";
 
-    cacheIDStream << TransformDirectionToString(m_direction)                   << " ";
-    cacheIDStream << InterpolationToString(m_interpolation)                    << " ";
-    cacheIDStream << (isInputHalfDomain() ? "half domain" : "standard domain") << " ";
-    cacheIDStream << GetHueAdjustName(m_hueAdjust);
+    os << TransformDirectionToString(m_direction)                   << " ";
+    os << InterpolationToString(m_interpolation)                    << " ";
+    os << (isInputHalfDomain() ? "half domain" : "standard domain") << " ";
+    os << GetHueAdjustName(m_hueAdjust);
 
     // NB: The m_invQuality is not currently included.
-
-    return cacheIDStream.str();
 }
 
 //-----------------------------------------------------------------------------
@@ -693,13 +689,13 @@ void Lut1DOpData::ComposeVec(Lut1DOpDataRcPtr & lut, OpRcPtrVec & ops)
 
     // TODO: Could keep it one channel in some cases.
     lut->getArray().resize(numPixels, 3);
-    Array::Values & inValues = lut->getArray().getValues();
+    float * inValues = lut->getArray().getValues().mutableData();
 
     // Evaluate the transforms at 32f.
     // Note: If any ops are bypassed, that will be respected here.
 
-    EvalTransform((const float*)(&inValues[0]),
-                  (float*)(&inValues[0]),
+    EvalTransform(inValues,
+                  inValues,
                   numPixels,
                   ops);
 }
@@ -845,6 +841,26 @@ Lut1DOpDataRcPtr MakeFastLut1DFromInverse(ConstLut1DOpDataRcPtr & lut)
         throw Exception("MakeFastLut1DFromInverse expects an inverse 1D LUT");
     }
 
+    // The processes sharing the disk cache only build the fast LUT once.
+    CacheIDDigest diskCacheKey;
+    const bool useDiskCache = DiskCache::IsEnabled();
+    if (useDiskCache)
+    {
+        CacheIDHasher hasher;
+        hasher.update("MakeFastLut1DFromInverse");
+        DiskCache::UpdateKey(hasher, *lut);
+        diskCacheKey = hasher.digest();
+
+        ConstOpDataVec data;
+        if (DiskCache::Load(diskCacheKey, data) && data.size() == 1)
+        {
+            if (auto fastLut = DiskCache::CopyAs<Lut1DOpData>(data[0]))
+            {
+                return fastLut;
+            }
+        }
+    }
+
     auto depth = lut->getFileOutputBitDepth();
     if (depth == BIT_DEPTH_UNKNOWN || depth == BIT_DEPTH_UINT14 || depth == BIT_DEPTH_UINT32)
     {
@@ -863,7 +879,15 @@ Lut1DOpDataRcPtr MakeFastLut1DFromInverse(ConstLut1DOpDataRcPtr & lut)
     // Make a domain for the composed 1D LUT.
     ConstLut1DOpDataRcPtr newDomainLut = Lut1DOpData::MakeLookupDomain(depth);
 
-    return Lut1DOpData::Compose(newDomainLut, lut, Lut1DOpData::COMPOSE_RESAMPLE_NO);
+    Lut1DOpDataRcPtr fastLut
+        = Lut1DOpData::Compose(newDomainLut, lut, Lut1DOpData::COMPOSE_RESAMPLE_NO);
+
+    if (useDiskCache)
+    {
+        DiskCache::Save(diskCacheKey, { fastLut });
+    }
+
+    return fastLut;
 }
 
 void Lut1DOpData::scale(float scale)
@@ -941,7 +965,9 @@ void Lut1DOpData::initializeFromForward()
     const unsigned long length = getArray().getLength();
     const unsigned long maxChannels = getArray().getMaxColorComponents();
     const unsigned long activeChannels = getArray().getNumColorComponents();
-    Array::Values& values = getArray().getValues();
+    // Only a LUT with reversals is modified, the values of the others are kept shared.
+    Array::Values & arrayValues = getArray().getValues();
+    const Array::Values & values = arrayValues;
 
     for (unsigned long c = 0; c < activeChannels; ++c)
     {
@@ -979,7 +1005,7 @@ void Lut1DOpData::initializeFromForward()
                 {
                     if (isIncreasing != (values[idx] > prevValue))
                     {
-                        values[idx] = prevValue;
+                        arrayValues.mutableData()[idx] = prevValue;
                     }
                     else
                     {
@@ -999,7 +1025,7 @@ void Lut1DOpData::initializeFromForward()
                 {
                     if (isIncreasing != (values[idx] > prevValue))
                     {
-                        values[idx] = prevValue;
+                        arrayValues.mutableData()[idx] = prevValue;
                     }
                     else
                     {
@@ -1016,7 +1042,7 @@ void Lut1DOpData::initializeFromForward()
                 {
                     if (isIncreasing != (values[idx] > prevValue))
                     {
-                        values[idx] = prevValue;
+                        arrayValues.mutableData()[idx] = prevValue;
                     }
                     else
                     {
@@ -113,7 +113,7 @@ public:
 
     bool hasChannelCrosstalk() const override;
 
-    std::string getCacheID() const override;
+    void writeCacheID(std::ostream & os) const override;
 
     // Check if the LUT is using half code indices as its domain.
     // Return returns true if this LUT requires half code indices as input.
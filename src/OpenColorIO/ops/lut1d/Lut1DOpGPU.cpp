@@ -18,7 +18,7 @@ namespace
 {
 void CreatePaddedLutChannels(unsigned long width,
                              unsigned long height,
-                             const std::vector<float> & channel,
+                             const Array::Values & channel,
                              std::vector<float> & paddedChannel)
 {
     // The 1D LUT always contains 3 channels.
@@ -83,7 +83,7 @@ void CreatePaddedLutChannels(unsigned long width,
 
 void CreatePaddedRedChannel(unsigned long width,
                             unsigned long height,
-                            const std::vector<float> & channel, // Contains RGB.
+                            const Array::Values & channel, // Contains RGB.
                             std::vector<float> & paddedChannel) // Expects Red only.
 {
     // The 1D LUT always contains 3 channels.
@@ -93,7 +93,7 @@ public:
     bool canCombineWith(ConstOpRcPtr & op) const override;
     void combineWith(OpRcPtrVec & ops, ConstOpRcPtr & secondOp) const override;
     bool hasChannelCrosstalk() const override;
-    std::string getCacheID() const override;
+    void writeCacheID(std::ostream & os) const override;
 
     ConstOpCPURcPtr getCPUOp(bool fastLogExpPow) const override;
 
@@ -184,14 +184,11 @@ bool Lut3DOp::hasChannelCrosstalk() const
     return lut3DData()->hasChannelCrosstalk();
 }
 
-std::string Lut3DOp::getCacheID() const
+void Lut3DOp::writeCacheID(std::ostream & os) const
 {
-    std::ostringstream cacheIDStream;
-    cacheIDStream << "<Lut3D ";
-    cacheIDStream << lut3DData()->getCacheID();
-    cacheIDStream << ">";
-
-    return cacheIDStream.str();
+    os << "<Lut3D ";
+    lut3DData()->writeCacheID(os);
+    os << ">";
 }
 
 ConstOpCPURcPtr Lut3DOp::getCPUOp(bool /*fastLogExpPow*/) const
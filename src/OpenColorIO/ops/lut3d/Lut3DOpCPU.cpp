@@ -4,17 +4,24 @@
 #include <algorithm>
 #include <math.h>
 #include <stdint.h>
+#include <unordered_map>
 #include <vector>
 
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "BitDepthUtils.h"
+#include "Caching.h"
+#include "DiskCache.h"
+#include "HashUtils.h"
 #include "MathUtils.h"
+#include "Mutex.h"
 #include "ops/lut3d/Lut3DOpCPU.h"
 #include "ops/OpTools.h"
 #include "Platform.h"
 #include "SSE.h"
+#include "ThreadPool.h"
 #include "CPUInfo.h"
+#include "ops/lut3d/Lut3DOpCPU_InvSearch.h"
 #include "Lut3DOpCPU_SSE2.h"
 #include "Lut3DOpCPU_AVX.h"
 #include "Lut3DOpCPU_AVX2.h"
@@ -36,15 +43,21 @@ public:
 protected:
     void updateData(ConstLut3DOpDataRcPtr & lut);
 
-    // Creates a LUT aligned to a 16 byte boundary with RGB and 0 for alpha
-    // in order to be able to load the LUT using _mm_load_ps.
-    float* createOptLut(const Array::Values& lut) const;
+    // Creates a LUT with RGB and 0 for alpha in order to be able to load
+    // the LUT using _mm_loadu_ps.
+    Array::Values createOptLut(const Array::Values& lut) const;
+
+public:
+    typedef OCIO_SHARED_PTR<const Array::Values> ConstValuesRcPtr;
+
+    const ConstValuesRcPtr & getOptLutValues() const { return m_optLutValues; }
 
 protected:
     // Keep all these values because they are invariant during the
     // processing. So to slim the processing code, these variables
     // are computed in the constructor.
-    float*         m_optLut;
+    ConstValuesRcPtr m_optLutValues; // Shared with the other renderers & processes.
+    const float*   m_optLut;
     unsigned long  m_dim;
     float          m_step;
     int            m_components;
@@ -123,7 +136,7 @@ class InvLut3DRenderer : public OpCPU
         // Populate the tree using the LUT values.
         // - gridVector Pointer to the vectorized 3d-LUT values.
         // - gridSize The dimension of each side of the 3d-LUT.
-        void initialize(float *gridVector, unsigned long gridSize);
+        void initialize(const float *gridVector, unsigned long gridSize);
 
         virtual ~RangeTree();
 
@@ -150,7 +163,7 @@ class InvLut3DRenderer : public OpCPU
         void initInds();
 
         // Initialize the tree with the min and max values for each LUT cube.
-        void initRanges(float *grvec);
+        void initRanges(const float *grvec);
 
         void indsToHash(const unsigned long i);
 
@@ -169,6 +182,16 @@ class InvLut3DRenderer : public OpCPU
 
 public:
 
+    // The extrapolated 3d-LUT and its RangeTree only depend on the LUT values and are read-only
+    // once built, so they are shared by all the renderers of identical LUTs.
+    struct TreeData
+    {
+        Array::Values      m_grvec;    // extrapolated 3d-LUT values
+        RangeTree          m_tree;     // object to allow fast range queries of
+                                       // the LUT
+    };
+    typedef OCIO_SHARED_PTR<const TreeData> ConstTreeDataRcPtr;
+
     explicit InvLut3DRenderer(ConstLut3DOpDataRcPtr & lut);
     virtual ~InvLut3DRenderer();
 
@@ -177,15 +200,34 @@ public:
     virtual void updateData(ConstLut3DOpDataRcPtr & lut);
 
     // Extrapolate the 3d-LUT to handle values outside the LUT gamut
-    void extrapolate3DArray(ConstLut3DOpDataRcPtr & lut);
+    static void extrapolate3DArray(ConstLut3DOpDataRcPtr & lut, Array::Values & grvec);
+
+    // Get the extrapolated 3d-LUT & RangeTree of the LUT, either from the cache or by building
+    // them.
+    static ConstTreeDataRcPtr GetTreeData(ConstLut3DOpDataRcPtr & lut);
+
+    const ConstTreeDataRcPtr & getTreeData() const { return m_data; }
+
+    const InvLut3DTreeView & getTreeView() const { return m_treeView; }
+
+    // Look for the inverse in the LUT cube of a leaf node of the tree.
+    static bool SolveLeaf(const void * renderer, unsigned long leaf,
+                          const float * rgb, float * result);
 
 protected:
     float              m_scale;        // output scaling for r, g and b
                                        // components
     long               m_dim;          // grid size of the extrapolated 3d-LUT
-    RangeTree          m_tree;         // object to allow fast range queries of
-                                       // the LUT
-    std::vector<float> m_grvec;        // extrapolated 3d-LUT values
+    ConstTreeDataRcPtr m_data;         // extrapolated 3d-LUT & its RangeTree
+
+    unsigned long      m_offs[3];      // offsets of the r, g and b steps in the
+                                       // extrapolated 3d-LUT values
+    unsigned long      m_newVertList[8]; // offsets of the cube vertices visited
+                                         // by invert_hypercube()
+
+    std::vector<InvLut3DTreeLevel> m_treeLevels; // flat view of the tree levels
+    InvLut3DTreeView   m_treeView;     // view of the tree for the vectorized search
+    apply_inv_lut_func * m_applyInvLutFunc = nullptr; // vectorized search
 
 private:
     InvLut3DRenderer() = delete;
@@ -246,7 +288,7 @@ inline __m128i GetLut3DIndices(const __m128i &idxR,
     return _mm_slli_epi32(r, 2);
 }
 
-inline void LookupNearest4(float* optLut,
+inline void LookupNearest4(const float* optLut,
                            const __m128i &rIndices,
                            const __m128i &gIndices,
                            const __m128i &bIndices,
@@ -257,10 +299,10 @@ inline void LookupNearest4(float* optLut,
 
     int* offsetInt = (int*)&offsets;
 
-    res[0] = _mm_load_ps(optLut + offsetInt[0]);
-    res[1] = _mm_load_ps(optLut + offsetInt[1]);
-    res[2] = _mm_load_ps(optLut + offsetInt[2]);
-    res[3] = _mm_load_ps(optLut + offsetInt[3]);
+    res[0] = _mm_loadu_ps(optLut + offsetInt[0]);
+    res[1] = _mm_loadu_ps(optLut + offsetInt[1]);
+    res[2] = _mm_loadu_ps(optLut + offsetInt[2]);
+    res[3] = _mm_loadu_ps(optLut + offsetInt[3]);
 }
 
 #else
@@ -299,6 +341,10 @@ inline void lerp_rgb(float* out, float* a, float* b, float* c, float* d,
 }
 #endif
 
+// Cache of the optimized LUT values keyed by the LUT values. The cache does not own the values,
+// they only live as long as one renderer uses them.
+WeakCache<CacheIDDigest, Array::Values> g_optLut3DCache;
+
 inline int GetLut3DIndexBlueFast(int indexR, int indexG, int indexB, long dim, int components=3)
 {
     return components * (indexB + (int)dim * (indexG + (int)dim * indexR));
@@ -317,11 +363,6 @@ BaseLut3DRenderer::BaseLut3DRenderer(ConstLut3DOpDataRcPtr & lut)
 
 BaseLut3DRenderer::~BaseLut3DRenderer()
 {
-#if OCIO_USE_SSE2
-    Platform::AlignedFree(m_optLut);
-#else
-    free(m_optLut);
-#endif
 }
 
 void BaseLut3DRenderer::updateData(ConstLut3DOpDataRcPtr & lut)
@@ -331,26 +372,56 @@ void BaseLut3DRenderer::updateData(ConstLut3DOpDataRcPtr & lut)
     m_step = ((float)m_dim - 1.0f);
 
 #if OCIO_USE_SSE2
-    Platform::AlignedFree(m_optLut);
     m_components = 4;
 #else
     m_components = 3;
-    free(m_optLut);
 #endif
-    m_optLut = createOptLut(lut->getArray().getValues());
+
+    // The optimized LUT is as large as the LUT so it is shared by the renderers of identical
+    // LUTs, and with the other processes using the disk cache (i.e. the values are then a memory
+    // mapping of the cache entry). It only depends on the LUT values.
+    const Array::Values & values = lut->getArray().getValues();
+
+    CacheIDHasher hasher;
+    hasher.update("Lut3DRenderer")
+          .update(&m_components, sizeof(m_components))
+          .update(values.data(), values.size() * sizeof(float));
+    const CacheIDDigest key = hasher.digest();
+
+    m_optLutValues = g_optLut3DCache.get(key);
+    if (!m_optLutValues)
+    {
+        auto optLutValues = std::make_shared<Array::Values>();
+
+        const bool useDiskCache = DiskCache::IsEnabled();
+        if (!useDiskCache || !DiskCache::LoadValues(key, *optLutValues))
+        {
+            *optLutValues = createOptLut(values);
+
+            if (useDiskCache)
+            {
+                DiskCache::SaveValues(key, *optLutValues);
+                // Map the saved entry to release the private copy.
+                DiskCache::LoadValues(key, *optLutValues);
+            }
+        }
+
+        m_optLutValues = g_optLut3DCache.add(key, optLutValues);
+    }
+
+    m_optLut = m_optLutValues->data();
 }
 
 #if OCIO_USE_SSE2
-// Creates a LUT aligned to a 16 byte boundary with RGB and 0 for alpha
-// in order to be able to load the LUT using _mm_load_ps.
-float* BaseLut3DRenderer::createOptLut(const Array::Values& lut) const
+// Creates a LUT with RGB and 0 for alpha in order to be able to load
+// the LUT using _mm_loadu_ps.
+Array::Values BaseLut3DRenderer::createOptLut(const Array::Values& lut) const
 {
     const long maxEntries = m_dim * m_dim * m_dim;
 
-    float *optLut =
-        (float*)Platform::AlignedMalloc(maxEntries * m_components * sizeof(float), 16);
+    Array::Values optLut(maxEntries * m_components);
 
-    float* currentValue = optLut;
+    float* currentValue = optLut.mutableData();
     for (long idx = 0; idx<maxEntries; idx++)
     {
         currentValue[0] = SanitizeFloat(lut[idx * 3]);
@@ -363,14 +434,13 @@ float* BaseLut3DRenderer::createOptLut(const Array::Values& lut) const
     return optLut;
 }
 #else
-float* BaseLut3DRenderer::createOptLut(const Array::Values& lut) const
+Array::Values BaseLut3DRenderer::createOptLut(const Array::Values& lut) const
 {
     const long maxEntries = m_dim * m_dim * m_dim;
 
-    float *optLut =
-        (float*)malloc(maxEntries * m_components * sizeof(float));
+    Array::Values optLut(maxEntries * m_components);
 
-    float* currentValue = optLut;
+    float* currentValue = optLut.mutableData();
     for (long idx = 0; idx<maxEntries; idx++)
     {
         currentValue[0] = SanitizeFloat(lut[idx * 3]);
@@ -836,18 +906,18 @@ void Lut3DRenderer::apply(const void * inImg, void * outImg, long numPixels) con
 // as efficiently as possible.
 unsigned long invert_hypercube
 (
-    unsigned long    n,
-    float*           x_out,
-    const float*     gr,
-    unsigned long*   ind2off,
-    float*           val,
-    unsigned long*   guess,
-    unsigned long    list_len,
-    long*            ops_list,
-    unsigned long*   entering_list,
-    unsigned long*   new_vert_list,
-    unsigned long*   path_list,
-    unsigned long*   path_order
+    unsigned long          n,
+    float*                 x_out,
+    const float*           gr,
+    const unsigned long*   ind2off,
+    const float*           val,
+    const unsigned long*   guess,
+    unsigned long          list_len,
+    const long*            ops_list,
+    const unsigned long*   entering_list,
+    const unsigned long*   new_vert_list,
+    const unsigned long*   path_list,
+    const unsigned long*   path_order
 )
 {
     // Singularity tolerance
@@ -1077,6 +1147,68 @@ unsigned long invert_hypercube
     }
 }
 
+// Below this number of items (i.e. LUT cubes or tree nodes) per task, the parallel dispatch
+// costs more than it saves when building the RangeTree.
+constexpr unsigned long TreeMinItemsPerTask = 16384;
+
+unsigned GetNumTreeTasks(unsigned long numItems)
+{
+    return (unsigned)std::max(1UL, std::min((unsigned long)GetNumHardwareThreads(),
+                                            numItems / TreeMinItemsPerTask));
+}
+
+// Call func(begin, end) on contiguous sub-ranges of [0, numItems) using several threads when
+// there are enough items. Each call must only write the data of its own sub-range.
+template<typename Func>
+void ParallelTreeFor(unsigned long numItems, const Func & func)
+{
+    RunParallelRanges(numItems, GetNumTreeTasks(numItems), func);
+}
+
+// Sort sub-ranges in parallel and then merge them pairwise. The result is identical to
+// std::sort() when the keys are unique.
+template<typename T>
+void ParallelTreeSort(std::vector<T> & items)
+{
+    const unsigned long numItems = static_cast<unsigned long>(items.size());
+
+    unsigned long numRuns = GetNumTreeTasks(numItems);
+    if (numRuns == 1)
+    {
+        std::sort(items.begin(), items.end());
+        return;
+    }
+
+    std::vector<unsigned long> bounds(numRuns + 1);
+    for (unsigned long run = 0; run <= numRuns; ++run)
+    {
+        bounds[run] = static_cast<unsigned long>((uint64_t)numItems * run / numRuns);
+    }
+
+    RunParallelTasks((unsigned)numRuns, [&](unsigned run)
+    {
+        std::sort(items.begin() + bounds[run], items.begin() + bounds[run + 1]);
+    });
+
+    while (numRuns > 1)
+    {
+        RunParallelTasks((unsigned)(numRuns / 2), [&](unsigned pair)
+        {
+            std::inplace_merge(items.begin() + bounds[2 * pair],
+                               items.begin() + bounds[2 * pair + 1],
+                               items.begin() + bounds[2 * pair + 2]);
+        });
+
+        // Keep the bounds of the merged runs (and of the last one if the count is odd).
+        unsigned long newNumRuns = 0;
+        for (unsigned long run = 0; run < numRuns; run += 2)
+        {
+            bounds[++newNumRuns] = bounds[std::min(run + 2, numRuns)];
+        }
+        numRuns = newNumRuns;
+    }
+}
+
 InvLut3DRenderer::RangeTree::RangeTree()
 {
 }
@@ -1085,7 +1217,7 @@ InvLut3DRenderer::RangeTree::~RangeTree()
 {
 }
 
-void InvLut3DRenderer::RangeTree::initRanges(float *grvec)
+void InvLut3DRenderer::RangeTree::initRanges(const float *grvec)
 {
     const unsigned long depthm1 = m_depth - 1;
     const unsigned long N = m_levels[depthm1].elems;
@@ -1122,38 +1254,42 @@ void InvLut3DRenderer::RangeTree::initRanges(float *grvec)
         throw Exception("Unsupported channel number.");
     }
 
-    float minVal[MAX_N] = { 0.0f, 0.0f, 0.0f, 0.0f };
-    float maxVal[MAX_N] = { 0.0f, 0.0f, 0.0f, 0.0f };
-    for (unsigned long i = 0; i < N; i++)
+    // The leaf cubes are independent from each other.
+    ParallelTreeFor(N, [&](unsigned long begin, unsigned long end)
     {
-        const unsigned long baseOffset = m_baseInds[i].inds[0] * ind0scale +
-            m_baseInds[i].inds[1] * ind1scale + m_baseInds[i].inds[2];
-
-        for (unsigned long k = 0; k < m_chans; k++)
+        float minVal[MAX_N] = { 0.0f, 0.0f, 0.0f, 0.0f };
+        float maxVal[MAX_N] = { 0.0f, 0.0f, 0.0f, 0.0f };
+        for (unsigned long i = begin; i < end; i++)
         {
-            minVal[k] = grvec[baseOffset * m_chans + k];
-            maxVal[k] = minVal[k];
-        }
+            const unsigned long baseOffset = m_baseInds[i].inds[0] * ind0scale +
+                m_baseInds[i].inds[1] * ind1scale + m_baseInds[i].inds[2];
 
-        for (unsigned long j = 1; j < corners; j++)
-        {
-            const unsigned long index = (baseOffset + cornerOffsets[j]) * m_chans;
             for (unsigned long k = 0; k < m_chans; k++)
             {
-                minVal[k] = std::min(minVal[k], grvec[index + k]);
-                maxVal[k] = std::max(maxVal[k], grvec[index + k]);
+                minVal[k] = grvec[baseOffset * m_chans + k];
+                maxVal[k] = minVal[k];
             }
-        }
 
-        // Expand the ranges slightly to allow for error in forward evaluation.
-        const float TOL = 1e-6f;
+            for (unsigned long j = 1; j < corners; j++)
+            {
+                const unsigned long index = (baseOffset + cornerOffsets[j]) * m_chans;
+                for (unsigned long k = 0; k < m_chans; k++)
+                {
+                    minVal[k] = std::min(minVal[k], grvec[index + k]);
+                    maxVal[k] = std::max(maxVal[k], grvec[index + k]);
+                }
+            }
 
-        for (unsigned long k = 0; k < m_chans; k++)
-        {
-            m_levels[depthm1].minVals[i * m_chans + k] = minVal[k] - TOL;
-            m_levels[depthm1].maxVals[i * m_chans + k] = maxVal[k] + TOL;
+            // Expand the ranges slightly to allow for error in forward evaluation.
+            const float TOL = 1e-6f;
+
+            for (unsigned long k = 0; k < m_chans; k++)
+            {
+                m_levels[depthm1].minVals[i * m_chans + k] = minVal[k] - TOL;
+                m_levels[depthm1].maxVals[i * m_chans + k] = maxVal[k] + TOL;
+            }
         }
-    }
+    });
 }
 
 void InvLut3DRenderer::RangeTree::initInds()
@@ -1266,44 +1402,48 @@ void InvLut3DRenderer::RangeTree::updateRanges(const unsigned long level)
     m_levels[level].minVals.resize(levelSize * m_chans);
     m_levels[level].maxVals.resize(levelSize * m_chans);
 
-    for (unsigned long i = 0; i < levelSize; i++)
+    // The nodes of a level (i.e. the sub-trees) are independent from each other.
+    ParallelTreeFor(levelSize, [&](unsigned long begin, unsigned long end)
     {
-        const unsigned long index = m_levels[level].child0offsets[i];
-        for (unsigned long k = 0; k < m_chans; k++)
+        for (unsigned long i = begin; i < end; i++)
         {
-            m_levels[level].minVals[i * m_chans + k] =
-                m_levels[level + 1].minVals[index * m_chans + k];
-            m_levels[level].maxVals[i * m_chans + k] =
-                m_levels[level + 1].maxVals[index * m_chans + k];
-        }
+            const unsigned long index = m_levels[level].child0offsets[i];
+            for (unsigned long k = 0; k < m_chans; k++)
+            {
+                m_levels[level].minVals[i * m_chans + k] =
+                    m_levels[level + 1].minVals[index * m_chans + k];
+                m_levels[level].maxVals[i * m_chans + k] =
+                    m_levels[level + 1].maxVals[index * m_chans + k];
+            }
 
-        // New min/max combine the min/max for all children from next lower level.
-        for (unsigned long j = 2; j <= maxChildren; j++)
-        {
-            if (m_levels[level].numChildren[i] >= j)
+            // New min/max combine the min/max for all children from next lower level.
+            for (unsigned long j = 2; j <= maxChildren; j++)
             {
-                const unsigned long ind = index + j - 1;
-                for (unsigned long k = 0; k < m_chans; k++)
+                if (m_levels[level].numChildren[i] >= j)
                 {
-                    const float minVal = m_levels[level].minVals[i * m_chans + k];
-                    const float childMinVal = m_levels[level + 1].minVals[ind * m_chans + k];
-                    if (childMinVal < minVal)
-                    {
-                        m_levels[level].minVals[i * m_chans + k] = childMinVal;
-                    }
-                    const float maxVal = m_levels[level].maxVals[i * m_chans + k];
-                    const float childMaxVal = m_levels[level + 1].maxVals[ind * m_chans + k];
-                    if (childMaxVal > maxVal)
+                    const unsigned long ind = index + j - 1;
+                    for (unsigned long k = 0; k < m_chans; k++)
                     {
-                        m_levels[level].maxVals[i * m_chans + k] = childMaxVal;
+                        const float minVal = m_levels[level].minVals[i * m_chans + k];
+                        const float childMinVal = m_levels[level + 1].minVals[ind * m_chans + k];
+                        if (childMinVal < minVal)
+                        {
+                            m_levels[level].minVals[i * m_chans + k] = childMinVal;
+                        }
+                        const float maxVal = m_levels[level].maxVals[i * m_chans + k];
+                        const float childMaxVal = m_levels[level + 1].maxVals[ind * m_chans + k];
+                        if (childMaxVal > maxVal)
+                        {
+                            m_levels[level].maxVals[i * m_chans + k] = childMaxVal;
+                        }
                     }
                 }
             }
         }
-    }
+    });
 }
 
-void InvLut3DRenderer::RangeTree::initialize(float *grvec, unsigned long gsz)
+void InvLut3DRenderer::RangeTree::initialize(const float *grvec, unsigned long gsz)
 {
     m_chans = 3;  // only supporting Lut3D for now
     m_gsz[0] = m_gsz[1] = m_gsz[2] = gsz;
@@ -1351,13 +1491,16 @@ void InvLut3DRenderer::RangeTree::initialize(float *grvec, unsigned long gsz)
     // Calculate hash for indices.
 
     const unsigned long cnt = static_cast<unsigned long>(m_baseInds.size());
-    for (unsigned long i = 0; i < cnt; i++)
+    ParallelTreeFor(cnt, [this](unsigned long begin, unsigned long end)
     {
-        indsToHash(i);
-    }
+        for (unsigned long i = begin; i < end; i++)
+        {
+            indsToHash(i);
+        }
+    });
 
     // Sort indices based on hash.
-    std::sort(m_baseInds.begin(), m_baseInds.end());
+    ParallelTreeSort(m_baseInds);
 
     // Copy sorted hashes into temp vector.
     ulongVector hashes(cnt);
@@ -1421,6 +1564,29 @@ void InvLut3DRenderer::RangeTree::initialize(float *grvec, unsigned long gsz)
     }
 }*/
 
+// Tables used by invert_hypercube() to visit the tetrahedra of a LUT cube.
+const long InvOpsList[]                = { 0, 0, 1, 1, 1, 1, 1, 1 };
+const unsigned long InvEnteringList[]  = { 2, 1, 0, 2, 0, 2, 0, 2 };
+const unsigned long InvNewVerts[] = {
+    1, 0, 0,
+    1, 1, 1,
+    1, 1, 0,
+    0, 1, 0,
+    0, 1, 1,
+    0, 0, 1,
+    1, 0, 1,
+    1, 0, 0 };
+const unsigned long InvPathList[] = {
+    0, 0, 0,
+    0, 0, 0,
+    0, 1, 2,
+    1, 0, 2,
+    1, 2, 0,
+    2, 1, 0,
+    2, 0, 1,
+    0, 2, 1 };
+const unsigned long InvPathOrder[] = { 1, 0, 2 };
+
 float* extrapolate(float RGB[3], float center, float scale)
 {
     RGB[0] = (RGB[0] - center) * scale + center;
@@ -1429,12 +1595,59 @@ float* extrapolate(float RGB[3], float center, float scale)
     return RGB;
 }
 
+// Cache of the extrapolated 3d-LUTs & RangeTrees keyed by the LUT values. The cache does not
+// own the data, it only lives as long as one renderer uses it.
+WeakCache<CacheIDDigest, InvLut3DRenderer::TreeData> g_invLut3DTreeCache;
+
+InvLut3DRenderer::ConstTreeDataRcPtr InvLut3DRenderer::GetTreeData(ConstLut3DOpDataRcPtr & lut)
+{
+    // Only the LUT values are needed to build the tree (i.e. not the interpolation, direction
+    // or id parts of the LUT cache ID).
+    const Lut3DOpData::Lut3DArray::Values & values = lut->getArray().getValues();
+    const CacheIDDigest key = CacheIDHashDigest(values.data(), values.size() * sizeof(float));
+
+    ConstTreeDataRcPtr data = g_invLut3DTreeCache.get(key);
+    if (data)
+    {
+        return data;
+    }
+
+    auto newData = std::make_shared<TreeData>();
+    extrapolate3DArray(lut, newData->m_grvec);
+
+    const unsigned long dim = lut->getArray().getLength() + 2;  // extrapolation adds 2
+    newData->m_tree.initialize(newData->m_grvec.data(), dim);
+    //newData->m_tree.print();
+
+    return g_invLut3DTreeCache.add(key, newData);
+}
+
 InvLut3DRenderer::InvLut3DRenderer(ConstLut3DOpDataRcPtr & lut)
     : OpCPU()
     , m_scale(0.0f)
     , m_dim(0)
-    , m_tree()
 {
+    #if OCIO_USE_SSE2
+    if (CPUInfo::instance().hasSSE2())
+    {
+        m_applyInvLutFunc = applyInvTetrahedralSSE2;
+    }
+    #endif
+
+    #if OCIO_USE_AVX2
+    if (CPUInfo::instance().hasAVX2())
+    {
+        m_applyInvLutFunc = applyInvTetrahedralAVX2;
+    }
+    #endif
+
+    #if OCIO_USE_AVX512
+    if (CPUInfo::instance().hasAVX512())
+    {
+        m_applyInvLutFunc = applyInvTetrahedralAVX512;
+    }
+    #endif
+
     updateData(lut);
 }
 
@@ -1444,21 +1657,69 @@ InvLut3DRenderer:: ~InvLut3DRenderer()
 
 void InvLut3DRenderer::updateData(ConstLut3DOpDataRcPtr & lut)
 {
-    extrapolate3DArray(lut);
+    m_data = GetTreeData(lut);
 
     m_dim = lut->getArray().getLength() + 2;  // extrapolation adds 2
 
-    m_tree.initialize(m_grvec.data(), m_dim);
-    //m_tree.print();
-
     // Converts from index units to inDepth units of the original LUT.
     // (Note that inDepth of the original LUT is outDepth of the inverse LUT.)
     // (Note that the result should be relative to the unextrapolated LUT,
     //  hence the dim - 3.)
     m_scale = 1.0f / (float)(m_dim - 3);
+
+    const RangeTree & tree = m_data->m_tree;
+    const unsigned long* gsz = tree.getGridSize();
+    const unsigned long chans = tree.getChans();
+
+    m_offs[0] = gsz[2] * gsz[1];
+    m_offs[1] = gsz[2];
+    m_offs[2] = 1;
+
+    for (int i = 0; i < 8; i++)
+    {
+        m_newVertList[i] =  // must happen before * chans
+            InvNewVerts[i * 3] * m_offs[0] + InvNewVerts[i * 3 + 1] * m_offs[1]
+                + InvNewVerts[i * 3 + 2] * m_offs[2];
+    }
+    for (unsigned long i = 0; i<chans; i++)
+    {
+        m_offs[i] = m_offs[i] * chans;
+    }
+
+    // Flatten the tree for the vectorized search.
+    const TreeLevels & levels = tree.getLevels();
+    m_treeLevels.resize(levels.size());
+    for (size_t level = 0; level < levels.size(); ++level)
+    {
+        m_treeLevels[level].minVals = levels[level].minVals.data();
+        m_treeLevels[level].maxVals = levels[level].maxVals.data();
+        m_treeLevels[level].child0offsets = levels[level].child0offsets.data();
+        m_treeLevels[level].numChildren = levels[level].numChildren.data();
+    }
+
+    m_treeView.depth    = tree.getDepth();
+    m_treeView.rootSize = (unsigned long)levels[0].child0offsets.size();
+    m_treeView.levels   = m_treeLevels.data();
+    m_treeView.solve    = &InvLut3DRenderer::SolveLeaf;
+    m_treeView.solver   = this;
+    m_treeView.maxDim   = float(gsz[0] - 3u);  // unextrapolated max
+    m_treeView.scale    = m_scale;
+}
+
+bool InvLut3DRenderer::SolveLeaf(const void * renderer, unsigned long leaf,
+                                 const float * rgb, float * result)
+{
+    const InvLut3DRenderer & self = *static_cast<const InvLut3DRenderer *>(renderer);
+
+    const BaseIndsVec & baseInds = self.m_data->m_tree.getBaseInds();
+
+    return invert_hypercube(3, result, self.m_data->m_grvec.data(),
+                            self.m_offs, rgb, baseInds[leaf].inds,
+                            8, InvOpsList, InvEnteringList, self.m_newVertList,
+                            InvPathList, InvPathOrder) != 0;
 }
 
-void InvLut3DRenderer::extrapolate3DArray(ConstLut3DOpDataRcPtr & lut)
+void InvLut3DRenderer::extrapolate3DArray(ConstLut3DOpDataRcPtr & lut, Array::Values & grvec)
 {
     const unsigned long dim = lut->getArray().getLength();
     const unsigned long newDim = dim + 2;
@@ -1468,17 +1729,16 @@ void InvLut3DRenderer::extrapolate3DArray(ConstLut3DOpDataRcPtr & lut)
 
     Lut3DOpData::Lut3DArray newArray(newDim);
 
-    // Copy center values.
+    // Copy center values, one blue row at a time (i.e. the blue channel varies most rapidly).
+    const float * values = array.getValues().data();
+    float * newValues = newArray.getValues().mutableData();
     for (unsigned long idx = 0; idx<dim; idx++)
     {
         for (unsigned long jdx = 0; jdx<dim; jdx++)
         {
-            for (unsigned long kdx = 0; kdx<dim; kdx++)
-            {
-                float RGB[3];
-                array.getRGB(idx, jdx, kdx, RGB);
-                newArray.setRGB(idx + 1, jdx + 1, kdx + 1, RGB);
-            }
+            const float * src = values + (idx * dim * dim + jdx * dim) * 3;
+            float * dst = newValues + ((idx + 1) * newDim * newDim + (jdx + 1) * newDim + 1) * 3;
+            std::copy(src, src + dim * 3, dst);
         }
     }
 
@@ -1587,55 +1847,30 @@ void InvLut3DRenderer::extrapolate3DArray(ConstLut3DOpDataRcPtr & lut)
         }
     }
 
-    m_grvec = newArray.getValues();
+    grvec = std::move(newArray.getValues());
 }
 
 // TODO apply() needs further optimization work.
 
 void InvLut3DRenderer::apply(const void * inImg, void * outImg, long numPixels) const
 {
-    const unsigned long* gsz = m_tree.getGridSize();
-    const float maxDim = float(gsz[0] - 3u);  // unextrapolated max
-    const unsigned long chans = m_tree.getChans();
-    const unsigned long depth = m_tree.getDepth();
-    const TreeLevels& levels = m_tree.getLevels();
-    const BaseIndsVec& baseInds = m_tree.getBaseInds();
-
-    unsigned long offs[3] = { gsz[2] * gsz[1], gsz[2], 1 };
-
-    unsigned long list_len = 8;
-    long ops_list[] =               { 0, 0, 1, 1, 1, 1, 1, 1 };
-    unsigned long entering_list[] = { 2, 1, 0, 2, 0, 2, 0, 2 };
-    unsigned long new_verts[] = {
-        1, 0, 0,
-        1, 1, 1,
-        1, 1, 0,
-        0, 1, 0,
-        0, 1, 1,
-        0, 0, 1,
-        1, 0, 1,
-        1, 0, 0 };
-    unsigned long path_list[] = {
-        0, 0, 0,
-        0, 0, 0,
-        0, 1, 2,
-        1, 0, 2,
-        1, 2, 0,
-        2, 1, 0,
-        2, 0, 1,
-        0, 2, 1 };
-    unsigned long path_order[] = { 1, 0, 2 };
-    unsigned long new_vert_list[8];
-    for (int i = 0; i < 8; i++)
-    {
-        new_vert_list[i] =  // must happen before * chans
-            new_verts[i * 3] * offs[0] + new_verts[i * 3 + 1] * offs[1] + new_verts[i * 3 + 2] * offs[2];
-    }
-    for (unsigned long i = 0; i<chans; i++)
+    const float * in = (const float *)inImg;
+    float * out = (float *)outImg;
+
+    if (m_applyInvLutFunc && numPixels > 1)
     {
-        offs[i] = offs[i] * chans;
+        m_applyInvLutFunc(m_treeView, in, out, numPixels);
+        return;
     }
 
+    const RangeTree & tree = m_data->m_tree;
+
+    const unsigned long* gsz = tree.getGridSize();
+    const float maxDim = float(gsz[0] - 3u);  // unextrapolated max
+    const unsigned long chans = tree.getChans();
+    const unsigned long depth = tree.getDepth();
+    const TreeLevels& levels = tree.getLevels();
+
     const unsigned long MAX_LEVELS = 16;
     unsigned long currentChild[MAX_LEVELS];
     unsigned long currentNumChildren[MAX_LEVELS];
@@ -1647,9 +1882,6 @@ void InvLut3DRenderer::apply(const void * inImg, void * outImg, long numPixels)
         currentChildInd[i] = 0;
     }
 
-    const float * in = (const float *)inImg;
-    float * out = (float *)outImg;
-
     for (long i = 0; i<numPixels; ++i)
     {
         // Although the inverse LUT has been extrapolated, it may not be enough
@@ -1663,7 +1895,6 @@ void InvLut3DRenderer::apply(const void * inImg, void * outImg, long numPixels)
         const float B = Clamp(in[2], 0.f, inMax);
 
         const long depthm1 = depth - 1;
-        unsigned long baseIndx[3] = {0, 0, 0};
 
         currentNumChildren[0] = (unsigned long)levels[0].child0offsets.size();
         currentChild[0] = 0;
@@ -1692,18 +1923,9 @@ void InvLut3DRenderer::apply(const void * inImg, void * outImg, long numPixels)
                 {
                     if (level == depthm1)
                     {
-                        for (unsigned long k = 0; k < chans; k++)
-                            baseIndx[k] = baseInds[node].inds[k];
+                        const float fxval[3] = { R, G, B };
 
-                        float fxval[3] = { R, G, B };
-
-                        const bool valid = (invert_hypercube(3, result, m_grvec.data(),
-                                                             offs, fxval, baseIndx,
-                                                             list_len, ops_list,
-                                                             entering_list, new_vert_list,
-                                                             path_list, path_order) != 0);
-
-                        if (valid)
+                        if (SolveLeaf(this, node, fxval, result))
                         {
                             level = 0;  // to exit outer loop
                             break;
@@ -1720,14 +1942,14 @@ void InvLut3DRenderer::apply(const void * inImg, void * outImg, long numPixels)
                 }
             }
             level--;
-
-            // Need to subtract 1 since the indices include the extrapolation.
-            out[0] = Clamp(result[0] - 1.f, 0.f, maxDim) * m_scale;
-            out[1] = Clamp(result[1] - 1.f, 0.f, maxDim) * m_scale;
-            out[2] = Clamp(result[2] - 1.f, 0.f, maxDim) * m_scale;
-            out[3] = in[3];
         }
 
+        // Need to subtract 1 since the indices include the extrapolation.
+        out[0] = Clamp(result[0] - 1.f, 0.f, maxDim) * m_scale;
+        out[1] = Clamp(result[1] - 1.f, 0.f, maxDim) * m_scale;
+        out[2] = Clamp(result[2] - 1.f, 0.f, maxDim) * m_scale;
+        out[3] = in[3];
+
         in  += 4;
         out += 4;
     }
@@ -268,6 +268,34 @@ inline void applyTetrahedralAVX2Func(const float *lut3d, int dim, const void *in
     }
 }
 
+// RGB values of a packet of pixels for the exact inverse search.
+struct InvLut3DPacketAVX2
+{
+    static constexpr unsigned size = 8;
+
+    explicit InvLut3DPacketAVX2(const float (&rgb)[3][8])
+        : r(_mm256_loadu_ps(rgb[0]))
+        , g(_mm256_loadu_ps(rgb[1]))
+        , b(_mm256_loadu_ps(rgb[2]))
+    {
+    }
+
+    static void clearUpperState() { _mm256_zeroupper(); }
+
+    unsigned inRange(const float * minVals, const float * maxVals) const
+    {
+        __m256 mask = _mm256_cmp_ps(r, _mm256_set1_ps(minVals[0]), _CMP_GE_OQ);
+        mask = _mm256_and_ps(mask, _mm256_cmp_ps(g, _mm256_set1_ps(minVals[1]), _CMP_GE_OQ));
+        mask = _mm256_and_ps(mask, _mm256_cmp_ps(b, _mm256_set1_ps(minVals[2]), _CMP_GE_OQ));
+        mask = _mm256_and_ps(mask, _mm256_cmp_ps(r, _mm256_set1_ps(maxVals[0]), _CMP_LE_OQ));
+        mask = _mm256_and_ps(mask, _mm256_cmp_ps(g, _mm256_set1_ps(maxVals[1]), _CMP_LE_OQ));
+        mask = _mm256_and_ps(mask, _mm256_cmp_ps(b, _mm256_set1_ps(maxVals[2]), _CMP_LE_OQ));
+        return (unsigned)_mm256_movemask_ps(mask);
+    }
+
+    __m256 r, g, b;
+};
+
 } // anonymous namespace
 
 void applyTetrahedralAVX2(const float *lut3d, int dim, const float *src, float *dst, int total_pixel_count)
@@ -275,6 +303,11 @@ void applyTetrahedralAVX2(const float *lut3d, int dim, const float *src, float *
     applyTetrahedralAVX2Func<BIT_DEPTH_F32, BIT_DEPTH_F32>(lut3d, dim, src, dst, total_pixel_count);
 }
 
+void applyInvTetrahedralAVX2(const InvLut3DTreeView & tree, const float *src, float *dst, long total_pixel_count)
+{
+    ApplyInvLut3DTree<InvLut3DPacketAVX2>(tree, src, dst, total_pixel_count);
+}
+
 } // OCIO_NAMESPACE
 
 #endif // OCIO_USE_AVX2
\ No newline at end of file
@@ -247,6 +247,34 @@ inline void applyTetrahedralAVX512Func(const float *lut3d, int dim, const void *
     }
 }
 
+// RGB values of a packet of pixels for the exact inverse search.
+struct InvLut3DPacketAVX512
+{
+    static constexpr unsigned size = 16;
+
+    explicit InvLut3DPacketAVX512(const float (&rgb)[3][16])
+        : r(_mm512_loadu_ps(rgb[0]))
+        , g(_mm512_loadu_ps(rgb[1]))
+        , b(_mm512_loadu_ps(rgb[2]))
+    {
+    }
+
+    static void clearUpperState() { _mm256_zeroupper(); }
+
+    unsigned inRange(const float * minVals, const float * maxVals) const
+    {
+        __mmask16 mask = _mm512_cmp_ps_mask(r, _mm512_set1_ps(minVals[0]), _CMP_GE_OQ);
+        mask = _mm512_mask_cmp_ps_mask(mask, g, _mm512_set1_ps(minVals[1]), _CMP_GE_OQ);
+        mask = _mm512_mask_cmp_ps_mask(mask, b, _mm512_set1_ps(minVals[2]), _CMP_GE_OQ);
+        mask = _mm512_mask_cmp_ps_mask(mask, r, _mm512_set1_ps(maxVals[0]), _CMP_LE_OQ);
+        mask = _mm512_mask_cmp_ps_mask(mask, g, _mm512_set1_ps(maxVals[1]), _CMP_LE_OQ);
+        mask = _mm512_mask_cmp_ps_mask(mask, b, _mm512_set1_ps(maxVals[2]), _CMP_LE_OQ);
+        return (unsigned)mask;
+    }
+
+    __m512 r, g, b;
+};
+
 } // anonymous namespace
 
 void applyTetrahedralAVX512(const float *lut3d, int dim, const float *src, float *dst, int total_pixel_count)
@@ -254,6 +282,11 @@ void applyTetrahedralAVX512(const float *lut3d, int dim, const float *src, float
     applyTetrahedralAVX512Func<BIT_DEPTH_F32, BIT_DEPTH_F32>(lut3d, dim, src, dst, total_pixel_count);
 }
 
+void applyInvTetrahedralAVX512(const InvLut3DTreeView & tree, const float *src, float *dst, long total_pixel_count)
+{
+    ApplyInvLut3DTree<InvLut3DPacketAVX512>(tree, src, dst, total_pixel_count);
+}
+
 } // OCIO_NAMESPACE
 
 #endif // OCIO_USE_AVX512
\ No newline at end of file
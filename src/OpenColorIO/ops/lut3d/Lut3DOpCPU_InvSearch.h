@@ -0,0 +1,176 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#ifndef INCLUDED_OCIO_LUT3DOP_CPU_INVSEARCH_H
+#define INCLUDED_OCIO_LUT3DOP_CPU_INVSEARCH_H
+
+#include <OpenColorIO/OpenColorIO.h>
+
+namespace OCIO_NAMESPACE
+{
+
+// Flat view of a level of the RangeTree used by the exact inverse 3D LUT renderer.
+struct InvLut3DTreeLevel
+{
+    const float *         minVals = nullptr;       // min LUT values of the nodes (3 per node)
+    const float *         maxVals = nullptr;       // max LUT values of the nodes (3 per node)
+    const unsigned long * child0offsets = nullptr; // offsets to the first children
+    const unsigned long * numChildren = nullptr;   // number of children of the nodes
+};
+
+// Look for the inverse of the RGB value in the LUT cube of a leaf node. When found, it returns
+// true and the result in the index units of the extrapolated LUT.
+typedef bool (InvLut3DSolveFunc)(const void * solver, unsigned long leaf,
+                                 const float * rgb, float * result);
+
+// Everything the vectorized inverse renderers need from the RangeTree.
+struct InvLut3DTreeView
+{
+    unsigned long             depth = 0;        // number of levels of the tree
+    unsigned long             rootSize = 0;     // number of nodes of the first level
+    const InvLut3DTreeLevel * levels = nullptr; // the levels, from the root to the leaves
+    InvLut3DSolveFunc *       solve = nullptr;  // the leaf search
+    const void *              solver = nullptr; // the data of the leaf search
+    float                     maxDim = 0.f;     // unextrapolated max index
+    float                     scale = 0.f;      // from index units to output values
+};
+
+typedef void (apply_inv_lut_func)(const InvLut3DTreeView & tree,
+                                  const float * src, float * dst, long numPixels);
+
+// The Packet type of each instruction set holds the RGB values of Packet::size pixels and its
+// inRange(minVals, maxVals) method returns the bit mask of the pixels inside a node range. Its
+// static clearUpperState() method is called before the (non-vectorized) leaf search to avoid
+// the AVX to SSE transition penalties.
+//
+// Note: All the code below only depends on the Packet type so each instruction set gets its
+// own instantiation.
+
+// Depth-first search of the tree for a packet of pixels. A sub-tree is only visited when at
+// least one of the pixels still looking for its inverse is inside the sub-tree range. As the
+// nodes are visited in the same order than for a single pixel, each pixel gets the same result
+// than the scalar search.
+template<typename Packet>
+void SearchInvLut3DTree(const InvLut3DTreeView & tree,
+                        const Packet & packet,
+                        const float (&rgb)[3][Packet::size],
+                        unsigned pending,
+                        float (&results)[3][Packet::size])
+{
+    constexpr unsigned long MAX_LEVELS = 16;
+    unsigned long currentChild[MAX_LEVELS];
+    unsigned long lastChild[MAX_LEVELS];
+    unsigned      currentMask[MAX_LEVELS];
+
+    const unsigned long leafLevel = tree.depth - 1;
+
+    currentChild[0] = 0;
+    lastChild[0]    = tree.rootSize;
+    currentMask[0]  = pending;
+
+    long level = 0;
+    while (level >= 0 && pending)
+    {
+        if (currentChild[level] == lastChild[level])
+        {
+            level--;
+            continue;
+        }
+
+        const unsigned long node = currentChild[level]++;
+        const InvLut3DTreeLevel & treeLevel = tree.levels[level];
+
+        const unsigned inRange
+            = packet.inRange(treeLevel.minVals + node * 3, treeLevel.maxVals + node * 3)
+                & currentMask[level] & pending;
+
+        if (!inRange)
+        {
+            continue;
+        }
+
+        if ((unsigned long)level == leafLevel)
+        {
+            for (unsigned lane = 0; lane < Packet::size; ++lane)
+            {
+                if (inRange & (1u << lane))
+                {
+                    const float fxval[3] = { rgb[0][lane], rgb[1][lane], rgb[2][lane] };
+                    float result[3] = { 0.f, 0.f, 0.f };
+
+                    Packet::clearUpperState();
+                    if (tree.solve(tree.solver, node, fxval, result))
+                    {
+                        results[0][lane] = result[0];
+                        results[1][lane] = result[1];
+                        results[2][lane] = result[2];
+                        pending &= ~(1u << lane);
+                    }
+                }
+            }
+        }
+        else
+        {
+            currentChild[level + 1] = treeLevel.child0offsets[node];
+            lastChild[level + 1]    = treeLevel.child0offsets[node] + treeLevel.numChildren[node];
+            currentMask[level + 1]  = inRange;
+            level++;
+        }
+    }
+}
+
+template<typename Packet>
+void ApplyInvLut3DTree(const InvLut3DTreeView & tree, const float * src, float * dst, long numPixels)
+{
+    constexpr unsigned size = Packet::size;
+
+    float rgb[3][size];
+    float results[3][size];
+
+    for (long start = 0; start < numPixels; start += size)
+    {
+        const long remaining = numPixels - start;
+        const unsigned count = remaining < (long)size ? (unsigned)remaining : size;
+
+        for (unsigned lane = 0; lane < size; ++lane)
+        {
+            // Pad the last packet with its last pixel.
+            const float * in = src + 4 * (start + (lane < count ? lane : count - 1));
+
+            // Although the inverse LUT has been extrapolated, it may not be enough to cover an
+            // HDR float image, so need to clamp (same as Clamp() i.e. NaN values become 0).
+            for (unsigned c = 0; c < 3; ++c)
+            {
+                const float val = 0.f < in[c] ? in[c] : 0.f;
+                rgb[c][lane] = 1.f < val ? 1.f : val;
+
+                // For now, if no result is found, return 0.
+                results[c][lane] = 0.f;
+            }
+        }
+
+        const Packet packet(rgb);
+        const unsigned pending = (1u << count) - 1u;
+
+        SearchInvLut3DTree(tree, packet, rgb, pending, results);
+
+        for (unsigned lane = 0; lane < count; ++lane)
+        {
+            const float * in = src + 4 * (start + lane);
+            float * out = dst + 4 * (start + lane);
+
+            // Need to subtract 1 since the indices include the extrapolation.
+            for (unsigned c = 0; c < 3; ++c)
+            {
+                const float val = results[c][lane] - 1.f;
+                const float clamped = 0.f < val ? val : 0.f;
+                out[c] = (tree.maxDim < clamped ? tree.maxDim : clamped) * tree.scale;
+            }
+            out[3] = in[3];
+        }
+    }
+}
+
+} // namespace OCIO_NAMESPACE
+
+#endif /* INCLUDED_OCIO_LUT3DOP_CPU_INVSEARCH_H */
@@ -309,6 +309,35 @@ static inline void applyTetrahedralSSE2Func(const float *lut3d, int dim, const f
         }
     }
 }
+
+// RGB values of a packet of pixels for the exact inverse search.
+struct InvLut3DPacketSSE2
+{
+    static constexpr unsigned size = 4;
+
+    explicit InvLut3DPacketSSE2(const float (&rgb)[3][4])
+        : r(_mm_loadu_ps(rgb[0]))
+        , g(_mm_loadu_ps(rgb[1]))
+        , b(_mm_loadu_ps(rgb[2]))
+    {
+    }
+
+    static void clearUpperState() {}
+
+    unsigned inRange(const float * minVals, const float * maxVals) const
+    {
+        __m128 mask = _mm_cmpge_ps(r, _mm_set1_ps(minVals[0]));
+        mask = _mm_and_ps(mask, _mm_cmpge_ps(g, _mm_set1_ps(minVals[1])));
+        mask = _mm_and_ps(mask, _mm_cmpge_ps(b, _mm_set1_ps(minVals[2])));
+        mask = _mm_and_ps(mask, _mm_cmple_ps(r, _mm_set1_ps(maxVals[0])));
+        mask = _mm_and_ps(mask, _mm_cmple_ps(g, _mm_set1_ps(maxVals[1])));
+        mask = _mm_and_ps(mask, _mm_cmple_ps(b, _mm_set1_ps(maxVals[2])));
+        return (unsigned)_mm_movemask_ps(mask);
+    }
+
+    __m128 r, g, b;
+};
+
 } // anonymous namespace
 
 void applyTetrahedralSSE2(const float *lut3d, int dim, const float *src, float *dst, int total_pixel_count)
@@ -316,6 +345,11 @@ void applyTetrahedralSSE2(const float *lut3d, int dim, const float *src, float *
     applyTetrahedralSSE2Func<BIT_DEPTH_F32, BIT_DEPTH_F32>(lut3d, dim, src, dst, total_pixel_count);
 }
 
+void applyInvTetrahedralSSE2(const InvLut3DTreeView & tree, const float *src, float *dst, long total_pixel_count)
+{
+    ApplyInvLut3DTree<InvLut3DPacketSSE2>(tree, src, dst, total_pixel_count);
+}
+
 } // OCIO_NAMESPACE
 
 #endif // OCIO_USE_SSE2
\ No newline at end of file
@@ -7,6 +7,7 @@
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "CPUInfo.h"
+#include "ops/lut3d/Lut3DOpCPU_InvSearch.h"
 
 #if OCIO_USE_SSE2
 namespace OCIO_NAMESPACE
@@ -14,6 +15,9 @@ namespace OCIO_NAMESPACE
 
 void applyTetrahedralSSE2(const float *lut3d, int dim, const float *src, float *dst, int total_pixel_count);
 
+// Exact inverse using a vectorized search of the RangeTree (4 pixels at once).
+void applyInvTetrahedralSSE2(const InvLut3DTreeView & tree, const float *src, float *dst, long total_pixel_count);
+
 } // namespace OCIO_NAMESPACE
 
 #endif // OCIO_USE_SSE2
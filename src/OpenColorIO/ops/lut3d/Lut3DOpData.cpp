@@ -6,6 +6,7 @@
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "BitDepthUtils.h"
+#include "DiskCache.h"
 #include "HashUtils.h"
 #include "MathUtils.h"
 #include "ops/lut3d/Lut3DOp.h"
@@ -34,27 +35,55 @@ Lut3DOpDataRcPtr MakeFastLut3DFromInverse(ConstLut3DOpDataRcPtr & lut)
         throw Exception("MakeFastLut3DFromInverse expects an inverse LUT");
     }
 
+    // The processes sharing the disk cache only build the fast LUT once.
+    CacheIDDigest diskCacheKey;
+    const bool useDiskCache = DiskCache::IsEnabled();
+    if (useDiskCache)
+    {
+        CacheIDHasher hasher;
+        hasher.update("MakeFastLut3DFromInverse");
+        DiskCache::UpdateKey(hasher, *lut);
+        diskCacheKey = hasher.digest();
+
+        ConstOpDataVec data;
+        if (DiskCache::Load(diskCacheKey, data) && data.size() == 1)
+        {
+            if (auto fastLut = DiskCache::CopyAs<Lut3DOpData>(data[0]))
+            {
+                return fastLut;
+            }
+        }
+    }
+
     // TODO: The FastLut will limit inputs to [0,1].  If the forward LUT has an extended range
     // output, perhaps add a Range op before the FastLut to bring values into [0,1].
 
-    // Make a domain for the composed Lut3D.
-    // TODO: Using a large number like 48 here is better for accuracy,
-    // but it causes a delay when creating the renderer.
-    const long GridSize = 48u;
-    Lut3DOpDataRcPtr newDomain = std::make_shared<Lut3DOpData>(GridSize);
+    // Make a domain for the composed Lut3D, at least as fine as the LUT.
+    // TODO: Using a large number like 48 here is better for accuracy. Larger sizes are now
+    // practical as the domain is evaluated in parallel.
+    const unsigned long GridSize = std::max(48ul, lut->getArray().getLength());
 
-    newDomain->setFileOutputBitDepth(lut->getFileOutputBitDepth());
+    // Compose the new domain with our inverse LUT (using INV_EXACT style).
+    OpRcPtrVec ops;
+    Lut3DOpDataRcPtr nonConstLut = std::const_pointer_cast<Lut3DOpData>(lut);
+    CreateLut3DOp(ops, nonConstLut, TRANSFORM_DIR_FORWARD);
 
-    ConstLut3DOpDataRcPtr constNewDomain = newDomain;
+    Lut3DOpDataRcPtr result = Lut3DOpData::ComposeVec(ops, GridSize);
 
-    // Compose the LUT newDomain with our inverse LUT (using INV_EXACT style).
-    Lut3DOpDataRcPtr result = Lut3DOpData::Compose(constNewDomain, lut);
+    result->getFormatMetadata().combine(lut->getFormatMetadata());
+    result->setFileOutputBitDepth(lut->getFileOutputBitDepth());
 
     // The INV_EXACT inversion style computes an inverse to the tetrahedral
     // style of forward evaluation.
     // TODO: Although this seems like the "correct" thing to do, it does
     // not seem to help accuracy (and is slower).  To investigate ...
     //result->setInterpolation(INTERP_TETRAHEDRAL);
+
+    if (useDiskCache)
+    {
+        DiskCache::Save(diskCacheKey, { result });
+    }
+
     return result;
 }
 
@@ -76,10 +105,9 @@ Lut3DOpDataRcPtr Lut3DOpData::Compose(ConstLut3DOpDataRcPtr & lutc1,
 {
     // TODO: Composition of LUTs is a potentially lossy operation.
     // We try to be safe by making the result at least as big as either lut1 or
-    // lut2 but we may want to even increase the resolution further.  However,
-    // currently composition is done pairs at a time and we would want to
-    // determine the increase size once at the start rather than bumping it up
-    // as each pair is done.
+    // lut2 but we may want to even increase the resolution further.  Note that
+    // composition is done pairs at a time, use ComposeVec() to determine the
+    // size once at the start for a whole set of ops.
 
     Lut3DOpDataRcPtr lut1 = std::const_pointer_cast<Lut3DOpData>(lutc1);
     Lut3DOpDataRcPtr lut2 = std::const_pointer_cast<Lut3DOpData>(lutc2);
@@ -136,12 +164,12 @@ Lut3DOpDataRcPtr Lut3DOpData::Compose(ConstLut3DOpDataRcPtr & lutc1,
 
     result->setFileOutputBitDepth(fileOutBD);
 
-    const Array::Values & domain = result->getArray().getValues();
+    float * domain = result->getArray().getValues().mutableData();
     const long gridSize = result->getArray().getLength();
     const long numPixels = gridSize * gridSize * gridSize;
 
-    EvalTransform((const float*)(&domain[0]),
-                  (float*)(&domain[0]),
+    EvalTransform(domain,
+                  domain,
                   numPixels,
                   ops);
 
@@ -155,6 +183,37 @@ Lut3DOpDataRcPtr Lut3DOpData::Compose(ConstLut3DOpDataRcPtr & lutc1,
     return result;
 }
 
+Lut3DOpDataRcPtr Lut3DOpData::ComposeVec(OpRcPtrVec & ops, unsigned long gridSize)
+{
+    if (ops.empty())
+    {
+        throw Exception("There is nothing to compose the 3D LUT with");
+    }
+
+    if (gridSize < 2 || gridSize > maxSupportedLength)
+    {
+        std::ostringstream oss;
+        oss << "3D LUT grid size '" << gridSize
+            << "' must be between 2 and " << maxSupportedLength << ".";
+        throw Exception(oss.str().c_str());
+    }
+
+    // The result starts as an identity i.e. its values are the domain to evaluate.
+    Lut3DOpDataRcPtr result = std::make_shared<Lut3DOpData>(gridSize);
+
+    float * values = result->getArray().getValues().mutableData();
+    const long numPixels = (long)(gridSize * gridSize * gridSize);
+
+    // Evaluate the whole lattice through all the ops at 32f.
+    // Note: If any ops are bypassed, that will be respected here.
+    EvalTransform(values,
+                  values,
+                  numPixels,
+                  ops);
+
+    return result;
+}
+
 Lut3DOpData::Lut3DArray::Lut3DArray(unsigned long length)
 {
     resize(length, getMaxColorComponents());
@@ -180,7 +239,7 @@ void Lut3DOpData::Lut3DArray::fill()
     const long length = getLength();
     const long maxChannels = getMaxColorComponents();
 
-    Array::Values& values = getValues();
+    float * values = getValues().mutableData();
 
     const float stepValue = 1.0f / ((float)length - 1.0f);
 
@@ -228,7 +287,7 @@ void Lut3DOpData::Lut3DArray::setRGB(long i, long j, long k, float* RGB)
 {
     const long length = getLength();
     const long maxChannels = getMaxColorComponents();
-    Array::Values& values = getValues();
+    float * values = getValues().mutableData();
     // Array order matches ctf order: channels vary most rapidly, then B, G, R.
     long offset = (i*length*length + j*length + k) * maxChannels;
     values[offset] = RGB[0];
@@ -241,8 +300,8 @@ void Lut3DOpData::Lut3DArray::scale(float scaleFactor)
     // Don't scale if scaleFactor = 1.0f.
     if (scaleFactor != 1.0f)
     {
-        Array::Values& arrayVals = getValues();
-        const size_t size = arrayVals.size();
+        const size_t size = getValues().size();
+        float * arrayVals = getValues().mutableData();
 
         for (size_t i = 0; i < size; i++)
         {
@@ -323,6 +382,7 @@ void Lut3DOpData::setArrayFromRedFastestOrder(const std::vector<float> & lut)
         throw Exception(oss.str().c_str());
     }
 
+    float * lutValues = lutArray.getValues().mutableData();
     for (unsigned long b = 0; b < lutSize; ++b)
     {
         for (unsigned long g = 0; g < lutSize; ++g)
@@ -335,9 +395,9 @@ void Lut3DOpData::setArrayFromRedFastestOrder(const std::vector<float> & lut)
                 // Float array index. Red changes fastest.
                 const unsigned long redFastIdx = 3 * ((b*lutSize + g)*lutSize + r);
 
-                lutArray[blueFastIdx + 0] = lut[redFastIdx + 0];
-                lutArray[blueFastIdx + 1] = lut[redFastIdx + 1];
-                lutArray[blueFastIdx + 2] = lut[redFastIdx + 2];
+                lutValues[blueFastIdx + 0] = lut[redFastIdx + 0];
+                lutValues[blueFastIdx + 1] = lut[redFastIdx + 1];
+                lutValues[blueFastIdx + 2] = lut[redFastIdx + 2];
             }
         }
     }
@@ -467,26 +527,21 @@ Lut3DOpDataRcPtr Lut3DOpData::inverse() const
     return invLut;
 }
 
-std::string Lut3DOpData::getCacheID() const
+void Lut3DOpData::writeCacheID(std::ostream & os) const
 {
     AutoMutex lock(m_mutex);
 
     const Lut3DArray::Values & values = getArray().getValues();
 
-    std::ostringstream cacheIDStream;
     if (!getID().empty())
     {
-        cacheIDStream << getID() << " ";
+        os << getID() << " ";
     }
 
-    cacheIDStream << CacheIDHash(reinterpret_cast<const char*>(&values[0]),
-                                 values.size() * sizeof(values[0]))
-                  << " ";
-
-    cacheIDStream << InterpolationToString(m_interpolation)  << " ";
-    cacheIDStream << TransformDirectionToString(m_direction) << " ";
+    os << CacheIDHashDigest(&values[0], values.size() * sizeof(values[0])) << " ";
 
-    return cacheIDStream.str();
+    os << InterpolationToString(m_interpolation)  << " ";
+    os << TransformDirectionToString(m_direction) << " ";
 }
 
 void Lut3DOpData::scale(float scale)
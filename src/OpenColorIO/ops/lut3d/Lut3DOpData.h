@@ -30,6 +30,11 @@ public:
     // approximates the effect of the pair of ops.
     static Lut3DOpDataRcPtr Compose(ConstLut3DOpDataRcPtr & lut1, ConstLut3DOpDataRcPtr & lut2);
 
+    // Calculate a new 3D LUT of the requested grid size by evaluating its domain through the
+    // whole set of ops in a single pass (rather than composing pairs at a time). The ops will
+    // be finalized.
+    static Lut3DOpDataRcPtr ComposeVec(OpRcPtrVec & ops, unsigned long gridSize);
+
 public:
     // The gridSize parameter is the length of the cube axis.
     explicit Lut3DOpData(unsigned long gridSize);
@@ -83,7 +88,7 @@ public:
 
     bool equals(const OpData& other) const override;
 
-    std::string getCacheID() const override;
+    void writeCacheID(std::ostream & os) const override;
 
     inline BitDepth getFileOutputBitDepth() const { return m_fileOutBitDepth; }
     inline void setFileOutputBitDepth(BitDepth out) { m_fileOutBitDepth = out; }
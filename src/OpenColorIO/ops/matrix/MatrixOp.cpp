@@ -58,7 +58,7 @@ public:
     void combineWith(OpRcPtrVec & ops, ConstOpRcPtr & secondOp) const override;
 
     void finalize() override;
-    std::string getCacheID() const override;
+    void writeCacheID(std::ostream & os) const override;
 
     ConstOpCPURcPtr getCPUOp(bool fastLogExpPow) const override;
 
@@ -170,15 +170,12 @@ void MatrixOffsetOp::finalize()
     }
 }
 
-std::string MatrixOffsetOp::getCacheID() const
+void MatrixOffsetOp::writeCacheID(std::ostream & os) const
 {
     // Create the cacheID
-    std::ostringstream cacheIDStream;
-    cacheIDStream << "<MatrixOffsetOp ";
-    cacheIDStream << matrixData()->getCacheID() << " ";
-    cacheIDStream << ">";
-
-    return cacheIDStream.str();
+    os << "<MatrixOffsetOp ";
+    matrixData()->writeCacheID(os);
+    os << " >";
 }
 
 ConstOpCPURcPtr MatrixOffsetOp::getCPUOp(bool /*fastLogExpPow*/) const
@@ -14,6 +14,89 @@ namespace OCIO_NAMESPACE
 namespace
 {
 
+// Apply a matrix (i.e. by columns) with an optional offset on planar pixels. The operation order
+// is the same as the packed processing to produce identical results.
+template<bool hasOffset>
+void ApplyMatrixPlanar(const float * const in[4],
+                       float * const out[4],
+                       long numPixels,
+                       const float (&column1)[4],
+                       const float (&column2)[4],
+                       const float (&column3)[4],
+                       const float (&column4)[4],
+                       const float (&offset)[4])
+{
+    long idx = 0;
+
+#if OCIO_USE_SSE2
+    __m128 m0[4], m1[4], m2[4], m3[4], o[4];
+    for (int c = 0; c < 4; ++c)
+    {
+        m0[c] = _mm_set1_ps(column1[c]);
+        m1[c] = _mm_set1_ps(column2[c]);
+        m2[c] = _mm_set1_ps(column3[c]);
+        m3[c] = _mm_set1_ps(column4[c]);
+        o[c]  = _mm_set1_ps(offset[c]);
+    }
+
+    // Process four pixels at once i.e. all the vector lanes hold the same channel.
+    for (; idx + 4 <= numPixels; idx += 4)
+    {
+        const __m128 r = _mm_loadu_ps(in[0] + idx);
+        const __m128 g = _mm_loadu_ps(in[1] + idx);
+        const __m128 b = _mm_loadu_ps(in[2] + idx);
+        const __m128 a = _mm_loadu_ps(in[3] + idx);
+
+        __m128 img[4];
+        for (int c = 0; c < 4; ++c)
+        {
+            const __m128 rm0 = _mm_mul_ps(m0[c], r);
+            const __m128 gm1 = _mm_mul_ps(m1[c], g);
+            const __m128 bm2 = _mm_mul_ps(m2[c], b);
+            const __m128 am3 = _mm_mul_ps(m3[c], a);
+
+            img[c] = _mm_add_ps(_mm_add_ps(rm0, gm1), _mm_add_ps(bm2, am3));
+            if (hasOffset)
+            {
+                img[c] = _mm_add_ps(img[c], o[c]);
+            }
+        }
+
+        _mm_storeu_ps(out[0] + idx, img[0]);
+        _mm_storeu_ps(out[1] + idx, img[1]);
+        _mm_storeu_ps(out[2] + idx, img[2]);
+        _mm_storeu_ps(out[3] + idx, img[3]);
+    }
+#endif
+
+    for (; idx < numPixels; ++idx)
+    {
+        const float r = in[0][idx];
+        const float g = in[1][idx];
+        const float b = in[2][idx];
+        const float a = in[3][idx];
+
+        float img[4];
+        for (int c = 0; c < 4; ++c)
+        {
+#if OCIO_USE_SSE2
+            img[c] = (r*column1[c] + g*column2[c]) + (b*column3[c] + a*column4[c]);
+#else
+            img[c] = r*column1[c] + g*column2[c] + b*column3[c] + a*column4[c];
+#endif
+            if (hasOffset)
+            {
+                img[c] += offset[c];
+            }
+        }
+
+        out[0][idx] = img[0];
+        out[1][idx] = img[1];
+        out[2][idx] = img[2];
+        out[3][idx] = img[3];
+    }
+}
+
 class ScaleRenderer : public OpCPU
 {
 public:
@@ -23,6 +106,11 @@ public:
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
 
+    bool hasPlanarApply() const override { return true; }
+    void applyPlanar(const float * const inPlanes[4],
+                     float * const outPlanes[4],
+                     long numPixels) const override;
+
 private:
     float m_scale[4];
 };
@@ -36,6 +124,11 @@ public:
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
 
+    bool hasPlanarApply() const override { return true; }
+    void applyPlanar(const float * const inPlanes[4],
+                     float * const outPlanes[4],
+                     long numPixels) const override;
+
 private:
     float m_scale[4];
     float m_offset[4];
@@ -50,6 +143,11 @@ public:
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
 
+    bool hasPlanarApply() const override { return true; }
+    void applyPlanar(const float * const inPlanes[4],
+                     float * const outPlanes[4],
+                     long numPixels) const override;
+
 private:
 
     float m_column1[4];
@@ -69,6 +167,11 @@ public:
 
     void apply(const void * inImg, void * outImg, long numPixels) const override;
 
+    bool hasPlanarApply() const override { return true; }
+    void applyPlanar(const float * const inPlanes[4],
+                     float * const outPlanes[4],
+                     long numPixels) const override;
+
 private:
     float m_column1[4];
     float m_column2[4];
@@ -104,6 +207,23 @@ void ScaleRenderer::apply(const void * inImg, void * outImg, long numPixels) con
     }
 }
 
+void ScaleRenderer::applyPlanar(const float * const inPlanes[4],
+                                float * const outPlanes[4],
+                                long numPixels) const
+{
+    for (int c = 0; c < 4; ++c)
+    {
+        const float * in = inPlanes[c];
+        float * out = outPlanes[c];
+        const float scale = m_scale[c];
+
+        for (long idx = 0; idx < numPixels; ++idx)
+        {
+            out[idx] = in[idx] * scale;
+        }
+    }
+}
+
 ScaleWithOffsetRenderer::ScaleWithOffsetRenderer(ConstMatrixOpDataRcPtr & mat)
     : OpCPU()
 {
@@ -139,6 +259,24 @@ void ScaleWithOffsetRenderer::apply(const void * inImg, void * outImg, long numP
     }
 }
 
+void ScaleWithOffsetRenderer::applyPlanar(const float * const inPlanes[4],
+                                          float * const outPlanes[4],
+                                          long numPixels) const
+{
+    for (int c = 0; c < 4; ++c)
+    {
+        const float * in = inPlanes[c];
+        float * out = outPlanes[c];
+        const float scale = m_scale[c];
+        const float offset = m_offset[c];
+
+        for (long idx = 0; idx < numPixels; ++idx)
+        {
+            out[idx] = in[idx] * scale + offset;
+        }
+    }
+}
+
 MatrixWithOffsetRenderer::MatrixWithOffsetRenderer(ConstMatrixOpDataRcPtr & mat)
     : OpCPU()
 {
@@ -287,6 +425,14 @@ void MatrixWithOffsetRenderer::apply(const void * inImg, void * outImg, long num
 
 }
 
+void MatrixWithOffsetRenderer::applyPlanar(const float * const inPlanes[4],
+                                           float * const outPlanes[4],
+                                           long numPixels) const
+{
+    ApplyMatrixPlanar<true>(inPlanes, outPlanes, numPixels,
+                            m_column1, m_column2, m_column3, m_column4, m_offset);
+}
+
 MatrixRenderer::MatrixRenderer(ConstMatrixOpDataRcPtr & mat)
     : OpCPU()
 {
@@ -395,6 +541,16 @@ void MatrixRenderer::apply(const void * inImg, void * outImg, long numPixels) co
 #endif
 }
 
+void MatrixRenderer::applyPlanar(const float * const inPlanes[4],
+                                 float * const outPlanes[4],
+                                 long numPixels) const
+{
+    static constexpr float noOffset[4]{ 0.0f, 0.0f, 0.0f, 0.0f };
+
+    ApplyMatrixPlanar<false>(inPlanes, outPlanes, numPixels,
+                             m_column1, m_column2, m_column3, m_column4, noOffset);
+}
+
 }
 
 ConstOpCPURcPtr GetMatrixRenderer(ConstMatrixOpDataRcPtr & mat)
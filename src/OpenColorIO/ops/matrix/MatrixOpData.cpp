@@ -116,7 +116,7 @@ MatrixOpData::MatrixArrayPtr MatrixOpData::MatrixArray::inner(const MatrixArray
     const ArrayDouble::Values & Bvals = B_4x4.getValues();
 
     MatrixArrayPtr OutPtr = std::make_shared<MatrixArray>();
-    ArrayDouble::Values& Ovals = OutPtr->getValues();
+    double * Ovals = OutPtr->getValues().mutableData();
 
     const unsigned long dim = OutPtr->getLength();
 
@@ -170,12 +170,13 @@ MatrixOpData::MatrixArrayPtr MatrixOpData::MatrixArray::inverse() const
     // will be expanded if only 3x3.
     validate();
 
-    MatrixArray t(*this);
+    MatrixArray tArray(*this);
+    double * t = tArray.getValues().mutableData();
 
     // Create a new matrix array.
     // The new matrix is initialized as identity.
     MatrixArrayPtr invPtr = std::make_shared<MatrixArray>();
-    MatrixArray & s = *invPtr;
+    double * s = invPtr->getValues().mutableData();
 
     const unsigned long dim = invPtr->getLength();
 
@@ -283,7 +284,7 @@ MatrixOpData::MatrixArrayPtr MatrixOpData::MatrixArray::inverse() const
 template<typename T>
 void MatrixOpData::MatrixArray::setRGB(const T * values)
 {
-    Values & v = getValues();
+    double * v = getValues().mutableData();
 
     v[ 0] = double(values[0]);
     v[ 1] = double(values[1]);
@@ -346,9 +347,10 @@ bool MatrixOpData::MatrixArray::isUnityDiagonal() const
 void MatrixOpData::MatrixArray::fill()
 {
     const unsigned long dim = getLength();
-    ArrayDouble::Values & values = getValues();
+    const size_t numValues = getValues().size();
+    double * values = getValues().mutableData();
 
-    std::memset(&values[0], 0, values.size() * sizeof(double));
+    std::memset(values, 0, numValues * sizeof(double));
 
     for (unsigned long i = 0; i<dim; ++i)
     {
@@ -373,7 +375,7 @@ void MatrixOpData::MatrixArray::expandFrom3x3To4x4()
 
 void MatrixOpData::MatrixArray::setRGBA(const float * values)
 {
-    Values & v = getValues();
+    double * v = getValues().mutableData();
 
     v[0] = values[0];
     v[1] = values[1];
@@ -398,8 +400,7 @@ void MatrixOpData::MatrixArray::setRGBA(const float * values)
 
 void MatrixOpData::MatrixArray::setRGBA(const double * values)
 {
-    Values & v = getValues();
-    std::memcpy(&v[0], values, 16 * sizeof(double));
+    std::memcpy(getValues().mutableData(), values, 16 * sizeof(double));
 }
 
 void MatrixOpData::MatrixArray::validate() const
@@ -458,7 +459,7 @@ MatrixOpDataRcPtr MatrixOpData::clone() const
 
 void MatrixOpData::setArrayValue(unsigned long index, double value)
 {
-    m_array.getValues()[index] = value;
+    m_array.getValues().mutableData()[index] = value;
 }
 
 double MatrixOpData::getArrayValue(unsigned long index) const
@@ -835,29 +836,23 @@ MatrixOpDataRcPtr MatrixOpData::getAsForward() const
     return invOp;
 }
 
-std::string MatrixOpData::getCacheID() const
+void MatrixOpData::writeCacheID(std::ostream & os) const
 {
     AutoMutex lock(m_mutex);
 
-    std::ostringstream cacheIDStream;
     if (!getID().empty())
     {
-        cacheIDStream << getID() << " ";
+        os << getID() << " ";
     }
 
-    cacheIDStream << TransformDirectionToString(m_direction) << " ";
+    os << TransformDirectionToString(m_direction) << " ";
 
-    std::string hash;
-    hash += CacheIDHash(
-        (const char *) &(getArray().getValues()[0]),
-        16 * sizeof(double));
-    hash += CacheIDHash(
-        (const char *) getOffsets().getValues(),
-        4 * sizeof(double));
+    // Hash of the matrix & offsets hashes.
+    CacheIDHashStream hash;
+    hash << CacheIDHashDigest(&(getArray().getValues()[0]), 16 * sizeof(double));
+    hash << CacheIDHashDigest(getOffsets().getValues(), 4 * sizeof(double));
 
-    cacheIDStream << CacheIDHash(hash.c_str(), hash.size());
-
-    return cacheIDStream.str();
+    os << hash.digest();
 }
 
 void MatrixOpData::scale(double inScale, double outScale)
@@ -197,7 +197,7 @@ public:
     // Returns true if the op's output combines input channels.
     bool hasChannelCrosstalk() const override { return !isDiagonal(); }
 
-    std::string getCacheID() const override;
+    void writeCacheID(std::ostream & os) const override;
 
     // Check if the matrix array is a no-op (ignoring the offsets).
     bool isUnityDiagonal() const;
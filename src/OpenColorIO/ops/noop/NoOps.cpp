@@ -42,7 +42,7 @@ public:
     bool isSameType(ConstOpRcPtr & op) const override;
     bool isInverse(ConstOpRcPtr & op) const override;
 
-    std::string getCacheID() const override;
+    void writeCacheID(std::ostream & os) const override;
 
     ConstOpCPURcPtr getCPUOp(bool /*fastLogExpPow*/) const override { return nullptr; }
 
@@ -80,9 +80,9 @@ bool AllocationNoOp::isInverse(ConstOpRcPtr & op) const
     return true;
 }
 
-std::string AllocationNoOp::getCacheID() const
+void AllocationNoOp::writeCacheID(std::ostream & os) const
 {
-    return m_allocationData.getCacheID();
+    os << m_allocationData.getCacheID();
 }
 
 void AllocationNoOp::getGpuAllocation(AllocationData & allocation) const
@@ -192,12 +192,12 @@ OpRcPtrVec Create3DLut(const OpRcPtrVec & ops, unsigned edgelen)
     }
 
     // Convert the RGBA image to an RGB image, in place.
-    auto & lutArray = lut->getArray();
+    float * lutValues = lut->getArray().getValues().mutableData();
     for(unsigned i=0; i<lut3DNumPixels; ++i)
     {
-        lutArray[3*i+0] = lut3D[4*i+0];
-        lutArray[3*i+1] = lut3D[4*i+1];
-        lutArray[3*i+2] = lut3D[4*i+2];
+        lutValues[3*i+0] = lut3D[4*i+0];
+        lutValues[3*i+1] = lut3D[4*i+1];
+        lutValues[3*i+2] = lut3D[4*i+2];
     }
 
     OpRcPtrVec newOps;
@@ -313,7 +313,7 @@ public:
     bool isInverse(ConstOpRcPtr & op) const override;
     void dumpMetadata(ProcessorMetadataRcPtr & metadata) const override;
 
-    std::string getCacheID() const override;
+    void writeCacheID(std::ostream & os) const override;
 
     ConstOpCPURcPtr getCPUOp(bool /*fastLogExpPow*/) const override { return nullptr; }
 
@@ -355,9 +355,9 @@ void FileNoOp::dumpMetadata(ProcessorMetadataRcPtr & metadata) const
     metadata->addFile(fileData->getPath().c_str());
 }
 
-std::string FileNoOp::getCacheID() const
+void FileNoOp::writeCacheID(std::ostream & os) const
 {
-    return m_fileReference;
+    os << m_fileReference;
 }
 
 }
@@ -399,7 +399,7 @@ public:
     bool isInverse(ConstOpRcPtr & op) const override;
     void dumpMetadata(ProcessorMetadataRcPtr & metadata) const override;
 
-    std::string getCacheID() const override;
+    void writeCacheID(std::ostream & os) const override;
 
     ConstOpCPURcPtr getCPUOp(bool /*fastLogExpPow*/) const override { return nullptr; }
 
@@ -439,9 +439,9 @@ void LookNoOp::dumpMetadata(ProcessorMetadataRcPtr & metadata) const
     metadata->addLook(m_look.c_str());
 }
 
-std::string LookNoOp::getCacheID() const
+void LookNoOp::writeCacheID(std::ostream & os) const
 {
-    return m_look;
+    os << m_look;
 }
 
 }
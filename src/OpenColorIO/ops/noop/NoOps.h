@@ -46,7 +46,7 @@ public:
     bool isNoOp() const override { return true; }
     bool isIdentity() const override { return true; }
     bool hasChannelCrosstalk() const override { return false; }
-    std::string getCacheID() const override { return ""; }
+    void writeCacheID(std::ostream & /*os*/) const override { }
     void validate() const override {}
 };
 
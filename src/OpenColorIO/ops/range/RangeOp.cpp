@@ -47,7 +47,7 @@ public:
     void combineWith(OpRcPtrVec & ops, ConstOpRcPtr & secondOp) const override;
 
     void finalize() override;
-    std::string getCacheID() const override;
+    void writeCacheID(std::ostream & os) const override;
 
     ConstOpCPURcPtr getCPUOp(bool fastLogExpPow) const override;
 
@@ -182,15 +182,12 @@ void RangeOp::finalize()
     }
 }
 
-std::string RangeOp::getCacheID() const
+void RangeOp::writeCacheID(std::ostream & os) const
 {
     // Create the cacheID
-    std::ostringstream cacheIDStream;
-    cacheIDStream << "<RangeOp ";
-    cacheIDStream << rangeData()->getCacheID() << " ";
-    cacheIDStream << ">";
-
-    return cacheIDStream.str();
+    os << "<RangeOp ";
+    rangeData()->writeCacheID(os);
+    os << " >";
 }
 
 ConstOpCPURcPtr RangeOp::getCPUOp(bool /*fastLogExpPow*/) const
@@ -13,6 +13,20 @@
 namespace OCIO_NAMESPACE
 {
 
+namespace
+{
+
+// The range does not modify the alpha channel.
+void CopyAlphaPlane(const float * const inPlanes[4], float * const outPlanes[4], long numPixels)
+{
+    if (inPlanes[3] != outPlanes[3])
+    {
+        std::copy(inPlanes[3], inPlanes[3] + numPixels, outPlanes[3]);
+    }
+}
+
+} // anon
+
 class RangeOpCPU : public OpCPU
 {
 public:
@@ -35,6 +49,11 @@ public:
     RangeScaleMinMaxRenderer(ConstRangeOpDataRcPtr & range);
 
     virtual void apply(const void * inImg, void * outImg, long numPixels) const override;
+
+    bool hasPlanarApply() const override { return true; }
+    void applyPlanar(const float * const inPlanes[4],
+                     float * const outPlanes[4],
+                     long numPixels) const override;
 };
 
 class RangeMinMaxRenderer : public RangeOpCPU
@@ -43,6 +62,11 @@ public:
     RangeMinMaxRenderer(ConstRangeOpDataRcPtr & range);
 
     virtual void apply(const void * inImg, void * outImg, long numPixels) const override;
+
+    bool hasPlanarApply() const override { return true; }
+    void applyPlanar(const float * const inPlanes[4],
+                     float * const outPlanes[4],
+                     long numPixels) const override;
 };
 
 class RangeMinRenderer : public RangeOpCPU
@@ -51,6 +75,11 @@ public:
     RangeMinRenderer(ConstRangeOpDataRcPtr & range);
 
     virtual void apply(const void * inImg, void * outImg, long numPixels) const override;
+
+    bool hasPlanarApply() const override { return true; }
+    void applyPlanar(const float * const inPlanes[4],
+                     float * const outPlanes[4],
+                     long numPixels) const override;
 };
 
 class RangeMaxRenderer : public RangeOpCPU
@@ -59,6 +88,11 @@ public:
     RangeMaxRenderer(ConstRangeOpDataRcPtr & range);
 
     virtual void apply(const void * inImg, void * outImg, long numPixels) const override;
+
+    bool hasPlanarApply() const override { return true; }
+    void applyPlanar(const float * const inPlanes[4],
+                     float * const outPlanes[4],
+                     long numPixels) const override;
 };
 
 
@@ -102,6 +136,25 @@ void RangeScaleMinMaxRenderer::apply(const void * inImg, void * outImg, long num
     }
 }
 
+void RangeScaleMinMaxRenderer::applyPlanar(const float * const inPlanes[4],
+                                           float * const outPlanes[4],
+                                           long numPixels) const
+{
+    for (int c = 0; c < 3; ++c)
+    {
+        const float * in = inPlanes[c];
+        float * out = outPlanes[c];
+
+        for (long idx = 0; idx < numPixels; ++idx)
+        {
+            // NaNs become m_lowerBound.
+            out[idx] = Clamp(in[idx] * m_scale + m_offset, m_lowerBound, m_upperBound);
+        }
+    }
+
+    CopyAlphaPlane(inPlanes, outPlanes, numPixels);
+}
+
 RangeMinMaxRenderer::RangeMinMaxRenderer(ConstRangeOpDataRcPtr & range)
     :  RangeOpCPU(range)
 {
@@ -125,6 +178,25 @@ void RangeMinMaxRenderer::apply(const void * inImg, void * outImg, long numPixel
     }
 }
 
+void RangeMinMaxRenderer::applyPlanar(const float * const inPlanes[4],
+                                      float * const outPlanes[4],
+                                      long numPixels) const
+{
+    for (int c = 0; c < 3; ++c)
+    {
+        const float * in = inPlanes[c];
+        float * out = outPlanes[c];
+
+        for (long idx = 0; idx < numPixels; ++idx)
+        {
+            // NaNs become m_lowerBound.
+            out[idx] = Clamp(in[idx], m_lowerBound, m_upperBound);
+        }
+    }
+
+    CopyAlphaPlane(inPlanes, outPlanes, numPixels);
+}
+
 RangeMinRenderer::RangeMinRenderer(ConstRangeOpDataRcPtr & range)
     :  RangeOpCPU(range)
 {
@@ -148,6 +220,25 @@ void RangeMinRenderer::apply(const void * inImg, void * outImg, long numPixels)
     }
 }
 
+void RangeMinRenderer::applyPlanar(const float * const inPlanes[4],
+                                   float * const outPlanes[4],
+                                   long numPixels) const
+{
+    for (int c = 0; c < 3; ++c)
+    {
+        const float * in = inPlanes[c];
+        float * out = outPlanes[c];
+
+        for (long idx = 0; idx < numPixels; ++idx)
+        {
+            // NaNs become m_lowerBound.
+            out[idx] = std::max(m_lowerBound, in[idx]);
+        }
+    }
+
+    CopyAlphaPlane(inPlanes, outPlanes, numPixels);
+}
+
 RangeMaxRenderer::RangeMaxRenderer(ConstRangeOpDataRcPtr & range)
     :  RangeOpCPU(range)
 {
@@ -171,6 +262,25 @@ void RangeMaxRenderer::apply(const void * inImg, void * outImg, long numPixels)
     }
 }
 
+void RangeMaxRenderer::applyPlanar(const float * const inPlanes[4],
+                                   float * const outPlanes[4],
+                                   long numPixels) const
+{
+    for (int c = 0; c < 3; ++c)
+    {
+        const float * in = inPlanes[c];
+        float * out = outPlanes[c];
+
+        for (long idx = 0; idx < numPixels; ++idx)
+        {
+            // NaNs become m_upperBound.
+            out[idx] = std::min(m_upperBound, in[idx]);
+        }
+    }
+
+    CopyAlphaPlane(inPlanes, outPlanes, numPixels);
+}
+
 
 ConstOpCPURcPtr GetRangeRenderer(ConstRangeOpDataRcPtr & range)
 {
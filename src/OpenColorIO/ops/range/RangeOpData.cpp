@@ -574,27 +574,24 @@ RangeOpDataRcPtr RangeOpData::getAsForward() const
     return invOp;
 }
 
-std::string RangeOpData::getCacheID() const
+void RangeOpData::writeCacheID(std::ostream & os) const
 {
     AutoMutex lock(m_mutex);
 
-    std::ostringstream cacheIDStream;
     if (!getID().empty())
     {
-        cacheIDStream << getID() << " ";
+        os << getID() << " ";
     }
 
-    cacheIDStream << TransformDirectionToString(m_direction) << " ";
+    os << TransformDirectionToString(m_direction) << " ";
 
-    cacheIDStream.precision(DefaultValues::FLOAT_DECIMALS);
+    os.precision(DefaultValues::FLOAT_DECIMALS);
 
-    cacheIDStream << "[" << m_minInValue
-                  << ", " << m_maxInValue
-                  << ", " << m_minOutValue
-                  << ", " << m_maxOutValue
-                  << "]";
-
-    return cacheIDStream.str();
+    os << "[" << m_minInValue
+       << ", " << m_maxInValue
+       << ", " << m_minOutValue
+       << ", " << m_maxOutValue
+       << "]";
 }
 
 void RangeOpData::normalize()
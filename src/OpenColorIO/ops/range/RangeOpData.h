@@ -111,7 +111,7 @@ public:
 
     // Validate the state of the instance and initialize private members.
     void validate() const override;
-    std::string getCacheID() const override;
+    void writeCacheID(std::ostream & os) const override;
 
     Type getType() const override { return RangeType; }
 
@@ -59,9 +59,9 @@ bool ReferenceOpData::equals(const OpData& other) const
     return true;
 }
 
-std::string ReferenceOpData::getCacheID() const
+void ReferenceOpData::writeCacheID(std::ostream & /*os*/) const
 {
-    throw Exception("ReferenceOpData::getCacheID should never be called. ReferenceOpData does "
+    throw Exception("ReferenceOpData::writeCacheID should never be called. ReferenceOpData does "
                     "not have a corresponding Op");
 }
 
@@ -44,7 +44,7 @@ public:
 
     bool equals(const OpData& other) const override;
 
-    std::string getCacheID() const override;
+    void writeCacheID(std::ostream & os) const override;
 
     ReferenceStyle getReferenceStyle() const
     {
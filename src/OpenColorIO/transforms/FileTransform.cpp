@@ -2,6 +2,7 @@
 // Copyright Contributors to the OpenColorIO Project.
 
 #include <algorithm>
+#include <cstdlib>
 #include <fstream>
 #include <map>
 #include <sstream>
@@ -14,10 +15,14 @@
 #include <OpenColorIO/OpenColorIO.h>
 
 #include "Caching.h"
+#include "DiskCache.h"
 #include "FileTransform.h"
 #include "Logging.h"
 #include "Mutex.h"
 #include "OCIOZArchive.h"
+#include "ops/lut1d/Lut1DOpData.h"
+#include "ops/lut3d/Lut3DOpData.h"
+#include "ops/matrix/MatrixOpData.h"
 #include "ops/noop/NoOps.h"
 #include "PathUtils.h"
 #include "Platform.h"
@@ -589,6 +594,34 @@ void FileFormat::write(const ConstConfigRcPtr & /*config*/,
     throw Exception(os.str().c_str());
 }
 
+size_t GetOpDataMemorySize(const ConstOpDataRcPtr & data)
+{
+    if (!data)
+    {
+        return 0;
+    }
+
+    const OpData::Type type = data->getType();
+    if (type == OpData::Lut1DType)
+    {
+        auto lut = OCIO_DYNAMIC_POINTER_CAST<const Lut1DOpData>(data);
+        return sizeof(Lut1DOpData) + lut->getArray().getValues().size() * sizeof(float);
+    }
+    else if (type == OpData::Lut3DType)
+    {
+        auto lut = OCIO_DYNAMIC_POINTER_CAST<const Lut3DOpData>(data);
+        return sizeof(Lut3DOpData) + lut->getArray().getValues().size() * sizeof(float);
+    }
+    else if (type == OpData::MatrixType)
+    {
+        auto matrix = OCIO_DYNAMIC_POINTER_CAST<const MatrixOpData>(data);
+        return sizeof(MatrixOpData) + matrix->getArray().getValues().size() * sizeof(double);
+    }
+
+    // The other op data only hold a few parameters.
+    return sizeof(OpData);
+}
+
 namespace
 {
 
@@ -791,12 +824,28 @@ struct FileCacheResult
 
 typedef OCIO_SHARED_PTR<FileCacheResult> FileCacheResultPtr;
 
+// The file content cache evicting the least recently used files when its memory budget is
+// exceeded. The memory footprint of a file is the estimated size of its loaded content (refer to
+// CachedFile::getMemorySize).
+class FileCache : public LRUCache<std::string, FileCacheResultPtr>
+{
+public:
+    FileCache()
+    {
+        std::string budget;
+        if (Platform::Getenv(OCIO_FILE_CACHE_BUDGET, budget))
+        {
+            // Note: An invalid value means no limit.
+            setBudget(static_cast<size_t>(std::strtoull(budget.c_str(), nullptr, 10)));
+        }
+    }
+};
+
 } // namespace
 
 
 // A global file content cache.
-template class GenericCache<std::string, FileCacheResultPtr>;
-GenericCache<std::string, FileCacheResultPtr> g_fileCache;
+FileCache g_fileCache;
 
 void GetCachedFileAndFormat(FileFormat * & format,
                             CachedFileRcPtr & cachedFile,
@@ -808,28 +857,9 @@ void GetCachedFileAndFormat(FileFormat * & format,
     // the data creation. It was originally done to improve the multi-threaded
     // file lookup.  Refer to PR #309 for details.
 
-    // Load the file cache ptr from the global map
-    FileCacheResultPtr result;
-    {
-        AutoMutex guard(g_fileCache.lock());
-    
-        if (g_fileCache.isEnabled())
-        {
-            // As the entry is a shared pointer instance, having an empty one
-            // means that the entry does not exist in the cache. So, it provides
-            // a fast existence check.
-            result = g_fileCache[filepath];
-            if (!result)
-            {
-                result = std::make_shared<FileCacheResult>();
-                g_fileCache[filepath] = result;
-            }
-        }
-        else
-        {
-            result = std::make_shared<FileCacheResult>();
-        }
-    }
+    // Load the file cache ptr from the global cache (only locking the shard holding the entry).
+    FileCacheResultPtr result
+        = g_fileCache.getOrCreate(filepath, []() { return std::make_shared<FileCacheResult>(); });
 
     // If this file has already been loaded, return the result immediately.
 
@@ -856,6 +886,12 @@ void GetCachedFileAndFormat(FileFormat * & format,
             os << filepath;
             result->exceptionText = os.str();
         }
+
+        // Now that the content is loaded, account for its memory footprint (which could evict
+        // the least recently used files).
+        const size_t contentSize = result->cachedFile ? result->cachedFile->getMemorySize() : 0;
+        g_fileCache.setCost(filepath,
+                            sizeof(FileCacheResult) + result->exceptionText.size() + contentSize);
     }
 
     if (result->error)
@@ -892,6 +928,80 @@ void ClearFileTransformCaches()
     g_fileCache.clear();
 }
 
+void SetFileCacheBudget(size_t numBytes)
+{
+    g_fileCache.setBudget(numBytes);
+    DiskCache::SetMemoryBudget(numBytes);
+}
+
+size_t GetFileCacheBudget()
+{
+    return g_fileCache.getBudget();
+}
+
+void GetFileCacheStatistics(size_t & numHits,
+                            size_t & numMisses,
+                            size_t & numEvictions,
+                            size_t & numEntries,
+                            size_t & numBytes)
+{
+    const FileCache::Statistics stats = g_fileCache.getStatistics();
+
+    numHits      = stats.m_hits;
+    numMisses    = stats.m_misses;
+    numEvictions = stats.m_evictions;
+    numEntries   = stats.m_entries;
+    numBytes     = stats.m_cost;
+}
+
+namespace
+{
+
+// Build the disk cache key of the file ops. Return false if the file does not exist.
+bool GetFileDiskCacheKey(CacheIDDigest & key,
+                         const std::string & filepath,
+                         const ConstContextRcPtr & context,
+                         const FileTransform & fileTransform,
+                         TransformDirection dir)
+{
+    CacheIDHasher hasher;
+    hasher.update("FileTransform");
+    if (!DiskCache::UpdateKey(hasher, filepath))
+    {
+        return false;
+    }
+
+    const Interpolation interp = fileTransform.getInterpolation();
+    const CDLStyle cdlStyle    = fileTransform.getCDLStyle();
+    hasher.update(&interp, sizeof(interp))
+          .update(&cdlStyle, sizeof(cdlStyle))
+          .update(&dir, sizeof(dir))
+          .update(context->resolveStringVar(fileTransform.getCCCId()));
+
+    key = hasher.digest();
+    return true;
+}
+
+// Store the file ops only if they are all supported by the disk cache (e.g. a CTF could
+// reference other files or contain any op).
+void SaveFileOps(const CacheIDDigest & key, const OpRcPtrVec & ops, size_t firstFileOp)
+{
+    ConstOpDataVec data;
+    for (size_t idx = firstFileOp; idx < ops.size(); ++idx)
+    {
+        ConstOpRcPtr op = ops[idx];
+        if (!DiskCache::IsSupported(*op->data()))
+        {
+            return;
+        }
+        data.push_back(op->data());
+    }
+
+    DiskCache::Save(key, data);
+}
+
+} // namespace
+
 void BuildFileTransformOps(OpRcPtrVec & ops,
                            const Config& config,
                            const ConstContextRcPtr & context,
@@ -930,6 +1040,26 @@ void BuildFileTransformOps(OpRcPtrVec & ops,
         }
     }
 
+    // The disk cache is not used when the files are read through a proxy (e.g. archived config).
+    CacheIDDigest diskCacheKey;
+    const bool useDiskCache = DiskCache::IsEnabled() && !config.getConfigIOProxy()
+        && GetFileDiskCacheKey(diskCacheKey, filepath, context, fileTransform, dir);
+
+    ConstOpDataVec diskCacheData;
+    if (useDiskCache && DiskCache::Load(diskCacheKey, diskCacheData))
+    {
+        CreateFileNoOp(ops, filepath);
+        ConstOpRcPtr fileNoOpConst = ops.back();
+
+        for (const auto & data : diskCacheData)
+        {
+            CreateOpVecFromOpData(ops, data, TRANSFORM_DIR_FORWARD);
+        }
+
+        DynamicPtrCast<const FileNoOpData>(fileNoOpConst->data())->setComplete();
+        return;
+    }
+
     FileFormat* format = NULL;
     CachedFileRcPtr cachedFile;
 
@@ -946,11 +1076,17 @@ void BuildFileTransformOps(OpRcPtrVec & ops,
 
         ConstOpRcPtr fileNoOpConst = ops.back();
         OpRcPtr fileNoOp = ops.back();
+        const size_t firstFileOp = ops.size();
 
         // CTF implementation of FileFormat::buildFileOps might call
         // BuildFileTransformOps for References.
         format->buildFileOps(ops, config, context, cachedFile, fileTransform, dir);
 
+        if (useDiskCache)
+        {
+            SaveFileOps(diskCacheKey, ops, firstFileOp);
+        }
+
         // File has been loaded completely. It may now be referenced again.
         ConstOpDataRcPtr data = fileNoOpConst->data();
         auto fileData = DynamicPtrCast<const FileNoOpData>(data);
@@ -30,10 +30,21 @@ public:
     {
         throw Exception("Not a CDL file format.");
     }
+
+    // Return the estimated memory footprint (in bytes) of the loaded file content, which is
+    // charged to the file cache budget (refer to SetFileCacheBudget).
+    virtual size_t getMemorySize() const
+    {
+        return sizeof(CachedFile);
+    }
 };
 
 typedef OCIO_SHARED_PTR<CachedFile> CachedFileRcPtr;
 
+// Return the estimated memory footprint (in bytes) of the op data i.e. mostly the LUT values.
+// A null op data has no footprint.
+size_t GetOpDataMemorySize(const ConstOpDataRcPtr & data);
+
 enum FormatCapabilityFlags : unsigned int
 {
     FORMAT_CAPABILITY_NONE  = 0,
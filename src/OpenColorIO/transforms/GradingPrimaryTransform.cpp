@@ -85,7 +85,7 @@ void GradingPrimaryTransformImpl::setStyle(GradingStyle style) noexcept
     data().setStyle(style);
 }
 
-const GradingPrimary & GradingPrimaryTransformImpl::getValue() const
+GradingPrimary GradingPrimaryTransformImpl::getValue() const
 {
     return data().getValue();
 }
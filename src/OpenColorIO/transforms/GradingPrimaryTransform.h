@@ -38,7 +38,7 @@ public:
 
     void setStyle(GradingStyle style) noexcept override;
 
-    const GradingPrimary & getValue() const override;
+    GradingPrimary getValue() const override;
     void setValue(const GradingPrimary & values) override;
 
     bool isDynamic() const noexcept override;
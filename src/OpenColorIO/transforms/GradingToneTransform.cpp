@@ -85,7 +85,7 @@ void GradingToneTransformImpl::setStyle(GradingStyle style) noexcept
     data().setStyle(style);
 }
 
-const GradingTone & GradingToneTransformImpl::getValue() const
+GradingTone GradingToneTransformImpl::getValue() const
 {
     return data().getValue();
 }
@@ -38,7 +38,7 @@ public:
 
     void setStyle(GradingStyle style) noexcept override;
 
-    const GradingTone & getValue() const override;
+    GradingTone getValue() const override;
     void setValue(const GradingTone & values) override;
 
     bool isDynamic() const noexcept override;
@@ -123,9 +123,10 @@ void CheckLUT1DIndex(const char * function, unsigned long index, unsigned long s
 void Lut1DTransformImpl::setValue(unsigned long index, float r, float g, float b)
 {
     CheckLUT1DIndex("setValue", index, getLength());
-    data().getArray()[3 * index] = r;
-    data().getArray()[3 * index + 1] = g;
-    data().getArray()[3 * index + 2] = b;
+    float * values = data().getArray().getValues().mutableData();
+    values[3 * index] = r;
+    values[3 * index + 1] = g;
+    values[3 * index + 2] = b;
 }
 
 void Lut1DTransformImpl::setInputHalfDomain(bool isHalfDomain) noexcept
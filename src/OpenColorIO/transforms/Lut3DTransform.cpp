@@ -138,9 +138,10 @@ void Lut3DTransformImpl::setValue(unsigned long indexR,
 
     // Array is stored in blue-fastest order.
     const unsigned long arrayIdx = 3 * ((indexR*gs + indexG)*gs + indexB);
-    m_data.getArray()[arrayIdx] = r;
-    m_data.getArray()[arrayIdx + 1] = g;
-    m_data.getArray()[arrayIdx + 2] = b;
+    float * values = m_data.getArray().getValues().mutableData();
+    values[arrayIdx] = r;
+    values[arrayIdx + 1] = g;
+    values[arrayIdx + 2] = b;
 }
 
 
@@ -61,8 +61,7 @@ void CreateLut(OpRcPtrVec & ops,
     lut->setInterpolation(INTERP_LINEAR);
     lut->setDirection(TRANSFORM_DIR_FORWARD);
 
-    Array & array = lut->getArray();
-    Array::Values & values = array.getValues();
+    float * values = lut->getArray().getValues().mutableData();
 
     for (unsigned long idx = 0; idx < lutDimension; ++idx)
     {
@@ -82,7 +81,7 @@ void CreateLut(OpRcPtrVec & ops,
     lut->setInterpolation(INTERP_LINEAR);
     lut->setDirection(TRANSFORM_DIR_FORWARD);
 
-    Array::Values & values = lut->getArray().getValues();
+    float * values = lut->getArray().getValues().mutableData();
 
     for (unsigned long idx = 0; idx < lutDimension; ++idx)
     {
@@ -113,7 +112,7 @@ void CreateHalfLut(OpRcPtrVec & ops, std::function<float(double)> lutValueGenera
     lut->setDirection(TRANSFORM_DIR_FORWARD);
 
     Array & array = lut->getArray();
-    Array::Values & values = array.getValues();
+    float * values = array.getValues().mutableData();
 
     const unsigned long lutDimension = array.getLength();
     for (unsigned long idx = 0; idx < lutDimension; ++idx)
@@ -1,6 +1,7 @@
 // SPDX-License-Identifier: BSD-3-Clause
 // Copyright Contributors to the OpenColorIO Project.
 
+#include <algorithm>
 #include <chrono>
 #include <cstdlib>
 #include <iostream>
@@ -52,6 +53,8 @@ int main(int argc, const char **argv)
     std::string outputDepth;
     std::string inputconfig;
 
+    int numThreads              = 1;
+
     bool usegpu                 = false;
     bool usegpuLegacy           = false;
     bool outputgpuInfo          = false;
@@ -87,6 +90,8 @@ int main(int argc, const char **argv)
                "--help",                &help,                  "Display the help and exit",
                "-v" ,                   &verbose,               "Display general information",
               "--iconfig %s",           &inputconfig,           "Input .ocio configuration file (default: $OCIO)",
+               "--threads %d",          &numThreads,            "Number of threads used for the CPU color processing "
+                                                                "(0 means all the hardware threads, default is 1)",
                "<SEPARATOR>", "\nOpenImageIO or OpenEXR options:",
                "--bitdepth %s",         &outputDepth,  "Output image bitdepth",
                "--float-attribute %L",  &floatAttrs,   "\"name=float\" pair defining OIIO float attribute "
@@ -560,12 +565,12 @@ int main(int argc, const char **argv)
             {
                 OCIO::ImageDescRcPtr srcImgDesc = imgInput.getImageDesc();
                 OCIO::ImageDescRcPtr dstImgDesc = imgOutputCPU.getImageDesc();
-                cpuProcessor->apply(*srcImgDesc, *dstImgDesc);
+                cpuProcessor->apply(*srcImgDesc, *dstImgDesc, (unsigned)std::max(0, numThreads));
             }
             else
             {
                 OCIO::ImageDescRcPtr imgDesc = imgInput.getImageDesc();
-                cpuProcessor->apply(*imgDesc);
+                cpuProcessor->apply(*imgDesc, (unsigned)std::max(0, numThreads));
             }
 
             if (verbose)
@@ -7,6 +7,11 @@
 #include "apputils/argparse.h"
 #include "utils/StringUtils.h"
 
+// Count all the heap allocations (including the ones from the library) to measure the
+// allocations done by the apply calls.
+#define OCIO_REPLACE_ALLOCATION_FUNCTIONS
+#include "utils/AllocationCounting.h"
+
 #include <chrono>
 #include <cmath>
 #include <limits>
@@ -15,6 +20,60 @@
 
 namespace OCIO = OCIO_NAMESPACE;
 
+// Utility to count the heap allocations of the apply calls.
+class AllocationCounter
+{
+public:
+    AllocationCounter() = delete;
+    AllocationCounter(const AllocationCounter &) = delete;
+
+    explicit AllocationCounter(const char * explanation)
+        :   m_explanations(explanation)
+    {
+    }
+
+    ~AllocationCounter()
+    {
+        if (!m_counts.empty())
+        {
+            size_t others = 0;
+            for (size_t idx = 1; idx < m_counts.size(); ++idx)
+            {
+                others += m_counts[idx];
+            }
+
+            std::ostringstream oss;
+            oss << m_explanations
+                << "For " << m_counts.size() << " apply calls, heap allocations per call: ["
+                << m_counts[0];
+
+            if (m_counts.size() > 1)
+            {
+                oss << ", " << (float(others) / float(m_counts.size() - 1));
+            }
+
+            oss << "]";
+
+            std::cout << oss.str() << std::endl;
+        }
+    }
+
+    void resume()
+    {
+        m_start = AllocationCounting::GetNumAllocations();
+    }
+
+    void pause()
+    {
+        m_counts.push_back(AllocationCounting::GetNumAllocations() - m_start);
+    }
+
+private:
+    const std::string m_explanations;
+    size_t m_start { 0 };
+    std::vector<size_t> m_counts;
+};
+
 // Utility to measure time in ms.
 class CustomMeasure
 {
@@ -110,6 +169,7 @@ private:
 
 // Process the complete image line by line.
 void ProcessLines(CustomMeasure & m,
+                  AllocationCounter & allocs,
                   OCIO::ConstCPUProcessorRcPtr & cpuProcessor,
                   const OCIO::PackedImageDesc & img)
 {
@@ -130,7 +190,9 @@ void ProcessLines(CustomMeasure & m,
                                         OCIO::AutoStride);
 
         // Apply the color transformation (in place).
+        allocs.resume();
         cpuProcessor->apply(imageDesc);
+        allocs.pause();
 
         // Find the next line.
         lineToProcess += img.getYStrideBytes();
@@ -176,7 +238,10 @@ int main(int argc, const char **argv)
     std::string inColorSpace, outColorSpace, display, view;
     std::string inBitDepthStr("f32"), outBitDepthStr("f32");
     unsigned iterations = 50;
-    bool nocache = false, nooptim = false;
+    unsigned numThreads = 1;
+    unsigned chunkSize = 0;
+    bool nocache = false, nooptim = false, f32prefix = false;
+    unsigned bakeLut3D = 0;
 
     bool useColorspaces = false;
     bool useDisplayview = false;
@@ -218,6 +283,18 @@ int main(int argc, const char **argv)
                                             "Bypass all caches. Default is false",
                "--nooptim",                 &nooptim, 
                                             "Disable the processor optimizations. Default is false",
+               "--f32prefix",               &f32prefix,
+                                            "Replace the separable ops processing a F32 input by a "\
+                                            "half-domain 1D LUT (lossy). Default is false",
+               "--bakelut3d %d",            &bakeLut3D,
+                                            "Bake the ops into a 3D LUT of that edge length, preceded by "\
+                                            "a log2 shaper for float input (lossy). Default is 0 i.e. disabled",
+               "--threads %d",              &numThreads,
+                                            "Number of threads used to process the complete image "\
+                                            "(0 means all the hardware threads). Default is 1",
+               "--chunk %d",                &chunkSize,
+                                            "Number of pixels processed at once by the chain of CPU ops "\
+                                            "(0 means the complete line). Default is 0",
                NULL);
 
     if (ap.parse (argc, argv) < 0)
@@ -420,9 +497,17 @@ int main(int argc, const char **argv)
             throw OCIO::Exception("Missing color transformation description.");
         }
 
-        const OCIO::OptimizationFlags optimFlags
+        OCIO::OptimizationFlags optimFlags
             = nooptim ? OCIO::OPTIMIZATION_NONE : OCIO::OPTIMIZATION_DEFAULT;
 
+        OCIO::CPUApproximations approximations;
+        approximations.m_separablePrefixF32 = f32prefix;
+        if (bakeLut3D)
+        {
+            approximations.m_bakeLut3D           = true;
+            approximations.m_bakeLut3DEdgeLength = bakeLut3D;
+        }
+
         auto GetBitDepthFromString = [](const std::string & str) -> OCIO::BitDepth 
         {
             OCIO::BitDepth bd = OCIO::BIT_DEPTH_F32;
@@ -506,7 +591,8 @@ int main(int argc, const char **argv)
                 m.resume();
                 cpuProcessor = optProcessor->getOptimizedCPUProcessor(inBitDepth,
                                                                       outBitDepth,
-                                                                      optimFlags);
+                                                                      optimFlags,
+                                                                      approximations);
                 m.pause();
             }
         }
@@ -514,6 +600,8 @@ int main(int argc, const char **argv)
         std::cout << std::endl << std::endl;
         std::cout << "Image processing statistics:" << std::endl << std::endl;
 
+        OCIO::SetCPUProcessorChunkSize(chunkSize);
+
         // Create an arbitrary 4K RGBA image.
 
         static constexpr size_t width  = 3840;
@@ -583,27 +671,52 @@ int main(int argc, const char **argv)
 
             if (inBitDepth == outBitDepth)
             {
-                CustomMeasure m("Process the complete image (in place):\t\t\t\t", iterations);
+                // When a chunk size is requested, also measure the processing by complete lines
+                // to report the speedup.
+                std::vector<unsigned> chunkSizes{ chunkSize };
+                if (chunkSize != 0)
+                {
+                    chunkSizes.insert(chunkSizes.begin(), 0);
+                }
 
-                for(unsigned iter=0; iter<iterations; ++iter)
+                for (unsigned size : chunkSizes)
                 {
-                    std::vector<float>    inImg_f32  = img_f32_ref;
-                    std::vector<uint16_t> inImg_ui16 = img_ui16_ref;
+                    OCIO::SetCPUProcessorChunkSize(size);
 
-                    OCIO::PackedImageDesc imgDesc(inBitDepth == OCIO::BIT_DEPTH_F32
-                                                    ? (void*)&inImg_f32[0] : (void*)&inImg_ui16[0], 
-                                                  width, 
-                                                  height,
-                                                  numChannels,
-                                                  inBitDepth,
-                                                  OCIO::AutoStride,
-                                                  OCIO::AutoStride,
-                                                  OCIO::AutoStride);
+                    const std::string msg
+                        = size == 0 ? "Process the complete image (in place):\t\t\t\t"
+                                    : "Process the complete image (in place) by chunks of "
+                                        + std::to_string(size) + " pixels:\t";
 
-                    // Apply the color transformation.
-                    m.resume();
-                    cpuProcessor->apply(imgDesc);
-                    m.pause();
+                    CustomMeasure m(msg.c_str(), iterations);
+
+                    for(unsigned iter=0; iter<iterations; ++iter)
+                    {
+                        std::vector<float>    inImg_f32  = img_f32_ref;
+                        std::vector<uint16_t> inImg_ui16 = img_ui16_ref;
+
+                        OCIO::PackedImageDesc imgDesc(inBitDepth == OCIO::BIT_DEPTH_F32
+                                                        ? (void*)&inImg_f32[0] : (void*)&inImg_ui16[0], 
+                                                      width, 
+                                                      height,
+                                                      numChannels,
+                                                      inBitDepth,
+                                                      OCIO::AutoStride,
+                                                      OCIO::AutoStride,
+                                                      OCIO::AutoStride);
+
+                        // Apply the color transformation.
+                        m.resume();
+                        if (numThreads == 1)
+                        {
+                            cpuProcessor->apply(imgDesc);
+                        }
+                        else
+                        {
+                            cpuProcessor->apply(imgDesc, numThreads);
+                        }
+                        m.pause();
+                    }
                 }
             }
 
@@ -642,16 +755,27 @@ int main(int argc, const char **argv)
                 // Use a custom cpu processor as input and output bit depths could be different.
                 auto cpu = optProcessor->getOptimizedCPUProcessor(inBitDepth,
                                                                   outBitDepth,
-                                                                  optimFlags);
+                                                                  optimFlags,
+                                                                  approximations);
 
+                AllocationCounter allocs("Process the complete image (two buffers):\t\t\t");
                 CustomMeasure m("Process the complete image (two buffers):\t\t\t", iterations);
 
                 for(unsigned iter=0; iter<iterations; ++iter)
                 {
                     // Apply the color transformation.
+                    allocs.resume();
                     m.resume();
-                    cpu->apply(inImgDesc, outImgDesc);
+                    if (numThreads == 1)
+                    {
+                        cpu->apply(inImgDesc, outImgDesc);
+                    }
+                    else
+                    {
+                        cpu->apply(inImgDesc, outImgDesc, numThreads);
+                    }
                     m.pause();
+                    allocs.pause();
                 }
             }
         }
@@ -673,11 +797,12 @@ int main(int argc, const char **argv)
                                             OCIO::AutoStride,
                                             OCIO::AutoStride);
 
+            AllocationCounter allocs("Process the complete image (in place) but line by line:\t\t");
             CustomMeasure m("Process the complete image (in place) but line by line:\t\t", iterations);
 
             for(unsigned iter=0; iter<iterations; ++iter)
             {
-                ProcessLines(m, cpuProcessor, inImgDesc);
+                ProcessLines(m, allocs, cpuProcessor, inImgDesc);
             }
         }
 
@@ -20,7 +20,7 @@ int main(int argc, const char **argv)
 {
     bool verbose = false;
     std::string inputColorSpace, outputColorSpace, display, view;
-    std::string filepath;
+    std::string filepath, snapshotpath;
 
     bool help = false;
 
@@ -44,7 +44,8 @@ int main(int argc, const char **argv)
 
     ArgParse ap;
     ap.options("ociowrite -- write a color transformation to a file\n\n"
-               "usage: ociowrite [options] --file outputfile\n\n",
+               "usage: ociowrite [options] --file outputfile\n"
+               "       ociowrite [options] --snapshot outputfile\n\n",
                "--h",                       &help, 
                                             "Display the help and exit",
                "--help",                    &help, 
@@ -61,6 +62,9 @@ int main(int argc, const char **argv)
                                             "Provide the (display, view) pair and output color space to apply on the image",
                "--file %s",                 &filepath, 
                                             pathDesc.c_str(),
+               "--snapshot %s",             &snapshotpath,
+                                            "Write a binary snapshot of the ${OCIO} config, "
+                                            "which loads faster than the YAML config",
                NULL);
 
     if (argc <= 1 || ap.parse(argc, argv) < 0)
@@ -98,6 +102,48 @@ int main(int argc, const char **argv)
         }
     }
 
+    // Write the config snapshot.
+    if (!snapshotpath.empty())
+    {
+        if (!filepath.empty())
+        {
+            std::cerr << std::endl;
+            std::cerr << "The --snapshot and --file options are mutually exclusive." << std::endl;
+            exit(1);
+        }
+
+        try
+        {
+            const char * env = OCIO::GetEnvVariable("OCIO");
+            if (!env || !*env)
+            {
+                std::cerr << std::endl;
+                std::cerr << "Missing the ${OCIO} env. variable." << std::endl;
+                exit(1);
+            }
+
+            // Only a valid config is worth a snapshot.
+            OCIO::ConstConfigRcPtr config = OCIO::Config::CreateFromEnv();
+            config->validate();
+
+            // Throw if the file could not be written.
+            config->serializeSnapshot(snapshotpath.c_str());
+
+            if (verbose)
+            {
+                std::cout << std::endl;
+                std::cout << "Config snapshot written to: " << snapshotpath << std::endl;
+            }
+        }
+        catch(OCIO::Exception & exception)
+        {
+            std::cerr << "OCIO Error: " << exception.what() << std::endl;
+            exit(1);
+        }
+
+        return 0;
+    }
+
     if (filepath.empty())
     {
         std::cerr << std::endl;
@@ -43,6 +43,10 @@ void bindPyCPUProcessor(py::module & m)
              DOC(CPUProcessor, hasDynamicProperty))
         .def("isDynamic", &CPUProcessor::isDynamic,
              DOC(CPUProcessor, isDynamic))
+        .def("beginDynamicPropertyUpdate", &CPUProcessor::beginDynamicPropertyUpdate,
+             DOC(CPUProcessor, beginDynamicPropertyUpdate))
+        .def("commitDynamicPropertyUpdate", &CPUProcessor::commitDynamicPropertyUpdate,
+             DOC(CPUProcessor, commitDynamicPropertyUpdate))
 
         .def("apply", [](CPUProcessorRcPtr & self, PyImageDesc & imgDesc) 
             {
@@ -90,6 +94,33 @@ written to the dstImgDesc image, leaving srcImgDesc unchanged.
     pointer. The dedicated packed ``apply*`` methods utilize 
     ``ImageDesc`` on the C++ side so avoid the copy.
 
+)doc")
+        .def("apply", [](CPUProcessorRcPtr & self, PyImageDesc & imgDesc, unsigned numThreads) 
+            {
+                self->apply((*imgDesc.m_img), numThreads);
+            },
+             "imgDesc"_a, "numThreads"_a,
+             py::call_guard<py::gil_scoped_release>(), 
+             R"doc(
+Same as above but the image is split in numThreads bands of lines which 
+are processed concurrently. A numThreads of 0 uses the number of hardware 
+threads. The result is identical to the single threaded apply.
+
+)doc")
+        .def("apply", [](CPUProcessorRcPtr & self, 
+                         PyImageDesc & srcImgDesc, 
+                         PyImageDesc & dstImgDesc,
+                         unsigned numThreads)
+            {
+                self->apply((*srcImgDesc.m_img), (*dstImgDesc.m_img), numThreads);
+            },
+             "srcImgDesc"_a, "dstImgDesc"_a, "numThreads"_a,
+             py::call_guard<py::gil_scoped_release>(),
+             R"doc(
+Same as above but the image is split in numThreads bands of lines which 
+are processed concurrently. A numThreads of 0 uses the number of hardware 
+threads. The result is identical to the single threaded apply.
+
 )doc")
         .def("applyRGB", [](CPUProcessorRcPtr & self, py::buffer & data) 
             {
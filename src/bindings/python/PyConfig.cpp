@@ -254,6 +254,19 @@ void bindPyConfig(py::module & m)
                 return os.str();
             }, 
              DOC(Config, serialize))
+        .def("serializeSnapshot", [](ConfigRcPtr & self, const std::string & fileName) 
+            {
+                self->serializeSnapshot(fileName.c_str());
+            }, 
+             "fileName"_a, 
+             DOC(Config, serializeSnapshot))
+        .def("serializeSnapshot", [](ConfigRcPtr & self) 
+            {
+                std::ostringstream os;
+                self->serializeSnapshot(os);
+                return py::bytes(os.str());
+            }, 
+             DOC(Config, serializeSnapshot))
         .def("getCacheID", (const char * (Config::*)() const) &Config::getCacheID, 
              DOC(Config, getCacheID))
         .def("getCacheID", 
@@ -965,6 +978,24 @@ void bindPyConfig(py::module & m)
              DOC(Config, setProcessorCacheFlags))
         .def("clearProcessorCache", &Config::clearProcessorCache, 
              DOC(Config, setProcessorCacheFlags))
+        .def("setProcessorCacheLimits", &Config::setProcessorCacheLimits, 
+             "maxProcessors"_a, "maxBytes"_a,
+             DOC(Config, setProcessorCacheLimits))
+        .def("getProcessorCacheLimits", [](ConfigRcPtr & self)
+            {
+                size_t maxProcessors = 0, maxBytes = 0;
+                self->getProcessorCacheLimits(maxProcessors, maxBytes);
+                return py::make_tuple(maxProcessors, maxBytes);
+            },
+             DOC(Config, getProcessorCacheLimits))
+        .def("getProcessorCacheStatistics", [](ConfigRcPtr & self)
+            {
+                size_t numHits = 0, numMisses = 0, numEvictions = 0, numEntries = 0, numBytes = 0;
+                self->getProcessorCacheStatistics(numHits, numMisses, numEvictions, 
+                                                  numEntries, numBytes);
+                return py::make_tuple(numHits, numMisses, numEvictions, numEntries, numBytes);
+            },
+             DOC(Config, getProcessorCacheStatistics))
 
         // Archiving
         .def("isArchivable", &Config::isArchivable, DOC(Config, isArchivable))
@@ -44,7 +44,7 @@ struct OCIOHIDDEN PyDynamicProperty
         throw OCIO::Exception("Invalid dynamic property type (doesn't accept a double).");
     }
 
-    const GradingPrimary & getGradingPrimary()
+    GradingPrimary getGradingPrimary()
     {
         auto propGP = DynamicPropertyValue::AsGradingPrimary(m_prop);
         if (propGP)
@@ -64,7 +64,7 @@ struct OCIOHIDDEN PyDynamicProperty
         throw OCIO::Exception("Invalid dynamic property type (doesn't accept a GradingPrimary).");
     }
 
-    const ConstGradingRGBCurveRcPtr & getGradingRGBCurve()
+    ConstGradingRGBCurveRcPtr getGradingRGBCurve()
     {
         auto propGC = DynamicPropertyValue::AsGradingRGBCurve(m_prop);
         if (propGC)
@@ -84,7 +84,7 @@ struct OCIOHIDDEN PyDynamicProperty
         throw OCIO::Exception("Invalid dynamic property type (doesn't accept a GradingRGBCurve).");
     }
 
-    const ConstGradingHueCurveRcPtr & getGradingHueCurve()
+    ConstGradingHueCurveRcPtr getGradingHueCurve()
     {
         auto propGC = DynamicPropertyValue::AsGradingHueCurve(m_prop);
         if (propGC)
@@ -104,7 +104,7 @@ struct OCIOHIDDEN PyDynamicProperty
         throw OCIO::Exception("Invalid dynamic property type (doesn't accept a GradingHueCurve).");
     }
 
-    const GradingTone & getGradingTone()
+    GradingTone getGradingTone()
     {
         auto propGT = DynamicPropertyValue::AsGradingTone(m_prop);
         if (propGT)
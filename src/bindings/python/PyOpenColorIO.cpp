@@ -40,6 +40,29 @@ PYBIND11_MODULE(PyOpenColorIO, m)
     // Global functions
     m.def("ClearAllCaches", &ClearAllCaches,
           DOC(PyOpenColorIO, ClearAllCaches));
+    m.def("SetFileCacheBudget", &SetFileCacheBudget, "numBytes"_a,
+          DOC(PyOpenColorIO, SetFileCacheBudget));
+    m.def("GetFileCacheBudget", &GetFileCacheBudget,
+          DOC(PyOpenColorIO, GetFileCacheBudget));
+    m.def("GetFileCacheStatistics", []()
+        {
+            size_t numHits = 0, numMisses = 0, numEvictions = 0, numEntries = 0, numBytes = 0;
+            GetFileCacheStatistics(numHits, numMisses, numEvictions, numEntries, numBytes);
+            return py::make_tuple(numHits, numMisses, numEvictions, numEntries, numBytes);
+        },
+          DOC(PyOpenColorIO, GetFileCacheStatistics));
+    m.def("SetDiskCacheDirectory", &SetDiskCacheDirectory, "dirname"_a,
+          DOC(PyOpenColorIO, SetDiskCacheDirectory));
+    m.def("GetDiskCacheDirectory", &GetDiskCacheDirectory,
+          DOC(PyOpenColorIO, GetDiskCacheDirectory));
+    m.def("SetDiskCacheBudget", &SetDiskCacheBudget, "numBytes"_a,
+          DOC(PyOpenColorIO, SetDiskCacheBudget));
+    m.def("GetDiskCacheBudget", &GetDiskCacheBudget,
+          DOC(PyOpenColorIO, GetDiskCacheBudget));
+    m.def("SetCPUProcessorChunkSize", &SetCPUProcessorChunkSize, "numPixels"_a,
+          DOC(PyOpenColorIO, SetCPUProcessorChunkSize));
+    m.def("GetCPUProcessorChunkSize", &GetCPUProcessorChunkSize,
+          DOC(PyOpenColorIO, GetCPUProcessorChunkSize));
     m.def("GetVersion", &GetVersion,
           DOC(PyOpenColorIO, GetVersion));
     m.def("GetVersionHex", &GetVersionHex,
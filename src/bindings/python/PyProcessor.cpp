@@ -30,6 +30,37 @@ void bindPyProcessor(py::module & m)
         py::class_<TransformFormatMetadataIterator>(
             clsProcessor, "TransformFormatMetadataIterator");
 
+    auto clsCPUApproximations = 
+        py::class_<CPUApproximations>(
+            m.attr("CPUApproximations"));
+
+    clsCPUApproximations
+        .def(py::init<>())
+
+        .def("__eq__", [](const CPUApproximations & self, const CPUApproximations & other)
+            {
+                return self == other;
+            }, py::is_operator())
+        .def("__ne__", [](const CPUApproximations & self, const CPUApproximations & other)
+            {
+                return self != other;
+            }, py::is_operator())
+
+        .def_readwrite("separablePrefixF32", &CPUApproximations::m_separablePrefixF32,
+                       DOC(CPUApproximations, m_separablePrefixF32))
+        .def_readwrite("bakeLut3D", &CPUApproximations::m_bakeLut3D,
+                       DOC(CPUApproximations, m_bakeLut3D))
+        .def_readwrite("bakeLut3DEdgeLength", &CPUApproximations::m_bakeLut3DEdgeLength,
+                       DOC(CPUApproximations, m_bakeLut3DEdgeLength))
+        .def_readwrite("bakeLut3DShaperMinStops", &CPUApproximations::m_bakeLut3DShaperMinStops,
+                       DOC(CPUApproximations, m_bakeLut3DShaperMinStops))
+        .def_readwrite("bakeLut3DShaperMaxStops", &CPUApproximations::m_bakeLut3DShaperMaxStops,
+                       DOC(CPUApproximations, m_bakeLut3DShaperMaxStops))
+        .def_readwrite("bakeLut3DMaxError", &CPUApproximations::m_bakeLut3DMaxError,
+                       DOC(CPUApproximations, m_bakeLut3DMaxError))
+        .def("validate", &CPUApproximations::validate,
+             DOC(CPUApproximations, validate));
+
     clsProcessor
         .def("isNoOp", &Processor::isNoOp,
              DOC(Processor, isNoOp))
@@ -89,7 +120,13 @@ void bindPyProcessor(py::module & m)
              (ConstCPUProcessorRcPtr (Processor::*)(BitDepth, BitDepth, OptimizationFlags) const) 
              &Processor::getOptimizedCPUProcessor, 
              "inBitDepth"_a, "outBitDepth"_a, "oFlags"_a,
-             DOC(Processor, getOptimizedCPUProcessor));
+             DOC(Processor, getOptimizedCPUProcessor, 2))
+        .def("getOptimizedCPUProcessor", 
+             (ConstCPUProcessorRcPtr (Processor::*)(BitDepth, BitDepth, OptimizationFlags,
+                                                    const CPUApproximations &) const) 
+             &Processor::getOptimizedCPUProcessor, 
+             "inBitDepth"_a, "outBitDepth"_a, "oFlags"_a, "approximations"_a,
+             DOC(Processor, getOptimizedCPUProcessor, 3));
 
     clsTransformFormatMetadataIterator
         .def("__len__", [](TransformFormatMetadataIterator & it) 
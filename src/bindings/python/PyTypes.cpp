@@ -82,6 +82,10 @@ void bindPyTypes(py::module & m)
         m, "Processor", 
         DOC(Processor));
 
+    py::class_<CPUApproximations>(
+        m, "CPUApproximations", 
+        DOC(CPUApproximations));
+
     py::class_<ProcessorMetadata, ProcessorMetadataRcPtr /* holder */>(
         m, "ProcessorMetadata",
         DOC(ProcessorMetadata));
@@ -946,6 +950,7 @@ void bindPyTypes(py::module & m)
     m.attr("OCIO_INACTIVE_COLORSPACES_ENVVAR") = OCIO_INACTIVE_COLORSPACES_ENVVAR;
     m.attr("OCIO_OPTIMIZATION_FLAGS_ENVVAR") = OCIO_OPTIMIZATION_FLAGS_ENVVAR;
     m.attr("OCIO_USER_CATEGORIES_ENVVAR") = OCIO_USER_CATEGORIES_ENVVAR;
+    m.attr("OCIO_LAZY_LOADING_ENVVAR") = OCIO_LAZY_LOADING_ENVVAR;
 
     // Roles
     m.attr("ROLE_DEFAULT") = ROLE_DEFAULT;
@@ -977,6 +982,9 @@ void bindPyTypes(py::module & m)
     m.attr("OCIO_DISABLE_ALL_CACHES") = OCIO_DISABLE_ALL_CACHES;
     m.attr("OCIO_DISABLE_PROCESSOR_CACHES") = OCIO_DISABLE_PROCESSOR_CACHES;
     m.attr("OCIO_DISABLE_CACHE_FALLBACK") = OCIO_DISABLE_CACHE_FALLBACK;
+    m.attr("OCIO_FILE_CACHE_BUDGET") = OCIO_FILE_CACHE_BUDGET;
+    m.attr("OCIO_DISK_CACHE_DIR") = OCIO_DISK_CACHE_DIR;
+    m.attr("OCIO_DISK_CACHE_BUDGET") = OCIO_DISK_CACHE_BUDGET;
 
     m.attr("OCIO_CONFIG_DEFAULT_NAME") = OCIO_CONFIG_DEFAULT_NAME;
     m.attr("OCIO_CONFIG_DEFAULT_FILE_EXT") = OCIO_CONFIG_DEFAULT_FILE_EXT;
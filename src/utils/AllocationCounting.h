@@ -0,0 +1,107 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#ifndef INCLUDED_ALLOCATIONCOUNTING_H
+#define INCLUDED_ALLOCATIONCOUNTING_H
+
+// Count the heap allocations i.e. the calls to the global operator new, for example to measure
+// the allocations of the apply calls or to check that a code path never allocates.
+//
+// The replacement of the global allocation functions is an opt-in hook of the executable: one
+// (and only one) translation unit of the executable defines OCIO_REPLACE_ALLOCATION_FUNCTIONS
+// before including this header. Without it, the counts stay at zero.
+//
+// Note: The replacement also applies to the shared library except on Windows.
+
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+
+namespace AllocationCounting
+{
+
+// Number of allocations of all the threads.
+inline std::atomic<size_t> g_numAllocations{ 0 };
+
+// Number of allocations of the calling thread.
+inline thread_local size_t g_numThreadAllocations = 0;
+
+inline void CountAllocation()
+{
+    ++g_numAllocations;
+    ++g_numThreadAllocations;
+}
+
+inline size_t GetNumAllocations()
+{
+    return g_numAllocations;
+}
+
+inline size_t GetNumThreadAllocations()
+{
+    return g_numThreadAllocations;
+}
+
+} // namespace AllocationCounting
+
+
+#ifdef OCIO_REPLACE_ALLOCATION_FUNCTIONS
+
+// Note that the other forms (e.g. the array ones) call these ones.
+
+void * operator new(std::size_t size)
+{
+    AllocationCounting::CountAllocation();
+    if (void * ptr = std::malloc(size ? size : 1))
+    {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void * ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void * ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+void * operator new(std::size_t size, std::align_val_t alignment)
+{
+    AllocationCounting::CountAllocation();
+
+    // Over-allocate to align the memory block and to keep the original pointer just before it.
+    const std::size_t align = static_cast<std::size_t>(alignment);
+    void * raw = std::malloc(size + align + sizeof(void *));
+    if (!raw)
+    {
+        throw std::bad_alloc();
+    }
+
+    const std::size_t start = reinterpret_cast<std::size_t>(raw) + sizeof(void *);
+    void ** ptr = reinterpret_cast<void **>((start + align - 1) & ~(align - 1));
+    ptr[-1] = raw;
+    return ptr;
+}
+
+void operator delete(void * ptr, std::align_val_t) noexcept
+{
+    if (ptr)
+    {
+        std::free(reinterpret_cast<void **>(ptr)[-1]);
+    }
+}
+
+void operator delete(void * ptr, std::size_t, std::align_val_t alignment) noexcept
+{
+    operator delete(ptr, alignment);
+}
+
+#endif // OCIO_REPLACE_ALLOCATION_FUNCTIONS
+
+#endif // INCLUDED_ALLOCATIONCOUNTING_H
@@ -0,0 +1,153 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#include <sstream>
+#include <string>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "testutils/UnitTest.h"
+#include "utils/AllocationCounting.h"
+
+namespace OCIO = OCIO_NAMESPACE;
+
+
+#ifndef OCIO_UNIT_TEST_FILES_DIR
+#error Expecting OCIO_UNIT_TEST_FILES_DIR to be defined for tests. Check relevant CMakeLists.txt
+#endif
+
+#define _STR(x) #x
+#define STR(x) _STR(x)
+
+namespace
+{
+
+// Count the heap allocations done by the calling thread while the counter exists.
+class AllocationCounter
+{
+public:
+    AllocationCounter()
+        :   m_start(AllocationCounting::GetNumThreadAllocations())
+    {
+    }
+
+    AllocationCounter(const AllocationCounter &) = delete;
+    AllocationCounter & operator=(const AllocationCounter &) = delete;
+
+    size_t getNumAllocations() const
+    {
+        return AllocationCounting::GetNumThreadAllocations() - m_start;
+    }
+
+private:
+    const size_t m_start;
+};
+
+} // anon.
+
+
+OCIO_ADD_TEST(Allocations, counter)
+{
+    // Check that the allocation functions are replaced i.e. the other tests are meaningful.
+
+    AllocationCounter counter;
+    OCIO::ConfigRcPtr config = OCIO::Config::Create();
+
+    OCIO_CHECK_ASSERT(counter.getNumAllocations() > 0);
+}
+
+OCIO_ADD_TEST(Allocations, processor_cache_hit)
+{
+    // A processor cache hit does not allocate anything, even when the transform uses context
+    // variables.
+
+    static const std::string CONFIG = 
+        "ocio_profile_version: 2\n"
+        "\n"
+        "environment: {LUT: lut1d_green.ctf}\n"
+        "search_path: " STR(OCIO_UNIT_TEST_FILES_DIR) "\n"
+        "\n"
+        "roles:\n"
+        "  default: cs1\n"
+        "\n"
+        "displays:\n"
+        "  disp1:\n"
+        "    - !<View> {name: view1, colorspace: cs3}\n"
+        "\n"
+        "colorspaces:\n"
+        "  - !<ColorSpace>\n"
+        "    name: cs1\n"
+        "\n"
+        "  - !<ColorSpace>\n"
+        "    name: cs2\n"
+        "    from_scene_reference: !<MatrixTransform> {offset: [0.11, 0.12, 0.13, 0]}\n"
+        "\n"
+        "  - !<ColorSpace>\n"
+        "    name: cs3\n"
+        "    from_scene_reference: !<FileTransform> {src: $LUT}\n";
+
+    std::istringstream iss;
+    iss.str(CONFIG);
+
+    OCIO::ConstConfigRcPtr config;
+    OCIO_CHECK_NO_THROW(config = OCIO::Config::CreateFromStream(iss));
+
+    OCIO::ConstContextRcPtr context = config->getCurrentContext();
+
+    for (const char * dst : { "cs2", "cs3" })
+    {
+        OCIO::ColorSpaceTransformRcPtr transform = OCIO::ColorSpaceTransform::Create();
+        transform->setSrc("cs1");
+        transform->setDst(dst);
+
+        OCIO::ConstProcessorRcPtr proc;
+        OCIO_CHECK_NO_THROW(proc = config->getProcessor(context, transform,
+                                                        OCIO::TRANSFORM_DIR_FORWARD));
+
+        size_t numAllocations = 0;
+        OCIO::ConstProcessorRcPtr cachedProc;
+        {
+            AllocationCounter counter;
+            cachedProc = config->getProcessor(context, transform, OCIO::TRANSFORM_DIR_FORWARD);
+            numAllocations = counter.getNumAllocations();
+        }
+
+        OCIO_CHECK_EQUAL(cachedProc, proc);
+        OCIO_CHECK_EQUAL(numAllocations, 0);
+    }
+}
+
+OCIO_ADD_TEST(Allocations, dynamic_properties_pixel_apply)
+{
+    // The single pixel apply calls reuse the dynamic property snapshot of the thread i.e. they
+    // do not allocate.
+
+    OCIO::ExposureContrastTransformRcPtr ec = OCIO::ExposureContrastTransform::Create();
+    ec->setExposure(0.5);
+    ec->makeExposureDynamic();
+
+    OCIO::GradingPrimaryTransformRcPtr gp = OCIO::GradingPrimaryTransform::Create(OCIO::GRADING_LOG);
+    gp->makeDynamic();
+
+    OCIO::GroupTransformRcPtr group = OCIO::GroupTransform::Create();
+    group->appendTransform(ec);
+    group->appendTransform(gp);
+
+    OCIO::ConfigRcPtr config = OCIO::Config::Create();
+    auto cpuProc = config->getProcessor(group)->getDefaultCPUProcessor();
+
+    float rgb[3] = { 0.5f, 0.4f, 0.2f };
+    float rgba[4] = { 0.5f, 0.4f, 0.2f, 1.f };
+    cpuProc->applyRGB(rgb);
+    cpuProc->applyRGBA(rgba);
+
+    size_t numAllocations = 0;
+    {
+        AllocationCounter counter;
+        cpuProc->applyRGB(rgb);
+        cpuProc->applyRGBA(rgba);
+        numAllocations = counter.getNumAllocations();
+    }
+    OCIO_CHECK_EQUAL(numAllocations, 0);
+}
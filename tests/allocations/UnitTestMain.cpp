@@ -0,0 +1,17 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#include "testutils/UnitTest.h"
+
+// Only one translation unit of the executable replaces the global allocation functions.
+#define OCIO_REPLACE_ALLOCATION_FUNCTIONS
+#include "utils/AllocationCounting.h"
+
+
+int main(int argc, const char ** argv)
+{
+    std::cerr << "\n OpenColorIO_Allocations_Unit_Tests \n\n";
+
+    return UnitTestMain(argc, argv);
+}
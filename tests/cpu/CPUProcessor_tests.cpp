@@ -34,6 +34,228 @@ OCIO_ADD_TEST(CPUProcessor, dynamic_properties)
                           "Cannot find dynamic property; not used by CPU processor.");
 }
 
+OCIO_ADD_TEST(CPUProcessor, dynamic_properties_grouped_update)
+{
+    OCIO::ExposureContrastTransformRcPtr ec = OCIO::ExposureContrastTransform::Create();
+    ec->setExposure(0.5);
+    ec->makeExposureDynamic();
+
+    OCIO::GradingRGBCurveTransformRcPtr gc = OCIO::GradingRGBCurveTransform::Create(OCIO::GRADING_LOG);
+    gc->makeDynamic();
+
+    OCIO::GroupTransformRcPtr group = OCIO::GroupTransform::Create();
+    group->appendTransform(ec);
+    group->appendTransform(gc);
+
+    OCIO::ConfigRcPtr config = OCIO::Config::Create();
+    auto cpuProc = config->getProcessor(group)->getDefaultCPUProcessor();
+
+    OCIO::DynamicPropertyRcPtr dp = cpuProc->getDynamicProperty(OCIO::DYNAMIC_PROPERTY_EXPOSURE);
+    auto dpExposure = OCIO::DynamicPropertyValue::AsDouble(dp);
+    dp = cpuProc->getDynamicProperty(OCIO::DYNAMIC_PROPERTY_GRADING_RGBCURVE);
+    auto dpCurve = OCIO::DynamicPropertyValue::AsGradingRGBCurve(dp);
+
+    const float inPixel[3] = { 0.5f, 0.4f, 0.2f };
+
+    float before[3] = { inPixel[0], inPixel[1], inPixel[2] };
+    cpuProc->applyRGB(before);
+
+    OCIO_CHECK_THROW_WHAT(cpuProc->commitDynamicPropertyUpdate(),
+                          OCIO::Exception,
+                          "There is no dynamic property update in progress.");
+
+    OCIO_CHECK_NO_THROW(cpuProc->beginDynamicPropertyUpdate());
+    OCIO_CHECK_THROW_WHAT(cpuProc->beginDynamicPropertyUpdate(),
+                          OCIO::Exception,
+                          "A dynamic property update is already in progress.");
+
+    auto identity = OCIO::GradingBSplineCurve::Create({ { 0.f, 0.f },{ 1.f, 1.f } });
+    auto curve = OCIO::GradingBSplineCurve::Create({ { 0.f, 0.1f },{ 0.3f, 0.5f },
+                                                     { 0.6f, 0.7f },{ 1.f, 1.f } });
+    auto curves = OCIO::GradingRGBCurve::Create(identity, identity, identity, curve);
+
+    dpExposure->setValue(0.2);
+    dpExposure->setValue(1.0);
+    OCIO_CHECK_NO_THROW(dpCurve->setValue(curves));
+
+    // The staged values are not visible until the commit.
+    OCIO_CHECK_EQUAL(dpExposure->getValue(), 0.5);
+    OCIO_CHECK_ASSERT(dpCurve->getValue()->getCurve(OCIO::RGB_MASTER)->getNumControlPoints() != 4);
+
+    float pixel[3] = { inPixel[0], inPixel[1], inPixel[2] };
+    cpuProc->applyRGB(pixel);
+    OCIO_CHECK_EQUAL(pixel[0], before[0]);
+    OCIO_CHECK_EQUAL(pixel[1], before[1]);
+    OCIO_CHECK_EQUAL(pixel[2], before[2]);
+
+    // Each property is prepared once whatever the number of values set.
+    OCIO_CHECK_EQUAL(cpuProc->commitDynamicPropertyUpdate(), 2);
+    OCIO_CHECK_EQUAL(dpExposure->getValue(), 1.0);
+    OCIO_CHECK_EQUAL(dpCurve->getValue()->getCurve(OCIO::RGB_MASTER)->getNumControlPoints(), 4);
+
+    // Compare to a processor built with the committed values.
+    ec->setExposure(1.0);
+    gc->setValue(curves);
+    auto refProc = config->getProcessor(group)->getDefaultCPUProcessor();
+
+    float expected[3] = { inPixel[0], inPixel[1], inPixel[2] };
+    refProc->applyRGB(expected);
+    OCIO_CHECK_NE(expected[0], before[0]);
+
+    pixel[0] = inPixel[0];
+    pixel[1] = inPixel[1];
+    pixel[2] = inPixel[2];
+    cpuProc->applyRGB(pixel);
+    OCIO_CHECK_EQUAL(pixel[0], expected[0]);
+    OCIO_CHECK_EQUAL(pixel[1], expected[1]);
+    OCIO_CHECK_EQUAL(pixel[2], expected[2]);
+
+    // Outside of an update, the values are immediately used.
+    dpExposure->setValue(0.5);
+    OCIO_CHECK_EQUAL(dpExposure->getValue(), 0.5);
+
+    // Nothing to publish.
+    OCIO_CHECK_NO_THROW(cpuProc->beginDynamicPropertyUpdate());
+    OCIO_CHECK_EQUAL(cpuProc->commitDynamicPropertyUpdate(), 0);
+
+    // A value set during the update counts even if it is the current one.
+    OCIO_CHECK_NO_THROW(cpuProc->beginDynamicPropertyUpdate());
+    dpExposure->setValue(0.5);
+    OCIO_CHECK_EQUAL(cpuProc->commitDynamicPropertyUpdate(), 1);
+    OCIO_CHECK_EQUAL(dpExposure->getValue(), 0.5);
+}
+
+OCIO_ADD_TEST(CPUProcessor, dynamic_properties_pixel_apply)
+{
+    // The single pixel apply calls reuse the dynamic property snapshot of the thread.
+
+    OCIO::ExposureContrastTransformRcPtr ec = OCIO::ExposureContrastTransform::Create();
+    ec->setExposure(0.5);
+    ec->makeExposureDynamic();
+
+    OCIO::GradingPrimaryTransformRcPtr gp = OCIO::GradingPrimaryTransform::Create(OCIO::GRADING_LOG);
+    gp->makeDynamic();
+
+    OCIO::GroupTransformRcPtr group = OCIO::GroupTransform::Create();
+    group->appendTransform(ec);
+    group->appendTransform(gp);
+
+    OCIO::ConfigRcPtr config = OCIO::Config::Create();
+    auto cpuProc = config->getProcessor(group)->getDefaultCPUProcessor();
+
+    OCIO::DynamicPropertyRcPtr dp = cpuProc->getDynamicProperty(OCIO::DYNAMIC_PROPERTY_GRADING_PRIMARY);
+    auto dpPrimary = OCIO::DynamicPropertyValue::AsGradingPrimary(dp);
+
+    float rgb[3] = { 0.5f, 0.4f, 0.2f };
+    float rgba[4] = { 0.5f, 0.4f, 0.2f, 1.f };
+    cpuProc->applyRGB(rgb);
+    cpuProc->applyRGBA(rgba);
+
+    // A new value is used by the next call.
+    OCIO::GradingPrimary value = dpPrimary->getValue();
+    value.m_saturation = 0.;
+    dpPrimary->setValue(value);
+
+    cpuProc->applyRGB(rgb);
+    OCIO_CHECK_CLOSE(rgb[0], rgb[1], 1e-5f);
+    OCIO_CHECK_CLOSE(rgb[1], rgb[2], 1e-5f);
+    OCIO_CHECK_EQUAL(dpPrimary->getValue().m_saturation, 0.);
+}
+
+OCIO_ADD_TEST(CPUProcessor, dynamic_properties_concurrent_apply)
+{
+    // A writer thread alternates between two sets of values while the image is processed by
+    // bands and by chunks: each apply call must use only one of the two sets.
+
+    constexpr long width  = 64;
+    constexpr long height = 32;
+
+    OCIO::ExposureContrastTransformRcPtr ec = OCIO::ExposureContrastTransform::Create();
+    ec->makeExposureDynamic();
+    ec->makeContrastDynamic();
+
+    OCIO::GradingPrimaryTransformRcPtr gp = OCIO::GradingPrimaryTransform::Create(OCIO::GRADING_LOG);
+    gp->makeDynamic();
+
+    OCIO::GroupTransformRcPtr group = OCIO::GroupTransform::Create();
+    group->appendTransform(ec);
+    group->appendTransform(gp);
+
+    OCIO::ConfigRcPtr config = OCIO::Config::Create();
+    auto cpuProc = config->getProcessor(group)->getDefaultCPUProcessor();
+
+    OCIO::DynamicPropertyRcPtr dp = cpuProc->getDynamicProperty(OCIO::DYNAMIC_PROPERTY_EXPOSURE);
+    auto dpExposure = OCIO::DynamicPropertyValue::AsDouble(dp);
+    dp = cpuProc->getDynamicProperty(OCIO::DYNAMIC_PROPERTY_CONTRAST);
+    auto dpContrast = OCIO::DynamicPropertyValue::AsDouble(dp);
+    dp = cpuProc->getDynamicProperty(OCIO::DYNAMIC_PROPERTY_GRADING_PRIMARY);
+    auto dpPrimary = OCIO::DynamicPropertyValue::AsGradingPrimary(dp);
+
+    OCIO::GradingPrimary primaryA(OCIO::GRADING_LOG);
+    OCIO::GradingPrimary primaryB(OCIO::GRADING_LOG);
+    primaryB.m_saturation = 1.4;
+    primaryB.m_offset.m_red = 0.05;
+
+    const float inPixel[4] = { 0.3f, 0.4f, 0.5f, 1.f };
+
+    auto setValues = [&](int set)
+    {
+        dpExposure->setValue(set == 0 ? 0. : 1.5);
+        dpContrast->setValue(set == 0 ? 1. : 1.2);
+        dpPrimary->setValue(set == 0 ? primaryA : primaryB);
+    };
+
+    // Compute the result of each set of values.
+    float expected[2][4];
+    for (int set = 0; set < 2; ++set)
+    {
+        setValues(set);
+        std::copy(inPixel, inPixel + 4, expected[set]);
+        cpuProc->applyRGBA(expected[set]);
+    }
+    OCIO_REQUIRE_ASSERT(expected[0][0] != expected[1][0]);
+
+    std::atomic<bool> done{ false };
+    std::thread writer([&]()
+    {
+        int set = 0;
+        while (!done)
+        {
+            set = 1 - set;
+            cpuProc->beginDynamicPropertyUpdate();
+            setValues(set);
+            cpuProc->commitDynamicPropertyUpdate();
+        }
+    });
+
+    OCIO::SetCPUProcessorChunkSize(16);
+
+    std::vector<float> img(width * height * 4);
+    for (int iter = 0; iter < 50; ++iter)
+    {
+        for (long idx = 0; idx < width * height; ++idx)
+        {
+            std::copy(inPixel, inPixel + 4, &img[idx * 4]);
+        }
+
+        OCIO::PackedImageDesc imgDesc(&img[0], width, height, 4);
+        OCIO_CHECK_NO_THROW(cpuProc->apply(imgDesc, 4));
+
+        const int set = (img[0] == expected[0][0]) ? 0 : 1;
+        bool consistent = true;
+        for (long idx = 0; idx < width * height * 4; ++idx)
+        {
+            consistent = consistent && (img[idx] == expected[set][idx % 4]);
+        }
+        OCIO_CHECK_ASSERT(consistent);
+    }
+
+    OCIO::SetCPUProcessorChunkSize(0);
+
+    done = true;
+    writer.join();
+}
+
 OCIO_ADD_TEST(CPUProcessor, flag_composition)
 {
     // The test validates the build of a custom optimization flag.
@@ -2908,3 +3130,619 @@ OCIO_ADD_TEST(CPUProcessor, optimizations)
                                                                __LINE__);
     }
 }
+
+OCIO_ADD_TEST(CPUProcessor, multi_threaded_apply)
+{
+    // The multi-threaded processing must produce exactly the same result as the
+    // single threaded one.
+
+    constexpr long width     = 67;
+    constexpr long height    = 41;
+    constexpr long nChannels = 4;
+
+    OCIO::ConfigRcPtr config = OCIO::Config::CreateRaw()->createEditableCopy();
+
+    OCIO::GroupTransformRcPtr group = OCIO::GroupTransform::Create();
+    group->appendTransform(OCIO::LogTransform::Create());
+    group->appendTransform(OCIO::ExponentTransform::Create());
+
+    OCIO::ConstProcessorRcPtr processor;
+    OCIO_CHECK_NO_THROW(processor = config->getProcessor(group));
+
+    std::vector<float> inBuf(width * height * nChannels);
+    for (size_t idx = 0; idx < inBuf.size(); ++idx)
+    {
+        inBuf[idx] = float(idx) / float(inBuf.size());
+    }
+
+    // In-place processing of a packed RGBA F32 image.
+    {
+        OCIO::ConstCPUProcessorRcPtr cpuProcessor = processor->getDefaultCPUProcessor();
+
+        std::vector<float> refBuf = inBuf;
+        OCIO::PackedImageDesc refImgDesc(&refBuf[0], width, height, nChannels);
+        OCIO_CHECK_NO_THROW(cpuProcessor->apply(refImgDesc));
+
+        for (unsigned numThreads : { 0u, 1u, 3u, 8u, 1000u })
+        {
+            std::vector<float> outBuf = inBuf;
+            OCIO::PackedImageDesc outImgDesc(&outBuf[0], width, height, nChannels);
+            OCIO_CHECK_NO_THROW(cpuProcessor->apply(outImgDesc, numThreads));
+
+            for (size_t idx = 0; idx < outBuf.size(); ++idx)
+            {
+                OCIO_REQUIRE_ASSERT(outBuf[idx] == refBuf[idx]
+                                    || (std::isnan(outBuf[idx]) && std::isnan(refBuf[idx])));
+            }
+        }
+    }
+
+    // Processing from a packed RGB F32 image to a planar RGBA UINT16 image.
+    {
+        OCIO::ConstCPUProcessorRcPtr cpuProcessor
+            = processor->getOptimizedCPUProcessor(OCIO::BIT_DEPTH_F32,
+                                                  OCIO::BIT_DEPTH_UINT16,
+                                                  OCIO::OPTIMIZATION_DEFAULT);
+
+        OCIO::PackedImageDesc srcImgDesc(&inBuf[0], width, height, 3);
+
+        auto process = [&](std::vector<uint16_t> & outBuf, unsigned numThreads)
+        {
+            outBuf.resize(width * height * nChannels);
+            OCIO::PlanarImageDesc dstImgDesc(&outBuf[0],
+                                             &outBuf[width * height],
+                                             &outBuf[2 * width * height],
+                                             &outBuf[3 * width * height],
+                                             width, height,
+                                             OCIO::BIT_DEPTH_UINT16,
+                                             OCIO::AutoStride,
+                                             OCIO::AutoStride);
+            if (numThreads == 1)
+            {
+                cpuProcessor->apply(srcImgDesc, dstImgDesc);
+            }
+            else
+            {
+                cpuProcessor->apply(srcImgDesc, dstImgDesc, numThreads);
+            }
+        };
+
+        std::vector<uint16_t> refBuf;
+        OCIO_CHECK_NO_THROW(process(refBuf, 1));
+
+        std::vector<uint16_t> outBuf;
+        OCIO_CHECK_NO_THROW(process(outBuf, 5));
+        OCIO_CHECK_ASSERT(outBuf == refBuf);
+    }
+
+    // Errors are propagated to the calling thread.
+    {
+        OCIO::ConstCPUProcessorRcPtr cpuProcessor = processor->getDefaultCPUProcessor();
+
+        std::vector<float> srcBuf(width * height * nChannels);
+        std::vector<float> dstBuf(width * (height - 1) * nChannels);
+
+        OCIO::PackedImageDesc srcImgDesc(&srcBuf[0], width, height, nChannels);
+        OCIO::PackedImageDesc dstImgDesc(&dstBuf[0], width, height - 1, nChannels);
+
+        OCIO_CHECK_THROW_WHAT(cpuProcessor->apply(srcImgDesc, dstImgDesc, 4),
+                              OCIO::Exception,
+                              "Dimension inconsistency between source and destination image buffers.");
+    }
+}
+
+OCIO_ADD_TEST(CPUProcessor, chunked_apply)
+{
+    // Processing the scanlines by chunks of pixels must produce exactly the same result as
+    // processing complete scanlines.
+
+    constexpr long width     = 1000;
+    constexpr long height    = 3;
+    constexpr long nChannels = 4;
+
+    OCIO::ConfigRcPtr config = OCIO::Config::CreateRaw()->createEditableCopy();
+
+    OCIO::GroupTransformRcPtr group = OCIO::GroupTransform::Create();
+    group->appendTransform(OCIO::LogTransform::Create());
+    OCIO::MatrixTransformRcPtr matrix = OCIO::MatrixTransform::Create();
+    const double offset[4]{ 0.1, 0.2, 0.3, 0.4 };
+    matrix->setOffset(offset);
+    group->appendTransform(matrix);
+    group->appendTransform(OCIO::ExponentTransform::Create());
+
+    OCIO::ConstCPUProcessorRcPtr cpuProcessor;
+    OCIO_CHECK_NO_THROW(cpuProcessor = config->getProcessor(group)->getDefaultCPUProcessor());
+
+    std::vector<float> inBuf(width * height * nChannels);
+    for (size_t idx = 0; idx < inBuf.size(); ++idx)
+    {
+        inBuf[idx] = float(idx) / float(inBuf.size());
+    }
+
+    OCIO_CHECK_EQUAL(OCIO::GetCPUProcessorChunkSize(), 0u);
+
+    std::vector<float> refBuf = inBuf;
+    OCIO::PackedImageDesc refImgDesc(&refBuf[0], width, height, nChannels);
+    OCIO_CHECK_NO_THROW(cpuProcessor->apply(refImgDesc));
+
+    // Note that 0 and any size larger than the scanline process the complete scanline.
+    for (unsigned chunkSize : { 1u, 7u, 256u, 999u, 1000u, 4096u, 0u,
+                                std::numeric_limits<unsigned>::max() })
+    {
+        OCIO::SetCPUProcessorChunkSize(chunkSize);
+        OCIO_CHECK_EQUAL(OCIO::GetCPUProcessorChunkSize(), chunkSize);
+
+        std::vector<float> outBuf = inBuf;
+        OCIO::PackedImageDesc outImgDesc(&outBuf[0], width, height, nChannels);
+        OCIO_CHECK_NO_THROW(cpuProcessor->apply(outImgDesc));
+
+        for (size_t idx = 0; idx < outBuf.size(); ++idx)
+        {
+            OCIO_REQUIRE_ASSERT(outBuf[idx] == refBuf[idx]
+                                || (std::isnan(outBuf[idx]) && std::isnan(refBuf[idx])));
+        }
+    }
+
+    OCIO::SetCPUProcessorChunkSize(0);
+}
+
+OCIO_ADD_TEST(CPUProcessor, chunked_apply_concurrent)
+{
+    // The chunk size is a global setting which could change while other threads apply
+    // processors: the result is always the same.
+
+    constexpr long width     = 1000;
+    constexpr long height    = 8;
+    constexpr long nChannels = 4;
+
+    OCIO::ConfigRcPtr config = OCIO::Config::CreateRaw()->createEditableCopy();
+
+    OCIO::GroupTransformRcPtr group = OCIO::GroupTransform::Create();
+    group->appendTransform(OCIO::LogTransform::Create());
+    OCIO::MatrixTransformRcPtr matrix = OCIO::MatrixTransform::Create();
+    const double offset[4]{ 0.1, 0.2, 0.3, 0.4 };
+    matrix->setOffset(offset);
+    group->appendTransform(matrix);
+    group->appendTransform(OCIO::ExponentTransform::Create());
+
+    OCIO::ConstCPUProcessorRcPtr cpuProcessor;
+    OCIO_CHECK_NO_THROW(cpuProcessor = config->getProcessor(group)->getDefaultCPUProcessor());
+
+    std::vector<float> inBuf(width * height * nChannels);
+    for (size_t idx = 0; idx < inBuf.size(); ++idx)
+    {
+        inBuf[idx] = float(idx) / float(inBuf.size());
+    }
+
+    std::vector<float> refBuf = inBuf;
+    OCIO::PackedImageDesc refImgDesc(&refBuf[0], width, height, nChannels);
+    OCIO_CHECK_NO_THROW(cpuProcessor->apply(refImgDesc));
+
+    std::atomic<bool> done{ false };
+    std::thread setter([&]()
+    {
+        const unsigned chunkSizes[] = { 1u, 7u, 256u, 0u, 999u, 4096u };
+        for (size_t idx = 0; !done; ++idx)
+        {
+            OCIO::SetCPUProcessorChunkSize(chunkSizes[idx % 6]);
+            std::this_thread::yield();
+        }
+    });
+
+    constexpr int NumThreads = 4;
+    std::vector<std::thread> threads;
+    std::atomic<int> numMismatches{ 0 };
+    for (int thread = 0; thread < NumThreads; ++thread)
+    {
+        threads.emplace_back([&]()
+        {
+            for (int iter = 0; iter < 20; ++iter)
+            {
+                std::vector<float> outBuf = inBuf;
+                OCIO::PackedImageDesc outImgDesc(&outBuf[0], width, height, nChannels);
+                cpuProcessor->apply(outImgDesc);
+
+                for (size_t idx = 0; idx < outBuf.size(); ++idx)
+                {
+                    if (!(outBuf[idx] == refBuf[idx]
+                          || (std::isnan(outBuf[idx]) && std::isnan(refBuf[idx]))))
+                    {
+                        ++numMismatches;
+                        break;
+                    }
+                }
+            }
+        });
+    }
+
+    for (auto & thread : threads)
+    {
+        thread.join();
+    }
+    done = true;
+    setter.join();
+
+    OCIO_CHECK_EQUAL(numMismatches, 0);
+
+    OCIO::SetCPUProcessorChunkSize(0);
+    OCIO_CHECK_EQUAL(OCIO::GetCPUProcessorChunkSize(), 0u);
+}
+
+OCIO_ADD_TEST(CPUProcessor, scratch_buffer)
+{
+    // The scratch memory of the scanline helpers comes from a per-thread arena which is
+    // reused by the successive apply calls.
+
+    void * first = nullptr;
+    {
+        OCIO::ScratchBuffer buffer;
+        OCIO_CHECK_NO_THROW(first = buffer.acquire(1000));
+        OCIO_REQUIRE_ASSERT(first);
+        OCIO_CHECK_EQUAL(reinterpret_cast<uintptr_t>(first) % OCIO::ScratchBuffer::Alignment, 0u);
+
+        // A smaller request reuses the same memory.
+        OCIO_CHECK_EQUAL(buffer.acquire(10), first);
+
+        // A nested use on the same thread gets its own memory.
+        OCIO::ScratchBuffer nested;
+        void * other = nullptr;
+        OCIO_CHECK_NO_THROW(other = nested.acquire(1000));
+        OCIO_REQUIRE_ASSERT(other);
+        OCIO_CHECK_NE(other, first);
+        OCIO_CHECK_EQUAL(reinterpret_cast<uintptr_t>(other) % OCIO::ScratchBuffer::Alignment, 0u);
+    }
+
+    {
+        // The memory is reused by the next instance.
+        OCIO::ScratchBuffer buffer;
+        OCIO_CHECK_EQUAL(buffer.acquire(1000), first);
+
+        void * bigger = nullptr;
+        OCIO_CHECK_NO_THROW(bigger = buffer.acquire(100000));
+        OCIO_REQUIRE_ASSERT(bigger);
+        OCIO_CHECK_EQUAL(reinterpret_cast<uintptr_t>(bigger) % OCIO::ScratchBuffer::Alignment, 0u);
+    }
+
+    OCIO_CHECK_EQUAL(OCIO::ScratchBuffer::AlignSize(0), 0u);
+    OCIO_CHECK_EQUAL(OCIO::ScratchBuffer::AlignSize(1), 64u);
+    OCIO_CHECK_EQUAL(OCIO::ScratchBuffer::AlignSize(64), 64u);
+    OCIO_CHECK_EQUAL(OCIO::ScratchBuffer::AlignSize(65), 128u);
+}
+
+OCIO_ADD_TEST(CPUProcessor, planar_apply)
+{
+    // The planar F32 images are processed directly on their planes when some CPU ops support
+    // it, and the result must be identical to the processing of packed images.
+
+    constexpr long width  = 53;
+    constexpr long height = 17;
+
+    OCIO::ConfigRcPtr config = OCIO::Config::CreateRaw()->createEditableCopy();
+
+    std::vector<float> rgbaBuf(width * height * 4);
+    for (size_t idx = 0; idx < rgbaBuf.size(); ++idx)
+    {
+        rgbaBuf[idx] = -0.25f + 1.5f * float(idx) / float(rgbaBuf.size());
+    }
+
+    // Note that none of the tested transforms mixes the alpha channel with the color ones so
+    // the RGB output of the images without alpha is the same as the RGBA one.
+    auto checkProcessor = [&](const OCIO::ConstTransformRcPtr & transform)
+    {
+        OCIO::ConstProcessorRcPtr processor;
+        OCIO_CHECK_NO_THROW(processor = config->getProcessor(transform));
+        OCIO::ConstCPUProcessorRcPtr cpuProcessor = processor->getDefaultCPUProcessor();
+
+        std::vector<float> refBuf = rgbaBuf;
+        OCIO::PackedImageDesc refImgDesc(&refBuf[0], width, height, 4);
+        OCIO_CHECK_NO_THROW(cpuProcessor->apply(refImgDesc));
+
+        for (bool hasAlpha : { true, false })
+        {
+            // Split the RGBA image in planes.
+            const long numPlanes = hasAlpha ? 4 : 3;
+            std::vector<float> planarBuf(width * height * numPlanes);
+            for (long idx = 0; idx < width * height; ++idx)
+            {
+                for (long c = 0; c < numPlanes; ++c)
+                {
+                    planarBuf[c * width * height + idx] = rgbaBuf[idx * 4 + c];
+                }
+            }
+
+            auto makeImgDesc = [&](std::vector<float> & buf)
+            {
+                return OCIO::PlanarImageDesc(&buf[0],
+                                             &buf[width * height],
+                                             &buf[2 * width * height],
+                                             hasAlpha ? &buf[3 * width * height] : nullptr,
+                                             width, height);
+            };
+
+            auto checkResult = [&](const std::vector<float> & outBuf)
+            {
+                for (long idx = 0; idx < width * height; ++idx)
+                {
+                    for (long c = 0; c < numPlanes; ++c)
+                    {
+                        const float out = outBuf[c * width * height + idx];
+                        const float ref = refBuf[idx * 4 + c];
+                        OCIO_REQUIRE_ASSERT(out == ref || (std::isnan(out) && std::isnan(ref)));
+                    }
+                }
+            };
+
+            for (unsigned chunkSize : { 0u, 5u, 64u, std::numeric_limits<unsigned>::max() })
+            {
+                OCIO::SetCPUProcessorChunkSize(chunkSize);
+
+                // In-place processing.
+                {
+                    std::vector<float> outBuf = planarBuf;
+                    OCIO::PlanarImageDesc outImgDesc = makeImgDesc(outBuf);
+                    OCIO_CHECK_NO_THROW(cpuProcessor->apply(outImgDesc));
+                    checkResult(outBuf);
+                }
+
+                // Processing from one buffer to another.
+                {
+                    std::vector<float> srcBuf = planarBuf;
+                    std::vector<float> dstBuf(planarBuf.size());
+                    OCIO::PlanarImageDesc srcImgDesc = makeImgDesc(srcBuf);
+                    OCIO::PlanarImageDesc dstImgDesc = makeImgDesc(dstBuf);
+                    OCIO_CHECK_NO_THROW(cpuProcessor->apply(srcImgDesc, dstImgDesc));
+                    checkResult(dstBuf);
+                    OCIO_CHECK_ASSERT(srcBuf == planarBuf);
+                }
+
+                // Multi-threaded processing.
+                {
+                    std::vector<float> outBuf = planarBuf;
+                    OCIO::PlanarImageDesc outImgDesc = makeImgDesc(outBuf);
+                    OCIO_CHECK_NO_THROW(cpuProcessor->apply(outImgDesc, 3));
+                    checkResult(outBuf);
+                }
+            }
+
+            OCIO::SetCPUProcessorChunkSize(0);
+        }
+    };
+
+    // Matrix and range ops support the planar processing.
+    {
+        OCIO::GroupTransformRcPtr group = OCIO::GroupTransform::Create();
+
+        OCIO::MatrixTransformRcPtr matrix = OCIO::MatrixTransform::Create();
+        const double m44[16] = {  1.1, 0.2, 0.3, 0.0,
+                                  0.4, 0.9, 0.1, 0.0,
+                                 -0.1, 0.2, 1.3, 0.0,
+                                  0.0, 0.0, 0.0, 1.0 };
+        const double offset[4] = { 0.01, -0.02, 0.03, 0.0 };
+        matrix->setMatrix(m44);
+        matrix->setOffset(offset);
+        group->appendTransform(matrix);
+
+        OCIO::RangeTransformRcPtr range = OCIO::RangeTransform::Create();
+        range->setMinInValue(0.);
+        range->setMinOutValue(0.);
+        group->appendTransform(range);
+
+        checkProcessor(group);
+    }
+
+    // The log op does not support the planar processing so the packed path is used.
+    {
+        OCIO::GroupTransformRcPtr group = OCIO::GroupTransform::Create();
+        group->appendTransform(OCIO::MatrixTransform::Create());
+        group->appendTransform(OCIO::LogTransform::Create());
+
+        checkProcessor(group);
+    }
+
+    // Only the ops without a planar path (i.e. the log & 1D LUT ones) process packed pixels,
+    // including as the first and the last ops.
+    {
+        OCIO::GroupTransformRcPtr group = OCIO::GroupTransform::Create();
+
+        OCIO::LogTransformRcPtr log = OCIO::LogTransform::Create();
+        group->appendTransform(log);
+
+        OCIO::MatrixTransformRcPtr matrix = OCIO::MatrixTransform::Create();
+        const double offset[4] = { 0.1, 0.2, 0.3, 0.0 };
+        matrix->setOffset(offset);
+        group->appendTransform(matrix);
+
+        OCIO::RangeTransformRcPtr range = OCIO::RangeTransform::Create();
+        range->setMinInValue(0.);
+        range->setMinOutValue(0.);
+        group->appendTransform(range);
+
+        OCIO::LogTransformRcPtr invLog = OCIO::LogTransform::Create();
+        invLog->setDirection(OCIO::TRANSFORM_DIR_INVERSE);
+        group->appendTransform(invLog);
+
+        checkProcessor(group);
+    }
+
+    {
+        OCIO::GroupTransformRcPtr group = OCIO::GroupTransform::Create();
+
+        OCIO::Lut1DTransformRcPtr lut = OCIO::Lut1DTransform::Create(3, false);
+        lut->setValue(0, 0.0f, 0.1f, 0.2f);
+        lut->setValue(1, 0.4f, 0.5f, 0.6f);
+        lut->setValue(2, 1.0f, 0.9f, 0.8f);
+        group->appendTransform(lut);
+
+        OCIO::MatrixTransformRcPtr matrix = OCIO::MatrixTransform::Create();
+        const double m44[16] = { 0.9, 0.1, 0.0, 0.0,
+                                 0.1, 0.8, 0.1, 0.0,
+                                 0.0, 0.2, 0.8, 0.0,
+                                 0.0, 0.0, 0.0, 1.0 };
+        matrix->setMatrix(m44);
+        group->appendTransform(matrix);
+
+        OCIO::ExponentTransformRcPtr exponent = OCIO::ExponentTransform::Create();
+        const double gamma[4] = { 2.2, 2.2, 2.2, 1.0 };
+        exponent->setValue(gamma);
+        group->appendTransform(exponent);
+
+        group->appendTransform(OCIO::LogTransform::Create());
+
+        checkProcessor(group);
+    }
+}
+
+namespace
+{
+
+// Process an image having the channel ordering and compare the result with the one of the
+// same pixels in an RGBA image (i.e. which does not need any packing).
+template<OCIO::BitDepth BD>
+void ComparePacking(const OCIO::ConstProcessorRcPtr & processor,
+                    OCIO::ChannelOrdering chanOrder,
+                    unsigned lineNo)
+{
+    typedef typename OCIO::BitDepthInfo<BD>::Type Type;
+
+    // Use an odd width to also validate the processing of the last pixels of the lines.
+    constexpr long width  = 37;
+    constexpr long height = 3;
+
+    // Offsets of the R, G, B & A channels in a pixel.
+    long offsets[4] = { 0, 1, 2, 3 };
+    long numChannels = 4;
+    switch (chanOrder)
+    {
+        case OCIO::CHANNEL_ORDERING_RGB:
+            numChannels = 3;
+            break;
+        case OCIO::CHANNEL_ORDERING_BGR:
+            numChannels = 3;
+            offsets[0] = 2; offsets[2] = 0;
+            break;
+        case OCIO::CHANNEL_ORDERING_BGRA:
+            offsets[0] = 2; offsets[2] = 0;
+            break;
+        case OCIO::CHANNEL_ORDERING_ABGR:
+            offsets[0] = 3; offsets[1] = 2; offsets[2] = 1; offsets[3] = 0;
+            break;
+        case OCIO::CHANNEL_ORDERING_RGBA:
+            break;
+    }
+
+    std::vector<Type> rgbaImg(width * height * 4);
+    std::vector<Type> img(width * height * numChannels);
+
+    for (long idx = 0; idx < width * height; ++idx)
+    {
+        for (long c = 0; c < 4; ++c)
+        {
+            const float value = float(idx * 4 + c) / float(rgbaImg.size());
+            const Type v = Type(value * OCIO::BitDepthInfo<BD>::maxValue);
+
+            if (c < numChannels)
+            {
+                rgbaImg[idx * 4 + c] = v;
+                img[idx * numChannels + offsets[c]] = v;
+            }
+            else
+            {
+                rgbaImg[idx * 4 + c] = Type(OCIO::BitDepthInfo<BD>::maxValue);
+            }
+        }
+    }
+
+    OCIO::ConstCPUProcessorRcPtr cpuProcessor
+        = processor->getOptimizedCPUProcessor(BD, BD, OCIO::OPTIMIZATION_DEFAULT);
+
+    OCIO::PackedImageDesc rgbaImgDesc(&rgbaImg[0], width, height, OCIO::CHANNEL_ORDERING_RGBA,
+                                      BD, OCIO::AutoStride, OCIO::AutoStride, OCIO::AutoStride);
+    OCIO_CHECK_NO_THROW_FROM(cpuProcessor->apply(rgbaImgDesc), lineNo);
+
+    OCIO::PackedImageDesc imgDesc(&img[0], width, height, chanOrder,
+                                  BD, OCIO::AutoStride, OCIO::AutoStride, OCIO::AutoStride);
+    OCIO_CHECK_NO_THROW_FROM(cpuProcessor->apply(imgDesc), lineNo);
+
+    for (long idx = 0; idx < width * height; ++idx)
+    {
+        for (long c = 0; c < numChannels; ++c)
+        {
+            OCIO_CHECK_EQUAL_FROM(float(img[idx * numChannels + offsets[c]]),
+                                  float(rgbaImg[idx * 4 + c]), lineNo);
+        }
+    }
+}
+
+} // anon
+
+OCIO_ADD_TEST(CPUProcessor, packing_layouts)
+{
+    // The common image layouts have vectorized packing functions which must produce the same
+    // results as the processing of RGBA images.
+
+    OCIO::ConfigRcPtr config = OCIO::Config::CreateRaw()->createEditableCopy();
+
+    OCIO::GroupTransformRcPtr group = OCIO::GroupTransform::Create();
+    OCIO::MatrixTransformRcPtr matrix = OCIO::MatrixTransform::Create();
+    const double m44[16] = { 0.9, 0.1, 0.0, 0.0,
+                             0.0, 0.8, 0.2, 0.0,
+                             0.1, 0.0, 0.7, 0.0,
+                             0.0, 0.0, 0.0, 0.5 };
+    matrix->setMatrix(m44);
+    group->appendTransform(matrix);
+    group->appendTransform(OCIO::LogTransform::Create());
+
+    OCIO::ConstProcessorRcPtr processor;
+    OCIO_CHECK_NO_THROW(processor = config->getProcessor(group));
+
+    for (OCIO::ChannelOrdering chanOrder : { OCIO::CHANNEL_ORDERING_RGB,
+                                             OCIO::CHANNEL_ORDERING_BGR,
+                                             OCIO::CHANNEL_ORDERING_BGRA,
+                                             OCIO::CHANNEL_ORDERING_ABGR })
+    {
+        ComparePacking<OCIO::BIT_DEPTH_UINT8>(processor, chanOrder, __LINE__);
+        ComparePacking<OCIO::BIT_DEPTH_UINT10>(processor, chanOrder, __LINE__);
+        ComparePacking<OCIO::BIT_DEPTH_UINT12>(processor, chanOrder, __LINE__);
+        ComparePacking<OCIO::BIT_DEPTH_UINT16>(processor, chanOrder, __LINE__);
+        ComparePacking<OCIO::BIT_DEPTH_F16>(processor, chanOrder, __LINE__);
+        ComparePacking<OCIO::BIT_DEPTH_F32>(processor, chanOrder, __LINE__);
+    }
+
+    // Planar F32 images (i.e. the log op does not support the planar processing).
+    {
+        constexpr long width  = 21;
+        constexpr long height = 2;
+
+        std::vector<float> rgbaImg(width * height * 4);
+        std::vector<float> planarImg(width * height * 4);
+        for (long idx = 0; idx < width * height; ++idx)
+        {
+            for (long c = 0; c < 4; ++c)
+            {
+                const float value = float(idx * 4 + c) / float(rgbaImg.size());
+                rgbaImg[idx * 4 + c] = value;
+                planarImg[c * width * height + idx] = value;
+            }
+        }
+
+        OCIO::ConstCPUProcessorRcPtr cpuProcessor = processor->getDefaultCPUProcessor();
+
+        OCIO::PackedImageDesc rgbaImgDesc(&rgbaImg[0], width, height, 4);
+        OCIO_CHECK_NO_THROW(cpuProcessor->apply(rgbaImgDesc));
+
+        OCIO::PlanarImageDesc planarImgDesc(&planarImg[0],
+                                            &planarImg[width * height],
+                                            &planarImg[2 * width * height],
+                                            &planarImg[3 * width * height],
+                                            width, height);
+        OCIO_CHECK_NO_THROW(cpuProcessor->apply(planarImgDesc));
+
+        for (long idx = 0; idx < width * height; ++idx)
+        {
+            for (long c = 0; c < 4; ++c)
+            {
+                OCIO_CHECK_EQUAL(planarImg[c * width * height + idx], rgbaImg[idx * 4 + c]);
+            }
+        }
+    }
+}
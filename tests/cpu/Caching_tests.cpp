@@ -2,6 +2,10 @@
 // Copyright Contributors to the OpenColorIO Project.
 
 
+#include <atomic>
+#include <thread>
+#include <vector>
+
 #include "Caching.cpp"
 
 #include "testutils/UnitTest.h"
@@ -107,6 +111,93 @@ OCIO_ADD_TEST(Caching, generic_cache)
     }
 }
 
+OCIO_ADD_TEST(Caching, lru_cache)
+{
+    // A unit test to check the LRUCache class.
+
+    auto create = []() { return std::make_shared<Data>(); };
+
+    {
+        OCIO::LRUCache<std::string, DataRcPtr> cache;
+        OCIO_CHECK_ASSERT(cache.isEnabled());
+        OCIO_CHECK_EQUAL(cache.getBudget(), 0);
+
+        DataRcPtr entry1 = cache.getOrCreate("entry1", create);
+        OCIO_REQUIRE_ASSERT(entry1);
+        OCIO_CHECK_ASSERT(cache.exists("entry1"));
+        OCIO_CHECK_ASSERT(!cache.exists("entry2"));
+
+        // The existing entry is returned.
+        OCIO_CHECK_EQUAL(cache.getOrCreate("entry1", create), entry1);
+
+        cache.setCost("entry1", 100);
+        DataRcPtr entry2 = cache.getOrCreate("entry2", create);
+        cache.setCost("entry2", 200);
+        DataRcPtr entry3 = cache.getOrCreate("entry3", create);
+        cache.setCost("entry3", 300);
+
+        // No limit by default.
+        OCIO::LRUCache<std::string, DataRcPtr>::Statistics stats = cache.getStatistics();
+        OCIO_CHECK_EQUAL(stats.m_hits, 1);
+        OCIO_CHECK_EQUAL(stats.m_misses, 3);
+        OCIO_CHECK_EQUAL(stats.m_evictions, 0);
+        OCIO_CHECK_EQUAL(stats.m_entries, 3);
+        OCIO_CHECK_EQUAL(stats.m_cost, 600);
+
+        // Use entry1 so entry2 is the least recently used one.
+        OCIO_CHECK_EQUAL(cache.getOrCreate("entry1", create), entry1);
+
+        cache.setBudget(500);
+
+        OCIO_CHECK_ASSERT(cache.exists("entry1"));
+        OCIO_CHECK_ASSERT(!cache.exists("entry2"));
+        OCIO_CHECK_ASSERT(cache.exists("entry3"));
+
+        stats = cache.getStatistics();
+        OCIO_CHECK_EQUAL(stats.m_evictions, 1);
+        OCIO_CHECK_EQUAL(stats.m_entries, 2);
+        OCIO_CHECK_EQUAL(stats.m_cost, 400);
+
+        // An entry larger than the budget evicts all the others but is kept.
+        DataRcPtr entry4 = cache.getOrCreate("entry4", create);
+        cache.setCost("entry4", 1000);
+
+        OCIO_CHECK_ASSERT(!cache.exists("entry1"));
+        OCIO_CHECK_ASSERT(!cache.exists("entry3"));
+        OCIO_CHECK_ASSERT(cache.exists("entry4"));
+
+        stats = cache.getStatistics();
+        OCIO_CHECK_EQUAL(stats.m_evictions, 3);
+        OCIO_CHECK_EQUAL(stats.m_entries, 1);
+        OCIO_CHECK_EQUAL(stats.m_cost, 1000);
+
+        // The evicted entries are still valid for their owners.
+        OCIO_CHECK_ASSERT(!entry1->status);
+
+        // Flush the cache and check the content.
+        OCIO_CHECK_NO_THROW(cache.clear());
+        OCIO_CHECK_ASSERT(!cache.exists("entry4"));
+
+        stats = cache.getStatistics();
+        OCIO_CHECK_EQUAL(stats.m_entries, 0);
+        OCIO_CHECK_EQUAL(stats.m_cost, 0);
+        OCIO_CHECK_EQUAL(stats.m_misses, 4);
+    }
+
+    {
+        // Disable all the caches.
+        Guard guard;
+
+        OCIO::LRUCache<std::string, DataRcPtr> cache;
+        OCIO_CHECK_ASSERT(!cache.isEnabled());
+
+        DataRcPtr entry1 = cache.getOrCreate("entry1", create);
+        OCIO_CHECK_ASSERT(entry1);
+        OCIO_CHECK_ASSERT(!cache.exists("entry1"));
+        OCIO_CHECK_NE(cache.getOrCreate("entry1", create), entry1);
+    }
+}
+
 OCIO_ADD_TEST(Caching, processor_cache)
 {
     // A unit test to check the ProcessorCache class.
@@ -244,4 +335,361 @@ OCIO_ADD_TEST(Caching, processor_cache)
             OCIO_CHECK_EQUAL(procA, procB); 
         }
     }
-}
\ No newline at end of file
+}
+OCIO_ADD_TEST(Caching, processor_cache_limits)
+{
+    static const std::string CONFIG = 
+        "ocio_profile_version: 2\n"
+        "\n"
+        "search_path: " + OCIO::GetTestFilesDir() + "\n"
+        "\n"
+        "roles:\n"
+        "  default: cs1\n"
+        "\n"
+        "displays:\n"
+        "  disp1:\n"
+        "    - !<View> {name: view1, colorspace: cs3}\n"
+        "\n"
+        "colorspaces:\n"
+        "  - !<ColorSpace>\n"
+        "    name: cs1\n"
+        "\n"
+        "  - !<ColorSpace>\n"
+        "    name: cs2\n"
+        "    from_scene_reference: !<MatrixTransform> {offset: [0.11, 0.12, 0.13, 0]}\n"
+        "\n"
+        "  - !<ColorSpace>\n"
+        "    name: cs3\n"
+        "    from_scene_reference: !<FileTransform> {src: lut1d_green.ctf}\n";
+
+    std::istringstream iss;
+    iss.str(CONFIG);
+
+    OCIO::ConstConfigRcPtr config;
+    OCIO_CHECK_NO_THROW(config = OCIO::Config::CreateFromStream(iss));
+
+    size_t maxProcessors = 1, maxBytes = 1;
+    config->getProcessorCacheLimits(maxProcessors, maxBytes);
+    OCIO_CHECK_EQUAL(maxProcessors, 0);
+    OCIO_CHECK_EQUAL(maxBytes, 0);
+
+    size_t hits = 1, misses = 1, evictions = 1, entries = 1, bytes = 1;
+    config->getProcessorCacheStatistics(hits, misses, evictions, entries, bytes);
+    OCIO_CHECK_EQUAL(hits, 0);
+    OCIO_CHECK_EQUAL(misses, 0);
+    OCIO_CHECK_EQUAL(evictions, 0);
+    OCIO_CHECK_EQUAL(entries, 0);
+    OCIO_CHECK_EQUAL(bytes, 0);
+
+    OCIO::ConstProcessorRcPtr procA = config->getProcessor("cs1", "cs2");
+    OCIO::ConstProcessorRcPtr procB = config->getProcessor("cs1", "cs2");
+    OCIO_CHECK_EQUAL(procA, procB);
+
+    config->getProcessorCacheStatistics(hits, misses, evictions, entries, bytes);
+    OCIO_CHECK_EQUAL(hits, 1);
+    OCIO_CHECK_EQUAL(misses, 1);
+    OCIO_CHECK_EQUAL(entries, 1);
+    OCIO_CHECK_ASSERT(bytes > 0);
+
+    const size_t matrixBytes = bytes;
+
+    OCIO::ConstProcessorRcPtr procC = config->getProcessor("cs1", "cs3");
+
+    config->getProcessorCacheStatistics(hits, misses, evictions, entries, bytes);
+    OCIO_CHECK_EQUAL(misses, 2);
+    OCIO_CHECK_EQUAL(entries, 2);
+    // The LUT makes the processor larger.
+    OCIO_CHECK_ASSERT(bytes - matrixBytes > matrixBytes);
+
+    // Bound the number of processors i.e. the least recently used one is evicted.
+
+    config->setProcessorCacheLimits(1, 0);
+    config->getProcessorCacheLimits(maxProcessors, maxBytes);
+    OCIO_CHECK_EQUAL(maxProcessors, 1);
+    OCIO_CHECK_EQUAL(maxBytes, 0);
+
+    config->getProcessorCacheStatistics(hits, misses, evictions, entries, bytes);
+    OCIO_CHECK_EQUAL(evictions, 1);
+    OCIO_CHECK_EQUAL(entries, 1);
+
+    OCIO::ConstProcessorRcPtr procD = config->getProcessor("cs1", "cs2");
+    OCIO_CHECK_NE(procD, procA);
+    OCIO_CHECK_EQUAL(config->getProcessor("cs1", "cs2"), procD);
+
+    config->getProcessorCacheStatistics(hits, misses, evictions, entries, bytes);
+    OCIO_CHECK_EQUAL(hits, 2);
+    OCIO_CHECK_EQUAL(misses, 3);
+    OCIO_CHECK_EQUAL(evictions, 2);
+    OCIO_CHECK_EQUAL(entries, 1);
+    OCIO_CHECK_EQUAL(bytes, matrixBytes);
+
+    // Bound the memory footprint i.e. the LUT processor does not fit with the other one.
+
+    config->setProcessorCacheLimits(0, 2 * matrixBytes);
+
+    OCIO::ConstProcessorRcPtr procE = config->getProcessor("cs1", "cs3");
+    OCIO_CHECK_NE(procE, procC);
+
+    config->getProcessorCacheStatistics(hits, misses, evictions, entries, bytes);
+    OCIO_CHECK_EQUAL(evictions, 3);
+    OCIO_CHECK_EQUAL(entries, 1);
+    OCIO_CHECK_ASSERT(bytes > matrixBytes);
+
+    // The editable copy has the same limits but an empty cache.
+
+    OCIO::ConfigRcPtr cfg = config->createEditableCopy();
+    cfg->getProcessorCacheLimits(maxProcessors, maxBytes);
+    OCIO_CHECK_EQUAL(maxProcessors, 0);
+    OCIO_CHECK_EQUAL(maxBytes, 2 * matrixBytes);
+
+    cfg->getProcessorCacheStatistics(hits, misses, evictions, entries, bytes);
+    OCIO_CHECK_EQUAL(entries, 0);
+    OCIO_CHECK_EQUAL(bytes, 0);
+}
+
+OCIO_ADD_TEST(Caching, processor_cache_failure)
+{
+    // A failed processor creation must not leave a pending entry behind i.e. the next request
+    // for the same processor creates it again (and fails again) instead of waiting forever.
+
+    OCIO::ConfigRcPtr config = OCIO::Config::CreateRaw()->createEditableCopy();
+    config->setSearchPath(OCIO::GetTestFilesDir().c_str());
+
+    OCIO::FileTransformRcPtr file = OCIO::FileTransform::Create();
+    file->setSrc("missing_file.clf");
+
+    OCIO_CHECK_THROW_WHAT(config->getProcessor(file), OCIO::Exception, "missing_file.clf");
+    OCIO_CHECK_THROW_WHAT(config->getProcessor(file), OCIO::Exception, "missing_file.clf");
+
+    size_t hits = 0, misses = 0, evictions = 0, entries = 0, bytes = 0;
+    config->getProcessorCacheStatistics(hits, misses, evictions, entries, bytes);
+    OCIO_CHECK_EQUAL(misses, 2);
+    OCIO_CHECK_EQUAL(entries, 0);
+
+    // Then a valid processor is still cached.
+
+    file->setSrc("lut1d_green.ctf");
+
+    OCIO::ConstProcessorRcPtr proc;
+    OCIO_CHECK_NO_THROW(proc = config->getProcessor(file));
+    OCIO_CHECK_EQUAL(config->getProcessor(file), proc);
+
+    config->getProcessorCacheStatistics(hits, misses, evictions, entries, bytes);
+    OCIO_CHECK_EQUAL(hits, 1);
+    OCIO_CHECK_EQUAL(entries, 1);
+}
+
+OCIO_ADD_TEST(Caching, processor_cache_hit_context)
+{
+    // The processor cache hits when the transform uses context variables (refer to
+    // tests/allocations for the heap allocations of a cache hit).
+
+    static const std::string CONFIG = 
+        "ocio_profile_version: 2\n"
+        "\n"
+        "environment: {LUT: lut1d_green.ctf}\n"
+        "search_path: " + OCIO::GetTestFilesDir() + "\n"
+        "\n"
+        "roles:\n"
+        "  default: cs1\n"
+        "\n"
+        "displays:\n"
+        "  disp1:\n"
+        "    - !<View> {name: view1, colorspace: cs3}\n"
+        "\n"
+        "colorspaces:\n"
+        "  - !<ColorSpace>\n"
+        "    name: cs1\n"
+        "\n"
+        "  - !<ColorSpace>\n"
+        "    name: cs2\n"
+        "    from_scene_reference: !<MatrixTransform> {offset: [0.11, 0.12, 0.13, 0]}\n"
+        "\n"
+        "  - !<ColorSpace>\n"
+        "    name: cs3\n"
+        "    from_scene_reference: !<FileTransform> {src: $LUT}\n";
+
+    std::istringstream iss;
+    iss.str(CONFIG);
+
+    OCIO::ConstConfigRcPtr config;
+    OCIO_CHECK_NO_THROW(config = OCIO::Config::CreateFromStream(iss));
+
+    OCIO::ConstContextRcPtr context = config->getCurrentContext();
+
+    for (const char * dst : { "cs2", "cs3" })
+    {
+        OCIO::ColorSpaceTransformRcPtr transform = OCIO::ColorSpaceTransform::Create();
+        transform->setSrc("cs1");
+        transform->setDst(dst);
+
+        OCIO::ConstProcessorRcPtr proc;
+        OCIO_CHECK_NO_THROW(proc = config->getProcessor(context, transform,
+                                                        OCIO::TRANSFORM_DIR_FORWARD));
+
+        OCIO_CHECK_EQUAL(config->getProcessor(context, transform, OCIO::TRANSFORM_DIR_FORWARD),
+                         proc);
+    }
+
+    size_t hits = 0, misses = 0, evictions = 0, entries = 0, bytes = 0;
+    config->getProcessorCacheStatistics(hits, misses, evictions, entries, bytes);
+    OCIO_CHECK_EQUAL(hits, 2);
+    OCIO_CHECK_EQUAL(misses, 2);
+    OCIO_CHECK_EQUAL(entries, 2);
+
+    // Another context with the same context variable values still finds the processor.
+
+    OCIO::ContextRcPtr otherContext = context->createEditableCopy();
+    otherContext->setStringVar("UNUSED", "value");
+
+    OCIO::ColorSpaceTransformRcPtr transform = OCIO::ColorSpaceTransform::Create();
+    transform->setSrc("cs1");
+    transform->setDst("cs3");
+
+    OCIO::ConstProcessorRcPtr proc = config->getProcessor(context, transform,
+                                                          OCIO::TRANSFORM_DIR_FORWARD);
+    OCIO_CHECK_EQUAL(config->getProcessor(otherContext, transform, OCIO::TRANSFORM_DIR_FORWARD),
+                     proc);
+
+    // But not with a different value.
+
+    otherContext->setStringVar("LUT", "lut1d_1.spi1d");
+    OCIO_CHECK_NE(config->getProcessor(otherContext, transform, OCIO::TRANSFORM_DIR_FORWARD),
+                  proc);
+}
+
+OCIO_ADD_TEST(Caching, single_flight)
+{
+    // Concurrent requests for the same key share a single creation.
+
+    constexpr int NumThreads = 8;
+
+    OCIO::SingleFlight<std::string, DataRcPtr> flights;
+
+    std::atomic<int> numLookups{ 0 };
+    std::atomic<int> numCreations{ 0 };
+
+    // The lookup is called under the lock of the pending creations i.e. once all the requests
+    // did their lookup, they all wait for the same creation.
+    auto lookup = [&numLookups](DataRcPtr &) { ++numLookups; return false; };
+
+    auto create = [&numLookups, &numCreations]()
+    {
+        ++numCreations;
+        while (numLookups < NumThreads)
+        {
+            std::this_thread::yield();
+        }
+        return std::make_shared<Data>();
+    };
+
+    std::vector<DataRcPtr> results(NumThreads);
+    std::vector<std::thread> threads;
+    for (int i = 0; i < NumThreads; ++i)
+    {
+        threads.emplace_back([&, i]() { results[i] = flights.get("key", lookup, create); });
+    }
+    for (auto & thread : threads)
+    {
+        thread.join();
+    }
+
+    // The factory ran once and all the requests got the same entry.
+    OCIO_CHECK_EQUAL(numCreations.load(), 1);
+    OCIO_REQUIRE_ASSERT(results[0]);
+    for (const auto & result : results)
+    {
+        OCIO_CHECK_EQUAL(result, results[0]);
+    }
+    OCIO_CHECK_EQUAL(flights.getNumPending(), 0);
+
+    // The waiting requests get the exception of a failed creation.
+
+    numLookups   = 0;
+    numCreations = 0;
+
+    auto fail = [&numLookups, &numCreations]() -> DataRcPtr
+    {
+        ++numCreations;
+        while (numLookups < NumThreads)
+        {
+            std::this_thread::yield();
+        }
+        throw OCIO::Exception("Creation failure.");
+    };
+
+    std::atomic<int> numErrors{ 0 };
+    threads.clear();
+    for (int i = 0; i < NumThreads; ++i)
+    {
+        threads.emplace_back([&]()
+        {
+            try
+            {
+                flights.get("key", lookup, fail);
+            }
+            catch (const OCIO::Exception & e)
+            {
+                if (std::string(e.what()) == "Creation failure.")
+                {
+                    ++numErrors;
+                }
+            }
+        });
+    }
+    for (auto & thread : threads)
+    {
+        thread.join();
+    }
+
+    OCIO_CHECK_EQUAL(numCreations.load(), 1);
+    OCIO_CHECK_EQUAL(numErrors.load(), NumThreads);
+
+    // A failed creation does not stay pending i.e. the next request creates the entry again.
+    OCIO_CHECK_EQUAL(flights.getNumPending(), 0);
+
+    DataRcPtr entry;
+    OCIO_CHECK_NO_THROW(entry = flights.get("key", lookup, create));
+    OCIO_CHECK_ASSERT(entry);
+    OCIO_CHECK_ASSERT(entry != results[0]);
+    OCIO_CHECK_EQUAL(numCreations.load(), 2);
+
+    // An entry found by the lookup is never created.
+    auto found = [&entry](DataRcPtr & e) { e = entry; return true; };
+    OCIO_CHECK_EQUAL(flights.get("key", found, fail), entry);
+    OCIO_CHECK_EQUAL(numCreations.load(), 2);
+}
+
+OCIO_ADD_TEST(Caching, weak_cache)
+{
+    OCIO::WeakCache<std::string, Data> cache;
+
+    OCIO_CHECK_ASSERT(!cache.get("key"));
+
+    // The cache returns the added entry while one user keeps it.
+    std::shared_ptr<const Data> entry = std::make_shared<Data>();
+    OCIO_CHECK_EQUAL(cache.add("key", entry), entry);
+    OCIO_CHECK_EQUAL(cache.get("key"), entry);
+
+    // Adding another entry for the same key returns the existing one.
+    OCIO_CHECK_EQUAL(cache.add("key", std::make_shared<Data>()), entry);
+
+    // The cache does not own the entries.
+    const std::weak_ptr<const Data> weakEntry = entry;
+    entry.reset();
+    OCIO_CHECK_ASSERT(weakEntry.expired());
+    OCIO_CHECK_ASSERT(!cache.get("key"));
+
+    // An expired entry is replaced.
+    entry = std::make_shared<Data>();
+    OCIO_CHECK_EQUAL(cache.add("key", entry), entry);
+    OCIO_CHECK_EQUAL(cache.get("key"), entry);
+
+    // The expired entries are removed once in a while.
+    for (int i = 0; i < 200; ++i)
+    {
+        cache.add(std::to_string(i), std::make_shared<Data>());
+    }
+    OCIO_CHECK_ASSERT(cache.size() < 100);
+    OCIO_CHECK_EQUAL(cache.get("key"), entry);
+}
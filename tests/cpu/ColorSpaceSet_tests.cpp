@@ -314,3 +314,83 @@ OCIO_ADD_TEST(ColorSpaceSet, operations_on_set)
 
     OCIO_CHECK_EQUAL(css4->getNumColorSpaces(), 0);
 }
+
+OCIO_ADD_TEST(ColorSpaceSet, name_index)
+{
+    // The names & aliases are indexed, check the index stays in sync with the color spaces.
+
+    OCIO::ColorSpaceSetRcPtr css = OCIO::ColorSpaceSet::Create();
+
+    constexpr int numCS = 200;
+    for (int idx = 0; idx < numCS; ++idx)
+    {
+        OCIO::ColorSpaceRcPtr cs = OCIO::ColorSpace::Create();
+        cs->setName(("Color Space " + std::to_string(idx)).c_str());
+        cs->addAlias(("alias" + std::to_string(idx)).c_str());
+        cs->addAlias(("ALT" + std::to_string(idx)).c_str());
+        OCIO_CHECK_NO_THROW(css->addColorSpace(cs));
+    }
+    OCIO_REQUIRE_EQUAL(css->getNumColorSpaces(), numCS);
+
+    // Names and aliases are case insensitive.
+    OCIO_CHECK_EQUAL(css->getColorSpaceIndex("color space 0"), 0);
+    OCIO_CHECK_EQUAL(css->getColorSpaceIndex("COLOR SPACE 150"), 150);
+    OCIO_CHECK_EQUAL(css->getColorSpaceIndex("Alias42"), 42);
+    OCIO_CHECK_EQUAL(css->getColorSpaceIndex("alt199"), 199);
+    OCIO_CHECK_EQUAL(css->getColorSpaceIndex("alias200"), -1);
+    OCIO_CHECK_EQUAL(css->getColorSpaceIndex(""), -1);
+    OCIO_CHECK_EQUAL(css->getColorSpaceIndex(nullptr), -1);
+    OCIO_CHECK_ASSERT(css->hasColorSpace("ALIAS7"));
+
+    // An alias can not be used as the name of another color space.
+    {
+        OCIO::ColorSpaceRcPtr cs = OCIO::ColorSpace::Create();
+        cs->setName("alias3");
+        OCIO_CHECK_THROW_WHAT(css->addColorSpace(cs), OCIO::Exception,
+                              "Cannot add 'alias3' color space, existing color space, "
+                              "'Color Space 3' is using this name as an alias.");
+    }
+
+    // Replace a color space, its aliases change.
+    {
+        OCIO::ColorSpaceRcPtr cs = OCIO::ColorSpace::Create();
+        cs->setName("COLOR space 10");
+        cs->addAlias("new alias");
+        OCIO_CHECK_NO_THROW(css->addColorSpace(cs));
+        OCIO_CHECK_EQUAL(css->getNumColorSpaces(), numCS);
+        OCIO_CHECK_EQUAL(css->getColorSpaceIndex("color space 10"), 10);
+        OCIO_CHECK_EQUAL(css->getColorSpaceIndex("New Alias"), 10);
+        OCIO_CHECK_EQUAL(css->getColorSpaceIndex("alias10"), -1);
+        OCIO_CHECK_EQUAL(std::string(css->getColorSpaceNameByIndex(10)),
+                         std::string("COLOR space 10"));
+    }
+
+    // Removing a color space shifts the next ones. An alias does not remove a color space.
+    OCIO_CHECK_NO_THROW(css->removeColorSpace("alias0"));
+    OCIO_CHECK_EQUAL(css->getNumColorSpaces(), numCS);
+    OCIO_CHECK_NO_THROW(css->removeColorSpace("color SPACE 0"));
+    OCIO_REQUIRE_EQUAL(css->getNumColorSpaces(), numCS - 1);
+    OCIO_CHECK_EQUAL(css->getColorSpaceIndex("alias0"), -1);
+    OCIO_CHECK_EQUAL(css->getColorSpaceIndex("alias1"), 0);
+    OCIO_CHECK_EQUAL(css->getColorSpaceIndex("new alias"), 9);
+    OCIO_CHECK_EQUAL(css->getColorSpaceIndex("Color Space 199"), numCS - 2);
+
+    // The copy has its own index.
+    OCIO::ColorSpaceSetRcPtr copy = css->createEditableCopy();
+    OCIO_CHECK_EQUAL(copy->getColorSpaceIndex("alt50"), 49);
+    OCIO_CHECK_NO_THROW(css->clearColorSpaces());
+    OCIO_CHECK_EQUAL(css->getColorSpaceIndex("alt50"), -1);
+    OCIO_CHECK_EQUAL(copy->getColorSpaceIndex("alt50"), 49);
+
+    // Remove a set of color spaces.
+    OCIO::ColorSpaceSetRcPtr toRemove = OCIO::ColorSpaceSet::Create();
+    toRemove->addColorSpace(copy->getColorSpaceByIndex(0));
+    toRemove->addColorSpace(copy->getColorSpaceByIndex(100));
+    OCIO_CHECK_NO_THROW(copy->removeColorSpaces(toRemove));
+    OCIO_REQUIRE_EQUAL(copy->getNumColorSpaces(), numCS - 3);
+    OCIO_CHECK_EQUAL(copy->getColorSpaceIndex("alias1"), -1);
+    OCIO_CHECK_EQUAL(copy->getColorSpaceIndex("alias2"), 0);
+    OCIO_CHECK_EQUAL(copy->getColorSpaceIndex("alias101"), -1);
+    OCIO_CHECK_EQUAL(copy->getColorSpaceIndex("alias102"), 99);
+    OCIO_CHECK_EQUAL(copy->getColorSpaceIndex("ALT199"), numCS - 4);
+}
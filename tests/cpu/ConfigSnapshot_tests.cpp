@@ -0,0 +1,499 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#include <cstdio>
+#include <sstream>
+
+#include <pystring.h>
+
+#include "ConfigSnapshot.cpp"
+
+#include "testutils/UnitTest.h"
+#include "UnitTestUtils.h"
+#include "Platform.h"
+#include "utils/StringUtils.h"
+
+namespace OCIO = OCIO_NAMESPACE;
+
+
+namespace
+{
+
+std::string Serialize(const OCIO::ConstConfigRcPtr & config)
+{
+    std::ostringstream oss;
+    config->serialize(oss);
+    return oss.str();
+}
+
+std::string Snapshot(const OCIO::ConstConfigRcPtr & config)
+{
+    std::ostringstream oss;
+    config->serializeSnapshot(oss);
+    return oss.str();
+}
+
+OCIO::ConstConfigRcPtr LoadSnapshot(const std::string & snapshot)
+{
+    std::istringstream iss(snapshot);
+    return OCIO::Config::CreateFromStream(iss);
+}
+
+constexpr char ALL_SECTIONS_CONFIG[] = R"(ocio_profile_version: 2.5
+
+environment:
+  SHOT: 001a
+  SEQ: abc
+search_path:
+  - luts
+  - shots/$SHOT
+strictparsing: false
+family_separator: "~"
+luma: [0.2126, 0.7152, 0.0722]
+name: snapshot
+description: |
+  A config using
+  most of the features.
+
+roles:
+  default: raw
+  scene_linear: lin
+  aces_interchange: lin
+  cie_xyz_d65_interchange: P3
+  color_timing: log
+  compositing_log: log
+
+file_rules:
+  - !<Rule> {name: ColorSpaceNamePathSearch}
+  - !<Rule> {name: exr, colorspace: lin, pattern: "*", extension: exr, custom: {key1: value1}}
+  - !<Rule> {name: tiff, colorspace: video, regex: ".*\\.tiff?$"}
+  - !<Rule> {name: Default, colorspace: raw}
+
+viewing_rules:
+  - !<Rule> {name: linear, colorspaces: [lin], custom: {key2: value2}}
+  - !<Rule> {name: video, encodings: [sdr-video]}
+
+shared_views:
+  - !<View> {name: Film, view_transform: film, display_colorspace: <USE_DISPLAY_NAME>, looks: +grade, rule: linear, description: A shared view}
+
+displays:
+  sRGB:
+    - !<View> {name: Raw, colorspace: raw}
+    - !<View> {name: Video, colorspace: video, rule: video}
+    - !<Views> [Film]
+  P3:
+    - !<Views> [Film]
+
+virtual_display:
+  - !<View> {name: Raw, colorspace: raw}
+  - !<Views> [Film]
+
+active_displays: [sRGB, P3]
+active_views: [Film, Raw]
+inactive_colorspaces: [unused]
+
+looks:
+  - !<Look>
+    name: grade
+    process_space: log
+    description: A look
+    transform: !<CDLTransform> {name: cdl, slope: [1, 1.1, 1.2], offset: [0.1, 0, -0.1], power: [1, 0.9, 1.1], sat: 0.9}
+    inverse_transform: !<CDLTransform> {slope: [1, 1.1, 1.2], direction: inverse}
+
+default_view_transform: film
+
+view_transforms:
+  - !<ViewTransform>
+    name: film
+    family: Film
+    categories: [look]
+    from_scene_reference: !<GroupTransform>
+      name: group
+      children:
+        - !<BuiltinTransform> {style: ACES-OUTPUT - ACES2065-1_to_CIE-XYZ-D65 - SDR-VIDEO_1.0}
+        - !<FixedFunctionTransform> {style: REC2100_Surround, params: [0.75], direction: inverse}
+        - !<ExposureContrastTransform> {style: linear, exposure: 0.5, contrast: 1.1, gamma: 0.9, pivot: 0.18}
+        - !<GradingPrimaryTransform> {style: log, contrast: {rgb: [1.1, 1, 1], master: 1.1}}
+        - !<GradingRGBCurveTransform>
+          style: video
+          blue: {control_points: [0, 0, 0.1, 0.5, 1, 1.5], slopes: [0, 1, 1.1]}
+          direction: inverse
+        - !<GradingHueCurveTransform>
+          style: log
+          hue_hue: {control_points: [0, 0.15, 0.5, 0.5, 1, 1.123456]}
+        - !<GradingToneTransform> {style: log, s_contrast: 1.1}
+        - !<RangeTransform> {min_in_value: 0, max_in_value: 1, min_out_value: 0.1, max_out_value: 0.9, style: noClamp}
+        - !<MatrixTransform> {name: mtx, matrix: [1, 0, 0, 0, 0, 2, 0, 0, 0, 0, 3, 0, 0, 0, 0, 1], offset: [0.1, 0.2, 0.3, 0]}
+
+display_colorspaces:
+  - !<ColorSpace>
+    name: sRGB
+    family: Display
+    encoding: sdr-video
+    from_display_reference: !<ExponentWithLinearTransform> {gamma: 2.4, offset: 0.055, direction: inverse}
+
+  - !<ColorSpace>
+    name: P3
+    from_display_reference: !<ExponentTransform> {value: [2.6, 2.6, 2.6, 1], style: mirror}
+
+colorspaces:
+  - !<ColorSpace>
+    name: raw
+    aliases: [data]
+    isdata: true
+    categories: [file-io]
+
+  - !<ColorSpace>
+    name: lin
+    aliases: [lin_ap0]
+    interop_id: lin_ap0
+    equalitygroup: scene
+    bitdepth: 32f
+    description: The linear color space.
+    encoding: scene-linear
+    allocation: lg2
+    allocationvars: [-8, 5, 0.00390625]
+
+  - !<ColorSpace>
+    name: log
+    family: Log~Camera
+    to_scene_reference: !<LogCameraTransform> {log_side_slope: [1, 1, 1.1], lin_side_break: [0.1, 0.2, 0.3], linear_slope: [1.2, 1.2, 1.2]}
+    from_scene_reference: !<GroupTransform>
+      children:
+        - !<LogAffineTransform> {base: 10, log_side_offset: [0.1, 0.1, 0.1]}
+        - !<LogTransform> {base: 2}
+        - !<AllocationTransform> {allocation: lg2, vars: [-8, 5]}
+
+  - !<ColorSpace>
+    name: video
+    to_scene_reference: !<GroupTransform>
+      children:
+        - !<FileTransform> {src: lut.cube, cccid: cc0001, interpolation: tetrahedral, direction: inverse}
+        - !<ColorSpaceTransform> {src: lin, dst: log, data_bypass: false}
+        - !<DisplayViewTransform> {src: lin, display: sRGB, view: Raw, looks_bypass: true}
+        - !<LookTransform> {src: lin, dst: log, looks: grade}
+
+  - !<ColorSpace>
+    name: unused
+
+named_transforms:
+  - !<NamedTransform>
+    name: nt
+    aliases: [nt_alias]
+    family: Utility
+    categories: [working-space]
+    encoding: log
+    transform: !<LogTransform> {base: 10}
+    inverse_transform: !<LogTransform> {base: 10, direction: inverse}
+)";
+
+} // anon.
+
+
+OCIO_ADD_TEST(ConfigSnapshot, all_sections)
+{
+    std::istringstream iss(ALL_SECTIONS_CONFIG);
+    OCIO::ConstConfigRcPtr config;
+    OCIO_CHECK_NO_THROW(config = OCIO::Config::CreateFromStream(iss));
+    OCIO_REQUIRE_ASSERT(config);
+
+    const std::string snapshot = Snapshot(config);
+    OCIO_CHECK_ASSERT(OCIO::ConfigSnapshot::IsSnapshot(snapshot.data(), snapshot.size()));
+
+    OCIO::ConstConfigRcPtr snapConfig;
+    OCIO_CHECK_NO_THROW(snapConfig = LoadSnapshot(snapshot));
+    OCIO_REQUIRE_ASSERT(snapConfig);
+
+    // The loaded config is identical to the original one.
+    OCIO_CHECK_EQUAL(Serialize(snapConfig), Serialize(config));
+    OCIO_CHECK_EQUAL(std::string(snapConfig->getCacheID()), std::string(config->getCacheID()));
+
+    OCIO_CHECK_EQUAL(snapConfig->getEnvironmentMode(), OCIO::ENV_ENVIRONMENT_LOAD_PREDEFINED);
+    OCIO_CHECK_EQUAL(std::string(snapConfig->getCurrentContext()->getStringVar("SHOT")),
+                     std::string("001a"));
+    OCIO_CHECK_EQUAL(snapConfig->getNumColorSpaces(), 6);
+    OCIO_CHECK_ASSERT(snapConfig->isInactiveColorSpace("unused"));
+    OCIO_CHECK_EQUAL(std::string(snapConfig->getColorSpace("data")->getName()),
+                     std::string("raw"));
+    OCIO_CHECK_EQUAL(std::string(snapConfig->getColorSpaceFromFilepath("/a/b.exr")),
+                     std::string("lin"));
+    OCIO_CHECK_EQUAL(std::string(snapConfig->getColorSpaceFromFilepath("/a/b.tif")),
+                     std::string("video"));
+    OCIO_CHECK_EQUAL(std::string(snapConfig->getVirtualDisplayView(OCIO::VIEW_SHARED, 0)),
+                     std::string("Film"));
+    OCIO_CHECK_NO_THROW(snapConfig->validate());
+
+    // A snapshot of the snapshot is identical.
+    OCIO_CHECK_EQUAL(Snapshot(snapConfig), snapshot);
+}
+
+OCIO_ADD_TEST(ConfigSnapshot, v1_config)
+{
+    constexpr char CONFIG[] = R"(ocio_profile_version: 1
+
+search_path: luts:shots
+strictparsing: true
+luma: [0.2126, 0.7152, 0.0722]
+
+roles:
+  default: raw
+
+displays:
+  sRGB:
+    - !<View> {name: Raw, colorspace: raw}
+
+active_displays: []
+active_views: []
+
+colorspaces:
+  - !<ColorSpace>
+    name: raw
+    isdata: true
+
+  - !<ColorSpace>
+    name: lnf
+    to_reference: !<CDLTransform> {slope: [1, 1.1, 1.2]}
+)";
+
+    std::istringstream iss(CONFIG);
+    OCIO::ConstConfigRcPtr config;
+    OCIO_CHECK_NO_THROW(config = OCIO::Config::CreateFromStream(iss));
+    OCIO_REQUIRE_ASSERT(config);
+
+    OCIO::ConstConfigRcPtr snapConfig;
+    OCIO_CHECK_NO_THROW(snapConfig = LoadSnapshot(Snapshot(config)));
+    OCIO_REQUIRE_ASSERT(snapConfig);
+
+    OCIO_CHECK_EQUAL(snapConfig->getMajorVersion(), 1);
+    OCIO_CHECK_EQUAL(Serialize(snapConfig), Serialize(config));
+    OCIO_CHECK_EQUAL(snapConfig->getEnvironmentMode(), OCIO::ENV_ENVIRONMENT_LOAD_ALL);
+    // The in-memory file rules of a v1 config are also preserved.
+    OCIO_CHECK_EQUAL(snapConfig->getFileRules()->getNumEntries(),
+                     config->getFileRules()->getNumEntries());
+    OCIO_CHECK_EQUAL(std::string(snapConfig->getColorSpaceFromFilepath("a_lnf.exr")),
+                     std::string("lnf"));
+}
+
+OCIO_ADD_TEST(ConfigSnapshot, builtin_configs)
+{
+    const OCIO::BuiltinConfigRegistry & registry = OCIO::BuiltinConfigRegistry::Get();
+    for (size_t i = 0; i < registry.getNumBuiltinConfigs(); ++i)
+    {
+        const char * name = registry.getBuiltinConfigName(i);
+
+        OCIO::ConstConfigRcPtr config = OCIO::Config::CreateFromBuiltinConfig(name);
+        OCIO::ConstConfigRcPtr snapConfig;
+        OCIO_CHECK_NO_THROW(snapConfig = LoadSnapshot(Snapshot(config)));
+        OCIO_REQUIRE_ASSERT(snapConfig);
+        OCIO_CHECK_EQUAL(Serialize(snapConfig), Serialize(config));
+        OCIO_CHECK_EQUAL(std::string(snapConfig->getCacheID()),
+                         std::string(config->getCacheID()));
+    }
+}
+
+OCIO_ADD_TEST(ConfigSnapshot, transforms)
+{
+    // Some transforms or values are not serializable in the YAML form.
+
+    auto lut1d = OCIO::Lut1DTransform::Create(5, true);
+    lut1d->setValue(2, 0.1f, 0.2f, 0.3f);
+    lut1d->setHueAdjust(OCIO::HUE_DW3);
+    lut1d->getFormatMetadata().addChildElement("Description", "A 1D LUT");
+    lut1d->getFormatMetadata().getChildElement(0).addAttribute("lang", "en");
+
+    auto lut3d = OCIO::Lut3DTransform::Create(3);
+    lut3d->setValue(1, 2, 0, 0.5f, 0.25f, 0.125f);
+    lut3d->setInterpolation(OCIO::INTERP_TETRAHEDRAL);
+    lut3d->setDirection(OCIO::TRANSFORM_DIR_INVERSE);
+
+    auto ec = OCIO::ExposureContrastTransform::Create();
+    ec->setExposure(1.5);
+    ec->makeExposureDynamic();
+    ec->makeGammaDynamic();
+
+    auto primary = OCIO::GradingPrimaryTransform::Create(OCIO::GRADING_LIN);
+    primary->makeDynamic();
+
+    auto hue = OCIO::GradingHueCurveTransform::Create(OCIO::GRADING_LIN);
+    hue->setRGBToHSY(OCIO::HSY_TRANSFORM_NONE);
+    hue->setSlope(OCIO::HUE_SAT, 0, 0.5f);
+
+    auto group = OCIO::GroupTransform::Create();
+    group->appendTransform(lut1d);
+    group->appendTransform(lut3d);
+    group->appendTransform(ec);
+    group->appendTransform(primary);
+    group->appendTransform(hue);
+
+    auto cs = OCIO::ColorSpace::Create();
+    cs->setName("cs");
+    cs->setTransform(group, OCIO::COLORSPACE_DIR_TO_REFERENCE);
+
+    OCIO::ConfigRcPtr config = OCIO::Config::CreateRaw()->createEditableCopy();
+    config->setVersion(2, 5);
+    config->addColorSpace(cs);
+
+    OCIO::ConstConfigRcPtr snapConfig;
+    OCIO_CHECK_NO_THROW(snapConfig = LoadSnapshot(Snapshot(config)));
+    OCIO_REQUIRE_ASSERT(snapConfig);
+
+    auto snapGroup = OCIO::DynamicPtrCast<const OCIO::GroupTransform>(
+        snapConfig->getColorSpace("cs")->getTransform(OCIO::COLORSPACE_DIR_TO_REFERENCE));
+    OCIO_REQUIRE_ASSERT(snapGroup);
+    OCIO_REQUIRE_EQUAL(snapGroup->getNumTransforms(), group->getNumTransforms());
+
+    for (int i = 0; i < group->getNumTransforms(); ++i)
+    {
+        std::ostringstream expected, result;
+        expected << *group->getTransform(i);
+        result << *snapGroup->getTransform(i);
+        OCIO_CHECK_EQUAL(result.str(), expected.str());
+    }
+
+    auto snapLut1d = OCIO::DynamicPtrCast<const OCIO::Lut1DTransform>(snapGroup->getTransform(0));
+    OCIO_REQUIRE_ASSERT(snapLut1d);
+    OCIO_CHECK_ASSERT(snapLut1d->equals(*lut1d));
+    OCIO_CHECK_EQUAL(std::string(snapLut1d->getFormatMetadata().getChildElement(0)
+                                     .getAttributeValue("lang")), std::string("en"));
+
+    auto snapLut3d = OCIO::DynamicPtrCast<const OCIO::Lut3DTransform>(snapGroup->getTransform(1));
+    OCIO_REQUIRE_ASSERT(snapLut3d);
+    OCIO_CHECK_ASSERT(snapLut3d->equals(*lut3d));
+
+    auto snapEC = OCIO::DynamicPtrCast<const OCIO::ExposureContrastTransform>(
+        snapGroup->getTransform(2));
+    OCIO_REQUIRE_ASSERT(snapEC);
+    OCIO_CHECK_ASSERT(snapEC->isExposureDynamic());
+    OCIO_CHECK_ASSERT(!snapEC->isContrastDynamic());
+    OCIO_CHECK_ASSERT(snapEC->isGammaDynamic());
+
+    auto snapPrimary = OCIO::DynamicPtrCast<const OCIO::GradingPrimaryTransform>(
+        snapGroup->getTransform(3));
+    OCIO_REQUIRE_ASSERT(snapPrimary);
+    OCIO_CHECK_ASSERT(snapPrimary->isDynamic());
+
+    auto snapHue = OCIO::DynamicPtrCast<const OCIO::GradingHueCurveTransform>(
+        snapGroup->getTransform(4));
+    OCIO_REQUIRE_ASSERT(snapHue);
+    OCIO_CHECK_EQUAL(snapHue->getRGBToHSY(), OCIO::HSY_TRANSFORM_NONE);
+    OCIO_CHECK_EQUAL(snapHue->getSlope(OCIO::HUE_SAT, 0), 0.5f);
+}
+
+OCIO_ADD_TEST(ConfigSnapshot, create_from_file)
+{
+    std::istringstream iss(ALL_SECTIONS_CONFIG);
+    OCIO::ConfigRcPtr config;
+    OCIO_CHECK_NO_THROW(config = OCIO::Config::CreateFromStream(iss)->createEditableCopy());
+    OCIO_REQUIRE_ASSERT(config);
+
+    const std::string filename = OCIO::Platform::CreateTempFilename(".ociosnap");
+    OCIO_CHECK_NO_THROW(config->serializeSnapshot(filename.c_str()));
+
+    // Without a working directory, the one of the snapshot file is used.
+    OCIO::ConstConfigRcPtr snapConfig;
+    OCIO_CHECK_NO_THROW(snapConfig = OCIO::Config::CreateFromFile(filename.c_str()));
+    OCIO_REQUIRE_ASSERT(snapConfig);
+    OCIO_CHECK_EQUAL(Serialize(snapConfig), Serialize(config));
+    OCIO_CHECK_EQUAL(std::string(snapConfig->getWorkingDir()),
+                     pystring::os::path::dirname(OCIO::AbsPath(filename)));
+
+    // Otherwise, the working directory of the config is kept.
+    config->setWorkingDir("/shows/abc/config");
+    // An existing snapshot is replaced.
+    OCIO_CHECK_NO_THROW(config->serializeSnapshot(filename.c_str()));
+    OCIO_CHECK_NO_THROW(snapConfig = OCIO::Config::CreateFromFile(filename.c_str()));
+    OCIO_REQUIRE_ASSERT(snapConfig);
+    OCIO_CHECK_EQUAL(std::string(snapConfig->getWorkingDir()), std::string("/shows/abc/config"));
+
+    std::remove(filename.c_str());
+
+    // The snapshot file could not be written.
+    const std::string missingDir = pystring::os::path::join(
+        pystring::os::path::dirname(filename), "missing_dir");
+    const std::string missingFilename
+        = pystring::os::path::join(missingDir, "config.ociosnap");
+    OCIO_CHECK_THROW_WHAT(config->serializeSnapshot(missingFilename.c_str()), OCIO::Exception,
+                          "Error building the config snapshot: Could not open the file");
+    OCIO_CHECK_THROW_WHAT(config->serializeSnapshot(""), OCIO::Exception,
+                          "The config snapshot filename is empty.");
+}
+
+OCIO_ADD_TEST(ConfigSnapshot, errors)
+{
+    std::istringstream iss(ALL_SECTIONS_CONFIG);
+    OCIO::ConstConfigRcPtr config;
+    OCIO_CHECK_NO_THROW(config = OCIO::Config::CreateFromStream(iss));
+    OCIO_REQUIRE_ASSERT(config);
+    const std::string snapshot = Snapshot(config);
+
+    {
+        // Any change of the payload is detected.
+        std::string corrupted = snapshot;
+        corrupted[corrupted.size() / 2] ^= 0x01;
+        OCIO_CHECK_THROW_WHAT(LoadSnapshot(corrupted), OCIO::Exception,
+                              "The config snapshot '<stream>' is corrupted.");
+    }
+
+    {
+        const std::string truncated = snapshot.substr(0, snapshot.size() - 1);
+        OCIO_CHECK_THROW_WHAT(LoadSnapshot(truncated), OCIO::Exception,
+                              "The config snapshot '<stream>' is corrupted.");
+    }
+
+    {
+        const std::string truncated = snapshot.substr(0, OCIO::ConfigSnapshot::SignatureSize + 2);
+        OCIO_CHECK_THROW_WHAT(LoadSnapshot(truncated), OCIO::Exception,
+                              "The config snapshot '<stream>' is corrupted.");
+    }
+
+    {
+        // The format version follows the signature.
+        std::string otherVersion = snapshot;
+        otherVersion[OCIO::ConfigSnapshot::SignatureSize] += 1;
+        OCIO_CHECK_THROW_WHAT(LoadSnapshot(otherVersion), OCIO::Exception,
+                              "uses the format version 2 but this version of the OpenColorIO "
+                              "library");
+    }
+
+    {
+        // Only the first signature byte is checked to detect a snapshot in a stream.
+        std::string otherSignature = snapshot;
+        otherSignature[1] = 'X';
+        OCIO_CHECK_THROW_WHAT(LoadSnapshot(otherSignature), OCIO::Exception,
+                              "The config snapshot '<stream>' is corrupted.");
+        OCIO_CHECK_ASSERT(!OCIO::ConfigSnapshot::IsSnapshot(otherSignature.data(),
+                                                            otherSignature.size()));
+    }
+}
+
+OCIO_ADD_TEST(ConfigSnapshot, enum_values)
+{
+    // The enum values are range checked when reading a snapshot.
+
+    OCIO::SnapshotWriter w;
+    w.writeEnum(OCIO::TRANSFORM_DIR_INVERSE);
+    w.writePOD<int32_t>(OCIO::TRANSFORM_DIR_INVERSE + 1);
+    w.writePOD<int32_t>(-1);
+    w.writeEnum(OCIO::INTERP_BEST);
+    w.writePOD<int32_t>(OCIO::INTERP_CUBIC + 1);
+    w.writeEnum(OCIO::FIXED_FUNCTION_RGB_TO_HSY_VID);
+    w.writePOD<int32_t>(OCIO::FIXED_FUNCTION_RGB_TO_HSY_VID + 1);
+
+    const std::string & data = w.buffer();
+    OCIO::SnapshotReader r(data.data(), data.size(), "enums");
+
+    OCIO_CHECK_EQUAL(r.readEnum<OCIO::TransformDirection>(), OCIO::TRANSFORM_DIR_INVERSE);
+    OCIO_CHECK_THROW_WHAT(r.readEnum<OCIO::TransformDirection>(), OCIO::Exception,
+                          "The config snapshot 'enums' is corrupted.");
+    OCIO_CHECK_THROW_WHAT(r.readEnum<OCIO::TransformDirection>(), OCIO::Exception,
+                          "The config snapshot 'enums' is corrupted.");
+    OCIO_CHECK_EQUAL(r.readEnum<OCIO::Interpolation>(), OCIO::INTERP_BEST);
+    OCIO_CHECK_THROW_WHAT(r.readEnum<OCIO::Interpolation>(), OCIO::Exception,
+                          "The config snapshot 'enums' is corrupted.");
+    OCIO_CHECK_EQUAL(r.readEnum<OCIO::FixedFunctionStyle>(),
+                     OCIO::FIXED_FUNCTION_RGB_TO_HSY_VID);
+    OCIO_CHECK_THROW_WHAT(r.readEnum<OCIO::FixedFunctionStyle>(), OCIO::Exception,
+                          "The config snapshot 'enums' is corrupted.");
+    OCIO_CHECK_ASSERT(r.atEnd());
+}
@@ -10416,3 +10416,350 @@ view_transforms:
     }
 }
 
+
+OCIO_ADD_TEST(Config, name_index)
+{
+    // The names of the looks, view transforms & named transforms (and the aliases of the named
+    // transforms) are indexed, check the indexes stay in sync with the lists.
+
+    OCIO::ConfigRcPtr config = OCIO::Config::Create();
+
+    constexpr int num = 50;
+    for (int idx = 0; idx < num; ++idx)
+    {
+        const std::string suffix = std::to_string(idx);
+
+        OCIO::LookRcPtr look = OCIO::Look::Create();
+        look->setName(("Look " + suffix).c_str());
+        OCIO_CHECK_NO_THROW(config->addLook(look));
+
+        OCIO::ViewTransformRcPtr vt = OCIO::ViewTransform::Create(OCIO::REFERENCE_SPACE_SCENE);
+        vt->setName(("View Transform " + suffix).c_str());
+        vt->setTransform(OCIO::MatrixTransform::Create(), OCIO::VIEWTRANSFORM_DIR_TO_REFERENCE);
+        OCIO_CHECK_NO_THROW(config->addViewTransform(vt));
+
+        OCIO::NamedTransformRcPtr nt = OCIO::NamedTransform::Create();
+        nt->setName(("Named Transform " + suffix).c_str());
+        nt->addAlias(("nt" + suffix).c_str());
+        nt->setTransform(OCIO::MatrixTransform::Create(), OCIO::TRANSFORM_DIR_FORWARD);
+        OCIO_CHECK_NO_THROW(config->addNamedTransform(nt));
+    }
+    OCIO_REQUIRE_EQUAL(config->getNumLooks(), num);
+    OCIO_REQUIRE_EQUAL(config->getNumViewTransforms(), num);
+    OCIO_REQUIRE_EQUAL(config->getNumNamedTransforms(), num);
+
+    // Lookups are case insensitive.
+    OCIO_REQUIRE_ASSERT(config->getLook("LOOK 12"));
+    OCIO_CHECK_EQUAL(std::string(config->getLook("LOOK 12")->getName()), "Look 12");
+    OCIO_REQUIRE_ASSERT(config->getViewTransform("view transform 49"));
+    OCIO_CHECK_EQUAL(std::string(config->getViewTransform("view transform 49")->getName()),
+                     "View Transform 49");
+    OCIO_REQUIRE_ASSERT(config->getNamedTransform("NT7"));
+    OCIO_CHECK_EQUAL(std::string(config->getNamedTransform("NT7")->getName()),
+                     "Named Transform 7");
+    OCIO_CHECK_ASSERT(!config->getLook("Look 50"));
+    OCIO_CHECK_ASSERT(!config->getLook(""));
+    OCIO_CHECK_ASSERT(!config->getViewTransform(nullptr));
+    OCIO_CHECK_ASSERT(!config->getNamedTransform("nt50"));
+
+    // Replacing an element keeps its position.
+    {
+        OCIO::LookRcPtr look = OCIO::Look::Create();
+        look->setName("look 3");
+        look->setDescription("replaced");
+        OCIO_CHECK_NO_THROW(config->addLook(look));
+        OCIO_CHECK_EQUAL(config->getNumLooks(), num);
+        OCIO_CHECK_EQUAL(std::string(config->getLookNameByIndex(3)), "look 3");
+        OCIO_CHECK_EQUAL(std::string(config->getLook("Look 3")->getDescription()), "replaced");
+
+        OCIO::ViewTransformRcPtr vt = OCIO::ViewTransform::Create(OCIO::REFERENCE_SPACE_DISPLAY);
+        vt->setName("VIEW TRANSFORM 3");
+        vt->setTransform(OCIO::MatrixTransform::Create(), OCIO::VIEWTRANSFORM_DIR_TO_REFERENCE);
+        OCIO_CHECK_NO_THROW(config->addViewTransform(vt));
+        OCIO_CHECK_EQUAL(config->getNumViewTransforms(), num);
+        OCIO_CHECK_EQUAL(std::string(config->getViewTransformNameByIndex(3)), "VIEW TRANSFORM 3");
+        OCIO_CHECK_EQUAL(config->getViewTransform("View Transform 3")->getReferenceSpaceType(),
+                         OCIO::REFERENCE_SPACE_DISPLAY);
+
+        // The aliases of the replaced named transform are updated.
+        OCIO::NamedTransformRcPtr nt = OCIO::NamedTransform::Create();
+        nt->setName("Named Transform 3");
+        nt->addAlias("replaced");
+        nt->setTransform(OCIO::MatrixTransform::Create(), OCIO::TRANSFORM_DIR_FORWARD);
+        OCIO_CHECK_NO_THROW(config->addNamedTransform(nt));
+        OCIO_CHECK_EQUAL(config->getNumNamedTransforms(), num);
+        OCIO_CHECK_ASSERT(!config->getNamedTransform("nt3"));
+        OCIO_REQUIRE_ASSERT(config->getNamedTransform("Replaced"));
+        OCIO_CHECK_EQUAL(std::string(config->getNamedTransform("Replaced")->getName()),
+                         "Named Transform 3");
+    }
+
+    // Removing a named transform shifts the next ones. An alias does not remove it.
+    OCIO_CHECK_NO_THROW(config->removeNamedTransform("nt0"));
+    OCIO_CHECK_EQUAL(config->getNumNamedTransforms(), num);
+    OCIO_CHECK_NO_THROW(config->removeNamedTransform("named transform 0"));
+    OCIO_CHECK_ASSERT(!config->getNamedTransform("nt0"));
+    OCIO_REQUIRE_ASSERT(config->getNamedTransform("nt49"));
+    OCIO_CHECK_EQUAL(std::string(config->getNamedTransform("nt49")->getName()),
+                     "Named Transform 49");
+
+    // The copy has its own indexes.
+    OCIO::ConfigRcPtr copy = config->createEditableCopy();
+
+    OCIO_CHECK_NO_THROW(config->clearLooks());
+    OCIO_CHECK_NO_THROW(config->clearViewTransforms());
+    OCIO_CHECK_NO_THROW(config->clearNamedTransforms());
+    OCIO_CHECK_ASSERT(!config->getLook("look 1"));
+    OCIO_CHECK_ASSERT(!config->getViewTransform("view transform 1"));
+    OCIO_CHECK_ASSERT(!config->getNamedTransform("nt1"));
+
+    OCIO_CHECK_ASSERT(copy->getLook("look 1"));
+    OCIO_CHECK_ASSERT(copy->getViewTransform("view transform 1"));
+    OCIO_CHECK_ASSERT(copy->getNamedTransform("nt1"));
+    OCIO_CHECK_ASSERT(copy->getNamedTransform("replaced"));
+}
+
+namespace
+{
+
+constexpr char LAZY_CONFIG[] =
+R"(ocio_profile_version: 2.1
+
+roles:
+  default: raw
+  scene_linear: lin
+
+displays:
+  sRGB:
+    - !<View> {name: Raw, colorspace: raw}
+    - !<View> {name: Film, view_transform: film, display_colorspace: display}
+
+active_displays: []
+active_views: []
+
+view_transforms:
+  - !<ViewTransform>
+    name: film
+    from_scene_reference: !<GroupTransform>
+      children:
+        - !<ExponentTransform> {value: 2.2}
+
+        # A comment in the middle of the transform.
+        - !<RangeTransform> {min_in_value: 0, max_in_value: 1, min_out_value: 0, max_out_value: 1}
+
+display_colorspaces:
+  - !<ColorSpace>
+    name: display
+    from_display_reference: !<BuiltinTransform> {style: ACES-LMT - ACES 1.3 Reference Gamut Compression}
+
+looks:
+  - !<Look>
+    name: grade
+    process_space: lin
+    transform: &grade !<CDLTransform> {slope: [1, 2, 1]}
+    inverse_transform: *grade
+
+colorspaces:
+- !<ColorSpace>
+  name: raw
+  isdata: true
+
+- !<ColorSpace> {name: flow, to_reference: !<MatrixTransform> {offset: [0.1, 0.1, 0.1, 0]}}
+
+- !<ColorSpace>
+  name: lin
+  description: |
+    The transform: is not a key.
+  to_scene_reference:
+    !<MatrixTransform> {offset: [0.5, 0.5, 0.5, 0]}
+  from_scene_reference: !<MatrixTransform> {offset: [-0.5, -0.5, -0.5, 0]}
+
+named_transforms:
+  - !<NamedTransform>
+    name: nt
+    transform: !<ExponentTransform> {value: 3}
+)";
+
+} // anon.
+
+OCIO_ADD_TEST(Config, lazy_loading)
+{
+    std::string eagerStr;
+    {
+        std::istringstream is(LAZY_CONFIG);
+        OCIO::ConstConfigRcPtr config;
+        OCIO_CHECK_NO_THROW(config = OCIO::Config::CreateFromStream(is));
+        OCIO_REQUIRE_ASSERT(config);
+        OCIO_CHECK_NO_THROW(config->validate());
+
+        std::ostringstream oss;
+        OCIO_CHECK_NO_THROW(config->serialize(oss));
+        eagerStr = oss.str();
+    }
+
+    OCIO::EnvironmentVariableGuard guard(OCIO::OCIO_LAZY_LOADING_ENVVAR, "1");
+
+    std::istringstream is(LAZY_CONFIG);
+    OCIO::ConstConfigRcPtr config;
+    OCIO_CHECK_NO_THROW(config = OCIO::Config::CreateFromStream(is));
+    OCIO_REQUIRE_ASSERT(config);
+
+    // The transforms are identical to the eager loading ones.
+
+    OCIO::ConstProcessorRcPtr proc;
+    OCIO_CHECK_NO_THROW(proc = config->getProcessor("lin", "raw"));
+    OCIO_CHECK_NO_THROW(proc = config->getProcessor("raw", "sRGB", "Film",
+                                                    OCIO::TRANSFORM_DIR_FORWARD));
+    OCIO_CHECK_NO_THROW(config->validate());
+
+    std::ostringstream oss;
+    OCIO_CHECK_NO_THROW(config->serialize(oss));
+    OCIO_CHECK_EQUAL(oss.str(), eagerStr);
+
+    // The deferred transforms are shared by the copies.
+
+    OCIO::ConstColorSpaceRcPtr cs = config->getColorSpace("lin");
+    OCIO_REQUIRE_ASSERT(cs);
+    OCIO::ConfigRcPtr copy = config->createEditableCopy();
+    OCIO_CHECK_EQUAL(copy->getColorSpace("lin")->getTransform(OCIO::COLORSPACE_DIR_TO_REFERENCE),
+                     cs->getTransform(OCIO::COLORSPACE_DIR_TO_REFERENCE));
+}
+
+OCIO_ADD_TEST(Config, lazy_loading_errors)
+{
+    // An invalid transform is only reported when used.
+
+    std::string str(LAZY_CONFIG);
+    OCIO_REQUIRE_ASSERT(StringUtils::ReplaceInPlace(str, "{value: 3}", "{value: [3, 2]}"));
+
+    {
+        std::istringstream is(str);
+        OCIO_CHECK_THROW_WHAT(OCIO::Config::CreateFromStream(is), OCIO::Exception,
+                              "At line 55, the value parsing of the key 'value' from "
+                              "'ExponentTransform' failed: 'value' values must be 4 floats.");
+    }
+
+    OCIO::EnvironmentVariableGuard guard(OCIO::OCIO_LAZY_LOADING_ENVVAR, "1");
+
+    {
+        std::istringstream is(str);
+        OCIO::ConstConfigRcPtr config;
+        OCIO_CHECK_NO_THROW(config = OCIO::Config::CreateFromStream(is));
+        OCIO_REQUIRE_ASSERT(config);
+
+        OCIO_CHECK_NO_THROW(config->getProcessor("lin", "raw"));
+        OCIO_CHECK_THROW_WHAT(config->getProcessor("nt", OCIO::TRANSFORM_DIR_FORWARD),
+                              OCIO::Exception,
+                              "Error: Loading the OCIO profile failed. At line 55, the value "
+                              "parsing of the key 'value' from 'ExponentTransform' failed");
+        // The error is reported again.
+        OCIO_CHECK_THROW_WHAT(config->validate(), OCIO::Exception,
+                              "At line 55, the value parsing of the key 'value' from "
+                              "'ExponentTransform' failed: 'value' values must be 4 floats.");
+    }
+
+    // The element transform getters throw, but not the operators printing them.
+
+    str = LAZY_CONFIG;
+    OCIO_REQUIRE_ASSERT(StringUtils::ReplaceInPlace(str, "{offset: [0.5, 0.5, 0.5, 0]}",
+                                                               "{offset: [0.5, 0.5]}"));
+    OCIO_REQUIRE_ASSERT(StringUtils::ReplaceInPlace(str, "{value: 2.2}", "{value: [2.2, 2]}"));
+    OCIO_REQUIRE_ASSERT(StringUtils::ReplaceInPlace(str, "{value: 3}", "{value: [3, 3]}"));
+    OCIO_REQUIRE_ASSERT(StringUtils::ReplaceInPlace(str,
+                                                    "&grade !<CDLTransform> {slope: [1, 2, 1]}",
+                                                    "!<CDLTransform> {slope: [1, 2]}"));
+    OCIO_REQUIRE_ASSERT(StringUtils::ReplaceInPlace(str, "inverse_transform: *grade",
+                                                         "# No inverse transform."));
+    {
+        std::istringstream is(str);
+        OCIO::ConstConfigRcPtr config;
+        OCIO_CHECK_NO_THROW(config = OCIO::Config::CreateFromStream(is));
+        OCIO_REQUIRE_ASSERT(config);
+
+        OCIO::ConstColorSpaceRcPtr cs = config->getColorSpace("lin");
+        OCIO_REQUIRE_ASSERT(cs);
+        OCIO_CHECK_THROW_WHAT(cs->getTransform(OCIO::COLORSPACE_DIR_TO_REFERENCE),
+                              OCIO::Exception,
+                              "At line 49, the value parsing of the key 'offset' from "
+                              "'MatrixTransform' failed: 'offset' values must be 4 numbers.");
+        // The error is reported again.
+        OCIO_CHECK_THROW_WHAT(cs->getTransform(OCIO::COLORSPACE_DIR_TO_REFERENCE),
+                              OCIO::Exception, "At line 49");
+
+        std::ostringstream oss;
+        OCIO_CHECK_NO_THROW(oss << *cs);
+        OCIO_CHECK_NE(oss.str().find("error="), std::string::npos);
+        OCIO_CHECK_NE(oss.str().find("At line 49"), std::string::npos);
+
+        OCIO::ConstViewTransformRcPtr vt = config->getViewTransform("film");
+        OCIO_REQUIRE_ASSERT(vt);
+        OCIO_CHECK_THROW_WHAT(vt->getTransform(OCIO::VIEWTRANSFORM_DIR_FROM_REFERENCE),
+                              OCIO::Exception,
+                              "At line 20, the value parsing of the key 'value' from "
+                              "'ExponentTransform' failed: 'value' values must be 4 floats.");
+
+        oss.str("");
+        OCIO_CHECK_NO_THROW(oss << *vt);
+        OCIO_CHECK_NE(oss.str().find("error="), std::string::npos);
+
+        OCIO::ConstLookRcPtr look = config->getLook("grade");
+        OCIO_REQUIRE_ASSERT(look);
+        OCIO_CHECK_THROW_WHAT(look->getTransform(), OCIO::Exception, "At line 34");
+
+        oss.str("");
+        OCIO_CHECK_NO_THROW(oss << *look);
+        OCIO_CHECK_NE(oss.str().find("error="), std::string::npos);
+        OCIO_CHECK_NE(oss.str().find("At line 34"), std::string::npos);
+
+        OCIO::ConstNamedTransformRcPtr nt = config->getNamedTransform("nt");
+        OCIO_REQUIRE_ASSERT(nt);
+        OCIO_CHECK_THROW_WHAT(nt->getTransform(OCIO::TRANSFORM_DIR_FORWARD), OCIO::Exception,
+                              "At line 55");
+
+        oss.str("");
+        OCIO_CHECK_NO_THROW(oss << *nt);
+        OCIO_CHECK_NE(oss.str().find("error="), std::string::npos);
+        OCIO_CHECK_NE(oss.str().find("At line 55"), std::string::npos);
+
+        // The color space references of an invalid transform are unknown.
+        OCIO_CHECK_ASSERT(config->isColorSpaceUsed("flow"));
+
+        OCIO_CHECK_THROW_WHAT(config->getCacheID(), OCIO::Exception, "failed");
+        OCIO_CHECK_THROW_WHAT(config->validate(), OCIO::Exception,
+                              "Config failed transform validation. Error: Loading the OCIO "
+                              "profile failed.");
+    }
+
+    // The version of a deferred transform is checked when used.
+
+    str = LAZY_CONFIG;
+    OCIO_REQUIRE_ASSERT(StringUtils::ReplaceInPlace(str, "ocio_profile_version: 2.1",
+                                                               "ocio_profile_version: 2"));
+    {
+        std::istringstream is(str);
+        OCIO::ConstConfigRcPtr config;
+        OCIO_CHECK_NO_THROW(config = OCIO::Config::CreateFromStream(is));
+        OCIO_REQUIRE_ASSERT(config);
+
+        OCIO_CHECK_NO_THROW(config->getProcessor("lin", "raw"));
+        OCIO_CHECK_THROW_WHAT(config->getProcessor("raw", "sRGB", "Film",
+                                                   OCIO::TRANSFORM_DIR_FORWARD),
+                              OCIO::Exception,
+                              "Only config version 2.1 (or higher) can have BuiltinTransform style "
+                              "'ACES-LMT - ACES 1.3 Reference Gamut Compression'.");
+    }
+
+    // The transforms which are not deferred are still checked when loading.
+
+    OCIO_REQUIRE_ASSERT(StringUtils::ReplaceInPlace(str, "!<CDLTransform>",
+                                                               "!<LogCameraTransform>"));
+    OCIO_REQUIRE_ASSERT(StringUtils::ReplaceInPlace(str, "{slope: [1, 2, 1]}",
+                                                               "{lin_side_break: [0.1, 0.1, 0.1]}"));
+    OCIO_REQUIRE_ASSERT(StringUtils::ReplaceInPlace(str, "ocio_profile_version: 2",
+                                                               "ocio_profile_version: 1"));
+    {
+        std::istringstream is(str);
+        OCIO_CHECK_THROW_WHAT(OCIO::Config::CreateFromStream(is), OCIO::Exception,
+                              "Only config version 2 (or higher) can have LogCameraTransform.");
+    }
+}
@@ -0,0 +1,153 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#include "DeferredTransform.cpp"
+
+#include "testutils/UnitTest.h"
+#include "UnitTestUtils.h"
+
+namespace OCIO = OCIO_NAMESPACE;
+
+
+OCIO_ADD_TEST(DeferredTransform, load_once)
+{
+    OCIO_CHECK_THROW_WHAT(OCIO::DeferredTransform(nullptr), OCIO::Exception,
+                          "A deferred transform needs a loader.");
+
+    int numCalls = 0;
+    OCIO::DeferredTransform deferred([&numCalls]()
+    {
+        ++numCalls;
+        OCIO::TransformRcPtr transform = OCIO::MatrixTransform::Create();
+        return transform;
+    });
+
+    OCIO_CHECK_ASSERT(!deferred.isLoaded());
+    OCIO_CHECK_EQUAL(numCalls, 0);
+
+    OCIO::ConstTransformRcPtr transform = deferred.get();
+    OCIO_REQUIRE_ASSERT(transform);
+    OCIO_CHECK_ASSERT(OCIO::DynamicPtrCast<const OCIO::MatrixTransform>(transform));
+    OCIO_CHECK_ASSERT(deferred.isLoaded());
+    OCIO_CHECK_EQUAL(numCalls, 1);
+
+    // The transform is only created once.
+    OCIO_CHECK_EQUAL(deferred.get().get(), transform.get());
+    OCIO_CHECK_EQUAL(numCalls, 1);
+}
+
+OCIO_ADD_TEST(DeferredTransform, load_failure)
+{
+    int numCalls = 0;
+    OCIO::DeferredTransform deferred([&numCalls]() -> OCIO::TransformRcPtr
+    {
+        ++numCalls;
+        throw OCIO::Exception("Invalid transform.");
+    });
+
+    // The error is reported by each call.
+    OCIO_CHECK_THROW_WHAT(deferred.get(), OCIO::Exception, "Invalid transform.");
+    OCIO_CHECK_THROW_WHAT(deferred.get(), OCIO::Exception, "Invalid transform.");
+    OCIO_CHECK_EQUAL(numCalls, 2);
+    OCIO_CHECK_ASSERT(!deferred.isLoaded());
+
+    OCIO::DeferredTransform nullDeferred([]() { return OCIO::TransformRcPtr(); });
+    OCIO_CHECK_THROW_WHAT(nullDeferred.get(), OCIO::Exception,
+                          "A deferred transform cannot be null.");
+}
+
+OCIO_ADD_TEST(DeferredTransform, elements)
+{
+    // The deferred transforms are only attached to the elements by a lazy config loading.
+
+    constexpr char CONFIG[] =
+R"(ocio_profile_version: 2.1
+
+roles:
+  default: raw
+
+displays:
+  sRGB:
+    - !<View> {name: Raw, colorspace: raw}
+
+view_transforms:
+  - !<ViewTransform>
+    name: film
+    from_scene_reference: !<ExponentTransform> {value: [2.2, 2]}
+
+looks:
+  - !<Look>
+    name: grade
+    process_space: raw
+    inverse_transform: !<ExponentTransform> {value: 2}
+
+colorspaces:
+  - !<ColorSpace>
+    name: raw
+    isdata: true
+
+  - !<ColorSpace>
+    name: lin
+    to_scene_reference: !<ExponentTransform> {value: 2}
+
+named_transforms:
+  - !<NamedTransform>
+    name: nt
+    transform: !<ExponentTransform> {value: 3}
+)";
+
+    OCIO::EnvironmentVariableGuard guard(OCIO::OCIO_LAZY_LOADING_ENVVAR, "1");
+
+    std::istringstream is(CONFIG);
+    OCIO::ConstConfigRcPtr config;
+    OCIO_CHECK_NO_THROW(config = OCIO::Config::CreateFromStream(is));
+    OCIO_REQUIRE_ASSERT(config);
+
+    // Color space.
+
+    OCIO::ColorSpaceRcPtr cs = config->getColorSpace("lin")->createEditableCopy();
+
+    // A copy shares the deferred transform.
+    auto csCopy = cs->createEditableCopy();
+
+    OCIO_CHECK_ASSERT(OCIO::DynamicPtrCast<const OCIO::ExponentTransform>(
+        cs->getTransform(OCIO::COLORSPACE_DIR_TO_REFERENCE)));
+    OCIO_CHECK_EQUAL(csCopy->getTransform(OCIO::COLORSPACE_DIR_TO_REFERENCE).get(),
+                     cs->getTransform(OCIO::COLORSPACE_DIR_TO_REFERENCE).get());
+    OCIO_CHECK_ASSERT(!cs->getTransform(OCIO::COLORSPACE_DIR_FROM_REFERENCE));
+
+    // Setting a transform replaces the deferred one.
+    cs->setTransform(OCIO::MatrixTransform::Create(), OCIO::COLORSPACE_DIR_TO_REFERENCE);
+    OCIO_CHECK_ASSERT(OCIO::DynamicPtrCast<const OCIO::MatrixTransform>(
+        cs->getTransform(OCIO::COLORSPACE_DIR_TO_REFERENCE)));
+    OCIO_CHECK_ASSERT(OCIO::DynamicPtrCast<const OCIO::ExponentTransform>(
+        csCopy->getTransform(OCIO::COLORSPACE_DIR_TO_REFERENCE)));
+
+    // Look.
+
+    OCIO::ConstLookRcPtr look = config->getLook("grade");
+    OCIO_REQUIRE_ASSERT(look);
+    OCIO_CHECK_ASSERT(!look->getTransform());
+    OCIO_CHECK_ASSERT(OCIO::DynamicPtrCast<const OCIO::ExponentTransform>(
+        look->getInverseTransform()));
+
+    // View transform: adding it does not create the (invalid) deferred transform.
+
+    OCIO::ConfigRcPtr editableConfig = config->createEditableCopy();
+    OCIO::ViewTransformRcPtr vt = config->getViewTransform("film")->createEditableCopy();
+    vt->setName("film2");
+    OCIO_CHECK_NO_THROW(editableConfig->addViewTransform(vt));
+    OCIO_CHECK_THROW_WHAT(vt->getTransform(OCIO::VIEWTRANSFORM_DIR_FROM_REFERENCE),
+                          OCIO::Exception, "'value' values must be 4 floats");
+    OCIO_CHECK_ASSERT(!vt->getTransform(OCIO::VIEWTRANSFORM_DIR_TO_REFERENCE));
+
+    // Named transform.
+
+    OCIO::NamedTransformRcPtr nt = config->getNamedTransform("nt")->createEditableCopy();
+    OCIO_CHECK_NO_THROW(editableConfig->addNamedTransform(nt));
+    OCIO_CHECK_ASSERT(OCIO::DynamicPtrCast<const OCIO::ExponentTransform>(
+        nt->getTransform(OCIO::TRANSFORM_DIR_FORWARD)));
+    nt->setTransform(nullptr, OCIO::TRANSFORM_DIR_FORWARD);
+    OCIO_CHECK_ASSERT(!nt->getTransform(OCIO::TRANSFORM_DIR_FORWARD));
+}
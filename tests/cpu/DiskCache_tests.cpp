@@ -0,0 +1,510 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#include "DiskCache.cpp"
+
+#include "ops/cdl/CDLOpData.h"
+#include "ops/lut1d/Lut1DOp.h"
+#include "ops/lut3d/Lut3DOp.h"
+#include "testutils/UnitTest.h"
+#include "UnitTestUtils.h"
+
+namespace OCIO = OCIO_NAMESPACE;
+
+
+namespace
+{
+
+// Use a temporary directory as the disk cache directory.
+class DiskCacheGuard
+{
+public:
+    explicit DiskCacheGuard(const std::string & name)
+        :   m_directory(OCIO::CreateTemporaryDirectory(name))
+        ,   m_previousDirectory(OCIO::GetDiskCacheDirectory())
+        ,   m_previousBudget(OCIO::GetDiskCacheBudget())
+    {
+        OCIO::SetDiskCacheDirectory(m_directory.c_str());
+    }
+
+    ~DiskCacheGuard()
+    {
+        OCIO::SetDiskCacheDirectory(m_previousDirectory.c_str());
+        OCIO::SetDiskCacheBudget(m_previousBudget);
+        OCIO::RemoveTemporaryDirectory(m_directory);
+    }
+
+    const std::string & getDirectory() const { return m_directory; }
+
+    size_t getNumEntries() const
+    {
+        size_t num = 0;
+        for (const auto & entry : OCIO::fs::directory_iterator(OCIO::PathFromUTF8(m_directory)))
+        {
+            num += (entry.path().extension() == OCIO::EntryExtension) ? 1 : 0;
+        }
+        return num;
+    }
+
+private:
+    const std::string m_directory;
+    const std::string m_previousDirectory;
+    const size_t m_previousBudget;
+};
+
+OCIO::CacheIDDigest GetKey(const std::string & str)
+{
+    return OCIO::CacheIDHashDigest(str.c_str(), str.size());
+}
+
+} // anon.
+
+OCIO_ADD_TEST(DiskCache, disabled)
+{
+    const std::string previousDirectory = OCIO::GetDiskCacheDirectory();
+
+    OCIO::SetDiskCacheDirectory("");
+    OCIO_CHECK_ASSERT(!OCIO::DiskCache::IsEnabled());
+    OCIO_CHECK_EQUAL(std::string(OCIO::GetDiskCacheDirectory()), "");
+
+    OCIO::ConstOpDataVec data{ std::make_shared<OCIO::RangeOpData>(0., 1., 0., 1.) };
+    OCIO_CHECK_NO_THROW(OCIO::DiskCache::Save(GetKey("disabled"), data));
+    OCIO_CHECK_ASSERT(!OCIO::DiskCache::Load(GetKey("disabled"), data));
+
+    OCIO::SetDiskCacheDirectory(previousDirectory.c_str());
+}
+
+OCIO_ADD_TEST(DiskCache, round_trip)
+{
+    DiskCacheGuard guard("DiskCache_round_trip");
+    OCIO_CHECK_ASSERT(OCIO::DiskCache::IsEnabled());
+    OCIO_CHECK_EQUAL(guard.getDirectory(), OCIO::GetDiskCacheDirectory());
+
+    auto lut1d = std::make_shared<OCIO::Lut1DOpData>(OCIO::Lut1DOpData::LUT_INPUT_HALF_CODE,
+                                                     65536, true);
+    lut1d->setDirection(OCIO::TRANSFORM_DIR_INVERSE);
+    lut1d->setHueAdjust(OCIO::HUE_DW3);
+    lut1d->setFileOutputBitDepth(OCIO::BIT_DEPTH_UINT10);
+    lut1d->getArray().getValues().mutableData()[3] = 0.5f;
+    lut1d->getFormatMetadata().addAttribute(OCIO::METADATA_ID, "lut1d");
+    lut1d->getFormatMetadata().addChildElement(OCIO::METADATA_DESCRIPTION, "A 1D LUT");
+
+    auto lut3d = std::make_shared<OCIO::Lut3DOpData>(OCIO::INTERP_TETRAHEDRAL, 17);
+    lut3d->setFileOutputBitDepth(OCIO::BIT_DEPTH_F16);
+    lut3d->getArray().getValues().mutableData()[42] = -0.25f;
+
+    auto matrix = std::make_shared<OCIO::MatrixOpData>(OCIO::TRANSFORM_DIR_INVERSE);
+    matrix->setArrayValue(1, 0.125);
+    matrix->setOffsetValue(2, 0.5);
+    matrix->setFileInputBitDepth(OCIO::BIT_DEPTH_UINT8);
+
+    auto range = std::make_shared<OCIO::RangeOpData>(0.5, 1., 0.5, 1.5);
+    range->unsetMaxInValue();
+    range->unsetMaxOutValue();
+
+    const OCIO::ConstOpDataVec data{ lut1d, lut3d, matrix, range };
+    const OCIO::CacheIDDigest key = GetKey("round_trip");
+
+    OCIO::ConstOpDataVec loaded;
+    OCIO_CHECK_ASSERT(!OCIO::DiskCache::Load(key, loaded));
+
+    OCIO::DiskCache::Save(key, data);
+    OCIO_CHECK_EQUAL(guard.getNumEntries(), 1);
+
+    const std::string entryPath = OCIO::DiskCache::GetEntryPath(key);
+    OCIO_CHECK_EQUAL(OCIO::PathToUTF8(OCIO::PathFromUTF8(entryPath).parent_path()), guard.getDirectory());
+
+    // The LUT values are aligned in the entry file.
+    {
+        const OCIO::Platform::MappedFile file(entryPath.c_str());
+        const size_t numValues = lut1d->getArray().getValues().size();
+        const char * values = nullptr;
+        for (size_t pos = 0; pos + numValues * sizeof(float) <= file.size(); pos += 4)
+        {
+            if (0 == memcmp(file.data() + pos, lut1d->getArray().getValues().data(),
+                            numValues * sizeof(float)))
+            {
+                values = file.data() + pos;
+                break;
+            }
+        }
+        OCIO_REQUIRE_ASSERT(values);
+        OCIO_CHECK_EQUAL((values - file.data()) % OCIO::ValueAlignment, 0);
+    }
+
+    OCIO_REQUIRE_ASSERT(OCIO::DiskCache::Load(key, loaded));
+    OCIO_REQUIRE_EQUAL(loaded.size(), data.size());
+
+    // The entry is read from the file.
+
+    OCIO::DiskCache::ClearMemoryCache();
+    loaded.clear();
+    OCIO_REQUIRE_ASSERT(OCIO::DiskCache::Load(key, loaded));
+    OCIO_REQUIRE_EQUAL(loaded.size(), data.size());
+
+    for (size_t idx = 0; idx < data.size(); ++idx)
+    {
+        OCIO_CHECK_NE(loaded[idx].get(), data[idx].get());
+        OCIO_CHECK_ASSERT(*loaded[idx] == *data[idx]);
+        OCIO_CHECK_ASSERT(loaded[idx]->getFormatMetadata() == data[idx]->getFormatMetadata());
+    }
+
+    auto loadedLut1d = OCIO::DiskCache::CopyAs<OCIO::Lut1DOpData>(loaded[0]);
+    OCIO_REQUIRE_ASSERT(loadedLut1d);
+    OCIO_CHECK_EQUAL(loadedLut1d->getID(), "lut1d");
+    OCIO_CHECK_EQUAL(loadedLut1d->getFileOutputBitDepth(), OCIO::BIT_DEPTH_UINT10);
+    OCIO_CHECK_ASSERT(!OCIO::DiskCache::CopyAs<OCIO::Lut3DOpData>(loaded[0]));
+
+    auto loadedLut3d = OCIO::DiskCache::CopyAs<OCIO::Lut3DOpData>(loaded[1]);
+    OCIO_REQUIRE_ASSERT(loadedLut3d);
+    OCIO_CHECK_EQUAL(loadedLut3d->getFileOutputBitDepth(), OCIO::BIT_DEPTH_F16);
+
+    // The values are used in place from the entry file, including by the copies, until they
+    // are modified.
+
+    const auto & constLut3d = *loadedLut3d;
+    OCIO_CHECK_ASSERT(constLut3d.getArray().getValues().isShared());
+    OCIO_CHECK_ASSERT(loadedLut1d->getArray().getValues().isShared());
+
+    const float * mappedValues = constLut3d.getArray().getValues().data();
+    OCIO_CHECK_EQUAL((reinterpret_cast<uintptr_t>(mappedValues) % OCIO::ValueAlignment), 0);
+    OCIO_CHECK_EQUAL(OCIO::DynamicPtrCast<const OCIO::Lut3DOpData>(loaded[1])
+                         ->getArray().getValues().data(),
+                     mappedValues);
+
+    loadedLut3d->getArray().getValues().mutableData()[42] = 1.0f;
+    OCIO_CHECK_ASSERT(!constLut3d.getArray().getValues().isShared());
+    OCIO_CHECK_EQUAL(OCIO::DynamicPtrCast<const OCIO::Lut3DOpData>(loaded[1])
+                         ->getArray().getValues()[42],
+                     -0.25f);
+
+    auto loadedMatrix = OCIO::DiskCache::CopyAs<OCIO::MatrixOpData>(loaded[2]);
+    OCIO_REQUIRE_ASSERT(loadedMatrix);
+    OCIO_CHECK_EQUAL(loadedMatrix->getFileInputBitDepth(), OCIO::BIT_DEPTH_UINT8);
+
+    // Only some op data are supported.
+
+    OCIO_CHECK_ASSERT(OCIO::DiskCache::IsSupported(*range));
+    const auto cdl = std::make_shared<OCIO::CDLOpData>();
+    OCIO_CHECK_ASSERT(!OCIO::DiskCache::IsSupported(*cdl));
+}
+
+OCIO_ADD_TEST(DiskCache, finalized_op_keeps_sharing)
+{
+    DiskCacheGuard guard("DiskCache_finalized_op");
+
+    auto lut1d = std::make_shared<OCIO::Lut1DOpData>(1024);
+    lut1d->setDirection(OCIO::TRANSFORM_DIR_INVERSE);
+    float * lut1dValues = lut1d->getArray().getValues().mutableData();
+    for (size_t idx = 0; idx < lut1d->getArray().getValues().size(); ++idx)
+    {
+        lut1dValues[idx] = std::pow(lut1dValues[idx], 2.2f);
+    }
+
+    auto lut3d = std::make_shared<OCIO::Lut3DOpData>(OCIO::INTERP_TETRAHEDRAL, 17);
+    lut3d->getArray().getValues().mutableData()[42] = 0.5f;
+
+    const OCIO::CacheIDDigest key = GetKey("finalized_op");
+    OCIO::DiskCache::Save(key, { lut1d, lut3d });
+    OCIO::DiskCache::ClearMemoryCache();
+
+    OCIO::ConstOpDataVec loaded;
+    OCIO_REQUIRE_ASSERT(OCIO::DiskCache::Load(key, loaded));
+    OCIO_REQUIRE_EQUAL(loaded.size(), 2);
+
+    // The ops own non-const copies of the loaded op data.
+
+    auto loadedLut1d = OCIO::DiskCache::CopyAs<OCIO::Lut1DOpData>(loaded[0]);
+    auto loadedLut3d = OCIO::DiskCache::CopyAs<OCIO::Lut3DOpData>(loaded[1]);
+    OCIO_REQUIRE_ASSERT(loadedLut1d);
+    OCIO_REQUIRE_ASSERT(loadedLut3d);
+
+    const float * mappedLut1d = loadedLut1d->getArray().getValues().data();
+    const float * mappedLut3d = loadedLut3d->getArray().getValues().data();
+    OCIO_CHECK_ASSERT(loadedLut1d->getArray().getValues().isShared());
+    OCIO_CHECK_ASSERT(loadedLut3d->getArray().getValues().isShared());
+
+    OCIO::OpRcPtrVec ops;
+    OCIO::CreateLut1DOp(ops, loadedLut1d, OCIO::TRANSFORM_DIR_FORWARD);
+    OCIO::CreateLut3DOp(ops, loadedLut3d, OCIO::TRANSFORM_DIR_FORWARD);
+    OCIO_REQUIRE_EQUAL(ops.size(), 2);
+
+    // Finalizing the ops (including the inversion preparation of the 1D LUT) and creating
+    // their renderers only read the values.
+
+    OCIO_CHECK_NO_THROW(ops.finalize());
+    for (const auto & op : ops)
+    {
+        OCIO_CHECK_ASSERT(!op->isNoOp());
+        OCIO_CHECK_ASSERT(!op->getCacheID().empty());
+
+        float rgba[4] = { 0.25f, 0.5f, 0.75f, 1.f };
+        OCIO_CHECK_NO_THROW(op->apply(rgba, 1));
+    }
+
+    OCIO_CHECK_ASSERT(loadedLut1d->getArray().getValues().isShared());
+    OCIO_CHECK_EQUAL(loadedLut1d->getArray().getValues().data(), mappedLut1d);
+    OCIO_CHECK_ASSERT(loadedLut3d->getArray().getValues().isShared());
+    OCIO_CHECK_EQUAL(loadedLut3d->getArray().getValues().data(), mappedLut3d);
+
+    // Only editing the values copies them.
+
+    loadedLut3d->getArray().getValues().mutableData()[0] = 0.1f;
+    OCIO_CHECK_ASSERT(!loadedLut3d->getArray().getValues().isShared());
+    OCIO_CHECK_EQUAL(loadedLut3d->getArray().getValues()[0], 0.1f);
+    OCIO_CHECK_EQUAL(mappedLut3d[0], 0.f);
+}
+
+OCIO_ADD_TEST(DiskCache, values)
+{
+    DiskCacheGuard guard("DiskCache_values");
+
+    const OCIO::CacheIDDigest key = GetKey("values");
+
+    OCIO::Array::Values values;
+    OCIO_CHECK_ASSERT(!OCIO::DiskCache::LoadValues(key, values));
+
+    const OCIO::Array::Values saved(std::vector<float>{ 0.f, 0.25f, 0.5f, 0.75f, 1.f });
+    OCIO::DiskCache::SaveValues(key, saved);
+    OCIO_CHECK_EQUAL(guard.getNumEntries(), 1);
+
+    OCIO_REQUIRE_ASSERT(OCIO::DiskCache::LoadValues(key, values));
+    OCIO_CHECK_ASSERT(values.isShared());
+    OCIO_CHECK_ASSERT(values == saved);
+
+    // The entry could not be read as op data.
+
+    OCIO::ConstOpDataVec data;
+    OCIO_CHECK_ASSERT(!OCIO::DiskCache::Load(key, data));
+    OCIO_CHECK_EQUAL(guard.getNumEntries(), 0);
+
+    // The mapped values stay valid once the entry file is removed.
+    OCIO_CHECK_ASSERT(values == saved);
+}
+
+OCIO_ADD_TEST(DiskCache, key)
+{
+    // The key depends on the complete op data content.
+
+    auto lut = std::make_shared<OCIO::Lut3DOpData>(OCIO::INTERP_LINEAR, 5);
+
+    OCIO::CacheIDHasher hasher1;
+    OCIO::DiskCache::UpdateKey(hasher1, *lut);
+
+    lut->getFormatMetadata().addChildElement(OCIO::METADATA_DESCRIPTION, "A 3D LUT");
+
+    OCIO::CacheIDHasher hasher2;
+    OCIO::DiskCache::UpdateKey(hasher2, *lut);
+    OCIO_CHECK_NE(hasher1.digest().toString(), hasher2.digest().toString());
+
+    lut->setFileOutputBitDepth(OCIO::BIT_DEPTH_UINT12);
+
+    OCIO::CacheIDHasher hasher3;
+    OCIO::DiskCache::UpdateKey(hasher3, *lut);
+    OCIO_CHECK_NE(hasher2.digest().toString(), hasher3.digest().toString());
+
+    // The key of a file depends on its path.
+
+    OCIO::CacheIDHasher hasher4;
+    OCIO_CHECK_ASSERT(!OCIO::DiskCache::UpdateKey(hasher4, std::string("missing.spi1d")));
+    const std::string filepath = OCIO::GetTestFilesDir() + "/lut1d_1.spi1d";
+    OCIO_CHECK_ASSERT(OCIO::DiskCache::UpdateKey(hasher4, filepath));
+}
+
+OCIO_ADD_TEST(DiskCache, corrupted_entry)
+{
+    DiskCacheGuard guard("DiskCache_corrupted_entry");
+
+    const OCIO::CacheIDDigest key = GetKey("corrupted_entry");
+    OCIO::DiskCache::Save(key, { std::make_shared<OCIO::RangeOpData>(0., 1., 0., 1.) });
+    OCIO_CHECK_EQUAL(guard.getNumEntries(), 1);
+
+    const std::string entryPath = OCIO::DiskCache::GetEntryPath(key);
+    const auto size = OCIO::fs::file_size(OCIO::PathFromUTF8(entryPath));
+
+    // Change the last byte of the payload.
+    {
+        std::fstream file(OCIO::PathFromUTF8(entryPath),
+                          std::ios_base::in | std::ios_base::out | std::ios_base::binary);
+        file.seekp(size - 1);
+        file.put('\x7f');
+    }
+
+    // The entry is not used and removed.
+
+    OCIO::DiskCache::ClearMemoryCache();
+    OCIO::ConstOpDataVec loaded;
+    OCIO_CHECK_ASSERT(!OCIO::DiskCache::Load(key, loaded));
+    OCIO_CHECK_EQUAL(guard.getNumEntries(), 0);
+
+    // A truncated entry is also rejected.
+
+    OCIO::DiskCache::Save(key, { std::make_shared<OCIO::RangeOpData>(0., 1., 0., 1.) });
+    OCIO::fs::resize_file(OCIO::PathFromUTF8(entryPath), OCIO::EntryHeaderSize / 2);
+
+    OCIO_CHECK_ASSERT(!OCIO::DiskCache::Load(key, loaded));
+    OCIO_CHECK_EQUAL(guard.getNumEntries(), 0);
+}
+
+OCIO_ADD_TEST(DiskCache, other_versions)
+{
+    DiskCacheGuard guard("DiskCache_other_versions");
+
+    const OCIO::CacheIDDigest key = GetKey("other_versions");
+    const std::string entryPath = OCIO::DiskCache::GetEntryPath(key);
+
+    // The entry file name depends on the library & format versions.
+
+    std::ostringstream versions;
+    versions << "_" << std::hex << OCIO::GetVersionHex() << std::dec << "_"
+             << OCIO::EntryFormatVersion << OCIO::EntryExtension;
+    OCIO_CHECK_NE(entryPath.find(key.toUUID() + versions.str()), std::string::npos);
+
+    // The entry of another library version is neither read nor removed.
+
+    OCIO::DiskCache::Save(key, { std::make_shared<OCIO::RangeOpData>(0., 1., 0., 1.) });
+    const std::string otherPath
+        = guard.getDirectory() + "/" + key.toUUID() + "_1000000_1" + OCIO::EntryExtension;
+    OCIO::fs::rename(OCIO::PathFromUTF8(entryPath), OCIO::PathFromUTF8(otherPath));
+
+    OCIO::DiskCache::ClearMemoryCache();
+    OCIO::ConstOpDataVec loaded;
+    OCIO_CHECK_ASSERT(!OCIO::DiskCache::Load(key, loaded));
+    OCIO::DiskCache::Save(key, { std::make_shared<OCIO::RangeOpData>(0., 1., 0., 1.) });
+    OCIO_CHECK_EQUAL(guard.getNumEntries(), 2);
+    OCIO_CHECK_ASSERT(OCIO::fs::exists(OCIO::PathFromUTF8(otherPath)));
+
+    // An entry which could not be read but is not corrupted is kept.
+
+    OCIO::DiskCache::ClearMemoryCache();
+    OCIO_CHECK_ASSERT(!OCIO::ReadEntryFile(entryPath, []() { throw OCIO::Exception("Failed"); }));
+    OCIO_CHECK_ASSERT(OCIO::fs::exists(OCIO::PathFromUTF8(entryPath)));
+    OCIO_CHECK_ASSERT(OCIO::DiskCache::Load(key, loaded));
+}
+
+OCIO_ADD_TEST(DiskCache, eviction)
+{
+    DiskCacheGuard guard("DiskCache_eviction");
+
+    const OCIO::ConstOpDataVec data{ std::make_shared<OCIO::Lut3DOpData>(17) };
+
+    OCIO::DiskCache::Save(GetKey("entry1"), data);
+    const auto entrySize = OCIO::fs::file_size(
+        OCIO::PathFromUTF8(OCIO::DiskCache::GetEntryPath(GetKey("entry1"))));
+
+    // The budget is only exceeded by the third entry.
+    OCIO::SetDiskCacheBudget(static_cast<size_t>(entrySize * 2 + entrySize / 2));
+    OCIO_CHECK_EQUAL(OCIO::GetDiskCacheBudget(), static_cast<size_t>(entrySize * 2 + entrySize / 2));
+
+    OCIO::DiskCache::Save(GetKey("entry2"), data);
+    OCIO_CHECK_EQUAL(guard.getNumEntries(), 2);
+
+    // Make the first entry the most recently used one.
+    const auto now = OCIO::fs::file_time_type::clock::now();
+    OCIO::fs::last_write_time(OCIO::PathFromUTF8(OCIO::DiskCache::GetEntryPath(GetKey("entry1"))),
+                              now - std::chrono::minutes(1));
+    OCIO::fs::last_write_time(OCIO::PathFromUTF8(OCIO::DiskCache::GetEntryPath(GetKey("entry2"))),
+                              now - std::chrono::minutes(2));
+
+    OCIO::DiskCache::Save(GetKey("entry3"), data);
+    OCIO_CHECK_EQUAL(guard.getNumEntries(), 2);
+
+    OCIO::DiskCache::ClearMemoryCache();
+    OCIO::ConstOpDataVec loaded;
+    OCIO_CHECK_ASSERT(OCIO::DiskCache::Load(GetKey("entry1"), loaded));
+    OCIO_CHECK_ASSERT(!OCIO::DiskCache::Load(GetKey("entry2"), loaded));
+    OCIO_CHECK_ASSERT(OCIO::DiskCache::Load(GetKey("entry3"), loaded));
+
+    // Reducing the budget evicts entries.
+
+    OCIO::SetDiskCacheBudget(static_cast<size_t>(entrySize));
+    OCIO_CHECK_EQUAL(guard.getNumEntries(), 1);
+}
+
+OCIO_ADD_TEST(DiskCache, eviction_scan)
+{
+    DiskCacheGuard guard("DiskCache_eviction_scan");
+
+    const OCIO::ConstOpDataVec data{ std::make_shared<OCIO::RangeOpData>(0., 1., 0., 1.) };
+
+    OCIO::DiskCache::Save(GetKey("entry1"), data);
+    const auto entrySize = OCIO::fs::file_size(
+        OCIO::PathFromUTF8(OCIO::DiskCache::GetEntryPath(GetKey("entry1"))));
+    OCIO::SetDiskCacheBudget(static_cast<size_t>(entrySize * 3));
+
+    // An entry added by another process exceeds the budget but the directory is not scanned as
+    // the entries written by the process fit in the budget.
+
+    const std::string otherPath = guard.getDirectory() + "/other" + OCIO::EntryExtension;
+    {
+        std::ofstream file(OCIO::PathFromUTF8(otherPath), std::ios_base::binary);
+        file << std::string(static_cast<size_t>(entrySize * 2), 'x');
+    }
+    OCIO::fs::last_write_time(OCIO::PathFromUTF8(otherPath),
+                              OCIO::fs::file_time_type::clock::now() - std::chrono::minutes(1));
+
+    OCIO::DiskCache::Save(GetKey("entry2"), data);
+    OCIO_CHECK_EQUAL(guard.getNumEntries(), 3);
+
+    OCIO::DiskCache::Save(GetKey("entry3"), data);
+    OCIO_CHECK_EQUAL(guard.getNumEntries(), 4);
+
+    // The entries written by the process exceed the budget so the directory is scanned and the
+    // oldest entries are removed.
+
+    OCIO::DiskCache::Save(GetKey("entry4"), data);
+    OCIO_CHECK_EQUAL(guard.getNumEntries(), 3);
+    OCIO_CHECK_ASSERT(!OCIO::fs::exists(OCIO::PathFromUTF8(otherPath)));
+}
+
+OCIO_ADD_TEST(DiskCache, file_transform)
+{
+    DiskCacheGuard guard("DiskCache_file_transform");
+
+    OCIO::ClearAllCaches();
+
+    size_t hits = 0, misses = 0, evictions = 0, entries = 0, bytes = 0;
+    OCIO::GetFileCacheStatistics(hits, misses, evictions, entries, bytes);
+    const size_t initialMisses = misses;
+
+    // The inverse 3D LUT is replaced by a fast forward 3D LUT.
+    const std::string lutFile("lut3d_example_Inv.ctf");
+
+    OCIO::ConstProcessorRcPtr proc1;
+    OCIO_CHECK_NO_THROW(proc1 = OCIO::GetFileTransformProcessor(lutFile));
+    OCIO_REQUIRE_ASSERT(proc1);
+
+    OCIO::GetFileCacheStatistics(hits, misses, evictions, entries, bytes);
+    OCIO_CHECK_EQUAL(misses, initialMisses + 1);
+
+    float pixel1[3]{ 0.1f, 0.5f, 0.9f };
+    proc1->getDefaultCPUProcessor()->applyRGB(pixel1);
+
+    // The file ops, the fast LUT & the LUT of the renderer built by the CPU processor.
+    OCIO_CHECK_EQUAL(guard.getNumEntries(), 3);
+
+    // A warm disk cache skips the file parsing (i.e. as another process would do).
+
+    OCIO::ClearAllCaches();
+
+    OCIO::ConstProcessorRcPtr proc2;
+    OCIO_CHECK_NO_THROW(proc2 = OCIO::GetFileTransformProcessor(lutFile));
+    OCIO_REQUIRE_ASSERT(proc2);
+
+    OCIO::GetFileCacheStatistics(hits, misses, evictions, entries, bytes);
+    OCIO_CHECK_EQUAL(misses, initialMisses + 1);
+    OCIO_CHECK_EQUAL(entries, 0);
+    OCIO_CHECK_EQUAL(guard.getNumEntries(), 3);
+
+    OCIO_CHECK_EQUAL(std::string(proc1->getCacheID()), std::string(proc2->getCacheID()));
+
+    float pixel2[3]{ 0.1f, 0.5f, 0.9f };
+    proc2->getDefaultCPUProcessor()->applyRGB(pixel2);
+    OCIO_CHECK_EQUAL(guard.getNumEntries(), 3);
+    OCIO_CHECK_EQUAL(pixel1[0], pixel2[0]);
+    OCIO_CHECK_EQUAL(pixel1[1], pixel2[1]);
+    OCIO_CHECK_EQUAL(pixel1[2], pixel2[2]);
+
+    OCIO::ClearAllCaches();
+}
@@ -3,6 +3,7 @@
 
 
 #include <sstream>
+#include <thread>
 
 #include "DynamicProperty.cpp"
 
@@ -151,6 +152,111 @@ OCIO_ADD_TEST(DynamicProperty, get_dynamic_via_cpu_processor)
                           "Cannot find dynamic property");
 }
 
+namespace
+{
+double GetUniformDouble(const OCIO::GpuShaderDescRcPtr & shaderDesc, const std::string & name)
+{
+    for (unsigned idx = 0; idx < shaderDesc->getNumUniforms(); ++idx)
+    {
+        OCIO::GpuShaderDesc::UniformData data;
+        const std::string uniformName = shaderDesc->getUniform(idx, data);
+        if (uniformName.find(name) != std::string::npos)
+        {
+            return data.m_getDouble();
+        }
+    }
+    throw OCIO::Exception("Missing uniform.");
+}
+}
+
+OCIO_ADD_TEST(DynamicProperty, get_dynamic_via_gpu_shader)
+{
+    // The uniforms always read the current value of the dynamic properties of the shader.
+
+    auto gp = OCIO::GradingPrimaryTransform::Create(OCIO::GRADING_LOG);
+    gp->makeDynamic();
+    auto gt = OCIO::GradingToneTransform::Create(OCIO::GRADING_LOG);
+    gt->makeDynamic();
+
+    OCIO::GroupTransformRcPtr group = OCIO::GroupTransform::Create();
+    group->appendTransform(gp);
+    group->appendTransform(gt);
+
+    OCIO::ConfigRcPtr config = OCIO::Config::Create();
+    auto gpuProcessor = config->getProcessor(group)->getDefaultGPUProcessor();
+
+    OCIO::GpuShaderDescRcPtr shaderDesc = OCIO::GpuShaderDesc::CreateShaderDesc();
+    OCIO_CHECK_NO_THROW(gpuProcessor->extractGpuShaderInfo(shaderDesc));
+
+    OCIO::DynamicPropertyRcPtr dp;
+    OCIO_CHECK_NO_THROW(dp = shaderDesc->getDynamicProperty(OCIO::DYNAMIC_PROPERTY_GRADING_PRIMARY));
+    auto dpPrimary = OCIO::DynamicPropertyValue::AsGradingPrimary(dp);
+    OCIO_CHECK_NO_THROW(dp = shaderDesc->getDynamicProperty(OCIO::DYNAMIC_PROPERTY_GRADING_TONE));
+    auto dpTone = OCIO::DynamicPropertyValue::AsGradingTone(dp);
+
+    OCIO_CHECK_EQUAL(GetUniformDouble(shaderDesc, "saturation"), 1.);
+    OCIO_CHECK_EQUAL(GetUniformDouble(shaderDesc, "sContrast"), 1.);
+
+    for (double value : { 1.5, 0.5 })
+    {
+        OCIO::GradingPrimary primary = dpPrimary->getValue();
+        primary.m_saturation = value;
+        dpPrimary->setValue(primary);
+
+        OCIO::GradingTone tone = dpTone->getValue();
+        tone.m_scontrast = value;
+        dpTone->setValue(tone);
+
+        OCIO_CHECK_EQUAL(GetUniformDouble(shaderDesc, "saturation"), value);
+        OCIO_CHECK_EQUAL(GetUniformDouble(shaderDesc, "sContrast"), value);
+    }
+}
+
+OCIO_ADD_TEST(DynamicPropertyImpl, snapshot)
+{
+    auto dpImpl = std::make_shared<OCIO::DynamicPropertyDoubleImpl>(OCIO::DYNAMIC_PROPERTY_EXPOSURE,
+                                                                   1.0, true);
+    auto dpPrimary = std::make_shared<OCIO::DynamicPropertyGradingPrimaryImpl>(
+        OCIO::GRADING_LOG, OCIO::TRANSFORM_DIR_FORWARD, OCIO::GradingPrimary(OCIO::GRADING_LOG), true);
+
+    const std::vector<OCIO::DynamicPropertyImplRcPtr> props{ dpImpl, dpPrimary };
+    const OCIO::DynamicPropertySnapshot snapshot(props);
+
+    OCIO::GradingPrimary primary(OCIO::GRADING_LOG);
+    primary.m_saturation = 1.5;
+
+    {
+        const OCIO::DynamicPropertySnapshot::Pin pin(snapshot);
+
+        // The values published after the snapshot are not visible while it is pinned.
+        dpImpl->setValue(2.0);
+        dpPrimary->setValue(primary);
+        OCIO_CHECK_EQUAL(dpImpl->getValue(), 1.0);
+        OCIO_CHECK_EQUAL(dpPrimary->getValue().m_saturation, 1.0);
+        OCIO_CHECK_ASSERT(dpPrimary->getLocalBypass());
+
+        // Nested pins restore the previous one.
+        {
+            const OCIO::DynamicPropertySnapshot other(props);
+            const OCIO::DynamicPropertySnapshot::Pin pinOther(other);
+            OCIO_CHECK_EQUAL(dpImpl->getValue(), 2.0);
+        }
+        OCIO_CHECK_EQUAL(dpImpl->getValue(), 1.0);
+    }
+
+    OCIO_CHECK_EQUAL(dpImpl->getValue(), 2.0);
+    OCIO_CHECK_EQUAL(dpPrimary->getValue().m_saturation, 1.5);
+    OCIO_CHECK_ASSERT(!dpPrimary->getLocalBypass());
+
+    // The other threads are not affected by the pin.
+    const OCIO::DynamicPropertySnapshot::Pin pin(snapshot);
+    double value = 0.;
+    std::thread reader([&]() { value = dpImpl->getValue(); });
+    reader.join();
+    OCIO_CHECK_EQUAL(value, 2.0);
+    OCIO_CHECK_EQUAL(dpImpl->getValue(), 1.0);
+}
+
 OCIO_ADD_TEST(DynamicPropertyImpl, equal_grading_primary)
 {
     OCIO::GradingPrimary gplog{ OCIO::GRADING_LOG };
@@ -478,6 +584,39 @@ void checkKnotsAndCoefs(
     }
 }
 
+OCIO_ADD_TEST(DynamicPropertyImpl, grading_rgb_curve_knots_coefs_snapshot)
+{
+    auto identity = OCIO::GradingBSplineCurve::Create({ { 0.f, 0.f },{ 1.f, 1.f } });
+    auto curves = OCIO::GradingRGBCurve::Create(identity, identity, identity, identity);
+
+    OCIO::DynamicPropertyGradingRGBCurveImplRcPtr dp =
+        std::make_shared<OCIO::DynamicPropertyGradingRGBCurveImpl>(curves, true);
+
+    const OCIO::ConstKnotsCoefsRcPtr snapshot = dp->getKnotsCoefs();
+    OCIO_CHECK_ASSERT(snapshot->m_localBypass);
+
+    // A new value publishes new knots & coefs, the snapshot is left untouched.
+    auto curve = OCIO::GradingBSplineCurve::Create({ { 0.f, 0.1f },{ 0.5f, 0.7f },{ 1.f, 1.f } });
+    dp->setValue(OCIO::GradingRGBCurve::Create(identity, curve, identity, identity));
+
+    OCIO_CHECK_ASSERT(snapshot->m_localBypass);
+    OCIO_CHECK_EQUAL(snapshot->m_numKnots, 0);
+    OCIO_CHECK_ASSERT(dp->getKnotsCoefs() != snapshot);
+    OCIO_CHECK_ASSERT(!dp->getKnotsCoefs()->m_localBypass);
+    OCIO_CHECK_ASSERT(!dp->getLocalBypass());
+
+    // During an update, the new value is only staged.
+    dp->beginUpdate();
+    dp->setValue(curves);
+    OCIO_CHECK_ASSERT(!dp->getLocalBypass());
+    OCIO_CHECK_ASSERT(dp->prepareUpdate());
+    OCIO_CHECK_ASSERT(!dp->getLocalBypass());
+    dp->commitUpdate();
+    OCIO_CHECK_ASSERT(dp->getLocalBypass());
+    OCIO_CHECK_ASSERT(!dp->isUpdateInProgress());
+    OCIO_CHECK_ASSERT(!dp->prepareUpdate());
+}
+
 OCIO_ADD_TEST(DynamicPropertyImpl, grading_hue_curve_knots_coefs)
 {
      auto hh = OCIO::GradingBSplineCurve::Create(
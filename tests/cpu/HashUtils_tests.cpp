@@ -0,0 +1,60 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#include "HashUtils.cpp"
+
+#include "testutils/UnitTest.h"
+
+namespace OCIO = OCIO_NAMESPACE;
+
+
+OCIO_ADD_TEST(HashUtils, cache_id_hash)
+{
+    const std::string str("OpenColorIO");
+
+    const OCIO::CacheIDDigest digest = OCIO::CacheIDHashDigest(str.c_str(), str.size());
+    OCIO_CHECK_EQUAL(digest.toString(), OCIO::CacheIDHash(str.c_str(), str.size()));
+    OCIO_CHECK_EQUAL(digest.toUUID(), OCIO::CacheIDHashUUID(str.c_str(), str.size()));
+
+    // The UUID is always made of zero-padded 32 hexadecimal digits.
+    OCIO_CHECK_EQUAL(OCIO::CacheIDHashUUID("", 0), "99aa06d3-0147-98d8-6001-c324468d497f");
+
+    OCIO::CacheIDDigest small;
+    small.m_low  = 0x1;
+    small.m_high = 0xab;
+    OCIO_CHECK_EQUAL(small.toString(), "1ab");
+    OCIO_CHECK_EQUAL(small.toUUID(), "00000000-0000-00ab-0000-000000000001");
+}
+
+OCIO_ADD_TEST(HashUtils, cache_id_hasher)
+{
+    const std::string str("The quick brown fox jumps over the lazy dog");
+    const OCIO::CacheIDDigest digest = OCIO::CacheIDHashDigest(str.c_str(), str.size());
+
+    // Hashing the pieces gives the digest of the concatenated data.
+
+    OCIO::CacheIDHasher hasher;
+    hasher.update(str.substr(0, 10)).update(str.substr(10));
+    OCIO_CHECK_ASSERT(hasher.digest() == digest);
+
+    hasher.reset();
+    hasher.update(str.substr(0, 10));
+    OCIO_CHECK_ASSERT(hasher.digest() != digest);
+
+    OCIO::CacheIDHashStream stream;
+    stream << "The quick brown fox jumps over the " << 'l' << "azy dog";
+    OCIO_CHECK_ASSERT(stream.digest() == digest);
+
+    // Digests could be combined.
+
+    OCIO::CacheIDHasher hasher1;
+    hasher1.update(digest).update(digest);
+
+    OCIO::CacheIDHasher hasher2;
+    hasher2.update(digest);
+    OCIO_CHECK_ASSERT(hasher1.digest() != hasher2.digest());
+
+    hasher2.update(digest);
+    OCIO_CHECK_ASSERT(hasher1.digest() == hasher2.digest());
+}
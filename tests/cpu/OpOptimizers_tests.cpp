@@ -773,10 +773,11 @@ OCIO_ADD_TEST(OpOptimizers, lut1d_half_domain_keep_prior_range)
 
     // Add another LUT.
     lutData = lutData->clone();
-    auto & lutArray = lutData->getArray();
-    for (auto & val : lutArray.getValues())
+    const size_t numValues = lutData->getArray().getValues().size();
+    float * values = lutData->getArray().getValues().mutableData();
+    for (size_t idx = 0; idx < numValues; ++idx)
     {
-        val = -val;
+        values[idx] = -values[idx];
     }
     OCIO::CreateLut1DOp(ops, lutData, OCIO::TRANSFORM_DIR_FORWARD);
 
@@ -1581,6 +1582,245 @@ OCIO_ADD_TEST(OpOptimizers, opt_prefix_test1)
     OCIO_CHECK_EQUAL(lut0->getArray().getLength(), 65536u);
 }
 
+OCIO_ADD_TEST(OpOptimizers, opt_prefix_f32)
+{
+    // For F32 input, the separable prefix is only replaced by a half-domain Lut1D when the
+    // dedicated CPU approximation is enabled.
+
+    OCIO::OpRcPtrVec ops;
+    const double exp4[4] = { 2.2, 2.4, 2.6, 1.0 };
+    OCIO_CHECK_NO_THROW(OCIO::CreateExponentOp(ops, exp4, OCIO::TRANSFORM_DIR_FORWARD));
+    OCIO_CHECK_NO_THROW(OCIO::CreateLogOp(ops, 2.0, OCIO::TRANSFORM_DIR_FORWARD));
+    OCIO_CHECK_NO_THROW(ops.finalize());
+    OCIO_REQUIRE_EQUAL(ops.size(), 2);
+
+    OCIO::OpRcPtrVec optOps = ops.clone();
+    OCIO_CHECK_NO_THROW(optOps.optimizeForBitdepth(OCIO::BIT_DEPTH_F32, OCIO::BIT_DEPTH_F32,
+                                                   OCIO::OPTIMIZATION_COMP_SEPARABLE_PREFIX));
+    OCIO_CHECK_EQUAL(optOps.size(), 2);
+
+    // The approximation is lossy so no optimization flag enables it.
+    for (auto level : { OCIO::OPTIMIZATION_LOSSLESS, OCIO::OPTIMIZATION_VERY_GOOD,
+                        OCIO::OPTIMIZATION_GOOD, OCIO::OPTIMIZATION_DRAFT,
+                        OCIO::OPTIMIZATION_ALL })
+    {
+        OCIO_CHECK_NO_THROW(optOps.optimizeForBitdepth(OCIO::BIT_DEPTH_F32, OCIO::BIT_DEPTH_F32,
+                                                       level));
+        OCIO_REQUIRE_EQUAL(optOps.size(), 2);
+        OCIO_CHECK_EQUAL(OCIO::ConstOpRcPtr(optOps[0])->data()->getType(),
+                         OCIO::OpData::ExponentType);
+    }
+
+    OCIO::CPUApproximations approximations;
+    approximations.m_separablePrefixF32 = true;
+
+    // The F32 approximation does not apply to the other bit-depths.
+    OCIO_CHECK_NO_THROW(optOps.optimizeForBitdepth(OCIO::BIT_DEPTH_UINT10, OCIO::BIT_DEPTH_F32,
+                                                   OCIO::OPTIMIZATION_NONE, approximations));
+    OCIO_CHECK_EQUAL(optOps.size(), 2);
+
+    OCIO_CHECK_NO_THROW(optOps.optimizeForBitdepth(OCIO::BIT_DEPTH_F32, OCIO::BIT_DEPTH_F32,
+                                                   OCIO::OPTIMIZATION_NONE, approximations));
+    OCIO_REQUIRE_EQUAL(optOps.size(), 1);
+
+    OCIO::ConstOpRcPtr o0 = optOps[0];
+    OCIO_REQUIRE_EQUAL(o0->data()->getType(), OCIO::OpData::Lut1DType);
+
+    auto lut0 = OCIO_DYNAMIC_POINTER_CAST<const OCIO::Lut1DOpData>(o0->data());
+    OCIO_CHECK_ASSERT(lut0->isInputHalfDomain());
+    OCIO_CHECK_EQUAL(lut0->getArray().getLength(), 65536u);
+
+    // The interpolation between the half values is very close to the original processing (i.e.
+    // the largest differences are the float precision of the large log values). Note that the
+    // exponent op clamps the negative alpha.
+    CompareRender(ops, optOps, __LINE__, 1e-4f, true);
+}
+
+OCIO_ADD_TEST(OpOptimizers, opt_bake_lut3d)
+{
+    OCIO::OpRcPtrVec ops;
+    const double m44[16] = { 0.8,  0.15, 0.05, 0.0,
+                             0.1,  0.8,  0.1,  0.0,
+                             0.05, 0.15, 0.8,  0.0,
+                             0.0,  0.0,  0.0,  1.0 };
+    const double exp4[4] = { 2.2, 2.2, 2.2, 1.0 };
+    OCIO_CHECK_NO_THROW(OCIO::CreateMatrixOp(ops, m44, OCIO::TRANSFORM_DIR_FORWARD));
+    OCIO_CHECK_NO_THROW(OCIO::CreateExponentOp(ops, exp4, OCIO::TRANSFORM_DIR_FORWARD));
+    OCIO_CHECK_NO_THROW(ops.finalize());
+    OCIO_REQUIRE_EQUAL(ops.size(), 2);
+
+    // No optimization flag bakes the ops.
+    OCIO::OpRcPtrVec optOps = ops.clone();
+    OCIO_CHECK_NO_THROW(optOps.optimizeForBitdepth(OCIO::BIT_DEPTH_UINT10, OCIO::BIT_DEPTH_F32,
+                                                   OCIO::OPTIMIZATION_ALL));
+    OCIO_CHECK_EQUAL(optOps.size(), 2);
+
+    // Integer input: no shaper.
+    OCIO::CPUApproximations approximations;
+    OCIO_CHECK_EQUAL(approximations.m_bakeLut3DEdgeLength, 65u);
+    approximations.m_bakeLut3D = true;
+    OCIO_CHECK_NO_THROW(optOps.optimizeForBitdepth(OCIO::BIT_DEPTH_UINT10, OCIO::BIT_DEPTH_F32,
+                                                   OCIO::OPTIMIZATION_NONE, approximations));
+    OCIO_REQUIRE_EQUAL(optOps.size(), 1);
+
+    OCIO::ConstOpRcPtr o0 = optOps[0];
+    OCIO_REQUIRE_EQUAL(o0->data()->getType(), OCIO::OpData::Lut3DType);
+    auto lut3d = OCIO_DYNAMIC_POINTER_CAST<const OCIO::Lut3DOpData>(o0->data());
+    OCIO_CHECK_EQUAL(lut3d->getGridSize(), 65);
+    OCIO_CHECK_EQUAL(lut3d->getInterpolation(), OCIO::INTERP_TETRAHEDRAL);
+
+    const std::vector<float> img = {
+        0.778f, 0.824f, 0.885f, 0.153f,
+        0.044f, 0.014f, 0.088f, 0.999f,
+        0.488f, 0.381f, 0.f,    0.f,
+        1.000f, 0.25f,  0.023f, 1.f };
+
+    std::vector<float> ref = img;
+    for (const auto & op : ops)
+    {
+        op->apply(ref.data(), ref.data(), 4);
+    }
+    std::vector<float> res = img;
+    optOps[0]->apply(res.data(), res.data(), 4);
+
+    for (size_t idx = 0; idx < img.size(); ++idx)
+    {
+        OCIO_CHECK_CLOSE(res[idx], ref[idx], 1e-3f);
+    }
+
+    // Already a single 3D LUT: nothing to do.
+    OCIO_CHECK_NO_THROW(optOps.optimizeForBitdepth(OCIO::BIT_DEPTH_UINT10, OCIO::BIT_DEPTH_F32,
+                                                   OCIO::OPTIMIZATION_NONE, approximations));
+    OCIO_REQUIRE_EQUAL(optOps.size(), 1);
+    OCIO_CHECK_ASSERT(optOps[0] == o0);
+
+    // Float input: half-domain shaper followed by the 3D LUT.
+    approximations.m_bakeLut3DEdgeLength = 33;
+    optOps = ops.clone();
+    OCIO_CHECK_NO_THROW(optOps.optimizeForBitdepth(OCIO::BIT_DEPTH_F32, OCIO::BIT_DEPTH_F32,
+                                                   OCIO::OPTIMIZATION_NONE, approximations));
+    OCIO_REQUIRE_EQUAL(optOps.size(), 2);
+
+    o0 = optOps[0];
+    OCIO_REQUIRE_EQUAL(o0->data()->getType(), OCIO::OpData::Lut1DType);
+    auto lut1d = OCIO_DYNAMIC_POINTER_CAST<const OCIO::Lut1DOpData>(o0->data());
+    OCIO_CHECK_ASSERT(lut1d->isInputHalfDomain());
+
+    OCIO::ConstOpRcPtr o1 = optOps[1];
+    OCIO_REQUIRE_EQUAL(o1->data()->getType(), OCIO::OpData::Lut3DType);
+    lut3d = OCIO_DYNAMIC_POINTER_CAST<const OCIO::Lut3DOpData>(o1->data());
+    OCIO_CHECK_EQUAL(lut3d->getGridSize(), 33);
+
+    // 0.18 is on the grid so it is exactly mapped.
+    float pixel[4] = { 0.18f, 0.18f, 0.18f, 1.f };
+    for (const auto & op : optOps)
+    {
+        op->apply(pixel, pixel, 1);
+    }
+    const float expected = std::pow(0.18f, 2.2f);
+    OCIO_CHECK_CLOSE(pixel[0], expected, 1e-4f);
+    OCIO_CHECK_CLOSE(pixel[1], expected, 1e-4f);
+    OCIO_CHECK_CLOSE(pixel[2], expected, 1e-4f);
+
+    // An empty shaper range removes the shaper.
+    approximations.m_bakeLut3DShaperMinStops = 0.;
+    approximations.m_bakeLut3DShaperMaxStops = 0.;
+    optOps = ops.clone();
+    OCIO_CHECK_NO_THROW(optOps.optimizeForBitdepth(OCIO::BIT_DEPTH_F32, OCIO::BIT_DEPTH_F32,
+                                                   OCIO::OPTIMIZATION_NONE, approximations));
+    OCIO_REQUIRE_EQUAL(optOps.size(), 1);
+    o0 = optOps[0];
+    OCIO_CHECK_EQUAL(o0->data()->getType(), OCIO::OpData::Lut3DType);
+
+    // Separable ops are left to the separable prefix optimization.
+    OCIO::OpRcPtrVec sepOps;
+    OCIO_CHECK_NO_THROW(OCIO::CreateExponentOp(sepOps, exp4, OCIO::TRANSFORM_DIR_FORWARD));
+    OCIO_CHECK_NO_THROW(sepOps.finalize());
+    OCIO_CHECK_NO_THROW(sepOps.optimizeForBitdepth(OCIO::BIT_DEPTH_UINT10, OCIO::BIT_DEPTH_F32,
+                                                   OCIO::OPTIMIZATION_NONE, approximations));
+    OCIO_REQUIRE_EQUAL(sepOps.size(), 1);
+    o0 = sepOps[0];
+    OCIO_CHECK_EQUAL(o0->data()->getType(), OCIO::OpData::ExponentType);
+
+    // The ops are kept when the baked LUT exceeds the max error.
+    approximations.m_bakeLut3DEdgeLength = 2;
+    approximations.m_bakeLut3DMaxError = 1e-3;
+    optOps = ops.clone();
+    OCIO_CHECK_NO_THROW(optOps.optimizeForBitdepth(OCIO::BIT_DEPTH_UINT10, OCIO::BIT_DEPTH_F32,
+                                                   OCIO::OPTIMIZATION_NONE, approximations));
+    OCIO_CHECK_EQUAL(optOps.size(), 2);
+
+    approximations.m_bakeLut3DEdgeLength = 65;
+    optOps = ops.clone();
+    OCIO_CHECK_NO_THROW(optOps.optimizeForBitdepth(OCIO::BIT_DEPTH_UINT10, OCIO::BIT_DEPTH_F32,
+                                                   OCIO::OPTIMIZATION_NONE, approximations));
+    OCIO_REQUIRE_EQUAL(optOps.size(), 1);
+    o0 = optOps[0];
+    OCIO_CHECK_EQUAL(o0->data()->getType(), OCIO::OpData::Lut3DType);
+
+    // A matrix is exactly interpolated by the 3D LUT inside its domain, but float input is not
+    // bounded so the clamping of the values outside of the domain is an error.
+    OCIO::OpRcPtrVec matOps;
+    OCIO_CHECK_NO_THROW(OCIO::CreateMatrixOp(matOps, m44, OCIO::TRANSFORM_DIR_FORWARD));
+    OCIO_CHECK_NO_THROW(matOps.finalize());
+
+    optOps = matOps.clone();
+    OCIO_CHECK_NO_THROW(optOps.optimizeForBitdepth(OCIO::BIT_DEPTH_UINT10, OCIO::BIT_DEPTH_F32,
+                                                   OCIO::OPTIMIZATION_NONE, approximations));
+    OCIO_REQUIRE_EQUAL(optOps.size(), 1);
+    o0 = optOps[0];
+    OCIO_CHECK_EQUAL(o0->data()->getType(), OCIO::OpData::Lut3DType);
+
+    optOps = matOps.clone();
+    OCIO_CHECK_NO_THROW(optOps.optimizeForBitdepth(OCIO::BIT_DEPTH_F32, OCIO::BIT_DEPTH_F32,
+                                                   OCIO::OPTIMIZATION_NONE, approximations));
+    OCIO_REQUIRE_EQUAL(optOps.size(), 1);
+    o0 = optOps[0];
+    OCIO_CHECK_EQUAL(o0->data()->getType(), OCIO::OpData::MatrixType);
+
+    // Same with the shaper which clamps the negative values.
+    approximations.m_bakeLut3DShaperMinStops = -10.;
+    approximations.m_bakeLut3DShaperMaxStops = 10.;
+    approximations.m_bakeLut3DMaxError = 1e3;
+
+    optOps = matOps.clone();
+    OCIO_CHECK_NO_THROW(optOps.optimizeForBitdepth(OCIO::BIT_DEPTH_F32, OCIO::BIT_DEPTH_F32,
+                                                   OCIO::OPTIMIZATION_NONE, approximations));
+    OCIO_REQUIRE_EQUAL(optOps.size(), 1);
+    o0 = optOps[0];
+    OCIO_CHECK_EQUAL(o0->data()->getType(), OCIO::OpData::MatrixType);
+
+    // The default max error always bakes the ops.
+    approximations.m_bakeLut3DMaxError = 0.;
+    optOps = matOps.clone();
+    OCIO_CHECK_NO_THROW(optOps.optimizeForBitdepth(OCIO::BIT_DEPTH_F32, OCIO::BIT_DEPTH_F32,
+                                                   OCIO::OPTIMIZATION_NONE, approximations));
+    OCIO_CHECK_EQUAL(optOps.size(), 2);
+
+    // Validation.
+    OCIO_CHECK_NO_THROW(approximations.validate());
+    OCIO_CHECK_NO_THROW(OCIO::CPUApproximations().validate());
+
+    approximations.m_bakeLut3DEdgeLength = 1;
+    OCIO_CHECK_THROW_WHAT(approximations.validate(), OCIO::Exception,
+                          "Edge length '1' must be in the range [2, 129]");
+    approximations.m_bakeLut3DEdgeLength = 130;
+    OCIO_CHECK_THROW_WHAT(approximations.validate(), OCIO::Exception,
+                          "Edge length '130' must be in the range [2, 129]");
+    approximations.m_bakeLut3DEdgeLength = 33;
+
+    approximations.m_bakeLut3DShaperMinStops = 2.;
+    approximations.m_bakeLut3DShaperMaxStops = -2.;
+    OCIO_CHECK_THROW_WHAT(approximations.validate(), OCIO::Exception,
+                          "Shaper range [2, -2] is not a valid range");
+    approximations.m_bakeLut3DShaperMinStops = -10.;
+    approximations.m_bakeLut3DShaperMaxStops = 10.;
+
+    approximations.m_bakeLut3DMaxError = -1.;
+    OCIO_CHECK_THROW_WHAT(approximations.validate(), OCIO::Exception,
+                          "Max error '-1' must be positive or zero");
+}
+
 OCIO_ADD_TEST(OpOptimizers, replace_ops)
 {
     auto cdlData = std::make_shared<OCIO::CDLOpData>();
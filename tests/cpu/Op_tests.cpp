@@ -515,3 +515,32 @@ OCIO_ADD_TEST(OpRcPtrVec, serialize)
     // Serialize not optimized OpVec i.e. contains some NoOps.
     OCIO_CHECK_NO_THROW(OCIO::SerializeOpVec(ops));
 }
+
+OCIO_ADD_TEST(OpRcPtrVec, cache_id_hasher)
+{
+    // The ops directly write their cache IDs to the hasher, and the digest is the same as hashing
+    // the cache ID string.
+
+    OCIO::ContextRcPtr context = OCIO::Context::Create();
+
+    OCIO::OpRcPtrVec ops;
+    for (const std::string fileName : { "clf/multiple_ops.clf",
+                                        "cdl_various.ctf",
+                                        "exposure_contrast_log.ctf",
+                                        "fixed_function.ctf",
+                                        "gamma_test1.ctf",
+                                        "grading_hue_curve.ctf",
+                                        "log_logtolinv2.ctf" })
+    {
+        OCIO_CHECK_NO_THROW(OCIO::BuildOpsTest(ops, fileName, context,
+                                               OCIO::TRANSFORM_DIR_FORWARD));
+    }
+    OCIO_REQUIRE_ASSERT(ops.size() > 10);
+
+    const std::string cacheID = ops.getCacheID();
+
+    OCIO::CacheIDHasher hasher;
+    ops.getCacheID(hasher);
+
+    OCIO_CHECK_ASSERT(hasher.digest() == OCIO::CacheIDHashDigest(cacheID.c_str(), cacheID.size()));
+}
@@ -228,3 +228,26 @@ OCIO_ADD_TEST(Platform, utf8_utf16_convert)
     OCIO_CHECK_ASSERT(wcscmp(utf8_to_utf16.c_str(), utf16_str.c_str()) == 0);
 #endif
 }
+
+OCIO_ADD_TEST(Platform, mapped_file)
+{
+    const std::string filename = OCIO::Platform::CreateTempFilename(".bin");
+    const std::string content("mapped\0content", 14);
+    {
+        std::ofstream ofs(filename, std::ios::out | std::ios::binary);
+        ofs.write(content.data(), content.size());
+    }
+
+    {
+        OCIO::Platform::MappedFile file(filename.c_str());
+        OCIO_CHECK_EQUAL(file.size(), content.size());
+        OCIO_REQUIRE_ASSERT(file.data());
+        OCIO_CHECK_EQUAL(std::string(file.data(), file.size()), content);
+    }
+
+    std::remove(filename.c_str());
+
+    OCIO_CHECK_THROW_WHAT(OCIO::Platform::MappedFile(filename.c_str()),
+                          OCIO::Exception,
+                          "Error could not read");
+}
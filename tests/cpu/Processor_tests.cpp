@@ -423,6 +423,44 @@ OCIO_ADD_TEST(Processor, cache_cpu_processors)
     OCIO_CHECK_NO_THROW(cpuProc1 = proc1->getOptimizedCPUProcessor(OCIO::OPTIMIZATION_LOSSLESS));
     OCIO_CHECK_EQUAL(cpuProc1.get(), cpuProc2.get());
 
+    // The default approximations share the processor built without approximations.
+    OCIO::CPUApproximations approximations;
+    OCIO_CHECK_NO_THROW(cpuProc2 = proc1->getOptimizedCPUProcessor(OCIO::BIT_DEPTH_F32,
+                                                                   OCIO::BIT_DEPTH_F32,
+                                                                   OCIO::OPTIMIZATION_LOSSLESS,
+                                                                   approximations));
+    OCIO_CHECK_EQUAL(cpuProc1.get(), cpuProc2.get());
+
+    // The approximations are different.
+    approximations.m_bakeLut3D = true;
+    OCIO_CHECK_NO_THROW(cpuProc2 = proc1->getOptimizedCPUProcessor(OCIO::BIT_DEPTH_F32,
+                                                                   OCIO::BIT_DEPTH_F32,
+                                                                   OCIO::OPTIMIZATION_LOSSLESS,
+                                                                   approximations));
+    OCIO_CHECK_NE(cpuProc1.get(), cpuProc2.get());
+
+    OCIO::ConstCPUProcessorRcPtr cpuProc3;
+    approximations.m_bakeLut3DEdgeLength = 33;
+    OCIO_CHECK_NO_THROW(cpuProc3 = proc1->getOptimizedCPUProcessor(OCIO::BIT_DEPTH_F32,
+                                                                   OCIO::BIT_DEPTH_F32,
+                                                                   OCIO::OPTIMIZATION_LOSSLESS,
+                                                                   approximations));
+    OCIO_CHECK_NE(cpuProc2.get(), cpuProc3.get());
+
+    OCIO_CHECK_NO_THROW(cpuProc2 = proc1->getOptimizedCPUProcessor(OCIO::BIT_DEPTH_F32,
+                                                                   OCIO::BIT_DEPTH_F32,
+                                                                   OCIO::OPTIMIZATION_LOSSLESS,
+                                                                   approximations));
+    OCIO_CHECK_EQUAL(cpuProc2.get(), cpuProc3.get());
+
+    approximations.m_bakeLut3DEdgeLength = 1;
+    OCIO_CHECK_THROW_WHAT(proc1->getOptimizedCPUProcessor(OCIO::BIT_DEPTH_F32,
+                                                          OCIO::BIT_DEPTH_F32,
+                                                          OCIO::OPTIMIZATION_LOSSLESS,
+                                                          approximations),
+                          OCIO::Exception,
+                          "Edge length '1' must be in the range [2, 129]");
+
     // If that's a 'dynamic' transform (i.e. contains dynamic properties) then the cache is used
     // or not depdending of the cache setting.
 
@@ -0,0 +1,115 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "ThreadPool.cpp"
+
+#include "testutils/UnitTest.h"
+
+namespace OCIO = OCIO_NAMESPACE;
+
+
+OCIO_ADD_TEST(ThreadPool, run_tasks)
+{
+    OCIO_CHECK_ASSERT(OCIO::GetNumHardwareThreads() >= 1);
+
+    OCIO_CHECK_NO_THROW(OCIO::RunParallelTasks(0, [](unsigned) { throw OCIO::Exception("No task."); }));
+
+    for (unsigned numTasks : { 1u, 2u, 7u, 100u })
+    {
+        std::vector<std::atomic<int>> counts(numTasks);
+        for (auto & count : counts)
+        {
+            count = 0;
+        }
+
+        OCIO::RunParallelTasks(numTasks, [&counts](unsigned task) { ++counts[task]; });
+
+        // Each task is processed exactly once.
+        for (const auto & count : counts)
+        {
+            OCIO_CHECK_EQUAL(count.load(), 1);
+        }
+    }
+}
+
+OCIO_ADD_TEST(ThreadPool, errors)
+{
+    std::atomic<int> numCalls{ 0 };
+
+    // The error is only reported once all the tasks are done.
+    OCIO_CHECK_THROW_WHAT(OCIO::RunParallelTasks(10, [&numCalls](unsigned task)
+                          {
+                              ++numCalls;
+                              if (task == 3)
+                              {
+                                  throw OCIO::Exception("Task failure.");
+                              }
+                          }),
+                          OCIO::Exception, "Task failure.");
+    OCIO_CHECK_EQUAL(numCalls.load(), 10);
+
+    // The pool is still usable.
+    numCalls = 0;
+    OCIO_CHECK_NO_THROW(OCIO::RunParallelTasks(10, [&numCalls](unsigned) { ++numCalls; }));
+    OCIO_CHECK_EQUAL(numCalls.load(), 10);
+}
+
+OCIO_ADD_TEST(ThreadPool, nested_and_concurrent_calls)
+{
+    // Tasks running tasks and several threads using the pool at the same time never wait for
+    // each other.
+
+    constexpr unsigned NumThreads = 4;
+    std::atomic<int> numCalls{ 0 };
+
+    auto runNested = [&numCalls]()
+    {
+        OCIO::RunParallelTasks(8, [&numCalls](unsigned)
+        {
+            OCIO::RunParallelTasks(8, [&numCalls](unsigned) { ++numCalls; });
+        });
+    };
+
+    std::vector<std::thread> threads;
+    for (unsigned i = 0; i < NumThreads; ++i)
+    {
+        threads.emplace_back(runNested);
+    }
+    for (auto & thread : threads)
+    {
+        thread.join();
+    }
+
+    OCIO_CHECK_EQUAL(numCalls.load(), (int)(NumThreads * 8 * 8));
+}
+
+OCIO_ADD_TEST(ThreadPool, run_ranges)
+{
+    for (unsigned long numItems : { 0UL, 1UL, 5UL, 1000UL })
+    {
+        for (unsigned numTasks : { 1u, 3u, 16u })
+        {
+            std::vector<int> counts(numItems, 0);
+
+            OCIO::RunParallelRanges(numItems, numTasks,
+                                    [&counts](unsigned long begin, unsigned long end)
+            {
+                for (unsigned long i = begin; i < end; ++i)
+                {
+                    ++counts[i];
+                }
+            });
+
+            // The sub-ranges cover all the items without overlapping.
+            for (int count : counts)
+            {
+                OCIO_CHECK_EQUAL(count, 1);
+            }
+        }
+    }
+}
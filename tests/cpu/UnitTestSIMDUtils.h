@@ -0,0 +1,75 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+#ifndef INCLUDED_OCIO_UNITTEST_SIMDUTILS_H
+#define INCLUDED_OCIO_UNITTEST_SIMDUTILS_H
+
+#include <vector>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include "testutils/UnitTest.h"
+
+namespace OCIO_NAMESPACE
+{
+
+// Renderer using the vectorized apply function (i.e. its m_applySIMD member) to test, a null
+// function selects the SSE (or scalar) code of the renderer.
+template<typename Renderer>
+class RendererSIMD : public Renderer
+{
+public:
+    template<typename OpDataRcPtr, typename ApplyFunc>
+    RendererSIMD(OpDataRcPtr & data, ApplyFunc * func)
+        : Renderer(data)
+    {
+        this->m_applySIMD = func;
+    }
+};
+
+// RGBA image with values below, within and above the [0, 1] range. The alpha is not scaled.
+inline std::vector<float> CreateSIMDTestImage(long numPixels, float scale)
+{
+    std::vector<float> image(4 * numPixels);
+    for (long idx = 0; idx < numPixels; ++idx)
+    {
+        image[4 * idx + 0] = scale * (-0.5f + 0.05f * (float)(idx % 37));
+        image[4 * idx + 1] = scale * ( 1.3f - 0.04f * (float)(idx % 41));
+        image[4 * idx + 2] = scale * ( 0.2f + 0.03f * (float)(idx % 11));
+        image[4 * idx + 3] = 0.1f * (float)(idx % 7);
+    }
+    return image;
+}
+
+// Compare the renderer using the vectorized apply function with the SSE (or scalar) one, for
+// separate and in-place buffers. The number of pixels should not be a multiple of the vector
+// sizes to also test the last packet. The validate function compares two images i.e.
+// validate(expected, result, numPixels, line).
+template<typename Renderer, typename OpDataRcPtr, typename ApplyFunc, typename Validate>
+void CheckRendererSIMD(OpDataRcPtr & data,
+                       ApplyFunc * func,
+                       long numPixels,
+                       float scale,
+                       Validate validate,
+                       unsigned line)
+{
+    std::vector<float> image = CreateSIMDTestImage(numPixels, scale);
+
+    std::vector<float> expected(4 * numPixels);
+    std::vector<float> res(4 * numPixels);
+
+    const RendererSIMD<Renderer> ref(data, static_cast<ApplyFunc *>(nullptr));
+    const RendererSIMD<Renderer> simd(data, func);
+
+    OCIO_CHECK_NO_THROW_FROM(ref.apply(image.data(), expected.data(), numPixels), line);
+    OCIO_CHECK_NO_THROW_FROM(simd.apply(image.data(), res.data(), numPixels), line);
+    validate(expected.data(), res.data(), numPixels, line);
+
+    // In-place processing.
+    OCIO_CHECK_NO_THROW_FROM(simd.apply(image.data(), image.data(), numPixels), line);
+    validate(expected.data(), image.data(), numPixels, line);
+}
+
+} // namespace OCIO_NAMESPACE
+
+#endif // INCLUDED_OCIO_UNITTEST_SIMDUTILS_H
@@ -0,0 +1,94 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright Contributors to the OpenColorIO Project.
+
+
+#include "ops/OpArray.h"
+
+#include "testutils/UnitTest.h"
+
+namespace OCIO = OCIO_NAMESPACE;
+
+namespace
+{
+
+// An array holding three values per entry.
+class RGBArray : public OCIO::Array
+{
+public:
+    unsigned long getNumValues() const override
+    {
+        return getLength() * getMaxColorComponents();
+    }
+};
+
+} // anon.
+
+OCIO_ADD_TEST(ArrayValues, owned)
+{
+    OCIO::Array::Values values(4, 0.5f);
+    OCIO_CHECK_ASSERT(!values.isShared());
+    OCIO_CHECK_EQUAL(values.size(), 4);
+
+    values.mutableData()[1] = 1.0f;
+    values.resize(6);
+    OCIO_CHECK_EQUAL(values.size(), 6);
+    OCIO_CHECK_EQUAL(values[1], 1.0f);
+    OCIO_CHECK_EQUAL(values[5], 0.0f);
+
+    const OCIO::Array::Values other(std::vector<float>{ 0.5f, 1.0f, 0.5f, 0.5f, 0.0f, 0.0f });
+    OCIO_CHECK_ASSERT(values == other);
+
+    values.clear();
+    OCIO_CHECK_ASSERT(values.empty());
+}
+
+OCIO_ADD_TEST(ArrayValues, copy_on_write)
+{
+    // The shared values are owned by the holder.
+    auto holder = std::make_shared<std::vector<float>>(std::vector<float>{ 1.f, 2.f, 3.f });
+
+    OCIO::Array::Values values;
+    values.share(holder->data(), holder->size(), holder);
+    OCIO_CHECK_ASSERT(values.isShared());
+    OCIO_CHECK_EQUAL(holder.use_count(), 2);
+
+    // Reading does not copy.
+    const OCIO::Array::Values & constValues = values;
+    OCIO_CHECK_EQUAL(constValues.size(), 3);
+    OCIO_CHECK_EQUAL(constValues.data(), holder->data());
+    OCIO_CHECK_EQUAL(constValues[2], 3.f);
+
+    // A copy shares the values.
+    OCIO::Array::Values copy = values;
+    OCIO_CHECK_ASSERT(copy.isShared());
+    OCIO_CHECK_EQUAL(holder.use_count(), 3);
+    OCIO_CHECK_ASSERT(copy == values);
+
+    // Resizing to the same size keeps sharing.
+    copy.resize(3);
+    OCIO_CHECK_ASSERT(copy.isShared());
+
+    // Modifying copies the values.
+    copy.mutableData()[0] = 10.f;
+    OCIO_CHECK_ASSERT(!copy.isShared());
+    OCIO_CHECK_EQUAL(holder.use_count(), 2);
+    OCIO_CHECK_EQUAL(copy[0], 10.f);
+    OCIO_CHECK_EQUAL(copy[1], 2.f);
+    OCIO_CHECK_EQUAL((*holder)[0], 1.f);
+    OCIO_CHECK_ASSERT(copy != values);
+
+    // The array is only shared through its values.
+    RGBArray array;
+    array.resize(1, 3);
+    array.getValues() = values;
+    OCIO_CHECK_EQUAL(array.getDoubleValue(1), 2.);
+    array.adjustColorComponentNumber();
+    OCIO_CHECK_ASSERT(array.getValues().isShared());
+
+    array.scale(2.f);
+    OCIO_CHECK_ASSERT(!array.getValues().isShared());
+    OCIO_CHECK_EQUAL(array[2], 6.f);
+
+    values.clear();
+    OCIO_CHECK_EQUAL(holder.use_count(), 1);
+}
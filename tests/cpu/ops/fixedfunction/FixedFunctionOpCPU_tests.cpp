@@ -617,6 +617,62 @@ OCIO_ADD_TEST(FixedFunctionOpCPU, aces_ot_20_edge_cases)
     ApplyFixedFunction(input_32f.data(), expected_32f.data(), test_cases, funcData, 1e-4f, __LINE__);
 }
 
+OCIO_ADD_TEST(FixedFunctionOpCPU, aces_ot_20_fast)
+{
+    // The SIMD renderer (used when the fast log, exp & pow approximations are allowed) is
+    // validated against the scalar one. The number of pixels is not a multiple of the SIMD
+    // width in order to also validate the processing of the remaining pixels.
+
+    const int lut_size = 11;
+    const int num_channels = 4;
+    const int num_samples = lut_size * lut_size * lut_size + 2;
+    std::vector<float> input_32f(num_samples * num_channels, 0.f);
+    std::vector<float> expected_32f(num_samples * num_channels, 0.f);
+
+    GenerateIdentityLut3D(&input_32f[2 * num_channels], lut_size, num_channels, OCIO::LUT3DORDER_FAST_RED);
+
+    // Cover small negative values & HDR values.
+    for (int i = 0; i < num_samples * num_channels; i += num_channels)
+    {
+        input_32f[i + 0] = 16.f * input_32f[i + 0] * input_32f[i + 0] - 0.05f;
+        input_32f[i + 1] = 16.f * input_32f[i + 1] * input_32f[i + 1] - 0.05f;
+        input_32f[i + 2] = 16.f * input_32f[i + 2] * input_32f[i + 2] - 0.05f;
+        input_32f[i + 3] = float(i % 3) * 0.5f;
+    }
+
+    // Black & a hue angle of exactly 360 degrees (refer to the aces_ot_20_edge_cases test).
+    input_32f[0] = 0.f;
+    input_32f[1] = 0.f;
+    input_32f[2] = 0.f;
+    input_32f[4] = 0.742242277f;
+    input_32f[5] = 0.0931933373f;
+    input_32f[6] = 0.321542144f;
+
+    for (const double peakLuminance : { 100., 1000. })
+    {
+        OCIO::FixedFunctionOpData::Params params = {
+            peakLuminance,
+            // P3D65 gamut
+            0.680, 0.320, 0.265, 0.690, 0.150, 0.060, 0.3127, 0.3290
+        };
+
+        OCIO::ConstFixedFunctionOpDataRcPtr funcData
+            = std::make_shared<OCIO::FixedFunctionOpData>(OCIO::FixedFunctionOpData::ACES_OUTPUT_TRANSFORM_20_FWD,
+                                                          params);
+
+        OCIO::ConstOpCPURcPtr op;
+        OCIO_CHECK_NO_THROW(op = OCIO::GetFixedFunctionCPURenderer(funcData, false));
+        OCIO_CHECK_NO_THROW(op->apply(&input_32f[0], &expected_32f[0], num_samples));
+
+        std::vector<float> output_32f = input_32f;
+        ApplyFixedFunction(&output_32f[0], &expected_32f[0], num_samples,
+                           funcData,
+                           1e-4f,
+                           __LINE__,
+                           true);
+    }
+}
+
 OCIO_ADD_TEST(FixedFunctionOpCPU, aces_ot_20_p3d65_100n_rt)
 {
     const int lut_size = 8;
@@ -1420,3 +1476,205 @@ OCIO_ADD_TEST(FixedFunctionOpCPU, LIN_TO_DOUBLE_LOG)
         ApplyFixedFunction(img.data(), linearFrame.data(), NumPixels, dataFInv, 1e-6f, __LINE__, false);
     }
 }
+
+namespace
+{
+
+// Scalar renderers used as the reference for the SIMD versions of the color model conversions.
+OCIO::ConstOpCPURcPtr GetColorModelScalarRenderer(OCIO::ConstFixedFunctionOpDataRcPtr & data)
+{
+    switch (data->getStyle())
+    {
+        case OCIO::FixedFunctionOpData::RGB_TO_HSV:
+            return std::make_shared<OCIO::Renderer_RGB_TO_HSV>(data);
+        case OCIO::FixedFunctionOpData::HSV_TO_RGB:
+            return std::make_shared<OCIO::Renderer_HSV_TO_RGB>(data);
+        case OCIO::FixedFunctionOpData::RGB_TO_HSY_LOG:
+            return std::make_shared<OCIO::Renderer_RGB_TO_HSY_LOG>(data);
+        case OCIO::FixedFunctionOpData::HSY_LOG_TO_RGB:
+            return std::make_shared<OCIO::Renderer_HSY_LOG_TO_RGB>(data);
+        case OCIO::FixedFunctionOpData::RGB_TO_HSY_LIN:
+            return std::make_shared<OCIO::Renderer_RGB_TO_HSY_LIN>(data);
+        case OCIO::FixedFunctionOpData::HSY_LIN_TO_RGB:
+            return std::make_shared<OCIO::Renderer_HSY_LIN_TO_RGB>(data);
+        case OCIO::FixedFunctionOpData::RGB_TO_HSY_VID:
+            return std::make_shared<OCIO::Renderer_RGB_TO_HSY_VID>(data);
+        case OCIO::FixedFunctionOpData::HSY_VID_TO_RGB:
+            return std::make_shared<OCIO::Renderer_HSY_VID_TO_RGB>(data);
+        case OCIO::FixedFunctionOpData::XYZ_TO_xyY:
+            return std::make_shared<OCIO::Renderer_XYZ_TO_xyY>(data);
+        case OCIO::FixedFunctionOpData::xyY_TO_XYZ:
+            return std::make_shared<OCIO::Renderer_xyY_TO_XYZ>(data);
+        case OCIO::FixedFunctionOpData::XYZ_TO_uvY:
+            return std::make_shared<OCIO::Renderer_XYZ_TO_uvY>(data);
+        case OCIO::FixedFunctionOpData::uvY_TO_XYZ:
+            return std::make_shared<OCIO::Renderer_uvY_TO_XYZ>(data);
+        case OCIO::FixedFunctionOpData::XYZ_TO_LUV:
+            return std::make_shared<OCIO::Renderer_XYZ_TO_LUV>(data);
+        case OCIO::FixedFunctionOpData::LUV_TO_XYZ:
+            return std::make_shared<OCIO::Renderer_LUV_TO_XYZ>(data);
+        case OCIO::FixedFunctionOpData::ACES_RED_MOD_03_FWD:
+        case OCIO::FixedFunctionOpData::ACES_RED_MOD_03_INV:
+        case OCIO::FixedFunctionOpData::ACES_RED_MOD_10_FWD:
+        case OCIO::FixedFunctionOpData::ACES_RED_MOD_10_INV:
+        case OCIO::FixedFunctionOpData::ACES_GLOW_03_FWD:
+        case OCIO::FixedFunctionOpData::ACES_GLOW_03_INV:
+        case OCIO::FixedFunctionOpData::ACES_GLOW_10_FWD:
+        case OCIO::FixedFunctionOpData::ACES_GLOW_10_INV:
+        case OCIO::FixedFunctionOpData::ACES_DARK_TO_DIM_10_FWD:
+        case OCIO::FixedFunctionOpData::ACES_DARK_TO_DIM_10_INV:
+        case OCIO::FixedFunctionOpData::ACES_GAMUT_COMP_13_FWD:
+        case OCIO::FixedFunctionOpData::ACES_GAMUT_COMP_13_INV:
+        case OCIO::FixedFunctionOpData::REC2100_SURROUND_FWD:
+        case OCIO::FixedFunctionOpData::REC2100_SURROUND_INV:
+        case OCIO::FixedFunctionOpData::LIN_TO_PQ:
+        case OCIO::FixedFunctionOpData::PQ_TO_LIN:
+        case OCIO::FixedFunctionOpData::LIN_TO_GAMMA_LOG:
+        case OCIO::FixedFunctionOpData::GAMMA_LOG_TO_LIN:
+        case OCIO::FixedFunctionOpData::LIN_TO_DOUBLE_LOG:
+        case OCIO::FixedFunctionOpData::DOUBLE_LOG_TO_LIN:
+        case OCIO::FixedFunctionOpData::ACES_OUTPUT_TRANSFORM_20_FWD:
+        case OCIO::FixedFunctionOpData::ACES_OUTPUT_TRANSFORM_20_INV:
+        case OCIO::FixedFunctionOpData::ACES_RGB_TO_JMh_20:
+        case OCIO::FixedFunctionOpData::ACES_JMh_TO_RGB_20:
+        case OCIO::FixedFunctionOpData::ACES_TONESCALE_COMPRESS_20_FWD:
+        case OCIO::FixedFunctionOpData::ACES_TONESCALE_COMPRESS_20_INV:
+        case OCIO::FixedFunctionOpData::ACES_GAMUT_COMPRESS_20_FWD:
+        case OCIO::FixedFunctionOpData::ACES_GAMUT_COMPRESS_20_INV:
+            break;
+    }
+
+    throw OCIO::Exception("Not a color model conversion.");
+}
+
+void ColorModelCheckSIMD(OCIO::ColorModelSIMDApplyFunc * (*getFunc)(OCIO::FixedFunctionOpData::Style))
+{
+    // The number of pixels is not a multiple of the SIMD width in order to also validate the
+    // processing of the remaining pixels.
+    const int lut_size = 11;
+    const int num_channels = 4;
+    const int num_samples = lut_size * lut_size * lut_size + 3;
+    std::vector<float> rgb(num_samples * num_channels, 0.f);
+
+    GenerateIdentityLut3D(&rgb[3 * num_channels], lut_size, num_channels, OCIO::LUT3DORDER_FAST_RED);
+
+    // Cover negative & HDR values, and keep a few exact grays & zeros.
+    for (int i = 3 * num_channels; i < num_samples * num_channels; i += num_channels)
+    {
+        rgb[i + 0] = 3.f * rgb[i + 0] * rgb[i + 0] - 0.25f;
+        rgb[i + 1] = 3.f * rgb[i + 1] * rgb[i + 1] - 0.25f;
+        rgb[i + 2] = 3.f * rgb[i + 2] - 0.5f;
+        rgb[i + 3] = float(i % 3) * 0.5f;
+    }
+    rgb[4] = rgb[5] = rgb[6] = 0.18f;
+    rgb[8] = rgb[9] = rgb[10] = -0.5f;
+
+    // Negative XYZ values could lead to denominators close to zero, which would amplify the
+    // rounding differences (e.g. from the FMA instructions) so only use the positive values.
+    std::vector<float> xyz(rgb);
+    for (auto & v : xyz)
+    {
+        v = std::abs(v);
+    }
+
+    const OCIO::FixedFunctionOpData::Style styles[][2] = {
+        { OCIO::FixedFunctionOpData::RGB_TO_HSV,     OCIO::FixedFunctionOpData::HSV_TO_RGB     },
+        { OCIO::FixedFunctionOpData::RGB_TO_HSY_LOG, OCIO::FixedFunctionOpData::HSY_LOG_TO_RGB },
+        { OCIO::FixedFunctionOpData::RGB_TO_HSY_LIN, OCIO::FixedFunctionOpData::HSY_LIN_TO_RGB },
+        { OCIO::FixedFunctionOpData::RGB_TO_HSY_VID, OCIO::FixedFunctionOpData::HSY_VID_TO_RGB },
+        { OCIO::FixedFunctionOpData::XYZ_TO_xyY,     OCIO::FixedFunctionOpData::xyY_TO_XYZ     },
+        { OCIO::FixedFunctionOpData::XYZ_TO_uvY,     OCIO::FixedFunctionOpData::uvY_TO_XYZ     },
+        { OCIO::FixedFunctionOpData::XYZ_TO_LUV,     OCIO::FixedFunctionOpData::LUV_TO_XYZ     } };
+
+    for (const auto & fwdInv : styles)
+    {
+        // The forward direction processes the RGB values and the inverse direction processes
+        // the (scalar) forward results.
+        const bool isXYZ = fwdInv[0] == OCIO::FixedFunctionOpData::XYZ_TO_xyY
+                        || fwdInv[0] == OCIO::FixedFunctionOpData::XYZ_TO_uvY
+                        || fwdInv[0] == OCIO::FixedFunctionOpData::XYZ_TO_LUV;
+
+        std::vector<float> input = isXYZ ? xyz : rgb;
+        for (const auto style : fwdInv)
+        {
+            OCIO::ConstFixedFunctionOpDataRcPtr data
+                = std::make_shared<OCIO::FixedFunctionOpData>(style);
+
+            OCIO::ColorModelSIMDApplyFunc * func = getFunc(style);
+            OCIO_REQUIRE_ASSERT(func);
+
+            std::vector<float> expected(input.size());
+            OCIO::ConstOpCPURcPtr op = GetColorModelScalarRenderer(data);
+            op->apply(input.data(), expected.data(), num_samples);
+
+            // Only the cube root of XYZ_TO_LUV is approximated.
+            const float errorThreshold
+                = style == OCIO::FixedFunctionOpData::XYZ_TO_LUV ? 1e-4f : 1e-5f;
+
+            std::vector<float> res(input.size());
+            func(input.data(), res.data(), num_samples);
+
+            for (size_t idx = 0; idx < res.size(); ++idx)
+            {
+                if (std::isnan(expected[idx]))
+                {
+                    OCIO_CHECK_ASSERT(std::isnan(res[idx]));
+                }
+                else if (!OCIO::EqualWithSafeRelError(res[idx], expected[idx], errorThreshold, 1.0f))
+                {
+                    std::ostringstream errorMsg;
+                    errorMsg.precision(14);
+                    errorMsg << "Style: " << OCIO::FixedFunctionOpData::ConvertStyleToString(style, false)
+                             << " - Index: " << idx
+                             << " - Values: " << res[idx] << " expected: " << expected[idx];
+                    OCIO_CHECK_ASSERT_MESSAGE(0, errorMsg.str());
+                }
+            }
+
+            // In-place processing.
+            std::vector<float> img = input;
+            func(img.data(), img.data(), num_samples);
+            OCIO_CHECK_ASSERT(0 == std::memcmp(img.data(), res.data(), res.size() * sizeof(float)));
+
+            input = expected;
+        }
+    }
+}
+
+} // anon.
+
+#if OCIO_USE_SSE2
+OCIO_ADD_TEST(FixedFunctionOpCPU, color_models_sse2)
+{
+    if (!OCIO::CPUInfo::instance().hasSSE2())
+    {
+        throw SkipException();
+    }
+
+    ColorModelCheckSIMD(OCIO::getColorModelFuncSSE2);
+}
+#endif
+
+#if OCIO_USE_AVX2
+OCIO_ADD_TEST(FixedFunctionOpCPU, color_models_avx2)
+{
+    if (!OCIO::CPUInfo::instance().hasAVX2())
+    {
+        throw SkipException();
+    }
+
+    ColorModelCheckSIMD(OCIO::getColorModelFuncAVX2);
+}
+#endif
+
+#if OCIO_USE_AVX512
+OCIO_ADD_TEST(FixedFunctionOpCPU, color_models_avx512)
+{
+    if (!OCIO::CPUInfo::instance().hasAVX512())
+    {
+        throw SkipException();
+    }
+
+    ColorModelCheckSIMD(OCIO::getColorModelFuncAVX512);
+}
+#endif
@@ -5,6 +5,7 @@
 #include "ops/gradinghuecurve/GradingHueCurveOpCPU.cpp"
 
 #include "testutils/UnitTest.h"
+#include "UnitTestSIMDUtils.h"
 #include "utils/StringUtils.h"
 
 namespace OCIO = OCIO_NAMESPACE;
@@ -432,3 +433,124 @@ OCIO_ADD_TEST(GradingHueCurveOpCPU, bypass_rgbtohsy)
     OCIO_CHECK_NO_THROW(op->apply(res, res, num_samples));
     ValidateImage(input_32f, res, num_samples, __LINE__);
 }
+
+namespace
+{
+
+// The inverse of the lin style amplifies the rounding differences (e.g. from the fused
+// multiply-adds) for the large values so use a relative tolerance.
+void ValidateImageSIMD(const float * expected, const float * res, long numPix, unsigned line)
+{
+    static constexpr float error = 1e-4f;
+
+    for (long i = 0; i < 4 * numPix; ++i)
+    {
+        if (expected[i] != res[i])
+        {
+            const float errorFactor = std::max(1.f, std::abs(expected[i]));
+            OCIO_CHECK_CLOSE_FROM(expected[i], res[i], error * errorFactor, line);
+        }
+    }
+}
+
+// Compare the vectorized renderer with the scalar one, using more than one block of pixels.
+template<typename Renderer>
+void GradingHueCurveCheckSIMD(OCIO::ConstGradingHueCurveOpDataRcPtr & gcc,
+                              OCIO::GradingHueCurveSIMDApplyFunc * func,
+                              unsigned line)
+{
+    OCIO::CheckRendererSIMD<Renderer>(gcc, func, 1029, 1.f, ValidateImageSIMD, line);
+}
+
+void GradingHueCurveCheckSIMD(OCIO::GradingHueCurveSIMDApplyFunc * func)
+{
+    auto hh = OCIO::GradingBSplineCurve::Create(
+        { {0.05f, 0.15f}, {0.2f, 0.3f}, {0.35f, 0.4f}, {0.45f, 0.45f}, {0.6f, 0.7f}, {0.8f, 0.85f} },
+        OCIO::HUE_HUE);
+    auto hs = OCIO::GradingBSplineCurve::Create(
+        { {-0.1f, 1.2f}, {0.2f, 0.7f}, {0.4f, 1.5f}, {0.5f, 0.5f}, {0.6f, 1.4f}, {0.8f, 0.7f} },
+        OCIO::HUE_SAT);
+    auto hl = OCIO::GradingBSplineCurve::Create(
+        { {0.1f, 1.5f}, {0.2f, 0.7f}, {0.4f, 1.4f}, {0.5f, 0.8f}, {0.8f, 0.5f} },
+        OCIO::HUE_LUM);
+    auto ls = OCIO::GradingBSplineCurve::Create(
+        { {0.05f, 1.5f}, {0.5f, 0.9f}, {1.1f, 1.4f} },
+        OCIO::LUM_SAT);
+    auto ss = OCIO::GradingBSplineCurve::Create(
+        { {0.f, 0.1f}, {0.5f, 0.45f}, {1.f, 1.1f} },
+        OCIO::SAT_SAT);
+    auto ll = OCIO::GradingBSplineCurve::Create(
+        { {-0.02f, -0.04f}, {0.2f, 0.1f}, {0.8f, 0.95f}, {1.1f, 1.2f} },
+        OCIO::LUM_LUM);
+    auto sl = OCIO::GradingBSplineCurve::Create(
+        { {0.f, 1.2f}, {0.6f, 0.8f}, {0.9f, 1.1f} },
+        OCIO::SAT_LUM);
+    auto hfx = OCIO::GradingBSplineCurve::Create(
+        { {0.2f, 0.05f}, {0.4f, -0.09f}, {0.6f, -0.2f}, { 0.8f, 0.05f}, {0.99f, -0.02f} },
+        OCIO::HUE_FX);
+
+    auto gc = std::make_shared<OCIO::GradingHueCurveOpData>(OCIO::GRADING_LOG,
+        hh, hs, hl, ls, ss, ll, sl, hfx);
+    OCIO::ConstGradingHueCurveOpDataRcPtr gcc = gc;
+
+    GradingHueCurveCheckSIMD<OCIO::GradingHueCurveFwdOpCPU>(gcc, func, __LINE__);
+    gc->setDirection(OCIO::TRANSFORM_DIR_INVERSE);
+    GradingHueCurveCheckSIMD<OCIO::GradingHueCurveRevOpCPU>(gcc, func, __LINE__);
+
+    // Lin style, work in f-stops for the luma curves.
+    ls = OCIO::GradingBSplineCurve::Create(
+        { {-6.f, 0.9f}, {-3.f, 0.8f}, {0.f, 1.2f}, {2.f, 1.f}, {4.f, 0.6f}, {6.f, 0.55f} },
+        OCIO::LUM_SAT);
+    ll = OCIO::GradingBSplineCurve::Create(
+        { {-8.f, -7.f}, {-2.f, -3.f}, {2.f, 3.5f}, {8.f, 7.f} },
+        OCIO::LUM_LUM);
+
+    gc = std::make_shared<OCIO::GradingHueCurveOpData>(OCIO::GRADING_LIN,
+        hh, hs, hl, ls, ss, ll, sl, hfx);
+    gcc = gc;
+
+    GradingHueCurveCheckSIMD<OCIO::GradingHueCurveFwdOpCPU>(gcc, func, __LINE__);
+    gc->setDirection(OCIO::TRANSFORM_DIR_INVERSE);
+    GradingHueCurveCheckSIMD<OCIO::GradingHueCurveRevOpCPU>(gcc, func, __LINE__);
+
+    // Some identity curves.
+    hh = OCIO::GradingBSplineCurve::Create({ {0.f, 0.f}, {0.9f, 0.9f} }, OCIO::HUE_HUE);
+    hl = OCIO::GradingBSplineCurve::Create({ {0.f, 1.f}, {0.9f, 1.f} }, OCIO::HUE_LUM);
+    ls = OCIO::GradingBSplineCurve::Create({ {0.f, 1.f}, {0.9f, 1.f} }, OCIO::LUM_SAT);
+    ll = OCIO::GradingBSplineCurve::Create({ {0.f, 0.f}, {0.9f, 0.9f} }, OCIO::LUM_LUM);
+    hfx = OCIO::GradingBSplineCurve::Create({ {0.f, 0.f}, {0.9f, 0.f} }, OCIO::HUE_FX);
+
+    gc = std::make_shared<OCIO::GradingHueCurveOpData>(OCIO::GRADING_VIDEO,
+        hh, hs, hl, ls, ss, ll, sl, hfx);
+    gcc = gc;
+
+    GradingHueCurveCheckSIMD<OCIO::GradingHueCurveFwdOpCPU>(gcc, func, __LINE__);
+    gc->setDirection(OCIO::TRANSFORM_DIR_INVERSE);
+    GradingHueCurveCheckSIMD<OCIO::GradingHueCurveRevOpCPU>(gcc, func, __LINE__);
+}
+
+} // anon.
+
+#if OCIO_USE_AVX2
+OCIO_ADD_TEST(GradingHueCurveOpCPU, avx2)
+{
+    if (!OCIO::CPUInfo::instance().hasAVX2())
+    {
+        throw SkipException();
+    }
+
+    GradingHueCurveCheckSIMD(OCIO::applyGradingHueCurveAVX2);
+}
+#endif
+
+#if OCIO_USE_AVX512
+OCIO_ADD_TEST(GradingHueCurveOpCPU, avx512)
+{
+    if (!OCIO::CPUInfo::instance().hasAVX512())
+    {
+        throw SkipException();
+    }
+
+    GradingHueCurveCheckSIMD(OCIO::applyGradingHueCurveAVX512);
+}
+#endif
@@ -5,6 +5,7 @@
 #include "ops/gradingprimary/GradingPrimaryOpCPU.cpp"
 
 #include "testutils/UnitTest.h"
+#include "UnitTestSIMDUtils.h"
 #include "utils/StringUtils.h"
 
 namespace OCIO = OCIO_NAMESPACE;
@@ -405,3 +406,107 @@ OCIO_ADD_TEST(GradingPrimaryOpCPU, video)
     OCIO_CHECK_NO_THROW(op->apply(TS3::expected_wbpivot_32f, res, TS3::num_samples));
     ValidateImage(TS3::input_32f, res, TS3::num_samples, __LINE__);
 }
+
+namespace
+{
+
+// Compare the vectorized renderer with the SSE (or scalar) one.
+template<typename Renderer>
+void GradingPrimaryCheckSIMD(OCIO::ConstGradingPrimaryOpDataRcPtr & gpc,
+                             OCIO::GradingPrimarySIMDApplyFunc * func,
+                             unsigned line)
+{
+    OCIO::CheckRendererSIMD<Renderer>(gpc, func, 37, 1.f, ValidateImage, line);
+}
+
+void GradingPrimaryCheckSIMD(OCIO::GradingPrimarySIMDApplyFunc * func)
+{
+    auto gd = std::make_shared<OCIO::GradingPrimaryOpData>(OCIO::GRADING_LOG);
+    OCIO::ConstGradingPrimaryOpDataRcPtr gdc = gd;
+
+    OCIO::GradingPrimary gdp(OCIO::GRADING_LOG);
+    gdp.m_brightness = TS1::brightness;
+    gdp.m_contrast   = TS1::contrast;
+    gdp.m_gamma      = TS1::gamma;
+    gdp.m_pivot      = TS1::pivot;
+    gdp.m_saturation = TS1::saturation;
+    gdp.m_clampBlack = TS1::clampBlack;
+    gdp.m_clampWhite = TS1::clampWhite;
+    gdp.m_pivotBlack = TS1::pivotBlack;
+    gdp.m_pivotWhite = TS1::pivotWhite;
+    gd->setValue(gdp);
+
+    GradingPrimaryCheckSIMD<OCIO::GradingPrimaryLogFwdOpCPU>(gdc, func, __LINE__);
+    gd->setDirection(OCIO::TRANSFORM_DIR_INVERSE);
+    GradingPrimaryCheckSIMD<OCIO::GradingPrimaryLogRevOpCPU>(gdc, func, __LINE__);
+
+    // Identity gamma & saturation.
+    gdp.m_gamma = OCIO::GradingRGBM(1., 1., 1., 1.);
+    gdp.m_saturation = 1.;
+    gd->setValue(gdp);
+    GradingPrimaryCheckSIMD<OCIO::GradingPrimaryLogRevOpCPU>(gdc, func, __LINE__);
+    gd->setDirection(OCIO::TRANSFORM_DIR_FORWARD);
+    GradingPrimaryCheckSIMD<OCIO::GradingPrimaryLogFwdOpCPU>(gdc, func, __LINE__);
+
+    gd = std::make_shared<OCIO::GradingPrimaryOpData>(OCIO::GRADING_LIN);
+    gdc = gd;
+
+    gdp = OCIO::GradingPrimary(OCIO::GRADING_LIN);
+    gdp.m_exposure   = TS2::exposure;
+    gdp.m_offset     = TS2::offset;
+    gdp.m_contrast   = TS2::contrast;
+    gdp.m_pivot      = TS2::pivot;
+    gdp.m_saturation = TS2::saturation;
+    gdp.m_clampBlack = TS2::clampBlack;
+    gdp.m_clampWhite = TS2::clampWhite;
+    gd->setValue(gdp);
+
+    GradingPrimaryCheckSIMD<OCIO::GradingPrimaryLinFwdOpCPU>(gdc, func, __LINE__);
+    gd->setDirection(OCIO::TRANSFORM_DIR_INVERSE);
+    GradingPrimaryCheckSIMD<OCIO::GradingPrimaryLinRevOpCPU>(gdc, func, __LINE__);
+
+    gd = std::make_shared<OCIO::GradingPrimaryOpData>(OCIO::GRADING_VIDEO);
+    gdc = gd;
+
+    gdp = OCIO::GradingPrimary(OCIO::GRADING_VIDEO);
+    gdp.m_lift       = TS3::lift;
+    gdp.m_gamma      = TS3::gamma;
+    gdp.m_gain       = TS3::gain;
+    gdp.m_offset     = TS3::offset;
+    gdp.m_saturation = TS3::saturation;
+    gdp.m_clampBlack = TS3::clampBlack;
+    gdp.m_clampWhite = TS3::clampWhite;
+    gdp.m_pivotBlack = TS3::pivotBlack;
+    gdp.m_pivotWhite = TS3::pivotWhite;
+    gd->setValue(gdp);
+
+    GradingPrimaryCheckSIMD<OCIO::GradingPrimaryVidFwdOpCPU>(gdc, func, __LINE__);
+    gd->setDirection(OCIO::TRANSFORM_DIR_INVERSE);
+    GradingPrimaryCheckSIMD<OCIO::GradingPrimaryVidRevOpCPU>(gdc, func, __LINE__);
+}
+
+} // anon.
+
+#if OCIO_USE_AVX2
+OCIO_ADD_TEST(GradingPrimaryOpCPU, avx2)
+{
+    if (!OCIO::CPUInfo::instance().hasAVX2())
+    {
+        throw SkipException();
+    }
+
+    GradingPrimaryCheckSIMD(OCIO::applyGradingPrimaryAVX2);
+}
+#endif
+
+#if OCIO_USE_AVX512
+OCIO_ADD_TEST(GradingPrimaryOpCPU, avx512)
+{
+    if (!OCIO::CPUInfo::instance().hasAVX512())
+    {
+        throw SkipException();
+    }
+
+    GradingPrimaryCheckSIMD(OCIO::applyGradingPrimaryAVX512);
+}
+#endif
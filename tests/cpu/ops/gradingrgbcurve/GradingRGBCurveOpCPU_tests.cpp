@@ -5,6 +5,7 @@
 #include "ops/gradingrgbcurve/GradingRGBCurveOpCPU.cpp"
 
 #include "testutils/UnitTest.h"
+#include "UnitTestSIMDUtils.h"
 #include "utils/StringUtils.h"
 
 namespace OCIO = OCIO_NAMESPACE;
@@ -440,3 +441,99 @@ OCIO_ADD_TEST(GradingRGBCurveOpCPU, slopes)
     OCIO_CHECK_NO_THROW(op->apply(rev_input_32f, rev_input_32f, num_samples));
     ValidateImage(rev_expected_32f, rev_input_32f, num_samples, __LINE__);
 }
+
+namespace
+{
+
+// Compare the vectorized renderer with the SSE (or scalar) one.
+template<typename Renderer>
+void GradingRGBCurveCheckSIMD(OCIO::ConstGradingRGBCurveOpDataRcPtr & gcc,
+                              OCIO::GradingRGBCurveSIMDApplyFunc * func,
+                              float scale,
+                              unsigned line)
+{
+    OCIO::CheckRendererSIMD<Renderer>(gcc, func, 37, scale, ValidateImage, line);
+}
+
+void GradingRGBCurveCheckSIMD(OCIO::GradingRGBCurveSIMDApplyFunc * func)
+{
+    OCIO::ConstGradingBSplineCurveRcPtr r = OCIO::GradingBSplineCurve::Create(
+        { { 0.1f, 0.15f }, { 0.55f, 0.45f }, { 0.9f, 1.1f } });
+    OCIO::ConstGradingBSplineCurveRcPtr g = OCIO::GradingBSplineCurve::Create(
+        { { 0.1f, 0.15f }, { 0.55f, 0.35f }, { 0.9f, 1.1f } });
+    OCIO::ConstGradingBSplineCurveRcPtr b = OCIO::GradingBSplineCurve::Create(
+        { { 0.1f, 0.15f }, { 0.55f, 0.85f }, { 0.9f, 1.1f } });
+    OCIO::ConstGradingBSplineCurveRcPtr m = OCIO::GradingBSplineCurve::Create(
+        { { -0.1f, 0.1f }, { 1.1f, 1.3f } });
+
+    auto gc = std::make_shared<OCIO::GradingRGBCurveOpData>(OCIO::GRADING_LOG, r, g, b, m);
+    OCIO::ConstGradingRGBCurveOpDataRcPtr gcc = gc;
+
+    GradingRGBCurveCheckSIMD<OCIO::GradingRGBCurveFwdOpCPU>(gcc, func, 1.f, __LINE__);
+    gc->setDirection(OCIO::TRANSFORM_DIR_INVERSE);
+    GradingRGBCurveCheckSIMD<OCIO::GradingRGBCurveRevOpCPU>(gcc, func, 1.f, __LINE__);
+
+    // Lin style with an identity master curve.
+    r = OCIO::GradingBSplineCurve::Create(
+        { { -6.f, -8.f }, { -2.f, -5.f }, {  2.f,  4.f }, {  5.f,  6.f } });
+    m = OCIO::GradingBSplineCurve::Create({ { 0.f, 0.f }, { 0.5f, 0.5f }, { 1.f, 1.f } });
+
+    gc = std::make_shared<OCIO::GradingRGBCurveOpData>(OCIO::GRADING_LIN, r, r, r, m);
+    gcc = gc;
+
+    GradingRGBCurveCheckSIMD<OCIO::GradingRGBCurveLinearFwdOpCPU>(gcc, func, 1.f, __LINE__);
+    gc->setDirection(OCIO::TRANSFORM_DIR_INVERSE);
+    GradingRGBCurveCheckSIMD<OCIO::GradingRGBCurveLinearRevOpCPU>(gcc, func, 1.f, __LINE__);
+
+    // Flat extrapolation slopes.
+    auto curve = OCIO::GradingBSplineCurve::Create({
+            {-5.26017743f, -4.f},
+            {-3.75502745f, -3.57868829f},
+            {-2.24987747f, -1.82131329f},
+            {-0.74472749f,  0.68124124f},
+            { 1.06145248f,  2.87457742f},
+            { 2.86763245f,  3.83406206f},
+            { 4.67381243f,  4.f}
+        });
+    const float slopes[] = { 0.f,  0.55982688f,  1.77532247f,  1.55f,  0.8787017f,  0.18374463f,  0.f };
+    for (size_t i = 0; i < 7; ++i)
+    {
+        curve->setSlope(i, slopes[i]);
+    }
+    m = curve;
+    OCIO::ConstGradingBSplineCurveRcPtr z = OCIO::GradingBSplineCurve::Create(
+        { { 0.f, 0.f }, { 1.f, 1.f } });
+
+    gc = std::make_shared<OCIO::GradingRGBCurveOpData>(OCIO::GRADING_LOG, z, z, z, m);
+    gcc = gc;
+
+    GradingRGBCurveCheckSIMD<OCIO::GradingRGBCurveFwdOpCPU>(gcc, func, 6.f, __LINE__);
+    gc->setDirection(OCIO::TRANSFORM_DIR_INVERSE);
+    GradingRGBCurveCheckSIMD<OCIO::GradingRGBCurveRevOpCPU>(gcc, func, 4.f, __LINE__);
+}
+
+} // anon.
+
+#if OCIO_USE_AVX2
+OCIO_ADD_TEST(GradingRGBCurveOpCPU, avx2)
+{
+    if (!OCIO::CPUInfo::instance().hasAVX2())
+    {
+        throw SkipException();
+    }
+
+    GradingRGBCurveCheckSIMD(OCIO::applyGradingRGBCurveAVX2);
+}
+#endif
+
+#if OCIO_USE_AVX512
+OCIO_ADD_TEST(GradingRGBCurveOpCPU, avx512)
+{
+    if (!OCIO::CPUInfo::instance().hasAVX512())
+    {
+        throw SkipException();
+    }
+
+    GradingRGBCurveCheckSIMD(OCIO::applyGradingRGBCurveAVX512);
+}
+#endif
@@ -6,6 +6,7 @@
 #include "ops/gradingtone/GradingToneOpCPU.cpp"
 
 #include "testutils/UnitTest.h"
+#include "UnitTestSIMDUtils.h"
 #include "utils/StringUtils.h"
 
 namespace OCIO = OCIO_NAMESPACE;
@@ -503,3 +504,91 @@ OCIO_ADD_TEST(GradingToneOpCPU, lin_midtones)
     OCIO_CHECK_NO_THROW(op->apply(TS7::expected_32f, res, TS7::num_samples));
     ValidateImage(TS7::input_32f, res, TS7::num_samples, __LINE__);
 }
+
+namespace
+{
+
+// Compare the vectorized renderer with the SSE (or scalar) one.
+template<typename Renderer>
+void GradingToneCheckSIMD(OCIO::ConstGradingToneOpDataRcPtr & gtc,
+                          OCIO::GradingToneSIMDApplyFunc * func,
+                          unsigned line)
+{
+    OCIO::CheckRendererSIMD<Renderer>(gtc, func, 37, 1.f, ValidateImage, line);
+}
+
+void GradingToneCheckSIMD(OCIO::GradingToneSIMDApplyFunc * func)
+{
+    // Both sides of the identity for each control.
+    const OCIO::GradingTone lowValues = []()
+    {
+        OCIO::GradingTone gtd(OCIO::GRADING_LOG);
+        gtd.m_blacks     = OCIO::GradingRGBMSW(0.8, 1.2, 0.9, 0.7, 0.1, 0.2);
+        gtd.m_shadows    = OCIO::GradingRGBMSW(0.6, 1.3, 1.0, 0.8, 0.6, 0.1);
+        gtd.m_midtones   = OCIO::GradingRGBMSW(0.3, 1.0, 1.8, 1.2, 0.47, 0.6);
+        gtd.m_highlights = OCIO::GradingRGBMSW(1.4, 0.7, 1.0, 1.2, 0.2, 0.9);
+        gtd.m_whites     = OCIO::GradingRGBMSW(0.7, 1.3, 1.0, 0.8, 0.4, 0.5);
+        gtd.m_scontrast  = 0.7;
+        return gtd;
+    }();
+
+    OCIO::GradingTone highValues{ lowValues };
+    highValues.m_blacks     = OCIO::GradingRGBMSW(1.3, 0.6, 1.0, 1.4, 0.1, 0.2);
+    highValues.m_shadows    = OCIO::GradingRGBMSW(1.5, 0.7, 0.8, 1.2, 0.6, 0.1);
+    highValues.m_highlights = OCIO::GradingRGBMSW(0.8, 1.3, 1.2, 0.7, 0.2, 0.9);
+    highValues.m_whites     = OCIO::GradingRGBMSW(1.3, 0.8, 0.6, 1.4, 0.4, 0.5);
+    highValues.m_scontrast  = 1.4;
+
+    for (const auto & values : { lowValues, highValues })
+    {
+        auto gt = std::make_shared<OCIO::GradingToneOpData>(OCIO::GRADING_LOG);
+        OCIO::ConstGradingToneOpDataRcPtr gtc = gt;
+
+        gt->setValue(values);
+        GradingToneCheckSIMD<OCIO::GradingToneFwdOpCPU>(gtc, func, __LINE__);
+        gt->setDirection(OCIO::TRANSFORM_DIR_INVERSE);
+        GradingToneCheckSIMD<OCIO::GradingToneRevOpCPU>(gtc, func, __LINE__);
+
+        gt = std::make_shared<OCIO::GradingToneOpData>(OCIO::GRADING_LIN);
+        gtc = gt;
+
+        OCIO::GradingTone linValues(OCIO::GRADING_LIN);
+        linValues.m_blacks     = values.m_blacks;
+        linValues.m_shadows    = values.m_shadows;
+        linValues.m_midtones   = values.m_midtones;
+        linValues.m_highlights = values.m_highlights;
+        linValues.m_whites     = values.m_whites;
+        linValues.m_scontrast  = values.m_scontrast;
+
+        gt->setValue(linValues);
+        GradingToneCheckSIMD<OCIO::GradingToneLinearFwdOpCPU>(gtc, func, __LINE__);
+        gt->setDirection(OCIO::TRANSFORM_DIR_INVERSE);
+        GradingToneCheckSIMD<OCIO::GradingToneLinearRevOpCPU>(gtc, func, __LINE__);
+    }
+}
+
+} // anon.
+
+#if OCIO_USE_AVX2
+OCIO_ADD_TEST(GradingToneOpCPU, avx2)
+{
+    if (!OCIO::CPUInfo::instance().hasAVX2())
+    {
+        throw SkipException();
+    }
+
+    GradingToneCheckSIMD(OCIO::applyGradingToneAVX2);
+}
+#endif
+
+#if OCIO_USE_AVX512
+OCIO_ADD_TEST(GradingToneOpCPU, avx512)
+{
+    if (!OCIO::CPUInfo::instance().hasAVX512())
+    {
+        throw SkipException();
+    }
+
+    GradingToneCheckSIMD(OCIO::applyGradingToneAVX512);
+}
+#endif
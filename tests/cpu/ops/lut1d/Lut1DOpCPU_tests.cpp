@@ -129,7 +129,7 @@ OCIO_ADD_TEST(Lut1DRenderer, nan_test)
 {
     OCIO::Lut1DOpDataRcPtr lut = std::make_shared<OCIO::Lut1DOpData>(8);
 
-    float * values = &lut->getArray().getValues()[0];
+    float * values = lut->getArray().getValues().mutableData();
 
     values[0]  = 0.0f;      values[1]  = 0.0f;      values[2]  = 0.002333f;
     values[3]  = 0.0f;      values[4]  = 0.291341f; values[5]  = 0.015624f;
@@ -177,7 +177,7 @@ OCIO_ADD_TEST(Lut1DRenderer, nan_half_test)
     OCIO::Lut1DOpDataRcPtr lut = std::make_shared<OCIO::Lut1DOpData>(
         OCIO::Lut1DOpData::LUT_INPUT_HALF_CODE, 65536, false);
 
-    float * values = &lut->getArray().getValues()[0];
+    float * values = lut->getArray().getValues().mutableData();
 
     // Changed values for nan input.
     constexpr int nanIdRed = 32256 * 3;
@@ -827,7 +827,7 @@ OCIO_ADD_TEST(Lut1DRenderer, basic)
     // No more an 'identity LUT 1D'.
     const float arbitraryVal = 0.123456f;
 
-    lutData->getArray()[5] = arbitraryVal;
+    lutData->getArray().getValues().mutableData()[5] = arbitraryVal;
 
     OCIO_CHECK_NO_THROW(lutData->validate());
     OCIO_CHECK_NO_THROW(lutData->finalize());
@@ -861,7 +861,7 @@ OCIO_ADD_TEST(Lut1DRenderer, half)
 
     // No more an 'identity LUT 1D'.
     constexpr float arbitraryVal = 0.123456f;
-    lutData->getArray()[5] = arbitraryVal;
+    lutData->getArray().getValues().mutableData()[5] = arbitraryVal;
     OCIO_CHECK_ASSERT(!lutData->isIdentity());
 
     const half inImg[8] = {
@@ -1831,7 +1831,7 @@ OCIO_ADD_TEST(Lut1DRenderer, lut_1d_inv_increasing)
 
     // This is a typical "easy" lut with a simple power function.
     // Linear to 1/2.2 gamma corrected code values.
-    OCIO::Array::Values & vals = lutData->getArray().getValues();
+    float * vals = lutData->getArray().getValues().mutableData();
     int i = 0;
     vals[i] = vals[i+1] = vals[i+2] =    0.f / 1023.f;
     i += 3;
@@ -1959,7 +1959,7 @@ OCIO_ADD_TEST(Lut1DRenderer, lut_1d_inv_decreasing_reversals)
 
     // This is a more "difficult" LUT that is decreasing and has reversals
     // and values outside the typical range.
-    OCIO::Array::Values & vals = lutData->getArray().getValues();
+    float * vals = lutData->getArray().getValues().mutableData();
     int i = 0;
     vals[i] = vals[i+1] = vals[i+2] =  90.f / 255.f;
     i += 3;
@@ -2060,7 +2060,7 @@ OCIO_ADD_TEST(Lut1DRenderer, lut_1d_inv_clamp_to_range)
     // Note that the start and end values do not span the full [0,255] range
     // so we test that input values are clamped correctly to this range when
     // the LUT has no flat spots at start or end.
-    OCIO::Array::Values & vals = lutData->getArray().getValues();
+    float * vals = lutData->getArray().getValues().mutableData();
     int i = 0;
     vals[i] = vals[i+1] = vals[i+2] =  30.f / 255.f;
     i += 3;
@@ -2250,9 +2250,9 @@ OCIO_ADD_TEST(Lut1DRenderer, lut_1d_inv_half_input)
     lutData->getArray().resize(dim, 1);
     for (unsigned i = 0; i < dim; ++i)
     {
-        lutData->getArray()[i * 3 + 0] = lutEntries[i];
-        lutData->getArray()[i * 3 + 1] = lutEntries[i];
-        lutData->getArray()[i * 3 + 2] = lutEntries[i];
+        lutData->getArray().getValues().mutableData()[i * 3 + 0] = lutEntries[i];
+        lutData->getArray().getValues().mutableData()[i * 3 + 1] = lutEntries[i];
+        lutData->getArray().getValues().mutableData()[i * 3 + 2] = lutEntries[i];
     }
 
     auto invLut = lutData->inverse();
@@ -2638,3 +2638,159 @@ OCIO_ADD_TEST(Lut1DRenderer, lut_1d_inv_half_domain_hue_adjust)
     }
 }
 
+
+namespace
+{
+
+// Renderer using the given vectorized inverse evaluation (or the scalar one for nullptr).
+template<typename Renderer>
+class InvLut1DRendererSIMD : public Renderer
+{
+public:
+    InvLut1DRendererSIMD(OCIO::ConstLut1DOpDataRcPtr & lut, OCIO::InvLut1DOpCPUApplyFunc * applyFunc)
+        : Renderer(lut)
+    {
+        this->m_applyInvLutFunc = applyFunc;
+    }
+};
+
+template<typename Renderer>
+void InvLut1DCheckSIMD(OCIO::ConstLut1DOpDataRcPtr & invLut,
+                       const std::vector<float> & inImg,
+                       OCIO::InvLut1DOpCPUApplyFunc * applyFunc,
+                       int tolerance)
+{
+    const long numPixels = (long)inImg.size() / 4;
+
+    const InvLut1DRendererSIMD<Renderer> refRenderer(invLut, nullptr);
+    std::vector<float> refImg(inImg.size());
+    refRenderer.apply(inImg.data(), refImg.data(), numPixels);
+
+    const InvLut1DRendererSIMD<Renderer> renderer(invLut, applyFunc);
+    std::vector<float> outImg(inImg.size());
+    renderer.apply(inImg.data(), outImg.data(), numPixels);
+
+    for (size_t idx = 0; idx < outImg.size(); ++idx)
+    {
+        OCIO_CHECK_ASSERT_MESSAGE(!OCIO::FloatsDiffer(refImg[idx], outImg[idx], tolerance, false),
+                                  GetErrorMessage(refImg[idx], outImg[idx]));
+    }
+}
+
+void InvLut1DCheckSIMD(OCIO::InvLut1DOpCPUApplyFunc * applyFunc)
+{
+    const float qnan = std::numeric_limits<float>::quiet_NaN();
+    const float inf = std::numeric_limits<float>::infinity();
+
+    // Include values outside of the LUT range & special values, and a pixel count which is
+    // not a multiple of the vector sizes.
+    constexpr long numPixels = 123;
+    std::vector<float> inImg(numPixels * 4);
+
+    // Increasing red with flat spots at both ends, decreasing green and a blue with a
+    // flat spot in the middle.
+    {
+        constexpr unsigned long dim = 1000;
+        OCIO::Lut1DOpDataRcPtr lutData = std::make_shared<OCIO::Lut1DOpData>(dim);
+
+        float * vals = lutData->getArray().getValues().mutableData();
+        for (unsigned long i = 0; i < dim; ++i)
+        {
+            const float x = float(i) / float(dim - 1);
+            vals[i * 3 + 0] = std::min(std::max(std::pow(x, 1.5f), 0.1f), 0.8f);
+            vals[i * 3 + 1] = 1.f - std::pow(x, 0.5f);
+            vals[i * 3 + 2] = (x > 0.4f && x < 0.6f) ? 0.5f : x;
+        }
+
+        OCIO::ConstLut1DOpDataRcPtr invLut = lutData->inverse();
+
+        for (long idx = 0; idx < numPixels; ++idx)
+        {
+            inImg[4 * idx + 0] = float((idx * 37) % 101) / 90.f - 0.05f;
+            inImg[4 * idx + 1] = float((idx * 53) % 103) / 100.f;
+            inImg[4 * idx + 2] = float((idx * 71) % 107) / 100.f - 0.02f;
+            inImg[4 * idx + 3] = float(idx);
+        }
+        inImg[4] = qnan;
+        inImg[9] = inf;
+        inImg[14] = -inf;
+
+        InvLut1DCheckSIMD<OCIO::InvLut1DRenderer<OCIO::BIT_DEPTH_F32, OCIO::BIT_DEPTH_F32>>(
+            invLut, inImg, applyFunc, 0);
+    }
+
+    // Half domain LUT.
+    {
+        OCIO::Lut1DOpDataRcPtr lutData
+            = std::make_shared<OCIO::Lut1DOpData>(OCIO::Lut1DOpData::LUT_INPUT_HALF_CODE,
+                                                  65536, false);
+
+        float * vals = lutData->getArray().getValues().mutableData();
+        for (unsigned i = 0; i < 65536; ++i)
+        {
+            half h;
+            h.setBits((unsigned short)i);
+            const float x = std::isfinite((float)h) ? (float)h : 0.f;
+
+            vals[i * 3 + 0] = x / (1.f + std::fabs(x));
+            vals[i * 3 + 1] = -0.5f * x;
+            vals[i * 3 + 2] = x > 0.f ? std::log2(1.f + x) : x;
+        }
+
+        OCIO::ConstLut1DOpDataRcPtr invLut = lutData->inverse();
+
+        for (long idx = 0; idx < numPixels; ++idx)
+        {
+            inImg[4 * idx + 0] = float((idx * 37) % 101) / 50.f - 1.f;
+            inImg[4 * idx + 1] = float((idx * 53) % 103) * 100.f - 5000.f;
+            inImg[4 * idx + 2] = float((idx * 71) % 107) / 10.f - 2.f;
+            inImg[4 * idx + 3] = float(idx);
+        }
+        inImg[4] = qnan;
+        inImg[9] = inf;
+        inImg[14] = -inf;
+        inImg[16] = -0.f;
+
+        // The interpolation of the half domain values could use a fused multiply-add.
+        InvLut1DCheckSIMD<OCIO::InvLut1DRendererHalfCode<OCIO::BIT_DEPTH_F32, OCIO::BIT_DEPTH_F32>>(
+            invLut, inImg, applyFunc, 1);
+    }
+}
+
+} // anon.
+
+#if OCIO_USE_SSE2
+OCIO_ADD_TEST(Lut1DRenderer, lut_1d_inv_sse2)
+{
+    if (!OCIO::CPUInfo::instance().hasSSE2())
+    {
+        throw SkipException();
+    }
+
+    InvLut1DCheckSIMD(OCIO::applyInvLut1DSSE2);
+}
+#endif
+
+#if OCIO_USE_AVX2
+OCIO_ADD_TEST(Lut1DRenderer, lut_1d_inv_avx2)
+{
+    if (!OCIO::CPUInfo::instance().hasAVX2())
+    {
+        throw SkipException();
+    }
+
+    InvLut1DCheckSIMD(OCIO::applyInvLut1DAVX2);
+}
+#endif
+
+#if OCIO_USE_AVX512
+OCIO_ADD_TEST(Lut1DRenderer, lut_1d_inv_avx512)
+{
+    if (!OCIO::CPUInfo::instance().hasAVX512())
+    {
+        throw SkipException();
+    }
+
+    InvLut1DCheckSIMD(OCIO::applyInvLut1DAVX512);
+}
+#endif
@@ -55,7 +55,7 @@ OCIO_ADD_TEST(Lut1DOpData, accessors)
 
     // Restore the number of components
     l.getArray().setNumColorComponents(3);
-    l.getArray()[1] = 1.0f;
+    l.getArray().getValues().mutableData()[1] = 1.0f;
     OCIO_CHECK_ASSERT(!l.isNoOp());
     OCIO_CHECK_ASSERT(!l.isIdentity());
     OCIO_CHECK_NO_THROW(l.validate());
@@ -81,7 +81,7 @@ OCIO_ADD_TEST(Lut1DOpData, accessors)
     OCIO_CHECK_EQUAL(l.getArray().getNumColorComponents(), 3);
 
     // Restore value.
-    l.getArray()[1] = 0.0f;
+    l.getArray().getValues().mutableData()[1] = 0.0f;
 
     OCIO_CHECK_NO_THROW(l.finalize());
     // Finalize sets numColorComponents to 1 if the three channels are equal.
@@ -94,14 +94,14 @@ OCIO_ADD_TEST(Lut1DOpData, accessors)
     // Reset number of components.
     l.getArray().setNumColorComponents(3);
 
-    l.getArray()[0] = std::numeric_limits<float>::quiet_NaN();
-    l.getArray()[1] = std::numeric_limits<float>::quiet_NaN();
-    l.getArray()[2] = 0;
+    l.getArray().getValues().mutableData()[0] = std::numeric_limits<float>::quiet_NaN();
+    l.getArray().getValues().mutableData()[1] = std::numeric_limits<float>::quiet_NaN();
+    l.getArray().getValues().mutableData()[2] = 0;
 
     OCIO_CHECK_NO_THROW(l.finalize());
     OCIO_CHECK_EQUAL(l.getArray().getNumColorComponents(), 3);
 
-    l.getArray()[2] = std::numeric_limits<float>::quiet_NaN();
+    l.getArray().getValues().mutableData()[2] = std::numeric_limits<float>::quiet_NaN();
     OCIO_CHECK_NO_THROW(l.finalize());
     OCIO_CHECK_EQUAL(l.getArray().getNumColorComponents(), 1);
 }
@@ -117,16 +117,16 @@ OCIO_ADD_TEST(Lut1DOpData, is_identity)
     const float first = l1.getArray()[0];
     const float last = l1.getArray()[lastId];
 
-    l1.getArray()[0] = first + 0.9e-5f;
-    l1.getArray()[lastId] = last + 0.9e-5f;
+    l1.getArray().getValues().mutableData()[0] = first + 0.9e-5f;
+    l1.getArray().getValues().mutableData()[lastId] = last + 0.9e-5f;
     OCIO_CHECK_ASSERT(l1.isIdentity());
 
-    l1.getArray()[0] = first + 1.1e-5f;
-    l1.getArray()[lastId] = last;
+    l1.getArray().getValues().mutableData()[0] = first + 1.1e-5f;
+    l1.getArray().getValues().mutableData()[lastId] = last;
     OCIO_CHECK_ASSERT(!l1.isIdentity());
 
-    l1.getArray()[0] = first;
-    l1.getArray()[lastId] = last + 1.1e-5f;
+    l1.getArray().getValues().mutableData()[0] = first;
+    l1.getArray().getValues().mutableData()[lastId] = last + 1.1e-5f;
     OCIO_CHECK_ASSERT(!l1.isIdentity());
 
     OCIO::Lut1DOpData l2(OCIO::Lut1DOpData::LUT_INPUT_HALF_CODE, 65536, false);
@@ -142,18 +142,18 @@ OCIO_ADD_TEST(Lut1DOpData, is_identity)
 
     OCIO_CHECK_ASSERT(l2.isIdentity());
 
-    l2.getArray()[0] = first2 + ERROR_0;
-    l2.getArray()[id2] = last2 + ERROR_31700;
+    l2.getArray().getValues().mutableData()[0] = first2 + ERROR_0;
+    l2.getArray().getValues().mutableData()[id2] = last2 + ERROR_31700;
 
     OCIO_CHECK_ASSERT(l2.isIdentity());
 
-    l2.getArray()[0] = first2 + 2 * ERROR_0;
-    l2.getArray()[id2] = last2;
+    l2.getArray().getValues().mutableData()[0] = first2 + 2 * ERROR_0;
+    l2.getArray().getValues().mutableData()[id2] = last2;
 
     OCIO_CHECK_ASSERT(!l2.isIdentity());
 
-    l2.getArray()[0] = first2;
-    l2.getArray()[id2] = last2 + 2 * ERROR_31700;
+    l2.getArray().getValues().mutableData()[0] = first2;
+    l2.getArray().getValues().mutableData()[id2] = last2 + 2 * ERROR_31700;
 
     OCIO_CHECK_ASSERT(!l2.isIdentity());
 }
@@ -161,7 +161,7 @@ OCIO_ADD_TEST(Lut1DOpData, is_identity)
 OCIO_ADD_TEST(Lut1DOpData, clone)
 {
     OCIO::Lut1DOpData ref(20);
-    ref.getArray()[1] = 0.5f;
+    ref.getArray().getValues().mutableData()[1] = 0.5f;
     ref.setHueAdjust(OCIO::HUE_DW3);
 
     OCIO::Lut1DOpDataRcPtr pClone = ref.clone();
@@ -231,7 +231,7 @@ OCIO_ADD_TEST(Lut1DOpData, channel)
     OCIO_CHECK_ASSERT(!L2->mayCompose(L1C));
 
     L1->setHueAdjust(OCIO::HUE_NONE);
-    L1->getArray()[1] = 3.0f;
+    L1->getArray().getValues().mutableData()[1] = 3.0f;
     // False: non-identity.
     OCIO_CHECK_ASSERT(!L1->hasChannelCrosstalk());
 
@@ -290,7 +290,7 @@ OCIO_ADD_TEST(Lut1DOpData, lut_1d_compose)
     lut1->getFormatMetadata().addAttribute(OCIO::METADATA_ID, "lut1");
     lut1->getFormatMetadata().addChildElement(OCIO::METADATA_DESCRIPTION, "description of 'lut1'");
     lut1->getArray().resize(8, 3);
-    float * values = &lut1->getArray().getValues()[0];
+    float * values = lut1->getArray().getValues().mutableData();
 
     values[0]  = 0.0f;      values[1]  = 0.0f;      values[2]  = 0.002333f;
     values[3]  = 0.0f;      values[4]  = 0.291341f; values[5]  = 0.015624f;
@@ -306,7 +306,7 @@ OCIO_ADD_TEST(Lut1DOpData, lut_1d_compose)
     lut2->getFormatMetadata().addAttribute(OCIO::METADATA_ID, "lut2");
     lut2->getFormatMetadata().addChildElement(OCIO::METADATA_DESCRIPTION, "description of 'lut2'");
     lut2->getArray().resize(8, 3);
-    values = &lut2->getArray().getValues()[0];
+    values = lut2->getArray().getValues().mutableData();
 
     values[0]  = 0.0f;        values[1]  = 0.0f;       values[2]  = 0.0023303f;
     values[3]  = 0.0f;        values[4]  = 0.0029134f; values[5]  = 0.015624f;
@@ -336,7 +336,7 @@ OCIO_ADD_TEST(Lut1DOpData, lut_1d_compose)
         OCIO_CHECK_EQUAL(std::string(desc2.getElementName()), OCIO::METADATA_DESCRIPTION);
         OCIO_CHECK_EQUAL(std::string(desc2.getElementValue()), "description of 'lut2'");
 
-        values = &result->getArray().getValues()[0];
+        values = result->getArray().getValues().mutableData();
 
         OCIO_CHECK_EQUAL(result->getArray().getLength(), 8);
 
@@ -374,7 +374,7 @@ OCIO_ADD_TEST(Lut1DOpData, lut_1d_compose)
         OCIO_CHECK_NO_THROW(result =
             OCIO::Lut1DOpData::Compose(lut1C, lut2C, OCIO::Lut1DOpData::COMPOSE_RESAMPLE_BIG));
 
-        values = &result->getArray().getValues()[0];
+        values = result->getArray().getValues().mutableData();
 
         OCIO_CHECK_EQUAL(result->getArray().getLength(), 65536);
 
@@ -421,7 +421,7 @@ OCIO_ADD_TEST(Lut1DOpData, lut_1d_compose_sc)
     OCIO::Lut1DOpDataRcPtr lut1 = std::make_shared<OCIO::Lut1DOpData>(2);
 
     lut1->getArray().resize(2, 3);
-    float * values = &lut1->getArray().getValues()[0];
+    float * values = lut1->getArray().getValues().mutableData();
     values[0] = 64.f;  values[1] = 64.f;   values[2] = 64.f;
     values[3] = 196.f; values[4] = 196.f;  values[5] = 196.f;
     lut1->scale(1.0f / 255.0f);
@@ -429,7 +429,7 @@ OCIO_ADD_TEST(Lut1DOpData, lut_1d_compose_sc)
     OCIO::Lut1DOpDataRcPtr lut2 = std::make_shared<OCIO::Lut1DOpData>(2);
 
     lut2->getArray().resize(32, 3);
-    values = &lut2->getArray().getValues()[0];
+    values = lut2->getArray().getValues().mutableData();
 
     values[0] = 0.0000000f;   values[1] = 0.0000000f;  values[2] = 0.0023303f;
     values[3] = 0.0000000f;   values[4] = 0.0001869f;  values[5] = 0.0052544f;
@@ -524,9 +524,7 @@ OCIO_ADD_TEST(Lut1DOpData, is_inverse)
     L1->getFormatMetadata().addAttribute(OCIO::METADATA_ID, uid);
 
     // Make it not an identity.
-    OCIO::Array & array = L1->getArray();
-    OCIO::Array::Values & values = array.getValues();
-    values[0] = 20.f;
+    L1->getArray().getValues().mutableData()[0] = 20.f;
     OCIO_CHECK_ASSERT(!L1->isIdentity());
 
     // Create an inverse LUT with same basics.
@@ -554,10 +552,10 @@ void SetLutArray(OCIO::Lut1DOpData & op,
     // not dimension * channels.
 
     const unsigned long maxChannels = refArray.getMaxColorComponents();
-    OCIO::Array::Values & values = refArray.getValues();
+    float * values = refArray.getValues().mutableData();
     if (channels == maxChannels)
     {
-        memcpy(&(values[0]), data, dimension * channels * sizeof(float));
+        memcpy(values, data, dimension * channels * sizeof(float));
     }
     else
     {
@@ -752,7 +750,7 @@ void SetLutArrayHalf(const OCIO::Lut1DOpDataRcPtr & op, unsigned long channels)
     // not dimension * channels.
 
     const unsigned long maxChannels = refArray.getMaxColorComponents();
-    OCIO::Array::Values & values = refArray.getValues();
+    float * values = refArray.getValues().mutableData();
     for (unsigned long j = 0u; j < channels; j++)
     {
         for (unsigned long i = 0u; i < 65536u; i++)
@@ -973,10 +971,11 @@ OCIO_ADD_TEST(Lut1DOpData, compose_inverse_luts)
     OCIO::ConstLut1DOpDataRcPtr lutRef = std::make_shared<OCIO::Lut1DOpData>(17);
     OCIO::Lut1DOpDataRcPtr lut = std::make_shared<OCIO::Lut1DOpData>(17);
 
-    auto & lutValues = lut->getArray().getValues();
-    for (auto & val : lutValues)
+    const size_t numValues = lut->getArray().getValues().size();
+    float * values = lut->getArray().getValues().mutableData();
+    for (size_t idx = 0; idx < numValues; ++idx)
     {
-        val *= val;
+        values[idx] *= values[idx];
     }
 
     OCIO::ConstLut1DOpDataRcPtr lutFwd1 = lut->clone();
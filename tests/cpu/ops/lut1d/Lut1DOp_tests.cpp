@@ -16,14 +16,14 @@ namespace OCIO = OCIO_NAMESPACE;
 OCIO_ADD_TEST(Lut1DOp, extrapolation_errors)
 {
     OCIO::Lut1DOpDataRcPtr lut = std::make_shared<OCIO::Lut1DOpData>(3);
-    auto & lutArray = lut->getArray();
+    float * lutValues = lut->getArray().getValues().mutableData();
 
     // Simple y=x+0.1 LUT.
     for (int i = 0; i < 3; ++i)
     {
         for (int c = 0; c < 3; ++c)
         {
-            lutArray[c + i * 3] += 0.1f;
+            lutValues[c + i * 3] += 0.1f;
         }
     }
 
@@ -58,13 +58,11 @@ OCIO_ADD_TEST(Lut1DOp, extrapolation_errors)
 OCIO_ADD_TEST(Lut1DOp, inverse)
 {
     OCIO::Lut1DOpDataRcPtr luta = std::make_shared<OCIO::Lut1DOpData>(3);
-    auto & lutaArray = luta->getArray();
-    lutaArray[0] = 0.1f;
+    luta->getArray().getValues().mutableData()[0] = 0.1f;
 
     OCIO::Lut1DOpDataRcPtr lutb = luta->clone();
     OCIO::Lut1DOpDataRcPtr lutc = luta->clone();
-    auto & lutcArray = lutc->getArray();
-    lutcArray[0] = 0.2f;
+    lutc->getArray().getValues().mutableData()[0] = 0.2f;
 
     OCIO::OpRcPtrVec ops;
     OCIO_CHECK_NO_THROW(CreateLut1DOp(ops, luta, OCIO::TRANSFORM_DIR_FORWARD));
@@ -128,7 +126,7 @@ OCIO::Lut1DOpDataRcPtr CreateSquareLut()
     // Make a LUT that squares the input.
     static constexpr int size = 256;
     OCIO::Lut1DOpDataRcPtr lut = std::make_shared<OCIO::Lut1DOpData>(size);
-    auto & lutArray = lut->getArray();
+    float * lutValues = lut->getArray().getValues().mutableData();
 
     for (int i = 0; i < size; ++i)
     {
@@ -137,7 +135,7 @@ OCIO::Lut1DOpDataRcPtr CreateSquareLut()
 
         for (int c = 0; c < 3; ++c)
         {
-            lutArray[c + i * 3] = x2;
+            lutValues[c + i * 3] = x2;
         }
     }
     return lut;
@@ -365,7 +363,7 @@ OCIO_ADD_TEST(Lut1D, compose_big_domain)
 {
     auto lut1 = std::make_shared<OCIO::Lut1DOpData>(10);
     auto lut2 = std::make_shared<OCIO::Lut1DOpData>(10);
-    lut1->getArray()[9 * 3] = 1.0001f;
+    lut1->getArray().getValues().mutableData()[9 * 3] = 1.0001f;
 
     OCIO::OpRcPtrVec ops;
     OCIO::CreateLut1DOp(ops, lut1, OCIO::TRANSFORM_DIR_FORWARD);
@@ -434,9 +432,9 @@ OCIO_ADD_TEST(Lut1D, create_transform)
 
     auto lut = std::make_shared<OCIO::Lut1DOpData>(OCIO::Lut1DOpData::LUT_STANDARD, 3, false);
     lut->setFileOutputBitDepth(OCIO::BIT_DEPTH_UINT10);
-    lut->getArray()[3] = 0.51f;
-    lut->getArray()[4] = 0.52f;
-    lut->getArray()[5] = 0.53f;
+    lut->getArray().getValues().mutableData()[3] = 0.51f;
+    lut->getArray().getValues().mutableData()[4] = 0.52f;
+    lut->getArray().getValues().mutableData()[5] = 0.53f;
 
     auto & metadataSource = lut->getFormatMetadata();
     metadataSource.addAttribute(OCIO::METADATA_NAME, "test");
@@ -15,7 +15,7 @@ void Lut3DRendererNaNTest(OCIO::Interpolation interpol)
 {
     OCIO::Lut3DOpDataRcPtr lut = std::make_shared<OCIO::Lut3DOpData>(interpol, 4);
 
-    float * values = &lut->getArray().getValues()[0];
+    float * values = lut->getArray().getValues().mutableData();
     // Change LUT so that it is not identity.
     values[65] += 0.001f;
 
@@ -55,3 +55,190 @@ OCIO_ADD_TEST(Lut3DRenderer, nan_tetra_test)
     Lut3DRendererNaNTest(OCIO::INTERP_TETRAHEDRAL);
 }
 
+
+OCIO_ADD_TEST(Lut3DRenderer, opt_lut_cache)
+{
+    OCIO::Lut3DOpDataRcPtr lut
+        = std::make_shared<OCIO::Lut3DOpData>(OCIO::INTERP_TETRAHEDRAL, 17);
+    lut->getArray().getValues().mutableData()[100] = 0.5f;
+
+    OCIO::ConstLut3DOpDataRcPtr constLut = lut;
+    OCIO::ConstOpCPURcPtr renderer1 = OCIO::GetLut3DRenderer(constLut);
+    OCIO::ConstOpCPURcPtr renderer2 = OCIO::GetLut3DRenderer(constLut);
+
+    auto lutRenderer1 = OCIO::DynamicPtrCast<const OCIO::BaseLut3DRenderer>(renderer1);
+    auto lutRenderer2 = OCIO::DynamicPtrCast<const OCIO::BaseLut3DRenderer>(renderer2);
+    OCIO_REQUIRE_ASSERT(lutRenderer1);
+    OCIO_REQUIRE_ASSERT(lutRenderer2);
+
+    // The renderers of an identical LUT share the same optimized LUT.
+    OCIO_CHECK_ASSERT(lutRenderer1->getOptLutValues());
+    OCIO_CHECK_EQUAL(lutRenderer1->getOptLutValues(), lutRenderer2->getOptLutValues());
+
+    // Even using another interpolation.
+    OCIO::Lut3DOpDataRcPtr lutLinear = lut->clone();
+    lutLinear->setInterpolation(OCIO::INTERP_LINEAR);
+    OCIO::ConstLut3DOpDataRcPtr constLutLinear = lutLinear;
+    OCIO::ConstOpCPURcPtr renderer3 = OCIO::GetLut3DRenderer(constLutLinear);
+    auto lutRenderer3 = OCIO::DynamicPtrCast<const OCIO::BaseLut3DRenderer>(renderer3);
+    OCIO_REQUIRE_ASSERT(lutRenderer3);
+    OCIO_CHECK_EQUAL(lutRenderer1->getOptLutValues(), lutRenderer3->getOptLutValues());
+
+    // A different LUT does not.
+    OCIO::Lut3DOpDataRcPtr lut2 = lut->clone();
+    lut2->getArray().getValues().mutableData()[100] = 0.25f;
+    OCIO::ConstLut3DOpDataRcPtr constLut2 = lut2;
+    OCIO::ConstOpCPURcPtr renderer4 = OCIO::GetLut3DRenderer(constLut2);
+    auto lutRenderer4 = OCIO::DynamicPtrCast<const OCIO::BaseLut3DRenderer>(renderer4);
+    OCIO_REQUIRE_ASSERT(lutRenderer4);
+    OCIO_CHECK_NE(lutRenderer1->getOptLutValues(), lutRenderer4->getOptLutValues());
+}
+
+OCIO_ADD_TEST(Lut3DRenderer, inverse_tree_cache)
+{
+    // A LUT large enough to build the RangeTree with several threads.
+    constexpr unsigned long gridSize = 65;
+    OCIO::Lut3DOpDataRcPtr fwdLut
+        = std::make_shared<OCIO::Lut3DOpData>(OCIO::INTERP_TETRAHEDRAL, gridSize);
+
+    // Make the LUT a monotonic non-linear curve.
+    const size_t numValues = fwdLut->getArray().getValues().size();
+    float * values = fwdLut->getArray().getValues().mutableData();
+    for (size_t idx = 0; idx < numValues; ++idx)
+    {
+        values[idx] = std::pow(values[idx], 1.5f) * 0.9f + 0.05f;
+    }
+
+    OCIO::ConstLut3DOpDataRcPtr invLut = fwdLut->inverse();
+    OCIO::ConstOpCPURcPtr renderer1 = OCIO::GetLut3DRenderer(invLut);
+    OCIO::ConstOpCPURcPtr renderer2 = OCIO::GetLut3DRenderer(invLut);
+
+    auto invRenderer1 = OCIO::DynamicPtrCast<const OCIO::InvLut3DRenderer>(renderer1);
+    auto invRenderer2 = OCIO::DynamicPtrCast<const OCIO::InvLut3DRenderer>(renderer2);
+    OCIO_REQUIRE_ASSERT(invRenderer1);
+    OCIO_REQUIRE_ASSERT(invRenderer2);
+
+    // The renderers of an identical LUT share the same tree.
+    OCIO_CHECK_ASSERT(invRenderer1->getTreeData());
+    OCIO_CHECK_EQUAL(invRenderer1->getTreeData(), invRenderer2->getTreeData());
+
+    // A different LUT does not.
+    OCIO::Lut3DOpDataRcPtr fwdLut2 = fwdLut->clone();
+    fwdLut2->getArray().getValues().mutableData()[100] += 0.001f;
+    OCIO::ConstLut3DOpDataRcPtr invLut2 = fwdLut2->inverse();
+    OCIO::ConstOpCPURcPtr renderer3 = OCIO::GetLut3DRenderer(invLut2);
+    auto invRenderer3 = OCIO::DynamicPtrCast<const OCIO::InvLut3DRenderer>(renderer3);
+    OCIO_REQUIRE_ASSERT(invRenderer3);
+    OCIO_CHECK_NE(invRenderer1->getTreeData(), invRenderer3->getTreeData());
+
+    // Check that the tree built in parallel allows to find the inverse.
+    const float inImage[] = { 0.10f, 0.25f, 0.70f, 0.f,
+                              0.66f, 0.25f, 0.81f, 0.5f,
+                              0.18f, 0.99f, 0.45f, 1.f,
+                              0.02f, 0.50f, 0.93f, 1.f };
+    float image[16];
+    for (unsigned i = 0; i < 16; ++i)
+    {
+        const float val = (i % 4 == 3) ? inImage[i] : std::pow(inImage[i], 1.5f) * 0.9f + 0.05f;
+        image[i] = val;
+    }
+
+    renderer1->apply(image, image, 4);
+
+    for (unsigned i = 0; i < 16; ++i)
+    {
+        OCIO_CHECK_CLOSE(image[i], inImage[i], 1e-3f);
+    }
+}
+
+namespace
+{
+
+void InvLut3DCheckSIMD(OCIO::apply_inv_lut_func * applyFunc)
+{
+    constexpr unsigned long gridSize = 17;
+    OCIO::Lut3DOpDataRcPtr fwdLut
+        = std::make_shared<OCIO::Lut3DOpData>(OCIO::INTERP_TETRAHEDRAL, gridSize);
+
+    const size_t numValues = fwdLut->getArray().getValues().size();
+    float * values = fwdLut->getArray().getValues().mutableData();
+    for (size_t idx = 0; idx < numValues; ++idx)
+    {
+        values[idx] = std::pow(values[idx], 1.2f + 0.2f * float(idx % 3)) * 0.9f + 0.05f;
+    }
+
+    OCIO::ConstLut3DOpDataRcPtr invLut = fwdLut->inverse();
+    OCIO::ConstOpCPURcPtr renderer = OCIO::GetLut3DRenderer(invLut);
+    auto invRenderer = OCIO::DynamicPtrCast<const OCIO::InvLut3DRenderer>(renderer);
+    OCIO_REQUIRE_ASSERT(invRenderer);
+
+    // Include values outside of the LUT range & special values, and a pixel count which is
+    // not a multiple of the packet sizes.
+    const float qnan = std::numeric_limits<float>::quiet_NaN();
+    const float inf = std::numeric_limits<float>::infinity();
+    constexpr long numPixels = 123;
+    std::vector<float> inImg(numPixels * 4);
+    for (long idx = 0; idx < numPixels; ++idx)
+    {
+        inImg[4 * idx + 0] = float((idx * 37) % 101) / 90.f - 0.05f;
+        inImg[4 * idx + 1] = float((idx * 53) % 103) / 100.f;
+        inImg[4 * idx + 2] = float((idx * 71) % 107) / 106.f;
+        inImg[4 * idx + 3] = float(idx);
+    }
+    inImg[4] = qnan;
+    inImg[9] = inf;
+    inImg[14] = -inf;
+
+    // The scalar search, one pixel at a time.
+    std::vector<float> refImg(inImg);
+    for (long idx = 0; idx < numPixels; ++idx)
+    {
+        renderer->apply(&refImg[4 * idx], &refImg[4 * idx], 1);
+    }
+
+    std::vector<float> outImg(inImg.size());
+    applyFunc(invRenderer->getTreeView(), inImg.data(), outImg.data(), numPixels);
+
+    for (size_t idx = 0; idx < outImg.size(); ++idx)
+    {
+        OCIO_CHECK_EQUAL(outImg[idx], refImg[idx]);
+    }
+}
+
+} // anon.
+
+#if OCIO_USE_SSE2
+OCIO_ADD_TEST(Lut3DRenderer, inverse_sse2)
+{
+    if (!OCIO::CPUInfo::instance().hasSSE2())
+    {
+        throw SkipException();
+    }
+
+    InvLut3DCheckSIMD(OCIO::applyInvTetrahedralSSE2);
+}
+#endif
+
+#if OCIO_USE_AVX2
+OCIO_ADD_TEST(Lut3DRenderer, inverse_avx2)
+{
+    if (!OCIO::CPUInfo::instance().hasAVX2())
+    {
+        throw SkipException();
+    }
+
+    InvLut3DCheckSIMD(OCIO::applyInvTetrahedralAVX2);
+}
+#endif
+
+#if OCIO_USE_AVX512
+OCIO_ADD_TEST(Lut3DRenderer, inverse_avx512)
+{
+    if (!OCIO::CPUInfo::instance().hasAVX512())
+    {
+        throw SkipException();
+    }
+
+    InvLut3DCheckSIMD(OCIO::applyInvTetrahedralAVX512);
+}
+#endif
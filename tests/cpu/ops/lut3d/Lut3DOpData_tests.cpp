@@ -30,7 +30,7 @@ OCIO_ADD_TEST(Lut3DOpData, accessors)
 
     OCIO_CHECK_EQUAL(l.getInterpolation(), interpol);
 
-    l.getArray()[0] = 1.0f;
+    l.getArray().getValues().mutableData()[0] = 1.0f;
 
     OCIO_CHECK_ASSERT(!l.isIdentity());
     OCIO_CHECK_NO_THROW(l.validate());
@@ -54,7 +54,7 @@ OCIO_ADD_TEST(Lut3DOpData, accessors)
 OCIO_ADD_TEST(Lut3DOpData, clone)
 {
     OCIO::Lut3DOpData ref(33);
-    ref.getArray()[1] = 0.1f;
+    ref.getArray().getValues().mutableData()[1] = 0.1f;
 
     OCIO::Lut3DOpDataRcPtr pClone = ref.clone();
 
@@ -138,7 +138,7 @@ OCIO_ADD_TEST(Lut3DOpData, is_inverse)
     L1NC->setName("Forward");
     // Make it not an identity.
     OCIO::Array & array = L1NC->getArray();
-    OCIO::Array::Values & values = array.getValues();
+    float * values = array.getValues().mutableData();
     values[0] = 20.f;
     OCIO_CHECK_ASSERT(!L1NC->isIdentity());
 
@@ -278,7 +278,7 @@ OCIO_ADD_TEST(Lut3DOpData, compose_2)
     OCIO_CHECK_NO_THROW(composed = OCIO::Lut3DOpData::Compose(lutData0, lutData1));
 
     OCIO_CHECK_EQUAL(composed->getArray().getLength(), (unsigned long)17);
-    const std::vector<float> & a = composed->getArray().getValues();
+    const OCIO::Array::Values & a = composed->getArray().getValues();
     OCIO_CHECK_CLOSE(a[6]    ,    2.5942142f  / 4095.0f, 1e-7f);
     OCIO_CHECK_CLOSE(a[7]    ,   29.60961342f / 4095.0f, 1e-7f);
     OCIO_CHECK_CLOSE(a[8]    ,  154.82646179f / 4095.0f, 1e-7f);
@@ -290,6 +290,82 @@ OCIO_ADD_TEST(Lut3DOpData, compose_2)
     OCIO_CHECK_CLOSE(a[14738], 4088.30493164f / 4095.0f, 1e-6f);
 }
 
+OCIO_ADD_TEST(Lut3DOpData, compose_vec)
+{
+    OCIO::ContextRcPtr context = OCIO::Context::Create();
+
+    OCIO::OpRcPtrVec ops;
+    OCIO_CHECK_NO_THROW(BuildOpsTest(ops, "clf/lut3d_bizarre.clf", context,
+                                     OCIO::TRANSFORM_DIR_FORWARD));
+    OCIO_CHECK_NO_THROW(BuildOpsTest(ops, "clf/lut3d_17x17x17_10i_12i.clf", context,
+                                     OCIO::TRANSFORM_DIR_FORWARD));
+    OCIO_REQUIRE_EQUAL(4, ops.size());
+
+    OCIO_SHARED_PTR<const OCIO::Op> op0 = ops[1];
+    OCIO_SHARED_PTR<const OCIO::Op> op1 = ops[3];
+
+    OCIO::ConstLut3DOpDataRcPtr lutData0 =
+        OCIO::DynamicPtrCast<const OCIO::Lut3DOpData>(op0->data());
+    OCIO::ConstLut3DOpDataRcPtr lutData1 =
+        OCIO::DynamicPtrCast<const OCIO::Lut3DOpData>(op1->data());
+    OCIO_REQUIRE_ASSERT(lutData0);
+    OCIO_REQUIRE_ASSERT(lutData1);
+
+    OCIO::Lut3DOpDataRcPtr composed;
+    OCIO_CHECK_NO_THROW(composed = OCIO::Lut3DOpData::Compose(lutData0, lutData1));
+
+    // Composing the whole set of ops at once gives the same result as the pair composition.
+
+    OCIO::OpRcPtrVec ops17 = ops.clone();
+    OCIO::Lut3DOpDataRcPtr composedVec;
+    OCIO_CHECK_NO_THROW(composedVec = OCIO::Lut3DOpData::ComposeVec(ops17, 17));
+    OCIO_REQUIRE_ASSERT(composedVec);
+    OCIO_CHECK_EQUAL(composedVec->getArray().getLength(), (unsigned long)17);
+
+    const OCIO::Array::Values & a = composed->getArray().getValues();
+    const OCIO::Array::Values & b = composedVec->getArray().getValues();
+    OCIO_REQUIRE_EQUAL(a.size(), b.size());
+    for (size_t idx = 0; idx < a.size(); ++idx)
+    {
+        OCIO_CHECK_CLOSE(a[idx], b[idx], 1e-6f);
+    }
+
+    // A larger grid size is evaluated in parallel and gives the same result as evaluating the
+    // ops one pixel at a time (but for the SIMD rounding differences).
+
+    const unsigned long gridSize = 65;
+    OCIO::OpRcPtrVec ops65 = ops.clone();
+    OCIO_CHECK_NO_THROW(composedVec = OCIO::Lut3DOpData::ComposeVec(ops65, gridSize));
+    OCIO_REQUIRE_ASSERT(composedVec);
+    OCIO_CHECK_EQUAL(composedVec->getArray().getLength(), gridSize);
+    OCIO_CHECK_NO_THROW(composedVec->validate());
+
+    const OCIO::Lut3DOpData identity(gridSize);
+    const OCIO::Array::Values & domain = identity.getArray().getValues();
+    const OCIO::Array::Values & c = composedVec->getArray().getValues();
+    for (size_t idx = 0; idx < c.size(); idx += 3 * 997)
+    {
+        float pixel[4] = { domain[idx], domain[idx + 1], domain[idx + 2], 1.0f };
+        for (const auto & op : ops65)
+        {
+            op->apply(pixel, pixel, 1);
+        }
+        OCIO_CHECK_CLOSE(c[idx + 0], pixel[0], 1e-6f);
+        OCIO_CHECK_CLOSE(c[idx + 1], pixel[1], 1e-6f);
+        OCIO_CHECK_CLOSE(c[idx + 2], pixel[2], 1e-6f);
+    }
+
+    // Faulty parameters.
+
+    OCIO::OpRcPtrVec noOps;
+    OCIO_CHECK_THROW_WHAT(OCIO::Lut3DOpData::ComposeVec(noOps, 17), OCIO::Exception,
+                          "There is nothing to compose the 3D LUT with");
+    OCIO_CHECK_THROW_WHAT(OCIO::Lut3DOpData::ComposeVec(ops17, 1), OCIO::Exception,
+                          "must be between 2 and 129");
+    OCIO_CHECK_THROW_WHAT(OCIO::Lut3DOpData::ComposeVec(ops17, 130), OCIO::Exception,
+                          "must be between 2 and 129");
+}
+
 OCIO_ADD_TEST(Lut3DOpData, inv_lut3d_lut_size)
 {
     const std::string fileName("clf/lut3d_17x17x17_10i_12i.clf");
@@ -317,10 +393,11 @@ OCIO_ADD_TEST(Lut3DOpData, compose_inverse_luts)
     OCIO::ConstLut3DOpDataRcPtr lutRef = std::make_shared<OCIO::Lut3DOpData>(5);
     OCIO::Lut3DOpDataRcPtr lut = lutRef->clone();
 
-    auto & lutValues = lut->getArray().getValues();
-    for (auto & val : lutValues)
+    const size_t numValues = lut->getArray().getValues().size();
+    float * values = lut->getArray().getValues().mutableData();
+    for (size_t idx = 0; idx < numValues; ++idx)
     {
-        val *= val;
+        values[idx] *= values[idx];
     }
 
     OCIO::ConstLut3DOpDataRcPtr lutFwd1 = lut->clone();
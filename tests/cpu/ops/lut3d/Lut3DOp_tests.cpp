@@ -320,7 +320,7 @@ OCIO_ADD_TEST(Lut3DOp, cpu_renderer_lut3d)
 
     // No more an 'identity LUT 3D'.
     const float arbitraryVal = 0.123456f;
-    lutData->getArray()[5] = arbitraryVal;
+    lutData->getArray().getValues().mutableData()[5] = arbitraryVal;
 
     OCIO_CHECK_NO_THROW(lut.validate());
     OCIO_CHECK_NO_THROW(lut.finalize());
@@ -585,9 +585,9 @@ OCIO_ADD_TEST(Lut3D, create_transform)
 
     lut->setFileOutputBitDepth(OCIO::BIT_DEPTH_UINT10);
 
-    lut->getArray()[39] = 0.61f;
-    lut->getArray()[40] = 0.52f;
-    lut->getArray()[41] = 0.74f;
+    lut->getArray().getValues().mutableData()[39] = 0.61f;
+    lut->getArray().getValues().mutableData()[40] = 0.52f;
+    lut->getArray().getValues().mutableData()[41] = 0.74f;
 
     auto & metadataSource = lut->getFormatMetadata();
     metadataSource.addAttribute(OCIO::METADATA_NAME, "test");
@@ -124,9 +124,9 @@ OCIO_ADD_TEST(MatrixOpData, diagonal)
 
 #define MATRIX_TEST_HAS_ALPHA(id, val)  \
 {                                       \
-    mat.getArray()[id] = val + 0.001;   \
+    mat.setArrayValue(id, val + 0.001); \
     OCIO_CHECK_ASSERT(mat.hasAlpha());  \
-    mat.getArray()[id] = val;           \
+    mat.setArrayValue(id, val);         \
     OCIO_CHECK_ASSERT(!mat.hasAlpha()); \
 }
 
@@ -34,7 +34,7 @@ void CreateGenericLutOp(OCIO::OpRcPtrVec & ops)
     // Make a LUT that squares the input.
     const unsigned long size = 256;
     OCIO::Lut1DOpDataRcPtr lut = std::make_shared<OCIO::Lut1DOpData>(size);
-    auto & lutArray = lut->getArray();
+    float * lutValues = lut->getArray().getValues().mutableData();
 
     for(unsigned long i = 0; i < size; ++i)
     {
@@ -43,7 +43,7 @@ void CreateGenericLutOp(OCIO::OpRcPtrVec & ops)
 
         for(int c=0; c<3; ++c)
         {
-            lutArray[3 * i +  c] = x2;
+            lutValues[3 * i +  c] = x2;
         }
     }
 
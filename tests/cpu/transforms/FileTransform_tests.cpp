@@ -118,6 +118,63 @@ OCIO_ADD_TEST(FileTransform, load_file_ok)
     OCIO_CHECK_ASSERT(!proc->isNoOp());
 }
 
+OCIO_ADD_TEST(FileTransform, file_cache_budget)
+{
+    OCIO::ClearAllCaches();
+
+    size_t hits = 0, misses = 0, evictions = 0, entries = 0, bytes = 0;
+    OCIO::GetFileCacheStatistics(hits, misses, evictions, entries, bytes);
+    OCIO_CHECK_EQUAL(entries, 0);
+    OCIO_CHECK_EQUAL(bytes, 0);
+
+    const size_t initialMisses    = misses;
+    const size_t initialHits      = hits;
+    const size_t initialEvictions = evictions;
+
+    const std::string lustre3DtLut("lustre_33x33x33.3dl");
+    OCIO_CHECK_NO_THROW(OCIO::GetFileTransformProcessor(lustre3DtLut));
+
+    OCIO::GetFileCacheStatistics(hits, misses, evictions, entries, bytes);
+    OCIO_CHECK_EQUAL(misses, initialMisses + 1);
+    OCIO_CHECK_EQUAL(entries, 1);
+
+    // The footprint is the in-memory size of the loaded content i.e. mostly the 3D LUT values
+    // (and not the file size).
+    const size_t lut3DSize = 33 * 33 * 33 * 3 * sizeof(float);
+    OCIO_CHECK_ASSERT(bytes > lut3DSize);
+    OCIO_CHECK_ASSERT(bytes < lut3DSize + 64 * 1024);
+
+    // A second load is served from the cache.
+
+    OCIO_CHECK_NO_THROW(OCIO::GetFileTransformProcessor(lustre3DtLut));
+
+    OCIO::GetFileCacheStatistics(hits, misses, evictions, entries, bytes);
+    OCIO_CHECK_EQUAL(hits, initialHits + 1);
+    OCIO_CHECK_EQUAL(misses, initialMisses + 1);
+
+    // With a budget only fitting one file, loading another file evicts the first one.
+
+    const size_t defaultBudget = OCIO::GetFileCacheBudget();
+    OCIO::SetFileCacheBudget(bytes + 1);
+    OCIO_CHECK_EQUAL(OCIO::GetFileCacheBudget(), bytes + 1);
+
+    const std::string discree3DtLut("discreet-3d-lut.3dl");
+    OCIO_CHECK_NO_THROW(OCIO::GetFileTransformProcessor(discree3DtLut));
+
+    OCIO::GetFileCacheStatistics(hits, misses, evictions, entries, bytes);
+    OCIO_CHECK_EQUAL(misses, initialMisses + 2);
+    OCIO_CHECK_EQUAL(evictions, initialEvictions + 1);
+    OCIO_CHECK_EQUAL(entries, 1);
+
+    OCIO_CHECK_NO_THROW(OCIO::GetFileTransformProcessor(lustre3DtLut));
+
+    OCIO::GetFileCacheStatistics(hits, misses, evictions, entries, bytes);
+    OCIO_CHECK_EQUAL(misses, initialMisses + 3);
+
+    OCIO::SetFileCacheBudget(defaultBudget);
+    OCIO::ClearAllCaches();
+}
+
 OCIO_ADD_TEST(FileTransform, load_file_fail)
 {
     // Legacy Lustre 1D LUT files. Similar to supported formats but actually
@@ -364,6 +364,35 @@ class CPUProcessorTest(unittest.TestCase):
                 delta=self.FLOAT_DELTA
             )
 
+    def test_apply_num_threads(self):
+        if not np:
+            logger.warning("NumPy not found. Skipping test!")
+            return
+
+        # Wrap buffers in ImageDesc
+        arr = self.float_rgb_3d.copy()
+        image = OCIO.PackedImageDesc(arr, 7, 3, 3)
+        dst_arr = np.zeros_like(self.float_rgb_3d)
+        dst_image = OCIO.PackedImageDesc(dst_arr, 7, 3, 3)
+
+        # The bands of lines give the same result as the single threaded apply
+        for num_threads in [0, 1, 2, 5]:
+            arr[:] = self.float_rgb_3d
+            self.default_cpu_proc_fwd.apply(image, num_threads)
+            self.default_cpu_proc_inv.apply(image, dst_image, num_threads)
+
+            for i in range(arr.size):
+                self.assertAlmostEqual(
+                    arr.flat[i],
+                    self.float_rgb_3d.flat[i] * 0.5,
+                    delta=self.FLOAT_DELTA
+                )
+                self.assertAlmostEqual(
+                    dst_arr.flat[i],
+                    self.float_rgb_3d.flat[i],
+                    delta=self.FLOAT_DELTA
+                )
+
     def test_apply_rgb_list(self):
         # Forward transform returns modified values
         fwd_result = self.default_cpu_proc_fwd.applyRGB(self.float_rgb_list)
@@ -5,6 +5,7 @@ import copy
 import unittest
 import os
 import sys
+import tempfile
 
 import PyOpenColorIO as OCIO
 from UnitTestUtils import (SIMPLE_CONFIG_VIRTUAL_DISPLAY,
@@ -1665,3 +1666,28 @@ class ConfigVirtualDisplayTest(unittest.TestCase):
         self.assertFalse(self.cfg.isDisplayTemporary('sRGB'))
         self.cfg.setDisplayTemporary('sRGB', True)
         self.assertTrue(self.cfg.isDisplayTemporary('sRGB'))
+
+    def test_serialize_snapshot(self):
+        """
+        Test the config snapshot round-trip.
+        """
+
+        snapshot = self.cfg.serializeSnapshot()
+        self.assertIsInstance(snapshot, bytes)
+
+        fd, filename = tempfile.mkstemp(suffix='.ociosnap')
+        os.close(fd)
+        try:
+            self.cfg.serializeSnapshot(filename)
+            with open(filename, 'rb') as f:
+                self.assertEqual(f.read(), snapshot)
+
+            cfg = OCIO.Config.CreateFromFile(filename)
+            self.assertEqual(cfg.serialize(), self.cfg.serialize())
+        finally:
+            os.remove(filename)
+
+        # The file could not be written.
+        with self.assertRaises(OCIO.Exception):
+            self.cfg.serializeSnapshot(os.path.join(os.path.dirname(filename),
+                                                    'missing_dir', 'config.ociosnap'))
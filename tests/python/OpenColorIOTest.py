@@ -7,6 +7,7 @@ import os
 import sys
 
 import PyOpenColorIO as OCIO
+from UnitTestUtils import TEST_DATAFILES_DIR
 
 
 class OpenColorIOTest(unittest.TestCase):
@@ -38,3 +39,67 @@ class OpenColorIOTest(unittest.TestCase):
         OCIO.SetEnvVariable(value='TOTO', name='MY_ENVAR')
         self.assertTrue(OCIO.IsEnvVariablePresent(name='MY_ENVAR'))
         self.assertEqual(OCIO.GetEnvVariable(name='MY_ENVAR'), 'TOTO')
+
+    def test_disk_cache(self):
+        """
+        Test Get/SetDiskCacheDirectory() & Get/SetDiskCacheBudget().
+        """
+        defaultDirectory = OCIO.GetDiskCacheDirectory()
+        defaultBudget = OCIO.GetDiskCacheBudget()
+
+        OCIO.SetDiskCacheBudget(numBytes=1024)
+        self.assertEqual(OCIO.GetDiskCacheBudget(), 1024)
+
+        OCIO.SetDiskCacheDirectory('')
+        self.assertEqual(OCIO.GetDiskCacheDirectory(), '')
+
+        OCIO.SetDiskCacheDirectory(defaultDirectory)
+        OCIO.SetDiskCacheBudget(defaultBudget)
+
+    def test_file_cache(self):
+        """
+        Test Get/SetFileCacheBudget() and GetFileCacheStatistics().
+        """
+        OCIO.ClearAllCaches()
+
+        hits, misses, evictions, entries, numBytes = OCIO.GetFileCacheStatistics()
+        self.assertEqual(entries, 0)
+        self.assertEqual(numBytes, 0)
+
+        config = OCIO.Config.CreateRaw()
+        file_tr = OCIO.FileTransform(src=os.path.join(TEST_DATAFILES_DIR, 'lut1d_1.spi1d'))
+        config.getProcessor(file_tr)
+
+        hits, misses, evictions, entries, numBytes = OCIO.GetFileCacheStatistics()
+        self.assertEqual(entries, 1)
+        self.assertGreater(numBytes, 0)
+
+        defaultBudget = OCIO.GetFileCacheBudget()
+        OCIO.SetFileCacheBudget(numBytes=1024)
+        self.assertEqual(OCIO.GetFileCacheBudget(), 1024)
+
+        # Negative budgets are not valid.
+        with self.assertRaises(TypeError):
+            OCIO.SetFileCacheBudget(-1)
+        self.assertEqual(OCIO.GetFileCacheBudget(), 1024)
+
+        OCIO.SetFileCacheBudget(defaultBudget)
+        self.assertEqual(OCIO.GetFileCacheBudget(), defaultBudget)
+        OCIO.ClearAllCaches()
+
+    def test_cpu_processor_chunk_size(self):
+        """
+        Test Get/SetCPUProcessorChunkSize().
+        """
+        self.assertEqual(OCIO.GetCPUProcessorChunkSize(), 0)
+
+        OCIO.SetCPUProcessorChunkSize(numPixels=256)
+        self.assertEqual(OCIO.GetCPUProcessorChunkSize(), 256)
+
+        # Negative sizes are not valid.
+        with self.assertRaises(TypeError):
+            OCIO.SetCPUProcessorChunkSize(-1)
+        self.assertEqual(OCIO.GetCPUProcessorChunkSize(), 256)
+
+        OCIO.SetCPUProcessorChunkSize(0)
+        self.assertEqual(OCIO.GetCPUProcessorChunkSize(), 0)
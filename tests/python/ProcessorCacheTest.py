@@ -69,4 +69,31 @@ colorspaces:
       # Confirm that the processor is the same.
       procE = cfg.getProcessor("cs3", "disp1", "view1", OCIO.TRANSFORM_DIR_FORWARD)
 
-      self.assertEqual(procD, procE)
\ No newline at end of file
+      self.assertEqual(procD, procE)
+
+      # Test the processor cache limits & statistics.
+
+      self.assertEqual(cfg.getProcessorCacheLimits(), (0, 0))
+
+      cfg.clearProcessorCache()
+      hits, misses, evictions, entries, numBytes = cfg.getProcessorCacheStatistics()
+      self.assertEqual(entries, 0)
+      self.assertEqual(numBytes, 0)
+
+      procF = cfg.getProcessor("cs1", "cs2")
+      procG = cfg.getProcessor("cs1", "cs3")
+      hits2, misses2, evictions2, entries, numBytes = cfg.getProcessorCacheStatistics()
+      self.assertEqual(misses2, misses + 2)
+      self.assertEqual(entries, 2)
+      self.assertGreater(numBytes, 0)
+
+      # Only keep the most recently used processor.
+      cfg.setProcessorCacheLimits(1, 0)
+      self.assertEqual(cfg.getProcessorCacheLimits(), (1, 0))
+
+      hits3, misses3, evictions3, entries, numBytes = cfg.getProcessorCacheStatistics()
+      self.assertEqual(evictions3, evictions2 + 1)
+      self.assertEqual(entries, 1)
+
+      self.assertEqual(cfg.getProcessor("cs1", "cs3"), procG)
+      self.assertNotEqual(cfg.getProcessor("cs1", "cs2"), procF)
@@ -140,6 +140,57 @@ class ProcessorTest(unittest.TestCase):
         self.assertEqual(t1.getTransformType(), OCIO.TRANSFORM_TYPE_MATRIX)
         self.assertEqual(t1.getOffset(), [3, 2, 1.5, 0])
 
+    def test_cpu_approximations(self):
+        # Test getOptimizedCPUProcessor() with approximations.
+
+        approx = OCIO.CPUApproximations()
+        self.assertFalse(approx.separablePrefixF32)
+        self.assertFalse(approx.bakeLut3D)
+        self.assertEqual(approx.bakeLut3DEdgeLength, 65)
+        self.assertEqual(approx.bakeLut3DShaperMinStops, -10.0)
+        self.assertEqual(approx.bakeLut3DShaperMaxStops, 10.0)
+        self.assertEqual(approx.bakeLut3DMaxError, 0.0)
+        self.assertEqual(approx, OCIO.CPUApproximations())
+
+        cfg = OCIO.Config().CreateRaw()
+        group = OCIO.GroupTransform()
+        group.appendTransform(OCIO.MatrixTransform(matrix = [0.8, 0.15, 0.05, 0.,
+                                                             0.1, 0.8,  0.1,  0.,
+                                                             0.05, 0.15, 0.8, 0.,
+                                                             0.,  0.,   0.,   1.]))
+        group.appendTransform(OCIO.ExponentTransform(value = [2.2, 2.2, 2.2, 1.]))
+        p = cfg.getProcessor(group)
+
+        approx.bakeLut3D = True
+        approx.bakeLut3DEdgeLength = 33
+        self.assertNotEqual(approx, OCIO.CPUApproximations())
+
+        cpu = p.getOptimizedCPUProcessor(OCIO.BIT_DEPTH_F32, OCIO.BIT_DEPTH_F32,
+                                         OCIO.OPTIMIZATION_DEFAULT, approx)
+        pixel = cpu.applyRGB([0.18, 0.18, 0.18])
+        for v in pixel:
+            self.assertAlmostEqual(v, pow(0.18, 2.2), delta=1e-4)
+
+        # Invalid settings.
+        approx.bakeLut3DEdgeLength = 1
+        with self.assertRaises(OCIO.Exception):
+            approx.validate()
+        with self.assertRaises(OCIO.Exception):
+            p.getOptimizedCPUProcessor(OCIO.BIT_DEPTH_F32, OCIO.BIT_DEPTH_F32,
+                                       OCIO.OPTIMIZATION_DEFAULT, approx)
+
+        approx.bakeLut3DEdgeLength = 65
+        approx.bakeLut3DShaperMinStops = 2.0
+        approx.bakeLut3DShaperMaxStops = -2.0
+        with self.assertRaises(OCIO.Exception):
+            approx.validate()
+
+        approx.bakeLut3DShaperMinStops = -10.0
+        approx.bakeLut3DShaperMaxStops = 10.0
+        approx.bakeLut3DMaxError = -1.0
+        with self.assertRaises(OCIO.Exception):
+            approx.validate()
+
     def test_format_meta_data(self):
         # Test FormatMetadata related functions.
 